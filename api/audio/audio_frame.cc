@@ -12,6 +12,10 @@
 
 #include <string.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
 #include "rtc_base/checks.h"
 #include "rtc_base/time_utils.h"
 
@@ -19,7 +23,8 @@ namespace webrtc {
 
 AudioFrame::AudioFrame() {
   // Visual Studio doesn't like this in the class definition.
-  static_assert(sizeof(data_) == kMaxDataSizeBytes, "kMaxDataSizeBytes");
+  static_assert(sizeof(SampleBuffer::data) == kMaxDataSizeBytes,
+                "kMaxDataSizeBytes");
 }
 
 void AudioFrame::Reset() {
@@ -42,6 +47,7 @@ void AudioFrame::ResetWithoutMuting() {
   profile_timestamp_ms_ = 0;
   packet_infos_ = RtpPacketInfos();
   absolute_capture_timestamp_ms_ = absl::nullopt;
+  level_info_ = absl::nullopt;
 }
 
 void AudioFrame::UpdateFrame(uint32_t timestamp,
@@ -65,11 +71,15 @@ void AudioFrame::UpdateFrame(uint32_t timestamp,
   const size_t length = samples_per_channel * num_channels;
   RTC_CHECK_LE(length, kMaxDataSizeSamples);
   if (data != nullptr) {
-    memcpy(data_, data, sizeof(int16_t) * length);
+    // The payload is overwritten below, so there is no need to preserve the
+    // contents of a shared buffer when detaching from it.
+    memcpy(UnshareData(/*copy_existing_data=*/false), data,
+           sizeof(int16_t) * length);
     muted_ = false;
   } else {
     muted_ = true;
   }
+  level_info_ = absl::nullopt;
 }
 
 void AudioFrame::CopyFrom(const AudioFrame& src) {
@@ -91,10 +101,10 @@ void AudioFrame::CopyFrom(const AudioFrame& src) {
 
   const size_t length = samples_per_channel_ * num_channels_;
   RTC_CHECK_LE(length, kMaxDataSizeSamples);
-  if (!src.muted()) {
-    memcpy(data_, src.data(), sizeof(int16_t) * length);
-    muted_ = false;
-  }
+  // Share the payload instead of copying it; whichever frame is written to
+  // next detaches to its own copy first (see mutable_data()).
+  buffer_ = src.buffer_;
+  level_info_ = src.level_info_;
 }
 
 void AudioFrame::UpdateProfileTimeStamp() {
@@ -109,22 +119,54 @@ int64_t AudioFrame::ElapsedProfileTimeMs() const {
   return rtc::TimeSince(profile_timestamp_ms_);
 }
 
+const AudioFrame::LevelInfo& AudioFrame::level_info() const {
+  if (!level_info_) {
+    LevelInfo info;
+    if (!muted_ && buffer_) {
+      const int16_t* samples = buffer_->data;
+      const size_t length = samples_per_channel_ * num_channels_;
+      // One fused pass instead of separate max-abs and sum-of-squares scans;
+      // the loop is simple enough for the compiler to vectorize.
+      int max_abs = 0;
+      float sum_square = 0.f;
+      for (size_t i = 0; i < length; ++i) {
+        const int value = samples[i];
+        max_abs = std::max(max_abs, std::abs(value));
+        sum_square += static_cast<float>(value) * value;
+      }
+      // abs(-32768) does not fit in an int16_t; saturate like
+      // WebRtcSpl_MaxAbsValueW16 does.
+      info.max_abs_value = static_cast<int16_t>(std::min(max_abs, 32767));
+      info.sum_square = sum_square;
+    }
+    level_info_ = info;
+  }
+  return *level_info_;
+}
+
 const int16_t* AudioFrame::data() const {
-  return muted_ ? empty_data() : data_;
+  return muted_ || !buffer_ ? empty_data() : buffer_->data;
 }
 
 // TODO(henrik.lundin) Can we skip zeroing the buffer?
 // See https://bugs.chromium.org/p/webrtc/issues/detail?id=5647.
 int16_t* AudioFrame::mutable_data() {
+  // A muted frame's buffer is zeroed below, so there is no need to preserve
+  // the contents of a shared buffer when detaching from it.
+  int16_t* data = UnshareData(/*copy_existing_data=*/!muted_);
   if (muted_) {
-    memset(data_, 0, kMaxDataSizeBytes);
+    memset(data, 0, kMaxDataSizeBytes);
     muted_ = false;
   }
-  return data_;
+  // The caller may write through the returned pointer at any time, so the
+  // cached level cannot be trusted past this point.
+  level_info_ = absl::nullopt;
+  return data;
 }
 
 void AudioFrame::Mute() {
   muted_ = true;
+  level_info_ = absl::nullopt;
 }
 
 bool AudioFrame::muted() const {
@@ -137,4 +179,18 @@ const int16_t* AudioFrame::empty_data() {
   return &null_data[0];
 }
 
+int16_t* AudioFrame::UnshareData(bool copy_existing_data) {
+  if (!buffer_) {
+    buffer_ = new rtc::RefCountedObject<SampleBuffer>();
+  } else if (!buffer_->HasOneRef()) {
+    rtc::scoped_refptr<rtc::RefCountedObject<SampleBuffer>> new_buffer(
+        new rtc::RefCountedObject<SampleBuffer>());
+    if (copy_existing_data) {
+      memcpy(new_buffer->data, buffer_->data, kMaxDataSizeBytes);
+    }
+    buffer_ = std::move(new_buffer);
+  }
+  return buffer_->data;
+}
+
 }  // namespace webrtc
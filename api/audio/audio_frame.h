@@ -16,7 +16,9 @@
 
 #include "api/audio/channel_layout.h"
 #include "api/rtp_packet_infos.h"
+#include "api/scoped_refptr.h"
 #include "rtc_base/constructor_magic.h"
+#include "rtc_base/ref_counted_object.h"
 
 namespace webrtc {
 
@@ -30,6 +32,9 @@ namespace webrtc {
  *   should be prepared for that.
  * - The total number of samples is samples_per_channel_ * num_channels_.
  * - Stereo data is interleaved starting with the left channel.
+ * - CopyFrom() shares the sample buffer between the frames and only copies it
+ *   once one of them is written to (copy-on-write), so fanning a frame out to
+ *   several read-only consumers does not copy the samples per hop.
  */
 class AudioFrame {
  public:
@@ -87,9 +92,27 @@ class AudioFrame {
   // called.
   int64_t ElapsedProfileTimeMs() const;
 
+  // Signal level of the frame, computed in a single pass over the samples and
+  // cached until the frame is next written to. Every consumer that needs a
+  // per-frame level (stats, the RTP audio-level extension, mixer ranking)
+  // should read it from here instead of rescanning the samples.
+  struct LevelInfo {
+    // Maximum absolute sample value, in [0, 32767].
+    int16_t max_abs_value = 0;
+    // Sum of squared sample values over all channels.
+    float sum_square = 0.f;
+  };
+
+  // Returns the cached level, computing it first if no write happened since
+  // the last computation. Like data(), a muted frame reads as all zeros.
+  const LevelInfo& level_info() const;
+
   // data() returns a zeroed static buffer if the frame is muted.
-  // mutable_frame() always returns a non-static buffer; the first call to
-  // mutable_frame() zeros the non-static buffer and marks the frame unmuted.
+  // mutable_data() always returns a non-static buffer; the first call to
+  // mutable_data() zeros the non-static buffer and marks the frame unmuted.
+  // If CopyFrom() left the frame sharing its buffer with another frame,
+  // mutable_data() first gives the frame its own copy, so writes never leak
+  // into other frames.
   const int16_t* data() const;
   int16_t* mutable_data();
 
@@ -151,14 +174,33 @@ class AudioFrame {
   RtpPacketInfos packet_infos_;
 
  private:
+  // Refcounted storage for the interleaved samples, so that CopyFrom() can
+  // share one buffer between frames instead of copying it. A frame detaches
+  // to its own copy before the first write, like rtc::CopyOnWriteBuffer.
+  struct SampleBuffer {
+    int16_t data[kMaxDataSizeSamples];
+  };
+
   // A permanently zeroed out buffer to represent muted frames. This is a
   // header-only class, so the only way to avoid creating a separate empty
   // buffer per translation unit is to wrap a static in an inline function.
   static const int16_t* empty_data();
 
-  int16_t data_[kMaxDataSizeSamples];
+  // Returns a buffer no other frame shares, allocating one on first use and,
+  // when |copy_existing_data| is set, filling it with the samples the frame
+  // was sharing with another frame.
+  int16_t* UnshareData(bool copy_existing_data);
+
+  // Null until the frame first carries data; muted frames are served from
+  // |empty_data()| without allocating.
+  rtc::scoped_refptr<rtc::RefCountedObject<SampleBuffer>> buffer_;
   bool muted_ = true;
 
+  // Cached result of level_info(), invalidated whenever the samples may have
+  // changed. CopyFrom() copies the cache along with the shared buffer, so the
+  // level pass runs once per distinct payload, not once per consumer.
+  mutable absl::optional<LevelInfo> level_info_;
+
   // Absolute capture timestamp when this audio frame was originally captured.
   // This is only valid for audio frames captured on this machine. The absolute
   // capture timestamp of a received frame is found in |packet_infos_|.
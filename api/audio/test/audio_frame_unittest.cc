@@ -133,4 +133,36 @@ TEST(AudioFrameTest, CopyFrom) {
   EXPECT_EQ(0, memcmp(frame2.data(), frame1.data(), sizeof(samples)));
 }
 
+TEST(AudioFrameTest, LevelInfoOfMutedFrameIsZero) {
+  AudioFrame frame;
+  EXPECT_EQ(0, frame.level_info().max_abs_value);
+  EXPECT_EQ(0.f, frame.level_info().sum_square);
+}
+
+TEST(AudioFrameTest, LevelInfoMatchesSamples) {
+  AudioFrame frame;
+  frame.samples_per_channel_ = kSamplesPerChannel;
+  frame.num_channels_ = kNumChannelsMono;
+  int16_t* frame_data = frame.mutable_data();
+  frame_data[0] = 100;
+  frame_data[1] = -200;
+
+  EXPECT_EQ(200, frame.level_info().max_abs_value);
+  EXPECT_EQ(100.f * 100.f + 200.f * 200.f, frame.level_info().sum_square);
+}
+
+TEST(AudioFrameTest, LevelInfoRecomputedAfterWrite) {
+  AudioFrame frame;
+  frame.samples_per_channel_ = kSamplesPerChannel;
+  frame.num_channels_ = kNumChannelsMono;
+  frame.mutable_data()[0] = 100;
+  EXPECT_EQ(100, frame.level_info().max_abs_value);
+
+  frame.mutable_data()[0] = -300;
+  EXPECT_EQ(300, frame.level_info().max_abs_value);
+
+  frame.Mute();
+  EXPECT_EQ(0, frame.level_info().max_abs_value);
+}
+
 }  // namespace webrtc
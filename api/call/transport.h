@@ -35,6 +35,10 @@ struct PacketOptions {
   bool is_retransmit = false;
   bool included_in_feedback = false;
   bool included_in_allocation = false;
+  // Whether the socket layer may briefly coalesce this packet with others for
+  // the same destination and send them in one syscall (see
+  // rtc::PacketOptions::batchable).
+  bool batchable = false;
 };
 
 class Transport {
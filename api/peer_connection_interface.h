@@ -1385,11 +1385,35 @@ class RTC_EXPORT PeerConnectionFactoryInterface
 
     // Sets crypto related options, e.g. enabled cipher suites.
     CryptoOptions crypto_options = CryptoOptions::NoGcm();
+
+    // Number of network threads to shard subsequently created PeerConnections
+    // across. When greater than 1, each created PeerConnection is pinned
+    // round-robin to one of that many factory-owned network threads, and its
+    // whole ICE/DTLS/RTP path runs there, so independent connections scale
+    // across cores. 0 (the default) keeps the single shared network thread.
+    // The pool size is fixed once the first sharded connection is created.
+    // Has no effect on connections created with an injected PortAllocator,
+    // which stay on the thread the allocator was created for.
+    int network_thread_pool_size = 0;
   };
 
   // Set the options to be used for subsequently created PeerConnections.
   virtual void SetOptions(const Options& options) = 0;
 
+  // Front-loads the peer-independent parts of call setup that would otherwise
+  // run on the critical path of the first CreatePeerConnection() and offer
+  // exchange: one-time crypto library initialization and codec capability
+  // enumeration (hardware codec queries can be slow on some platforms).
+  // Everything this does also happens lazily on first use, so calling it is
+  // optional; a natural time is application startup or page load. The work is
+  // done synchronously on the calling thread. Peer-dependent steps such as
+  // ICE gathering and the DTLS handshake cannot be prewarmed here; ICE
+  // gathering starts with CreatePeerConnection(), and certificates can be
+  // pre-generated with an RTCCertificateGenerator and supplied in
+  // RTCConfiguration::certificates. Kept non-pure so that downstream mock
+  // factory classes do not need to implement it.
+  virtual void PrewarmStartup() {}
+
   // The preferred way to create a new peer connection. Simply provide the
   // configuration and a PeerConnectionDependencies structure.
   // TODO(benwright): Make pure virtual once downstream mock PC factory classes
@@ -0,0 +1,261 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/rtc_event_log_output_mapped_ring.h"
+
+#include <string.h>
+
+#include <limits>
+#include <vector>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/system/file_wrapper.h"
+
+#if defined(WEBRTC_POSIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace webrtc {
+
+namespace {
+
+// The data region is preceded by this header. The writer keeps |head| and
+// |used| consistent at every step, so a crashed process leaves at worst the
+// record it was writing unpublished.
+struct RingHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t capacity;
+  // Offset of the oldest record in the data region.
+  uint32_t head;
+  // Number of data region bytes in use, including record headers and
+  // end-of-region padding.
+  uint32_t used;
+};
+
+constexpr uint32_t kRingMagic = 0x52435452;  // "RTCR"
+constexpr uint32_t kRingVersion = 1;
+// The header is padded so the data region starts on its own cache line.
+constexpr size_t kRingHeaderSize = 64;
+// Record size marking padding between the last record and the region end.
+constexpr uint32_t kSkipMarker = std::numeric_limits<uint32_t>::max();
+
+static_assert(sizeof(RingHeader) <= kRingHeaderSize,
+              "Ring header must fit in the reserved space.");
+
+uint32_t ReadRecordSize(const uint8_t* p) {
+  uint32_t size;
+  memcpy(&size, p, sizeof(size));
+  return size;
+}
+
+}  // namespace
+
+RtcEventLogOutputMappedRing::RtcEventLogOutputMappedRing(
+    const std::string& file_name,
+    size_t capacity_bytes) {
+#if defined(WEBRTC_POSIX)
+  if (capacity_bytes < 2 * sizeof(uint32_t) ||
+      capacity_bytes > std::numeric_limits<uint32_t>::max() - kRingHeaderSize) {
+    RTC_LOG(LS_ERROR) << "Invalid event log ring capacity: " << capacity_bytes;
+    return;
+  }
+  const size_t mapping_size = kRingHeaderSize + capacity_bytes;
+  const int fd = open(file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    RTC_LOG(LS_ERROR) << "Failed to create event log ring file.";
+    return;
+  }
+  if (ftruncate(fd, mapping_size) != 0) {
+    RTC_LOG(LS_ERROR) << "Failed to size event log ring file.";
+    close(fd);
+    return;
+  }
+  void* mapping =
+      mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  // The mapping keeps the file open; the descriptor is no longer needed.
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    RTC_LOG(LS_ERROR) << "Failed to map event log ring file.";
+    return;
+  }
+  mapping_ = static_cast<uint8_t*>(mapping);
+  mapping_size_ = mapping_size;
+  data_ = mapping_ + kRingHeaderSize;
+  capacity_ = static_cast<uint32_t>(capacity_bytes);
+
+  RingHeader* header = reinterpret_cast<RingHeader*>(mapping_);
+  header->version = kRingVersion;
+  header->capacity = capacity_;
+  header->head = 0;
+  header->used = 0;
+  // Written last, so a partially initialized file is never mistaken for a
+  // valid ring.
+  header->magic = kRingMagic;
+#else
+  RTC_LOG(LS_ERROR)
+      << "Memory-mapped event log output is not supported on this platform.";
+#endif  // defined(WEBRTC_POSIX)
+}
+
+RtcEventLogOutputMappedRing::~RtcEventLogOutputMappedRing() {
+  Unmap();
+}
+
+void RtcEventLogOutputMappedRing::Unmap() {
+#if defined(WEBRTC_POSIX)
+  if (mapping_ != nullptr) {
+    munmap(mapping_, mapping_size_);
+  }
+#endif
+  mapping_ = nullptr;
+}
+
+bool RtcEventLogOutputMappedRing::IsActive() const {
+  return mapping_ != nullptr;
+}
+
+bool RtcEventLogOutputMappedRing::Write(const std::string& output) {
+  RTC_DCHECK(IsActive());
+  RingHeader* header = reinterpret_cast<RingHeader*>(mapping_);
+
+  const size_t needed = sizeof(uint32_t) + output.size();
+  // A record and the worst-case end-of-region padding preceding it must both
+  // fit; see the capacity requirement in the header file.
+  if (needed > capacity_ / 2) {
+    RTC_LOG(LS_ERROR) << "Event batch too large for the event log ring.";
+    Unmap();
+    return false;
+  }
+
+  // |head + used| never wraps more than once, since records are dropped as
+  // soon as the ring is full.
+  uint32_t tail = header->head + header->used;
+  if (tail >= capacity_)
+    tail -= capacity_;
+
+  // Records are stored contiguously. If this one does not fit before the
+  // region end, the remaining bytes are marked as padding and the record
+  // goes to the region start.
+  const uint32_t space_at_end = capacity_ - tail;
+  const uint32_t padding = space_at_end < needed ? space_at_end : 0;
+
+  while (capacity_ - header->used < padding + needed) {
+    DropOldest();
+  }
+
+  if (padding > 0) {
+    if (padding >= sizeof(uint32_t)) {
+      const uint32_t marker = kSkipMarker;
+      memcpy(data_ + tail, &marker, sizeof(marker));
+    }
+    header->used += padding;
+    tail = 0;
+  }
+
+  const uint32_t size = static_cast<uint32_t>(output.size());
+  memcpy(data_ + tail, &size, sizeof(size));
+  memcpy(data_ + tail + sizeof(size), output.data(), output.size());
+  // Publishing the record is the last step, so a crash mid-copy loses only
+  // this record.
+  header->used += needed;
+  return true;
+}
+
+void RtcEventLogOutputMappedRing::DropOldest() {
+  RingHeader* header = reinterpret_cast<RingHeader*>(mapping_);
+  RTC_DCHECK_GT(header->used, 0u);
+  const uint32_t space_at_end = capacity_ - header->head;
+  if (space_at_end < sizeof(uint32_t) ||
+      ReadRecordSize(data_ + header->head) == kSkipMarker) {
+    // End-of-region padding.
+    header->used -= space_at_end;
+    header->head = 0;
+    return;
+  }
+  const uint32_t record_size =
+      sizeof(uint32_t) + ReadRecordSize(data_ + header->head);
+  RTC_DCHECK_LE(record_size, header->used);
+  header->used -= record_size;
+  header->head += record_size;
+  if (header->head == capacity_)
+    header->head = 0;
+}
+
+// static
+bool RtcEventLogOutputMappedRing::ExtractToFile(
+    const std::string& ring_file_name,
+    const std::string& out_file_name) {
+  FileWrapper ring_file = FileWrapper::OpenReadOnly(ring_file_name);
+  if (!ring_file.is_open()) {
+    RTC_LOG(LS_ERROR) << "Failed to open event log ring file.";
+    return false;
+  }
+
+  uint8_t header_bytes[kRingHeaderSize];
+  if (ring_file.Read(header_bytes, kRingHeaderSize) != kRingHeaderSize) {
+    RTC_LOG(LS_ERROR) << "Failed to read event log ring header.";
+    return false;
+  }
+  RingHeader header;
+  memcpy(&header, header_bytes, sizeof(header));
+  if (header.magic != kRingMagic || header.version != kRingVersion ||
+      header.head >= header.capacity || header.used > header.capacity) {
+    RTC_LOG(LS_ERROR) << "Corrupt event log ring header.";
+    return false;
+  }
+
+  std::vector<uint8_t> data(header.capacity);
+  if (ring_file.Read(data.data(), data.size()) != data.size()) {
+    RTC_LOG(LS_ERROR) << "Truncated event log ring file.";
+    return false;
+  }
+
+  FileWrapper out_file = FileWrapper::OpenWriteOnly(out_file_name);
+  if (!out_file.is_open()) {
+    RTC_LOG(LS_ERROR) << "Failed to open event log output file.";
+    return false;
+  }
+
+  // Walk the records from the oldest, using the same layout rules as the
+  // writer.
+  uint32_t offset = header.head;
+  uint32_t remaining = header.used;
+  while (remaining > 0) {
+    const uint32_t space_at_end = header.capacity - offset;
+    if (space_at_end < sizeof(uint32_t) ||
+        ReadRecordSize(&data[offset]) == kSkipMarker) {
+      if (space_at_end > remaining)
+        return false;
+      remaining -= space_at_end;
+      offset = 0;
+      continue;
+    }
+    const uint32_t size = ReadRecordSize(&data[offset]);
+    if (sizeof(uint32_t) + size > remaining ||
+        sizeof(uint32_t) + size > space_at_end) {
+      RTC_LOG(LS_ERROR) << "Corrupt record in event log ring.";
+      return false;
+    }
+    if (!out_file.Write(&data[offset + sizeof(uint32_t)], size)) {
+      return false;
+    }
+    remaining -= sizeof(uint32_t) + size;
+    offset += sizeof(uint32_t) + size;
+    if (offset == header.capacity)
+      offset = 0;
+  }
+  return true;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,76 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_RTC_EVENT_LOG_OUTPUT_MAPPED_RING_H_
+#define API_RTC_EVENT_LOG_OUTPUT_MAPPED_RING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "api/rtc_event_log_output.h"
+
+namespace webrtc {
+
+// Event log output backed by a memory-mapped file of fixed size, used as a
+// ring buffer: once the ring is full, the oldest event batches are
+// overwritten. Writes are plain memory copies into the mapping, so always-on
+// logging makes no syscalls on the hot path and has a bounded footprint. The
+// mapping is file-backed and updated in a self-consistent order, so the ring
+// survives a process crash; ExtractToFile() recovers the retained batches as
+// an ordinary event log file.
+//
+// Each Write() is stored as a whole record and records are dropped whole, so
+// the extracted log always starts at an event batch boundary. The capacity
+// must comfortably exceed twice the largest batch the encoder produces;
+// larger writes deactivate the output.
+//
+// The ring file uses the byte order of the writing host and is meant to be
+// extracted on the same machine.
+class RtcEventLogOutputMappedRing final : public RtcEventLogOutput {
+ public:
+  // Creates (or overwrites) |file_name| and maps a ring of |capacity_bytes|.
+  // On platforms without memory mapping support, or if the file cannot be
+  // created, the output starts out inactive.
+  RtcEventLogOutputMappedRing(const std::string& file_name,
+                              size_t capacity_bytes);
+
+  ~RtcEventLogOutputMappedRing() override;
+
+  bool IsActive() const override;
+
+  bool Write(const std::string& output) override;
+
+  // Snapshots the retained contents of the ring file |ring_file_name|,
+  // oldest record first, into |out_file_name| as a plain encoded event log
+  // (the same format RtcEventLogOutputFile produces). Returns false if the
+  // ring file is missing or corrupt.
+  static bool ExtractToFile(const std::string& ring_file_name,
+                            const std::string& out_file_name);
+
+ private:
+  // Releases the space held by the oldest record (or end-of-region padding).
+  void DropOldest();
+
+  // Unmaps the ring, deactivating the output. The file itself is kept.
+  void Unmap();
+
+  // Null when the mapping failed or after the output has been deactivated.
+  uint8_t* mapping_ = nullptr;
+  size_t mapping_size_ = 0;
+  // Start of the data region, directly after the ring header.
+  uint8_t* data_ = nullptr;
+  uint32_t capacity_ = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // API_RTC_EVENT_LOG_OUTPUT_MAPPED_RING_H_
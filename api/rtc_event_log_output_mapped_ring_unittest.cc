@@ -0,0 +1,112 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/rtc_event_log_output_mapped_ring.h"
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "rtc_base/checks.h"
+#include "test/gtest.h"
+#include "test/testsupport/file_utils.h"
+
+namespace webrtc {
+
+class RtcEventLogOutputMappedRingTest : public ::testing::Test {
+ public:
+  RtcEventLogOutputMappedRingTest()
+      : ring_file_name_(GetFilePath("_ring")),
+        extracted_file_name_(GetFilePath("_extracted")) {
+    // Ensure no leftovers from previous runs, which might not have terminated
+    // in an orderly fashion.
+    remove(ring_file_name_.c_str());
+    remove(extracted_file_name_.c_str());
+  }
+
+  ~RtcEventLogOutputMappedRingTest() override {
+    remove(ring_file_name_.c_str());
+    remove(extracted_file_name_.c_str());
+  }
+
+ protected:
+  std::string GetFilePath(const std::string& suffix) const {
+    auto test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    return test::OutputPath() + test_info->test_case_name() +
+           test_info->name() + suffix;
+  }
+
+  std::string Extract() const {
+    RTC_CHECK(RtcEventLogOutputMappedRing::ExtractToFile(
+        ring_file_name_, extracted_file_name_));
+    std::ifstream file(extracted_file_name_,
+                       std::ios_base::in | std::ios_base::binary);
+    RTC_CHECK(file.is_open());
+    RTC_CHECK(file.good());
+    std::string file_str((std::istreambuf_iterator<char>(file)),
+                         std::istreambuf_iterator<char>());
+    return file_str;
+  }
+
+  const std::string ring_file_name_;
+  const std::string extracted_file_name_;
+};
+
+TEST_F(RtcEventLogOutputMappedRingTest, NonDefectiveOutputsStartOutActive) {
+  auto output =
+      std::make_unique<RtcEventLogOutputMappedRing>(ring_file_name_, 4096);
+  EXPECT_TRUE(output->IsActive());
+}
+
+TEST_F(RtcEventLogOutputMappedRingTest, DefectiveOutputsStartOutInactive) {
+  const std::string illegal_filename = "/////////";
+  auto output =
+      std::make_unique<RtcEventLogOutputMappedRing>(illegal_filename, 4096);
+  EXPECT_FALSE(output->IsActive());
+}
+
+TEST_F(RtcEventLogOutputMappedRingTest, ExtractRetainsAllWrittenBatches) {
+  auto output =
+      std::make_unique<RtcEventLogOutputMappedRing>(ring_file_name_, 4096);
+  ASSERT_TRUE(output->Write("abc"));
+  ASSERT_TRUE(output->Write("def"));
+  output.reset();  // The ring file outlives the output.
+  EXPECT_EQ(Extract(), "abcdef");
+}
+
+TEST_F(RtcEventLogOutputMappedRingTest, OldestBatchesAreOverwrittenWhole) {
+  // Room for only a few 10-byte batches (each takes 14 bytes in the ring).
+  auto output =
+      std::make_unique<RtcEventLogOutputMappedRing>(ring_file_name_, 64);
+  for (int i = 0; i < 10; ++i) {
+    const std::string batch(10, static_cast<char>('a' + i));
+    ASSERT_TRUE(output->Write(batch));
+  }
+  output.reset();
+  const std::string extracted = Extract();
+  // Only whole batches of the newest data remain, and the newest batch is
+  // always last.
+  EXPECT_EQ(extracted.size() % 10, 0u);
+  EXPECT_GT(extracted.size(), 0u);
+  EXPECT_EQ(extracted.substr(extracted.size() - 10), std::string(10, 'j'));
+  for (size_t i = 0; i + 10 <= extracted.size(); i += 10) {
+    EXPECT_EQ(extracted.substr(i, 10), std::string(10, extracted[i]));
+  }
+}
+
+TEST_F(RtcEventLogOutputMappedRingTest, OverlargeBatchDeactivatesOutput) {
+  auto output =
+      std::make_unique<RtcEventLogOutputMappedRing>(ring_file_name_, 64);
+  EXPECT_FALSE(output->Write(std::string(100, 'x')));
+  EXPECT_FALSE(output->IsActive());
+}
+
+}  // namespace webrtc
@@ -12,6 +12,7 @@
 #define API_TRANSPORT_GOOG_CC_FACTORY_H_
 #include <memory>
 
+#include "absl/types/optional.h"
 #include "api/network_state_predictor.h"
 #include "api/transport/network_control.h"
 #include "rtc_base/deprecation.h"
@@ -25,6 +26,9 @@ struct GoogCcFactoryConfig {
   NetworkStatePredictorFactoryInterface* network_state_predictor_factory =
       nullptr;
   bool feedback_only = false;
+  // When set, overrides the default startup probing behavior of the created
+  // controllers. See ProbingPlan in api/transport/network_types.h.
+  absl::optional<ProbingPlan> probing_plan;
 };
 
 class GoogCcNetworkControllerFactory
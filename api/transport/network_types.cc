@@ -82,6 +82,10 @@ std::vector<PacketResult> TransportPacketsFeedback::SortedByReceiveTime()
   return res;
 }
 
+ProbingPlan::ProbingPlan() = default;
+ProbingPlan::ProbingPlan(const ProbingPlan&) = default;
+ProbingPlan::~ProbingPlan() = default;
+
 NetworkControlUpdate::NetworkControlUpdate() = default;
 NetworkControlUpdate::NetworkControlUpdate(const NetworkControlUpdate&) =
     default;
@@ -216,6 +216,26 @@ struct ProbeClusterConfig {
   int32_t id = 0;
 };
 
+// Application-supplied plan for startup probing, passed to the congestion
+// controller through its factory config. Overrides the default behavior of
+// probing at fixed multiples of the start bitrate, which can take several
+// probe round trips to reach the rates needed by high-bandwidth sources.
+struct ProbingPlan {
+  ProbingPlan();
+  ProbingPlan(const ProbingPlan&);
+  ~ProbingPlan();
+  // Bitrates of the initial probe ladder, sent when the network first
+  // becomes available. When empty, the default ladder derived from the
+  // start bitrate is used.
+  std::vector<DataRate> initial_probes;
+  // When true, the network is trusted to sustain the configured bitrates;
+  // the estimate starts at the configured start bitrate and, unless
+  // |initial_probes| says otherwise, startup probing targets the
+  // configured max bitrate directly instead of climbing up from the start
+  // bitrate.
+  bool trusted_network = false;
+};
+
 struct TargetTransferRate {
   Timestamp at_time = Timestamp::PlusInfinity();
   // The estimate on which the target rate is based on.
@@ -238,6 +258,24 @@ struct NetworkControlUpdate {
   absl::optional<TargetTransferRate> target_rate;
 };
 
+// Snapshot of the pacer queue state for one media stream (ssrc). Lets the
+// congestion controller see which streams the queued data belongs to and how
+// stale it is, instead of only the aggregate queue size.
+struct PacerStreamQueueInfo {
+  uint32_t ssrc = 0;
+  size_t packet_count = 0;
+  DataSize size = DataSize::Zero();
+  // Time since the oldest queued packet of this stream was enqueued.
+  TimeDelta oldest_packet_wait_time = TimeDelta::Zero();
+};
+
+inline bool operator==(const PacerStreamQueueInfo& a,
+                       const PacerStreamQueueInfo& b) {
+  return a.ssrc == b.ssrc && a.packet_count == b.packet_count &&
+         a.size == b.size &&
+         a.oldest_packet_wait_time == b.oldest_packet_wait_time;
+}
+
 // Process control
 struct ProcessInterval {
   ProcessInterval();
@@ -245,6 +283,8 @@ struct ProcessInterval {
   ~ProcessInterval();
   Timestamp at_time = Timestamp::PlusInfinity();
   absl::optional<DataSize> pacer_queue;
+  // Per-stream breakdown of |pacer_queue|. Empty if not available.
+  std::vector<PacerStreamQueueInfo> pacer_stream_queues;
 };
 
 // Under development, subject to change without notice.
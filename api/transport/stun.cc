@@ -630,6 +630,103 @@ bool StunMessage::EqualAttributes(
   return true;
 }
 
+// StunMessageView
+
+absl::optional<StunMessageView> StunMessageView::Parse(
+    rtc::ArrayView<const uint8_t> packet) {
+  if (packet.size() < kStunHeaderSize) {
+    return absl::nullopt;
+  }
+  const uint8_t* data = packet.data();
+  const uint16_t type = rtc::GetBE16(data);
+  if (type & 0x8000) {
+    // RTP and RTCP set the MSB of first byte, since first two bits are
+    // version, and version is always 2 (10). If set, this is not a STUN
+    // packet.
+    return absl::nullopt;
+  }
+  const uint16_t length = rtc::GetBE16(data + sizeof(uint16_t));
+  if (kStunHeaderSize + length != packet.size()) {
+    return absl::nullopt;
+  }
+  // Walk the attributes to validate the framing; the values themselves are
+  // not touched.
+  size_t offset = kStunHeaderSize;
+  while (offset < packet.size()) {
+    if (packet.size() - offset < kStunAttributeHeaderSize) {
+      return absl::nullopt;
+    }
+    size_t attr_length = rtc::GetBE16(data + offset + sizeof(uint16_t));
+    // Attribute values are padded to a multiple of 4 bytes.
+    if ((attr_length % 4) != 0) {
+      attr_length += 4 - (attr_length % 4);
+    }
+    if (packet.size() - offset - kStunAttributeHeaderSize < attr_length) {
+      return absl::nullopt;
+    }
+    offset += kStunAttributeHeaderSize + attr_length;
+  }
+  return StunMessageView(packet, type, length);
+}
+
+StunMessageView::StunMessageView(rtc::ArrayView<const uint8_t> packet,
+                                 uint16_t type,
+                                 uint16_t length)
+    : packet_(packet),
+      type_(type),
+      length_(length),
+      has_magic_cookie_(
+          rtc::GetBE32(packet.data() + kStunTransactionIdOffset -
+                       kStunMagicCookieLength) == kStunMagicCookie) {}
+
+absl::string_view StunMessageView::transaction_id() const {
+  // If the magic cookie is absent, the peer implements RFC3489 and the
+  // cookie bytes are part of the (longer) transaction ID.
+  const size_t offset = has_magic_cookie_
+                            ? kStunTransactionIdOffset
+                            : kStunTransactionIdOffset - kStunMagicCookieLength;
+  return absl::string_view(reinterpret_cast<const char*>(packet_.data()) +
+                               offset,
+                           kStunHeaderSize - offset);
+}
+
+uint32_t StunMessageView::reduced_transaction_id() const {
+  const absl::string_view id = transaction_id();
+  uint32_t result = 0;
+  for (size_t i = 0; i + sizeof(uint32_t) <= id.size();
+       i += sizeof(uint32_t)) {
+    result ^= rtc::GetBE32(id.data() + i);
+  }
+  return result;
+}
+
+absl::optional<rtc::ArrayView<const uint8_t>>
+StunMessageView::GetAttributeValue(int type) const {
+  const uint8_t* data = packet_.data();
+  size_t offset = kStunHeaderSize;
+  while (offset < packet_.size()) {
+    const int attr_type = rtc::GetBE16(data + offset);
+    const size_t attr_length = rtc::GetBE16(data + offset + sizeof(uint16_t));
+    if (attr_type == type) {
+      return packet_.subview(offset + kStunAttributeHeaderSize, attr_length);
+    }
+    offset += kStunAttributeHeaderSize + attr_length;
+    if ((attr_length % 4) != 0) {
+      offset += 4 - (attr_length % 4);
+    }
+  }
+  return absl::nullopt;
+}
+
+absl::optional<uint32_t> StunMessageView::GetUInt32(int type) const {
+  const absl::optional<rtc::ArrayView<const uint8_t>> value =
+      GetAttributeValue(type);
+  if (!value || value->size() != sizeof(uint32_t)) {
+    return absl::nullopt;
+  }
+  return rtc::GetBE32(value->data());
+}
+
 // StunAttribute
 
 StunAttribute::StunAttribute(uint16_t type, uint16_t length)
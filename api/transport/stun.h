@@ -21,6 +21,9 @@
 #include <string>
 #include <vector>
 
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+#include "api/array_view.h"
 #include "rtc_base/byte_buffer.h"
 #include "rtc_base/ip_address.h"
 #include "rtc_base/socket_address.h"
@@ -270,6 +273,49 @@ class StunMessage {
   uint32_t stun_magic_cookie_;
 };
 
+// A non-owning, validated view of a STUN message in its original buffer.
+// Parse() checks the header and the attribute framing in place, without
+// heap-allocating a StunAttribute per attribute, so hot paths can reject
+// malformed packets and look up attribute values at packet rate. The view is
+// only usable as long as the underlying buffer is; use StunMessage when the
+// message must outlive the packet, or to construct messages.
+class StunMessageView {
+ public:
+  // Validates |packet| and returns a view over it, or nullopt if |packet| is
+  // not a well-formed STUN message (wrong header length field, truncated or
+  // overrunning attributes).
+  static absl::optional<StunMessageView> Parse(
+      rtc::ArrayView<const uint8_t> packet);
+
+  int type() const { return type_; }
+  // Length of the attribute section, as carried in the header.
+  size_t length() const { return length_; }
+  // True if the message carries the RFC5389 magic cookie; if false, the
+  // message uses the legacy RFC3489 format.
+  bool has_magic_cookie() const { return has_magic_cookie_; }
+  // The transaction ID; for legacy messages this includes the bytes at the
+  // magic cookie position, matching StunMessage::transaction_id().
+  absl::string_view transaction_id() const;
+  uint32_t reduced_transaction_id() const;
+
+  // Returns the value (without padding) of the first attribute of |type|, or
+  // nullopt if the message carries none.
+  absl::optional<rtc::ArrayView<const uint8_t>> GetAttributeValue(
+      int type) const;
+  // Returns the value of a 4-byte attribute of |type| in host byte order.
+  absl::optional<uint32_t> GetUInt32(int type) const;
+
+ private:
+  StunMessageView(rtc::ArrayView<const uint8_t> packet,
+                  uint16_t type,
+                  uint16_t length);
+
+  rtc::ArrayView<const uint8_t> packet_;
+  uint16_t type_;
+  uint16_t length_;
+  bool has_magic_cookie_;
+};
+
 // Base class for all STUN/TURN attributes.
 class StunAttribute {
  public:
@@ -16,6 +16,8 @@
 #include <string>
 #include <utility>
 
+#include "absl/types/optional.h"
+#include "api/array_view.h"
 #include "rtc_base/arraysize.h"
 #include "rtc_base/byte_buffer.h"
 #include "rtc_base/byte_order.h"
@@ -1193,6 +1195,96 @@ TEST_F(StunTest, FailToReadRtcpPacket) {
   CheckFailureToRead(kRtcpPacket, sizeof(kRtcpPacket));
 }
 
+TEST_F(StunTest, ViewParsesValidMessage) {
+  absl::optional<StunMessageView> view = StunMessageView::Parse(
+      rtc::MakeArrayView(kStunMessageWithIPv4MappedAddress,
+                         sizeof(kStunMessageWithIPv4MappedAddress)));
+  ASSERT_TRUE(view.has_value());
+  EXPECT_EQ(STUN_BINDING_RESPONSE, view->type());
+  EXPECT_EQ(sizeof(kStunMessageWithIPv4MappedAddress) - kStunHeaderSize,
+            view->length());
+  EXPECT_TRUE(view->has_magic_cookie());
+
+  // The view must agree with the owning parser.
+  StunMessage msg;
+  size_t size = ReadStunMessage(&msg, kStunMessageWithIPv4MappedAddress);
+  ASSERT_NE(0U, size);
+  EXPECT_EQ(msg.transaction_id(), std::string(view->transaction_id()));
+  EXPECT_EQ(msg.reduced_transaction_id(), view->reduced_transaction_id());
+
+  absl::optional<rtc::ArrayView<const uint8_t>> value =
+      view->GetAttributeValue(STUN_ATTR_MAPPED_ADDRESS);
+  ASSERT_TRUE(value.has_value());
+  EXPECT_EQ(8U, value->size());
+  EXPECT_EQ(kStunMessageWithIPv4MappedAddress + kStunHeaderSize +
+                kStunAttributeHeaderSize,
+            value->data());
+  EXPECT_FALSE(view->GetAttributeValue(STUN_ATTR_USERNAME).has_value());
+  EXPECT_FALSE(view->GetUInt32(STUN_ATTR_FINGERPRINT).has_value());
+}
+
+TEST_F(StunTest, ViewParsesLegacyMessage) {
+  unsigned char rfc3489_packet[sizeof(kStunMessageWithIPv4MappedAddress)];
+  memcpy(rfc3489_packet, kStunMessageWithIPv4MappedAddress,
+         sizeof(kStunMessageWithIPv4MappedAddress));
+  // Overwrite the magic cookie here.
+  memcpy(&rfc3489_packet[4], "ABCD", 4);
+
+  absl::optional<StunMessageView> view = StunMessageView::Parse(
+      rtc::MakeArrayView(rfc3489_packet, sizeof(rfc3489_packet)));
+  ASSERT_TRUE(view.has_value());
+  EXPECT_FALSE(view->has_magic_cookie());
+  EXPECT_EQ(kStunTransactionIdLength + 4, view->transaction_id().size());
+
+  StunMessage msg;
+  size_t size = ReadStunMessage(&msg, rfc3489_packet);
+  ASSERT_NE(0U, size);
+  EXPECT_EQ(msg.transaction_id(), std::string(view->transaction_id()));
+  EXPECT_EQ(msg.reduced_transaction_id(), view->reduced_transaction_id());
+}
+
+TEST_F(StunTest, ViewRejectsInvalidMessages) {
+  EXPECT_FALSE(StunMessageView::Parse(
+                   rtc::MakeArrayView(kStunMessageWithZeroLength,
+                                      kRealLengthOfInvalidLengthTestCases))
+                   .has_value());
+  EXPECT_FALSE(StunMessageView::Parse(
+                   rtc::MakeArrayView(kStunMessageWithSmallLength,
+                                      kRealLengthOfInvalidLengthTestCases))
+                   .has_value());
+  EXPECT_FALSE(StunMessageView::Parse(
+                   rtc::MakeArrayView(kStunMessageWithExcessLength,
+                                      kRealLengthOfInvalidLengthTestCases))
+                   .has_value());
+  EXPECT_FALSE(
+      StunMessageView::Parse(rtc::MakeArrayView(kRtcpPacket,
+                                                sizeof(kRtcpPacket)))
+          .has_value());
+  // Truncated header.
+  EXPECT_FALSE(StunMessageView::Parse(
+                   rtc::MakeArrayView(kStunMessageWithIPv4MappedAddress,
+                                      kStunHeaderSize - 1))
+          .has_value());
+}
+
+TEST_F(StunTest, ViewReadsUInt32Attribute) {
+  rtc::ByteBufferWriter out;
+  StunMessage msg;
+  msg.SetType(STUN_BINDING_REQUEST);
+  msg.SetTransactionID("0123456789ab");
+  msg.AddAttribute(
+      std::make_unique<StunUInt32Attribute>(STUN_ATTR_PRIORITY, 0x12345678));
+  ASSERT_TRUE(msg.Write(&out));
+
+  absl::optional<StunMessageView> view = StunMessageView::Parse(
+      rtc::MakeArrayView(reinterpret_cast<const uint8_t*>(out.Data()),
+                         out.Length()));
+  ASSERT_TRUE(view.has_value());
+  absl::optional<uint32_t> priority = view->GetUInt32(STUN_ATTR_PRIORITY);
+  ASSERT_TRUE(priority.has_value());
+  EXPECT_EQ(0x12345678U, *priority);
+}
+
 // Check our STUN message validation code against the RFC5769 test messages.
 TEST_F(StunTest, ValidateMessageIntegrity) {
   // Try the messages from RFC 5769.
@@ -12,9 +12,15 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>  // no-presubmit-check For hardware_concurrency() only.
 #include <utility>
+#include <vector>
 
 #include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
 #include "rtc_base/ref_counted_object.h"
 #include "third_party/libyuv/include/libyuv/convert.h"
 #include "third_party/libyuv/include/libyuv/planar_functions.h"
@@ -31,6 +37,131 @@ int I420DataSize(int height, int stride_y, int stride_u, int stride_v) {
   return stride_y * height + (stride_u + stride_v) * ((height + 1) / 2);
 }
 
+// Upper bound on the scaling worker threads; the calling thread scales one
+// band itself while it waits for the workers.
+constexpr int kMaxScaleWorkers = 3;
+
+// One horizontal band of a scaling operation. Bands cover disjoint
+// destination rows and, since band boundaries land on whole (and even)
+// source rows, the box filter reads disjoint source rows too, so bands can
+// be scaled concurrently with output identical to one full-plane call.
+struct ScaleBand {
+  const uint8_t* src_y;
+  const uint8_t* src_u;
+  const uint8_t* src_v;
+  int src_height;
+  uint8_t* dst_y;
+  uint8_t* dst_u;
+  uint8_t* dst_v;
+  int dst_height;
+};
+
+// Scales pending bands until none are left. Shared by the worker threads and
+// the calling thread.
+struct ScaleJob {
+  const I420BufferInterface* src;
+  I420Buffer* dst;
+  int src_width;
+  int dst_width;
+  std::vector<ScaleBand> bands;
+  std::atomic<size_t> next_band{0};
+
+  void ScaleBands() {
+    while (true) {
+      const size_t i = next_band.fetch_add(1);
+      if (i >= bands.size())
+        return;
+      const ScaleBand& band = bands[i];
+      int res = libyuv::I420Scale(
+          band.src_y, src->StrideY(), band.src_u, src->StrideU(), band.src_v,
+          src->StrideV(), src_width, band.src_height, band.dst_y,
+          dst->StrideY(), band.dst_u, dst->StrideU(), band.dst_v,
+          dst->StrideV(), dst_width, band.dst_height, libyuv::kFilterBox);
+      RTC_DCHECK_EQ(res, 0);
+    }
+  }
+};
+
+// A process-wide pool of scaling threads. The workers sleep between jobs;
+// the thread calling RunJob() wakes them, takes part in the work itself and
+// blocks until the job is done. Only one job runs at a time; concurrent
+// callers are serialized.
+class ScaleThreadPool {
+ public:
+  explicit ScaleThreadPool(int worker_count) {
+    workers_.reserve(worker_count);
+    for (int i = 0; i < worker_count; i++) {
+      workers_.push_back(std::make_unique<Worker>(this));
+      workers_.back()->thread.Start();
+    }
+  }
+
+  // Number of threads a job is spread over, including the calling thread.
+  int thread_count() const { return static_cast<int>(workers_.size()) + 1; }
+
+  void RunJob(ScaleJob* job) {
+    job_lock_.Wait(rtc::Event::kForever);
+    job_ = job;
+    for (auto& worker : workers_)
+      worker->start.Set();
+    job->ScaleBands();
+    for (auto& worker : workers_)
+      worker->done.Wait(rtc::Event::kForever);
+    job_ = nullptr;
+    job_lock_.Set();
+  }
+
+  // Returns the process-wide pool, or nullptr on single-core machines where
+  // scaling in parallel cannot help. The pool is intentionally leaked; its
+  // threads are idle unless a job is running.
+  static ScaleThreadPool* GetInstance() {
+    static ScaleThreadPool* const pool = []() -> ScaleThreadPool* {
+      const int cores =
+          static_cast<int>(std::thread::hardware_concurrency());
+      if (cores < 2)
+        return nullptr;
+      return new ScaleThreadPool(std::min(cores - 1, kMaxScaleWorkers));
+    }();
+    return pool;
+  }
+
+ private:
+  struct Worker {
+    explicit Worker(ScaleThreadPool* pool)
+        : pool(pool), thread(&ScaleThreadPool::WorkerRun, this, "I420Scale") {}
+    ScaleThreadPool* const pool;
+    rtc::Event start;
+    rtc::Event done;
+    rtc::PlatformThread thread;
+  };
+
+  static void WorkerRun(void* obj) {
+    Worker* worker = static_cast<Worker*>(obj);
+    while (true) {
+      worker->start.Wait(rtc::Event::kForever);
+      worker->pool->job_->ScaleBands();
+      worker->done.Set();
+    }
+  }
+
+  // Signaled when no job is running; acts as a mutex between callers.
+  rtc::Event job_lock_{false, true};
+  ScaleJob* job_ = nullptr;
+  std::vector<std::unique_ptr<Worker>> workers_;
+};
+
+// Returns the smallest positive number of destination rows whose boundary
+// falls on a whole, even source row, so that bands split at multiples of it
+// scale independently; or 0 if no such split exists.
+int MinimumBandStep(int crop_height, int dst_height) {
+  for (int step = 2; step < dst_height; step += 2) {
+    const int src_rows = step * crop_height;
+    if (src_rows % dst_height == 0 && (src_rows / dst_height) % 2 == 0)
+      return step;
+  }
+  return 0;
+}
+
 }  // namespace
 
 I420Buffer::I420Buffer(int width, int height)
@@ -227,6 +358,96 @@ void I420Buffer::ScaleFrom(const I420BufferInterface& src) {
   CropAndScaleFrom(src, 0, 0, src.width(), src.height());
 }
 
+void I420Buffer::CropAndScaleFromParallel(const I420BufferInterface& src,
+                                          int offset_x,
+                                          int offset_y,
+                                          int crop_width,
+                                          int crop_height) {
+  ScaleThreadPool* pool = ScaleThreadPool::GetInstance();
+  // Fall back to the single-threaded path when there is no pool (single
+  // core), when scaling up vertically (the interpolation then reads source
+  // rows across band boundaries), or when odd heights make the chroma split
+  // inexact.
+  if (!pool || crop_height < height() || crop_height % 2 != 0 ||
+      height() % 2 != 0) {
+    CropAndScaleFrom(src, offset_x, offset_y, crop_width, crop_height);
+    return;
+  }
+  const int min_step = MinimumBandStep(crop_height, height());
+  if (min_step == 0 || min_step * 2 > height()) {
+    CropAndScaleFrom(src, offset_x, offset_y, crop_width, crop_height);
+    return;
+  }
+  // Aim for one band per thread, keeping boundaries on multiples of
+  // |min_step| so that each boundary lands on a whole, even source row.
+  int band_step = (height() / pool->thread_count()) / min_step * min_step;
+  if (band_step == 0)
+    band_step = min_step;
+
+  RTC_CHECK_LE(crop_width, src.width());
+  RTC_CHECK_LE(crop_height, src.height());
+  RTC_CHECK_LE(crop_width + offset_x, src.width());
+  RTC_CHECK_LE(crop_height + offset_y, src.height());
+  RTC_CHECK_GE(offset_x, 0);
+  RTC_CHECK_GE(offset_y, 0);
+
+  // Make sure offset is even so that u/v plane becomes aligned.
+  const int uv_offset_x = offset_x / 2;
+  const int uv_offset_y = offset_y / 2;
+  offset_x = uv_offset_x * 2;
+  offset_y = uv_offset_y * 2;
+
+  const uint8_t* y_plane = src.DataY() + src.StrideY() * offset_y + offset_x;
+  const uint8_t* u_plane =
+      src.DataU() + src.StrideU() * uv_offset_y + uv_offset_x;
+  const uint8_t* v_plane =
+      src.DataV() + src.StrideV() * uv_offset_y + uv_offset_x;
+
+  ScaleJob job;
+  job.src = &src;
+  job.dst = this;
+  job.src_width = crop_width;
+  job.dst_width = width();
+  for (int d = 0; d < height(); d += band_step) {
+    const int d_end = std::min(d + band_step, height());
+    // Exact and even by choice of |band_step|; each band therefore scales
+    // with the same rational row ratio as the whole frame.
+    const int s = d * crop_height / height();
+    const int s_end =
+        d_end == height() ? crop_height : d_end * crop_height / height();
+    ScaleBand band;
+    band.src_y = y_plane + src.StrideY() * s;
+    band.src_u = u_plane + src.StrideU() * (s / 2);
+    band.src_v = v_plane + src.StrideV() * (s / 2);
+    band.src_height = s_end - s;
+    band.dst_y = MutableDataY() + StrideY() * d;
+    band.dst_u = MutableDataU() + StrideU() * (d / 2);
+    band.dst_v = MutableDataV() + StrideV() * (d / 2);
+    band.dst_height = d_end - d;
+    job.bands.push_back(band);
+  }
+  if (job.bands.size() < 2) {
+    CropAndScaleFrom(src, offset_x, offset_y, crop_width, crop_height);
+    return;
+  }
+  pool->RunJob(&job);
+}
+
+void I420Buffer::CropAndScaleFromParallel(const I420BufferInterface& src) {
+  const int crop_width =
+      std::min(src.width(), width() * src.height() / height());
+  const int crop_height =
+      std::min(src.height(), height() * src.width() / width());
+
+  CropAndScaleFromParallel(src, (src.width() - crop_width) / 2,
+                           (src.height() - crop_height) / 2, crop_width,
+                           crop_height);
+}
+
+void I420Buffer::ScaleFromParallel(const I420BufferInterface& src) {
+  CropAndScaleFromParallel(src, 0, 0, src.width(), src.height());
+}
+
 void I420Buffer::PasteFrom(const I420BufferInterface& picture,
                            int offset_col,
                            int offset_row) {
@@ -98,6 +98,24 @@ class RTC_EXPORT I420Buffer : public I420BufferInterface {
   // Scale all of |src| to the size of |this| buffer, with no cropping.
   void ScaleFrom(const I420BufferInterface& src);
 
+  // Same as CropAndScaleFrom(), but splits the planes into horizontal bands
+  // that are scaled on a shared worker pool, and blocks until all bands are
+  // done. The output is bit-exact with CropAndScaleFrom(). Falls back to the
+  // single-threaded path when the split cannot be made exact (vertical
+  // upscaling, odd heights or band boundaries that don't land on whole
+  // source rows) or when only one core is available.
+  void CropAndScaleFromParallel(const I420BufferInterface& src,
+                                int offset_x,
+                                int offset_y,
+                                int crop_width,
+                                int crop_height);
+
+  // Parallel variant of the center-crop CropAndScaleFrom() overload.
+  void CropAndScaleFromParallel(const I420BufferInterface& src);
+
+  // Parallel variant of ScaleFrom().
+  void ScaleFromParallel(const I420BufferInterface& src);
+
   // Pastes whole picture to canvas at (offset_row, offset_col).
   // Offsets and picture dimensions must be even.
   void PasteFrom(const I420BufferInterface& picture,
@@ -0,0 +1,107 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video/nv12_buffer.h"
+
+#include <string.h>
+
+#include "api/video/i420_buffer.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+namespace {
+
+void FillNV12Buffer(NV12Buffer* buffer, uint8_t y, uint8_t u, uint8_t v) {
+  for (int row = 0; row < buffer->height(); ++row) {
+    memset(buffer->MutableDataY() + row * buffer->StrideY(), y,
+           buffer->width());
+  }
+  for (int row = 0; row < buffer->ChromaHeight(); ++row) {
+    uint8_t* uv_row = buffer->MutableDataUV() + row * buffer->StrideUV();
+    for (int col = 0; col < buffer->ChromaWidth(); ++col) {
+      uv_row[2 * col] = u;
+      uv_row[2 * col + 1] = v;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(NV12BufferTest, InitialData) {
+  constexpr int kWidth = 3;
+  constexpr int kHeight = 3;
+
+  rtc::scoped_refptr<NV12Buffer> nv12_buffer(
+      NV12Buffer::Create(kWidth, kHeight));
+  EXPECT_EQ(VideoFrameBuffer::Type::kNV12, nv12_buffer->type());
+  EXPECT_EQ(kWidth, nv12_buffer->width());
+  EXPECT_EQ(kHeight, nv12_buffer->height());
+  // The default Y stride is the width, and the UV stride is the width rounded
+  // up to an even number of pixels.
+  EXPECT_EQ(kWidth, nv12_buffer->StrideY());
+  EXPECT_EQ(kWidth + 1, nv12_buffer->StrideUV());
+  EXPECT_EQ(2, nv12_buffer->ChromaWidth());
+  EXPECT_EQ(2, nv12_buffer->ChromaHeight());
+}
+
+TEST(NV12BufferTest, ToI420) {
+  constexpr int kWidth = 4;
+  constexpr int kHeight = 4;
+  constexpr uint8_t kYValue = 10;
+  constexpr uint8_t kUValue = 20;
+  constexpr uint8_t kVValue = 30;
+
+  rtc::scoped_refptr<NV12Buffer> nv12_buffer(
+      NV12Buffer::Create(kWidth, kHeight));
+  FillNV12Buffer(nv12_buffer.get(), kYValue, kUValue, kVValue);
+
+  rtc::scoped_refptr<I420BufferInterface> i420_buffer =
+      nv12_buffer->ToI420();
+  ASSERT_TRUE(i420_buffer);
+  EXPECT_EQ(VideoFrameBuffer::Type::kI420, i420_buffer->type());
+  EXPECT_EQ(kWidth, i420_buffer->width());
+  EXPECT_EQ(kHeight, i420_buffer->height());
+  EXPECT_EQ(kYValue, i420_buffer->DataY()[0]);
+  EXPECT_EQ(kUValue, i420_buffer->DataU()[0]);
+  EXPECT_EQ(kVValue, i420_buffer->DataV()[0]);
+}
+
+TEST(NV12BufferTest, CopyFromI420RoundTrips) {
+  constexpr int kWidth = 4;
+  constexpr int kHeight = 4;
+  constexpr uint8_t kYValue = 110;
+  constexpr uint8_t kUValue = 120;
+  constexpr uint8_t kVValue = 130;
+
+  rtc::scoped_refptr<I420Buffer> i420_buffer(
+      I420Buffer::Create(kWidth, kHeight));
+  memset(i420_buffer->MutableDataY(), kYValue,
+         i420_buffer->StrideY() * kHeight);
+  memset(i420_buffer->MutableDataU(), kUValue,
+         i420_buffer->StrideU() * i420_buffer->ChromaHeight());
+  memset(i420_buffer->MutableDataV(), kVValue,
+         i420_buffer->StrideV() * i420_buffer->ChromaHeight());
+
+  rtc::scoped_refptr<NV12Buffer> nv12_buffer =
+      NV12Buffer::Copy(*i420_buffer);
+  ASSERT_TRUE(nv12_buffer);
+  EXPECT_EQ(kYValue, nv12_buffer->DataY()[0]);
+  EXPECT_EQ(kUValue, nv12_buffer->DataUV()[0]);
+  EXPECT_EQ(kVValue, nv12_buffer->DataUV()[1]);
+
+  rtc::scoped_refptr<I420BufferInterface> round_trip =
+      nv12_buffer->ToI420();
+  EXPECT_EQ(kYValue, round_trip->DataY()[0]);
+  EXPECT_EQ(kUValue, round_trip->DataU()[0]);
+  EXPECT_EQ(kVValue, round_trip->DataV()[0]);
+}
+
+}  // namespace webrtc
@@ -0,0 +1,180 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video_codecs/video_encoder_async_init_wrapper.h"
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "api/task_queue/default_task_queue_factory.h"
+#include "api/video/i420_buffer.h"
+#include "api/video/video_frame.h"
+#include "api/video_codecs/video_codec.h"
+#include "api/video_codecs/video_encoder.h"
+#include "modules/video_coding/include/video_error_codes.h"
+#include "rtc_base/event.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+const int kWidth = 320;
+const int kHeight = 240;
+const int kNumCores = 2;
+const size_t kMaxPayloadSize = 800;
+
+const VideoEncoder::Capabilities kCapabilities(false);
+const VideoEncoder::Settings kSettings(kCapabilities,
+                                       kNumCores,
+                                       kMaxPayloadSize);
+
+// Encoder counting its calls; InitEncode() optionally blocks on |init_block_|
+// to emulate a slow hardware encoder init.
+class CountingFakeEncoder : public VideoEncoder {
+ public:
+  int32_t InitEncode(const VideoCodec* codec_settings,
+                     const VideoEncoder::Settings& settings) override {
+    if (init_block_) {
+      init_block_->Wait(rtc::Event::kForever);
+    }
+    ++init_count_;
+    return init_result_;
+  }
+
+  int32_t Encode(const VideoFrame& frame,
+                 const std::vector<VideoFrameType>* frame_types) override {
+    ++encode_count_;
+    if (frame_types) {
+      last_frame_types_ = *frame_types;
+    }
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  int32_t RegisterEncodeCompleteCallback(
+      EncodedImageCallback* callback) override {
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  int32_t Release() override {
+    ++release_count_;
+    return WEBRTC_VIDEO_CODEC_OK;
+  }
+
+  void SetRates(const RateControlParameters& parameters) override {}
+
+  EncoderInfo GetEncoderInfo() const override { return EncoderInfo(); }
+
+  rtc::Event* init_block_ = nullptr;
+  int32_t init_result_ = WEBRTC_VIDEO_CODEC_OK;
+  std::atomic<int> init_count_{0};
+  std::atomic<int> encode_count_{0};
+  std::atomic<int> release_count_{0};
+  std::vector<VideoFrameType> last_frame_types_;
+};
+
+class VideoEncoderAsyncInitWrapperTest : public ::testing::Test {
+ protected:
+  VideoEncoderAsyncInitWrapperTest()
+      : task_queue_factory_(CreateDefaultTaskQueueFactory()) {
+    auto sw = std::make_unique<CountingFakeEncoder>();
+    auto main = std::make_unique<CountingFakeEncoder>();
+    sw_encoder_ = sw.get();
+    main_encoder_ = main.get();
+    wrapper_ = CreateVideoEncoderAsyncInitWrapper(
+        task_queue_factory_.get(), std::move(sw), std::move(main));
+    codec_.codecType = kVideoCodecVP8;
+    codec_.width = kWidth;
+    codec_.height = kHeight;
+  }
+
+  VideoFrame CreateFrame() {
+    return VideoFrame::Builder()
+        .set_video_frame_buffer(I420Buffer::Create(kWidth, kHeight))
+        .set_rotation(kVideoRotation_0)
+        .set_timestamp_us(0)
+        .build();
+  }
+
+  // Encodes frames until the main encoder has picked one up, bounded to keep
+  // a broken wrapper from hanging the test.
+  bool EncodeUntilMainEncoderUsed() {
+    for (int i = 0; i < 500; ++i) {
+      EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK,
+                wrapper_->Encode(CreateFrame(), nullptr));
+      if (main_encoder_->encode_count_ > 0) {
+        return true;
+      }
+      rtc::Event().Wait(/*give_up_after_ms=*/10);
+    }
+    return false;
+  }
+
+  std::unique_ptr<TaskQueueFactory> task_queue_factory_;
+  CountingFakeEncoder* sw_encoder_;
+  CountingFakeEncoder* main_encoder_;
+  std::unique_ptr<VideoEncoder> wrapper_;
+  VideoCodec codec_;
+};
+
+TEST_F(VideoEncoderAsyncInitWrapperTest,
+       EncodesWithSoftwareEncoderWhileMainInitIsPending) {
+  rtc::Event init_block;
+  main_encoder_->init_block_ = &init_block;
+
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, wrapper_->InitEncode(&codec_, kSettings));
+  EXPECT_EQ(1, sw_encoder_->init_count_);
+
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, wrapper_->Encode(CreateFrame(), nullptr));
+  EXPECT_EQ(1, sw_encoder_->encode_count_);
+  EXPECT_EQ(0, main_encoder_->encode_count_);
+
+  init_block.Set();
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, wrapper_->Release());
+}
+
+TEST_F(VideoEncoderAsyncInitWrapperTest,
+       SwitchesToMainEncoderWithKeyFrameWhenReady) {
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, wrapper_->InitEncode(&codec_, kSettings));
+  ASSERT_TRUE(EncodeUntilMainEncoderUsed());
+
+  // The first frame given to the main encoder must be a keyframe, and the
+  // software encoder is released at the switch.
+  ASSERT_EQ(1u, main_encoder_->last_frame_types_.size());
+  EXPECT_EQ(VideoFrameType::kVideoFrameKey,
+            main_encoder_->last_frame_types_[0]);
+  EXPECT_EQ(1, sw_encoder_->release_count_);
+
+  int encodes_before = main_encoder_->encode_count_;
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, wrapper_->Encode(CreateFrame(), nullptr));
+  EXPECT_EQ(encodes_before + 1, main_encoder_->encode_count_);
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, wrapper_->Release());
+}
+
+TEST_F(VideoEncoderAsyncInitWrapperTest,
+       StaysOnSoftwareEncoderWhenMainInitFails) {
+  main_encoder_->init_result_ = WEBRTC_VIDEO_CODEC_ERROR;
+
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, wrapper_->InitEncode(&codec_, kSettings));
+  // Wait for the failed background init to finish.
+  for (int i = 0; i < 500 && main_encoder_->init_count_ == 0; ++i) {
+    rtc::Event().Wait(/*give_up_after_ms=*/10);
+  }
+  ASSERT_EQ(1, main_encoder_->init_count_);
+
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, wrapper_->Encode(CreateFrame(), nullptr));
+  EXPECT_EQ(1, sw_encoder_->encode_count_);
+  EXPECT_EQ(0, main_encoder_->encode_count_);
+  EXPECT_EQ(WEBRTC_VIDEO_CODEC_OK, wrapper_->Release());
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -47,7 +47,12 @@ bool VideoCodecVP9::operator==(const VideoCodecVP9& other) const {
           adaptiveQpMode == other.adaptiveQpMode &&
           automaticResizeOn == other.automaticResizeOn &&
           numberOfSpatialLayers == other.numberOfSpatialLayers &&
-          flexibleMode == other.flexibleMode);
+          flexibleMode == other.flexibleMode &&
+          maxEncoderThreads == other.maxEncoderThreads &&
+          tileColumnsLog2 == other.tileColumnsLog2 &&
+          rowMtOn == other.rowMtOn &&
+          frameParallelDecodingOn == other.frameParallelDecodingOn &&
+          adaptiveSpeedOn == other.adaptiveSpeedOn);
 }
 
 bool VideoCodecH264::operator==(const VideoCodecH264& other) const {
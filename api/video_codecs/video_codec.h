@@ -71,6 +71,24 @@ struct VideoCodecVP9 {
   unsigned char numberOfSpatialLayers;
   bool flexibleMode;
   InterLayerPredMode interLayerPred;
+  // Encoder performance tuning, applied by the libvpx wrapper. The values
+  // from VideoEncoder::GetDefaultVp9Settings() preserve the
+  // resolution-derived threading and tiling behavior.
+  // Caps the number of encoder threads; 0 derives the count from resolution
+  // and available cores.
+  int maxEncoderThreads;
+  // Number of tile columns, in log2 units; -1 derives it from the thread
+  // count.
+  int tileColumnsLog2;
+  // Enables row based multithreading within tile columns.
+  bool rowMtOn;
+  // Encodes without backward-adaptive probability updates so that decoders
+  // can decode frame-parallel, at a small coding efficiency cost.
+  bool frameParallelDecodingOn;
+  // Lets the encoder raise the libvpx speed setting while the produced
+  // bitrate overshoots the target, and restore it when rate control catches
+  // up again.
+  bool adaptiveSpeedOn;
 };
 
 // H264 specific.
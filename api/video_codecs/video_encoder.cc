@@ -45,6 +45,11 @@ VideoCodecVP9 VideoEncoder::GetDefaultVp9Settings() {
   vp9_settings.numberOfSpatialLayers = 1;
   vp9_settings.flexibleMode = false;
   vp9_settings.interLayerPred = InterLayerPredMode::kOn;
+  vp9_settings.maxEncoderThreads = 0;
+  vp9_settings.tileColumnsLog2 = -1;
+  vp9_settings.rowMtOn = true;
+  vp9_settings.frameParallelDecodingOn = false;
+  vp9_settings.adaptiveSpeedOn = false;
 
   return vp9_settings;
 }
@@ -166,7 +171,15 @@ std::string VideoEncoder::EncoderInfo::ToString() const {
   }
   oss << "] "
          ", supports_simulcast = "
-      << supports_simulcast << "}";
+      << supports_simulcast;
+  oss << ", preferred_pixel_formats = [";
+  for (size_t i = 0; i < preferred_pixel_formats.size(); ++i) {
+    if (i > 0) {
+      oss << ", ";
+    }
+    oss << VideoFrameBufferTypeToString(preferred_pixel_formats[i]);
+  }
+  oss << "]}";
   return oss.str();
 }
 
@@ -202,7 +215,8 @@ bool VideoEncoder::EncoderInfo::operator==(const EncoderInfo& rhs) const {
   }
 
   if (resolution_bitrate_limits != rhs.resolution_bitrate_limits ||
-      supports_simulcast != rhs.supports_simulcast) {
+      supports_simulcast != rhs.supports_simulcast ||
+      preferred_pixel_formats != rhs.preferred_pixel_formats) {
     return false;
   }
 
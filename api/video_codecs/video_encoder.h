@@ -24,6 +24,7 @@
 #include "api/video/video_bitrate_allocation.h"
 #include "api/video/video_codec_constants.h"
 #include "api/video/video_frame.h"
+#include "api/video/video_frame_buffer.h"
 #include "api/video_codecs/video_codec.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/system/rtc_export.h"
@@ -154,6 +155,7 @@ class RTC_EXPORT VideoEncoder {
   struct RTC_EXPORT EncoderInfo {
     static constexpr uint8_t kMaxFramerateFraction =
         std::numeric_limits<uint8_t>::max();
+    static constexpr size_t kMaxPreferredPixelFormats = 5;
 
     EncoderInfo();
     EncoderInfo(const EncoderInfo&);
@@ -247,6 +249,14 @@ class RTC_EXPORT VideoEncoder {
     // in such case the encoder should return
     // WEBRTC_VIDEO_CODEC_ERR_SIMULCAST_PARAMETERS_NOT_SUPPORTED.
     bool supports_simulcast;
+
+    // The pixel formats the encoder consumes natively, in order of preference.
+    // A memory-backed frame whose buffer is already in one of these formats is
+    // passed to Encode() without conversion; buffers in other formats are
+    // converted to I420 first. Encoders must always accept I420, whether
+    // listed here or not. An empty list (the default) means only I420.
+    absl::InlinedVector<VideoFrameBuffer::Type, kMaxPreferredPixelFormats>
+        preferred_pixel_formats;
   };
 
   struct RTC_EXPORT RateControlParameters {
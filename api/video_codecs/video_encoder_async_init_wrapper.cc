@@ -0,0 +1,336 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "api/video_codecs/video_encoder_async_init_wrapper.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "api/fec_controller_override.h"
+#include "api/video/video_frame.h"
+#include "api/video_codecs/video_codec.h"
+#include "modules/video_coding/include/video_error_codes.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/task_queue.h"
+
+namespace webrtc {
+
+namespace {
+
+class VideoEncoderAsyncInitWrapper final : public VideoEncoder {
+ public:
+  VideoEncoderAsyncInitWrapper(TaskQueueFactory* task_queue_factory,
+                               std::unique_ptr<VideoEncoder> sw_encoder,
+                               std::unique_ptr<VideoEncoder> main_encoder);
+  ~VideoEncoderAsyncInitWrapper() override;
+
+  void SetFecControllerOverride(
+      FecControllerOverride* fec_controller_override) override;
+
+  int32_t InitEncode(const VideoCodec* codec_settings,
+                     const VideoEncoder::Settings& settings) override;
+
+  int32_t RegisterEncodeCompleteCallback(
+      EncodedImageCallback* callback) override;
+
+  int32_t Release() override;
+
+  int32_t Encode(const VideoFrame& frame,
+                 const std::vector<VideoFrameType>* frame_types) override;
+
+  void OnPacketLossRateUpdate(float packet_loss_rate) override;
+
+  void OnRttUpdate(int64_t rtt_ms) override;
+
+  void OnLossNotification(const LossNotification& loss_notification) override;
+
+  void SetRates(const RateControlParameters& parameters) override;
+
+  EncoderInfo GetEncoderInfo() const override;
+
+ private:
+  enum class MainEncoderState {
+    kNotStarted,    // InitEncode() has not been called, or Release() was.
+    kInitializing,  // InitEncode() is running on |init_queue_|.
+    kReady,         // Initialized; switch at the next Encode() call.
+    kActive,        // All calls go to the main encoder.
+    kFailed         // Initialization failed; software encoder stays active.
+  };
+
+  // The encoder all calls are routed to. The main encoder must not be
+  // touched from the encoder queue while |init_queue_| may be running its
+  // InitEncode(); stored parameters are replayed at the switch instead.
+  VideoEncoder* current_encoder() const {
+    return software_active_ ? sw_encoder_.get() : main_encoder_.get();
+  }
+
+  // Updates |encoder| with last observed parameters, such as callbacks,
+  // rates, etc.
+  void PrimeEncoder(VideoEncoder* encoder) const;
+
+  // Hands the remaining calls over to the main encoder. Called on the
+  // encoder queue once initialization has succeeded.
+  void SwitchToMainEncoder();
+
+  // Settings used in the last InitEncode() call, replayed on the main
+  // encoder when it becomes ready.
+  VideoCodec codec_settings_;
+  absl::optional<VideoEncoder::Settings> encoder_settings_;
+  absl::optional<RateControlParameters> rate_control_parameters_;
+  absl::optional<float> packet_loss_;
+  absl::optional<int64_t> rtt_;
+  FecControllerOverride* fec_controller_override_ = nullptr;
+  absl::optional<LossNotification> loss_notification_;
+  EncodedImageCallback* callback_ = nullptr;
+
+  const std::unique_ptr<VideoEncoder> main_encoder_;
+  const std::unique_ptr<VideoEncoder> sw_encoder_;
+
+  // Only accessed on the encoder queue.
+  bool software_active_ = false;
+  bool force_key_frame_ = false;
+
+  rtc::CriticalSection lock_;
+  MainEncoderState main_state_ RTC_GUARDED_BY(lock_) =
+      MainEncoderState::kNotStarted;
+  // Incremented by InitEncode() and Release(); lets a stale init task detect
+  // that its result is no longer wanted.
+  int init_generation_ RTC_GUARDED_BY(lock_) = 0;
+
+  // Declared last so that it is destroyed first, joining any init task still
+  // running before the encoders go away.
+  rtc::TaskQueue init_queue_;
+};
+
+VideoEncoderAsyncInitWrapper::VideoEncoderAsyncInitWrapper(
+    TaskQueueFactory* task_queue_factory,
+    std::unique_ptr<VideoEncoder> sw_encoder,
+    std::unique_ptr<VideoEncoder> main_encoder)
+    : main_encoder_(std::move(main_encoder)),
+      sw_encoder_(std::move(sw_encoder)),
+      init_queue_(task_queue_factory->CreateTaskQueue(
+          "EncoderInitQueue",
+          TaskQueueFactory::Priority::NORMAL)) {
+  RTC_DCHECK(main_encoder_);
+  RTC_DCHECK(sw_encoder_);
+}
+
+VideoEncoderAsyncInitWrapper::~VideoEncoderAsyncInitWrapper() = default;
+
+void VideoEncoderAsyncInitWrapper::PrimeEncoder(VideoEncoder* encoder) const {
+  RTC_DCHECK(encoder);
+  if (callback_) {
+    encoder->RegisterEncodeCompleteCallback(callback_);
+  }
+  if (rate_control_parameters_) {
+    encoder->SetRates(*rate_control_parameters_);
+  }
+  if (rtt_.has_value()) {
+    encoder->OnRttUpdate(rtt_.value());
+  }
+  if (packet_loss_.has_value()) {
+    encoder->OnPacketLossRateUpdate(packet_loss_.value());
+  }
+  if (fec_controller_override_) {
+    encoder->SetFecControllerOverride(fec_controller_override_);
+  }
+  if (loss_notification_.has_value()) {
+    encoder->OnLossNotification(loss_notification_.value());
+  }
+}
+
+int32_t VideoEncoderAsyncInitWrapper::InitEncode(
+    const VideoCodec* codec_settings,
+    const VideoEncoder::Settings& settings) {
+  codec_settings_ = *codec_settings;
+  encoder_settings_ = settings;
+  // Clear stored rate/channel parameters.
+  rate_control_parameters_ = absl::nullopt;
+
+  int generation;
+  {
+    rtc::CritScope cs(&lock_);
+    RTC_DCHECK_EQ(main_state_, MainEncoderState::kNotStarted)
+        << "InitEncode() should never be called on an active instance!";
+    generation = ++init_generation_;
+    main_state_ = MainEncoderState::kInitializing;
+  }
+
+  int32_t sw_ret = sw_encoder_->InitEncode(codec_settings, settings);
+  if (sw_ret != WEBRTC_VIDEO_CODEC_OK) {
+    // No placeholder available; initialize the main encoder synchronously
+    // like a plain encoder would.
+    RTC_LOG(LS_WARNING) << "Software encoder failed to initialize, falling "
+                           "back to synchronous main encoder init.";
+    sw_encoder_->Release();
+    int32_t ret = main_encoder_->InitEncode(codec_settings, settings);
+    rtc::CritScope cs(&lock_);
+    main_state_ = ret == WEBRTC_VIDEO_CODEC_OK ? MainEncoderState::kActive
+                                               : MainEncoderState::kNotStarted;
+    software_active_ = false;
+    return ret;
+  }
+
+  software_active_ = true;
+  force_key_frame_ = false;
+  PrimeEncoder(sw_encoder_.get());
+
+  // Initialize the main encoder in the background; the software encoder
+  // handles frames until it is ready. |codec_settings| is captured by value
+  // since a later InitEncode() may overwrite |codec_settings_|.
+  VideoCodec codec_copy = *codec_settings;
+  init_queue_.PostTask([this, generation, codec_copy, settings] {
+    int32_t ret = main_encoder_->InitEncode(&codec_copy, settings);
+    bool stale;
+    {
+      rtc::CritScope cs(&lock_);
+      stale = generation != init_generation_;
+      if (!stale) {
+        if (ret == WEBRTC_VIDEO_CODEC_OK) {
+          main_state_ = MainEncoderState::kReady;
+        } else {
+          RTC_LOG(LS_WARNING)
+              << "Async main encoder init failed with error code " << ret
+              << ", staying on software encoder.";
+          main_state_ = MainEncoderState::kFailed;
+        }
+      }
+    }
+    // Release() or a new InitEncode() happened while we were initializing;
+    // this result is stale.
+    if (stale && ret == WEBRTC_VIDEO_CODEC_OK) {
+      main_encoder_->Release();
+    }
+  });
+
+  return WEBRTC_VIDEO_CODEC_OK;
+}
+
+int32_t VideoEncoderAsyncInitWrapper::RegisterEncodeCompleteCallback(
+    EncodedImageCallback* callback) {
+  callback_ = callback;
+  return current_encoder()->RegisterEncodeCompleteCallback(callback);
+}
+
+int32_t VideoEncoderAsyncInitWrapper::Release() {
+  bool release_main;
+  {
+    rtc::CritScope cs(&lock_);
+    ++init_generation_;
+    release_main = main_state_ == MainEncoderState::kReady ||
+                   main_state_ == MainEncoderState::kActive;
+    main_state_ = MainEncoderState::kNotStarted;
+  }
+  int32_t ret = WEBRTC_VIDEO_CODEC_OK;
+  if (software_active_) {
+    ret = sw_encoder_->Release();
+    software_active_ = false;
+  }
+  if (release_main) {
+    int32_t main_ret = main_encoder_->Release();
+    if (ret == WEBRTC_VIDEO_CODEC_OK) {
+      ret = main_ret;
+    }
+  }
+  return ret;
+}
+
+void VideoEncoderAsyncInitWrapper::SwitchToMainEncoder() {
+  RTC_LOG(LS_INFO) << "Main encoder ready, switching from software encoder.";
+  sw_encoder_->Release();
+  software_active_ = false;
+  PrimeEncoder(main_encoder_.get());
+  // The decoder has only seen software-encoded frames; start the main
+  // encoder with a keyframe so the switch is seamless.
+  force_key_frame_ = true;
+}
+
+int32_t VideoEncoderAsyncInitWrapper::Encode(
+    const VideoFrame& frame,
+    const std::vector<VideoFrameType>* frame_types) {
+  bool switch_now = false;
+  {
+    rtc::CritScope cs(&lock_);
+    if (main_state_ == MainEncoderState::kNotStarted) {
+      return WEBRTC_VIDEO_CODEC_UNINITIALIZED;
+    }
+    if (main_state_ == MainEncoderState::kReady) {
+      main_state_ = MainEncoderState::kActive;
+      switch_now = true;
+    }
+  }
+  if (switch_now) {
+    SwitchToMainEncoder();
+  }
+  if (software_active_) {
+    return sw_encoder_->Encode(frame, frame_types);
+  }
+  if (force_key_frame_) {
+    force_key_frame_ = false;
+    size_t num_streams =
+        std::max<size_t>(1, codec_settings_.numberOfSimulcastStreams);
+    std::vector<VideoFrameType> key_frame_types(
+        num_streams, VideoFrameType::kVideoFrameKey);
+    return main_encoder_->Encode(frame, &key_frame_types);
+  }
+  return main_encoder_->Encode(frame, frame_types);
+}
+
+void VideoEncoderAsyncInitWrapper::SetRates(
+    const RateControlParameters& parameters) {
+  rate_control_parameters_ = parameters;
+  current_encoder()->SetRates(parameters);
+}
+
+void VideoEncoderAsyncInitWrapper::OnPacketLossRateUpdate(
+    float packet_loss_rate) {
+  packet_loss_ = packet_loss_rate;
+  current_encoder()->OnPacketLossRateUpdate(packet_loss_rate);
+}
+
+void VideoEncoderAsyncInitWrapper::OnRttUpdate(int64_t rtt_ms) {
+  rtt_ = rtt_ms;
+  current_encoder()->OnRttUpdate(rtt_ms);
+}
+
+void VideoEncoderAsyncInitWrapper::OnLossNotification(
+    const LossNotification& loss_notification) {
+  loss_notification_ = loss_notification;
+  current_encoder()->OnLossNotification(loss_notification);
+}
+
+void VideoEncoderAsyncInitWrapper::SetFecControllerOverride(
+    FecControllerOverride* fec_controller_override) {
+  fec_controller_override_ = fec_controller_override;
+  current_encoder()->SetFecControllerOverride(fec_controller_override);
+}
+
+VideoEncoder::EncoderInfo VideoEncoderAsyncInitWrapper::GetEncoderInfo() const {
+  // While the software encoder is active, the main encoder may be in the
+  // middle of InitEncode() on |init_queue_| and must not be queried.
+  return current_encoder()->GetEncoderInfo();
+}
+
+}  // namespace
+
+std::unique_ptr<VideoEncoder> CreateVideoEncoderAsyncInitWrapper(
+    TaskQueueFactory* task_queue_factory,
+    std::unique_ptr<VideoEncoder> sw_encoder,
+    std::unique_ptr<VideoEncoder> main_encoder) {
+  return std::make_unique<VideoEncoderAsyncInitWrapper>(
+      task_queue_factory, std::move(sw_encoder), std::move(main_encoder));
+}
+
+}  // namespace webrtc
@@ -0,0 +1,38 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef API_VIDEO_CODECS_VIDEO_ENCODER_ASYNC_INIT_WRAPPER_H_
+#define API_VIDEO_CODECS_VIDEO_ENCODER_ASYNC_INIT_WRAPPER_H_
+
+#include <memory>
+
+#include "api/task_queue/task_queue_factory.h"
+#include "api/video_codecs/video_encoder.h"
+#include "rtc_base/system/rtc_export.h"
+
+namespace webrtc {
+
+// Used to wrap external VideoEncoders whose InitEncode() is slow (tens to
+// hundreds of milliseconds for some hardware encoders). InitEncode() on the
+// wrapper initializes |sw_encoder| synchronously and kicks off initialization
+// of |main_encoder| on a background task queue; frames arriving in the
+// meantime are encoded by the software encoder instead of being dropped. Once
+// the main encoder is ready, the wrapper switches to it with a forced
+// keyframe so the decoder never sees a mid-GOP encoder change. If the main
+// encoder fails to initialize, the software encoder keeps the stream running,
+// like VideoEncoderSoftwareFallbackWrapper does after an encode failure.
+RTC_EXPORT std::unique_ptr<VideoEncoder> CreateVideoEncoderAsyncInitWrapper(
+    TaskQueueFactory* task_queue_factory,
+    std::unique_ptr<VideoEncoder> sw_encoder,
+    std::unique_ptr<VideoEncoder> main_encoder);
+
+}  // namespace webrtc
+
+#endif  // API_VIDEO_CODECS_VIDEO_ENCODER_ASYNC_INIT_WRAPPER_H_
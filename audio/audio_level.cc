@@ -11,7 +11,6 @@
 #include "audio/audio_level.h"
 
 #include "api/audio/audio_frame.h"
-#include "common_audio/signal_processing/include/signal_processing_library.h"
 
 namespace webrtc {
 namespace voe {
@@ -31,8 +30,7 @@ void AudioLevel::Reset() {
 }
 
 int16_t AudioLevel::LevelFullRange() const {
-  rtc::CritScope cs(&crit_sect_);
-  return current_level_full_range_;
+  return current_level_full_range_.load(std::memory_order_relaxed);
 }
 
 void AudioLevel::ResetLevelFullRange() {
@@ -53,13 +51,9 @@ double AudioLevel::TotalDuration() const {
 }
 
 void AudioLevel::ComputeLevel(const AudioFrame& audioFrame, double duration) {
-  // Check speech level (works for 2 channels as well)
-  int16_t abs_value =
-      audioFrame.muted()
-          ? 0
-          : WebRtcSpl_MaxAbsValueW16(
-                audioFrame.data(),
-                audioFrame.samples_per_channel_ * audioFrame.num_channels_);
+  // Check speech level (works for 2 channels as well). The level is cached on
+  // the frame, so other consumers of the same frame do not rescan the samples.
+  int16_t abs_value = audioFrame.level_info().max_abs_value;
 
   // Protect member access using a lock since this method is called on a
   // dedicated audio thread in the RecordedDataIsAvailable() callback.
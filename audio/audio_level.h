@@ -11,6 +11,8 @@
 #ifndef AUDIO_AUDIO_LEVEL_H_
 #define AUDIO_AUDIO_LEVEL_H_
 
+#include <atomic>
+
 #include "rtc_base/critical_section.h"
 #include "rtc_base/thread_annotations.h"
 
@@ -63,7 +65,9 @@ class AudioLevel {
 
   int16_t abs_max_ RTC_GUARDED_BY(crit_sect_);
   int16_t count_ RTC_GUARDED_BY(crit_sect_);
-  int16_t current_level_full_range_ RTC_GUARDED_BY(crit_sect_);
+  // Written under |crit_sect_|, but atomic so LevelFullRange() can read it
+  // without taking the lock on every stats poll.
+  std::atomic<int16_t> current_level_full_range_;
 
   double total_energy_ RTC_GUARDED_BY(crit_sect_) = 0.0;
   double total_duration_ RTC_GUARDED_BY(crit_sect_) = 0.0;
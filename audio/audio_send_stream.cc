@@ -501,6 +501,10 @@ webrtc::AudioSendStream::Stats AudioSendStream::GetStats(
 
   stats.report_block_datas = std::move(call_stats.report_block_datas);
 
+  if (audio_pipeline_tap::IsEnabled()) {
+    stats.pipeline_stage_deltas = audio_pipeline_tap::GetStageDeltas();
+  }
+
   return stats;
 }
 
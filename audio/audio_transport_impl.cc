@@ -16,9 +16,11 @@
 
 #include "audio/remix_resample.h"
 #include "audio/utility/audio_frame_operations.h"
+#include "audio/utility/audio_frame_pool.h"
 #include "call/audio_sender.h"
 #include "modules/audio_processing/include/audio_frame_proxies.h"
 #include "rtc_base/checks.h"
+#include "system_wrappers/include/audio_pipeline_tap.h"
 
 namespace webrtc {
 
@@ -51,11 +53,13 @@ void ProcessCaptureFrame(uint32_t delay_ms,
                          AudioFrame* audio_frame) {
   RTC_DCHECK(audio_frame);
   if (audio_processing) {
+    audio_pipeline_tap::Record(audio_pipeline_tap::Stage::kApmEntry);
     audio_processing->set_stream_delay_ms(delay_ms);
     audio_processing->set_stream_key_pressed(key_pressed);
     int error = ProcessAudioFrame(audio_processing, audio_frame);
 
     RTC_DCHECK_EQ(0, error) << "ProcessStream() error: " << error;
+    audio_pipeline_tap::Record(audio_pipeline_tap::Stage::kApmExit);
   }
 
   if (swap_stereo_channels) {
@@ -85,7 +89,9 @@ int Resample(const AudioFrame& frame,
 
 AudioTransportImpl::AudioTransportImpl(AudioMixer* mixer,
                                        AudioProcessing* audio_processing)
-    : audio_processing_(audio_processing), mixer_(mixer) {
+    : audio_processing_(audio_processing),
+      audio_senders_(std::make_shared<const std::vector<AudioSender*>>()),
+      mixer_(mixer) {
   RTC_DCHECK(mixer);
 }
 
@@ -117,14 +123,16 @@ int32_t AudioTransportImpl::RecordedDataIsAvailable(
   int send_sample_rate_hz = 0;
   size_t send_num_channels = 0;
   bool swap_stereo_channels = false;
+  std::shared_ptr<const std::vector<AudioSender*>> senders;
   {
     rtc::CritScope lock(&capture_lock_);
     send_sample_rate_hz = send_sample_rate_hz_;
     send_num_channels = send_num_channels_;
     swap_stereo_channels = swap_stereo_channels_;
+    senders = audio_senders_;
   }
 
-  std::unique_ptr<AudioFrame> audio_frame(new AudioFrame());
+  std::unique_ptr<AudioFrame> audio_frame = AudioFramePool::AcquireFrame();
   InitializeCaptureFrame(sample_rate, send_sample_rate_hz, number_of_channels,
                          send_num_channels, audio_frame.get());
   voe::RemixAndResample(static_cast<const int16_t*>(audio_data),
@@ -135,34 +143,44 @@ int32_t AudioTransportImpl::RecordedDataIsAvailable(
                       audio_frame.get());
 
   // Typing detection (utilizes the APM/VAD decision). We let the VAD determine
-  // if we're using this feature or not.
-  // TODO(solenberg): GetConfig() takes a lock. Work around that.
+  // if we're using this feature or not. GetConfig() takes the APM lock, so
+  // the enabled flag is refreshed about once per second rather than queried
+  // on every 10 ms callback.
   bool typing_detected = false;
-  if (audio_processing_ &&
-      audio_processing_->GetConfig().voice_detection.enabled) {
-    if (audio_frame->vad_activity_ != AudioFrame::kVadUnknown) {
+  if (audio_processing_) {
+    if (typing_config_check_countdown_ <= 0) {
+      typing_detection_enabled_ =
+          audio_processing_->GetConfig().voice_detection.enabled;
+      // 100 = 1 second / data duration (10 ms).
+      typing_config_check_countdown_ = 100;
+    }
+    --typing_config_check_countdown_;
+    if (typing_detection_enabled_ &&
+        audio_frame->vad_activity_ != AudioFrame::kVadUnknown) {
       bool vad_active = audio_frame->vad_activity_ == AudioFrame::kVadActive;
       typing_detected = typing_detection_.Process(key_pressed, vad_active);
     }
   }
 
-  // Copy frame and push to each sending stream. The copy is required since an
-  // encoding task will be posted internally to each stream.
   {
     rtc::CritScope lock(&capture_lock_);
     typing_noise_detected_ = typing_detected;
+  }
 
-    RTC_DCHECK_GT(audio_frame->samples_per_channel_, 0);
-    if (!audio_senders_.empty()) {
-      auto it = audio_senders_.begin();
-      while (++it != audio_senders_.end()) {
-        std::unique_ptr<AudioFrame> audio_frame_copy(new AudioFrame());
-        audio_frame_copy->CopyFrom(*audio_frame);
-        (*it)->SendAudioData(std::move(audio_frame_copy));
-      }
-      // Send the original frame to the first stream w/o copying.
-      (*audio_senders_.begin())->SendAudioData(std::move(audio_frame));
+  // Copy frame and push to each sending stream. The copy is required since an
+  // encoding task will be posted internally to each stream. The sender list
+  // snapshot is immutable, so no lock is held while delivering.
+  RTC_DCHECK_GT(audio_frame->samples_per_channel_, 0);
+  if (!senders->empty()) {
+    auto it = senders->begin();
+    while (++it != senders->end()) {
+      std::unique_ptr<AudioFrame> audio_frame_copy =
+          AudioFramePool::AcquireFrame();
+      audio_frame_copy->CopyFrom(*audio_frame);
+      (*it)->SendAudioData(std::move(audio_frame_copy));
     }
+    // Send the original frame to the first stream w/o copying.
+    (*senders->begin())->SendAudioData(std::move(audio_frame));
   }
 
   return 0;
@@ -237,8 +255,10 @@ void AudioTransportImpl::PullRenderData(int bits_per_sample,
 void AudioTransportImpl::UpdateAudioSenders(std::vector<AudioSender*> senders,
                                             int send_sample_rate_hz,
                                             size_t send_num_channels) {
+  auto snapshot =
+      std::make_shared<const std::vector<AudioSender*>>(std::move(senders));
   rtc::CritScope lock(&capture_lock_);
-  audio_senders_ = std::move(senders);
+  audio_senders_ = std::move(snapshot);
   send_sample_rate_hz_ = send_sample_rate_hz;
   send_num_channels_ = send_num_channels;
 }
@@ -11,6 +11,7 @@
 #ifndef AUDIO_AUDIO_TRANSPORT_IMPL_H_
 #define AUDIO_AUDIO_TRANSPORT_IMPL_H_
 
+#include <memory>
 #include <vector>
 
 #include "api/audio/audio_mixer.h"
@@ -72,13 +73,26 @@ class AudioTransportImpl : public AudioTransport {
 
   // Capture side.
   rtc::CriticalSection capture_lock_;
-  std::vector<AudioSender*> audio_senders_ RTC_GUARDED_BY(capture_lock_);
+  // Immutable snapshot of the senders, replaced wholesale by
+  // UpdateAudioSenders(). The capture callback grabs a reference under the
+  // lock but delivers audio without holding it, so |capture_lock_| is only
+  // ever held for plain member copies. Note that as a consequence a removed
+  // sender may still be handed one in-flight 10 ms block; senders must stay
+  // alive until the capture callback is known to have observed the update.
+  std::shared_ptr<const std::vector<AudioSender*>> audio_senders_
+      RTC_GUARDED_BY(capture_lock_);
   int send_sample_rate_hz_ RTC_GUARDED_BY(capture_lock_) = 8000;
   size_t send_num_channels_ RTC_GUARDED_BY(capture_lock_) = 1;
   bool typing_noise_detected_ RTC_GUARDED_BY(capture_lock_) = false;
   bool swap_stereo_channels_ RTC_GUARDED_BY(capture_lock_) = false;
   PushResampler<int16_t> capture_resampler_;
   TypingDetection typing_detection_;
+  // Cached APM voice detection setting. AudioProcessing::GetConfig() takes
+  // the APM lock, so the capture callback refreshes this once per second
+  // instead of querying on every 10 ms block. Only touched on the device
+  // capture thread.
+  bool typing_detection_enabled_ = false;
+  int typing_config_check_countdown_ = 0;
 
   // Render side.
   rtc::scoped_refptr<AudioMixer> mixer_;
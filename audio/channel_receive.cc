@@ -13,6 +13,7 @@
 #include <assert.h>
 
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
@@ -187,10 +188,7 @@ class ChannelReceive : public ChannelReceiveInterface {
   void InitFrameTransformerDelegate(
       rtc::scoped_refptr<webrtc::FrameTransformerInterface> frame_transformer);
 
-  bool Playing() const {
-    rtc::CritScope lock(&playing_lock_);
-    return playing_;
-  }
+  bool Playing() const { return playing_.load(std::memory_order_relaxed); }
 
   // Thread checkers document and lock usage of some methods to specific threads
   // we know about. The goal is to eventually split up voe::ChannelReceive into
@@ -207,8 +205,15 @@ class ChannelReceive : public ChannelReceiveInterface {
   rtc::CriticalSection _callbackCritSect;
   rtc::CriticalSection volume_settings_critsect_;
 
-  rtc::CriticalSection playing_lock_;
-  bool playing_ RTC_GUARDED_BY(&playing_lock_) = false;
+  // Written on the worker thread in StartPlayout()/StopPlayout() and read
+  // for every packet on the network thread, so it is atomic rather than
+  // lock-protected.
+  std::atomic<bool> playing_{false};
+
+  // Mirrors the NACK state configured through SetNACKStatus(), so that the
+  // per-packet receive path can skip the RTCP round-trip-time query and the
+  // NetEq NACK-list query entirely when NACK is disabled.
+  std::atomic<bool> nack_enabled_{false};
 
   RtcEventLog* const event_log_;
 
@@ -296,14 +301,20 @@ void ChannelReceive::OnReceivedPayloadData(
     return;
   }
 
-  int64_t round_trip_time = 0;
-  _rtpRtcpModule->RTT(remote_ssrc_, &round_trip_time, NULL, NULL, NULL);
+  // Only query the RTCP round-trip time and NetEq's NACK list when NACK is
+  // enabled; otherwise every packet would take the RTCP and NetEq locks a
+  // second time only to produce an empty list.
+  if (nack_enabled_.load(std::memory_order_relaxed)) {
+    int64_t round_trip_time = 0;
+    _rtpRtcpModule->RTT(remote_ssrc_, &round_trip_time, NULL, NULL, NULL);
 
-  std::vector<uint16_t> nack_list = acm_receiver_.GetNackList(round_trip_time);
-  if (!nack_list.empty()) {
-    // Can't use nack_list.data() since it's not supported by all
-    // compilers.
-    ResendPackets(&(nack_list[0]), static_cast<int>(nack_list.size()));
+    std::vector<uint16_t> nack_list =
+        acm_receiver_.GetNackList(round_trip_time);
+    if (!nack_list.empty()) {
+      // Can't use nack_list.data() since it's not supported by all
+      // compilers.
+      ResendPackets(&(nack_list[0]), static_cast<int>(nack_list.size()));
+    }
   }
 }
 
@@ -538,14 +549,12 @@ void ChannelReceive::SetSink(AudioSinkInterface* sink) {
 
 void ChannelReceive::StartPlayout() {
   RTC_DCHECK(worker_thread_checker_.IsCurrent());
-  rtc::CritScope lock(&playing_lock_);
-  playing_ = true;
+  playing_.store(true, std::memory_order_relaxed);
 }
 
 void ChannelReceive::StopPlayout() {
   RTC_DCHECK(worker_thread_checker_.IsCurrent());
-  rtc::CritScope lock(&playing_lock_);
-  playing_ = false;
+  playing_.store(false, std::memory_order_relaxed);
   _outputAudioLevel.ResetLevelFullRange();
 }
 
@@ -767,6 +776,7 @@ CallReceiveStatistics ChannelReceive::GetRTCPStatistics() const {
 
 void ChannelReceive::SetNACKStatus(bool enable, int max_packets) {
   RTC_DCHECK(worker_thread_checker_.IsCurrent());
+  nack_enabled_.store(enable, std::memory_order_relaxed);
   // None of these functions can fail.
   if (enable) {
     rtp_receive_statistics_->SetMaxReorderingThreshold(max_packets);
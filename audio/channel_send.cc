@@ -23,6 +23,7 @@
 #include "api/rtc_event_log/rtc_event_log.h"
 #include "audio/channel_send_frame_transformer_delegate.h"
 #include "audio/utility/audio_frame_operations.h"
+#include "audio/utility/audio_frame_pool.h"
 #include "call/rtp_transport_controller_send_interface.h"
 #include "logging/rtc_event_log/events/rtc_event_audio_playout.h"
 #include "modules/audio_coding/audio_network_adaptor/include/audio_network_adaptor_config.h"
@@ -847,6 +848,7 @@ void ChannelSend::ProcessAndEncodeAudio(
       [this, audio_frame = std::move(audio_frame)]() mutable {
         RTC_DCHECK_RUN_ON(&encoder_queue_);
         if (!encoder_queue_is_active_) {
+          AudioFramePool::ReleaseFrame(std::move(audio_frame));
           return;
         }
         // Measure time between when the audio frame is added to the task queue
@@ -866,8 +868,10 @@ void ChannelSend::ProcessAndEncodeAudio(
           if (is_muted && previous_frame_muted_) {
             rms_level_.AnalyzeMuted(length);
           } else {
-            rms_level_.Analyze(
-                rtc::ArrayView<const int16_t>(audio_frame->data(), length));
+            // The sum of squares is cached on the frame, shared with the
+            // capture-side level computation in AudioSendStream.
+            rms_level_.AnalyzePrecomputed(audio_frame->level_info().sum_square,
+                                          length);
           }
         }
         previous_frame_muted_ = is_muted;
@@ -882,10 +886,14 @@ void ChannelSend::ProcessAndEncodeAudio(
         // callback.
         if (audio_coding_->Add10MsData(*audio_frame) < 0) {
           RTC_DLOG(LS_ERROR) << "ACM::Add10MsData() failed.";
+          AudioFramePool::ReleaseFrame(std::move(audio_frame));
           return;
         }
 
         _timeStamp += static_cast<uint32_t>(audio_frame->samples_per_channel_);
+        // The encoder is done with the frame; recycle it for the capture
+        // thread.
+        AudioFramePool::ReleaseFrame(std::move(audio_frame));
       });
 }
 
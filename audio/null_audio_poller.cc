@@ -12,8 +12,14 @@
 
 #include <stddef.h>
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include "rtc_base/checks.h"
+#include "rtc_base/critical_section.h"
 #include "rtc_base/location.h"
+#include "rtc_base/message_handler.h"
 #include "rtc_base/thread.h"
 #include "rtc_base/time_utils.h"
 
@@ -28,43 +34,94 @@ constexpr size_t kNumChannels = 1;
 constexpr uint32_t kSamplesPerSecond = 48000;            // 48kHz
 constexpr size_t kNumSamples = kSamplesPerSecond / 100;  // 10ms of samples
 
+// The process-wide poll thread shared by all NullAudioPoller instances. Each
+// tick pulls every registered transport back to back; the next tick is
+// scheduled at an absolute deadline (previous deadline + 10 ms) so the
+// cadence does not drift with per-tick processing time. Posting stops
+// entirely while no transports are registered.
+class NullAudioPollThread final : public rtc::MessageHandler {
+ public:
+  // Intentionally leaked: pollers can be destroyed during process shutdown,
+  // after static destructors would have run.
+  static NullAudioPollThread* Instance() {
+    static NullAudioPollThread* const instance = new NullAudioPollThread();
+    return instance;
+  }
+
+  void Register(AudioTransport* transport) {
+    rtc::CritScope lock(&lock_);
+    RTC_DCHECK(std::find(transports_.begin(), transports_.end(), transport) ==
+               transports_.end());
+    transports_.push_back(transport);
+    if (!polling_) {
+      polling_ = true;
+      next_deadline_ = rtc::TimeMillis() + kPollDelayMs;
+      thread_->Post(RTC_FROM_HERE, this, 0);
+    }
+  }
+
+  // Blocks until any in-progress poll of |transport| has finished, so the
+  // caller may free the transport as soon as this returns.
+  void Unregister(AudioTransport* transport) {
+    rtc::CritScope lock(&lock_);
+    auto it = std::find(transports_.begin(), transports_.end(), transport);
+    RTC_DCHECK(it != transports_.end());
+    transports_.erase(it);
+  }
+
+ private:
+  NullAudioPollThread() : thread_(rtc::Thread::Create()) {
+    thread_->SetName("NullAudioPoller", nullptr);
+    thread_->Start();
+  }
+
+  void OnMessage(rtc::Message* msg) override {
+    // Buffer to hold the audio samples.
+    int16_t buffer[kNumSamples * kNumChannels];
+    // Output variables from |NeedMorePlayData|.
+    size_t n_samples;
+    int64_t elapsed_time_ms;
+    int64_t ntp_time_ms;
+
+    // Pulling under the lock makes Unregister() a synchronization point:
+    // once it returns, the transport is guaranteed not to be called again.
+    // Registration changes are rare, so the contention is negligible.
+    rtc::CritScope lock(&lock_);
+    for (AudioTransport* transport : transports_) {
+      transport->NeedMorePlayData(kNumSamples, sizeof(int16_t), kNumChannels,
+                                  kSamplesPerSecond, buffer, n_samples,
+                                  &elapsed_time_ms, &ntp_time_ms);
+    }
+
+    if (transports_.empty()) {
+      polling_ = false;
+      return;
+    }
+    // Reschedule the next poll iteration. If, for some reason, the given
+    // deadline has already passed, reschedule as soon as possible.
+    int64_t now = rtc::TimeMillis();
+    thread_->PostAt(RTC_FROM_HERE, std::max(next_deadline_, now), this, 0);
+    // Loop after next will be kPollDelayMs later.
+    next_deadline_ += kPollDelayMs;
+  }
+
+  std::unique_ptr<rtc::Thread> thread_;
+  rtc::CriticalSection lock_;
+  std::vector<AudioTransport*> transports_ RTC_GUARDED_BY(lock_);
+  bool polling_ RTC_GUARDED_BY(lock_) = false;
+  int64_t next_deadline_ RTC_GUARDED_BY(lock_) = 0;
+};
+
 }  // namespace
 
 NullAudioPoller::NullAudioPoller(AudioTransport* audio_transport)
-    : audio_transport_(audio_transport),
-      reschedule_at_(rtc::TimeMillis() + kPollDelayMs) {
+    : audio_transport_(audio_transport) {
   RTC_DCHECK(audio_transport);
-  OnMessage(nullptr);  // Start the poll loop.
+  NullAudioPollThread::Instance()->Register(audio_transport_);
 }
 
 NullAudioPoller::~NullAudioPoller() {
-  RTC_DCHECK(thread_checker_.IsCurrent());
-  rtc::Thread::Current()->Clear(this);
-}
-
-void NullAudioPoller::OnMessage(rtc::Message* msg) {
-  RTC_DCHECK(thread_checker_.IsCurrent());
-
-  // Buffer to hold the audio samples.
-  int16_t buffer[kNumSamples * kNumChannels];
-  // Output variables from |NeedMorePlayData|.
-  size_t n_samples;
-  int64_t elapsed_time_ms;
-  int64_t ntp_time_ms;
-  audio_transport_->NeedMorePlayData(kNumSamples, sizeof(int16_t), kNumChannels,
-                                     kSamplesPerSecond, buffer, n_samples,
-                                     &elapsed_time_ms, &ntp_time_ms);
-
-  // Reschedule the next poll iteration. If, for some reason, the given
-  // reschedule time has already passed, reschedule as soon as possible.
-  int64_t now = rtc::TimeMillis();
-  if (reschedule_at_ < now) {
-    reschedule_at_ = now;
-  }
-  rtc::Thread::Current()->PostAt(RTC_FROM_HERE, reschedule_at_, this, 0);
-
-  // Loop after next will be kPollDelayMs later.
-  reschedule_at_ += kPollDelayMs;
+  NullAudioPollThread::Instance()->Unregister(audio_transport_);
 }
 
 }  // namespace internal
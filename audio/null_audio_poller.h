@@ -11,27 +11,32 @@
 #ifndef AUDIO_NULL_AUDIO_POLLER_H_
 #define AUDIO_NULL_AUDIO_POLLER_H_
 
-#include <stdint.h>
-
 #include "modules/audio_device/include/audio_device_defines.h"
-#include "rtc_base/message_handler.h"
-#include "rtc_base/thread_checker.h"
 
 namespace webrtc {
 namespace internal {
 
-class NullAudioPoller final : public rtc::MessageHandler {
+// Drives playout for an AudioState when no real audio device does (e.g.
+// server-side, where playout is disabled but receive streams still need
+// their jitter buffers pulled).
+//
+// All pollers in the process share one poll thread that ticks every 10 ms
+// against absolute deadlines and pulls the registered transports in a batch,
+// so creating many AudioStates (one per Call) does not multiply 10 ms
+// timers. Constructing the poller registers |audio_transport| with the
+// shared thread; destroying it unregisters and guarantees no further
+// NeedMorePlayData() calls are made on the transport after the destructor
+// returns.
+class NullAudioPoller final {
  public:
   explicit NullAudioPoller(AudioTransport* audio_transport);
-  ~NullAudioPoller() override;
+  ~NullAudioPoller();
 
- protected:
-  void OnMessage(rtc::Message* msg) override;
+  NullAudioPoller(const NullAudioPoller&) = delete;
+  NullAudioPoller& operator=(const NullAudioPoller&) = delete;
 
  private:
-  rtc::ThreadChecker thread_checker_;
   AudioTransport* const audio_transport_;
-  int64_t reschedule_at_;
 };
 
 }  // namespace internal
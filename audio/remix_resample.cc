@@ -40,9 +40,12 @@ void RemixAndResample(const int16_t* src_data,
   size_t audio_ptr_num_channels = num_channels;
   int16_t downmixed_audio[AudioFrame::kMaxDataSizeSamples];
 
-  // Downmix before resampling.
+  // Downmix before resampling, so that the resampler only runs on the
+  // channels that survive. The downmix writes straight into the stack buffer
+  // consumed by the resampler; no intermediate AudioFrame is created.
   if (num_channels > dst_frame->num_channels_) {
-    RTC_DCHECK(num_channels == 2 || num_channels == 4)
+    RTC_DCHECK(num_channels == 2 || num_channels == 4 || num_channels == 6 ||
+               num_channels == 8)
         << "num_channels: " << num_channels;
     RTC_DCHECK(dst_frame->num_channels_ == 1 || dst_frame->num_channels_ == 2)
         << "dst_frame->num_channels_: " << dst_frame->num_channels_;
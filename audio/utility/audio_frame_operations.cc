@@ -117,6 +117,77 @@ int AudioFrameOperations::QuadToStereo(AudioFrame* frame) {
   return 0;
 }
 
+void AudioFrameOperations::FiveOneToStereo(const int16_t* src_audio,
+                                           size_t samples_per_channel,
+                                           int16_t* dst_audio) {
+  // Weighted average with power-of-two weights summing to one, so the result
+  // cannot clip and the branch-free inner loop auto-vectorizes. The LFE
+  // channel carries no directional information and is dropped, as is common
+  // when downmixing without bass management.
+  for (size_t i = 0; i < samples_per_channel; i++) {
+    const int32_t center = src_audio[6 * i + 2];
+    dst_audio[i * 2] =
+        (2 * static_cast<int32_t>(src_audio[6 * i]) + center +
+         src_audio[6 * i + 4]) >>
+        2;
+    dst_audio[i * 2 + 1] =
+        (2 * static_cast<int32_t>(src_audio[6 * i + 1]) + center +
+         src_audio[6 * i + 5]) >>
+        2;
+  }
+}
+
+int AudioFrameOperations::FiveOneToStereo(AudioFrame* frame) {
+  if (frame->num_channels_ != 6) {
+    return -1;
+  }
+
+  RTC_DCHECK_LE(frame->samples_per_channel_ * 6,
+                AudioFrame::kMaxDataSizeSamples);
+
+  if (!frame->muted()) {
+    FiveOneToStereo(frame->data(), frame->samples_per_channel_,
+                    frame->mutable_data());
+  }
+  frame->num_channels_ = 2;
+
+  return 0;
+}
+
+void AudioFrameOperations::SevenOneToStereo(const int16_t* src_audio,
+                                            size_t samples_per_channel,
+                                            int16_t* dst_audio) {
+  // See FiveOneToStereo() for the weighting rationale.
+  for (size_t i = 0; i < samples_per_channel; i++) {
+    const int32_t center = src_audio[8 * i + 2];
+    dst_audio[i * 2] =
+        (4 * static_cast<int32_t>(src_audio[8 * i]) + 2 * center +
+         src_audio[8 * i + 4] + src_audio[8 * i + 6]) >>
+        3;
+    dst_audio[i * 2 + 1] =
+        (4 * static_cast<int32_t>(src_audio[8 * i + 1]) + 2 * center +
+         src_audio[8 * i + 5] + src_audio[8 * i + 7]) >>
+        3;
+  }
+}
+
+int AudioFrameOperations::SevenOneToStereo(AudioFrame* frame) {
+  if (frame->num_channels_ != 8) {
+    return -1;
+  }
+
+  RTC_DCHECK_LE(frame->samples_per_channel_ * 8,
+                AudioFrame::kMaxDataSizeSamples);
+
+  if (!frame->muted()) {
+    SevenOneToStereo(frame->data(), frame->samples_per_channel_,
+                     frame->mutable_data());
+  }
+  frame->num_channels_ = 2;
+
+  return 0;
+}
+
 void AudioFrameOperations::DownmixChannels(const int16_t* src_audio,
                                            size_t src_channels,
                                            size_t samples_per_channel,
@@ -129,6 +200,12 @@ void AudioFrameOperations::DownmixChannels(const int16_t* src_audio,
   } else if (src_channels == 4 && dst_channels == 2) {
     QuadToStereo(src_audio, samples_per_channel, dst_audio);
     return;
+  } else if (src_channels == 6 && dst_channels == 2) {
+    FiveOneToStereo(src_audio, samples_per_channel, dst_audio);
+    return;
+  } else if (src_channels == 8 && dst_channels == 2) {
+    SevenOneToStereo(src_audio, samples_per_channel, dst_audio);
+    return;
   }
 
   RTC_NOTREACHED() << "src_channels: " << src_channels
@@ -148,6 +225,12 @@ void AudioFrameOperations::DownmixChannels(size_t dst_channels,
   } else if (frame->num_channels_ == 4 && dst_channels == 2) {
     int err = QuadToStereo(frame);
     RTC_DCHECK_EQ(err, 0);
+  } else if (frame->num_channels_ == 6 && dst_channels == 2) {
+    int err = FiveOneToStereo(frame);
+    RTC_DCHECK_EQ(err, 0);
+  } else if (frame->num_channels_ == 8 && dst_channels == 2) {
+    int err = SevenOneToStereo(frame);
+    RTC_DCHECK_EQ(err, 0);
   } else {
     RTC_NOTREACHED() << "src_channels: " << frame->num_channels_
                      << ", dst_channels: " << dst_channels;
@@ -54,10 +54,34 @@ class AudioFrameOperations {
   // |num_channels_| is 4 channels.
   static int QuadToStereo(AudioFrame* frame);
 
+  // Downmixes 6 channels (5.1 surround, interleaved as L, R, C, LFE, Ls, Rs)
+  // |src_audio| to stereo |dst_audio|. The LFE channel is dropped. This is an
+  // in-place operation, meaning |src_audio| and |dst_audio| may point to the
+  // same buffer.
+  static void FiveOneToStereo(const int16_t* src_audio,
+                              size_t samples_per_channel,
+                              int16_t* dst_audio);
+
+  // |frame.num_channels_| will be updated. This version checks that
+  // |num_channels_| is 6 channels.
+  static int FiveOneToStereo(AudioFrame* frame);
+
+  // Downmixes 8 channels (7.1 surround, interleaved as L, R, C, LFE, Ls, Rs,
+  // Lr, Rr) |src_audio| to stereo |dst_audio|. The LFE channel is dropped.
+  // This is an in-place operation, meaning |src_audio| and |dst_audio| may
+  // point to the same buffer.
+  static void SevenOneToStereo(const int16_t* src_audio,
+                               size_t samples_per_channel,
+                               int16_t* dst_audio);
+
+  // |frame.num_channels_| will be updated. This version checks that
+  // |num_channels_| is 8 channels.
+  static int SevenOneToStereo(AudioFrame* frame);
+
   // Downmixes |src_channels| |src_audio| to |dst_channels| |dst_audio|.
   // This is an in-place operation, meaning |src_audio| and |dst_audio|
   // may point to the same buffer. Supported channel combinations are
-  // Stereo to Mono, Quad to Mono, and Quad to Stereo.
+  // N channels to Mono, and Quad, 5.1 and 7.1 to Stereo.
   static void DownmixChannels(const int16_t* src_audio,
                               size_t src_channels,
                               size_t samples_per_channel,
@@ -66,7 +90,8 @@ class AudioFrameOperations {
 
   // |frame.num_channels_| will be updated. This version checks that
   // |num_channels_| and |dst_channels| are valid and performs relevant downmix.
-  // Supported channel combinations are N channels to Mono, and Quad to Stereo.
+  // Supported channel combinations are N channels to Mono, and Quad, 5.1 and
+  // 7.1 to Stereo.
   static void DownmixChannels(size_t dst_channels, AudioFrame* frame);
 
   // |frame.num_channels_| will be updated. This version checks that
@@ -43,6 +43,46 @@ void SetFrameData(int16_t ch1,
   }
 }
 
+void SetFrameData(int16_t ch1,
+                  int16_t ch2,
+                  int16_t ch3,
+                  int16_t ch4,
+                  int16_t ch5,
+                  int16_t ch6,
+                  AudioFrame* frame) {
+  int16_t* frame_data = frame->mutable_data();
+  for (size_t i = 0; i < frame->samples_per_channel_ * 6; i += 6) {
+    frame_data[i] = ch1;
+    frame_data[i + 1] = ch2;
+    frame_data[i + 2] = ch3;
+    frame_data[i + 3] = ch4;
+    frame_data[i + 4] = ch5;
+    frame_data[i + 5] = ch6;
+  }
+}
+
+void SetFrameData(int16_t ch1,
+                  int16_t ch2,
+                  int16_t ch3,
+                  int16_t ch4,
+                  int16_t ch5,
+                  int16_t ch6,
+                  int16_t ch7,
+                  int16_t ch8,
+                  AudioFrame* frame) {
+  int16_t* frame_data = frame->mutable_data();
+  for (size_t i = 0; i < frame->samples_per_channel_ * 8; i += 8) {
+    frame_data[i] = ch1;
+    frame_data[i + 1] = ch2;
+    frame_data[i + 2] = ch3;
+    frame_data[i + 3] = ch4;
+    frame_data[i + 4] = ch5;
+    frame_data[i + 5] = ch6;
+    frame_data[i + 6] = ch7;
+    frame_data[i + 7] = ch8;
+  }
+}
+
 void SetFrameData(int16_t left, int16_t right, AudioFrame* frame) {
   int16_t* frame_data = frame->mutable_data();
   for (size_t i = 0; i < frame->samples_per_channel_ * 2; i += 2) {
@@ -300,6 +340,71 @@ TEST_F(AudioFrameOperationsTest, QuadToStereoDoesNotWrapAround) {
   VerifyFramesAreEqual(stereo_frame, frame_);
 }
 
+TEST_F(AudioFrameOperationsTest, FiveOneToStereoFailsWithBadParameters) {
+  frame_.num_channels_ = 4;
+  EXPECT_EQ(-1, AudioFrameOperations::FiveOneToStereo(&frame_));
+  frame_.num_channels_ = 8;
+  EXPECT_EQ(-1, AudioFrameOperations::FiveOneToStereo(&frame_));
+}
+
+TEST_F(AudioFrameOperationsTest, FiveOneToStereoSucceeds) {
+  frame_.num_channels_ = 6;
+  // The LFE channel (value 100) must not contribute to the output.
+  SetFrameData(8, 0, 4, 100, 4, 8, &frame_);
+  EXPECT_EQ(0, AudioFrameOperations::FiveOneToStereo(&frame_));
+
+  AudioFrame stereo_frame;
+  stereo_frame.samples_per_channel_ = 320;
+  stereo_frame.num_channels_ = 2;
+  SetFrameData(6, 3, &stereo_frame);
+  VerifyFramesAreEqual(stereo_frame, frame_);
+}
+
+TEST_F(AudioFrameOperationsTest, FiveOneToStereoDoesNotWrapAround) {
+  frame_.num_channels_ = 6;
+  SetFrameData(-32768, -32768, -32768, -32768, -32768, -32768, &frame_);
+  EXPECT_EQ(0, AudioFrameOperations::FiveOneToStereo(&frame_));
+
+  AudioFrame stereo_frame;
+  stereo_frame.samples_per_channel_ = 320;
+  stereo_frame.num_channels_ = 2;
+  SetFrameData(-32768, -32768, &stereo_frame);
+  VerifyFramesAreEqual(stereo_frame, frame_);
+}
+
+TEST_F(AudioFrameOperationsTest, SevenOneToStereoFailsWithBadParameters) {
+  frame_.num_channels_ = 6;
+  EXPECT_EQ(-1, AudioFrameOperations::SevenOneToStereo(&frame_));
+  frame_.num_channels_ = 2;
+  EXPECT_EQ(-1, AudioFrameOperations::SevenOneToStereo(&frame_));
+}
+
+TEST_F(AudioFrameOperationsTest, SevenOneToStereoSucceeds) {
+  frame_.num_channels_ = 8;
+  // The LFE channel (value 100) must not contribute to the output.
+  SetFrameData(8, 0, 4, 100, 8, 16, 12, 4, &frame_);
+  EXPECT_EQ(0, AudioFrameOperations::SevenOneToStereo(&frame_));
+
+  AudioFrame stereo_frame;
+  stereo_frame.samples_per_channel_ = 320;
+  stereo_frame.num_channels_ = 2;
+  SetFrameData(7, 3, &stereo_frame);
+  VerifyFramesAreEqual(stereo_frame, frame_);
+}
+
+TEST_F(AudioFrameOperationsTest, SevenOneToStereoDoesNotWrapAround) {
+  frame_.num_channels_ = 8;
+  SetFrameData(-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+               &frame_);
+  EXPECT_EQ(0, AudioFrameOperations::SevenOneToStereo(&frame_));
+
+  AudioFrame stereo_frame;
+  stereo_frame.samples_per_channel_ = 320;
+  stereo_frame.num_channels_ = 2;
+  SetFrameData(-32768, -32768, &stereo_frame);
+  VerifyFramesAreEqual(stereo_frame, frame_);
+}
+
 TEST_F(AudioFrameOperationsTest, SwapStereoChannelsSucceedsOnStereo) {
   SetFrameData(0, 1, &frame_);
 
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "audio/utility/audio_frame_pool.h"
+
+#include <utility>
+#include <vector>
+
+#include "rtc_base/critical_section.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+namespace {
+
+// Upper bound on idle frames kept around, to put a lid on the memory held
+// after a burst of concurrent streams goes away.
+constexpr size_t kMaxPooledFrames = 128;
+
+struct PoolState {
+  rtc::CriticalSection lock;
+  std::vector<std::unique_ptr<AudioFrame>> frames RTC_GUARDED_BY(lock);
+};
+
+PoolState& GetPoolState() {
+  // Leaked at shutdown, like other process-wide state in this code base.
+  static PoolState* const state = new PoolState();
+  return *state;
+}
+
+}  // namespace
+
+std::unique_ptr<AudioFrame> AudioFramePool::AcquireFrame() {
+  PoolState& pool = GetPoolState();
+  {
+    rtc::CritScope cs(&pool.lock);
+    if (!pool.frames.empty()) {
+      std::unique_ptr<AudioFrame> frame = std::move(pool.frames.back());
+      pool.frames.pop_back();
+      frame->Reset();
+      return frame;
+    }
+  }
+  return std::make_unique<AudioFrame>();
+}
+
+void AudioFramePool::ReleaseFrame(std::unique_ptr<AudioFrame> frame) {
+  if (!frame) {
+    return;
+  }
+  PoolState& pool = GetPoolState();
+  rtc::CritScope cs(&pool.lock);
+  if (pool.frames.size() < kMaxPooledFrames) {
+    pool.frames.push_back(std::move(frame));
+  }
+  // Otherwise let |frame| be freed.
+}
+
+}  // namespace webrtc
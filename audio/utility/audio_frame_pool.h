@@ -0,0 +1,42 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef AUDIO_UTILITY_AUDIO_FRAME_POOL_H_
+#define AUDIO_UTILITY_AUDIO_FRAME_POOL_H_
+
+#include <memory>
+
+#include "api/audio/audio_frame.h"
+
+namespace webrtc {
+
+// Recycles AudioFrame heap allocations on the capture path. The capture
+// thread acquires one frame per 10 ms block per sending stream and each
+// stream's encoder queue releases it once the block has been handed to the
+// encoder. AudioFrame is several kilobytes because of its inline sample
+// array, so with many streams reusing frames avoids an allocation and free
+// of that size per stream per 10 ms.
+//
+// Releasing through the pool is an optimization, not a requirement; frames
+// that are destroyed normally are simply not reused.
+class AudioFramePool {
+ public:
+  AudioFramePool() = delete;
+
+  // Returns a reset frame, reusing a previously released one if available.
+  static std::unique_ptr<AudioFrame> AcquireFrame();
+
+  // Returns |frame| to the pool, or frees it if the pool is full.
+  static void ReleaseFrame(std::unique_ptr<AudioFrame> frame);
+};
+
+}  // namespace webrtc
+
+#endif  // AUDIO_UTILITY_AUDIO_FRAME_POOL_H_
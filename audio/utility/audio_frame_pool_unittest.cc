@@ -0,0 +1,50 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "audio/utility/audio_frame_pool.h"
+
+#include <memory>
+#include <utility>
+
+#include "test/gtest.h"
+
+namespace webrtc {
+
+TEST(AudioFramePoolTest, AcquireReturnsFrame) {
+  std::unique_ptr<AudioFrame> frame = AudioFramePool::AcquireFrame();
+  ASSERT_TRUE(frame);
+  EXPECT_EQ(0u, frame->samples_per_channel_);
+  EXPECT_TRUE(frame->muted());
+}
+
+TEST(AudioFramePoolTest, ReleasedFrameIsReusedAndReset) {
+  std::unique_ptr<AudioFrame> frame = AudioFramePool::AcquireFrame();
+  frame->sample_rate_hz_ = 48000;
+  frame->samples_per_channel_ = 480;
+  frame->num_channels_ = 2;
+  frame->mutable_data()[0] = 17;
+  AudioFrame* released = frame.get();
+  AudioFramePool::ReleaseFrame(std::move(frame));
+
+  // The pool is a LIFO, so the next acquire returns the released frame,
+  // reset to the state of a freshly constructed one.
+  std::unique_ptr<AudioFrame> reused = AudioFramePool::AcquireFrame();
+  ASSERT_TRUE(reused);
+  EXPECT_EQ(released, reused.get());
+  EXPECT_EQ(0u, reused->samples_per_channel_);
+  EXPECT_TRUE(reused->muted());
+}
+
+TEST(AudioFramePoolTest, ReleasingNullIsANoOp) {
+  AudioFramePool::ReleaseFrame(nullptr);
+  EXPECT_TRUE(AudioFramePool::AcquireFrame());
+}
+
+}  // namespace webrtc
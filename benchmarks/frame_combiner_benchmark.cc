@@ -0,0 +1,79 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "api/audio/audio_frame.h"
+#include "modules/audio_mixer/frame_combiner.h"
+#include "modules/audio_mixer/sine_wave_generator.h"
+#include "rtc_base/strings/string_builder.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gtest.h"
+#include "test/testsupport/perf_test.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumIterations = 10000;
+constexpr int kSampleRateHz = 48000;
+constexpr int16_t kAmplitude = 8000;
+
+// Measures the average time of one FrameCombiner::Combine() call (one 10 ms
+// mix) for the given source and channel count, limiter enabled.
+void RunCombineBenchmark(int number_of_sources, int number_of_channels) {
+  FrameCombiner combiner(/*use_limiter=*/true);
+  SineWaveGenerator generator(440.f, kAmplitude);
+  std::vector<std::unique_ptr<AudioFrame>> frames;
+  std::vector<AudioFrame*> mix_list;
+  for (int i = 0; i < number_of_sources; ++i) {
+    auto frame = std::make_unique<AudioFrame>();
+    frame->UpdateFrame(0, nullptr, kSampleRateHz / 100, kSampleRateHz,
+                       AudioFrame::kNormalSpeech, AudioFrame::kVadActive,
+                       number_of_channels);
+    generator.GenerateNextFrame(frame.get());
+    mix_list.push_back(frame.get());
+    frames.push_back(std::move(frame));
+  }
+  AudioFrame audio_frame_for_mixing;
+
+  Clock* clock = Clock::GetRealTimeClock();
+  const int64_t start_us = clock->TimeInMicroseconds();
+  for (int i = 0; i < kNumIterations; ++i) {
+    combiner.Combine(mix_list, number_of_channels, kSampleRateHz,
+                     number_of_sources, &audio_frame_for_mixing);
+  }
+  const int64_t duration_us = clock->TimeInMicroseconds() - start_us;
+
+  rtc::StringBuilder story;
+  story << "combine_" << number_of_sources << "_sources_"
+        << number_of_channels << "ch";
+  test::PrintResult("frame_combiner", "", story.Release(),
+                    duration_us / static_cast<double>(kNumIterations), "us",
+                    false, test::ImproveDirection::kSmallerIsBetter);
+}
+
+}  // namespace
+
+// Covers the mix-accumulate and limiter kernels across source counts, so a
+// change to either shows up against the scalar baseline.
+TEST(FrameCombinerBenchmark, CombineMono) {
+  for (int number_of_sources : {2, 4, 8, 16}) {
+    RunCombineBenchmark(number_of_sources, 1);
+  }
+}
+
+TEST(FrameCombinerBenchmark, CombineStereo) {
+  for (int number_of_sources : {2, 4, 8, 16}) {
+    RunCombineBenchmark(number_of_sources, 2);
+  }
+}
+
+}  // namespace webrtc
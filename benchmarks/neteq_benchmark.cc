@@ -0,0 +1,42 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/tools/neteq_performance_test.h"
+#include "test/gtest.h"
+#include "test/testsupport/perf_test.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSimulationTimeMs = 10000;
+
+}  // namespace
+
+// Measures the time needed to insert packets and pull 10 seconds of audio
+// through NetEq, without and with packet loss. Wall-clock time spent is
+// dominated by NetEqImpl::GetAudio().
+TEST(NetEqBenchmark, GetAudio) {
+  const int64_t runtime_ms =
+      test::NetEqPerformanceTest::Run(kSimulationTimeMs, 0, 0.0);
+  ASSERT_GT(runtime_ms, 0);
+  test::PrintResult("neteq", "", "get_audio", runtime_ms, "ms", false,
+                    test::ImproveDirection::kSmallerIsBetter);
+}
+
+TEST(NetEqBenchmark, GetAudioWithLoss) {
+  // Drop one out of every 10 packets.
+  const int64_t runtime_ms =
+      test::NetEqPerformanceTest::Run(kSimulationTimeMs, 10, 0.0);
+  ASSERT_GT(runtime_ms, 0);
+  test::PrintResult("neteq", "", "get_audio_10pct_loss", runtime_ms, "ms",
+                    false, test::ImproveDirection::kSmallerIsBetter);
+}
+
+}  // namespace webrtc
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "api/units/data_rate.h"
+#include "modules/pacing/pacing_controller.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gtest.h"
+#include "test/testsupport/perf_test.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumRounds = 2000;
+constexpr int kPacketsPerRound = 5;
+constexpr size_t kPacketSize = 1200;
+constexpr uint32_t kSsrc = 0x23456789;
+
+class DiscardingPacketSender : public PacingController::PacketSender {
+ public:
+  void SendRtpPacket(std::unique_ptr<RtpPacketToSend> packet,
+                     const PacedPacketInfo& cluster_info) override {
+    ++num_sent_;
+  }
+  std::vector<std::unique_ptr<RtpPacketToSend>> GeneratePadding(
+      DataSize size) override {
+    return {};
+  }
+  int num_sent() const { return num_sent_; }
+
+ private:
+  int num_sent_ = 0;
+};
+
+std::unique_ptr<RtpPacketToSend> BuildPacket(uint16_t sequence_number) {
+  auto packet = std::make_unique<RtpPacketToSend>(nullptr);
+  packet->set_packet_type(RtpPacketMediaType::kVideo);
+  packet->SetSsrc(kSsrc);
+  packet->SetSequenceNumber(sequence_number);
+  packet->SetPayloadSize(kPacketSize);
+  return packet;
+}
+
+}  // namespace
+
+// Measures the average time per packet spent enqueuing and processing
+// packets in the pacer, with the pacing rate high enough that the queue is
+// drained on every 5 ms process interval.
+TEST(PacingControllerBenchmark, EnqueueAndProcessPackets) {
+  SimulatedClock simulated_clock(123456789);
+  DiscardingPacketSender sender;
+  PacingController pacer(&simulated_clock, &sender, nullptr, nullptr,
+                         PacingController::ProcessMode::kPeriodic);
+  pacer.SetPacingRates(DataRate::KilobitsPerSec(100000), DataRate::Zero());
+
+  uint16_t sequence_number = 0;
+  Clock* clock = Clock::GetRealTimeClock();
+  const int64_t start_us = clock->TimeInMicroseconds();
+  for (int round = 0; round < kNumRounds; ++round) {
+    for (int i = 0; i < kPacketsPerRound; ++i)
+      pacer.EnqueuePacket(BuildPacket(sequence_number++));
+    simulated_clock.AdvanceTimeMilliseconds(5);
+    pacer.ProcessPackets();
+  }
+  const int64_t duration_us = clock->TimeInMicroseconds() - start_us;
+
+  const int num_packets = kNumRounds * kPacketsPerRound;
+  ASSERT_EQ(num_packets, sender.num_sent());
+
+  test::PrintResult("pacing_controller", "", "enqueue_and_process_packets",
+                    duration_us / static_cast<double>(num_packets), "us", false,
+                    test::ImproveDirection::kSmallerIsBetter);
+}
+
+}  // namespace webrtc
@@ -0,0 +1,67 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <vector>
+
+#include "call/rtp_demuxer.h"
+#include "call/rtp_packet_sink_interface.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gtest.h"
+#include "test/testsupport/perf_test.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumPackets = 100000;
+constexpr int kNumSinks = 16;
+
+class CountingSink : public RtpPacketSinkInterface {
+ public:
+  void OnRtpPacket(const RtpPacketReceived& packet) override { ++num_packets_; }
+  int num_packets() const { return num_packets_; }
+
+ private:
+  int num_packets_ = 0;
+};
+
+}  // namespace
+
+// Measures the average time needed to route a packet to its sink by SSRC,
+// the steady-state path taken by every received packet in a call.
+TEST(RtpDemuxerBenchmark, OnRtpPacketBySsrc) {
+  RtpDemuxer demuxer;
+  CountingSink sinks[kNumSinks];
+  std::vector<RtpPacketReceived> packets(kNumSinks);
+  for (int i = 0; i < kNumSinks; ++i) {
+    const uint32_t ssrc = 1000 + i;
+    ASSERT_TRUE(demuxer.AddSink(ssrc, &sinks[i]));
+    packets[i].SetSsrc(ssrc);
+    packets[i].SetSequenceNumber(static_cast<uint16_t>(i));
+  }
+
+  Clock* clock = Clock::GetRealTimeClock();
+  const int64_t start_us = clock->TimeInMicroseconds();
+  for (int i = 0; i < kNumPackets; ++i) {
+    demuxer.OnRtpPacket(packets[i % kNumSinks]);
+  }
+  const int64_t duration_us = clock->TimeInMicroseconds() - start_us;
+
+  int num_routed = 0;
+  for (const CountingSink& sink : sinks)
+    num_routed += sink.num_packets();
+  ASSERT_EQ(kNumPackets, num_routed);
+
+  test::PrintResult("rtp_demuxer", "", "on_rtp_packet_by_ssrc",
+                    duration_us / static_cast<double>(kNumPackets), "us", false,
+                    test::ImproveDirection::kSmallerIsBetter);
+}
+
+}  // namespace webrtc
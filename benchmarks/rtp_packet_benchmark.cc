@@ -0,0 +1,94 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstring>
+
+#include "modules/rtp_rtcp/source/rtp_header_extensions.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gtest.h"
+#include "test/testsupport/perf_test.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumPackets = 100000;
+constexpr size_t kPayloadSize = 1000;
+constexpr uint32_t kSsrc = 0x12345678;
+constexpr uint8_t kPayloadType = 96;
+
+RtpPacket::ExtensionManager CreateExtensionManager() {
+  RtpPacket::ExtensionManager extensions;
+  extensions.Register<TransmissionOffset>(1);
+  extensions.Register<AbsoluteSendTime>(2);
+  extensions.Register<TransportSequenceNumber>(3);
+  return extensions;
+}
+
+}  // namespace
+
+// Measures the average time needed to build an RTP packet with the header
+// extensions typically negotiated on the video send path.
+TEST(RtpPacketBenchmark, Build) {
+  const RtpPacket::ExtensionManager extensions = CreateExtensionManager();
+
+  Clock* clock = Clock::GetRealTimeClock();
+  const int64_t start_us = clock->TimeInMicroseconds();
+  for (int i = 0; i < kNumPackets; ++i) {
+    RtpPacketToSend packet(&extensions);
+    packet.SetPayloadType(kPayloadType);
+    packet.SetSequenceNumber(static_cast<uint16_t>(i));
+    packet.SetTimestamp(static_cast<uint32_t>(i) * 3000);
+    packet.SetSsrc(kSsrc);
+    packet.SetExtension<TransmissionOffset>(0x123456);
+    packet.SetExtension<AbsoluteSendTime>(0x654321);
+    packet.SetExtension<TransportSequenceNumber>(static_cast<uint16_t>(i));
+    uint8_t* payload = packet.AllocatePayload(kPayloadSize);
+    payload[0] = static_cast<uint8_t>(i);
+  }
+  const int64_t duration_us = clock->TimeInMicroseconds() - start_us;
+
+  test::PrintResult("rtp_packet", "", "build",
+                    duration_us / static_cast<double>(kNumPackets), "us", false,
+                    test::ImproveDirection::kSmallerIsBetter);
+}
+
+// Measures the average time needed to parse an RTP packet with three header
+// extensions, as done for every packet on the receive path.
+TEST(RtpPacketBenchmark, Parse) {
+  const RtpPacket::ExtensionManager extensions = CreateExtensionManager();
+
+  RtpPacketToSend packet(&extensions);
+  packet.SetPayloadType(kPayloadType);
+  packet.SetSequenceNumber(1234);
+  packet.SetTimestamp(567890);
+  packet.SetSsrc(kSsrc);
+  packet.SetExtension<TransmissionOffset>(0x123456);
+  packet.SetExtension<AbsoluteSendTime>(0x654321);
+  packet.SetExtension<TransportSequenceNumber>(4321);
+  memset(packet.AllocatePayload(kPayloadSize), 0xAB, kPayloadSize);
+
+  Clock* clock = Clock::GetRealTimeClock();
+  const int64_t start_us = clock->TimeInMicroseconds();
+  for (int i = 0; i < kNumPackets; ++i) {
+    RtpPacketReceived parsed(&extensions);
+    ASSERT_TRUE(parsed.Parse(packet.data(), packet.size()));
+    int32_t offset;
+    ASSERT_TRUE(parsed.GetExtension<TransmissionOffset>(&offset));
+  }
+  const int64_t duration_us = clock->TimeInMicroseconds() - start_us;
+
+  test::PrintResult("rtp_packet", "", "parse",
+                    duration_us / static_cast<double>(kNumPackets), "us", false,
+                    test::ImproveDirection::kSmallerIsBetter);
+}
+
+}  // namespace webrtc
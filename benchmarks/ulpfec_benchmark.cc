@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <cstring>
+#include <list>
+#include <memory>
+
+#include "modules/include/module_fec_types.h"
+#include "modules/rtp_rtcp/source/byte_io.h"
+#include "modules/rtp_rtcp/source/forward_error_correction.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gtest.h"
+#include "test/testsupport/perf_test.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumIterations = 10000;
+constexpr size_t kNumMediaPackets = 12;
+constexpr size_t kPacketSize = 1200;
+constexpr uint32_t kSsrc = 0x34567890;
+constexpr uint8_t kProtectionFactor = 127;  // Roughly 50% protection.
+
+ForwardErrorCorrection::PacketList BuildMediaPackets() {
+  ForwardErrorCorrection::PacketList media_packets;
+  for (size_t i = 0; i < kNumMediaPackets; ++i) {
+    auto packet = std::make_unique<ForwardErrorCorrection::Packet>();
+    packet->data.SetSize(kPacketSize);
+    uint8_t* data = packet->data.data();
+    memset(data, static_cast<uint8_t>(i), kPacketSize);
+    // A minimal RTP header is all EncodeFec() reads from the packets.
+    data[0] = 0x80;
+    data[1] = 96;
+    ByteWriter<uint16_t>::WriteBigEndian(&data[2], static_cast<uint16_t>(i));
+    ByteWriter<uint32_t>::WriteBigEndian(&data[4], 4000u);
+    ByteWriter<uint32_t>::WriteBigEndian(&data[8], kSsrc);
+    media_packets.push_back(std::move(packet));
+  }
+  return media_packets;
+}
+
+}  // namespace
+
+// Measures the average time needed to generate ULPFEC packets for a video
+// frame worth of media packets at ~50% protection.
+TEST(UlpfecBenchmark, EncodeFec) {
+  std::unique_ptr<ForwardErrorCorrection> fec =
+      ForwardErrorCorrection::CreateUlpfec(kSsrc);
+  const ForwardErrorCorrection::PacketList media_packets = BuildMediaPackets();
+
+  Clock* clock = Clock::GetRealTimeClock();
+  const int64_t start_us = clock->TimeInMicroseconds();
+  for (int i = 0; i < kNumIterations; ++i) {
+    std::list<ForwardErrorCorrection::Packet*> fec_packets;
+    ASSERT_EQ(0, fec->EncodeFec(media_packets, kProtectionFactor, 0, false,
+                                kFecMaskRandom, &fec_packets));
+    ASSERT_FALSE(fec_packets.empty());
+  }
+  const int64_t duration_us = clock->TimeInMicroseconds() - start_us;
+
+  test::PrintResult("ulpfec", "", "encode_fec",
+                    duration_us / static_cast<double>(kNumIterations), "us",
+                    false, test::ImproveDirection::kSmallerIsBetter);
+}
+
+}  // namespace webrtc
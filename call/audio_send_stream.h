@@ -30,6 +30,7 @@
 #include "call/rtp_config.h"
 #include "modules/audio_processing/include/audio_processing_statistics.h"
 #include "modules/rtp_rtcp/include/report_block_data.h"
+#include "system_wrappers/include/audio_pipeline_tap.h"
 
 namespace webrtc {
 
@@ -70,6 +71,11 @@ class AudioSendStream : public AudioSender {
     // per-pair the ReportBlockData represents the latest Report Block that was
     // received for that pair.
     std::vector<ReportBlockData> report_block_datas;
+
+    // Per-stage audio pipeline latency deltas. Only populated while the
+    // process-wide tap in system_wrappers/include/audio_pipeline_tap.h is
+    // enabled; the measurements are global, not per stream.
+    std::vector<audio_pipeline_tap::StageDelta> pipeline_stage_deltas;
   };
 
   struct Config {
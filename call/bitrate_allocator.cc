@@ -360,6 +360,8 @@ BitrateAllocator::BitrateAllocator(LimitObserver* limit_observer)
       last_fraction_loss_(0),
       last_rtt_(0),
       last_bwe_period_ms_(1000),
+      last_cwnd_reduce_ratio_(0),
+      needs_reallocation_(true),
       num_pause_events_(0),
       last_bwe_log_time_(0) {
   sequenced_checker_.Detach();
@@ -377,16 +379,31 @@ void BitrateAllocator::UpdateStartRate(uint32_t start_rate_bps) {
 
 void BitrateAllocator::OnNetworkEstimateChanged(TargetTransferRate msg) {
   RTC_DCHECK_RUN_ON(&sequenced_checker_);
+  int loss_ratio_255 = msg.network_estimate.loss_rate_ratio * 255;
+  uint8_t fraction_loss =
+      rtc::dchecked_cast<uint8_t>(rtc::SafeClamp(loss_ratio_255, 0, 255));
+
+  // If the inputs are identical to the previous estimate and the previous
+  // allocation round changed nothing, re-solving is guaranteed to produce
+  // the same result; skip the allocation passes and observer callbacks.
+  const bool unchanged =
+      !needs_reallocation_ &&
+      msg.target_rate.bps() == last_target_bps_ &&
+      msg.stable_target_rate.bps() == last_stable_target_bps_ &&
+      fraction_loss == last_fraction_loss_ &&
+      msg.network_estimate.round_trip_time.ms() == last_rtt_ &&
+      msg.network_estimate.bwe_period.ms() == last_bwe_period_ms_ &&
+      msg.cwnd_reduce_ratio == last_cwnd_reduce_ratio_;
+
   last_target_bps_ = msg.target_rate.bps();
   last_stable_target_bps_ = msg.stable_target_rate.bps();
   last_non_zero_bitrate_bps_ =
       last_target_bps_ > 0 ? last_target_bps_ : last_non_zero_bitrate_bps_;
 
-  int loss_ratio_255 = msg.network_estimate.loss_rate_ratio * 255;
-  last_fraction_loss_ =
-      rtc::dchecked_cast<uint8_t>(rtc::SafeClamp(loss_ratio_255, 0, 255));
+  last_fraction_loss_ = fraction_loss;
   last_rtt_ = msg.network_estimate.round_trip_time.ms();
   last_bwe_period_ms_ = msg.network_estimate.bwe_period.ms();
+  last_cwnd_reduce_ratio_ = msg.cwnd_reduce_ratio;
 
   // Periodically log the incoming BWE.
   int64_t now = msg.at_time.ms();
@@ -395,10 +412,14 @@ void BitrateAllocator::OnNetworkEstimateChanged(TargetTransferRate msg) {
     last_bwe_log_time_ = now;
   }
 
+  if (unchanged)
+    return;
+
   auto allocation = AllocateBitrates(allocatable_tracks_, last_target_bps_);
   auto stable_bitrate_allocation =
       AllocateBitrates(allocatable_tracks_, last_stable_target_bps_);
 
+  needs_reallocation_ = false;
   for (auto& config : allocatable_tracks_) {
     uint32_t allocated_bitrate = allocation[config.observer];
     uint32_t allocated_stable_target_rate =
@@ -437,8 +458,14 @@ void BitrateAllocator::OnNetworkEstimateChanged(TargetTransferRate msg) {
     }
 
     // Only update the media ratio if the observer got an allocation.
-    if (allocated_bitrate > 0)
-      config.media_ratio = MediaRatio(allocated_bitrate, protection_bitrate);
+    if (allocated_bitrate > 0) {
+      double media_ratio = MediaRatio(allocated_bitrate, protection_bitrate);
+      if (media_ratio != config.media_ratio)
+        needs_reallocation_ = true;
+      config.media_ratio = media_ratio;
+    }
+    if (allocated_bitrate != config.allocated_bitrate_bps)
+      needs_reallocation_ = true;
     config.allocated_bitrate_bps = allocated_bitrate;
   }
   UpdateAllocationLimits();
@@ -458,6 +485,7 @@ void BitrateAllocator::AddObserver(BitrateAllocatorObserver* observer,
   } else {
     allocatable_tracks_.push_back(AllocatableTrack(observer, config));
   }
+  needs_reallocation_ = true;
 
   if (last_target_bps_ > 0) {
     // Calculate a new allocation and update all observers.
@@ -536,6 +564,7 @@ void BitrateAllocator::RemoveObserver(BitrateAllocatorObserver* observer) {
        ++it) {
     if (it->observer == observer) {
       allocatable_tracks_.erase(it);
+      needs_reallocation_ = true;
       break;
     }
   }
@@ -159,6 +159,12 @@ class BitrateAllocator : public BitrateAllocatorInterface {
   uint8_t last_fraction_loss_ RTC_GUARDED_BY(&sequenced_checker_);
   int64_t last_rtt_ RTC_GUARDED_BY(&sequenced_checker_);
   int64_t last_bwe_period_ms_ RTC_GUARDED_BY(&sequenced_checker_);
+  double last_cwnd_reduce_ratio_ RTC_GUARDED_BY(&sequenced_checker_);
+  // True when the observer set or their configs changed since the last
+  // allocation, or when the last allocation changed any observer's bitrate.
+  // While false, a network estimate identical to the previous one is
+  // guaranteed to produce the same allocation and is not re-solved.
+  bool needs_reallocation_ RTC_GUARDED_BY(&sequenced_checker_);
   // Number of mute events based on too low BWE, not network up/down.
   int num_pause_events_ RTC_GUARDED_BY(&sequenced_checker_);
   int64_t last_bwe_log_time_ RTC_GUARDED_BY(&sequenced_checker_);
@@ -67,6 +67,7 @@ class TestBitrateObserver : public BitrateAllocatorObserver {
   }
 
   uint32_t OnBitrateUpdated(BitrateAllocationUpdate update) override {
+    ++update_count_;
     last_bitrate_bps_ = update.target_bitrate.bps();
     last_fraction_loss_ =
         rtc::dchecked_cast<uint8_t>(update.packet_loss_ratio * 256);
@@ -79,6 +80,7 @@ class TestBitrateObserver : public BitrateAllocatorObserver {
   int64_t last_rtt_ms_;
   int last_probing_interval_ms_;
   double protection_ratio_;
+  int update_count_ = 0;
 };
 
 constexpr int64_t kDefaultProbingIntervalMs = 3000;
@@ -768,6 +770,34 @@ TEST_F(BitrateAllocatorTest, AvoidTogglePercent) {
   allocator_->RemoveObserver(&observer);
 }
 
+TEST_F(BitrateAllocatorTest, RepeatedIdenticalEstimateSkipsReallocation) {
+  TestBitrateObserver observer;
+  AddObserver(&observer, 100000, 400000, 0, true, kDefaultBitratePriority);
+
+  allocator_->OnNetworkEstimateChanged(
+      CreateTargetRateMessage(200000, 0, 50, kDefaultProbingIntervalMs));
+  // A second round with the same estimate settles the allocation.
+  allocator_->OnNetworkEstimateChanged(
+      CreateTargetRateMessage(200000, 0, 50, kDefaultProbingIntervalMs));
+  EXPECT_EQ(200000u, observer.last_bitrate_bps_);
+
+  // Further identical estimates must not poke the observer again.
+  const int settled_update_count = observer.update_count_;
+  for (int i = 0; i < 3; ++i) {
+    allocator_->OnNetworkEstimateChanged(
+        CreateTargetRateMessage(200000, 0, 50, kDefaultProbingIntervalMs));
+  }
+  EXPECT_EQ(settled_update_count, observer.update_count_);
+
+  // A changed estimate is allocated and delivered as usual.
+  allocator_->OnNetworkEstimateChanged(
+      CreateTargetRateMessage(300000, 0, 50, kDefaultProbingIntervalMs));
+  EXPECT_EQ(300000u, observer.last_bitrate_bps_);
+  EXPECT_EQ(settled_update_count + 1, observer.update_count_);
+
+  allocator_->RemoveObserver(&observer);
+}
+
 TEST_F(BitrateAllocatorTest, PassProbingInterval) {
   TestBitrateObserver observer;
   AddObserver(&observer, 300000, 600000, 0, false, kDefaultBitratePriority);
@@ -27,7 +27,9 @@
 #include "audio/audio_state.h"
 #include "call/bitrate_allocator.h"
 #include "call/flexfec_receive_stream_impl.h"
+#include "call/memory_budget.h"
 #include "call/receive_time_calculator.h"
+#include "call/rtp_rtcp_demuxer_helper.h"
 #include "call/rtp_stream_receiver_controller.h"
 #include "call/rtp_transport_controller_send.h"
 #include "logging/rtc_event_log/events/rtc_event_audio_receive_stream_config.h"
@@ -43,7 +45,9 @@
 #include "modules/rtp_rtcp/source/rtp_packet_received.h"
 #include "modules/rtp_rtcp/source/rtp_utility.h"
 #include "modules/utility/include/process_thread.h"
+#ifdef WEBRTC_VIDEO_PIPELINE
 #include "modules/video_coding/fec_controller_default.h"
+#endif
 #include "rtc_base/checks.h"
 #include "rtc_base/constructor_magic.h"
 #include "rtc_base/location.h"
@@ -51,6 +55,8 @@
 #include "rtc_base/strings/string_builder.h"
 #include "rtc_base/synchronization/rw_lock_wrapper.h"
 #include "rtc_base/synchronization/sequence_checker.h"
+#include "rtc_base/task_utils/pooled_task_queue_factory.h"
+#include "rtc_base/thread.h"
 #include "rtc_base/thread_annotations.h"
 #include "rtc_base/time_utils.h"
 #include "rtc_base/trace_event.h"
@@ -59,10 +65,12 @@
 #include "system_wrappers/include/field_trial.h"
 #include "system_wrappers/include/metrics.h"
 #include "video/call_stats2.h"
-#include "video/send_delay_stats.h"
 #include "video/stats_counter.h"
+#ifdef WEBRTC_VIDEO_PIPELINE
+#include "video/send_delay_stats.h"
 #include "video/video_receive_stream2.h"
 #include "video/video_send_stream.h"
+#endif
 
 namespace webrtc {
 
@@ -168,6 +176,14 @@ TaskQueueBase* GetCurrentTaskQueueOrThread() {
 
 namespace internal {
 
+#ifndef WEBRTC_VIDEO_PIPELINE
+// With the video pipeline compiled out (rtc_include_video_pipeline=false)
+// the stream maps below only hold pointers, so forward declarations are
+// all that is needed.
+class VideoReceiveStream2;
+class VideoSendStream;
+#endif
+
 class Call final : public webrtc::Call,
                    public PacketReceiver,
                    public RecoveredPacketReceiver,
@@ -216,6 +232,8 @@ class Call final : public webrtc::Call,
 
   Stats GetStats() const override;
 
+  MemoryBudget* memory_budget() override;
+
   // Implements PacketReceiver.
   DeliveryStatus DeliverPacket(MediaType media_type,
                                rtc::CopyOnWriteBuffer packet,
@@ -251,8 +269,13 @@ class Call final : public webrtc::Call,
       RTC_EXCLUSIVE_LOCKS_REQUIRED(receive_crit_);
 
   void NotifyBweOfReceivedPacket(const RtpPacketReceived& packet,
-                                 MediaType media_type)
-      RTC_SHARED_LOCKS_REQUIRED(receive_crit_);
+                                 MediaType media_type,
+                                 bool use_send_side_bwe);
+
+  // Republishes |receive_rtp_config_snapshot_| from |receive_rtp_config_|.
+  // Must be called whenever |receive_rtp_config_| changes.
+  void PublishReceiveRtpConfigSnapshot()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(receive_crit_);
 
   void UpdateSendHistograms(Timestamp first_sent_packet)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(&bitrate_crit_);
@@ -268,6 +291,14 @@ class Call final : public webrtc::Call,
 
   Clock* const clock_;
   TaskQueueFactory* const task_queue_factory_;
+  // Created on demand by CreateVideoReceiveStream when the
+  // WebRTC-Video-SharedDecodePool trial is enabled, so that the decode queues
+  // of all video receive streams share a fixed pool of threads sized by
+  // |num_cpu_cores_| instead of getting one dedicated thread each. Receive
+  // streams are destroyed via DestroyVideoReceiveStream before the Call, so
+  // the pool outlives all queues created from it.
+  std::unique_ptr<PooledTaskQueueFactory> decode_pool_factory_
+      RTC_GUARDED_BY(configuration_sequence_checker_);
 
   const int num_cpu_cores_;
   const std::unique_ptr<ProcessThread> module_process_thread_;
@@ -279,6 +310,12 @@ class Call final : public webrtc::Call,
 
   NetworkState audio_network_state_;
   NetworkState video_network_state_;
+  // Stream counts per media type, maintained on the configuration sequence as
+  // streams are created and destroyed. They mirror the stream containers so
+  // that UpdateAggregateNetworkState() can aggregate without taking the
+  // send/receive stream locks.
+  size_t num_audio_streams_ RTC_GUARDED_BY(configuration_sequence_checker_);
+  size_t num_video_streams_ RTC_GUARDED_BY(configuration_sequence_checker_);
   bool aggregate_network_up_ RTC_GUARDED_BY(configuration_sequence_checker_);
 
   std::unique_ptr<RWLockWrapper> receive_crit_;
@@ -289,6 +326,15 @@ class Call final : public webrtc::Call,
   std::set<VideoReceiveStream2*> video_receive_streams_
       RTC_GUARDED_BY(receive_crit_);
 
+  // Maps a remote media sender SSRC to the receive stream that listens to it.
+  // Used by DeliverRtcp() to hand an RTCP compound packet only to the stream
+  // that consumes reports from that sender instead of making every receive
+  // stream parse it.
+  std::map<uint32_t, AudioReceiveStream*> audio_receive_ssrcs_
+      RTC_GUARDED_BY(receive_crit_);
+  std::map<uint32_t, VideoReceiveStream2*> video_receive_ssrcs_
+      RTC_GUARDED_BY(receive_crit_);
+
   std::map<std::string, AudioReceiveStream*> sync_stream_mapping_
       RTC_GUARDED_BY(receive_crit_);
 
@@ -325,6 +371,12 @@ class Call final : public webrtc::Call,
   };
   std::map<uint32_t, ReceiveRtpConfig> receive_rtp_config_
       RTC_GUARDED_BY(receive_crit_);
+  // Immutable snapshot of |receive_rtp_config_|, republished under the write
+  // lock on every stream add/remove. Per-packet delivery reads the snapshot
+  // with std::atomic_load instead of taking |receive_crit_| shared, so
+  // delivery is never stalled by stream churn on another thread.
+  std::shared_ptr<const std::map<uint32_t, ReceiveRtpConfig>>
+      receive_rtp_config_snapshot_;
 
   std::unique_ptr<RWLockWrapper> send_crit_;
   // Audio and Video send streams are owned by the client that creates them.
@@ -334,6 +386,15 @@ class Call final : public webrtc::Call,
       RTC_GUARDED_BY(send_crit_);
   std::set<VideoSendStream*> video_send_streams_ RTC_GUARDED_BY(send_crit_);
 
+#ifdef WEBRTC_VIDEO_PIPELINE
+  // Memory budget registration ids for the video streams, so that streams can
+  // be unregistered when they are destroyed.
+  std::map<VideoSendStream*, int> video_send_budget_ids_
+      RTC_GUARDED_BY(configuration_sequence_checker_);
+  std::map<VideoReceiveStream2*, int> video_receive_budget_ids_
+      RTC_GUARDED_BY(configuration_sequence_checker_);
+#endif
+
   using RtpStateMap = std::map<uint32_t, RtpState>;
   RtpStateMap suspended_audio_send_ssrcs_
       RTC_GUARDED_BY(configuration_sequence_checker_);
@@ -372,9 +433,15 @@ class Call final : public webrtc::Call,
 
   ReceiveSideCongestionController receive_side_cc_;
 
+  // Components owning reclaimable buffers register here; GetStats() reports
+  // the aggregate usage. Thread-safe, so no guard annotation is needed.
+  MemoryBudget memory_budget_;
+
   const std::unique_ptr<ReceiveTimeCalculator> receive_time_calculator_;
 
+#ifdef WEBRTC_VIDEO_PIPELINE
   const std::unique_ptr<SendDelayStats> video_send_delay_stats_;
+#endif
   const int64_t start_ms_;
 
   // Caches transport_send_.get(), to avoid racing with destructor.
@@ -401,7 +468,8 @@ std::string Call::Stats::ToString(int64_t time_ms) const {
   ss << "recv_bw_bps: " << recv_bandwidth_bps << ", ";
   ss << "max_pad_bps: " << max_padding_bitrate_bps << ", ";
   ss << "pacer_delay_ms: " << pacer_delay_ms << ", ";
-  ss << "rtt_ms: " << rtt_ms;
+  ss << "rtt_ms: " << rtt_ms << ", ";
+  ss << "memory_usage_bytes: " << memory_usage_bytes;
   ss << '}';
   return ss.str();
 }
@@ -452,6 +520,8 @@ Call::Call(Clock* clock,
       config_(config),
       audio_network_state_(kNetworkDown),
       video_network_state_(kNetworkDown),
+      num_audio_streams_(0),
+      num_video_streams_(0),
       aggregate_network_up_(false),
       receive_crit_(RWLockWrapper::CreateRWLock()),
       send_crit_(RWLockWrapper::CreateRWLock()),
@@ -467,7 +537,9 @@ Call::Call(Clock* clock,
       pacer_bitrate_kbps_counter_(clock_, nullptr, true),
       receive_side_cc_(clock_, transport_send->packet_router()),
       receive_time_calculator_(ReceiveTimeCalculator::CreateFromFieldTrial()),
+#ifdef WEBRTC_VIDEO_PIPELINE
       video_send_delay_stats_(new SendDelayStats(clock_)),
+#endif
       start_ms_(clock_->TimeInMilliseconds()),
       transport_send_ptr_(transport_send.get()),
       transport_send_(std::move(transport_send)) {
@@ -641,6 +713,7 @@ webrtc::AudioSendStream* Call::CreateAudioSendStream(
                audio_send_ssrcs_.end());
     audio_send_ssrcs_[config.rtp.ssrc] = send_stream;
   }
+  ++num_audio_streams_;
   {
     ReadLockScoped read_lock(*receive_crit_);
     for (AudioReceiveStream* stream : audio_receive_streams_) {
@@ -669,6 +742,7 @@ void Call::DestroyAudioSendStream(webrtc::AudioSendStream* send_stream) {
     size_t num_deleted = audio_send_ssrcs_.erase(ssrc);
     RTC_DCHECK_EQ(1, num_deleted);
   }
+  --num_audio_streams_;
   {
     ReadLockScoped read_lock(*receive_crit_);
     for (AudioReceiveStream* stream : audio_receive_streams_) {
@@ -697,8 +771,10 @@ webrtc::AudioReceiveStream* Call::CreateAudioReceiveStream(
     receive_rtp_config_.emplace(config.rtp.remote_ssrc,
                                 ReceiveRtpConfig(config));
     audio_receive_streams_.insert(receive_stream);
+    audio_receive_ssrcs_[config.rtp.remote_ssrc] = receive_stream;
 
     ConfigureSync(config.sync_group);
+    PublishReceiveRtpConfigSnapshot();
   }
   {
     ReadLockScoped read_lock(*send_crit_);
@@ -707,6 +783,7 @@ webrtc::AudioReceiveStream* Call::CreateAudioReceiveStream(
       receive_stream->AssociateSendStream(it->second);
     }
   }
+  ++num_audio_streams_;
   UpdateAggregateNetworkState();
   return receive_stream;
 }
@@ -725,6 +802,7 @@ void Call::DestroyAudioReceiveStream(
     receive_side_cc_.GetRemoteBitrateEstimator(UseSendSideBwe(config))
         ->RemoveStream(ssrc);
     audio_receive_streams_.erase(audio_receive_stream);
+    audio_receive_ssrcs_.erase(ssrc);
     const std::string& sync_group = audio_receive_stream->config().sync_group;
     const auto it = sync_stream_mapping_.find(sync_group);
     if (it != sync_stream_mapping_.end() &&
@@ -733,7 +811,9 @@ void Call::DestroyAudioReceiveStream(
       ConfigureSync(sync_group);
     }
     receive_rtp_config_.erase(ssrc);
+    PublishReceiveRtpConfigSnapshot();
   }
+  --num_audio_streams_;
   UpdateAggregateNetworkState();
   delete audio_receive_stream;
 }
@@ -743,6 +823,7 @@ webrtc::VideoSendStream* Call::CreateVideoSendStream(
     webrtc::VideoSendStream::Config config,
     VideoEncoderConfig encoder_config,
     std::unique_ptr<FecController> fec_controller) {
+#ifdef WEBRTC_VIDEO_PIPELINE
   TRACE_EVENT0("webrtc", "Call::CreateVideoSendStream");
   RTC_DCHECK_RUN_ON(&configuration_sequence_checker_);
 
@@ -775,14 +856,28 @@ webrtc::VideoSendStream* Call::CreateVideoSendStream(
     }
     video_send_streams_.insert(send_stream);
   }
+  // The send-side packet histories are pure resend caches, so they are the
+  // first thing the memory budget reclaims under pressure.
+  video_send_budget_ids_[send_stream] = memory_budget_.Register(
+      MemoryBudget::TrimPriority::kResendHistory,
+      [send_stream] { return send_stream->GetPacketHistoryMemoryUsage(); },
+      [send_stream](size_t bytes) {
+        return send_stream->TrimPacketHistories(bytes);
+      });
+  ++num_video_streams_;
   UpdateAggregateNetworkState();
 
   return send_stream;
+#else
+  RTC_LOG(LS_ERROR) << "Video pipeline not compiled into this build.";
+  return nullptr;
+#endif  // WEBRTC_VIDEO_PIPELINE
 }
 
 webrtc::VideoSendStream* Call::CreateVideoSendStream(
     webrtc::VideoSendStream::Config config,
     VideoEncoderConfig encoder_config) {
+#ifdef WEBRTC_VIDEO_PIPELINE
   if (config_.fec_controller_factory) {
     RTC_LOG(LS_INFO) << "External FEC Controller will be used.";
   }
@@ -792,9 +887,14 @@ webrtc::VideoSendStream* Call::CreateVideoSendStream(
           : std::make_unique<FecControllerDefault>(clock_);
   return CreateVideoSendStream(std::move(config), std::move(encoder_config),
                                std::move(fec_controller));
+#else
+  RTC_LOG(LS_ERROR) << "Video pipeline not compiled into this build.";
+  return nullptr;
+#endif  // WEBRTC_VIDEO_PIPELINE
 }
 
 void Call::DestroyVideoSendStream(webrtc::VideoSendStream* send_stream) {
+#ifdef WEBRTC_VIDEO_PIPELINE
   TRACE_EVENT0("webrtc", "Call::DestroyVideoSendStream");
   RTC_DCHECK(send_stream != nullptr);
   RTC_DCHECK_RUN_ON(&configuration_sequence_checker_);
@@ -817,6 +917,13 @@ void Call::DestroyVideoSendStream(webrtc::VideoSendStream* send_stream) {
   }
   RTC_CHECK(send_stream_impl != nullptr);
 
+  auto budget_it = video_send_budget_ids_.find(send_stream_impl);
+  RTC_DCHECK(budget_it != video_send_budget_ids_.end());
+  if (budget_it != video_send_budget_ids_.end()) {
+    memory_budget_.Unregister(budget_it->second);
+    video_send_budget_ids_.erase(budget_it);
+  }
+
   VideoSendStream::RtpStateMap rtp_states;
   VideoSendStream::RtpPayloadStateMap rtp_payload_states;
   send_stream_impl->StopPermanentlyAndGetRtpStates(&rtp_states,
@@ -828,12 +935,17 @@ void Call::DestroyVideoSendStream(webrtc::VideoSendStream* send_stream) {
     suspended_video_payload_states_[kv.first] = kv.second;
   }
 
+  --num_video_streams_;
   UpdateAggregateNetworkState();
   delete send_stream_impl;
+#else
+  RTC_NOTREACHED();
+#endif  // WEBRTC_VIDEO_PIPELINE
 }
 
 webrtc::VideoReceiveStream* Call::CreateVideoReceiveStream(
     webrtc::VideoReceiveStream::Config configuration) {
+#ifdef WEBRTC_VIDEO_PIPELINE
   TRACE_EVENT0("webrtc", "Call::CreateVideoReceiveStream");
   RTC_DCHECK_RUN_ON(&configuration_sequence_checker_);
 
@@ -844,8 +956,18 @@ webrtc::VideoReceiveStream* Call::CreateVideoReceiveStream(
 
   TaskQueueBase* current = GetCurrentTaskQueueOrThread();
   RTC_CHECK(current);
+  TaskQueueFactory* decode_queue_factory = task_queue_factory_;
+  if (field_trial::IsEnabled("WebRTC-Video-SharedDecodePool")) {
+    if (!decode_pool_factory_) {
+      decode_pool_factory_ = std::make_unique<PooledTaskQueueFactory>(
+          *task_queue_factory_, num_cpu_cores_, "SharedDecoding",
+          TaskQueueFactory::Priority::HIGH);
+    }
+    decode_queue_factory = decode_pool_factory_.get();
+  }
   VideoReceiveStream2* receive_stream = new VideoReceiveStream2(
-      task_queue_factory_, current, &video_receiver_controller_, num_cpu_cores_,
+      decode_queue_factory, current, &video_receiver_controller_,
+      num_cpu_cores_,
       transport_send_ptr_->packet_router(), std::move(configuration),
       module_process_thread_.get(), call_stats_.get(), clock_,
       new VCMTiming(clock_));
@@ -864,17 +986,34 @@ webrtc::VideoReceiveStream* Call::CreateVideoReceiveStream(
     receive_rtp_config_.emplace(config.rtp.remote_ssrc,
                                 ReceiveRtpConfig(config));
     video_receive_streams_.insert(receive_stream);
+    video_receive_ssrcs_[config.rtp.remote_ssrc] = receive_stream;
     ConfigureSync(config.sync_group);
+    PublishReceiveRtpConfigSnapshot();
   }
+  // The packet buffer is a reassembly buffer; trimming it drops late packets
+  // that might still have been usable, so it is reclaimed after the resend
+  // histories.
+  video_receive_budget_ids_[receive_stream] = memory_budget_.Register(
+      MemoryBudget::TrimPriority::kReorderBuffers,
+      [receive_stream] { return receive_stream->PacketBufferMemoryUsage(); },
+      [receive_stream](size_t /*bytes*/) {
+        return receive_stream->TrimPacketBuffer();
+      });
   receive_stream->SignalNetworkState(video_network_state_);
+  ++num_video_streams_;
   UpdateAggregateNetworkState();
   event_log_->Log(std::make_unique<RtcEventVideoReceiveStreamConfig>(
       CreateRtcLogStreamConfig(config)));
   return receive_stream;
+#else
+  RTC_LOG(LS_ERROR) << "Video pipeline not compiled into this build.";
+  return nullptr;
+#endif  // WEBRTC_VIDEO_PIPELINE
 }
 
 void Call::DestroyVideoReceiveStream(
     webrtc::VideoReceiveStream* receive_stream) {
+#ifdef WEBRTC_VIDEO_PIPELINE
   TRACE_EVENT0("webrtc", "Call::DestroyVideoReceiveStream");
   RTC_DCHECK_RUN_ON(&configuration_sequence_checker_);
   RTC_DCHECK(receive_stream != nullptr);
@@ -890,14 +1029,27 @@ void Call::DestroyVideoReceiveStream(
       receive_rtp_config_.erase(config.rtp.rtx_ssrc);
     }
     video_receive_streams_.erase(receive_stream_impl);
+    video_receive_ssrcs_.erase(config.rtp.remote_ssrc);
     ConfigureSync(config.sync_group);
+    PublishReceiveRtpConfigSnapshot();
   }
 
   receive_side_cc_.GetRemoteBitrateEstimator(UseSendSideBwe(config))
       ->RemoveStream(config.rtp.remote_ssrc);
 
+  auto budget_it = video_receive_budget_ids_.find(receive_stream_impl);
+  RTC_DCHECK(budget_it != video_receive_budget_ids_.end());
+  if (budget_it != video_receive_budget_ids_.end()) {
+    memory_budget_.Unregister(budget_it->second);
+    video_receive_budget_ids_.erase(budget_it);
+  }
+
+  --num_video_streams_;
   UpdateAggregateNetworkState();
   delete receive_stream_impl;
+#else
+  RTC_NOTREACHED();
+#endif  // WEBRTC_VIDEO_PIPELINE
 }
 
 FlexfecReceiveStream* Call::CreateFlexfecReceiveStream(
@@ -926,6 +1078,7 @@ FlexfecReceiveStream* Call::CreateFlexfecReceiveStream(
     RTC_DCHECK(receive_rtp_config_.find(config.remote_ssrc) ==
                receive_rtp_config_.end());
     receive_rtp_config_.emplace(config.remote_ssrc, ReceiveRtpConfig(config));
+    PublishReceiveRtpConfigSnapshot();
   }
 
   // TODO(brandtr): Store config in RtcEventLog here.
@@ -944,6 +1097,7 @@ void Call::DestroyFlexfecReceiveStream(FlexfecReceiveStream* receive_stream) {
     const FlexfecReceiveStream::Config& config = receive_stream->GetConfig();
     uint32_t ssrc = config.remote_ssrc;
     receive_rtp_config_.erase(ssrc);
+    PublishReceiveRtpConfigSnapshot();
 
     // Remove all SSRCs pointing to the FlexfecReceiveStreamImpl to be
     // destroyed.
@@ -994,9 +1148,15 @@ Call::Stats Call::GetStats() const {
     stats.max_padding_bitrate_bps = configured_max_padding_bitrate_bps_;
   }
 
+  stats.memory_usage_bytes = memory_budget_.TotalUsageBytes();
+
   return stats;
 }
 
+MemoryBudget* Call::memory_budget() {
+  return &memory_budget_;
+}
+
 void Call::SignalChannelNetworkState(MediaType media, NetworkState state) {
   RTC_DCHECK_RUN_ON(&configuration_sequence_checker_);
   switch (media) {
@@ -1013,12 +1173,14 @@ void Call::SignalChannelNetworkState(MediaType media, NetworkState state) {
   }
 
   UpdateAggregateNetworkState();
+#ifdef WEBRTC_VIDEO_PIPELINE
   {
     ReadLockScoped read_lock(*receive_crit_);
     for (VideoReceiveStream2* video_receive_stream : video_receive_streams_) {
       video_receive_stream->SignalNetworkState(video_network_state_);
     }
   }
+#endif
 }
 
 void Call::OnAudioTransportOverheadChanged(int transport_overhead_per_packet) {
@@ -1031,22 +1193,11 @@ void Call::OnAudioTransportOverheadChanged(int transport_overhead_per_packet) {
 void Call::UpdateAggregateNetworkState() {
   RTC_DCHECK_RUN_ON(&configuration_sequence_checker_);
 
-  bool have_audio = false;
-  bool have_video = false;
-  {
-    ReadLockScoped read_lock(*send_crit_);
-    if (!audio_send_ssrcs_.empty())
-      have_audio = true;
-    if (!video_send_ssrcs_.empty())
-      have_video = true;
-  }
-  {
-    ReadLockScoped read_lock(*receive_crit_);
-    if (!audio_receive_streams_.empty())
-      have_audio = true;
-    if (!video_receive_streams_.empty())
-      have_video = true;
-  }
+  // The counts are maintained as streams are created and destroyed, so the
+  // aggregation does not need to inspect the stream containers or take their
+  // locks.
+  const bool have_audio = num_audio_streams_ > 0;
+  const bool have_video = num_video_streams_ > 0;
 
   bool aggregate_network_up =
       ((have_video && video_network_state_ == kNetworkUp) ||
@@ -1067,8 +1218,10 @@ void Call::UpdateAggregateNetworkState() {
 }
 
 void Call::OnSentPacket(const rtc::SentPacket& sent_packet) {
+#ifdef WEBRTC_VIDEO_PIPELINE
   video_send_delay_stats_->OnSentPacket(sent_packet.packet_id,
                                         clock_->TimeInMilliseconds());
+#endif
   transport_send_ptr_->OnSentPacket(sent_packet);
 }
 
@@ -1157,6 +1310,7 @@ void Call::ConfigureSync(const std::string& sync_group) {
   }
   if (sync_audio_stream)
     sync_stream_mapping_[sync_group] = sync_audio_stream;
+#ifdef WEBRTC_VIDEO_PIPELINE
   size_t num_synced_streams = 0;
   for (VideoReceiveStream2* video_stream : video_receive_streams_) {
     if (video_stream->config().sync_group != sync_group)
@@ -1178,6 +1332,7 @@ void Call::ConfigureSync(const std::string& sync_group) {
       video_stream->SetSync(nullptr);
     }
   }
+#endif  // WEBRTC_VIDEO_PIPELINE
 }
 
 PacketReceiver::DeliveryStatus Call::DeliverRtcp(MediaType media_type,
@@ -1193,20 +1348,57 @@ PacketReceiver::DeliveryStatus Call::DeliverRtcp(MediaType media_type,
     received_rtcp_bytes_per_second_counter_.Add(static_cast<int>(length));
   }
   bool rtcp_delivered = false;
-  if (media_type == MediaType::ANY || media_type == MediaType::VIDEO) {
+  // When the compound packet carries the SSRC of a known media sender, only
+  // the receive stream listening to that sender consumes anything from it, so
+  // the remaining receive streams can skip parsing it entirely. Packets from
+  // unknown senders (e.g. a remote peer reporting from an SSRC it never sends
+  // media on) fall back to the broadcast loops below. Send streams always see
+  // every packet since report blocks and feedback target their local SSRCs
+  // regardless of which SSRC the remote peer reports from.
+  bool routed_to_receive_stream = false;
+  const absl::optional<uint32_t> sender_ssrc =
+      ParseRtcpPacketSenderSsrc(rtc::MakeArrayView(packet, length));
+  if (sender_ssrc) {
+    ReadLockScoped read_lock(*receive_crit_);
+#ifdef WEBRTC_VIDEO_PIPELINE
+    if (media_type == MediaType::ANY || media_type == MediaType::VIDEO) {
+      auto it = video_receive_ssrcs_.find(*sender_ssrc);
+      if (it != video_receive_ssrcs_.end()) {
+        routed_to_receive_stream = true;
+        it->second->DeliverRtcp(packet, length);
+        rtcp_delivered = true;
+      }
+    }
+#endif
+    if (!routed_to_receive_stream &&
+        (media_type == MediaType::ANY || media_type == MediaType::AUDIO)) {
+      auto it = audio_receive_ssrcs_.find(*sender_ssrc);
+      if (it != audio_receive_ssrcs_.end()) {
+        routed_to_receive_stream = true;
+        it->second->DeliverRtcp(packet, length);
+        rtcp_delivered = true;
+      }
+    }
+  }
+#ifdef WEBRTC_VIDEO_PIPELINE
+  if (!routed_to_receive_stream &&
+      (media_type == MediaType::ANY || media_type == MediaType::VIDEO)) {
     ReadLockScoped read_lock(*receive_crit_);
     for (VideoReceiveStream2* stream : video_receive_streams_) {
       if (stream->DeliverRtcp(packet, length))
         rtcp_delivered = true;
     }
   }
-  if (media_type == MediaType::ANY || media_type == MediaType::AUDIO) {
+#endif
+  if (!routed_to_receive_stream &&
+      (media_type == MediaType::ANY || media_type == MediaType::AUDIO)) {
     ReadLockScoped read_lock(*receive_crit_);
     for (AudioReceiveStream* stream : audio_receive_streams_) {
       stream->DeliverRtcp(packet, length);
       rtcp_delivered = true;
     }
   }
+#ifdef WEBRTC_VIDEO_PIPELINE
   if (media_type == MediaType::ANY || media_type == MediaType::VIDEO) {
     ReadLockScoped read_lock(*send_crit_);
     for (VideoSendStream* stream : video_send_streams_) {
@@ -1214,6 +1406,7 @@ PacketReceiver::DeliveryStatus Call::DeliverRtcp(MediaType media_type,
       rtcp_delivered = true;
     }
   }
+#endif
   if (media_type == MediaType::ANY || media_type == MediaType::AUDIO) {
     ReadLockScoped read_lock(*send_crit_);
     for (auto& kv : audio_send_ssrcs_) {
@@ -1259,15 +1452,22 @@ PacketReceiver::DeliveryStatus Call::DeliverRtp(MediaType media_type,
   RTC_DCHECK(media_type == MediaType::AUDIO || media_type == MediaType::VIDEO ||
              is_keep_alive_packet);
 
-  ReadLockScoped read_lock(*receive_crit_);
-  auto it = receive_rtp_config_.find(parsed_packet.Ssrc());
-  if (it == receive_rtp_config_.end()) {
+  // Per-packet delivery deliberately avoids taking |receive_crit_|; the
+  // lock-free snapshot keeps stream add/remove on other threads from stalling
+  // the packet path. The demuxers have their own internal synchronization, so
+  // a stream that deregistered after the snapshot was taken simply won't be
+  // found by OnRtpPacket below.
+  std::shared_ptr<const std::map<uint32_t, ReceiveRtpConfig>> config_snapshot =
+      std::atomic_load(&receive_rtp_config_snapshot_);
+  if (!config_snapshot) {
+    // No receive stream has ever been created.
+    return DELIVERY_UNKNOWN_SSRC;
+  }
+  auto it = config_snapshot->find(parsed_packet.Ssrc());
+  if (it == config_snapshot->end()) {
     RTC_LOG(LS_ERROR) << "receive_rtp_config_ lookup failed for ssrc "
                       << parsed_packet.Ssrc();
-    // Destruction of the receive stream, including deregistering from the
-    // RtpDemuxer, is not protected by the |receive_crit_| lock. But
-    // deregistering in the |receive_rtp_config_| map is protected by that lock.
-    // So by not passing the packet on to demuxing in this case, we prevent
+    // By not passing the packet on to demuxing in this case, we prevent
     // incoming packets to be passed on via the demuxer to a receive stream
     // which is being torned down.
     return DELIVERY_UNKNOWN_SSRC;
@@ -1275,7 +1475,8 @@ PacketReceiver::DeliveryStatus Call::DeliverRtp(MediaType media_type,
 
   parsed_packet.IdentifyExtensions(it->second.extensions);
 
-  NotifyBweOfReceivedPacket(parsed_packet, media_type);
+  NotifyBweOfReceivedPacket(parsed_packet, media_type,
+                            it->second.use_send_side_bwe);
 
   // RateCounters expect input parameter as int, save it as int,
   // instead of converting each time it is passed to RateCounter::Add below.
@@ -1329,15 +1530,17 @@ void Call::OnRecoveredPacket(const uint8_t* packet, size_t length) {
 
   parsed_packet.set_recovered(true);
 
-  ReadLockScoped read_lock(*receive_crit_);
-  auto it = receive_rtp_config_.find(parsed_packet.Ssrc());
-  if (it == receive_rtp_config_.end()) {
+  // Uses the same lock-free snapshot of the receive configs as DeliverRtp().
+  std::shared_ptr<const std::map<uint32_t, ReceiveRtpConfig>> config_snapshot =
+      std::atomic_load(&receive_rtp_config_snapshot_);
+  if (!config_snapshot) {
+    return;
+  }
+  auto it = config_snapshot->find(parsed_packet.Ssrc());
+  if (it == config_snapshot->end()) {
     RTC_LOG(LS_ERROR) << "receive_rtp_config_ lookup failed for ssrc "
                       << parsed_packet.Ssrc();
-    // Destruction of the receive stream, including deregistering from the
-    // RtpDemuxer, is not protected by the |receive_crit_| lock. But
-    // deregistering in the |receive_rtp_config_| map is protected by that lock.
-    // So by not passing the packet on to demuxing in this case, we prevent
+    // By not passing the packet on to demuxing in this case, we prevent
     // incoming packets to be passed on via the demuxer to a receive stream
     // which is being torn down.
     return;
@@ -1349,14 +1552,19 @@ void Call::OnRecoveredPacket(const uint8_t* packet, size_t length) {
   video_receiver_controller_.OnRtpPacket(parsed_packet);
 }
 
-void Call::NotifyBweOfReceivedPacket(const RtpPacketReceived& packet,
-                                     MediaType media_type) {
-  auto it = receive_rtp_config_.find(packet.Ssrc());
-  bool use_send_side_bwe =
-      (it != receive_rtp_config_.end()) && it->second.use_send_side_bwe;
+void Call::PublishReceiveRtpConfigSnapshot() {
+  std::atomic_store(
+      &receive_rtp_config_snapshot_,
+      std::shared_ptr<const std::map<uint32_t, ReceiveRtpConfig>>(
+          std::make_shared<std::map<uint32_t, ReceiveRtpConfig>>(
+              receive_rtp_config_)));
+}
 
+void Call::NotifyBweOfReceivedPacket(const RtpPacketReceived& packet,
+                                     MediaType media_type,
+                                     bool use_send_side_bwe) {
   RTPHeader header;
-  packet.GetHeader(&header);
+  packet.GetBweHeader(&header);
 
   ReceivedPacket packet_msg;
   packet_msg.size = DataSize::Bytes(packet.payload_size());
@@ -31,6 +31,8 @@
 
 namespace webrtc {
 
+class MemoryBudget;
+
 // A Call instance can contain several send and/or receive streams. All streams
 // are assumed to have the same remote endpoint and will share bitrate estimates
 // etc.
@@ -46,6 +48,10 @@ class Call {
     int recv_bandwidth_bps = 0;       // Estimated available receive bandwidth.
     int64_t pacer_delay_ms = 0;
     int64_t rtt_ms = -1;
+    // Total bytes held by the reclaimable buffers registered with the call's
+    // memory budget: the send-side packet histories and the video packet
+    // buffers of the call's video streams; see memory_budget().
+    int64_t memory_usage_bytes = 0;
   };
 
   static Call* Create(const Call::Config& config);
@@ -102,6 +108,13 @@ class Call {
   // pacing delay, etc.
   virtual Stats GetStats() const = 0;
 
+  // Returns the call-scoped memory budget that components owning reclaimable
+  // buffers (packet histories, reassembly buffers, jitter buffers) register
+  // with, or null if the implementation does not provide one. The returned
+  // pointer is valid as long as the Call instance exists. Kept non-pure so
+  // that Call implementations outside this module are unaffected.
+  virtual MemoryBudget* memory_budget() { return nullptr; }
+
   // TODO(skvlad): When the unbundled case with multiple streams for the same
   // media type going over different networks is supported, track the state
   // for each stream separately. Right now it's global per media type.
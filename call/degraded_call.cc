@@ -261,6 +261,10 @@ Call::Stats DegradedCall::GetStats() const {
   return call_->GetStats();
 }
 
+MemoryBudget* DegradedCall::memory_budget() {
+  return call_->memory_budget();
+}
+
 void DegradedCall::SignalChannelNetworkState(MediaType media,
                                              NetworkState state) {
   call_->SignalChannelNetworkState(media, state);
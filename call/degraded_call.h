@@ -83,6 +83,8 @@ class DegradedCall : public Call, private PacketReceiver {
 
   Stats GetStats() const override;
 
+  MemoryBudget* memory_budget() override;
+
   void SignalChannelNetworkState(MediaType media, NetworkState state) override;
   void OnAudioTransportOverheadChanged(
       int transport_overhead_per_packet) override;
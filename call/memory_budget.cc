@@ -0,0 +1,95 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "call/memory_budget.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+MemoryBudget::MemoryBudget() : budget_bytes_(0), next_id_(0) {}
+
+MemoryBudget::~MemoryBudget() {
+  rtc::CritScope cs(&crit_);
+  RTC_DCHECK(participants_.empty())
+      << "Components must unregister before the budget is destroyed.";
+}
+
+void MemoryBudget::SetBudgetBytes(size_t bytes) {
+  rtc::CritScope cs(&crit_);
+  budget_bytes_ = bytes;
+}
+
+size_t MemoryBudget::budget_bytes() const {
+  rtc::CritScope cs(&crit_);
+  return budget_bytes_;
+}
+
+int MemoryBudget::Register(TrimPriority priority,
+                           UsageCallback usage,
+                           TrimCallback trim) {
+  RTC_DCHECK(usage);
+  RTC_DCHECK(trim);
+  rtc::CritScope cs(&crit_);
+  Participant participant;
+  const int id = next_id_++;
+  participant.id = id;
+  participant.priority = priority;
+  participant.usage = std::move(usage);
+  participant.trim = std::move(trim);
+  // Insert before the first participant with a higher priority, keeping the
+  // list sorted by (priority, registration order).
+  auto insert_pos = std::find_if(
+      participants_.begin(), participants_.end(),
+      [priority](const Participant& p) { return p.priority > priority; });
+  participants_.insert(insert_pos, std::move(participant));
+  return id;
+}
+
+void MemoryBudget::Unregister(int id) {
+  rtc::CritScope cs(&crit_);
+  auto it =
+      std::find_if(participants_.begin(), participants_.end(),
+                   [id](const Participant& p) { return p.id == id; });
+  RTC_DCHECK(it != participants_.end());
+  if (it != participants_.end())
+    participants_.erase(it);
+}
+
+size_t MemoryBudget::TotalUsageBytes() const {
+  rtc::CritScope cs(&crit_);
+  return TotalUsageBytesInternal();
+}
+
+size_t MemoryBudget::TotalUsageBytesInternal() const {
+  size_t total = 0;
+  for (const Participant& participant : participants_)
+    total += participant.usage();
+  return total;
+}
+
+size_t MemoryBudget::EnforceBudget() {
+  rtc::CritScope cs(&crit_);
+  if (budget_bytes_ == 0)
+    return 0;
+  size_t usage = TotalUsageBytesInternal();
+  size_t released = 0;
+  for (const Participant& participant : participants_) {
+    if (usage <= budget_bytes_ + released)
+      break;
+    released += participant.trim(usage - released - budget_bytes_);
+  }
+  return released;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,99 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef CALL_MEMORY_BUDGET_H_
+#define CALL_MEMORY_BUDGET_H_
+
+#include <stddef.h>
+
+#include <functional>
+#include <vector>
+
+#include "rtc_base/critical_section.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Tracks the aggregate size of the reclaimable buffers owned by one Call and
+// trims them in priority order when a configured budget is exceeded. The
+// individual buffers (packet histories, reassembly buffers, jitter buffers)
+// each have sane per-instance limits, but nothing bounds their sum; under
+// loss storms the per-call total can spike far beyond what steady state
+// needs. Components register a usage callback reporting how many bytes they
+// currently hold, and a trim callback that releases what it reasonably can.
+//
+// Callbacks are invoked with the registry lock held, on whichever thread
+// calls TotalUsageBytes() or EnforceBudget(); they must therefore be
+// non-blocking, thread-safe, and must not call Register()/Unregister().
+// Registrations must be removed before the registered component is destroyed.
+class MemoryBudget {
+ public:
+  // Trim order under pressure. Lower values are trimmed first.
+  enum class TrimPriority {
+    // Pure resend caches, e.g. RTX packet history. Losing these costs at
+    // worst a failed retransmission, so they go first.
+    kResendHistory = 0,
+    // Reassembly and reordering buffers, e.g. video packet buffers. Trimming
+    // these can drop late packets that would still have been usable.
+    kReorderBuffers = 1,
+    // Buffers that directly back playout, e.g. frame and jitter buffers.
+    // Trimming these is audible or visible, so they go last.
+    kPlayoutBuffers = 2,
+  };
+
+  // Returns the number of bytes the component currently holds.
+  using UsageCallback = std::function<size_t()>;
+  // Asked to release up to the given number of bytes; returns how many bytes
+  // were actually released.
+  using TrimCallback = std::function<size_t(size_t)>;
+
+  MemoryBudget();
+  ~MemoryBudget();
+
+  // Sets the budget enforced by EnforceBudget(). 0 (the default) disables
+  // enforcement.
+  void SetBudgetBytes(size_t bytes);
+  size_t budget_bytes() const;
+
+  // Registers a reclaimable component and returns an id to pass to
+  // Unregister().
+  int Register(TrimPriority priority, UsageCallback usage, TrimCallback trim);
+  void Unregister(int id);
+
+  // Sums the registered usage callbacks.
+  size_t TotalUsageBytes() const;
+
+  // If the current usage exceeds the budget, invokes trim callbacks in
+  // priority order (and registration order within a priority) until usage is
+  // back under the budget or every callback has been asked once. Returns the
+  // number of bytes reported released. No-op when the budget is 0.
+  size_t EnforceBudget();
+
+ private:
+  struct Participant {
+    int id;
+    TrimPriority priority;
+    UsageCallback usage;
+    TrimCallback trim;
+  };
+
+  size_t TotalUsageBytesInternal() const RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
+
+  rtc::CriticalSection crit_;
+  size_t budget_bytes_ RTC_GUARDED_BY(crit_);
+  int next_id_ RTC_GUARDED_BY(crit_);
+  // Kept sorted by (priority, registration order), so EnforceBudget() can
+  // walk it front to back. Registration is rare; enforcement is not.
+  std::vector<Participant> participants_ RTC_GUARDED_BY(crit_);
+};
+
+}  // namespace webrtc
+
+#endif  // CALL_MEMORY_BUDGET_H_
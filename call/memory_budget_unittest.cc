@@ -0,0 +1,162 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "call/memory_budget.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+// A registered component holding |usage| bytes that releases everything it
+// holds when trimmed, and records how much it was asked for.
+class FakeComponent {
+ public:
+  explicit FakeComponent(size_t usage) : usage_(usage) {}
+
+  int RegisterWith(MemoryBudget* budget, MemoryBudget::TrimPriority priority) {
+    return budget->Register(priority, [this] { return usage_; },
+                            [this](size_t bytes) { return Trim(bytes); });
+  }
+
+  size_t usage() const { return usage_; }
+  const std::vector<size_t>& trim_requests() const { return trim_requests_; }
+
+ private:
+  size_t Trim(size_t bytes) {
+    trim_requests_.push_back(bytes);
+    size_t released = std::min(bytes, usage_);
+    usage_ -= released;
+    return released;
+  }
+
+  size_t usage_;
+  std::vector<size_t> trim_requests_;
+};
+
+TEST(MemoryBudgetTest, SumsRegisteredUsage) {
+  MemoryBudget budget;
+  EXPECT_EQ(0u, budget.TotalUsageBytes());
+
+  FakeComponent history(1000);
+  FakeComponent packets(500);
+  int history_id = history.RegisterWith(
+      &budget, MemoryBudget::TrimPriority::kResendHistory);
+  int packets_id = packets.RegisterWith(
+      &budget, MemoryBudget::TrimPriority::kReorderBuffers);
+  EXPECT_EQ(1500u, budget.TotalUsageBytes());
+
+  budget.Unregister(packets_id);
+  EXPECT_EQ(1000u, budget.TotalUsageBytes());
+
+  budget.Unregister(history_id);
+}
+
+TEST(MemoryBudgetTest, EnforceIsNoOpWithoutBudget) {
+  MemoryBudget budget;
+  FakeComponent history(1000);
+  int id = history.RegisterWith(&budget,
+                                MemoryBudget::TrimPriority::kResendHistory);
+
+  EXPECT_EQ(0u, budget.EnforceBudget());
+  EXPECT_TRUE(history.trim_requests().empty());
+  EXPECT_EQ(1000u, history.usage());
+
+  budget.Unregister(id);
+}
+
+TEST(MemoryBudgetTest, EnforceIsNoOpUnderBudget) {
+  MemoryBudget budget;
+  budget.SetBudgetBytes(2000);
+  FakeComponent history(1000);
+  int id = history.RegisterWith(&budget,
+                                MemoryBudget::TrimPriority::kResendHistory);
+
+  EXPECT_EQ(0u, budget.EnforceBudget());
+  EXPECT_TRUE(history.trim_requests().empty());
+
+  budget.Unregister(id);
+}
+
+TEST(MemoryBudgetTest, TrimsLowestPriorityFirst) {
+  MemoryBudget budget;
+  budget.SetBudgetBytes(1200);
+  // Register in reverse priority order to show that trim order follows the
+  // priority, not the registration order.
+  FakeComponent playout(1000);
+  FakeComponent history(1000);
+  int playout_id = playout.RegisterWith(
+      &budget, MemoryBudget::TrimPriority::kPlayoutBuffers);
+  int history_id = history.RegisterWith(
+      &budget, MemoryBudget::TrimPriority::kResendHistory);
+
+  // 2000 held, 1200 allowed: the 800 byte overshoot fits entirely in the
+  // resend history, so the playout buffers are never asked.
+  EXPECT_EQ(800u, budget.EnforceBudget());
+  ASSERT_EQ(1u, history.trim_requests().size());
+  EXPECT_EQ(800u, history.trim_requests()[0]);
+  EXPECT_EQ(200u, history.usage());
+  EXPECT_TRUE(playout.trim_requests().empty());
+
+  budget.Unregister(playout_id);
+  budget.Unregister(history_id);
+}
+
+TEST(MemoryBudgetTest, CascadesToHigherPrioritiesWhenNeeded) {
+  MemoryBudget budget;
+  budget.SetBudgetBytes(500);
+  FakeComponent history(300);
+  FakeComponent packets(400);
+  FakeComponent playout(400);
+  int history_id = history.RegisterWith(
+      &budget, MemoryBudget::TrimPriority::kResendHistory);
+  int packets_id = packets.RegisterWith(
+      &budget, MemoryBudget::TrimPriority::kReorderBuffers);
+  int playout_id = playout.RegisterWith(
+      &budget, MemoryBudget::TrimPriority::kPlayoutBuffers);
+
+  // 1100 held, 500 allowed. The history releases all 300, the packet buffer
+  // all 400 of which only 300 were needed, so the playout buffers are spared.
+  EXPECT_EQ(600u, budget.EnforceBudget());
+  EXPECT_EQ(0u, history.usage());
+  ASSERT_EQ(1u, packets.trim_requests().size());
+  EXPECT_EQ(300u, packets.trim_requests()[0]);
+  EXPECT_TRUE(playout.trim_requests().empty());
+  EXPECT_EQ(500u, budget.TotalUsageBytes());
+
+  budget.Unregister(history_id);
+  budget.Unregister(packets_id);
+  budget.Unregister(playout_id);
+}
+
+TEST(MemoryBudgetTest, AsksEachComponentAtMostOnce) {
+  MemoryBudget budget;
+  budget.SetBudgetBytes(100);
+
+  // Holds 1000 bytes but refuses to release anything.
+  size_t trim_calls = 0;
+  int id = budget.Register(MemoryBudget::TrimPriority::kResendHistory,
+                           [] { return size_t{1000}; },
+                           [&trim_calls](size_t) {
+                             ++trim_calls;
+                             return size_t{0};
+                           });
+
+  EXPECT_EQ(0u, budget.EnforceBudget());
+  EXPECT_EQ(1u, trim_calls);
+
+  budget.Unregister(id);
+}
+
+}  // namespace
+}  // namespace webrtc
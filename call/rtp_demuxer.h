@@ -11,9 +11,10 @@
 #ifndef CALL_RTP_DEMUXER_H_
 #define CALL_RTP_DEMUXER_H_
 
-#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -174,31 +175,48 @@ class RtpDemuxer {
   // sink_by_mid_and_rsid_ maps.
   void RefreshKnownMids();
 
+  // Hashes a (MID, RSID) pair so that sink_by_mid_and_rsid_ can use a hash
+  // table; MID and RSID are constrained by IsLegalMidName/IsLegalRsidName so
+  // combining the two string hashes is collision resistant enough.
+  struct MidRsidHash {
+    size_t operator()(const std::pair<std::string, std::string>& pair) const {
+      std::hash<std::string> hasher;
+      size_t hash = hasher(pair.first);
+      return hash ^ (hasher(pair.second) + 0x9e3779b9 + (hash << 6) +
+                     (hash >> 2));
+    }
+  };
+
   // Map each sink by its component attributes to facilitate quick lookups.
+  // The maps are hash based since per-packet sink resolution must stay O(1)
+  // even with thousands of registered sinks; no code relies on their
+  // iteration order.
   // Payload Type mapping is a multimap because if two sinks register for the
   // same payload type, both AddSinks succeed but we must know not to demux on
   // that attribute since it is ambiguous.
   // Note: Mappings are only modified by AddSink/RemoveSink (except for
   // SSRC mapping which receives all MID, payload type, or RSID to SSRC bindings
   // discovered when demuxing packets).
-  std::map<std::string, RtpPacketSinkInterface*> sink_by_mid_;
-  std::map<uint32_t, RtpPacketSinkInterface*> sink_by_ssrc_;
-  std::multimap<uint8_t, RtpPacketSinkInterface*> sinks_by_pt_;
-  std::map<std::pair<std::string, std::string>, RtpPacketSinkInterface*>
+  std::unordered_map<std::string, RtpPacketSinkInterface*> sink_by_mid_;
+  std::unordered_map<uint32_t, RtpPacketSinkInterface*> sink_by_ssrc_;
+  std::unordered_multimap<uint8_t, RtpPacketSinkInterface*> sinks_by_pt_;
+  std::unordered_map<std::pair<std::string, std::string>,
+                     RtpPacketSinkInterface*,
+                     MidRsidHash>
       sink_by_mid_and_rsid_;
-  std::map<std::string, RtpPacketSinkInterface*> sink_by_rsid_;
+  std::unordered_map<std::string, RtpPacketSinkInterface*> sink_by_rsid_;
 
   // Tracks all the MIDs that have been identified in added criteria. Used to
   // determine if a packet should be dropped right away because the MID is
   // unknown.
-  std::set<std::string> known_mids_;
+  std::unordered_set<std::string> known_mids_;
 
   // Records learned mappings of MID --> SSRC and RSID --> SSRC as packets are
   // received.
   // This is stored separately from the sink mappings because if a sink is
   // removed we want to still remember these associations.
-  std::map<uint32_t, std::string> mid_by_ssrc_;
-  std::map<uint32_t, std::string> rsid_by_ssrc_;
+  std::unordered_map<uint32_t, std::string> mid_by_ssrc_;
+  std::unordered_map<uint32_t, std::string> rsid_by_ssrc_;
 
   // Adds a binding from the SSRC to the given sink. Returns true if there was
   // not already a sink bound to the SSRC or if the sink replaced a different
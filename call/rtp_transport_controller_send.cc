@@ -627,8 +627,10 @@ void RtpTransportControllerSend::UpdateControllerWithTimeInterval() {
   RTC_DCHECK(controller_);
   ProcessInterval msg;
   msg.at_time = Timestamp::Millis(clock_->TimeInMilliseconds());
-  if (add_pacing_to_cwin_)
+  if (add_pacing_to_cwin_) {
     msg.pacer_queue = pacer()->QueueSizeData();
+    msg.pacer_stream_queues = pacer()->GetStreamQueueInfos();
+  }
   PostUpdates(controller_->OnProcessInterval(msg));
 }
 
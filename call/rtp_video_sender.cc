@@ -499,12 +499,8 @@ EncodedImageCallback::Result RtpVideoSender::OnEncodedImage(
     const RTPFragmentationHeader* fragmentation) {
   fec_controller_->UpdateWithEncodedData(encoded_image.size(),
                                          encoded_image._frameType);
-  rtc::CritScope lock(&crit_);
   RTC_DCHECK(!rtp_streams_.empty());
-  if (!active_)
-    return Result(Result::ERROR_SEND_FAILED);
 
-  shared_frame_id_++;
   size_t stream_index = 0;
   if (codec_specific_info &&
       (codec_specific_info->codecType == kVideoCodecVP8 ||
@@ -515,6 +511,22 @@ EncodedImageCallback::Result RtpVideoSender::OnEncodedImage(
   }
   RTC_DCHECK_LT(stream_index, rtp_streams_.size());
 
+  // Only the state guarded by |crit_| is touched under the lock; the header
+  // is built here since |params_| tracks frame ids across calls. The
+  // packetization below runs without the lock held so configuration calls
+  // from other threads are not blocked behind large frames. The rtp modules
+  // are internally synchronized, and this callback is serialized per encoder
+  // queue so the per-stream send path stays single-threaded.
+  RTPVideoHeader video_header;
+  {
+    rtc::CritScope lock(&crit_);
+    if (!active_)
+      return Result(Result::ERROR_SEND_FAILED);
+    shared_frame_id_++;
+    video_header = params_[stream_index].GetRtpVideoHeader(
+        encoded_image, codec_specific_info, shared_frame_id_);
+  }
+
   uint32_t rtp_timestamp =
       encoded_image.Timestamp() +
       rtp_streams_[stream_index].rtp_rtcp->StartTimestamp();
@@ -549,18 +561,21 @@ EncodedImageCallback::Result RtpVideoSender::OnEncodedImage(
 
   bool send_result = rtp_streams_[stream_index].sender_video->SendEncodedImage(
       rtp_config_.payload_type, codec_type_, rtp_timestamp, encoded_image,
-      fragmentation,
-      params_[stream_index].GetRtpVideoHeader(
-          encoded_image, codec_specific_info, shared_frame_id_),
-      expected_retransmission_time_ms);
+      fragmentation, video_header, expected_retransmission_time_ms);
   if (frame_count_observer_) {
-    FrameCounts& counts = frame_counts_[stream_index];
-    if (encoded_image._frameType == VideoFrameType::kVideoFrameKey) {
-      ++counts.key_frames;
-    } else if (encoded_image._frameType == VideoFrameType::kVideoFrameDelta) {
-      ++counts.delta_frames;
-    } else {
-      RTC_DCHECK(encoded_image._frameType == VideoFrameType::kEmptyFrame);
+    FrameCounts counts;
+    {
+      rtc::CritScope lock(&crit_);
+      FrameCounts& stream_counts = frame_counts_[stream_index];
+      if (encoded_image._frameType == VideoFrameType::kVideoFrameKey) {
+        ++stream_counts.key_frames;
+      } else if (encoded_image._frameType ==
+                 VideoFrameType::kVideoFrameDelta) {
+        ++stream_counts.delta_frames;
+      } else {
+        RTC_DCHECK(encoded_image._frameType == VideoFrameType::kEmptyFrame);
+      }
+      counts = stream_counts;
     }
     frame_count_observer_->FrameCountUpdated(counts,
                                              rtp_config_.ssrcs[stream_index]);
@@ -836,6 +851,27 @@ std::vector<RtpSequenceNumberMap::Info> RtpVideoSender::GetSentRtpPacketInfos(
   return std::vector<RtpSequenceNumberMap::Info>();
 }
 
+size_t RtpVideoSender::GetPacketHistoryMemoryUsage() const {
+  // |rtp_streams_| is const after construction and the histories do their own
+  // locking, so no lock is needed here.
+  size_t total_bytes = 0;
+  for (const RtpStreamSender& rtp_stream : rtp_streams_) {
+    total_bytes += rtp_stream.rtp_rtcp->PacketHistoryMemoryUsage();
+  }
+  return total_bytes;
+}
+
+size_t RtpVideoSender::TrimPacketHistories(size_t bytes) {
+  size_t released_bytes = 0;
+  for (const RtpStreamSender& rtp_stream : rtp_streams_) {
+    if (released_bytes >= bytes)
+      break;
+    released_bytes +=
+        rtp_stream.rtp_rtcp->TrimPacketHistory(bytes - released_bytes);
+  }
+  return released_bytes;
+}
+
 int RtpVideoSender::ProtectionRequest(const FecProtectionParams* delta_params,
                                       const FecProtectionParams* key_params,
                                       uint32_t* sent_video_rate_bps,
@@ -155,6 +155,9 @@ class RtpVideoSender : public RtpVideoSenderInterface,
       rtc::ArrayView<const uint16_t> sequence_numbers) const
       RTC_LOCKS_EXCLUDED(crit_) override;
 
+  size_t GetPacketHistoryMemoryUsage() const override;
+  size_t TrimPacketHistories(size_t bytes) override;
+
   // From StreamFeedbackObserver.
   void OnPacketFeedbackVector(
       std::vector<StreamPacketInfo> packet_feedback_vector)
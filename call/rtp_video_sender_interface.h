@@ -63,6 +63,12 @@ class RtpVideoSenderInterface : public EncodedImageCallback,
       uint32_t ssrc,
       rtc::ArrayView<const uint16_t> sequence_numbers) const = 0;
 
+  // Approximate number of heap bytes held by the send-side packet histories
+  // of the rtp modules, and a way to release up to |bytes| of them under
+  // memory pressure. Both may be called from any thread.
+  virtual size_t GetPacketHistoryMemoryUsage() const = 0;
+  virtual size_t TrimPacketHistories(size_t bytes) = 0;
+
   // Implements FecControllerOverride.
   void SetFecAllowed(bool fec_allowed) override = 0;
 };
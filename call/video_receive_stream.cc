@@ -50,6 +50,7 @@ std::string VideoReceiveStream::Stats::ToString(int64_t time_ms) const {
   ss << "key: " << frame_counts.key_frames << ", ";
   ss << "delta: " << frame_counts.delta_frames << ", ";
   ss << "frames_dropped: " << frames_dropped << ", ";
+  ss << "frames_decoded_over_budget: " << frames_decoded_over_budget << ", ";
   ss << "network_fps: " << network_frame_rate << ", ";
   ss << "decode_fps: " << decode_frame_rate << ", ";
   ss << "render_fps: " << render_frame_rate << ", ";
@@ -94,6 +95,10 @@ std::string VideoReceiveStream::Config::ToString() const {
   ss << ", rtp: " << rtp.ToString();
   ss << ", renderer: " << (renderer ? "(renderer)" : "nullptr");
   ss << ", render_delay_ms: " << render_delay_ms;
+  ss << ", enable_low_latency_decoding: "
+     << (enable_low_latency_decoding ? "on" : "off");
+  if (max_decode_ahead_frames > 0)
+    ss << ", max_decode_ahead_frames: " << max_decode_ahead_frames;
   if (!sync_group.empty())
     ss << ", sync_group: " << sync_group;
   ss << ", target_delay_ms: " << target_delay_ms;
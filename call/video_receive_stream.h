@@ -110,6 +110,9 @@ class VideoReceiveStream {
     // https://www.w3.org/TR/webrtc-stats/#dom-rtcvideoreceiverstats-framesdropped
     uint32_t frames_dropped = 0;
     uint32_t frames_decoded = 0;
+    // Frames whose decode time exceeded the decode time the frame scheduler
+    // had budgeted for them; these risk being rendered late.
+    uint32_t frames_decoded_over_budget = 0;
     // https://w3c.github.io/webrtc-stats/#dom-rtcinboundrtpstreamstats-totaldecodetime
     uint64_t total_decode_time_ms = 0;
     // Total inter frame delay in seconds.
@@ -243,6 +246,23 @@ class VideoReceiveStream {
     // available.
     bool enable_prerenderer_smoothing = true;
 
+    // If true, frames are handed to the decoder as soon as they are
+    // continuous and decodable, bypassing the jitter buffer's render time
+    // wait and jitter estimation. Intended for controlled networks (e.g.
+    // LAN capture pipelines) where glass-to-glass latency matters more
+    // than smooth playout. Set |enable_prerenderer_smoothing| to false as
+    // well to also bypass render time smoothing.
+    bool enable_low_latency_decoding = false;
+
+    // Maximum number of frames the jitter buffer may hand to the decoder
+    // before their scheduled decode time while the decoder is idle. The
+    // decoded frames wait in the prerenderer smoothing queue, building
+    // slack that absorbs decode time spikes (typically keyframes) without
+    // render misses. 0 disables decode-ahead. Only honored when
+    // |enable_prerenderer_smoothing| is true, since without smoothing the
+    // early frames would simply render early.
+    int max_decode_ahead_frames = 0;
+
     // Identifier for an A/V synchronization group. Empty string to disable.
     // TODO(pbos): Synchronize streams in a sync group, not just video streams
     // to one of the audio streams.
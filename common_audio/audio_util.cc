@@ -10,38 +10,151 @@
 
 #include "common_audio/include/audio_util.h"
 
+#include "common_audio/audio_util_simd.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY) && !defined(__SSE2__)
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#endif
+
 namespace webrtc {
+namespace {
 
-void FloatToS16(const float* src, size_t size, int16_t* dest) {
+#if defined(WEBRTC_ARCH_X86_FAMILY) && !defined(__SSE2__)
+bool UseSse2() {
+  static const bool use_sse2 = WebRtc_GetCPUInfo(kSSE2) != 0;
+  return use_sse2;
+}
+#endif
+
+}  // namespace
+
+void FloatToS16_C(const float* src, size_t size, int16_t* dest) {
   for (size_t i = 0; i < size; ++i)
     dest[i] = FloatToS16(src[i]);
 }
 
-void S16ToFloat(const int16_t* src, size_t size, float* dest) {
+void S16ToFloat_C(const int16_t* src, size_t size, float* dest) {
   for (size_t i = 0; i < size; ++i)
     dest[i] = S16ToFloat(src[i]);
 }
 
-void S16ToFloatS16(const int16_t* src, size_t size, float* dest) {
+void S16ToFloatS16_C(const int16_t* src, size_t size, float* dest) {
   for (size_t i = 0; i < size; ++i)
     dest[i] = src[i];
 }
 
-void FloatS16ToS16(const float* src, size_t size, int16_t* dest) {
+void FloatS16ToS16_C(const float* src, size_t size, int16_t* dest) {
   for (size_t i = 0; i < size; ++i)
     dest[i] = FloatS16ToS16(src[i]);
 }
 
-void FloatToFloatS16(const float* src, size_t size, float* dest) {
+void FloatToFloatS16_C(const float* src, size_t size, float* dest) {
   for (size_t i = 0; i < size; ++i)
     dest[i] = FloatToFloatS16(src[i]);
 }
 
-void FloatS16ToFloat(const float* src, size_t size, float* dest) {
+void FloatS16ToFloat_C(const float* src, size_t size, float* dest) {
   for (size_t i = 0; i < size; ++i)
     dest[i] = FloatS16ToFloat(src[i]);
 }
 
+void FloatToS16(const float* src, size_t size, int16_t* dest) {
+#if defined(WEBRTC_HAS_NEON)
+  FloatToS16_NEON(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY) && defined(__SSE2__)
+  FloatToS16_SSE2(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+  if (UseSse2()) {
+    FloatToS16_SSE2(src, size, dest);
+  } else {
+    FloatToS16_C(src, size, dest);
+  }
+#else
+  FloatToS16_C(src, size, dest);
+#endif
+}
+
+void S16ToFloat(const int16_t* src, size_t size, float* dest) {
+#if defined(WEBRTC_HAS_NEON)
+  S16ToFloat_NEON(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY) && defined(__SSE2__)
+  S16ToFloat_SSE2(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+  if (UseSse2()) {
+    S16ToFloat_SSE2(src, size, dest);
+  } else {
+    S16ToFloat_C(src, size, dest);
+  }
+#else
+  S16ToFloat_C(src, size, dest);
+#endif
+}
+
+void S16ToFloatS16(const int16_t* src, size_t size, float* dest) {
+#if defined(WEBRTC_HAS_NEON)
+  S16ToFloatS16_NEON(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY) && defined(__SSE2__)
+  S16ToFloatS16_SSE2(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+  if (UseSse2()) {
+    S16ToFloatS16_SSE2(src, size, dest);
+  } else {
+    S16ToFloatS16_C(src, size, dest);
+  }
+#else
+  S16ToFloatS16_C(src, size, dest);
+#endif
+}
+
+void FloatS16ToS16(const float* src, size_t size, int16_t* dest) {
+#if defined(WEBRTC_HAS_NEON)
+  FloatS16ToS16_NEON(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY) && defined(__SSE2__)
+  FloatS16ToS16_SSE2(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+  if (UseSse2()) {
+    FloatS16ToS16_SSE2(src, size, dest);
+  } else {
+    FloatS16ToS16_C(src, size, dest);
+  }
+#else
+  FloatS16ToS16_C(src, size, dest);
+#endif
+}
+
+void FloatToFloatS16(const float* src, size_t size, float* dest) {
+#if defined(WEBRTC_HAS_NEON)
+  FloatToFloatS16_NEON(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY) && defined(__SSE2__)
+  FloatToFloatS16_SSE2(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+  if (UseSse2()) {
+    FloatToFloatS16_SSE2(src, size, dest);
+  } else {
+    FloatToFloatS16_C(src, size, dest);
+  }
+#else
+  FloatToFloatS16_C(src, size, dest);
+#endif
+}
+
+void FloatS16ToFloat(const float* src, size_t size, float* dest) {
+#if defined(WEBRTC_HAS_NEON)
+  FloatS16ToFloat_NEON(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY) && defined(__SSE2__)
+  FloatS16ToFloat_SSE2(src, size, dest);
+#elif defined(WEBRTC_ARCH_X86_FAMILY)
+  if (UseSse2()) {
+    FloatS16ToFloat_SSE2(src, size, dest);
+  } else {
+    FloatS16ToFloat_C(src, size, dest);
+  }
+#else
+  FloatS16ToFloat_C(src, size, dest);
+#endif
+}
+
 template <>
 void DownmixInterleavedToMono<int16_t>(const int16_t* interleaved,
                                        size_t num_frames,
@@ -0,0 +1,111 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <arm_neon.h>
+
+#include "common_audio/audio_util_simd.h"
+#include "common_audio/include/audio_util.h"
+
+namespace webrtc {
+namespace {
+
+// Clamps the elements of |v| to [-32768, 32767], rounds half away from zero
+// as in the scalar FloatS16ToS16() and truncates to integers.
+int32x4_t ClampAndRoundToS32(float32x4_t v) {
+  const float32x4_t kMax = vdupq_n_f32(32767.f);
+  const float32x4_t kMin = vdupq_n_f32(-32768.f);
+  const uint32x4_t kSignMask = vdupq_n_u32(0x80000000);
+  const uint32x4_t kHalf = vreinterpretq_u32_f32(vdupq_n_f32(0.5f));
+  v = vminq_f32(v, kMax);
+  v = vmaxq_f32(v, kMin);
+  // copysign(0.5f, v).
+  const float32x4_t signed_half = vreinterpretq_f32_u32(
+      vorrq_u32(vandq_u32(vreinterpretq_u32_f32(v), kSignMask), kHalf));
+  // Truncation towards zero matches the static_cast in the scalar version.
+  return vcvtq_s32_f32(vaddq_f32(v, signed_half));
+}
+
+}  // namespace
+
+void FloatToS16_NEON(const float* src, size_t size, int16_t* dest) {
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const float32x4_t a = vmulq_n_f32(vld1q_f32(&src[i]), 32768.f);
+    const float32x4_t b = vmulq_n_f32(vld1q_f32(&src[i + 4]), 32768.f);
+    const int16x8_t v = vcombine_s16(vqmovn_s32(ClampAndRoundToS32(a)),
+                                     vqmovn_s32(ClampAndRoundToS32(b)));
+    vst1q_s16(&dest[i], v);
+  }
+  for (; i < size; ++i)
+    dest[i] = FloatToS16(src[i]);
+}
+
+void S16ToFloat_NEON(const int16_t* src, size_t size, float* dest) {
+  constexpr float kScaling = 1.f / 32768.f;
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const int16x8_t v = vld1q_s16(&src[i]);
+    const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(v)));
+    const float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(v)));
+    vst1q_f32(&dest[i], vmulq_n_f32(lo, kScaling));
+    vst1q_f32(&dest[i + 4], vmulq_n_f32(hi, kScaling));
+  }
+  for (; i < size; ++i)
+    dest[i] = S16ToFloat(src[i]);
+}
+
+void S16ToFloatS16_NEON(const int16_t* src, size_t size, float* dest) {
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const int16x8_t v = vld1q_s16(&src[i]);
+    vst1q_f32(&dest[i], vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))));
+    vst1q_f32(&dest[i + 4], vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))));
+  }
+  for (; i < size; ++i)
+    dest[i] = src[i];
+}
+
+void FloatS16ToS16_NEON(const float* src, size_t size, int16_t* dest) {
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const int32x4_t a = ClampAndRoundToS32(vld1q_f32(&src[i]));
+    const int32x4_t b = ClampAndRoundToS32(vld1q_f32(&src[i + 4]));
+    vst1q_s16(&dest[i], vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+  }
+  for (; i < size; ++i)
+    dest[i] = FloatS16ToS16(src[i]);
+}
+
+void FloatToFloatS16_NEON(const float* src, size_t size, float* dest) {
+  const float32x4_t kMax = vdupq_n_f32(1.f);
+  const float32x4_t kMin = vdupq_n_f32(-1.f);
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    const float32x4_t v = vmaxq_f32(vminq_f32(vld1q_f32(&src[i]), kMax), kMin);
+    vst1q_f32(&dest[i], vmulq_n_f32(v, 32768.f));
+  }
+  for (; i < size; ++i)
+    dest[i] = FloatToFloatS16(src[i]);
+}
+
+void FloatS16ToFloat_NEON(const float* src, size_t size, float* dest) {
+  const float32x4_t kMax = vdupq_n_f32(32768.f);
+  const float32x4_t kMin = vdupq_n_f32(-32768.f);
+  constexpr float kScaling = 1.f / 32768.f;
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    const float32x4_t v = vmaxq_f32(vminq_f32(vld1q_f32(&src[i]), kMax), kMin);
+    vst1q_f32(&dest[i], vmulq_n_f32(v, kScaling));
+  }
+  for (; i < size; ++i)
+    dest[i] = FloatS16ToFloat(src[i]);
+}
+
+}  // namespace webrtc
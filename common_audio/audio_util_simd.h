@@ -0,0 +1,54 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_AUDIO_AUDIO_UTIL_SIMD_H_
+#define COMMON_AUDIO_AUDIO_UTIL_SIMD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rtc_base/system/arch.h"
+
+namespace webrtc {
+
+// Scalar reference implementations of the array sample format conversions in
+// common_audio/include/audio_util.h. Exposed for testing.
+void FloatToS16_C(const float* src, size_t size, int16_t* dest);
+void S16ToFloat_C(const int16_t* src, size_t size, float* dest);
+void S16ToFloatS16_C(const int16_t* src, size_t size, float* dest);
+void FloatS16ToS16_C(const float* src, size_t size, int16_t* dest);
+void FloatToFloatS16_C(const float* src, size_t size, float* dest);
+void FloatS16ToFloat_C(const float* src, size_t size, float* dest);
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// SSE2 implementations, bitexact to the scalar reference versions. Defined
+// in audio_util_sse2.cc, which is compiled with SSE2 support.
+void FloatToS16_SSE2(const float* src, size_t size, int16_t* dest);
+void S16ToFloat_SSE2(const int16_t* src, size_t size, float* dest);
+void S16ToFloatS16_SSE2(const int16_t* src, size_t size, float* dest);
+void FloatS16ToS16_SSE2(const float* src, size_t size, int16_t* dest);
+void FloatToFloatS16_SSE2(const float* src, size_t size, float* dest);
+void FloatS16ToFloat_SSE2(const float* src, size_t size, float* dest);
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+// NEON implementations, bitexact to the scalar reference versions. Defined
+// in audio_util_neon.cc.
+void FloatToS16_NEON(const float* src, size_t size, int16_t* dest);
+void S16ToFloat_NEON(const int16_t* src, size_t size, float* dest);
+void S16ToFloatS16_NEON(const int16_t* src, size_t size, float* dest);
+void FloatS16ToS16_NEON(const float* src, size_t size, int16_t* dest);
+void FloatToFloatS16_NEON(const float* src, size_t size, float* dest);
+void FloatS16ToFloat_NEON(const float* src, size_t size, float* dest);
+#endif
+
+}  // namespace webrtc
+
+#endif  // COMMON_AUDIO_AUDIO_UTIL_SIMD_H_
@@ -0,0 +1,122 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <emmintrin.h>
+
+#include "common_audio/audio_util_simd.h"
+#include "common_audio/include/audio_util.h"
+
+namespace webrtc {
+namespace {
+
+// Clamps the elements of |v| to [-32768, 32767], rounds half away from zero
+// as in the scalar FloatS16ToS16() and truncates to integers.
+__m128i ClampAndRoundToS32(__m128 v) {
+  const __m128 kMax = _mm_set1_ps(32767.f);
+  const __m128 kMin = _mm_set1_ps(-32768.f);
+  const __m128 kHalf = _mm_set1_ps(0.5f);
+  const __m128 kSignMask = _mm_set1_ps(-0.f);
+  v = _mm_min_ps(v, kMax);
+  v = _mm_max_ps(v, kMin);
+  // copysign(0.5f, v).
+  const __m128 signed_half = _mm_or_ps(_mm_and_ps(v, kSignMask), kHalf);
+  // Truncation towards zero matches the static_cast in the scalar version.
+  return _mm_cvttps_epi32(_mm_add_ps(v, signed_half));
+}
+
+}  // namespace
+
+void FloatToS16_SSE2(const float* src, size_t size, int16_t* dest) {
+  const __m128 kScaling = _mm_set1_ps(32768.f);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m128i a =
+        ClampAndRoundToS32(_mm_mul_ps(_mm_loadu_ps(&src[i]), kScaling));
+    const __m128i b =
+        ClampAndRoundToS32(_mm_mul_ps(_mm_loadu_ps(&src[i + 4]), kScaling));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]),
+                     _mm_packs_epi32(a, b));
+  }
+  for (; i < size; ++i)
+    dest[i] = FloatToS16(src[i]);
+}
+
+void S16ToFloat_SSE2(const int16_t* src, size_t size, float* dest) {
+  const __m128 kScaling = _mm_set1_ps(1.f / 32768.f);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+    // Sign-extend the 16 bit values to 32 bits.
+    const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+    _mm_storeu_ps(&dest[i], _mm_mul_ps(_mm_cvtepi32_ps(lo), kScaling));
+    _mm_storeu_ps(&dest[i + 4], _mm_mul_ps(_mm_cvtepi32_ps(hi), kScaling));
+  }
+  for (; i < size; ++i)
+    dest[i] = S16ToFloat(src[i]);
+}
+
+void S16ToFloatS16_SSE2(const int16_t* src, size_t size, float* dest) {
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+    // Sign-extend the 16 bit values to 32 bits.
+    const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+    _mm_storeu_ps(&dest[i], _mm_cvtepi32_ps(lo));
+    _mm_storeu_ps(&dest[i + 4], _mm_cvtepi32_ps(hi));
+  }
+  for (; i < size; ++i)
+    dest[i] = src[i];
+}
+
+void FloatS16ToS16_SSE2(const float* src, size_t size, int16_t* dest) {
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    const __m128i a = ClampAndRoundToS32(_mm_loadu_ps(&src[i]));
+    const __m128i b = ClampAndRoundToS32(_mm_loadu_ps(&src[i + 4]));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&dest[i]),
+                     _mm_packs_epi32(a, b));
+  }
+  for (; i < size; ++i)
+    dest[i] = FloatS16ToS16(src[i]);
+}
+
+void FloatToFloatS16_SSE2(const float* src, size_t size, float* dest) {
+  const __m128 kMax = _mm_set1_ps(1.f);
+  const __m128 kMin = _mm_set1_ps(-1.f);
+  const __m128 kScaling = _mm_set1_ps(32768.f);
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m128 v = _mm_loadu_ps(&src[i]);
+    v = _mm_max_ps(_mm_min_ps(v, kMax), kMin);
+    _mm_storeu_ps(&dest[i], _mm_mul_ps(v, kScaling));
+  }
+  for (; i < size; ++i)
+    dest[i] = FloatToFloatS16(src[i]);
+}
+
+void FloatS16ToFloat_SSE2(const float* src, size_t size, float* dest) {
+  const __m128 kMax = _mm_set1_ps(32768.f);
+  const __m128 kMin = _mm_set1_ps(-32768.f);
+  const __m128 kScaling = _mm_set1_ps(1.f / 32768.f);
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m128 v = _mm_loadu_ps(&src[i]);
+    v = _mm_max_ps(_mm_min_ps(v, kMax), kMin);
+    _mm_storeu_ps(&dest[i], _mm_mul_ps(v, kScaling));
+  }
+  for (; i < size; ++i)
+    dest[i] = FloatS16ToFloat(src[i]);
+}
+
+}  // namespace webrtc
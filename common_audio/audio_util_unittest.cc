@@ -10,7 +10,9 @@
 
 #include "common_audio/include/audio_util.h"
 
+#include "common_audio/audio_util_simd.h"
 #include "rtc_base/arraysize.h"
+#include "rtc_base/random.h"
 #include "test/gmock.h"
 #include "test/gtest.h"
 
@@ -19,6 +21,10 @@ namespace {
 
 using ::testing::ElementsAreArray;
 
+// Odd size so that any vectorized implementation has to handle a scalar
+// tail as well.
+constexpr size_t kConversionTestSize = 317;
+
 void ExpectArraysEq(const int16_t* ref, const int16_t* test, size_t length) {
   for (size_t i = 0; i < length; ++i) {
     EXPECT_EQ(ref[i], test[i]);
@@ -91,6 +97,96 @@ TEST(AudioUtilTest, FloatS16ToFloat) {
   ExpectArraysEq(kReference, output, kSize);
 }
 
+// The array conversions may be vectorized on platforms with SIMD support.
+// Verify that the dispatched implementations are bitexact to the scalar
+// reference versions, including clamping and rounding of out-of-range
+// values.
+TEST(AudioUtilTest, FloatToS16MatchesReference) {
+  Random random_generator(42U);
+  float input[kConversionTestSize];
+  for (auto& sample : input) {
+    sample = 4.f * (random_generator.Rand<float>() - 0.5f);
+  }
+  int16_t reference[kConversionTestSize];
+  int16_t output[kConversionTestSize];
+  FloatToS16_C(input, kConversionTestSize, reference);
+  FloatToS16(input, kConversionTestSize, output);
+  ExpectArraysEq(reference, output, kConversionTestSize);
+}
+
+TEST(AudioUtilTest, S16ToFloatMatchesReference) {
+  Random random_generator(42U);
+  int16_t input[kConversionTestSize];
+  for (auto& sample : input) {
+    sample = static_cast<int16_t>(random_generator.Rand(-32768, 32767));
+  }
+  float reference[kConversionTestSize];
+  float output[kConversionTestSize];
+  S16ToFloat_C(input, kConversionTestSize, reference);
+  S16ToFloat(input, kConversionTestSize, output);
+  for (size_t i = 0; i < kConversionTestSize; ++i) {
+    EXPECT_EQ(reference[i], output[i]);
+  }
+}
+
+TEST(AudioUtilTest, S16ToFloatS16MatchesReference) {
+  Random random_generator(42U);
+  int16_t input[kConversionTestSize];
+  for (auto& sample : input) {
+    sample = static_cast<int16_t>(random_generator.Rand(-32768, 32767));
+  }
+  float reference[kConversionTestSize];
+  float output[kConversionTestSize];
+  S16ToFloatS16_C(input, kConversionTestSize, reference);
+  S16ToFloatS16(input, kConversionTestSize, output);
+  for (size_t i = 0; i < kConversionTestSize; ++i) {
+    EXPECT_EQ(reference[i], output[i]);
+  }
+}
+
+TEST(AudioUtilTest, FloatS16ToS16MatchesReference) {
+  Random random_generator(42U);
+  float input[kConversionTestSize];
+  for (auto& sample : input) {
+    sample = 100000.f * (random_generator.Rand<float>() - 0.5f);
+  }
+  int16_t reference[kConversionTestSize];
+  int16_t output[kConversionTestSize];
+  FloatS16ToS16_C(input, kConversionTestSize, reference);
+  FloatS16ToS16(input, kConversionTestSize, output);
+  ExpectArraysEq(reference, output, kConversionTestSize);
+}
+
+TEST(AudioUtilTest, FloatToFloatS16MatchesReference) {
+  Random random_generator(42U);
+  float input[kConversionTestSize];
+  for (auto& sample : input) {
+    sample = 4.f * (random_generator.Rand<float>() - 0.5f);
+  }
+  float reference[kConversionTestSize];
+  float output[kConversionTestSize];
+  FloatToFloatS16_C(input, kConversionTestSize, reference);
+  FloatToFloatS16(input, kConversionTestSize, output);
+  for (size_t i = 0; i < kConversionTestSize; ++i) {
+    EXPECT_EQ(reference[i], output[i]);
+  }
+}
+
+TEST(AudioUtilTest, FloatS16ToFloatMatchesReference) {
+  Random random_generator(42U);
+  float input[kConversionTestSize];
+  for (auto& sample : input) {
+    sample = 100000.f * (random_generator.Rand<float>() - 0.5f);
+  }
+  float reference[kConversionTestSize];
+  float output[kConversionTestSize];
+  FloatS16ToFloat_C(input, kConversionTestSize, reference);
+  FloatS16ToFloat(input, kConversionTestSize, output);
+  for (size_t i = 0; i < kConversionTestSize; ++i) {
+    EXPECT_EQ(reference[i], output[i]);
+  }
+}
+
 TEST(AudioUtilTest, DbfsToFloatS16) {
   static constexpr float kInput[] = {-90.f, -70.f, -30.f, -20.f, -10.f,
                                      -5.f,  -1.f,  0.f,   1.f};
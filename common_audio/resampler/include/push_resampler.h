@@ -18,8 +18,10 @@ namespace webrtc {
 
 class PushSincResampler;
 
-// Wraps PushSincResampler to provide stereo support.
-// TODO(ajm): add support for an arbitrary number of channels.
+// Wraps PushSincResampler to provide a push-based interleaved interface for
+// an arbitrary number of channels. All channels are resampled through a
+// single multichannel PushSincResampler, which shares the kernel-phase
+// computation per output frame across the channels.
 template <typename T>
 class PushResampler {
  public:
@@ -40,19 +42,21 @@ class PushResampler {
   int src_sample_rate_hz_;
   int dst_sample_rate_hz_;
   size_t num_channels_;
-  // Vector that is needed to provide the proper inputs and outputs to the
-  // interleave/de-interleave methods used in Resample. This needs to be
-  // heap-allocated on the state to support an arbitrary number of channels
-  // without doing run-time heap-allocations in the Resample method.
-  std::vector<T*> channel_data_array_;
 
-  struct ChannelResampler {
-    std::unique_ptr<PushSincResampler> resampler;
+  // A single resampler handling all channels in one call.
+  std::unique_ptr<PushSincResampler> resampler_;
+
+  // Planar buffers and pointer arrays needed to provide the proper inputs
+  // and outputs to the interleave/de-interleave methods used in Resample.
+  // These are kept on the state to support an arbitrary number of channels
+  // without doing run-time heap-allocations in the Resample method.
+  struct ChannelBuffers {
     std::vector<T> source;
     std::vector<T> destination;
   };
-
-  std::vector<ChannelResampler> channel_resamplers_;
+  std::vector<ChannelBuffers> channel_buffers_;
+  std::vector<T*> source_pointers_;
+  std::vector<T*> destination_pointers_;
 };
 }  // namespace webrtc
 
@@ -89,17 +89,16 @@ int PushResampler<T>::InitializeIfNeeded(int src_sample_rate_hz,
       static_cast<size_t>(src_sample_rate_hz / 100);
   const size_t dst_size_10ms_mono =
       static_cast<size_t>(dst_sample_rate_hz / 100);
-  channel_resamplers_.clear();
-  for (size_t i = 0; i < num_channels; ++i) {
-    channel_resamplers_.push_back(ChannelResampler());
-    auto channel_resampler = channel_resamplers_.rbegin();
-    channel_resampler->resampler = std::make_unique<PushSincResampler>(
-        src_size_10ms_mono, dst_size_10ms_mono);
-    channel_resampler->source.resize(src_size_10ms_mono);
-    channel_resampler->destination.resize(dst_size_10ms_mono);
+  resampler_ = std::make_unique<PushSincResampler>(
+      src_size_10ms_mono, dst_size_10ms_mono, num_channels);
+  channel_buffers_.resize(num_channels);
+  for (auto& buffers : channel_buffers_) {
+    buffers.source.resize(src_size_10ms_mono);
+    buffers.destination.resize(dst_size_10ms_mono);
   }
 
-  channel_data_array_.resize(num_channels_);
+  source_pointers_.resize(num_channels_);
+  destination_pointers_.resize(num_channels_);
 
   return 0;
 }
@@ -123,24 +122,20 @@ int PushResampler<T>::Resample(const T* src,
   const size_t dst_capacity_mono = dst_capacity / num_channels_;
 
   for (size_t ch = 0; ch < num_channels_; ++ch) {
-    channel_data_array_[ch] = channel_resamplers_[ch].source.data();
+    source_pointers_[ch] = channel_buffers_[ch].source.data();
+    destination_pointers_[ch] = channel_buffers_[ch].destination.data();
   }
 
-  Deinterleave(src, src_length_mono, num_channels_, channel_data_array_.data());
+  Deinterleave(src, src_length_mono, num_channels_, source_pointers_.data());
 
-  size_t dst_length_mono = 0;
+  // All channels are resampled in one call, sharing the kernel-phase
+  // computation per output frame.
+  const size_t dst_length_mono =
+      resampler_->Resample(source_pointers_.data(), src_length_mono,
+                           destination_pointers_.data(), dst_capacity_mono);
 
-  for (auto& resampler : channel_resamplers_) {
-    dst_length_mono = resampler.resampler->Resample(
-        resampler.source.data(), src_length_mono, resampler.destination.data(),
-        dst_capacity_mono);
-  }
-
-  for (size_t ch = 0; ch < num_channels_; ++ch) {
-    channel_data_array_[ch] = channel_resamplers_[ch].destination.data();
-  }
-
-  Interleave(channel_data_array_.data(), dst_length_mono, num_channels_, dst);
+  Interleave(destination_pointers_.data(), dst_length_mono, num_channels_,
+             dst);
   return static_cast<int>(dst_length_mono * num_channels_);
 }
 
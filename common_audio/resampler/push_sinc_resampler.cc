@@ -24,18 +24,46 @@ PushSincResampler::PushSincResampler(size_t source_frames,
                                    this)),
       source_ptr_(nullptr),
       source_ptr_int_(nullptr),
+      source_ptrs_(nullptr),
+      source_ptrs_int_(nullptr),
       destination_frames_(destination_frames),
+      num_channels_(1),
+      first_pass_(true),
+      source_available_(0) {}
+
+PushSincResampler::PushSincResampler(size_t source_frames,
+                                     size_t destination_frames,
+                                     size_t num_channels)
+    : resampler_(new SincResampler(
+          source_frames * 1.0 / destination_frames,
+          source_frames,
+          num_channels,
+          static_cast<SincResamplerMultiChannelCallback*>(this))),
+      source_ptr_(nullptr),
+      source_ptr_int_(nullptr),
+      source_ptrs_(nullptr),
+      source_ptrs_int_(nullptr),
+      destination_frames_(destination_frames),
+      num_channels_(num_channels),
       first_pass_(true),
       source_available_(0) {}
 
 PushSincResampler::~PushSincResampler() {}
 
+void PushSincResampler::EnsureFloatBuffer() {
+  if (float_buffer_.get())
+    return;
+  float_buffer_.reset(new float[destination_frames_ * num_channels_]);
+  float_buffer_ptrs_.resize(num_channels_);
+  for (size_t c = 0; c < num_channels_; ++c)
+    float_buffer_ptrs_[c] = float_buffer_.get() + c * destination_frames_;
+}
+
 size_t PushSincResampler::Resample(const int16_t* source,
                                    size_t source_length,
                                    int16_t* destination,
                                    size_t destination_capacity) {
-  if (!float_buffer_.get())
-    float_buffer_.reset(new float[destination_frames_]);
+  EnsureFloatBuffer();
 
   source_ptr_int_ = source;
   // Pass nullptr as the float source to have Run() read from the int16 source.
@@ -77,6 +105,44 @@ size_t PushSincResampler::Resample(const float* source,
   return destination_frames_;
 }
 
+size_t PushSincResampler::Resample(const int16_t* const* sources,
+                                   size_t source_length,
+                                   int16_t* const* destinations,
+                                   size_t destination_capacity) {
+  EnsureFloatBuffer();
+
+  source_ptrs_int_ = sources;
+  // Pass nullptr as the float sources to have Run() read from the int16
+  // sources.
+  Resample(static_cast<const float* const*>(nullptr), source_length,
+           float_buffer_ptrs_.data(), destination_frames_);
+  for (size_t c = 0; c < num_channels_; ++c)
+    FloatS16ToS16(float_buffer_ptrs_[c], destination_frames_, destinations[c]);
+  source_ptrs_int_ = nullptr;
+  return destination_frames_;
+}
+
+size_t PushSincResampler::Resample(const float* const* sources,
+                                   size_t source_length,
+                                   float* const* destinations,
+                                   size_t destination_capacity) {
+  RTC_CHECK_EQ(source_length, resampler_->request_frames());
+  RTC_CHECK_GE(destination_capacity, destination_frames_);
+  // Cache the source pointers. Calling Resample() will immediately trigger
+  // the Run() callback whereupon we provide the cached values.
+  source_ptrs_ = sources;
+  source_available_ = source_length;
+
+  // See the single-channel Resample() above for why the first pass primes
+  // the SincResampler buffer with a discarded ChunkSize() request.
+  if (first_pass_)
+    resampler_->Resample(resampler_->ChunkSize(), destinations);
+
+  resampler_->Resample(destination_frames_, destinations);
+  source_ptrs_ = nullptr;
+  return destination_frames_;
+}
+
 void PushSincResampler::Run(size_t frames, float* destination) {
   // Ensure we are only asked for the available samples. This would fail if
   // Run() was triggered more than once per Resample() call.
@@ -99,4 +165,31 @@ void PushSincResampler::Run(size_t frames, float* destination) {
   source_available_ -= frames;
 }
 
+void PushSincResampler::Run(size_t frames, float* const* destinations) {
+  // Ensure we are only asked for the available samples. This would fail if
+  // Run() was triggered more than once per Resample() call.
+  RTC_CHECK_EQ(source_available_, frames);
+
+  if (first_pass_) {
+    // Provide dummy input on the first pass, the output of which will be
+    // discarded, as described in the single-channel Resample().
+    for (size_t c = 0; c < num_channels_; ++c)
+      std::memset(destinations[c], 0, frames * sizeof(**destinations));
+    first_pass_ = false;
+    return;
+  }
+
+  if (source_ptrs_) {
+    for (size_t c = 0; c < num_channels_; ++c)
+      std::memcpy(destinations[c], source_ptrs_[c],
+                  frames * sizeof(**destinations));
+  } else {
+    for (size_t c = 0; c < num_channels_; ++c) {
+      for (size_t i = 0; i < frames; ++i)
+        destinations[c][i] = static_cast<float>(source_ptrs_int_[c][i]);
+    }
+  }
+  source_available_ -= frames;
+}
+
 }  // namespace webrtc
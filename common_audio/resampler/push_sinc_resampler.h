@@ -15,6 +15,7 @@
 #include <stdint.h>
 
 #include <memory>
+#include <vector>
 
 #include "common_audio/resampler/sinc_resampler.h"
 #include "rtc_base/constructor_magic.h"
@@ -25,19 +26,28 @@ namespace webrtc {
 // required by WebRTC. SincResampler uses a pull-based interface, and will
 // use SincResamplerCallback::Run() to request data upon a call to Resample().
 // These Run() calls will happen on the same thread Resample() is called on.
-class PushSincResampler : public SincResamplerCallback {
+class PushSincResampler : public SincResamplerCallback,
+                          public SincResamplerMultiChannelCallback {
  public:
   // Provide the size of the source and destination blocks in samples. These
   // must correspond to the same time duration (typically 10 ms) as the sample
   // ratio is inferred from them.
   PushSincResampler(size_t source_frames, size_t destination_frames);
+
+  // Constructs a resampler converting |num_channels| planar channels per
+  // Resample() call through a single SincResampler, sharing the kernel-phase
+  // computation across the channels. Resamplers constructed this way must use
+  // the planar Resample() overloads below.
+  PushSincResampler(size_t source_frames,
+                    size_t destination_frames,
+                    size_t num_channels);
   ~PushSincResampler() override;
 
   // Perform the resampling. |source_frames| must always equal the
   // |source_frames| provided at construction. |destination_capacity| must be
   // at least as large as |destination_frames|. Returns the number of samples
   // provided in destination (for convenience, since this will always be equal
-  // to |destination_frames|).
+  // to |destination_frames|). Only valid for single-channel resamplers.
   size_t Resample(const int16_t* source,
                   size_t source_frames,
                   int16_t* destination,
@@ -47,6 +57,20 @@ class PushSincResampler : public SincResamplerCallback {
                   float* destination,
                   size_t destination_capacity);
 
+  // Planar multichannel variants of the above. |sources| and |destinations|
+  // must each hold num_channels() buffer pointers. Only valid for resamplers
+  // constructed with a channel count.
+  size_t Resample(const int16_t* const* sources,
+                  size_t source_frames,
+                  int16_t* const* destinations,
+                  size_t destination_capacity);
+  size_t Resample(const float* const* sources,
+                  size_t source_frames,
+                  float* const* destinations,
+                  size_t destination_capacity);
+
+  size_t num_channels() const { return num_channels_; }
+
   // Delay due to the filter kernel. Essentially, the time after which an input
   // sample will appear in the resampled output.
   static float AlgorithmicDelaySeconds(int source_rate_hz) {
@@ -56,16 +80,27 @@ class PushSincResampler : public SincResamplerCallback {
  protected:
   // Implements SincResamplerCallback.
   void Run(size_t frames, float* destination) override;
+  // Implements SincResamplerMultiChannelCallback.
+  void Run(size_t frames, float* const* destinations) override;
 
  private:
   friend class PushSincResamplerTest;
   SincResampler* get_resampler_for_testing() { return resampler_.get(); }
 
+  // Lazily allocates |float_buffer_| with one planar channel of
+  // |destination_frames_| samples per channel, and points
+  // |float_buffer_ptrs_| into it.
+  void EnsureFloatBuffer();
+
   std::unique_ptr<SincResampler> resampler_;
   std::unique_ptr<float[]> float_buffer_;
+  std::vector<float*> float_buffer_ptrs_;
   const float* source_ptr_;
   const int16_t* source_ptr_int_;
+  const float* const* source_ptrs_;
+  const int16_t* const* source_ptrs_int_;
   const size_t destination_frames_;
+  const size_t num_channels_;
 
   // True on the first call to Resample(), to prime the SincResampler buffer.
   bool first_pass_;
@@ -14,6 +14,7 @@
 #include <cmath>
 #include <cstring>
 #include <memory>
+#include <vector>
 
 #include "common_audio/include/audio_util.h"
 #include "common_audio/resampler/sinusoidal_linear_chirp_source.h"
@@ -254,6 +255,110 @@ TEST_P(PushSincResamplerTest, ResampleFloat) {
   ResampleTest(false);
 }
 
+// Verify that the planar multichannel interface is bitexact with running
+// one PushSincResampler per channel over the same data.
+TEST(PushSincResamplerMultiChannelTest, MatchesSingleChannelFloat) {
+  static const size_t kNumChannels = 2;
+  static const int kInputRate = 48000;
+  static const size_t kSourceFrames = kInputRate / 100;
+  static const size_t kDestinationFrames = 160;  // 10 ms at 16 kHz.
+  static const size_t kNumBlocks = 20;
+
+  std::vector<std::unique_ptr<SinusoidalLinearChirpSource>> sources;
+  std::vector<std::unique_ptr<PushSincResampler>> reference_resamplers;
+  for (size_t c = 0; c < kNumChannels; ++c) {
+    sources.push_back(std::make_unique<SinusoidalLinearChirpSource>(
+        kInputRate, kNumBlocks * kSourceFrames, 0.5 * kInputRate, 10.0 * c));
+    reference_resamplers.push_back(
+        std::make_unique<PushSincResampler>(kSourceFrames,
+                                            kDestinationFrames));
+  }
+  PushSincResampler resampler(kSourceFrames, kDestinationFrames,
+                              kNumChannels);
+
+  std::vector<std::vector<float>> input(kNumChannels);
+  std::vector<std::vector<float>> reference(kNumChannels);
+  std::vector<std::vector<float>> output(kNumChannels);
+  std::vector<const float*> input_ptrs(kNumChannels);
+  std::vector<float*> output_ptrs(kNumChannels);
+  for (size_t c = 0; c < kNumChannels; ++c) {
+    input[c].resize(kSourceFrames);
+    reference[c].resize(kDestinationFrames);
+    output[c].resize(kDestinationFrames);
+    input_ptrs[c] = input[c].data();
+    output_ptrs[c] = output[c].data();
+  }
+
+  for (size_t block = 0; block < kNumBlocks; ++block) {
+    for (size_t c = 0; c < kNumChannels; ++c) {
+      sources[c]->Run(kSourceFrames, input[c].data());
+      reference_resamplers[c]->Resample(input[c].data(), kSourceFrames,
+                                        reference[c].data(),
+                                        kDestinationFrames);
+    }
+    resampler.Resample(input_ptrs.data(), kSourceFrames, output_ptrs.data(),
+                       kDestinationFrames);
+    for (size_t c = 0; c < kNumChannels; ++c) {
+      for (size_t i = 0; i < kDestinationFrames; ++i) {
+        ASSERT_EQ(reference[c][i], output[c][i])
+            << "block=" << block << " channel=" << c << " i=" << i;
+      }
+    }
+  }
+}
+
+TEST(PushSincResamplerMultiChannelTest, MatchesSingleChannelInt) {
+  static const size_t kNumChannels = 2;
+  static const int kInputRate = 32000;
+  static const size_t kSourceFrames = kInputRate / 100;
+  static const size_t kDestinationFrames = 480;  // 10 ms at 48 kHz.
+  static const size_t kNumBlocks = 20;
+
+  std::vector<std::unique_ptr<SinusoidalLinearChirpSource>> sources;
+  std::vector<std::unique_ptr<PushSincResampler>> reference_resamplers;
+  for (size_t c = 0; c < kNumChannels; ++c) {
+    sources.push_back(std::make_unique<SinusoidalLinearChirpSource>(
+        kInputRate, kNumBlocks * kSourceFrames, 0.5 * kInputRate, 10.0 * c));
+    reference_resamplers.push_back(
+        std::make_unique<PushSincResampler>(kSourceFrames,
+                                            kDestinationFrames));
+  }
+  PushSincResampler resampler(kSourceFrames, kDestinationFrames,
+                              kNumChannels);
+
+  std::vector<float> source_float(kSourceFrames);
+  std::vector<std::vector<int16_t>> input(kNumChannels);
+  std::vector<std::vector<int16_t>> reference(kNumChannels);
+  std::vector<std::vector<int16_t>> output(kNumChannels);
+  std::vector<const int16_t*> input_ptrs(kNumChannels);
+  std::vector<int16_t*> output_ptrs(kNumChannels);
+  for (size_t c = 0; c < kNumChannels; ++c) {
+    input[c].resize(kSourceFrames);
+    reference[c].resize(kDestinationFrames);
+    output[c].resize(kDestinationFrames);
+    input_ptrs[c] = input[c].data();
+    output_ptrs[c] = output[c].data();
+  }
+
+  for (size_t block = 0; block < kNumBlocks; ++block) {
+    for (size_t c = 0; c < kNumChannels; ++c) {
+      sources[c]->Run(kSourceFrames, source_float.data());
+      FloatToS16(source_float.data(), kSourceFrames, input[c].data());
+      reference_resamplers[c]->Resample(input[c].data(), kSourceFrames,
+                                        reference[c].data(),
+                                        kDestinationFrames);
+    }
+    resampler.Resample(input_ptrs.data(), kSourceFrames, output_ptrs.data(),
+                       kDestinationFrames);
+    for (size_t c = 0; c < kNumChannels; ++c) {
+      for (size_t i = 0; i < kDestinationFrames; ++i) {
+        ASSERT_EQ(reference[c][i], output[c][i])
+            << "block=" << block << " channel=" << c << " i=" << i;
+      }
+    }
+  }
+}
+
 // Thresholds chosen arbitrarily based on what each resampling reported during
 // testing.  All thresholds are in dbFS, http://en.wikipedia.org/wiki/DBFS.
 INSTANTIATE_TEST_SUITE_P(
@@ -123,19 +123,24 @@ const size_t SincResampler::kKernelSize;
 
 // If we know the minimum architecture at compile time, avoid CPU detection.
 #if defined(WEBRTC_ARCH_X86_FAMILY)
-#if defined(__SSE2__)
-#define CONVOLVE_FUNC Convolve_SSE
-void SincResampler::InitializeCPUSpecificFeatures() {}
-#else
 // x86 CPU detection required.  Function will be set by
-// InitializeCPUSpecificFeatures().
-// TODO(dalecurtis): Once Chrome moves to an SSE baseline this can be removed.
+// InitializeCPUSpecificFeatures().  Even with a compile-time SSE2 baseline
+// the indirection remains, since AVX2 can only be detected at run time.
 #define CONVOLVE_FUNC convolve_proc_
 
 void SincResampler::InitializeCPUSpecificFeatures() {
+  if (WebRtc_GetCPUInfo(kAVX2)) {
+    convolve_proc_ = Convolve_AVX2;
+    return;
+  }
+#if defined(__SSE2__)
+  convolve_proc_ = Convolve_SSE;
+#else
+  // TODO(dalecurtis): Once Chrome moves to an SSE baseline this can be
+  // removed.
   convolve_proc_ = WebRtc_GetCPUInfo(kSSE2) ? Convolve_SSE : Convolve_C;
-}
 #endif
+}
 #elif defined(WEBRTC_HAS_NEON)
 #define CONVOLVE_FUNC Convolve_NEON
 void SincResampler::InitializeCPUSpecificFeatures() {}
@@ -148,29 +153,55 @@ void SincResampler::InitializeCPUSpecificFeatures() {}
 SincResampler::SincResampler(double io_sample_rate_ratio,
                              size_t request_frames,
                              SincResamplerCallback* read_cb)
+    : SincResampler(io_sample_rate_ratio, request_frames, read_cb, 1, nullptr) {
+  RTC_DCHECK(read_cb);
+}
+
+SincResampler::SincResampler(
+    double io_sample_rate_ratio,
+    size_t request_frames,
+    size_t num_channels,
+    SincResamplerMultiChannelCallback* multi_channel_read_cb)
+    : SincResampler(io_sample_rate_ratio,
+                    request_frames,
+                    nullptr,
+                    num_channels,
+                    multi_channel_read_cb) {
+  RTC_DCHECK(multi_channel_read_cb);
+}
+
+SincResampler::SincResampler(double io_sample_rate_ratio,
+                             size_t request_frames,
+                             SincResamplerCallback* read_cb,
+                             size_t num_channels,
+                             SincResamplerMultiChannelCallback* multi_read_cb)
     : io_sample_rate_ratio_(io_sample_rate_ratio),
       read_cb_(read_cb),
+      multi_channel_read_cb_(multi_read_cb),
       request_frames_(request_frames),
+      num_channels_(num_channels),
       input_buffer_size_(request_frames_ + kKernelSize),
-      // Create input buffers with a 16-byte alignment for SSE optimizations.
+      // Create input buffers with a 32-byte alignment for SSE and AVX
+      // optimizations.
       kernel_storage_(static_cast<float*>(
-          AlignedMalloc(sizeof(float) * kKernelStorageSize, 16))),
+          AlignedMalloc(sizeof(float) * kKernelStorageSize, 32))),
       kernel_pre_sinc_storage_(static_cast<float*>(
-          AlignedMalloc(sizeof(float) * kKernelStorageSize, 16))),
+          AlignedMalloc(sizeof(float) * kKernelStorageSize, 32))),
       kernel_window_storage_(static_cast<float*>(
-          AlignedMalloc(sizeof(float) * kKernelStorageSize, 16))),
+          AlignedMalloc(sizeof(float) * kKernelStorageSize, 32))),
       input_buffer_(static_cast<float*>(
-          AlignedMalloc(sizeof(float) * input_buffer_size_, 16))),
-#if defined(WEBRTC_ARCH_X86_FAMILY) && !defined(__SSE2__)
-      convolve_proc_(nullptr),
-#endif
+          AlignedMalloc(sizeof(float) * input_buffer_size_ * num_channels_,
+                        32))),
+      read_destinations_(num_channels_),
       r1_(input_buffer_.get()),
       r2_(input_buffer_.get() + kKernelSize / 2) {
-#if defined(WEBRTC_ARCH_X86_FAMILY) && !defined(__SSE2__)
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  convolve_proc_ = nullptr;
   InitializeCPUSpecificFeatures();
   RTC_DCHECK(convolve_proc_);
 #endif
   RTC_DCHECK_GT(request_frames_, 0);
+  RTC_DCHECK_GT(num_channels_, 0);
   Flush();
   RTC_DCHECK_GT(block_size_, kKernelSize);
 
@@ -264,12 +295,28 @@ void SincResampler::SetRatio(double io_sample_rate_ratio) {
   }
 }
 
+void SincResampler::ReadFrames(float* destination) {
+  if (read_cb_) {
+    read_cb_->Run(request_frames_, destination);
+    return;
+  }
+  for (size_t c = 0; c < num_channels_; ++c)
+    read_destinations_[c] = destination + c * input_buffer_size_;
+  multi_channel_read_cb_->Run(request_frames_, read_destinations_.data());
+}
+
 void SincResampler::Resample(size_t frames, float* destination) {
+  RTC_DCHECK_EQ(1, num_channels_);
+  Resample(frames, &destination);
+}
+
+void SincResampler::Resample(size_t frames, float* const* destinations) {
   size_t remaining_frames = frames;
+  size_t output_idx = 0;
 
   // Step (1) -- Prime the input buffer at the start of the input stream.
   if (!buffer_primed_ && remaining_frames) {
-    read_cb_->Run(request_frames_, r0_);
+    ReadFrames(r0_);
     buffer_primed_ = true;
   }
 
@@ -310,11 +357,16 @@ void SincResampler::Resample(size_t frames, float* destination) {
       // Initialize input pointer based on quantized |virtual_source_idx_|.
       const float* const input_ptr = r1_ + source_idx;
 
-      // Figure out how much to weight each kernel's "convolution".
+      // Figure out how much to weight each kernel's "convolution".  The
+      // kernel phase is computed once and shared by all channels.
       const double kernel_interpolation_factor =
           virtual_offset_idx - offset_idx;
-      *destination++ =
-          CONVOLVE_FUNC(input_ptr, k1, k2, kernel_interpolation_factor);
+      for (size_t c = 0; c < num_channels_; ++c) {
+        destinations[c][output_idx] =
+            CONVOLVE_FUNC(input_ptr + c * input_buffer_size_, k1, k2,
+                          kernel_interpolation_factor);
+      }
+      ++output_idx;
 
       // Advance the virtual index.
       virtual_source_idx_ += current_io_ratio;
@@ -326,16 +378,19 @@ void SincResampler::Resample(size_t frames, float* destination) {
     // Wrap back around to the start.
     virtual_source_idx_ -= block_size_;
 
-    // Step (3) -- Copy r3_, r4_ to r1_, r2_.
+    // Step (3) -- Copy r3_, r4_ to r1_, r2_ in every channel.
     // This wraps the last input frames back to the start of the buffer.
-    memcpy(r1_, r3_, sizeof(*input_buffer_.get()) * kKernelSize);
+    for (size_t c = 0; c < num_channels_; ++c) {
+      memcpy(r1_ + c * input_buffer_size_, r3_ + c * input_buffer_size_,
+             sizeof(*input_buffer_.get()) * kKernelSize);
+    }
 
     // Step (4) -- Reinitialize regions if necessary.
     if (r0_ == r2_)
       UpdateRegions(true);
 
     // Step (5) -- Refresh the buffer with more input.
-    read_cb_->Run(request_frames_, r0_);
+    ReadFrames(r0_);
   }
 }
 
@@ -349,7 +404,7 @@ void SincResampler::Flush() {
   virtual_source_idx_ = 0;
   buffer_primed_ = false;
   memset(input_buffer_.get(), 0,
-         sizeof(*input_buffer_.get()) * input_buffer_size_);
+         sizeof(*input_buffer_.get()) * input_buffer_size_ * num_channels_);
   UpdateRegions(false);
 }
 
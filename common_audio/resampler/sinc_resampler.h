@@ -17,6 +17,7 @@
 #include <stddef.h>
 
 #include <memory>
+#include <vector>
 
 #include "rtc_base/constructor_magic.h"
 #include "rtc_base/gtest_prod_util.h"
@@ -34,7 +35,20 @@ class SincResamplerCallback {
   virtual void Run(size_t frames, float* destination) = 0;
 };
 
-// SincResampler is a high-quality single-channel sample-rate converter.
+// Callback class for providing more data into a multichannel resampler.
+// Expects |frames| of data per channel to be rendered into the planar
+// buffers in |destinations|; zero padded if not enough frames are available
+// to satisfy the request.
+class SincResamplerMultiChannelCallback {
+ public:
+  virtual ~SincResamplerMultiChannelCallback() {}
+  virtual void Run(size_t frames, float* const* destinations) = 0;
+};
+
+// SincResampler is a high-quality sample-rate converter. It resamples one
+// channel by default, but can also be constructed with several planar
+// channels which all share the same kernel-phase computation per output
+// frame.
 class SincResampler {
  public:
   // The kernel size can be adjusted for quality (higher is better) at the
@@ -62,17 +76,33 @@ class SincResampler {
   SincResampler(double io_sample_rate_ratio,
                 size_t request_frames,
                 SincResamplerCallback* read_cb);
+
+  // Constructs a resampler for |num_channels| planar channels. The channels
+  // advance in lockstep: each output frame computes the kernel phase once
+  // and convolves every channel with the same kernels.
+  SincResampler(double io_sample_rate_ratio,
+                size_t request_frames,
+                size_t num_channels,
+                SincResamplerMultiChannelCallback* multi_channel_read_cb);
   virtual ~SincResampler();
 
-  // Resample |frames| of data from |read_cb_| into |destination|.
+  // Resample |frames| of data from |read_cb_| into |destination|. Only valid
+  // for single-channel resamplers.
   void Resample(size_t frames, float* destination);
 
+  // Resample |frames| of data per channel from |multi_channel_read_cb_| into
+  // the planar buffers in |destinations|, which must hold num_channels()
+  // pointers.
+  void Resample(size_t frames, float* const* destinations);
+
   // The maximum size in frames that guarantees Resample() will only make a
   // single call to |read_cb_| for more data.
   size_t ChunkSize() const;
 
   size_t request_frames() const { return request_frames_; }
 
+  size_t num_channels() const { return num_channels_; }
+
   // Flush all buffered data and reset internal indices.  Not thread safe, do
   // not call while Resample() is in progress.
   void Flush();
@@ -91,9 +121,22 @@ class SincResampler {
   FRIEND_TEST_ALL_PREFIXES(SincResamplerTest, Convolve);
   FRIEND_TEST_ALL_PREFIXES(SincResamplerTest, ConvolveBenchmark);
 
+  // Delegated constructor carrying both callback flavors; exactly one of
+  // |read_cb| and |multi_read_cb| must be non-null.
+  SincResampler(double io_sample_rate_ratio,
+                size_t request_frames,
+                SincResamplerCallback* read_cb,
+                size_t num_channels,
+                SincResamplerMultiChannelCallback* multi_read_cb);
+
   void InitializeKernel();
   void UpdateRegions(bool second_load);
 
+  // Requests |request_frames_| frames for every channel from the read
+  // callback, with channel 0 rendered at |destination| and subsequent
+  // channels at |input_buffer_size_| strides from it.
+  void ReadFrames(float* destination);
+
   // Selects runtime specific CPU features like SSE.  Must be called before
   // using SincResampler.
   // TODO(ajm): Currently managed by the class internally. See the note with
@@ -112,6 +155,12 @@ class SincResampler {
                             const float* k1,
                             const float* k2,
                             double kernel_interpolation_factor);
+  // Defined in sinc_resampler_avx2.cc, which is compiled with AVX2/FMA
+  // support. Only called when the running CPU reports AVX2.
+  static float Convolve_AVX2(const float* input_ptr,
+                             const float* k1,
+                             const float* k2,
+                             double kernel_interpolation_factor);
 #elif defined(WEBRTC_HAS_NEON)
   static float Convolve_NEON(const float* input_ptr,
                              const float* k1,
@@ -129,16 +178,25 @@ class SincResampler {
   // The buffer is primed once at the very beginning of processing.
   bool buffer_primed_;
 
-  // Source of data for resampling.
+  // Source of data for resampling. Exactly one of the two callbacks is
+  // non-null; |read_cb_| for single-channel resamplers and
+  // |multi_channel_read_cb_| for multichannel ones.
   SincResamplerCallback* read_cb_;
+  SincResamplerMultiChannelCallback* multi_channel_read_cb_;
 
-  // The size (in samples) to request from each |read_cb_| execution.
+  // The size (in samples per channel) to request from each read callback
+  // execution.
   const size_t request_frames_;
 
+  // The number of planar channels resampled in lockstep.
+  const size_t num_channels_;
+
   // The number of source frames processed per pass.
   size_t block_size_;
 
-  // The size (in samples) of the internal buffer used by the resampler.
+  // The size (in samples) of the internal buffer used by the resampler for
+  // one channel. Channel c of |input_buffer_| starts at offset
+  // c * input_buffer_size_.
   const size_t input_buffer_size_;
 
   // Contains kKernelOffsetCount kernels back-to-back, each of size kKernelSize.
@@ -149,13 +207,20 @@ class SincResampler {
   std::unique_ptr<float[], AlignedFreeDeleter> kernel_window_storage_;
 
   // Data from the source is copied into this buffer for each processing pass.
+  // Holds num_channels_ planar channels of input_buffer_size_ samples each.
   std::unique_ptr<float[], AlignedFreeDeleter> input_buffer_;
 
-// Stores the runtime selection of which Convolve function to use.
+  // Scratch pointers handed to |multi_channel_read_cb_|, sized to
+  // num_channels_. Kept on the state to avoid per-pass heap allocations.
+  std::vector<float*> read_destinations_;
+
+// Stores the runtime selection of which Convolve function to use.  Even
+// builds with a guaranteed SSE2 baseline need the indirection on x86, since
+// AVX2 can only be detected at run time.
 // TODO(ajm): Move to using a global static which must only be initialized
 // once by the user. We're not doing this initially, because we don't have
 // e.g. a LazyInstance helper in webrtc.
-#if defined(WEBRTC_ARCH_X86_FAMILY) && !defined(__SSE2__)
+#if defined(WEBRTC_ARCH_X86_FAMILY)
   typedef float (*ConvolveProc)(const float*,
                                 const float*,
                                 const float*,
@@ -163,8 +228,8 @@ class SincResampler {
   ConvolveProc convolve_proc_;
 #endif
 
-  // Pointers to the various regions inside |input_buffer_|.  See the diagram at
-  // the top of the .cc file for more information.
+  // Pointers to the various regions inside channel 0 of |input_buffer_|.
+  // See the diagram at the top of the .cc file for more information.
   float* r0_;
   float* const r1_;
   float* const r2_;
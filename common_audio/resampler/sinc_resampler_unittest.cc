@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <memory>
 #include <tuple>
+#include <vector>
 
 #include "common_audio/resampler/sinusoidal_linear_chirp_source.h"
 #include "rtc_base/stringize_macros.h"
@@ -102,6 +103,73 @@ TEST(SincResamplerTest, Flush) {
     ASSERT_FLOAT_EQ(resampled_destination[i], 0);
 }
 
+// Adapter feeding one single-channel source per channel to a multichannel
+// resampler.
+class PlanarSources : public SincResamplerMultiChannelCallback {
+ public:
+  explicit PlanarSources(std::vector<SincResamplerCallback*> sources)
+      : sources_(std::move(sources)) {}
+
+  void Run(size_t frames, float* const* destinations) override {
+    for (size_t c = 0; c < sources_.size(); ++c)
+      sources_[c]->Run(frames, destinations[c]);
+  }
+
+ private:
+  const std::vector<SincResamplerCallback*> sources_;
+};
+
+// Verify that a multichannel resampler is bitexact with independent
+// single-channel resamplers fed the same per-channel data.
+TEST(SincResamplerTest, MultiChannelMatchesSingleChannel) {
+  static const size_t kNumChannels = 3;
+  static const int kInputRate = 48000;
+  static const int kOutputRate = 16000;
+  static const double kIoRatio = kInputRate / static_cast<double>(kOutputRate);
+  // Resample enough output to wrap the internal buffer several times.
+  static const size_t kOutputSamples = kOutputRate / 10 * 20;
+  static const size_t kInputSamples =
+      static_cast<size_t>(kOutputSamples * kIoRatio) + kInputRate;
+
+  // Generate per-channel references with single-channel resamplers. Each
+  // channel gets a differently delayed chirp.
+  std::vector<std::unique_ptr<float[]>> reference(kNumChannels);
+  for (size_t c = 0; c < kNumChannels; ++c) {
+    SinusoidalLinearChirpSource source(kInputRate, kInputSamples,
+                                       0.5 * kInputRate, 10.0 * c);
+    SincResampler resampler(kIoRatio, SincResampler::kDefaultRequestSize,
+                            &source);
+    reference[c].reset(new float[kOutputSamples]);
+    resampler.Resample(kOutputSamples, reference[c].get());
+  }
+
+  // Resample the same chirps through one multichannel resampler.
+  std::vector<std::unique_ptr<SinusoidalLinearChirpSource>> sources;
+  std::vector<SincResamplerCallback*> source_ptrs;
+  for (size_t c = 0; c < kNumChannels; ++c) {
+    sources.push_back(std::make_unique<SinusoidalLinearChirpSource>(
+        kInputRate, kInputSamples, 0.5 * kInputRate, 10.0 * c));
+    source_ptrs.push_back(sources.back().get());
+  }
+  PlanarSources planar_sources(source_ptrs);
+  SincResampler resampler(kIoRatio, SincResampler::kDefaultRequestSize,
+                          kNumChannels, &planar_sources);
+  EXPECT_EQ(kNumChannels, resampler.num_channels());
+
+  std::vector<std::unique_ptr<float[]>> output(kNumChannels);
+  std::vector<float*> output_ptrs(kNumChannels);
+  for (size_t c = 0; c < kNumChannels; ++c) {
+    output[c].reset(new float[kOutputSamples]);
+    output_ptrs[c] = output[c].get();
+  }
+  resampler.Resample(kOutputSamples, output_ptrs.data());
+
+  for (size_t c = 0; c < kNumChannels; ++c) {
+    for (size_t i = 0; i < kOutputSamples; ++i)
+      ASSERT_EQ(reference[c][i], output[c][i]) << "channel=" << c << " i=" << i;
+  }
+}
+
 // Test flush resets the internal state properly.
 TEST(SincResamplerTest, DISABLED_SetRatioBench) {
   MockSource mock_source;
@@ -161,6 +229,28 @@ TEST(SincResamplerTest, Convolve) {
       resampler.kernel_storage_.get() + 1, resampler.kernel_storage_.get(),
       resampler.kernel_storage_.get(), kKernelInterpolationFactor);
   EXPECT_NEAR(result2, result, kEpsilon);
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  // Test Convolve_AVX2() when the CPU supports it.  The FMA instructions it
+  // uses round differently than Convolve_C(), hence the epsilon.
+  if (WebRtc_GetCPUInfo(kAVX2)) {
+    result = resampler.Convolve_C(
+        resampler.kernel_storage_.get(), resampler.kernel_storage_.get(),
+        resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+    result2 = resampler.Convolve_AVX2(
+        resampler.kernel_storage_.get(), resampler.kernel_storage_.get(),
+        resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+    EXPECT_NEAR(result2, result, kEpsilon);
+
+    result = resampler.Convolve_C(
+        resampler.kernel_storage_.get() + 1, resampler.kernel_storage_.get(),
+        resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+    result2 = resampler.Convolve_AVX2(
+        resampler.kernel_storage_.get() + 1, resampler.kernel_storage_.get(),
+        resampler.kernel_storage_.get(), kKernelInterpolationFactor);
+    EXPECT_NEAR(result2, result, kEpsilon);
+  }
+#endif
 }
 #endif
 
@@ -0,0 +1,81 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+
+#include <emmintrin.h>
+
+static void DotProductWithScaleSse2(int32_t* cross_correlation,
+                                    const int16_t* vector1,
+                                    const int16_t* vector2,
+                                    size_t length,
+                                    int scaling) {
+  size_t i = 0;
+  size_t len1 = length >> 3;
+  size_t len2 = length & 7;
+  __m128i sum64 = _mm_setzero_si128();
+  int64_t sum64_halves[2];
+  int64_t sum_res = 0;
+
+  for (i = len1; i > 0; i -= 1) {
+    const __m128i seq1 = _mm_loadu_si128((const __m128i*)vector1);
+    const __m128i seq2 = _mm_loadu_si128((const __m128i*)vector2);
+    // Form the eight 32-bit products from the low and high halves of the
+    // 16x16-bit multiplications.
+    const __m128i mul_lo = _mm_mullo_epi16(seq1, seq2);
+    const __m128i mul_hi = _mm_mulhi_epi16(seq1, seq2);
+    const __m128i prod0 = _mm_unpacklo_epi16(mul_lo, mul_hi);
+    const __m128i prod1 = _mm_unpackhi_epi16(mul_lo, mul_hi);
+    // Sign-extend the products to 64 bits and accumulate, so that the sum
+    // cannot overflow.
+    const __m128i sign0 = _mm_srai_epi32(prod0, 31);
+    const __m128i sign1 = _mm_srai_epi32(prod1, 31);
+    sum64 = _mm_add_epi64(sum64, _mm_unpacklo_epi32(prod0, sign0));
+    sum64 = _mm_add_epi64(sum64, _mm_unpackhi_epi32(prod0, sign0));
+    sum64 = _mm_add_epi64(sum64, _mm_unpacklo_epi32(prod1, sign1));
+    sum64 = _mm_add_epi64(sum64, _mm_unpackhi_epi32(prod1, sign1));
+    vector1 += 8;
+    vector2 += 8;
+  }
+
+  // Calculate the rest of the samples.
+  for (i = len2; i > 0; i -= 1) {
+    sum_res += WEBRTC_SPL_MUL_16_16(*vector1, *vector2);
+    vector1++;
+    vector2++;
+  }
+
+  _mm_storeu_si128((__m128i*)sum64_halves, sum64);
+  *cross_correlation =
+      (int32_t)((sum64_halves[0] + sum64_halves[1] + sum_res) >> scaling);
+}
+
+/* SSE2 version of WebRtcSpl_CrossCorrelation() for x86 platforms. */
+void WebRtcSpl_CrossCorrelationSse2(int32_t* cross_correlation,
+                                    const int16_t* seq1,
+                                    const int16_t* seq2,
+                                    size_t dim_seq,
+                                    size_t dim_cross_correlation,
+                                    int right_shifts,
+                                    int step_seq2) {
+  size_t i = 0;
+
+  for (i = 0; i < dim_cross_correlation; i++) {
+    const int16_t* seq1_ptr = seq1;
+    const int16_t* seq2_ptr = seq2 + (step_seq2 * i);
+
+    DotProductWithScaleSse2(cross_correlation,
+                            seq1_ptr,
+                            seq2_ptr,
+                            dim_seq,
+                            right_shifts);
+    cross_correlation++;
+  }
+}
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+
+#include <emmintrin.h>
+
+// SSE2 intrinsics version of WebRtcSpl_DownsampleFast() for x86 platforms.
+int WebRtcSpl_DownsampleFastSse2(const int16_t* data_in,
+                                 size_t data_in_length,
+                                 int16_t* data_out,
+                                 size_t data_out_length,
+                                 const int16_t* __restrict coefficients,
+                                 size_t coefficients_length,
+                                 int factor,
+                                 size_t delay) {
+  size_t i = 0;
+  size_t j = 0;
+  int32_t out_s32 = 0;
+  size_t endpos = delay + factor * (data_out_length - 1) + 1;
+  size_t res = data_out_length & 0x7;
+  size_t endpos1 = endpos - factor * res;
+
+  // Return error if any of the running conditions doesn't meet.
+  if (data_out_length == 0 || coefficients_length == 0
+                           || data_in_length < endpos) {
+    return -1;
+  }
+
+  // First part, compute eight output samples per iteration. Each filter tap
+  // is broadcast, while the eight strided input samples are gathered with
+  // scalar loads; |factor| is variable, so there is no contiguous load
+  // pattern to exploit.
+  for (i = delay; i < endpos1; i += factor * 8) {
+    // Round value, 0.5 in Q12.
+    __m128i out32x4_0 = _mm_set1_epi32(2048);
+    __m128i out32x4_1 = _mm_set1_epi32(2048);
+
+    for (j = 0; j < coefficients_length; j++) {
+      const __m128i coeff = _mm_set1_epi16(coefficients[j]);
+      const __m128i in = _mm_set_epi16(data_in[i + factor * 7 - j],
+                                       data_in[i + factor * 6 - j],
+                                       data_in[i + factor * 5 - j],
+                                       data_in[i + factor * 4 - j],
+                                       data_in[i + factor * 3 - j],
+                                       data_in[i + factor * 2 - j],
+                                       data_in[i + factor - j],
+                                       data_in[i - j]);
+
+      // Mul and accumulate in the 32-bit domain.
+      const __m128i mul_lo = _mm_mullo_epi16(coeff, in);
+      const __m128i mul_hi = _mm_mulhi_epi16(coeff, in);
+      out32x4_0 = _mm_add_epi32(out32x4_0, _mm_unpacklo_epi16(mul_lo, mul_hi));
+      out32x4_1 = _mm_add_epi32(out32x4_1, _mm_unpackhi_epi16(mul_lo, mul_hi));
+    }
+
+    // Shift down to Q0, saturate, and store the output.
+    out32x4_0 = _mm_srai_epi32(out32x4_0, 12);
+    out32x4_1 = _mm_srai_epi32(out32x4_1, 12);
+    _mm_storeu_si128((__m128i*)data_out, _mm_packs_epi32(out32x4_0, out32x4_1));
+    data_out += 8;
+  }
+
+  // Second part, do the rest iterations (if any).
+  for (; i < endpos; i += factor) {
+    out_s32 = 2048;  // Round value, 0.5 in Q12.
+
+    for (j = 0; j < coefficients_length; j++) {
+      out_s32 = WebRtc_MulAccumW16(coefficients[j], data_in[i - j], out_s32);
+    }
+
+    // Saturate and store the output.
+    out_s32 >>= 12;
+    *data_out++ = WebRtcSpl_SatW32ToW16(out_s32);
+  }
+
+  return 0;
+}
@@ -0,0 +1,256 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+/*
+ * This file contains the SSE2 implementation of functions
+ * WebRtcSpl_MaxAbsValueW16Sse2()
+ * WebRtcSpl_MaxAbsValueW32Sse2()
+ * WebRtcSpl_MaxValueW16Sse2()
+ * WebRtcSpl_MaxValueW32Sse2()
+ * WebRtcSpl_MinValueW16Sse2()
+ * WebRtcSpl_MinValueW32Sse2()
+ *
+ * All functions are bit-exact with their C counterparts in
+ * min_max_operations.c.
+ */
+
+#include <emmintrin.h>
+#include <stdlib.h>
+
+#include "rtc_base/checks.h"
+#include "common_audio/signal_processing/include/signal_processing_library.h"
+
+// Selects, lane by lane, |a| where |mask| is all ones and |b| where it is
+// all zeros. SSE2 has no blend instruction, so emulate it with logic ops.
+static __m128i Select(__m128i mask, __m128i a, __m128i b) {
+  return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// Maximum absolute value of word16 vector. SSE2 version for x86 platforms.
+int16_t WebRtcSpl_MaxAbsValueW16Sse2(const int16_t* vector, size_t length) {
+  int maximum = 0;
+  size_t i = 0;
+  const size_t residual = length & 7;
+
+  RTC_DCHECK_GT(length, 0);
+
+  const __m128i zero = _mm_setzero_si128();
+  __m128i max_qv = zero;
+
+  for (i = 0; i + 8 <= length; i += 8) {
+    const __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+    // Saturated negation maps -32768 to 32767, which matches the final
+    // clamp of the C version, so no unsigned trickery is needed.
+    const __m128i abs_v = _mm_max_epi16(v, _mm_subs_epi16(zero, v));
+    max_qv = _mm_max_epi16(max_qv, abs_v);
+  }
+
+  // Horizontal maximum of the eight lanes.
+  max_qv = _mm_max_epi16(max_qv, _mm_srli_si128(max_qv, 8));
+  max_qv = _mm_max_epi16(max_qv, _mm_srli_si128(max_qv, 4));
+  max_qv = _mm_max_epi16(max_qv, _mm_srli_si128(max_qv, 2));
+  maximum = (int16_t)_mm_cvtsi128_si32(max_qv);
+
+  // Residual samples.
+  for (i = length - residual; i < length; i++) {
+    const int absolute = abs((int)vector[i]);
+    if (absolute > maximum) {
+      maximum = absolute;
+    }
+  }
+
+  // Guard the case for abs(-32768) from the scalar tail.
+  if (maximum > WEBRTC_SPL_WORD16_MAX) {
+    maximum = WEBRTC_SPL_WORD16_MAX;
+  }
+
+  return (int16_t)maximum;
+}
+
+// Maximum absolute value of word32 vector. SSE2 version for x86 platforms.
+int32_t WebRtcSpl_MaxAbsValueW32Sse2(const int32_t* vector, size_t length) {
+  // Track the signed minimum and maximum in vector registers and form the
+  // absolute value at the end; SSE2 lacks both a 32-bit absolute value and
+  // a 32-bit maximum instruction. Use uint32_t locals to accommodate
+  // abs(0x80000000), as in the C version.
+  uint32_t absolute = 0, maximum = 0;
+  size_t i = 0;
+  const size_t residual = length & 3;
+
+  RTC_DCHECK_GT(length, 0);
+
+  __m128i max_qv = _mm_set1_epi32(WEBRTC_SPL_WORD32_MIN);
+  __m128i min_qv = _mm_set1_epi32(WEBRTC_SPL_WORD32_MAX);
+
+  for (i = 0; i + 4 <= length; i += 4) {
+    const __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+    max_qv = Select(_mm_cmpgt_epi32(v, max_qv), v, max_qv);
+    min_qv = Select(_mm_cmpgt_epi32(min_qv, v), v, min_qv);
+  }
+
+  {
+    int32_t max_lanes[4];
+    int32_t min_lanes[4];
+    int j;
+    _mm_storeu_si128((__m128i*)max_lanes, max_qv);
+    _mm_storeu_si128((__m128i*)min_lanes, min_qv);
+    for (j = 0; j < 4; j++) {
+      if (max_lanes[j] > 0 && (uint32_t)max_lanes[j] > maximum) {
+        maximum = (uint32_t)max_lanes[j];
+      }
+      if (min_lanes[j] < 0) {
+        absolute = (uint32_t)0 - (uint32_t)min_lanes[j];
+        if (absolute > maximum) {
+          maximum = absolute;
+        }
+      }
+    }
+  }
+
+  // Residual samples.
+  for (i = length - residual; i < length; i++) {
+    absolute = abs((int)vector[i]);
+    if (absolute > maximum) {
+      maximum = absolute;
+    }
+  }
+
+  maximum = WEBRTC_SPL_MIN(maximum, WEBRTC_SPL_WORD32_MAX);
+
+  return (int32_t)maximum;
+}
+
+// Maximum value of word16 vector. SSE2 version for x86 platforms.
+int16_t WebRtcSpl_MaxValueW16Sse2(const int16_t* vector, size_t length) {
+  int16_t maximum = WEBRTC_SPL_WORD16_MIN;
+  size_t i = 0;
+  const size_t residual = length & 7;
+
+  RTC_DCHECK_GT(length, 0);
+
+  __m128i max_qv = _mm_set1_epi16(WEBRTC_SPL_WORD16_MIN);
+
+  for (i = 0; i + 8 <= length; i += 8) {
+    const __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+    max_qv = _mm_max_epi16(max_qv, v);
+  }
+
+  // Horizontal maximum of the eight lanes.
+  max_qv = _mm_max_epi16(max_qv, _mm_srli_si128(max_qv, 8));
+  max_qv = _mm_max_epi16(max_qv, _mm_srli_si128(max_qv, 4));
+  max_qv = _mm_max_epi16(max_qv, _mm_srli_si128(max_qv, 2));
+  maximum = (int16_t)_mm_cvtsi128_si32(max_qv);
+
+  // Residual samples.
+  for (i = length - residual; i < length; i++) {
+    if (vector[i] > maximum)
+      maximum = vector[i];
+  }
+
+  return maximum;
+}
+
+// Maximum value of word32 vector. SSE2 version for x86 platforms.
+int32_t WebRtcSpl_MaxValueW32Sse2(const int32_t* vector, size_t length) {
+  int32_t maximum = WEBRTC_SPL_WORD32_MIN;
+  size_t i = 0;
+  const size_t residual = length & 3;
+
+  RTC_DCHECK_GT(length, 0);
+
+  __m128i max_qv = _mm_set1_epi32(WEBRTC_SPL_WORD32_MIN);
+
+  for (i = 0; i + 4 <= length; i += 4) {
+    const __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+    max_qv = Select(_mm_cmpgt_epi32(v, max_qv), v, max_qv);
+  }
+
+  {
+    int32_t lanes[4];
+    int j;
+    _mm_storeu_si128((__m128i*)lanes, max_qv);
+    for (j = 0; j < 4; j++) {
+      if (lanes[j] > maximum)
+        maximum = lanes[j];
+    }
+  }
+
+  // Residual samples.
+  for (i = length - residual; i < length; i++) {
+    if (vector[i] > maximum)
+      maximum = vector[i];
+  }
+
+  return maximum;
+}
+
+// Minimum value of word16 vector. SSE2 version for x86 platforms.
+int16_t WebRtcSpl_MinValueW16Sse2(const int16_t* vector, size_t length) {
+  int16_t minimum = WEBRTC_SPL_WORD16_MAX;
+  size_t i = 0;
+  const size_t residual = length & 7;
+
+  RTC_DCHECK_GT(length, 0);
+
+  __m128i min_qv = _mm_set1_epi16(WEBRTC_SPL_WORD16_MAX);
+
+  for (i = 0; i + 8 <= length; i += 8) {
+    const __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+    min_qv = _mm_min_epi16(min_qv, v);
+  }
+
+  // Horizontal minimum of the eight lanes.
+  min_qv = _mm_min_epi16(min_qv, _mm_srli_si128(min_qv, 8));
+  min_qv = _mm_min_epi16(min_qv, _mm_srli_si128(min_qv, 4));
+  min_qv = _mm_min_epi16(min_qv, _mm_srli_si128(min_qv, 2));
+  minimum = (int16_t)_mm_cvtsi128_si32(min_qv);
+
+  // Residual samples.
+  for (i = length - residual; i < length; i++) {
+    if (vector[i] < minimum)
+      minimum = vector[i];
+  }
+
+  return minimum;
+}
+
+// Minimum value of word32 vector. SSE2 version for x86 platforms.
+int32_t WebRtcSpl_MinValueW32Sse2(const int32_t* vector, size_t length) {
+  int32_t minimum = WEBRTC_SPL_WORD32_MAX;
+  size_t i = 0;
+  const size_t residual = length & 3;
+
+  RTC_DCHECK_GT(length, 0);
+
+  __m128i min_qv = _mm_set1_epi32(WEBRTC_SPL_WORD32_MAX);
+
+  for (i = 0; i + 4 <= length; i += 4) {
+    const __m128i v = _mm_loadu_si128((const __m128i*)&vector[i]);
+    min_qv = Select(_mm_cmpgt_epi32(min_qv, v), v, min_qv);
+  }
+
+  {
+    int32_t lanes[4];
+    int j;
+    _mm_storeu_si128((__m128i*)lanes, min_qv);
+    for (j = 0; j < 4; j++) {
+      if (lanes[j] < minimum)
+        minimum = lanes[j];
+    }
+  }
+
+  // Residual samples.
+  for (i = length - residual; i < length; i++) {
+    if (vector[i] < minimum)
+      minimum = vector[i];
+  }
+
+  return minimum;
+}
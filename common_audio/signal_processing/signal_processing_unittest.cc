@@ -12,6 +12,8 @@
 
 #include "common_audio/signal_processing/include/signal_processing_library.h"
 #include "rtc_base/strings/string_builder.h"
+#include "rtc_base/system/arch.h"
+#include "rtc_base/time_utils.h"
 #include "test/gtest.h"
 
 static const size_t kVector16Size = 9;
@@ -334,6 +336,87 @@ TEST(SplTest, MinMaxOperationsTest) {
   EXPECT_EQ(6u, WebRtcSpl_MinIndexW32(vector32, kVectorSize));
 }
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// Verifies that the SSE2 min/max kernels match the C reference for lengths
+// around the vector width, so both the unrolled loops and the scalar tails
+// are exercised.
+TEST(SplTest, MinMaxOperationsSse2MatchesC) {
+  const size_t kMaxLength = 33;
+  int16_t v16[kMaxLength];
+  int32_t v32[kMaxLength];
+  uint32_t state = 1;
+
+  for (size_t length = 1; length <= kMaxLength; ++length) {
+    for (size_t i = 0; i < length; ++i) {
+      // Simple LCG; deterministic across platforms.
+      state = state * 1664525 + 1013904223;
+      v16[i] = static_cast<int16_t>(state >> 16);
+      state = state * 1664525 + 1013904223;
+      v32[i] = static_cast<int32_t>(state);
+    }
+    // Place extreme values where they land in both vector and tail code.
+    v16[length / 2] = WEBRTC_SPL_WORD16_MIN;
+    v16[length - 1] = WEBRTC_SPL_WORD16_MAX;
+    v32[length / 2] = WEBRTC_SPL_WORD32_MAX;
+
+    EXPECT_EQ(WebRtcSpl_MaxAbsValueW16C(v16, length),
+              WebRtcSpl_MaxAbsValueW16Sse2(v16, length));
+    EXPECT_EQ(WebRtcSpl_MaxValueW16C(v16, length),
+              WebRtcSpl_MaxValueW16Sse2(v16, length));
+    EXPECT_EQ(WebRtcSpl_MinValueW16C(v16, length),
+              WebRtcSpl_MinValueW16Sse2(v16, length));
+    EXPECT_EQ(WebRtcSpl_MaxAbsValueW32C(v32, length),
+              WebRtcSpl_MaxAbsValueW32Sse2(v32, length));
+    EXPECT_EQ(WebRtcSpl_MaxValueW32C(v32, length),
+              WebRtcSpl_MaxValueW32Sse2(v32, length));
+    EXPECT_EQ(WebRtcSpl_MinValueW32C(v32, length),
+              WebRtcSpl_MinValueW32Sse2(v32, length));
+  }
+
+  // A WORD32_MIN input saturates to WORD32_MAX, like the NEON version.
+  for (size_t i = 0; i < kMaxLength; ++i) {
+    v32[i] = WEBRTC_SPL_WORD32_MIN;
+  }
+  EXPECT_EQ(WEBRTC_SPL_WORD32_MAX,
+            WebRtcSpl_MaxAbsValueW32Sse2(v32, kMaxLength));
+}
+
+// Benchmark for the min/max kernels. Make sure to build with optimizations
+// so that RTC_DCHECKs are compiled out when benchmarking.
+TEST(SplTest, DISABLED_MinMaxOperationsBenchmark) {
+  const size_t kLength = 480;  // One 10 ms block at 48 kHz.
+  const int kIterations = 1000000;
+  int16_t v16[kLength];
+  uint32_t state = 1;
+  int16_t sink = 0;
+
+  for (size_t i = 0; i < kLength; ++i) {
+    state = state * 1664525 + 1013904223;
+    v16[i] = static_cast<int16_t>(state >> 16);
+  }
+
+  int64_t start = rtc::TimeNanos();
+  for (int i = 0; i < kIterations; ++i) {
+    sink ^= WebRtcSpl_MaxAbsValueW16C(v16, kLength);
+  }
+  double total_time_c_us =
+      (rtc::TimeNanos() - start) / rtc::kNumNanosecsPerMicrosec;
+  printf("MaxAbsValueW16C took %.2fms.\n", total_time_c_us / 1000);
+
+  start = rtc::TimeNanos();
+  for (int i = 0; i < kIterations; ++i) {
+    sink ^= WebRtcSpl_MaxAbsValueW16Sse2(v16, kLength);
+  }
+  double total_time_sse2_us =
+      (rtc::TimeNanos() - start) / rtc::kNumNanosecsPerMicrosec;
+  printf("MaxAbsValueW16Sse2 took %.2fms; which is %.2fx faster.\n",
+         total_time_sse2_us / 1000, total_time_c_us / total_time_sse2_us);
+
+  // Keep the results alive so the loops are not optimized away.
+  EXPECT_NE(-1, sink);
+}
+#endif
+
 TEST(SplTest, VectorOperationsTest) {
   const size_t kVectorSize = 4;
   int B[] = {4, 12, 133, 1100};
@@ -486,16 +569,16 @@ TEST(SplTest, CrossCorrelationTest) {
   WebRtcSpl_CrossCorrelation(vector32, vector16, kVector16, kSeqDimension,
                              kCrossCorrelationDimension, kShift, kStep);
 
-  // WebRtcSpl_CrossCorrelationC() and WebRtcSpl_CrossCorrelationNeon()
-  // are not bit-exact.
+  // WebRtcSpl_CrossCorrelationC() is not bit-exact with the Neon and SSE2
+  // versions, which accumulate in 64 bits and shift once at the end.
   const int32_t kExpected[kCrossCorrelationDimension] = {-266947903, -15579555,
                                                          -171282001};
   const int32_t* expected = kExpected;
 #if !defined(MIPS32_LE)
-  const int32_t kExpectedNeon[kCrossCorrelationDimension] = {
+  const int32_t kExpectedSimd[kCrossCorrelationDimension] = {
       -266947901, -15579553, -171281999};
   if (WebRtcSpl_CrossCorrelation != WebRtcSpl_CrossCorrelationC) {
-    expected = kExpectedNeon;
+    expected = kExpectedSimd;
   }
 #endif
   for (size_t i = 0; i < kCrossCorrelationDimension; ++i) {
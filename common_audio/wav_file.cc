@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdio>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -181,18 +182,21 @@ void WavReader::Close() {
 WavWriter::WavWriter(const std::string& filename,
                      int sample_rate,
                      size_t num_channels,
-                     SampleFormat sample_format)
+                     SampleFormat sample_format,
+                     bool async_write)
     // Unlike plain fopen, OpenWriteOnly takes care of filename utf8 ->
     // wchar conversion on windows.
     : WavWriter(FileWrapper::OpenWriteOnly(filename),
                 sample_rate,
                 num_channels,
-                sample_format) {}
+                sample_format,
+                async_write) {}
 
 WavWriter::WavWriter(FileWrapper file,
                      int sample_rate,
                      size_t num_channels,
-                     SampleFormat sample_format)
+                     SampleFormat sample_format,
+                     bool async_write)
     : sample_rate_(sample_rate),
       num_channels_(num_channels),
       num_samples_written_(0),
@@ -206,10 +210,19 @@ WavWriter::WavWriter(FileWrapper file,
   RTC_CHECK(CheckWavParameters(num_channels_, sample_rate_, format_,
                                num_samples_written_));
 
+  if (async_write) {
+    async_writer_ = std::make_unique<AsyncFileWriter>(std::move(file_));
+  }
+
   // Write a blank placeholder header, since we need to know the total number
   // of samples before we can fill in the real data.
   static const uint8_t blank_header[MaxWavHeaderSize()] = {0};
-  RTC_CHECK(file_.Write(blank_header, WavHeaderSize(format_)));
+  RTC_CHECK(WriteToFile(blank_header, WavHeaderSize(format_)));
+}
+
+bool WavWriter::WriteToFile(const void* data, size_t length) {
+  return async_writer_ ? async_writer_->Write(data, length)
+                       : file_.Write(data, length);
 }
 
 void WavWriter::WriteSamples(const int16_t* samples, size_t num_samples) {
@@ -224,7 +237,7 @@ void WavWriter::WriteSamples(const int16_t* samples, size_t num_samples) {
 
     if (format_ == WavFormat::kWavFormatPcm) {
       RTC_CHECK(
-          file_.Write(&samples[i], num_samples_to_write * sizeof(samples[0])));
+          WriteToFile(&samples[i], num_samples_to_write * sizeof(samples[0])));
     } else {
       RTC_CHECK_EQ(format_, WavFormat::kWavFormatIeeeFloat);
       std::array<float, kMaxChunksize> converted_samples;
@@ -232,7 +245,7 @@ void WavWriter::WriteSamples(const int16_t* samples, size_t num_samples) {
         converted_samples[j] = S16ToFloat(samples[i + j]);
       }
       RTC_CHECK(
-          file_.Write(converted_samples.data(),
+          WriteToFile(converted_samples.data(),
                       num_samples_to_write * sizeof(converted_samples[0])));
     }
 
@@ -258,7 +271,7 @@ void WavWriter::WriteSamples(const float* samples, size_t num_samples) {
         converted_samples[j] = FloatS16ToS16(samples[i + j]);
       }
       RTC_CHECK(
-          file_.Write(converted_samples.data(),
+          WriteToFile(converted_samples.data(),
                       num_samples_to_write * sizeof(converted_samples[0])));
     } else {
       RTC_CHECK_EQ(format_, WavFormat::kWavFormatIeeeFloat);
@@ -267,7 +280,7 @@ void WavWriter::WriteSamples(const float* samples, size_t num_samples) {
         converted_samples[j] = FloatS16ToFloat(samples[i + j]);
       }
       RTC_CHECK(
-          file_.Write(converted_samples.data(),
+          WriteToFile(converted_samples.data(),
                       num_samples_to_write * sizeof(converted_samples[0])));
     }
 
@@ -278,6 +291,11 @@ void WavWriter::WriteSamples(const float* samples, size_t num_samples) {
 }
 
 void WavWriter::Close() {
+  if (async_writer_) {
+    // Take the file back to patch the header below.
+    file_ = async_writer_->FinishAndRelease();
+    async_writer_ = nullptr;
+  }
   RTC_CHECK(file_.Rewind());
   std::array<uint8_t, MaxWavHeaderSize()> header;
   size_t header_size;
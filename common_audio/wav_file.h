@@ -14,9 +14,11 @@
 #include <stdint.h>
 
 #include <cstddef>
+#include <memory>
 #include <string>
 
 #include "common_audio/wav_header.h"
+#include "rtc_base/system/async_file_writer.h"
 #include "rtc_base/system/file_wrapper.h"
 
 namespace webrtc {
@@ -38,15 +40,20 @@ class WavFile {
 // for anything but debug code.
 class WavWriter final : public WavFile {
  public:
-  // Opens a new WAV file for writing.
+  // Opens a new WAV file for writing. With |async_write| set, samples are
+  // buffered and written to disk from a low priority background thread, so
+  // that disk stalls do not block the thread calling WriteSamples. Intended
+  // for debug recordings produced by real-time threads.
   WavWriter(const std::string& filename,
             int sample_rate,
             size_t num_channels,
-            SampleFormat sample_format = SampleFormat::kInt16);
+            SampleFormat sample_format = SampleFormat::kInt16,
+            bool async_write = false);
   WavWriter(FileWrapper file,
             int sample_rate,
             size_t num_channels,
-            SampleFormat sample_format = SampleFormat::kInt16);
+            SampleFormat sample_format = SampleFormat::kInt16,
+            bool async_write = false);
 
   // Closes the WAV file, after writing its header.
   ~WavWriter() { Close(); }
@@ -66,11 +73,15 @@ class WavWriter final : public WavFile {
 
  private:
   void Close();
+  bool WriteToFile(const void* data, size_t length);
   const int sample_rate_;
   const size_t num_channels_;
   size_t num_samples_written_;
   WavFormat format_;
   FileWrapper file_;
+  // Non-null when writing asynchronously; owns the file until Close, when
+  // the file is taken back to patch the header.
+  std::unique_ptr<AsyncFileWriter> async_writer_;
 };
 
 // Follows the conventions of WavWriter.
@@ -15,6 +15,7 @@
 
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #include "common_audio/wav_header.h"
 #include "test/gtest.h"
@@ -101,6 +102,36 @@ TEST(WavWriterTest, MAYBE_CPP) {
   }
 }
 
+// Write a WAV file with asynchronous buffered writing and verify that the
+// result is identical to what the synchronous path produces.
+TEST(WavWriterTest, AsyncWrite) {
+  const std::string outfile = test::OutputPath() + "wavtest_async.wav";
+  constexpr int kSampleRate = 16000;
+  constexpr size_t kNumSamples = 2 * kSampleRate;
+  {
+    WavWriter w(outfile, kSampleRate, 1, WavFile::SampleFormat::kInt16,
+                /*async_write=*/true);
+    std::vector<int16_t> samples(kNumSamples);
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      samples[i] = static_cast<int16_t>(i);
+    }
+    w.WriteSamples(samples.data(), kNumSamples);
+    EXPECT_EQ(kNumSamples, w.num_samples());
+  }
+  {
+    WavReader r(outfile);
+    EXPECT_EQ(kSampleRate, r.sample_rate());
+    EXPECT_EQ(1u, r.num_channels());
+    EXPECT_EQ(kNumSamples, r.num_samples());
+    std::vector<int16_t> samples(kNumSamples);
+    EXPECT_EQ(kNumSamples, r.ReadSamples(kNumSamples, samples.data()));
+    for (size_t i = 0; i < kNumSamples; ++i) {
+      ASSERT_EQ(static_cast<int16_t>(i), samples[i]);
+    }
+  }
+  remove(outfile.c_str());
+}
+
 // Write a larger WAV file. You can listen to this file to sanity-check it.
 TEST(WavWriterTest, LargeFile) {
   constexpr int kSampleRate = 8000;
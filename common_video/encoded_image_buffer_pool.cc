@@ -0,0 +1,89 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/encoded_image_buffer_pool.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+namespace {
+// Matching the default of I420BufferPool; encoders normally keep at most a
+// frame or two in flight, so hitting this indicates leaked references.
+constexpr size_t kDefaultMaxNumberOfBuffers = 10;
+// Rolling window of requested sizes used for capacity recommendations. At
+// 30 fps this is ~3 seconds of frames, enough to contain a key frame of each
+// GOP without old resolutions lingering for long.
+constexpr size_t kSizeWindowLength = 100;
+// Capacity is sized for this percentile of the window; the few frames above
+// it (key frames) trigger a plain realloc as before.
+constexpr int kCapacityPercentile = 95;
+// A recycled buffer is shrunk when its capacity exceeds the recommendation
+// by more than this factor, so memory retires after downward size changes
+// but stable streams never bounce between sizes.
+constexpr size_t kShrinkThresholdFactor = 4;
+}  // namespace
+
+EncodedImageBufferPool::EncodedImageBufferPool()
+    : EncodedImageBufferPool(kDefaultMaxNumberOfBuffers) {}
+
+EncodedImageBufferPool::EncodedImageBufferPool(size_t max_number_of_buffers)
+    : max_number_of_buffers_(max_number_of_buffers) {}
+
+EncodedImageBufferPool::~EncodedImageBufferPool() = default;
+
+void EncodedImageBufferPool::Release() {
+  buffers_.clear();
+}
+
+size_t EncodedImageBufferPool::RecommendCapacity(size_t size) {
+  if (recent_sizes_.size() < kSizeWindowLength) {
+    recent_sizes_.push_back(size);
+  } else {
+    recent_sizes_[next_recent_size_index_] = size;
+    next_recent_size_index_ = (next_recent_size_index_ + 1) % kSizeWindowLength;
+  }
+  // Too few samples to call anything a percentile; allocate exactly.
+  if (recent_sizes_.size() < 10)
+    return size;
+  std::vector<size_t> sorted = recent_sizes_;
+  auto nth = sorted.begin() + (sorted.size() - 1) * kCapacityPercentile / 100;
+  std::nth_element(sorted.begin(), nth, sorted.end());
+  return std::max(size, *nth);
+}
+
+rtc::scoped_refptr<EncodedImageBuffer> EncodedImageBufferPool::GetBuffer(
+    size_t size) {
+  RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
+  const size_t capacity = RecommendCapacity(size);
+  // If a buffer in the list has one ref, that reference is ours and the
+  // downstream consumers are done with it, so it can be recycled.
+  for (const rtc::scoped_refptr<PooledBuffer>& buffer : buffers_) {
+    if (buffer->HasOneRef()) {
+      if (buffer->size() < size ||
+          buffer->size() > kShrinkThresholdFactor * capacity) {
+        buffer->Realloc(capacity);
+      }
+      return buffer;
+    }
+  }
+
+  if (buffers_.size() >= max_number_of_buffers_)
+    return nullptr;
+  // Allocate new buffer.
+  rtc::scoped_refptr<PooledBuffer> buffer = new PooledBuffer(capacity);
+  buffers_.push_back(buffer);
+  return buffer;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,87 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "common_video/include/encoded_image_buffer_pool.h"
+
+#include "test/gtest.h"
+
+namespace webrtc {
+
+TEST(TestEncodedImageBufferPool, SimpleBuffer) {
+  EncodedImageBufferPool pool;
+  rtc::scoped_refptr<EncodedImageBuffer> buffer = pool.GetBuffer(100);
+  ASSERT_TRUE(buffer);
+  EXPECT_GE(buffer->size(), 100u);
+}
+
+TEST(TestEncodedImageBufferPool, BufferReused) {
+  EncodedImageBufferPool pool;
+  rtc::scoped_refptr<EncodedImageBuffer> buffer = pool.GetBuffer(100);
+  const uint8_t* data = buffer->data();
+  // Release buffer so that it is returned to the pool.
+  buffer = nullptr;
+  buffer = pool.GetBuffer(50);
+  EXPECT_EQ(buffer->data(), data);
+}
+
+TEST(TestEncodedImageBufferPool, BufferGrownWhenTooSmall) {
+  EncodedImageBufferPool pool;
+  rtc::scoped_refptr<EncodedImageBuffer> buffer = pool.GetBuffer(100);
+  buffer = nullptr;
+  buffer = pool.GetBuffer(200);
+  ASSERT_TRUE(buffer);
+  EXPECT_GE(buffer->size(), 200u);
+}
+
+TEST(TestEncodedImageBufferPool, BufferNotReusedWhileReferenced) {
+  EncodedImageBufferPool pool;
+  rtc::scoped_refptr<EncodedImageBuffer> buffer = pool.GetBuffer(100);
+  rtc::scoped_refptr<EncodedImageBuffer> other = pool.GetBuffer(100);
+  ASSERT_TRUE(other);
+  EXPECT_NE(other->data(), buffer->data());
+}
+
+TEST(TestEncodedImageBufferPool, MaxNumberOfBuffers) {
+  EncodedImageBufferPool pool(1);
+  rtc::scoped_refptr<EncodedImageBuffer> buffer = pool.GetBuffer(100);
+  EXPECT_FALSE(pool.GetBuffer(100));
+}
+
+TEST(TestEncodedImageBufferPool, NewBuffersSizedForRecentFrameSizes) {
+  EncodedImageBufferPool pool;
+  // Seed the size window so the percentile capacity applies.
+  for (int i = 0; i < 20; ++i) {
+    rtc::scoped_refptr<EncodedImageBuffer> buffer = pool.GetBuffer(10000);
+  }
+  // Hold a reference so the next request allocates a fresh buffer; it should
+  // come with capacity for the typical recent frame, not just the 100 bytes.
+  rtc::scoped_refptr<EncodedImageBuffer> held = pool.GetBuffer(10000);
+  rtc::scoped_refptr<EncodedImageBuffer> fresh = pool.GetBuffer(100);
+  ASSERT_TRUE(fresh);
+  EXPECT_GE(fresh->size(), 10000u);
+}
+
+TEST(TestEncodedImageBufferPool, CapacityShrinksAfterSizesDrop) {
+  EncodedImageBufferPool pool;
+  rtc::scoped_refptr<EncodedImageBuffer> buffer = pool.GetBuffer(100000);
+  buffer = nullptr;
+  // Once the window is dominated by small frames, the oversized recycled
+  // buffer should be shrunk rather than kept at key-frame capacity.
+  for (int i = 0; i < 200; ++i) {
+    buffer = pool.GetBuffer(1000);
+    buffer = nullptr;
+  }
+  buffer = pool.GetBuffer(1000);
+  ASSERT_TRUE(buffer);
+  EXPECT_GE(buffer->size(), 1000u);
+  EXPECT_LT(buffer->size(), 100000u);
+}
+
+}  // namespace webrtc
@@ -12,47 +12,111 @@
 
 #include <cstdint>
 
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#elif defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace webrtc {
 namespace H264 {
 
+namespace {
+
+// Calls |on_start_code| with the index of the first byte of every three-byte
+// start sequence {0 0 1} whose payload starts before the last byte of the
+// buffer, in increasing order. A start sequence is identified by its third
+// byte: a 1 preceded by two 0s. On x86 and ARM the candidate 1-bytes are
+// located 16 at a time with vector compares; 1s are rare in encoded
+// bitstreams, so most chunks are rejected with a single branch.
+template <typename OnStartCode>
+void ForEachStartCode(const uint8_t* buffer,
+                      size_t buffer_size,
+                      OnStartCode on_start_code) {
+  static_assert(kNaluShortStartSequenceSize >= 2,
+                "kNaluShortStartSequenceSize must be larger or equals to 2");
+  // Index of the third byte of a candidate start sequence; the exclusive
+  // bound leaves room for at least one payload byte after the sequence.
+  const size_t end = buffer_size - 1;
+  size_t i = kNaluShortStartSequenceSize - 1;
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  const __m128i kOne = _mm_set1_epi8(1);
+  while (i + 16 <= end) {
+    const __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i));
+    int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, kOne));
+    for (int bit = 0; mask != 0; ++bit, mask >>= 1) {
+      if ((mask & 1) && buffer[i + bit - 1] == 0 && buffer[i + bit - 2] == 0)
+        on_start_code(i + bit - 2);
+    }
+    i += 16;
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  const uint8x16_t kOne = vdupq_n_u8(1);
+  while (i + 16 <= end) {
+    const uint8x16_t eq = vceqq_u8(vld1q_u8(buffer + i), kOne);
+    const uint8x8_t fold = vorr_u8(vget_low_u8(eq), vget_high_u8(eq));
+    if (vget_lane_u64(vreinterpret_u64_u8(fold), 0) != 0) {
+      for (int k = 0; k < 16; ++k) {
+        if (buffer[i + k] == 1 && buffer[i + k - 1] == 0 &&
+            buffer[i + k - 2] == 0)
+          on_start_code(i + k - 2);
+      }
+    }
+    i += 16;
+  }
+#endif
+
+  // Scalar scan of whatever the vector loop didn't cover. This is sorta like
+  // Boyer-Moore, but with only the first optimization step: given a 3-byte
+  // sequence we're looking at, if the 3rd byte isn't 1 or 0, skip ahead to
+  // the next 3-byte sequence. 0s and 1s are relatively rare, so this will
+  // skip the majority of reads/checks.
+  while (i < end) {
+    if (buffer[i] > 1) {
+      i += 3;
+    } else if (buffer[i] == 1) {
+      if (buffer[i - 1] == 0 && buffer[i - 2] == 0)
+        on_start_code(i - 2);
+      i += 3;
+    } else {
+      ++i;
+    }
+  }
+}
+
+// Turns the start sequence at |start| into a NaluIndex, extending it to a
+// four-byte sequence when preceded by yet another 0.
+NaluIndex MakeNaluIndex(const uint8_t* buffer, size_t start) {
+  NaluIndex index = {start, start + 3, 0};
+  if (index.start_offset > 0 && buffer[index.start_offset - 1] == 0)
+    --index.start_offset;
+  return index;
+}
+
+}  // namespace
+
 const uint8_t kNaluTypeMask = 0x1F;
 
 std::vector<NaluIndex> FindNaluIndices(const uint8_t* buffer,
                                        size_t buffer_size) {
-  // This is sorta like Boyer-Moore, but with only the first optimization step:
-  // given a 3-byte sequence we're looking at, if the 3rd byte isn't 1 or 0,
-  // skip ahead to the next 3-byte sequence. 0s and 1s are relatively rare, so
-  // this will skip the majority of reads/checks.
   std::vector<NaluIndex> sequences;
   if (buffer_size < kNaluShortStartSequenceSize)
     return sequences;
 
-  static_assert(kNaluShortStartSequenceSize >= 2,
-                "kNaluShortStartSequenceSize must be larger or equals to 2");
-  const size_t end = buffer_size - kNaluShortStartSequenceSize;
-  for (size_t i = 0; i < end;) {
-    if (buffer[i + 2] > 1) {
-      i += 3;
-    } else if (buffer[i + 2] == 1) {
-      if (buffer[i + 1] == 0 && buffer[i] == 0) {
-        // We found a start sequence, now check if it was a 3 of 4 byte one.
-        NaluIndex index = {i, i + 3, 0};
-        if (index.start_offset > 0 && buffer[index.start_offset - 1] == 0)
-          --index.start_offset;
-
-        // Update length of previous entry.
-        auto it = sequences.rbegin();
-        if (it != sequences.rend())
-          it->payload_size = index.start_offset - it->payload_start_offset;
-
-        sequences.push_back(index);
-      }
+  ForEachStartCode(buffer, buffer_size, [&](size_t start) {
+    NaluIndex index = MakeNaluIndex(buffer, start);
 
-      i += 3;
-    } else {
-      ++i;
-    }
-  }
+    // Update length of previous entry.
+    auto it = sequences.rbegin();
+    if (it != sequences.rend())
+      it->payload_size = index.start_offset - it->payload_start_offset;
+
+    sequences.push_back(index);
+  });
 
   // Update length of last entry, if any.
   auto it = sequences.rbegin();
@@ -62,6 +126,37 @@ std::vector<NaluIndex> FindNaluIndices(const uint8_t* buffer,
   return sequences;
 }
 
+size_t FindNaluIndices(const uint8_t* buffer,
+                       size_t buffer_size,
+                       rtc::ArrayView<NaluIndex> indices) {
+  if (buffer_size < kNaluShortStartSequenceSize || indices.empty())
+    return 0;
+
+  size_t count = 0;
+  ForEachStartCode(buffer, buffer_size, [&](size_t start) {
+    // Out of space; the last index absorbs the rest of the buffer.
+    if (count == indices.size())
+      return;
+    NaluIndex index = MakeNaluIndex(buffer, start);
+
+    // Update length of previous entry.
+    if (count > 0) {
+      indices[count - 1].payload_size =
+          index.start_offset - indices[count - 1].payload_start_offset;
+    }
+
+    indices[count++] = index;
+  });
+
+  // Update length of last entry, if any.
+  if (count > 0) {
+    indices[count - 1].payload_size =
+        buffer_size - indices[count - 1].payload_start_offset;
+  }
+
+  return count;
+}
+
 NaluType ParseNaluType(uint8_t data) {
   return static_cast<NaluType>(data & kNaluTypeMask);
 }
@@ -16,6 +16,7 @@
 
 #include <vector>
 
+#include "api/array_view.h"
 #include "rtc_base/buffer.h"
 
 namespace webrtc {
@@ -61,6 +62,15 @@ struct NaluIndex {
 std::vector<NaluIndex> FindNaluIndices(const uint8_t* buffer,
                                        size_t buffer_size);
 
+// Writes the NALU indices in the given buffer into the caller-provided
+// |indices| and returns how many were written, avoiding any heap allocation.
+// If the buffer contains more NALUs than |indices| has room for, the
+// remaining start codes are ignored, so the last returned index's payload
+// runs to the end of the buffer.
+size_t FindNaluIndices(const uint8_t* buffer,
+                       size_t buffer_size,
+                       rtc::ArrayView<NaluIndex> indices);
+
 // Get the NAL type from the header byte immediately following start sequence.
 NaluType ParseNaluType(uint8_t data);
 
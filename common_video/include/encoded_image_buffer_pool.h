@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef COMMON_VIDEO_INCLUDE_ENCODED_IMAGE_BUFFER_POOL_H_
+#define COMMON_VIDEO_INCLUDE_ENCODED_IMAGE_BUFFER_POOL_H_
+
+#include <stddef.h>
+
+#include <list>
+#include <vector>
+
+#include "api/scoped_refptr.h"
+#include "api/video/encoded_image.h"
+#include "rtc_base/race_checker.h"
+#include "rtc_base/ref_counted_object.h"
+
+namespace webrtc {
+
+// Simple buffer pool to avoid a fresh EncodedImageBuffer allocation for every
+// encoded frame. A buffer handed out by GetBuffer is returned to the pool once
+// all EncodedImage copies referencing it have been destroyed, which with the
+// synchronous OnEncodedImage delivery happens as soon as packetization is
+// done. Encoder wrappers that copy their bitstream into an EncodedImageBuffer
+// can therefore recycle a small set of buffers instead of hitting the
+// allocator once per frame.
+class EncodedImageBufferPool {
+ public:
+  EncodedImageBufferPool();
+  explicit EncodedImageBufferPool(size_t max_number_of_buffers);
+  ~EncodedImageBufferPool();
+
+  EncodedImageBufferPool(const EncodedImageBufferPool&) = delete;
+  EncodedImageBufferPool& operator=(const EncodedImageBufferPool&) = delete;
+
+  // Returns a buffer of at least |size| bytes from the pool, reallocating a
+  // recycled buffer if it is too small. If all pooled buffers are still
+  // referenced and there are less than |max_number_of_buffers| pending, a new
+  // buffer is created. Returns null otherwise.
+  //
+  // Buffers are allocated with capacity for a high percentile of the recently
+  // requested sizes, so the occasional large frame (typically a key frame)
+  // does not grow every pooled buffer, and capacity shrinks back when frame
+  // sizes drop, e.g. after a downward bitrate or resolution change.
+  rtc::scoped_refptr<EncodedImageBuffer> GetBuffer(size_t size);
+
+  // Clears buffers_ so the memory can be reclaimed, e.g. when the encoder is
+  // released.
+  void Release();
+
+ private:
+  // Explicitly use a RefCountedObject to get access to HasOneRef, needed by
+  // the pool to check exclusive access.
+  using PooledBuffer = rtc::RefCountedObject<EncodedImageBuffer>;
+
+  // Records |size| in the rolling window of requested sizes and returns the
+  // capacity buffers should be (re)allocated with: at least |size|, normally
+  // the high percentile of the window.
+  size_t RecommendCapacity(size_t size);
+
+  rtc::RaceChecker race_checker_;
+  std::list<rtc::scoped_refptr<PooledBuffer>> buffers_;
+  // Max number of buffers this pool can have pending.
+  const size_t max_number_of_buffers_;
+  // Rolling window of recently requested sizes, used by RecommendCapacity().
+  std::vector<size_t> recent_sizes_;
+  size_t next_recent_size_index_ = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // COMMON_VIDEO_INCLUDE_ENCODED_IMAGE_BUFFER_POOL_H_
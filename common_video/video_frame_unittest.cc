@@ -453,6 +453,39 @@ TEST_P(TestPlanarYuvBuffer, CropAndScale16x9) {
   CheckCrop(*scaled_buffer->ToI420(), 0.0, 0.125, 1.0, 0.75);
 }
 
+TEST(TestI420BufferParallelScale, ScaleFromParallelMatchesScaleFrom) {
+  rtc::scoped_refptr<PlanarYuvBuffer> buf =
+      CreateGradient(VideoFrameBuffer::Type::kI420, 1280, 720);
+
+  rtc::scoped_refptr<I420Buffer> serial = I420Buffer::Create(640, 360);
+  serial->ScaleFrom(*buf->GetI420());
+  rtc::scoped_refptr<I420Buffer> parallel = I420Buffer::Create(640, 360);
+  parallel->ScaleFromParallel(*buf->GetI420());
+  EXPECT_TRUE(test::FrameBufsEqual(serial, parallel));
+}
+
+TEST(TestI420BufferParallelScale, CropAndScaleFromParallelMatchesSerial) {
+  rtc::scoped_refptr<PlanarYuvBuffer> buf =
+      CreateGradient(VideoFrameBuffer::Type::kI420, 1920, 1080);
+
+  rtc::scoped_refptr<I420Buffer> serial = I420Buffer::Create(640, 360);
+  serial->CropAndScaleFrom(*buf->GetI420(), 320, 180, 1280, 720);
+  rtc::scoped_refptr<I420Buffer> parallel = I420Buffer::Create(640, 360);
+  parallel->CropAndScaleFromParallel(*buf->GetI420(), 320, 180, 1280, 720);
+  EXPECT_TRUE(test::FrameBufsEqual(serial, parallel));
+}
+
+TEST(TestI420BufferParallelScale, UpscaleFallsBackToSerialPath) {
+  rtc::scoped_refptr<PlanarYuvBuffer> buf =
+      CreateGradient(VideoFrameBuffer::Type::kI420, 320, 180);
+
+  rtc::scoped_refptr<I420Buffer> serial = I420Buffer::Create(640, 360);
+  serial->ScaleFrom(*buf->GetI420());
+  rtc::scoped_refptr<I420Buffer> parallel = I420Buffer::Create(640, 360);
+  parallel->ScaleFromParallel(*buf->GetI420());
+  EXPECT_TRUE(test::FrameBufsEqual(serial, parallel));
+}
+
 TEST_P(TestPlanarYuvBuffer, PastesIntoBuffer) {
   const int kOffsetx = 20;
   const int kOffsety = 30;
@@ -56,7 +56,11 @@ std::unique_ptr<RtcEventLogEncoder> CreateEncoder(
 
 RtcEventLogImpl::RtcEventLogImpl(RtcEventLog::EncodingType encoding_type,
                                  TaskQueueFactory* task_queue_factory)
-    : event_encoder_(CreateEncoder(encoding_type)),
+    : staging_ring_(kMaxEventsInHistory),
+      staging_head_(0),
+      staging_size_(0),
+      drain_task_posted_(false),
+      event_encoder_(CreateEncoder(encoding_type)),
       num_config_events_written_(0),
       last_output_ms_(rtc::TimeMillis()),
       output_scheduled_(false),
@@ -64,7 +68,9 @@ RtcEventLogImpl::RtcEventLogImpl(RtcEventLog::EncodingType encoding_type,
       task_queue_(
           std::make_unique<rtc::TaskQueue>(task_queue_factory->CreateTaskQueue(
               "rtc_event_log",
-              TaskQueueFactory::Priority::NORMAL))) {}
+              TaskQueueFactory::Priority::NORMAL))) {
+  drain_buffer_.reserve(staging_ring_.size());
+}
 
 RtcEventLogImpl::~RtcEventLogImpl() {
   // If we're logging to the output, this will stop that. Blocking function.
@@ -142,13 +148,51 @@ void RtcEventLogImpl::StopLogging(std::function<void()> callback) {
 void RtcEventLogImpl::Log(std::unique_ptr<RtcEvent> event) {
   RTC_CHECK(event);
 
+  // Stage the event in the preallocated ring instead of posting a task per
+  // event; at high packet rates the per-event closure allocations and queue
+  // wake-ups would otherwise dominate the cost of logging.
+  {
+    rtc::CritScope lock(&staging_lock_);
+    if (staging_size_ == staging_ring_.size()) {
+      // The drain task has not kept up. Sacrifice the oldest staged event,
+      // mirroring what LogToMemory() does when the history is full.
+      staging_ring_[staging_head_].reset();
+      staging_head_ = (staging_head_ + 1) % staging_ring_.size();
+      --staging_size_;
+    }
+    staging_ring_[(staging_head_ + staging_size_) % staging_ring_.size()] =
+        std::move(event);
+    ++staging_size_;
+    if (drain_task_posted_)
+      return;
+    drain_task_posted_ = true;
+  }
+
   // Binding to |this| is safe because |this| outlives the |task_queue_|.
-  task_queue_->PostTask([this, event = std::move(event)]() mutable {
+  task_queue_->PostTask([this]() {
     RTC_DCHECK_RUN_ON(task_queue_.get());
+    DrainStagedEvents();
+  });
+}
+
+void RtcEventLogImpl::DrainStagedEvents() {
+  RTC_DCHECK(drain_buffer_.empty());
+  {
+    rtc::CritScope lock(&staging_lock_);
+    for (size_t i = 0; i < staging_size_; ++i) {
+      drain_buffer_.push_back(std::move(
+          staging_ring_[(staging_head_ + i) % staging_ring_.size()]));
+    }
+    staging_head_ = 0;
+    staging_size_ = 0;
+    drain_task_posted_ = false;
+  }
+  for (auto& event : drain_buffer_) {
     LogToMemory(std::move(event));
     if (event_output_)
       ScheduleOutput();
-  });
+  }
+  drain_buffer_.clear();
 }
 
 void RtcEventLogImpl::ScheduleOutput() {
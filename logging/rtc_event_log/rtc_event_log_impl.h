@@ -16,6 +16,7 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/types/optional.h"
 #include "api/rtc_event_log/rtc_event.h"
@@ -23,6 +24,7 @@
 #include "api/rtc_event_log_output.h"
 #include "api/task_queue/task_queue_factory.h"
 #include "logging/rtc_event_log/encoder/rtc_event_log_encoder.h"
+#include "rtc_base/critical_section.h"
 #include "rtc_base/synchronization/sequence_checker.h"
 #include "rtc_base/task_queue.h"
 #include "rtc_base/thread_annotations.h"
@@ -48,6 +50,7 @@ class RtcEventLogImpl final : public RtcEventLog {
   void Log(std::unique_ptr<RtcEvent> event) override;
 
  private:
+  void DrainStagedEvents() RTC_RUN_ON(task_queue_);
   void LogToMemory(std::unique_ptr<RtcEvent> event) RTC_RUN_ON(task_queue_);
   void LogEventsFromMemoryToOutput() RTC_RUN_ON(task_queue_);
 
@@ -62,6 +65,21 @@ class RtcEventLogImpl final : public RtcEventLog {
 
   void ScheduleOutput() RTC_RUN_ON(task_queue_);
 
+  // Fixed-size staging ring that Log() writes into from any thread. Events
+  // are moved to the history on |task_queue_| in batches, with at most one
+  // drain task in flight, so the hot path does not allocate a task per event.
+  // If the drain task falls behind, the oldest staged events are overwritten.
+  rtc::CriticalSection staging_lock_;
+  std::vector<std::unique_ptr<RtcEvent>> staging_ring_
+      RTC_GUARDED_BY(staging_lock_);
+  size_t staging_head_ RTC_GUARDED_BY(staging_lock_);
+  size_t staging_size_ RTC_GUARDED_BY(staging_lock_);
+  bool drain_task_posted_ RTC_GUARDED_BY(staging_lock_);
+  // Preallocated scratch space used by the drain task, so that moving a
+  // batch out of the staging ring does not allocate either.
+  std::vector<std::unique_ptr<RtcEvent>> drain_buffer_
+      RTC_GUARDED_BY(*task_queue_);
+
   // History containing all past configuration events.
   std::deque<std::unique_ptr<RtcEvent>> config_history_
       RTC_GUARDED_BY(*task_queue_);
@@ -14,10 +14,12 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <istream>  // no-presubmit-check TODO(webrtc:8982)
 #include <limits>
 #include <map>
+#include <memory>
 #include <utility>
 
 #include "absl/memory/memory.h"
@@ -42,7 +44,9 @@
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "rtc_base/numerics/sequence_number_util.h"
+#include "rtc_base/platform_thread.h"
 #include "rtc_base/protobuf_utils.h"
+#include "system_wrappers/include/cpu_info.h"
 
 // These macros were added to convert existing code using RTC_CHECKs
 // to returning a Status object instead. Macros are necessary (over
@@ -751,6 +755,145 @@ ParsedRtcEventLog::ParseStatus StoreRtcpBlocks(
   return ParsedRtcEventLog::ParseStatus::Success();
 }
 
+// One length-delimited event batch sliced out of the encoded log, together
+// with the result of decoding it. The field tag and length prefix are kept,
+// so that |encoded| parses as a one-element EventStream, just like the
+// original inline parse did.
+struct EncodedBatch {
+  bool legacy = false;
+  std::string encoded;
+  bool decode_ok = false;
+  rtclog::EventStream legacy_stream;
+  rtclog2::EventStream stream;
+};
+
+struct BatchDecoderContext {
+  explicit BatchDecoderContext(std::vector<EncodedBatch>* batches)
+      : batches(batches) {}
+  std::vector<EncodedBatch>* const batches;
+  std::atomic<size_t> next_batch{0};
+};
+
+void RunBatchDecoderThread(void* obj) {
+  BatchDecoderContext* context = static_cast<BatchDecoderContext*>(obj);
+  while (true) {
+    const size_t i = context->next_batch.fetch_add(1);
+    if (i >= context->batches->size())
+      return;
+    EncodedBatch& batch = (*context->batches)[i];
+    if (batch.legacy) {
+      batch.decode_ok = batch.legacy_stream.ParseFromArray(
+          batch.encoded.data(), batch.encoded.size());
+    } else {
+      batch.decode_ok = batch.stream.ParseFromArray(batch.encoded.data(),
+                                                    batch.encoded.size());
+    }
+    std::string().swap(batch.encoded);
+  }
+}
+
+// Decodes the protobuf batches across a pool of worker threads. The batches
+// are self-contained at the protobuf level; only storing the decoded events
+// is order-dependent and stays sequential.
+void DecodeBatches(std::vector<EncodedBatch>* batches) {
+  BatchDecoderContext context(batches);
+  const size_t num_threads =
+      std::min<size_t>(CpuInfo::DetectNumberOfCores(), batches->size());
+  if (num_threads <= 1) {
+    RunBatchDecoderThread(&context);
+    return;
+  }
+  std::vector<std::unique_ptr<rtc::PlatformThread>> threads;
+  threads.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    threads.push_back(std::make_unique<rtc::PlatformThread>(
+        &RunBatchDecoderThread, &context, "EventLogDecoder"));
+    threads.back()->Start();
+  }
+  for (auto& thread : threads)
+    thread->Stop();
+}
+
+// Splits the log into length-delimited event batches without decoding them.
+// Returns success both when the whole stream was consumed and when
+// |allow_incomplete_logs| permits ignoring a truncated tail; in either case
+// the complete batches read so far are left in |batches|.
+ParsedRtcEventLog::ParseStatus SliceEventBatches(
+    std::istream& stream,  // no-presubmit-check TODO(webrtc:8982)
+    bool allow_incomplete_logs,
+    std::vector<EncodedBatch>* batches) {
+  constexpr uint64_t kMaxEventSize = 10000000;  // Sanity check.
+  std::vector<char> buffer(0xFFFF);
+
+  RTC_DCHECK(stream.good());
+  while (1) {
+    // Check whether we have reached end of file.
+    stream.peek();
+    if (stream.eof()) {
+      break;
+    }
+
+    // Read the next message tag. Protobuf defines the message tag as
+    // (field_number << 3) | wire_type. In the legacy encoding, the field number
+    // is supposed to be 1 and the wire type for a length-delimited field is 2.
+    // In the new encoding we still expect the wire type to be 2, but the field
+    // number will be greater than 1.
+    constexpr uint64_t kExpectedV1Tag = (1 << 3) | 2;
+    size_t bytes_written = 0;
+    ParsedRtcEventLog::ParseStatusOr<uint64_t> tag =
+        ParseVarInt(stream, buffer.data(), &bytes_written);
+    if (!tag.ok()) {
+      RTC_LOG(LS_WARNING)
+          << "Missing field tag from beginning of protobuf event.";
+      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs,
+                                           kIncompleteLogError);
+      return tag.status();
+    }
+    constexpr uint64_t kWireTypeMask = 0x07;
+    const uint64_t wire_type = tag.value() & kWireTypeMask;
+    if (wire_type != 2) {
+      RTC_LOG(LS_WARNING) << "Expected field tag with wire type 2 (length "
+                             "delimited message). Found wire type "
+                          << wire_type;
+      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs,
+                                           kIncompleteLogError);
+      RTC_PARSE_CHECK_OR_RETURN_EQ(wire_type, 2);
+    }
+
+    // Read the length field.
+    ParsedRtcEventLog::ParseStatusOr<uint64_t> message_length =
+        ParseVarInt(stream, buffer.data(), &bytes_written);
+    if (!message_length.ok()) {
+      RTC_LOG(LS_WARNING) << "Missing message length after protobuf field tag.";
+      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs,
+                                           kIncompleteLogError);
+      return message_length.status();
+    } else if (message_length.value() > kMaxEventSize) {
+      RTC_LOG(LS_WARNING) << "Protobuf message length is too large.";
+      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs,
+                                           kIncompleteLogError);
+      RTC_PARSE_CHECK_OR_RETURN_LE(message_length.value(), kMaxEventSize);
+    }
+
+    // Read the next protobuf event to a temporary char buffer.
+    if (buffer.size() < bytes_written + message_length.value())
+      buffer.resize(bytes_written + message_length.value());
+    stream.read(buffer.data() + bytes_written, message_length.value());
+    if (stream.gcount() != static_cast<int>(message_length.value())) {
+      RTC_LOG(LS_WARNING) << "Failed to read protobuf message.";
+      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs,
+                                           kIncompleteLogError);
+      RTC_PARSE_CHECK_OR_RETURN(false);
+    }
+    size_t buffer_size = bytes_written + message_length.value();
+
+    batches->emplace_back();
+    batches->back().legacy = tag.value() == kExpectedV1Tag;
+    batches->back().encoded.assign(buffer.data(), buffer_size);
+  }
+  return ParsedRtcEventLog::ParseStatus::Success();
+}
+
 }  // namespace
 
 // Conversion functions for version 2 of the wire format.
@@ -1246,75 +1389,21 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStream(
 
 ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
     std::istream& stream) {  // no-presubmit-check TODO(webrtc:8982)
-  constexpr uint64_t kMaxEventSize = 10000000;  // Sanity check.
-  std::vector<char> buffer(0xFFFF);
-
-  RTC_DCHECK(stream.good());
-  while (1) {
-    // Check whether we have reached end of file.
-    stream.peek();
-    if (stream.eof()) {
-      break;
-    }
-
-    // Read the next message tag. Protobuf defines the message tag as
-    // (field_number << 3) | wire_type. In the legacy encoding, the field number
-    // is supposed to be 1 and the wire type for a length-delimited field is 2.
-    // In the new encoding we still expect the wire type to be 2, but the field
-    // number will be greater than 1.
-    constexpr uint64_t kExpectedV1Tag = (1 << 3) | 2;
-    size_t bytes_written = 0;
-    ParsedRtcEventLog::ParseStatusOr<uint64_t> tag =
-        ParseVarInt(stream, buffer.data(), &bytes_written);
-    if (!tag.ok()) {
-      RTC_LOG(LS_WARNING)
-          << "Missing field tag from beginning of protobuf event.";
-      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
-                                           kIncompleteLogError);
-      return tag.status();
-    }
-    constexpr uint64_t kWireTypeMask = 0x07;
-    const uint64_t wire_type = tag.value() & kWireTypeMask;
-    if (wire_type != 2) {
-      RTC_LOG(LS_WARNING) << "Expected field tag with wire type 2 (length "
-                             "delimited message). Found wire type "
-                          << wire_type;
-      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
-                                           kIncompleteLogError);
-      RTC_PARSE_CHECK_OR_RETURN_EQ(wire_type, 2);
-    }
-
-    // Read the length field.
-    ParsedRtcEventLog::ParseStatusOr<uint64_t> message_length =
-        ParseVarInt(stream, buffer.data(), &bytes_written);
-    if (!message_length.ok()) {
-      RTC_LOG(LS_WARNING) << "Missing message length after protobuf field tag.";
-      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
-                                           kIncompleteLogError);
-      return message_length.status();
-    } else if (message_length.value() > kMaxEventSize) {
-      RTC_LOG(LS_WARNING) << "Protobuf message length is too large.";
-      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
-                                           kIncompleteLogError);
-      RTC_PARSE_CHECK_OR_RETURN_LE(message_length.value(), kMaxEventSize);
-    }
-
-    // Read the next protobuf event to a temporary char buffer.
-    if (buffer.size() < bytes_written + message_length.value())
-      buffer.resize(bytes_written + message_length.value());
-    stream.read(buffer.data() + bytes_written, message_length.value());
-    if (stream.gcount() != static_cast<int>(message_length.value())) {
-      RTC_LOG(LS_WARNING) << "Failed to read protobuf message.";
-      RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
-                                           kIncompleteLogError);
-      RTC_PARSE_CHECK_OR_RETURN(false);
-    }
-    size_t buffer_size = bytes_written + message_length.value();
-
-    if (tag.value() == kExpectedV1Tag) {
-      // Parse the protobuf event from the buffer.
-      rtclog::EventStream event_stream;
-      if (!event_stream.ParseFromArray(buffer.data(), buffer_size)) {
+  std::vector<EncodedBatch> batches;
+  ParseStatus slice_status =
+      SliceEventBatches(stream, allow_incomplete_logs_, &batches);
+  if (!slice_status.ok())
+    return slice_status;
+
+  // Decoding the protobuf batches is the bulk of the parse time, and each
+  // batch is self-contained, so it is fanned out over a thread pool. Storing
+  // the decoded events must remain sequential, since e.g. parsing RTP headers
+  // depends on the extension maps set up by earlier config events.
+  DecodeBatches(&batches);
+
+  for (EncodedBatch& batch : batches) {
+    if (batch.legacy) {
+      if (!batch.decode_ok) {
         RTC_LOG(LS_WARNING)
             << "Failed to parse legacy-format protobuf message.";
         RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
@@ -1322,20 +1411,20 @@ ParsedRtcEventLog::ParseStatus ParsedRtcEventLog::ParseStreamInternal(
         RTC_PARSE_CHECK_OR_RETURN(false);
       }
 
-      RTC_PARSE_CHECK_OR_RETURN_EQ(event_stream.stream_size(), 1);
-      auto status = StoreParsedLegacyEvent(event_stream.stream(0));
+      RTC_PARSE_CHECK_OR_RETURN_EQ(batch.legacy_stream.stream_size(), 1);
+      auto status = StoreParsedLegacyEvent(batch.legacy_stream.stream(0));
       RTC_RETURN_IF_ERROR(status);
+      batch.legacy_stream.Clear();
     } else {
-      // Parse the protobuf event from the buffer.
-      rtclog2::EventStream event_stream;
-      if (!event_stream.ParseFromArray(buffer.data(), buffer_size)) {
+      if (!batch.decode_ok) {
         RTC_LOG(LS_WARNING) << "Failed to parse new-format protobuf message.";
         RTC_PARSE_WARN_AND_RETURN_SUCCESS_IF(allow_incomplete_logs_,
                                              kIncompleteLogError);
         RTC_PARSE_CHECK_OR_RETURN(false);
       }
-      auto status = StoreParsedNewFormatEvent(event_stream);
+      auto status = StoreParsedNewFormatEvent(batch.stream);
       RTC_RETURN_IF_ERROR(status);
+      batch.stream.Clear();
     }
   }
   return ParseStatus::Success();
@@ -0,0 +1,41 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "absl/flags/parse.h"
+#include "absl/flags/usage.h"
+#include "api/rtc_event_log_output_mapped_ring.h"
+
+int main(int argc, char* argv[]) {
+  absl::SetProgramUsageMessage(
+      "Tool for snapshotting the ring file written by "
+      "RtcEventLogOutputMappedRing into an ordinary RtcEventLog file, "
+      "which the usual analysis tools can read.\n"
+      "Example usage:\n"
+      "./rtc_event_ring2rtclog ring_file output.rtclog\n");
+  std::vector<char*> args = absl::ParseCommandLine(argc, argv);
+  if (args.size() != 3) {
+    std::cout << absl::ProgramUsageMessage();
+    return 1;
+  }
+
+  const std::string ring_file = args[1];
+  const std::string output_file = args[2];
+
+  if (!webrtc::RtcEventLogOutputMappedRing::ExtractToFile(ring_file,
+                                                          output_file)) {
+    std::cerr << "Failed to extract event log from " << ring_file << std::endl;
+    return -1;
+  }
+  return 0;
+}
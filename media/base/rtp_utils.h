@@ -26,6 +26,16 @@ const size_t kMinRtpPacketLen = 12;
 const size_t kMaxRtpPacketLen = 2048;
 const size_t kMinRtcpPacketLen = 4;
 
+// Tail headroom that must be available past the payload so that libsrtp can
+// protect a packet in place: worst case HMAC auth tag, plus the 4 byte index
+// appended to SRTCP packets.
+const size_t kMaxSrtpHmacOverhead = 16;
+const size_t kSrtcpIndexLen = 4;
+
+// Header prepended to media sent over a bound TURN channel
+// (https://tools.ietf.org/html/rfc5766#section-11.4).
+const size_t kTurnChannelDataHeaderLen = 4;
+
 struct RtpHeader {
   int payload_type;
   int seq_num;
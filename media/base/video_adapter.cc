@@ -193,28 +193,15 @@ bool VideoAdapter::AdaptFrameResolution(int in_width,
   rtc::CritScope cs(&critical_section_);
   ++frames_in_;
 
-  // The max output pixel count is the minimum of the requests from
-  // OnOutputFormatRequest and OnResolutionFramerateRequest.
-  int max_pixel_count = resolution_request_max_pixel_count_;
-
-  // Select target aspect ratio and max pixel count depending on input frame
-  // orientation.
-  absl::optional<std::pair<int, int>> target_aspect_ratio;
-  if (in_width > in_height) {
-    target_aspect_ratio = target_landscape_aspect_ratio_;
-    if (max_landscape_pixel_count_)
-      max_pixel_count = std::min(max_pixel_count, *max_landscape_pixel_count_);
-  } else {
-    target_aspect_ratio = target_portrait_aspect_ratio_;
-    if (max_portrait_pixel_count_)
-      max_pixel_count = std::min(max_pixel_count, *max_portrait_pixel_count_);
+  // Reuse the adaptation decision from the previous frame unless the
+  // constraints or the input size have changed since it was computed.
+  if (!cached_adaptation_ || cached_adaptation_->in_width != in_width ||
+      cached_adaptation_->in_height != in_height) {
+    ComputeAdaptation(in_width, in_height);
   }
 
-  int target_pixel_count =
-      std::min(resolution_request_target_pixel_count_, max_pixel_count);
-
   // Drop the input frame if necessary.
-  if (max_pixel_count <= 0 || !KeepFrame(in_timestamp_ns)) {
+  if (cached_adaptation_->drop_all || !KeepFrame(in_timestamp_ns)) {
     // Show VAdapt log every 90 frames dropped. (3 seconds)
     if ((frames_in_ - frames_out_) % 90 == 0) {
       // TODO(fbarchard): Reduce to LS_VERBOSE when adapter info is not needed
@@ -233,40 +220,13 @@ bool VideoAdapter::AdaptFrameResolution(int in_width,
     return false;
   }
 
-  // Calculate how the input should be cropped.
-  if (!target_aspect_ratio || target_aspect_ratio->first <= 0 ||
-      target_aspect_ratio->second <= 0) {
-    *cropped_width = in_width;
-    *cropped_height = in_height;
-  } else {
-    const float requested_aspect =
-        target_aspect_ratio->first /
-        static_cast<float>(target_aspect_ratio->second);
-    *cropped_width =
-        std::min(in_width, static_cast<int>(in_height * requested_aspect));
-    *cropped_height =
-        std::min(in_height, static_cast<int>(in_width / requested_aspect));
-  }
-  const Fraction scale =
-      FindScale(*cropped_width, *cropped_height, target_pixel_count,
-                max_pixel_count, variable_start_scale_factor_);
-  // Adjust cropping slightly to get correctly aligned output size and a perfect
-  // scale factor.
-  *cropped_width = roundUp(*cropped_width,
-                           scale.denominator * resolution_alignment_, in_width);
-  *cropped_height = roundUp(
-      *cropped_height, scale.denominator * resolution_alignment_, in_height);
-  RTC_DCHECK_EQ(0, *cropped_width % scale.denominator);
-  RTC_DCHECK_EQ(0, *cropped_height % scale.denominator);
-
-  // Calculate final output size.
-  *out_width = *cropped_width / scale.denominator * scale.numerator;
-  *out_height = *cropped_height / scale.denominator * scale.numerator;
-  RTC_DCHECK_EQ(0, *out_width % resolution_alignment_);
-  RTC_DCHECK_EQ(0, *out_height % resolution_alignment_);
+  *cropped_width = cached_adaptation_->cropped_width;
+  *cropped_height = cached_adaptation_->cropped_height;
+  *out_width = cached_adaptation_->out_width;
+  *out_height = cached_adaptation_->out_height;
 
   ++frames_out_;
-  if (scale.numerator != scale.denominator)
+  if (cached_adaptation_->scaled)
     ++frames_scaled_;
 
   if (previous_width_ &&
@@ -276,8 +236,7 @@ bool VideoAdapter::AdaptFrameResolution(int in_width,
                      << " / out " << frames_out_ << " / in " << frames_in_
                      << " Changes: " << adaption_changes_
                      << " Input: " << in_width << "x" << in_height
-                     << " Scale: " << scale.numerator << "/"
-                     << scale.denominator << " Output: " << *out_width << "x"
+                     << " Output: " << *out_width << "x"
                      << *out_height << " fps: " << max_framerate_request_ << "/"
                      << max_fps_.value_or(-1)
                      << " alignment: " << resolution_alignment_;
@@ -289,6 +248,75 @@ bool VideoAdapter::AdaptFrameResolution(int in_width,
   return true;
 }
 
+void VideoAdapter::ComputeAdaptation(int in_width, int in_height) {
+  // The max output pixel count is the minimum of the requests from
+  // OnOutputFormatRequest and OnResolutionFramerateRequest.
+  int max_pixel_count = resolution_request_max_pixel_count_;
+
+  // Select target aspect ratio and max pixel count depending on input frame
+  // orientation.
+  absl::optional<std::pair<int, int>> target_aspect_ratio;
+  if (in_width > in_height) {
+    target_aspect_ratio = target_landscape_aspect_ratio_;
+    if (max_landscape_pixel_count_)
+      max_pixel_count = std::min(max_pixel_count, *max_landscape_pixel_count_);
+  } else {
+    target_aspect_ratio = target_portrait_aspect_ratio_;
+    if (max_portrait_pixel_count_)
+      max_pixel_count = std::min(max_pixel_count, *max_portrait_pixel_count_);
+  }
+
+  int target_pixel_count =
+      std::min(resolution_request_target_pixel_count_, max_pixel_count);
+
+  cached_adaptation_.emplace();
+  cached_adaptation_->in_width = in_width;
+  cached_adaptation_->in_height = in_height;
+  cached_adaptation_->drop_all = max_pixel_count <= 0;
+  if (cached_adaptation_->drop_all) {
+    return;
+  }
+
+  // Calculate how the input should be cropped.
+  int cropped_width;
+  int cropped_height;
+  if (!target_aspect_ratio || target_aspect_ratio->first <= 0 ||
+      target_aspect_ratio->second <= 0) {
+    cropped_width = in_width;
+    cropped_height = in_height;
+  } else {
+    const float requested_aspect =
+        target_aspect_ratio->first /
+        static_cast<float>(target_aspect_ratio->second);
+    cropped_width =
+        std::min(in_width, static_cast<int>(in_height * requested_aspect));
+    cropped_height =
+        std::min(in_height, static_cast<int>(in_width / requested_aspect));
+  }
+  const Fraction scale =
+      FindScale(cropped_width, cropped_height, target_pixel_count,
+                max_pixel_count, variable_start_scale_factor_);
+  // Adjust cropping slightly to get correctly aligned output size and a perfect
+  // scale factor.
+  cropped_width = roundUp(cropped_width,
+                          scale.denominator * resolution_alignment_, in_width);
+  cropped_height = roundUp(
+      cropped_height, scale.denominator * resolution_alignment_, in_height);
+  RTC_DCHECK_EQ(0, cropped_width % scale.denominator);
+  RTC_DCHECK_EQ(0, cropped_height % scale.denominator);
+
+  // Calculate final output size.
+  cached_adaptation_->cropped_width = cropped_width;
+  cached_adaptation_->cropped_height = cropped_height;
+  cached_adaptation_->out_width =
+      cropped_width / scale.denominator * scale.numerator;
+  cached_adaptation_->out_height =
+      cropped_height / scale.denominator * scale.numerator;
+  RTC_DCHECK_EQ(0, cached_adaptation_->out_width % resolution_alignment_);
+  RTC_DCHECK_EQ(0, cached_adaptation_->out_height % resolution_alignment_);
+  cached_adaptation_->scaled = scale.numerator != scale.denominator;
+}
+
 void VideoAdapter::OnOutputFormatRequest(
     const absl::optional<VideoFormat>& format) {
   absl::optional<std::pair<int, int>> target_aspect_ratio;
@@ -336,6 +364,7 @@ void VideoAdapter::OnOutputFormatRequest(
   max_portrait_pixel_count_ = max_portrait_pixel_count;
   max_fps_ = max_fps;
   next_frame_timestamp_ns_ = absl::nullopt;
+  cached_adaptation_ = absl::nullopt;
 }
 
 void VideoAdapter::OnSinkWants(const rtc::VideoSinkWants& sink_wants) {
@@ -347,6 +376,7 @@ void VideoAdapter::OnSinkWants(const rtc::VideoSinkWants& sink_wants) {
   max_framerate_request_ = sink_wants.max_framerate_fps;
   resolution_alignment_ = cricket::LeastCommonMultiple(
       source_resolution_alignment_, sink_wants.resolution_alignment);
+  cached_adaptation_ = absl::nullopt;
 }
 
 }  // namespace cricket
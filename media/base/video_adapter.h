@@ -103,6 +103,11 @@ class VideoAdapter {
   bool KeepFrame(int64_t in_timestamp_ns)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(critical_section_);
 
+  // Recomputes |cached_adaptation_| for the given input size under the
+  // current constraints.
+  void ComputeAdaptation(int in_width, int in_height)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(critical_section_);
+
   int frames_in_ RTC_GUARDED_BY(critical_section_);  // Number of input frames.
   int frames_out_
       RTC_GUARDED_BY(critical_section_);  // Number of output frames.
@@ -143,6 +148,25 @@ class VideoAdapter {
   int resolution_request_max_pixel_count_ RTC_GUARDED_BY(critical_section_);
   int max_framerate_request_ RTC_GUARDED_BY(critical_section_);
 
+  // Cached output of the resolution adaptation. As long as the constraints
+  // and the input size are unchanged the decision from the previous frame
+  // still holds, so the per-frame path can skip the crop and scale factor
+  // computation; only frame dropping is time dependent. Invalidated by
+  // OnOutputFormatRequest() and OnSinkWants().
+  struct CachedAdaptation {
+    int in_width;
+    int in_height;
+    // True if the constraints currently reject all frames.
+    bool drop_all;
+    int cropped_width;
+    int cropped_height;
+    int out_width;
+    int out_height;
+    bool scaled;
+  };
+  absl::optional<CachedAdaptation> cached_adaptation_
+      RTC_GUARDED_BY(critical_section_);
+
   // The critical section to protect the above variables.
   rtc::CriticalSection critical_section_;
 
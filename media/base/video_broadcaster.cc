@@ -10,6 +10,7 @@
 
 #include "media/base/video_broadcaster.h"
 
+#include <memory>
 #include <vector>
 
 #include "absl/types/optional.h"
@@ -21,7 +22,8 @@
 
 namespace rtc {
 
-VideoBroadcaster::VideoBroadcaster() = default;
+VideoBroadcaster::VideoBroadcaster()
+    : sink_snapshot_(std::make_shared<std::vector<SinkPair>>()) {}
 VideoBroadcaster::~VideoBroadcaster() = default;
 
 void VideoBroadcaster::AddOrUpdateSink(
@@ -35,6 +37,7 @@ void VideoBroadcaster::AddOrUpdateSink(
   }
   VideoSourceBase::AddOrUpdateSink(sink, wants);
   UpdateWants();
+  UpdateSinkSnapshot();
 }
 
 void VideoBroadcaster::RemoveSink(
@@ -43,6 +46,7 @@ void VideoBroadcaster::RemoveSink(
   rtc::CritScope cs(&sinks_and_wants_lock_);
   VideoSourceBase::RemoveSink(sink);
   UpdateWants();
+  UpdateSinkSnapshot();
 }
 
 bool VideoBroadcaster::frame_wanted() const {
@@ -56,9 +60,18 @@ VideoSinkWants VideoBroadcaster::wants() const {
 }
 
 void VideoBroadcaster::OnFrame(const webrtc::VideoFrame& frame) {
-  rtc::CritScope cs(&sinks_and_wants_lock_);
+  // Grab a reference to the current sink list snapshot and deliver the frame
+  // without holding the lock, so fan-out to many sinks never contends with
+  // sink updates. The snapshot is immutable; updates replace it wholesale.
+  std::shared_ptr<const std::vector<SinkPair>> sinks;
+  bool clear_update_rect;
+  {
+    rtc::CritScope cs(&sinks_and_wants_lock_);
+    sinks = sink_snapshot_;
+    clear_update_rect = !previous_frame_sent_to_all_sinks_;
+  }
   bool current_frame_was_discarded = false;
-  for (auto& sink_pair : sink_pairs()) {
+  for (const auto& sink_pair : *sinks) {
     if (sink_pair.wants.rotation_applied &&
         frame.rotation() != webrtc::kVideoRotation_0) {
       // Calls to OnFrame are not synchronized with changes to the sink wants.
@@ -71,16 +84,20 @@ void VideoBroadcaster::OnFrame(const webrtc::VideoFrame& frame) {
       continue;
     }
     if (sink_pair.wants.black_frames) {
+      rtc::scoped_refptr<webrtc::VideoFrameBuffer> black_buffer;
+      {
+        rtc::CritScope cs(&sinks_and_wants_lock_);
+        black_buffer = GetBlackFrameBuffer(frame.width(), frame.height());
+      }
       webrtc::VideoFrame black_frame =
           webrtc::VideoFrame::Builder()
-              .set_video_frame_buffer(
-                  GetBlackFrameBuffer(frame.width(), frame.height()))
+              .set_video_frame_buffer(black_buffer)
               .set_rotation(frame.rotation())
               .set_timestamp_us(frame.timestamp_us())
               .set_id(frame.id())
               .build();
       sink_pair.sink->OnFrame(black_frame);
-    } else if (!previous_frame_sent_to_all_sinks_ && frame.has_update_rect()) {
+    } else if (clear_update_rect && frame.has_update_rect()) {
       // Since last frame was not sent to some sinks, no reliable update
       // information is available, so we need to clear the update rect.
       webrtc::VideoFrame copy = frame;
@@ -90,11 +107,17 @@ void VideoBroadcaster::OnFrame(const webrtc::VideoFrame& frame) {
       sink_pair.sink->OnFrame(frame);
     }
   }
+  rtc::CritScope cs(&sinks_and_wants_lock_);
   previous_frame_sent_to_all_sinks_ = !current_frame_was_discarded;
 }
 
 void VideoBroadcaster::OnDiscardedFrame() {
-  for (auto& sink_pair : sink_pairs()) {
+  std::shared_ptr<const std::vector<SinkPair>> sinks;
+  {
+    rtc::CritScope cs(&sinks_and_wants_lock_);
+    sinks = sink_snapshot_;
+  }
+  for (const auto& sink_pair : *sinks) {
     sink_pair.sink->OnDiscardedFrame();
   }
 }
@@ -136,6 +159,10 @@ void VideoBroadcaster::UpdateWants() {
   current_wants_ = wants;
 }
 
+void VideoBroadcaster::UpdateSinkSnapshot() {
+  sink_snapshot_ = std::make_shared<const std::vector<SinkPair>>(sink_pairs());
+}
+
 const rtc::scoped_refptr<webrtc::VideoFrameBuffer>&
 VideoBroadcaster::GetBlackFrameBuffer(int width, int height) {
   if (!black_frame_buffer_ || black_frame_buffer_->width() != width ||
@@ -11,6 +11,9 @@
 #ifndef MEDIA_BASE_VIDEO_BROADCASTER_H_
 #define MEDIA_BASE_VIDEO_BROADCASTER_H_
 
+#include <memory>
+#include <vector>
+
 #include "api/scoped_refptr.h"
 #include "api/video/video_frame_buffer.h"
 #include "api/video/video_source_interface.h"
@@ -52,6 +55,9 @@ class VideoBroadcaster : public VideoSourceBase,
 
  protected:
   void UpdateWants() RTC_EXCLUSIVE_LOCKS_REQUIRED(sinks_and_wants_lock_);
+  // Replaces the immutable sink list snapshot used by OnFrame() and
+  // OnDiscardedFrame() with a copy of the current sinks.
+  void UpdateSinkSnapshot() RTC_EXCLUSIVE_LOCKS_REQUIRED(sinks_and_wants_lock_);
   const rtc::scoped_refptr<webrtc::VideoFrameBuffer>& GetBlackFrameBuffer(
       int width,
       int height) RTC_EXCLUSIVE_LOCKS_REQUIRED(sinks_and_wants_lock_);
@@ -59,6 +65,15 @@ class VideoBroadcaster : public VideoSourceBase,
   rtc::CriticalSection sinks_and_wants_lock_;
 
   VideoSinkWants current_wants_ RTC_GUARDED_BY(sinks_and_wants_lock_);
+  // Immutable snapshot of the sink list, replaced wholesale whenever the
+  // sinks or their wants change. OnFrame() grabs a reference under the lock
+  // but iterates and delivers frames without holding it, so adding or
+  // updating sinks never contends with frame delivery. Note that as a
+  // consequence, RemoveSink() no longer blocks until a concurrent OnFrame()
+  // has finished; a removed sink must stay alive until the frame delivery
+  // thread is known to have passed the removal.
+  std::shared_ptr<const std::vector<SinkPair>> sink_snapshot_
+      RTC_GUARDED_BY(sinks_and_wants_lock_);
   rtc::scoped_refptr<webrtc::VideoFrameBuffer> black_frame_buffer_;
   bool previous_frame_sent_to_all_sinks_ RTC_GUARDED_BY(sinks_and_wants_lock_) =
       true;
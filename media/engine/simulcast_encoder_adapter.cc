@@ -19,6 +19,8 @@
 #include <utility>
 
 #include "api/scoped_refptr.h"
+#include "api/task_queue/default_task_queue_factory.h"
+#include "api/task_queue/task_queue_factory.h"
 #include "api/video/i420_buffer.h"
 #include "api/video/video_codec_constants.h"
 #include "api/video/video_frame_buffer.h"
@@ -31,6 +33,7 @@
 #include "modules/video_coding/utility/simulcast_rate_allocator.h"
 #include "rtc_base/atomic_ops.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/event.h"
 #include "rtc_base/experiments/rate_control_settings.h"
 #include "rtc_base/logging.h"
 #include "system_wrappers/include/field_trial.h"
@@ -147,6 +150,8 @@ SimulcastEncoderAdapter::SimulcastEncoderAdapter(
       fallback_encoder_factory_(fallback_factory),
       video_format_(format),
       encoded_complete_callback_(nullptr),
+      parallel_encode_enabled_(field_trial::IsEnabled(
+          "WebRTC-SimulcastEncoderAdapter-ParallelEncode")),
       experimental_boosted_screenshare_qp_(GetScreenshareBoostedQpValue()),
       boost_base_layer_quality_(RateControlSettings::ParseFromFieldTrials()
                                     .Vp8BoostBaseLayerQuality()),
@@ -186,6 +191,10 @@ int SimulcastEncoderAdapter::Release() {
     stored_encoders_.push(std::move(encoder));
   }
 
+  // Encode() waits for all fanned-out layer encodes before returning, so by
+  // the time we get here the workers are idle and safe to delete.
+  encode_workers_.clear();
+
   // It's legal to move the encoder to another queue now.
   encoder_queue_.Detach();
 
@@ -341,6 +350,18 @@ int SimulcastEncoderAdapter::InitEncode(
   // To save memory, don't store encoders that we don't use.
   DestroyStoredEncoders();
 
+  if (parallel_encode_enabled_ && number_of_streams > 1) {
+    // One worker per stream beyond the first; the first stream is encoded on
+    // the thread that calls Encode() while the workers run the others.
+    std::unique_ptr<TaskQueueFactory> task_queue_factory =
+        CreateDefaultTaskQueueFactory();
+    for (int i = 1; i < number_of_streams; ++i) {
+      encode_workers_.push_back(
+          std::make_unique<rtc::TaskQueue>(task_queue_factory->CreateTaskQueue(
+              "SimulcastEncoder", TaskQueueFactory::Priority::HIGH)));
+    }
+  }
+
   rtc::AtomicOps::ReleaseStore(&inited_, 1);
 
   return WEBRTC_VIDEO_CODEC_OK;
@@ -381,6 +402,18 @@ int SimulcastEncoderAdapter::Encode(
   rtc::scoped_refptr<I420BufferInterface> src_buffer;
   int src_width = input_image.width();
   int src_height = input_image.height();
+
+  // With parallel encoding, the per-stream frames (scaled here, on the
+  // caller's thread, from a single i420 conversion) are collected first and
+  // fanned out to the workers once all of them are ready.
+  struct LayerEncodeTask {
+    size_t stream_idx;
+    VideoFrame frame;
+    std::vector<VideoFrameType> frame_types;
+  };
+  std::vector<LayerEncodeTask> layer_tasks;
+  const bool encode_in_parallel = !encode_workers_.empty();
+
   for (size_t stream_idx = 0; stream_idx < streaminfos_.size(); ++stream_idx) {
     // Don't encode frames in resolutions that we don't intend to send.
     if (!streaminfos_[stream_idx].send_stream) {
@@ -427,10 +460,15 @@ int SimulcastEncoderAdapter::Encode(
          streaminfos_[stream_idx]
              .encoder->GetEncoderInfo()
              .supports_native_handle)) {
-      int ret = streaminfos_[stream_idx].encoder->Encode(input_image,
-                                                         &stream_frame_types);
-      if (ret != WEBRTC_VIDEO_CODEC_OK) {
-        return ret;
+      if (encode_in_parallel) {
+        layer_tasks.push_back(
+            {stream_idx, input_image, std::move(stream_frame_types)});
+      } else {
+        int ret = streaminfos_[stream_idx].encoder->Encode(
+            input_image, &stream_frame_types);
+        if (ret != WEBRTC_VIDEO_CODEC_OK) {
+          return ret;
+        }
       }
     } else {
       if (src_buffer == nullptr) {
@@ -439,7 +477,7 @@ int SimulcastEncoderAdapter::Encode(
       rtc::scoped_refptr<I420Buffer> dst_buffer =
           I420Buffer::Create(dst_width, dst_height);
 
-      dst_buffer->ScaleFrom(*src_buffer);
+      dst_buffer->ScaleFromParallel(*src_buffer);
 
       // UpdateRect is not propagated to lower simulcast layers currently.
       // TODO(ilnik): Consider scaling UpdateRect together with the buffer.
@@ -448,10 +486,46 @@ int SimulcastEncoderAdapter::Encode(
       frame.set_rotation(webrtc::kVideoRotation_0);
       frame.set_update_rect(
           VideoFrame::UpdateRect{0, 0, frame.width(), frame.height()});
-      int ret =
-          streaminfos_[stream_idx].encoder->Encode(frame, &stream_frame_types);
-      if (ret != WEBRTC_VIDEO_CODEC_OK) {
-        return ret;
+      if (encode_in_parallel) {
+        layer_tasks.push_back(
+            {stream_idx, std::move(frame), std::move(stream_frame_types)});
+      } else {
+        int ret = streaminfos_[stream_idx].encoder->Encode(
+            frame, &stream_frame_types);
+        if (ret != WEBRTC_VIDEO_CODEC_OK) {
+          return ret;
+        }
+      }
+    }
+  }
+
+  if (!layer_tasks.empty()) {
+    // Encode the first collected stream on the caller's thread and the rest
+    // on the workers, then wait for all of them so that Encode() keeps its
+    // synchronous contract. Each task writes only its own result slot, so no
+    // locking is needed for |results|.
+    std::vector<int> results(layer_tasks.size(), WEBRTC_VIDEO_CODEC_OK);
+    std::vector<std::unique_ptr<rtc::Event>> done_events;
+    for (size_t i = 1; i < layer_tasks.size(); ++i) {
+      done_events.push_back(std::make_unique<rtc::Event>());
+      rtc::Event* done = done_events.back().get();
+      LayerEncodeTask* task = &layer_tasks[i];
+      int* result = &results[i];
+      encode_workers_[(i - 1) % encode_workers_.size()]->PostTask(
+          [this, task, result, done] {
+            *result = streaminfos_[task->stream_idx].encoder->Encode(
+                task->frame, &task->frame_types);
+            done->Set();
+          });
+    }
+    results[0] = streaminfos_[layer_tasks[0].stream_idx].encoder->Encode(
+        layer_tasks[0].frame, &layer_tasks[0].frame_types);
+    for (const std::unique_ptr<rtc::Event>& done : done_events) {
+      done->Wait(rtc::Event::kForever);
+    }
+    for (int result : results) {
+      if (result != WEBRTC_VIDEO_CODEC_OK) {
+        return result;
       }
     }
   }
@@ -566,6 +640,10 @@ EncodedImageCallback::Result SimulcastEncoderAdapter::OnEncodedImage(
 
   stream_image.SetSpatialIndex(stream_idx);
 
+  // The contained encoders may complete on different threads when parallel
+  // encoding is enabled, but the registered callback expects serialized
+  // delivery.
+  rtc::CritScope cs(&encoded_image_crit_);
   return encoded_complete_callback_->OnEncodedImage(
       stream_image, &stream_codec_specific, fragmentation);
 }
@@ -25,8 +25,10 @@
 #include "modules/video_coding/include/video_codec_interface.h"
 #include "modules/video_coding/utility/framerate_controller.h"
 #include "rtc_base/atomic_ops.h"
+#include "rtc_base/critical_section.h"
 #include "rtc_base/synchronization/sequence_checker.h"
 #include "rtc_base/system/rtc_export.h"
+#include "rtc_base/task_queue.h"
 
 namespace webrtc {
 
@@ -131,6 +133,18 @@ class RTC_EXPORT SimulcastEncoderAdapter : public VideoEncoder {
   // have to be recreated. Remaining encoders are destroyed by the destructor.
   std::stack<std::unique_ptr<VideoEncoder>> stored_encoders_;
 
+  // When the WebRTC-SimulcastEncoderAdapter-ParallelEncode trial is enabled,
+  // Encode() fans the per-stream encodes out to these queues (one per stream
+  // beyond the first, which is encoded on the caller's thread) and waits for
+  // all of them before returning. Created by InitEncode, torn down by
+  // Release.
+  const bool parallel_encode_enabled_;
+  std::vector<std::unique_ptr<rtc::TaskQueue>> encode_workers_;
+
+  // Serializes delivery to |encoded_complete_callback_| since the contained
+  // encoders may complete concurrently when parallel encoding is enabled.
+  rtc::CriticalSection encoded_image_crit_;
+
   const absl::optional<unsigned int> experimental_boosted_screenshare_qp_;
   const bool boost_base_layer_quality_;
   const bool prefer_temporal_support_on_base_layer_;
@@ -405,6 +405,30 @@ MergeInfoAboutOutboundRtpSubstreams(
   return rtp_substreams;
 }
 
+// Hashes the fields of |codecs| that determine the outcome of MapCodecs().
+// Used as the key of the mapped receive codec cache; collisions are handled
+// by comparing the stored offered codec list.
+size_t CodecListHash(const std::vector<VideoCodec>& codecs) {
+  size_t hash = codecs.size();
+  auto combine = [&hash](size_t value) {
+    hash = hash * 101 + value;
+  };
+  for (const VideoCodec& codec : codecs) {
+    combine(static_cast<size_t>(codec.id));
+    combine(std::hash<std::string>()(codec.name));
+    for (const auto& param : codec.params) {
+      combine(std::hash<std::string>()(param.first));
+      combine(std::hash<std::string>()(param.second));
+    }
+  }
+  return hash;
+}
+
+// Upper bound on the number of entries kept in the mapped receive codec
+// cache. Negotiations normally produce a handful of distinct codec lists;
+// the cache is emptied if an adversarial peer exceeds this.
+const size_t kMaxMappedRecvCodecsCacheSize = 16;
+
 }  // namespace
 
 // This constant is really an on/off, lower-level configurable NACK history
@@ -1108,31 +1132,15 @@ bool WebRtcVideoChannel::GetChangedRecvParameters(
   }
 
   // Handle receive codecs.
-  const std::vector<VideoCodecSettings> mapped_codecs =
-      MapCodecs(params.codecs);
-  if (mapped_codecs.empty()) {
-    RTC_LOG(LS_ERROR) << "SetRecvParameters called without any video codecs.";
+  const std::vector<VideoCodecSettings>* mapped_codecs =
+      MapAndValidateRecvCodecs(params);
+  if (!mapped_codecs) {
     return false;
   }
 
-  // Verify that every mapped codec is supported locally.
-  if (params.is_stream_active) {
-    const std::vector<VideoCodec> local_supported_codecs =
-        GetPayloadTypesAndDefaultCodecs(decoder_factory_,
-                                        /*is_decoder_factory=*/true);
-    for (const VideoCodecSettings& mapped_codec : mapped_codecs) {
-      if (!FindMatchingCodec(local_supported_codecs, mapped_codec.codec)) {
-        RTC_LOG(LS_ERROR)
-            << "SetRecvParameters called with unsupported video codec: "
-            << mapped_codec.codec.ToString();
-        return false;
-      }
-    }
-  }
-
-  if (NonFlexfecReceiveCodecsHaveChanged(recv_codecs_, mapped_codecs)) {
+  if (NonFlexfecReceiveCodecsHaveChanged(recv_codecs_, *mapped_codecs)) {
     changed_params->codec_settings =
-        absl::optional<std::vector<VideoCodecSettings>>(mapped_codecs);
+        absl::optional<std::vector<VideoCodecSettings>>(*mapped_codecs);
   }
 
   // Handle RTP header extensions.
@@ -1143,7 +1151,7 @@ bool WebRtcVideoChannel::GetChangedRecvParameters(
         absl::optional<std::vector<webrtc::RtpExtension>>(filtered_extensions);
   }
 
-  int flexfec_payload_type = mapped_codecs.front().flexfec_payload_type;
+  int flexfec_payload_type = mapped_codecs->front().flexfec_payload_type;
   if (flexfec_payload_type != recv_flexfec_payload_type_) {
     changed_params->flexfec_payload_type = flexfec_payload_type;
   }
@@ -1151,6 +1159,52 @@ bool WebRtcVideoChannel::GetChangedRecvParameters(
   return true;
 }
 
+const std::vector<WebRtcVideoChannel::VideoCodecSettings>*
+WebRtcVideoChannel::MapAndValidateRecvCodecs(
+    const VideoRecvParameters& params) const {
+  const size_t key = CodecListHash(params.codecs);
+  auto it = mapped_recv_codecs_cache_.find(key);
+  if (it != mapped_recv_codecs_cache_.end() &&
+      it->second.offered_codecs != params.codecs) {
+    // Hash collision; drop the stale entry and recompute.
+    mapped_recv_codecs_cache_.erase(it);
+    it = mapped_recv_codecs_cache_.end();
+  }
+  if (it == mapped_recv_codecs_cache_.end()) {
+    std::vector<VideoCodecSettings> mapped_codecs = MapCodecs(params.codecs);
+    if (mapped_codecs.empty()) {
+      RTC_LOG(LS_ERROR)
+          << "SetRecvParameters called without any video codecs.";
+      return nullptr;
+    }
+    if (mapped_recv_codecs_cache_.size() >= kMaxMappedRecvCodecsCacheSize) {
+      mapped_recv_codecs_cache_.clear();
+    }
+    MappedRecvCodecsCacheEntry entry;
+    entry.offered_codecs = params.codecs;
+    entry.mapped_codecs = std::move(mapped_codecs);
+    it = mapped_recv_codecs_cache_.emplace(key, std::move(entry)).first;
+  }
+
+  // Verify that every mapped codec is supported locally. The result is
+  // remembered per cache entry since the decoder factory does not change.
+  if (params.is_stream_active && !it->second.validated) {
+    const std::vector<VideoCodec> local_supported_codecs =
+        GetPayloadTypesAndDefaultCodecs(decoder_factory_,
+                                        /*is_decoder_factory=*/true);
+    for (const VideoCodecSettings& mapped_codec : it->second.mapped_codecs) {
+      if (!FindMatchingCodec(local_supported_codecs, mapped_codec.codec)) {
+        RTC_LOG(LS_ERROR)
+            << "SetRecvParameters called with unsupported video codec: "
+            << mapped_codec.codec.ToString();
+        return nullptr;
+      }
+    }
+    it->second.validated = true;
+  }
+  return &it->second.mapped_codecs;
+}
+
 bool WebRtcVideoChannel::SetRecvParameters(const VideoRecvParameters& params) {
   RTC_DCHECK_RUN_ON(&thread_checker_);
   TRACE_EVENT0("webrtc", "WebRtcVideoChannel::SetRecvParameters");
@@ -1909,6 +1963,7 @@ bool WebRtcVideoChannel::SendRtp(const uint8_t* data,
       options.included_in_feedback;
   rtc_options.info_signaled_after_sent.included_in_allocation =
       options.included_in_allocation;
+  rtc_options.batchable = options.batchable;
   return MediaChannel::SendPacket(&packet, rtc_options);
 }
 
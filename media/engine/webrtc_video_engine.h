@@ -305,6 +305,18 @@ class WebRtcVideoChannel : public VideoMediaChannel,
                                 ChangedRecvParameters* changed_params) const
       RTC_EXCLUSIVE_LOCKS_REQUIRED(thread_checker_);
 
+  // Maps |params.codecs| to VideoCodecSettings and, if
+  // |params.is_stream_active|, verifies that each mapped codec is supported
+  // by |decoder_factory_|.
+  // Identical offered codec lists are resolved from
+  // |mapped_recv_codecs_cache_|, so renegotiations that offer the same codec
+  // section to many channels skip the per-pair matching done by MapCodecs()
+  // and FindMatchingCodec(). Returns a pointer into the cache, valid until
+  // the next call, or nullptr if mapping or validation failed.
+  const std::vector<VideoCodecSettings>* MapAndValidateRecvCodecs(
+      const VideoRecvParameters& params) const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(thread_checker_);
+
   void ConfigureReceiverRtp(
       webrtc::VideoReceiveStream::Config* config,
       webrtc::FlexfecReceiveStream::Config* flexfec_config,
@@ -603,6 +615,20 @@ class WebRtcVideoChannel : public VideoMediaChannel,
   webrtc::VideoBitrateAllocatorFactory* const bitrate_allocator_factory_
       RTC_GUARDED_BY(thread_checker_);
   std::vector<VideoCodecSettings> recv_codecs_ RTC_GUARDED_BY(thread_checker_);
+  // Cache of mapped receive codec lists, keyed by a hash of the offered
+  // codecs. SDP renegotiations typically offer the same codec section to
+  // every channel, so repeated offers resolve via one lookup instead of
+  // rerunning MapCodecs(). |offered_codecs| guards against hash collisions.
+  // |validated| records that the mapped codecs were verified against the
+  // decoder factory, whose supported formats are constant over the lifetime
+  // of the channel.
+  struct MappedRecvCodecsCacheEntry {
+    std::vector<VideoCodec> offered_codecs;
+    std::vector<VideoCodecSettings> mapped_codecs;
+    bool validated = false;
+  };
+  mutable std::map<size_t, MappedRecvCodecsCacheEntry>
+      mapped_recv_codecs_cache_ RTC_GUARDED_BY(thread_checker_);
   std::vector<webrtc::RtpExtension> recv_rtp_extensions_
       RTC_GUARDED_BY(thread_checker_);
   // See reason for keeping track of the FlexFEC payload type separately in
@@ -234,6 +234,7 @@ class WebRtcVoiceMediaChannel final : public VoiceMediaChannel,
         options.included_in_feedback;
     rtc_options.info_signaled_after_sent.included_in_allocation =
         options.included_in_allocation;
+    rtc_options.batchable = options.batchable;
     return VoiceMediaChannel::SendPacket(&packet, rtc_options);
   }
 
@@ -290,13 +290,25 @@ class SctpTransport::UsrSctpWrapper {
                         << "; set_df: " << rtc::ToHex(set_df);
 
     VerboseLogPacket(data, length, SCTP_DUMP_OUTBOUND);
-    // Note: We have to copy the data; the caller will delete it.
+    // Most outbound packets are generated while usrsctp is entered from the
+    // network thread (a send or an inbound packet being processed); send them
+    // straight out without copying the packet or queueing an invocation.
+    if (transport->network_thread_->IsCurrent()) {
+      transport->OnPacketFromSctpToNetwork(
+          reinterpret_cast<const uint8_t*>(data), length);
+      return 0;
+    }
+    // Called from a usrsctp thread (e.g. a retransmission timer); we have to
+    // copy the data - the caller will delete it - and marshal to the network
+    // thread.
     rtc::CopyOnWriteBuffer buf(reinterpret_cast<uint8_t*>(data), length);
-    // TODO(deadbeef): Why do we need an AsyncInvoke here? We're already on the
-    // right thread and don't need to unwind the stack.
     transport->invoker_.AsyncInvoke<void>(
         RTC_FROM_HERE, transport->network_thread_,
-        rtc::Bind(&SctpTransport::OnPacketFromSctpToNetwork, transport, buf));
+        rtc::Bind(
+            static_cast<void (SctpTransport::*)(
+                const rtc::CopyOnWriteBuffer&)>(
+                &SctpTransport::OnPacketFromSctpToNetwork),
+            transport, buf));
     return 0;
   }
 
@@ -1039,13 +1051,18 @@ sockaddr_conn SctpTransport::GetSctpSockAddr(int port) {
 
 void SctpTransport::OnPacketFromSctpToNetwork(
     const rtc::CopyOnWriteBuffer& buffer) {
+  OnPacketFromSctpToNetwork(buffer.data(), buffer.size());
+}
+
+void SctpTransport::OnPacketFromSctpToNetwork(const uint8_t* data,
+                                              size_t len) {
   RTC_DCHECK_RUN_ON(network_thread_);
-  if (buffer.size() > (kSctpMtu)) {
+  if (len > (kSctpMtu)) {
     RTC_LOG(LS_ERROR) << debug_name_
                       << "->OnPacketFromSctpToNetwork(...): "
                          "SCTP seems to have made a packet that is bigger "
                          "than its official MTU: "
-                      << buffer.size() << " vs max of " << kSctpMtu;
+                      << len << " vs max of " << kSctpMtu;
   }
   TRACE_EVENT0("webrtc", "SctpTransport::OnPacketFromSctpToNetwork");
 
@@ -1056,7 +1073,7 @@ void SctpTransport::OnPacketFromSctpToNetwork(
   }
 
   // Bon voyage.
-  transport_->SendPacket(buffer.data<char>(), buffer.size(),
+  transport_->SendPacket(reinterpret_cast<const char*>(data), len,
                          rtc::PacketOptions(), PF_NORMAL);
 }
 
@@ -172,6 +172,10 @@ class SctpTransport : public SctpTransportInternal,
 
   // Called using |invoker_| to send packet on the network.
   void OnPacketFromSctpToNetwork(const rtc::CopyOnWriteBuffer& buffer);
+  // As above, but called directly from the outbound packet callback when it
+  // already runs on the network thread, so the common send path does not pay
+  // for a copy of the packet and a queued invocation.
+  void OnPacketFromSctpToNetwork(const uint8_t* data, size_t len);
   // Called using |invoker_| to decide what to do with the packet.
   // The |flags| parameter is used by SCTP to distinguish notification packets
   // from other types of packets.
@@ -27,6 +27,7 @@
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "rtc_base/thread_annotations.h"
+#include "system_wrappers/include/audio_pipeline_tap.h"
 #include "system_wrappers/include/metrics.h"
 
 namespace webrtc {
@@ -297,6 +298,8 @@ int32_t AudioCodingModuleImpl::Encode(
                                      : AudioFrameType::kAudioFrameCN;
   }
 
+  audio_pipeline_tap::Record(audio_pipeline_tap::Stage::kAcmEncodeDone);
+
   {
     rtc::CritScope lock(&callback_crit_sect_);
     if (packetization_callback_) {
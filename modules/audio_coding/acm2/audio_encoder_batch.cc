@@ -0,0 +1,125 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/acm2/audio_encoder_batch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <utility>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/task_utils/to_queued_task.h"
+
+namespace webrtc {
+
+AudioEncoderBatch::AudioEncoderBatch(size_t num_worker_queues,
+                                     TaskQueueFactory* task_queue_factory)
+    : arenas_(num_worker_queues + 1), offsets_(num_worker_queues + 1) {
+  RTC_DCHECK(num_worker_queues == 0 || task_queue_factory);
+  workers_.reserve(num_worker_queues);
+  for (size_t i = 0; i < num_worker_queues; ++i) {
+    rtc::StringBuilder name;
+    name << "AudioEncoderBatchWorker" << i;
+    workers_.push_back(task_queue_factory->CreateTaskQueue(
+        name.str(), TaskQueueFactory::Priority::NORMAL));
+  }
+}
+
+AudioEncoderBatch::~AudioEncoderBatch() = default;
+
+void AudioEncoderBatch::RegisterEncoder(AudioEncoder* encoder) {
+  RTC_DCHECK(encoder);
+  RTC_DCHECK(std::find(encoders_.begin(), encoders_.end(), encoder) ==
+             encoders_.end());
+  encoders_.push_back(encoder);
+}
+
+void AudioEncoderBatch::UnregisterEncoder(AudioEncoder* encoder) {
+  auto it = std::find(encoders_.begin(), encoders_.end(), encoder);
+  RTC_DCHECK(it != encoders_.end());
+  encoders_.erase(it);
+}
+
+void AudioEncoderBatch::Encode(
+    rtc::ArrayView<const uint32_t> rtp_timestamps,
+    rtc::ArrayView<const rtc::ArrayView<const int16_t>> audio,
+    rtc::ArrayView<Output> outputs) {
+  RTC_DCHECK_EQ(rtp_timestamps.size(), encoders_.size());
+  RTC_DCHECK_EQ(audio.size(), encoders_.size());
+  RTC_DCHECK_EQ(outputs.size(), encoders_.size());
+  if (encoders_.empty()) {
+    return;
+  }
+  if (workers_.empty()) {
+    EncodeRange(0, encoders_.size(), 0, rtp_timestamps, audio, outputs);
+    return;
+  }
+
+  // Partition the encoders into contiguous slices, one per worker plus one
+  // for the calling thread. The slices are disjoint and each one appends to
+  // its own arena, so the workers write to their parts of |outputs| without
+  // synchronization.
+  const size_t num_slices = std::min(workers_.size() + 1, encoders_.size());
+  const size_t slice_size = encoders_.size() / num_slices;
+  const size_t remainder = encoders_.size() % num_slices;
+
+  std::atomic<size_t> pending_workers(num_slices - 1);
+  rtc::Event done;
+  size_t begin = slice_size + (remainder > 0 ? 1 : 0);
+  for (size_t slice = 1; slice < num_slices; ++slice) {
+    const size_t end = begin + slice_size + (slice < remainder ? 1 : 0);
+    workers_[slice - 1]->PostTask(ToQueuedTask([this, begin, end, slice,
+                                                rtp_timestamps, audio, outputs,
+                                                &pending_workers, &done] {
+      EncodeRange(begin, end, slice, rtp_timestamps, audio, outputs);
+      if (pending_workers.fetch_sub(1) == 1) {
+        done.Set();
+      }
+    }));
+    begin = end;
+  }
+  RTC_DCHECK_EQ(begin, encoders_.size());
+
+  // Encode the first slice on the calling thread, then wait for the workers
+  // to finish theirs.
+  EncodeRange(0, slice_size + (remainder > 0 ? 1 : 0), 0, rtp_timestamps,
+              audio, outputs);
+  done.Wait(rtc::Event::kForever);
+}
+
+void AudioEncoderBatch::EncodeRange(
+    size_t begin,
+    size_t end,
+    size_t arena_index,
+    rtc::ArrayView<const uint32_t> rtp_timestamps,
+    rtc::ArrayView<const rtc::ArrayView<const int16_t>> audio,
+    rtc::ArrayView<Output> outputs) {
+  rtc::Buffer& arena = arenas_[arena_index];
+  arena.Clear();
+  // The arena may reallocate while payloads are appended to it, so record
+  // offsets first and form the views when the slice is complete.
+  std::vector<size_t>& offsets = offsets_[arena_index];
+  offsets.resize(end - begin);
+  for (size_t i = begin; i < end; ++i) {
+    offsets[i - begin] = arena.size();
+    outputs[i].info = encoders_[i]->Encode(rtp_timestamps[i], audio[i], &arena);
+    RTC_DCHECK_EQ(arena.size(),
+                  offsets[i - begin] + outputs[i].info.encoded_bytes);
+  }
+  for (size_t i = begin; i < end; ++i) {
+    outputs[i].payload = rtc::ArrayView<const uint8_t>(
+        arena.data() + offsets[i - begin], outputs[i].info.encoded_bytes);
+  }
+}
+
+}  // namespace webrtc
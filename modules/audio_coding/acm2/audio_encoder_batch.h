@@ -0,0 +1,91 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_ACM2_AUDIO_ENCODER_BATCH_H_
+#define MODULES_AUDIO_CODING_ACM2_AUDIO_ENCODER_BATCH_H_
+
+#include <memory>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/audio_codecs/audio_encoder.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "rtc_base/buffer.h"
+#include "rtc_base/constructor_magic.h"
+
+namespace webrtc {
+
+// Facade that encodes one 10 ms frame for many AudioEncoder instances in a
+// single call, instead of each send stream driving its own encoder behind
+// its own lock. The encoders are stored contiguously and processed in
+// registration order; the encoded payloads are appended to a small set of
+// arena buffers whose capacity is reused between calls, so that steady-state
+// encoding allocates nothing. Optionally, the encoders are split into
+// contiguous slices that are encoded in parallel on a set of worker task
+// queues.
+//
+// The batch does not own the registered encoders, and all methods must be
+// called on the same thread.
+class AudioEncoderBatch {
+ public:
+  struct Output {
+    AudioEncoder::EncodedInfo info;
+    // View into an internal arena; valid until the next call to Encode or
+    // until the batch is destroyed.
+    rtc::ArrayView<const uint8_t> payload;
+  };
+
+  // |num_worker_queues| task queues are created with |task_queue_factory|
+  // and used to encode in parallel; with 0 workers all encoders run on the
+  // calling thread, and |task_queue_factory| may be null.
+  AudioEncoderBatch(size_t num_worker_queues,
+                    TaskQueueFactory* task_queue_factory);
+  ~AudioEncoderBatch();
+
+  // Registers |encoder|, which must stay alive until it is unregistered or
+  // the batch is destroyed.
+  void RegisterEncoder(AudioEncoder* encoder);
+  void UnregisterEncoder(AudioEncoder* encoder);
+  size_t NumEncoders() const { return encoders_.size(); }
+
+  // Encodes one frame for every registered encoder. The k-th registered
+  // encoder consumes |audio[k]| with RTP timestamp |rtp_timestamps[k]| and
+  // writes its result to |outputs[k]|; all views must have NumEncoders()
+  // elements. |audio[k]| must hold exactly 10 ms of audio in the encoder's
+  // native sample rate and channel layout, as for AudioEncoder::Encode.
+  void Encode(rtc::ArrayView<const uint32_t> rtp_timestamps,
+              rtc::ArrayView<const rtc::ArrayView<const int16_t>> audio,
+              rtc::ArrayView<Output> outputs);
+
+ private:
+  // Encodes the encoders with indices in [begin, end), appending payloads to
+  // the arena with index |arena_index|.
+  void EncodeRange(size_t begin,
+                   size_t end,
+                   size_t arena_index,
+                   rtc::ArrayView<const uint32_t> rtp_timestamps,
+                   rtc::ArrayView<const rtc::ArrayView<const int16_t>> audio,
+                   rtc::ArrayView<Output> outputs);
+
+  std::vector<AudioEncoder*> encoders_;
+  // One arena per worker plus one for the calling thread. Payload views in
+  // Output point into these. |offsets_| holds the per-slice payload start
+  // offsets while a slice is being encoded; like the arenas, its capacity is
+  // reused between calls.
+  std::vector<rtc::Buffer> arenas_;
+  std::vector<std::vector<size_t>> offsets_;
+  std::vector<std::unique_ptr<TaskQueueBase, TaskQueueDeleter>> workers_;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(AudioEncoderBatch);
+};
+
+}  // namespace webrtc
+#endif  // MODULES_AUDIO_CODING_ACM2_AUDIO_ENCODER_BATCH_H_
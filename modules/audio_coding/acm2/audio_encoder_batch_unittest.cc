@@ -0,0 +1,123 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/acm2/audio_encoder_batch.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "api/task_queue/default_task_queue_factory.h"
+#include "modules/audio_coding/codecs/pcm16b/audio_encoder_pcm16b.h"
+#include "rtc_base/buffer.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSampleRateHz = 8000;
+constexpr size_t kSamplesPerFrame = 80;  // 10 ms.
+
+std::unique_ptr<AudioEncoder> CreateEncoder() {
+  AudioEncoderPcm16B::Config config;
+  config.sample_rate_hz = kSampleRateHz;
+  config.frame_size_ms = 10;
+  return std::make_unique<AudioEncoderPcm16B>(config);
+}
+
+// Fills |samples| with a waveform that is deterministic in |stream| and
+// |frame_index|.
+void GenerateFrame(size_t stream, int frame_index, int16_t* samples) {
+  for (size_t i = 0; i < kSamplesPerFrame; ++i) {
+    samples[i] = static_cast<int16_t>(
+        100 * static_cast<int>(stream + 1) *
+        (static_cast<int>((frame_index * kSamplesPerFrame + i) % 50) - 25));
+  }
+}
+
+// Encodes |kNumStreams| streams through a batch with |num_worker_queues|
+// workers, and verifies that each payload is identical to what a reference
+// encoder produces when fed the same frames one stream at a time.
+void TestBatchAgainstReference(size_t num_worker_queues) {
+  constexpr size_t kNumStreams = 5;
+  constexpr int kNumFrames = 20;
+  std::unique_ptr<TaskQueueFactory> task_queue_factory =
+      CreateDefaultTaskQueueFactory();
+  AudioEncoderBatch batch(num_worker_queues, task_queue_factory.get());
+
+  std::vector<std::unique_ptr<AudioEncoder>> batched;
+  std::vector<std::unique_ptr<AudioEncoder>> reference;
+  for (size_t stream = 0; stream < kNumStreams; ++stream) {
+    batched.push_back(CreateEncoder());
+    reference.push_back(CreateEncoder());
+    batch.RegisterEncoder(batched.back().get());
+  }
+  ASSERT_EQ(kNumStreams, batch.NumEncoders());
+
+  int16_t audio[kNumStreams][kSamplesPerFrame];
+  std::vector<rtc::ArrayView<const int16_t>> audio_views;
+  for (size_t stream = 0; stream < kNumStreams; ++stream) {
+    audio_views.push_back(audio[stream]);
+  }
+  uint32_t rtp_timestamps[kNumStreams];
+  std::vector<AudioEncoderBatch::Output> outputs(kNumStreams);
+
+  for (int n = 0; n < kNumFrames; ++n) {
+    for (size_t stream = 0; stream < kNumStreams; ++stream) {
+      GenerateFrame(stream, n, audio[stream]);
+      rtp_timestamps[stream] =
+          static_cast<uint32_t>(n) * kSamplesPerFrame + stream;
+    }
+    batch.Encode(rtp_timestamps, audio_views, outputs);
+    for (size_t stream = 0; stream < kNumStreams; ++stream) {
+      rtc::Buffer reference_payload;
+      const AudioEncoder::EncodedInfo reference_info =
+          reference[stream]->Encode(rtp_timestamps[stream],
+                                    audio_views[stream], &reference_payload);
+      EXPECT_EQ(reference_info.encoded_timestamp,
+                outputs[stream].info.encoded_timestamp);
+      EXPECT_EQ(reference_info.encoded_bytes,
+                outputs[stream].info.encoded_bytes);
+      ASSERT_EQ(reference_payload.size(), outputs[stream].payload.size());
+      EXPECT_EQ(0, std::memcmp(reference_payload.data(),
+                               outputs[stream].payload.data(),
+                               reference_payload.size()));
+    }
+  }
+}
+
+TEST(AudioEncoderBatch, MatchesIndividuallyDrivenEncoders) {
+  TestBatchAgainstReference(0);
+}
+
+TEST(AudioEncoderBatch, MatchesIndividuallyDrivenEncodersWithWorkers) {
+  TestBatchAgainstReference(2);
+}
+
+TEST(AudioEncoderBatch, RegisterAndUnregister) {
+  AudioEncoderBatch batch(0, nullptr);
+  std::unique_ptr<AudioEncoder> encoder = CreateEncoder();
+  batch.RegisterEncoder(encoder.get());
+  EXPECT_EQ(1u, batch.NumEncoders());
+  int16_t audio[kSamplesPerFrame] = {0};
+  const rtc::ArrayView<const int16_t> audio_view(audio);
+  const uint32_t rtp_timestamp = 0;
+  AudioEncoderBatch::Output output;
+  batch.Encode(rtc::ArrayView<const uint32_t>(&rtp_timestamp, 1),
+               rtc::ArrayView<const rtc::ArrayView<const int16_t>>(&audio_view,
+                                                                   1),
+               rtc::ArrayView<AudioEncoderBatch::Output>(&output, 1));
+  EXPECT_EQ(kSamplesPerFrame * sizeof(int16_t), output.payload.size());
+  batch.UnregisterEncoder(encoder.get());
+  EXPECT_EQ(0u, batch.NumEncoders());
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -10,7 +10,9 @@
 
 #include "modules/audio_coding/codecs/cng/audio_encoder_cng.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 #include <memory>
 #include <utility>
 
@@ -25,6 +27,17 @@ namespace {
 
 const int kMaxFrameSizeMs = 60;
 
+// 10 ms at 48 kHz, the highest sample rate supported when using VAD/CNG.
+constexpr size_t kMaxSamplesPer10msFrame = 480;
+constexpr size_t kMaxFramesPerPacket = kMaxFrameSizeMs / 10;
+
+// While in a passive (DTX) run, frames whose samples never exceed this
+// amplitude (roughly -60 dBFS) cannot bring the VAD back to an active
+// decision, so they are counted as passive without running the VAD at all.
+// The common all-silence frame then only costs the max-amplitude scan done
+// while buffering.
+constexpr int kPassiveGateAmplitude = 32;
+
 class AudioEncoderCng final : public AudioEncoder {
  public:
   explicit AudioEncoderCng(AudioEncoderCngConfig&& config);
@@ -69,8 +82,15 @@ class AudioEncoderCng final : public AudioEncoder {
   const int cng_payload_type_;
   const int num_cng_coefficients_;
   const int sid_frame_interval_ms_;
-  std::vector<int16_t> speech_buffer_;
-  std::vector<uint32_t> rtp_timestamps_;
+  // Fixed-size buffers for the 10 ms blocks collected before each encode
+  // decision. On DTX-heavy input most frames only pass through here and the
+  // comfort noise encoder, so the buffering must not touch the heap.
+  int16_t speech_buffer_[kMaxFramesPerPacket * kMaxSamplesPer10msFrame];
+  uint32_t rtp_timestamps_[kMaxFramesPerPacket];
+  size_t num_buffered_frames_;
+  // Largest absolute sample value among the buffered blocks, used by the
+  // passive-run gate that skips the VAD for near-silent frames.
+  int buffered_max_abs_;
   bool last_frame_active_;
   std::unique_ptr<Vad> vad_;
   std::unique_ptr<ComfortNoiseEncoder> cng_encoder_;
@@ -84,12 +104,16 @@ AudioEncoderCng::AudioEncoderCng(AudioEncoderCngConfig&& config)
       cng_payload_type_(config.payload_type),
       num_cng_coefficients_(config.num_cng_coefficients),
       sid_frame_interval_ms_(config.sid_frame_interval_ms),
+      num_buffered_frames_(0),
+      buffered_max_abs_(0),
       last_frame_active_(true),
       vad_(config.vad ? std::unique_ptr<Vad>(config.vad)
                       : CreateVad(config.vad_mode)),
       cng_encoder_(new ComfortNoiseEncoder(SampleRateHz(),
                                            sid_frame_interval_ms_,
-                                           num_cng_coefficients_)) {}
+                                           num_cng_coefficients_)) {
+  RTC_CHECK_LE(SamplesPer10msFrame(), kMaxSamplesPer10msFrame);
+}
 
 AudioEncoderCng::~AudioEncoderCng() = default;
 
@@ -122,41 +146,53 @@ AudioEncoder::EncodedInfo AudioEncoderCng::EncodeImpl(
     rtc::ArrayView<const int16_t> audio,
     rtc::Buffer* encoded) {
   const size_t samples_per_10ms_frame = SamplesPer10msFrame();
-  RTC_CHECK_EQ(speech_buffer_.size(),
-               rtp_timestamps_.size() * samples_per_10ms_frame);
-  rtp_timestamps_.push_back(rtp_timestamp);
+  RTC_CHECK_LT(num_buffered_frames_, kMaxFramesPerPacket)
+      << "Frame size cannot be larger than " << kMaxFrameSizeMs
+      << " ms when using VAD/CNG.";
   RTC_DCHECK_EQ(samples_per_10ms_frame, audio.size());
-  speech_buffer_.insert(speech_buffer_.end(), audio.cbegin(), audio.cend());
+  rtp_timestamps_[num_buffered_frames_] = rtp_timestamp;
+  int16_t* const frame_dst =
+      &speech_buffer_[num_buffered_frames_ * samples_per_10ms_frame];
+  std::copy(audio.cbegin(), audio.cend(), frame_dst);
+  for (int16_t sample : audio) {
+    const int magnitude = std::abs(static_cast<int>(sample));
+    if (magnitude > buffered_max_abs_)
+      buffered_max_abs_ = magnitude;
+  }
+  ++num_buffered_frames_;
   const size_t frames_to_encode = speech_encoder_->Num10MsFramesInNextPacket();
-  if (rtp_timestamps_.size() < frames_to_encode) {
+  if (num_buffered_frames_ < frames_to_encode) {
     return EncodedInfo();
   }
   RTC_CHECK_LE(frames_to_encode * 10, kMaxFrameSizeMs)
       << "Frame size cannot be larger than " << kMaxFrameSizeMs
       << " ms when using VAD/CNG.";
 
-  // Group several 10 ms blocks per VAD call. Call VAD once or twice using the
-  // following split sizes:
-  // 10 ms = 10 + 0 ms; 20 ms = 20 + 0 ms; 30 ms = 30 + 0 ms;
-  // 40 ms = 20 + 20 ms; 50 ms = 30 + 20 ms; 60 ms = 30 + 30 ms.
-  size_t blocks_in_first_vad_call =
-      (frames_to_encode > 3 ? 3 : frames_to_encode);
-  if (frames_to_encode == 4)
-    blocks_in_first_vad_call = 2;
-  RTC_CHECK_GE(frames_to_encode, blocks_in_first_vad_call);
-  const size_t blocks_in_second_vad_call =
-      frames_to_encode - blocks_in_first_vad_call;
-
-  // Check if all of the buffer is passive speech. Start with checking the first
-  // block.
-  Vad::Activity activity = vad_->VoiceActivity(
-      &speech_buffer_[0], samples_per_10ms_frame * blocks_in_first_vad_call,
-      SampleRateHz());
-  if (activity == Vad::kPassive && blocks_in_second_vad_call > 0) {
-    // Only check the second block if the first was passive.
+  Vad::Activity activity = Vad::kPassive;
+  if (last_frame_active_ || buffered_max_abs_ > kPassiveGateAmplitude) {
+    // Group several 10 ms blocks per VAD call. Call VAD once or twice using
+    // the following split sizes:
+    // 10 ms = 10 + 0 ms; 20 ms = 20 + 0 ms; 30 ms = 30 + 0 ms;
+    // 40 ms = 20 + 20 ms; 50 ms = 30 + 20 ms; 60 ms = 30 + 30 ms.
+    size_t blocks_in_first_vad_call =
+        (frames_to_encode > 3 ? 3 : frames_to_encode);
+    if (frames_to_encode == 4)
+      blocks_in_first_vad_call = 2;
+    RTC_CHECK_GE(frames_to_encode, blocks_in_first_vad_call);
+    const size_t blocks_in_second_vad_call =
+        frames_to_encode - blocks_in_first_vad_call;
+
+    // Check if all of the buffer is passive speech. Start with checking the
+    // first block.
     activity = vad_->VoiceActivity(
-        &speech_buffer_[samples_per_10ms_frame * blocks_in_first_vad_call],
-        samples_per_10ms_frame * blocks_in_second_vad_call, SampleRateHz());
+        &speech_buffer_[0], samples_per_10ms_frame * blocks_in_first_vad_call,
+        SampleRateHz());
+    if (activity == Vad::kPassive && blocks_in_second_vad_call > 0) {
+      // Only check the second block if the first was passive.
+      activity = vad_->VoiceActivity(
+          &speech_buffer_[samples_per_10ms_frame * blocks_in_first_vad_call],
+          samples_per_10ms_frame * blocks_in_second_vad_call, SampleRateHz());
+    }
   }
 
   EncodedInfo info;
@@ -177,18 +213,27 @@ AudioEncoder::EncodedInfo AudioEncoderCng::EncodeImpl(
     }
   }
 
-  speech_buffer_.erase(
-      speech_buffer_.begin(),
-      speech_buffer_.begin() + frames_to_encode * samples_per_10ms_frame);
-  rtp_timestamps_.erase(rtp_timestamps_.begin(),
-                        rtp_timestamps_.begin() + frames_to_encode);
+  // Drop the consumed blocks. The speech encoder's packet size may have
+  // shrunk below what is buffered, in which case the leftover blocks are
+  // shifted to the front.
+  const size_t remaining_frames = num_buffered_frames_ - frames_to_encode;
+  if (remaining_frames > 0) {
+    std::copy(&speech_buffer_[frames_to_encode * samples_per_10ms_frame],
+              &speech_buffer_[num_buffered_frames_ * samples_per_10ms_frame],
+              &speech_buffer_[0]);
+    std::copy(&rtp_timestamps_[frames_to_encode],
+              &rtp_timestamps_[num_buffered_frames_], &rtp_timestamps_[0]);
+  }
+  num_buffered_frames_ = remaining_frames;
+  if (remaining_frames == 0)
+    buffered_max_abs_ = 0;
   return info;
 }
 
 void AudioEncoderCng::Reset() {
   speech_encoder_->Reset();
-  speech_buffer_.clear();
-  rtp_timestamps_.clear();
+  num_buffered_frames_ = 0;
+  buffered_max_abs_ = 0;
   last_frame_active_ = true;
   vad_->Reset();
   cng_encoder_.reset(new ComfortNoiseEncoder(
@@ -261,7 +306,7 @@ AudioEncoder::EncodedInfo AudioEncoderCng::EncodePassive(
     }
   }
 
-  info.encoded_timestamp = rtp_timestamps_.front();
+  info.encoded_timestamp = rtp_timestamps_[0];
   info.payload_type = cng_payload_type_;
   info.send_even_if_empty = true;
   info.speech = false;
@@ -274,7 +319,7 @@ AudioEncoder::EncodedInfo AudioEncoderCng::EncodeActive(size_t frames_to_encode,
   AudioEncoder::EncodedInfo info;
   for (size_t i = 0; i < frames_to_encode; ++i) {
     info =
-        speech_encoder_->Encode(rtp_timestamps_.front(),
+        speech_encoder_->Encode(rtp_timestamps_[0],
                                 rtc::ArrayView<const int16_t>(
                                     &speech_buffer_[i * samples_per_10ms_frame],
                                     samples_per_10ms_frame),
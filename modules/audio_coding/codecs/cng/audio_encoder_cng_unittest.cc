@@ -254,6 +254,23 @@ TEST_F(AudioEncoderCngTest, EncodeCallsVad) {
   Encode();
 }
 
+// Verifies that once a passive run has started, all-silent frames are
+// classified without consulting the VAD.
+TEST_F(AudioEncoderCngTest, SilentFramesSkipVadDuringPassiveRun) {
+  EXPECT_CALL(*mock_encoder_, Num10MsFramesInNextPacket())
+      .WillRepeatedly(Return(1U));
+  CreateCng(MakeCngConfig());
+  EXPECT_CALL(*mock_vad_, VoiceActivity(_, _, _))
+      .WillOnce(Return(Vad::kPassive));
+  Encode();
+  // |audio_| is all zeros, so the energy gate takes over from here.
+  EXPECT_CALL(*mock_vad_, VoiceActivity(_, _, _)).Times(0);
+  for (int i = 0; i < 5; ++i) {
+    Encode();
+    EXPECT_FALSE(encoded_info_.speech);
+  }
+}
+
 TEST_F(AudioEncoderCngTest, EncodeCollects1BlockPassiveSpeech) {
   CheckBlockGrouping(1, false);
 }
@@ -389,9 +406,11 @@ TEST_F(AudioEncoderCngTest, VerifySidFrameAfterSpeech) {
   CreateCng(std::move(config));
   EXPECT_CALL(*mock_encoder_, Num10MsFramesInNextPacket())
       .WillRepeatedly(Return(1U));
-  // Start with encoding noise.
+  // Start with encoding noise. The VAD is only consulted for the first
+  // frame; the second, all-silent frame is short-circuited to passive by the
+  // energy gate.
   EXPECT_CALL(*mock_vad_, VoiceActivity(_, _, _))
-      .Times(2)
+      .Times(1)
       .WillRepeatedly(Return(Vad::kPassive));
   Encode();
   EXPECT_EQ(kCngPayloadType, encoded_info_.payload_type);
@@ -59,26 +59,29 @@ AudioEncoder::EncodedInfo AudioEncoderCopyRed::EncodeImpl(
     uint32_t rtp_timestamp,
     rtc::ArrayView<const int16_t> audio,
     rtc::Buffer* encoded) {
-  const size_t primary_offset = encoded->size();
-  EncodedInfo info = speech_encoder_->Encode(rtp_timestamp, audio, encoded);
+  primary_encoded_.Clear();
+  EncodedInfo info =
+      speech_encoder_->Encode(rtp_timestamp, audio, &primary_encoded_);
 
   RTC_CHECK(info.redundant.empty()) << "Cannot use nested redundant encoders.";
-  RTC_DCHECK_EQ(encoded->size() - primary_offset, info.encoded_bytes);
+  RTC_DCHECK_EQ(primary_encoded_.size(), info.encoded_bytes);
 
   if (info.encoded_bytes > 0) {
     // |info| will be implicitly cast to an EncodedInfoLeaf struct, effectively
     // discarding the (empty) vector of redundant information. This is
     // intentional.
+    info.redundant.reserve(2);
     info.redundant.push_back(info);
     RTC_DCHECK_EQ(info.redundant.size(), 1);
+    encoded->AppendData(primary_encoded_);
     if (secondary_info_.encoded_bytes > 0) {
       encoded->AppendData(secondary_encoded_);
       info.redundant.push_back(secondary_info_);
       RTC_DCHECK_EQ(info.redundant.size(), 2);
     }
-    // Save primary to secondary.
-    secondary_encoded_.SetData(encoded->data() + primary_offset,
-                               info.encoded_bytes);
+    // Save primary to secondary by swapping buffers; this frame's payload
+    // becomes the next frame's redundancy without copying.
+    std::swap(primary_encoded_, secondary_encoded_);
     secondary_info_ = info;
     RTC_DCHECK_EQ(info.speech, info.redundant[0].speech);
   }
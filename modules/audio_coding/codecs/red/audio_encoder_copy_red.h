@@ -73,6 +73,11 @@ class AudioEncoderCopyRed final : public AudioEncoder {
  private:
   std::unique_ptr<AudioEncoder> speech_encoder_;
   int red_payload_type_;
+  // Scratch buffer the speech encoder encodes into; swapped into
+  // |secondary_encoded_| after each frame so the primary payload becomes next
+  // frame's redundancy without a copy. Capacities are reused, so the encode
+  // path is allocation-free in steady state.
+  rtc::Buffer primary_encoded_;
   rtc::Buffer secondary_encoded_;
   EncodedInfoLeaf secondary_info_;
   RTC_DISALLOW_COPY_AND_ASSIGN(AudioEncoderCopyRed);
@@ -27,7 +27,8 @@ AudioVector::AudioVector(size_t initial_size)
     : array_(new int16_t[initial_size + 1]),
       capacity_(initial_size + 1),
       begin_index_(0),
-      end_index_(capacity_ - 1) {
+      end_index_(capacity_ - 1),
+      move_scratch_capacity_(0) {
   memset(array_.get(), 0, capacity_ * sizeof(int16_t));
 }
 
@@ -51,7 +52,7 @@ void AudioVector::CopyTo(size_t length,
   if (length == 0)
     return;
   length = std::min(length, Size() - position);
-  const size_t copy_index = (begin_index_ + position) % capacity_;
+  const size_t copy_index = WrapAround(begin_index_ + position, capacity_);
   const size_t first_chunk_length = std::min(length, capacity_ - copy_index);
   memcpy(copy_to, &array_[copy_index], first_chunk_length * sizeof(int16_t));
   const size_t remaining_length = length - first_chunk_length;
@@ -92,7 +93,7 @@ void AudioVector::PushFront(const int16_t* prepend_this, size_t length) {
     memcpy(&array_[capacity_ - remaining_length], prepend_this,
            remaining_length * sizeof(int16_t));
   }
-  begin_index_ = (begin_index_ + capacity_ - length) % capacity_;
+  begin_index_ = WrapAround(begin_index_ + capacity_ - length, capacity_);
 }
 
 void AudioVector::PushBack(const AudioVector& append_this) {
@@ -113,7 +114,7 @@ void AudioVector::PushBack(const AudioVector& append_this,
   Reserve(Size() + length);
 
   const size_t start_index =
-      (append_this.begin_index_ + position) % append_this.capacity_;
+      WrapAround(append_this.begin_index_ + position, append_this.capacity_);
   const size_t first_chunk_length =
       std::min(length, append_this.capacity_ - start_index);
   PushBack(&append_this.array_[start_index], first_chunk_length);
@@ -135,14 +136,14 @@ void AudioVector::PushBack(const int16_t* append_this, size_t length) {
     memcpy(array_.get(), &append_this[first_chunk_length],
            remaining_length * sizeof(int16_t));
   }
-  end_index_ = (end_index_ + length) % capacity_;
+  end_index_ = WrapAround(end_index_ + length, capacity_);
 }
 
 void AudioVector::PopFront(size_t length) {
   if (length == 0)
     return;
   length = std::min(length, Size());
-  begin_index_ = (begin_index_ + length) % capacity_;
+  begin_index_ = WrapAround(begin_index_ + length, capacity_);
 }
 
 void AudioVector::PopBack(size_t length) {
@@ -150,7 +151,7 @@ void AudioVector::PopBack(size_t length) {
     return;
   // Never remove more than what is in the array.
   length = std::min(length, Size());
-  end_index_ = (end_index_ + capacity_ - length) % capacity_;
+  end_index_ = WrapAround(end_index_ + capacity_ - length, capacity_);
 }
 
 void AudioVector::Extend(size_t extra_length) {
@@ -230,7 +231,7 @@ void AudioVector::OverwriteAt(const int16_t* insert_this,
   size_t new_size = std::max(Size(), position + length);
   Reserve(new_size);
 
-  const size_t overwrite_index = (begin_index_ + position) % capacity_;
+  const size_t overwrite_index = WrapAround(begin_index_ + position, capacity_);
   const size_t first_chunk_length =
       std::min(length, capacity_ - overwrite_index);
   memcpy(&array_[overwrite_index], insert_this,
@@ -241,7 +242,7 @@ void AudioVector::OverwriteAt(const int16_t* insert_this,
            remaining_length * sizeof(int16_t));
   }
 
-  end_index_ = (begin_index_ + new_size) % capacity_;
+  end_index_ = WrapAround(begin_index_ + new_size, capacity_);
 }
 
 void AudioVector::CrossFade(const AudioVector& append_this,
@@ -251,7 +252,9 @@ void AudioVector::CrossFade(const AudioVector& append_this,
   assert(fade_length <= append_this.Size());
   fade_length = std::min(fade_length, Size());
   fade_length = std::min(fade_length, append_this.Size());
-  size_t position = Size() - fade_length + begin_index_;
+  // Index of the first sample in the overlap region, advanced incrementally
+  // in the loop below to avoid a modulo operation per sample.
+  size_t ix = WrapAround(Size() - fade_length + begin_index_, capacity_);
   // Cross fade the overlapping regions.
   // |alpha| is the mixing factor in Q14.
   // TODO(hlundin): Consider skipping +1 in the denominator to produce a
@@ -260,10 +263,9 @@ void AudioVector::CrossFade(const AudioVector& append_this,
   int alpha = 16384;
   for (size_t i = 0; i < fade_length; ++i) {
     alpha -= alpha_step;
-    array_[(position + i) % capacity_] =
-        (alpha * array_[(position + i) % capacity_] +
-         (16384 - alpha) * append_this[i] + 8192) >>
-        14;
+    array_[ix] =
+        (alpha * array_[ix] + (16384 - alpha) * append_this[i] + 8192) >> 14;
+    ix = WrapAround(ix + 1, capacity_);
   }
   assert(alpha >= 0);  // Verify that the slope was correct.
   // Append what is left of |append_this|.
@@ -274,7 +276,7 @@ void AudioVector::CrossFade(const AudioVector& append_this,
 
 // Returns the number of elements in this AudioVector.
 size_t AudioVector::Size() const {
-  return (end_index_ + capacity_ - begin_index_) % capacity_;
+  return WrapAround(end_index_ + capacity_ - begin_index_, capacity_);
 }
 
 // Returns true if this AudioVector is empty.
@@ -298,47 +300,55 @@ void AudioVector::Reserve(size_t n) {
   capacity_ = n + 1;
 }
 
+int16_t* AudioVector::MoveScratch(size_t length) {
+  if (move_scratch_capacity_ < length) {
+    move_scratch_.reset(new int16_t[length]);
+    move_scratch_capacity_ = length;
+  }
+  return move_scratch_.get();
+}
+
 void AudioVector::InsertByPushBack(const int16_t* insert_this,
                                    size_t length,
                                    size_t position) {
   const size_t move_chunk_length = Size() - position;
-  std::unique_ptr<int16_t[]> temp_array(nullptr);
+  int16_t* temp_array = nullptr;
   if (move_chunk_length > 0) {
     // TODO(minyue): see if it is possible to avoid copying to a buffer.
-    temp_array.reset(new int16_t[move_chunk_length]);
-    CopyTo(move_chunk_length, position, temp_array.get());
+    temp_array = MoveScratch(move_chunk_length);
+    CopyTo(move_chunk_length, position, temp_array);
     PopBack(move_chunk_length);
   }
 
   Reserve(Size() + length + move_chunk_length);
   PushBack(insert_this, length);
   if (move_chunk_length > 0)
-    PushBack(temp_array.get(), move_chunk_length);
+    PushBack(temp_array, move_chunk_length);
 }
 
 void AudioVector::InsertByPushFront(const int16_t* insert_this,
                                     size_t length,
                                     size_t position) {
-  std::unique_ptr<int16_t[]> temp_array(nullptr);
+  int16_t* temp_array = nullptr;
   if (position > 0) {
     // TODO(minyue): see if it is possible to avoid copying to a buffer.
-    temp_array.reset(new int16_t[position]);
-    CopyTo(position, 0, temp_array.get());
+    temp_array = MoveScratch(position);
+    CopyTo(position, 0, temp_array);
     PopFront(position);
   }
 
   Reserve(Size() + length + position);
   PushFront(insert_this, length);
   if (position > 0)
-    PushFront(temp_array.get(), position);
+    PushFront(temp_array, position);
 }
 
 void AudioVector::InsertZerosByPushBack(size_t length, size_t position) {
   const size_t move_chunk_length = Size() - position;
-  std::unique_ptr<int16_t[]> temp_array(nullptr);
+  int16_t* temp_array = nullptr;
   if (move_chunk_length > 0) {
-    temp_array.reset(new int16_t[move_chunk_length]);
-    CopyTo(move_chunk_length, position, temp_array.get());
+    temp_array = MoveScratch(move_chunk_length);
+    CopyTo(move_chunk_length, position, temp_array);
     PopBack(move_chunk_length);
   }
 
@@ -350,17 +360,17 @@ void AudioVector::InsertZerosByPushBack(size_t length, size_t position) {
   const size_t remaining_zero_length = length - first_zero_chunk_length;
   if (remaining_zero_length > 0)
     memset(array_.get(), 0, remaining_zero_length * sizeof(int16_t));
-  end_index_ = (end_index_ + length) % capacity_;
+  end_index_ = WrapAround(end_index_ + length, capacity_);
 
   if (move_chunk_length > 0)
-    PushBack(temp_array.get(), move_chunk_length);
+    PushBack(temp_array, move_chunk_length);
 }
 
 void AudioVector::InsertZerosByPushFront(size_t length, size_t position) {
-  std::unique_ptr<int16_t[]> temp_array(nullptr);
+  int16_t* temp_array = nullptr;
   if (position > 0) {
-    temp_array.reset(new int16_t[position]);
-    CopyTo(position, 0, temp_array.get());
+    temp_array = MoveScratch(position);
+    CopyTo(position, 0, temp_array);
     PopFront(position);
   }
 
@@ -373,10 +383,10 @@ void AudioVector::InsertZerosByPushFront(size_t length, size_t position) {
   if (remaining_zero_length > 0)
     memset(&array_[capacity_ - remaining_zero_length], 0,
            remaining_zero_length * sizeof(int16_t));
-  begin_index_ = (begin_index_ + capacity_ - length) % capacity_;
+  begin_index_ = WrapAround(begin_index_ + capacity_ - length, capacity_);
 
   if (position > 0)
-    PushFront(temp_array.get(), position);
+    PushFront(temp_array, position);
 }
 
 }  // namespace webrtc
@@ -140,8 +140,26 @@ class AudioVector {
     return ix;
   }
 
+  // Wraps |ix|, which must be smaller than 2 * |capacity|, into the range
+  // [0, capacity). Replaces the modulo operation for index arithmetic where
+  // the operands are known to be less than one full wrap apart, avoiding an
+  // integer division per call.
+  static inline size_t WrapAround(size_t ix, size_t capacity) {
+    RTC_DCHECK_LT(ix, 2 * capacity);
+    if (ix >= capacity) {
+      ix -= capacity;
+    }
+    return ix;
+  }
+
   void Reserve(size_t n);
 
+  // Returns a scratch buffer with room for at least |length| samples, growing
+  // it if needed. Used by the insert operations to stage the chunk of samples
+  // that has to move out of the way, instead of allocating a fresh temporary
+  // array on every insert.
+  int16_t* MoveScratch(size_t length);
+
   void InsertByPushBack(const int16_t* insert_this,
                         size_t length,
                         size_t position);
@@ -165,6 +183,10 @@ class AudioVector {
   // The index of the sample after the last sample in |array_|.
   size_t end_index_;
 
+  // Reused staging area for the insert operations; see MoveScratch().
+  std::unique_ptr<int16_t[]> move_scratch_;
+  size_t move_scratch_capacity_;
+
   RTC_DISALLOW_COPY_AND_ASSIGN(AudioVector);
 };
 
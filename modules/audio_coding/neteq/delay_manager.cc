@@ -20,6 +20,7 @@
 #include <string>
 
 #include "modules/audio_coding/neteq/histogram.h"
+#include "modules/audio_coding/neteq/p2_quantile_histogram.h"
 #include "modules/include/module_common_types_public.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
@@ -118,8 +119,15 @@ std::unique_ptr<DelayManager> DelayManager::Create(
     const TickTimer* tick_timer) {
   DelayHistogramConfig config = GetDelayHistogramConfig();
   const int quantile = config.quantile;
-  std::unique_ptr<Histogram> histogram = std::make_unique<Histogram>(
-      kDelayBuckets, config.forget_factor, config.start_forget_weight);
+  std::unique_ptr<Histogram> histogram;
+  if (field_trial::IsEnabled("WebRTC-Audio-NetEqDelayQuantileSketch")) {
+    // Constant-time quantile estimator; see P2QuantileHistogram.
+    histogram = std::make_unique<P2QuantileHistogram>(kDelayBuckets, quantile,
+                                                      config.forget_factor);
+  } else {
+    histogram = std::make_unique<Histogram>(kDelayBuckets, config.forget_factor,
+                                            config.start_forget_weight);
+  }
   return std::make_unique<DelayManager>(
       max_packets_in_buffer, base_minimum_delay_ms, quantile,
       enable_rtx_handling, tick_timer, std::move(histogram));
@@ -16,6 +16,13 @@
 #include <algorithm>  // Access to min, max.
 
 #include "common_audio/signal_processing/include/signal_processing_library.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#elif defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
 
 namespace webrtc {
 
@@ -279,7 +286,74 @@ void DspHelper::CrossFade(const int16_t* input1,
                           int16_t* output) {
   int16_t factor = *mix_factor;
   int16_t complement_factor = 16384 - factor;
-  for (size_t i = 0; i < length; i++) {
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  // Process eight samples at a time. Interleaving each sample of |input1|
+  // with the corresponding sample of |input2|, and each mix factor with its
+  // complement, turns the scale-and-add into one multiply-add per pair.
+  __m128i factors = _mm_setr_epi16(
+      factor, static_cast<int16_t>(factor - factor_decrement),
+      static_cast<int16_t>(factor - 2 * factor_decrement),
+      static_cast<int16_t>(factor - 3 * factor_decrement),
+      static_cast<int16_t>(factor - 4 * factor_decrement),
+      static_cast<int16_t>(factor - 5 * factor_decrement),
+      static_cast<int16_t>(factor - 6 * factor_decrement),
+      static_cast<int16_t>(factor - 7 * factor_decrement));
+  __m128i complements = _mm_sub_epi16(_mm_set1_epi16(16384), factors);
+  const __m128i step =
+      _mm_set1_epi16(static_cast<int16_t>(8 * factor_decrement));
+  const __m128i round = _mm_set1_epi32(8192);
+  for (; i + 8 <= length; i += 8) {
+    const __m128i in1 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input1[i]));
+    const __m128i in2 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input2[i]));
+    __m128i out_lo = _mm_srai_epi32(
+        _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(in1, in2),
+                                     _mm_unpacklo_epi16(factors, complements)),
+                      round),
+        14);
+    __m128i out_hi = _mm_srai_epi32(
+        _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(in1, in2),
+                                     _mm_unpackhi_epi16(factors, complements)),
+                      round),
+        14);
+    // Narrow by truncation, matching the int16_t conversion in the scalar
+    // loop below.
+    out_lo = _mm_srai_epi32(_mm_slli_epi32(out_lo, 16), 16);
+    out_hi = _mm_srai_epi32(_mm_slli_epi32(out_hi, 16), 16);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&output[i]),
+                     _mm_packs_epi32(out_lo, out_hi));
+    factors = _mm_sub_epi16(factors, step);
+    complements = _mm_add_epi16(complements, step);
+  }
+  factor = static_cast<int16_t>(*mix_factor -
+                                static_cast<int>(i) * factor_decrement);
+  complement_factor = static_cast<int16_t>(16384 - factor);
+#elif defined(WEBRTC_HAS_NEON)
+  // Process four samples at a time, with the mix factors and their
+  // complements kept in vector lanes.
+  const int16_t kLaneSteps[4] = {0, 1, 2, 3};
+  int16x4_t factors = vsub_s16(vdup_n_s16(factor),
+                               vmul_n_s16(vld1_s16(kLaneSteps),
+                                          factor_decrement));
+  int16x4_t complements = vsub_s16(vdup_n_s16(16384), factors);
+  const int16x4_t step = vdup_n_s16(static_cast<int16_t>(4 * factor_decrement));
+  for (; i + 4 <= length; i += 4) {
+    int32x4_t acc = vdupq_n_s32(8192);
+    acc = vmlal_s16(acc, vld1_s16(&input1[i]), factors);
+    acc = vmlal_s16(acc, vld1_s16(&input2[i]), complements);
+    // Narrow by truncation, matching the int16_t conversion in the scalar
+    // loop below.
+    vst1_s16(&output[i], vshrn_n_s32(acc, 14));
+    factors = vsub_s16(factors, step);
+    complements = vadd_s16(complements, step);
+  }
+  factor = static_cast<int16_t>(*mix_factor -
+                                static_cast<int>(i) * factor_decrement);
+  complement_factor = static_cast<int16_t>(16384 - factor);
+#endif
+  for (; i < length; i++) {
     output[i] =
         (factor * input1[i] + complement_factor * input2[i] + 8192) >> 14;
     factor -= factor_decrement;
@@ -305,7 +379,61 @@ void DspHelper::UnmuteSignal(const int16_t* input,
 
 void DspHelper::MuteSignal(int16_t* signal, int mute_slope, size_t length) {
   int32_t factor = (16384 << 6) + 32;
-  for (size_t i = 0; i < length; i++) {
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY) || defined(WEBRTC_HAS_NEON)
+  // The vectorized loops below pack |factor| >> 6 into 16 bits; take them
+  // only when the ramp is guaranteed to stay within the int16_t range.
+  const bool gain_fits_int16 =
+      factor - static_cast<int64_t>(mute_slope) * length >= -(32768 << 6);
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (gain_fits_int16) {
+    __m128i factors = _mm_setr_epi32(factor, factor - mute_slope,
+                                     factor - 2 * mute_slope,
+                                     factor - 3 * mute_slope);
+    const __m128i step = _mm_set1_epi32(4 * mute_slope);
+    // Pairing each sample with the constant 1, and each gain with the
+    // rounding constant, computes gain * sample + 8192 in one multiply-add.
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128i round = _mm_set1_epi16(8192);
+    for (; i + 4 <= length; i += 4) {
+      const __m128i samples =
+          _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&signal[i]));
+      const __m128i gains32 = _mm_srai_epi32(factors, 6);
+      const __m128i gains = _mm_packs_epi32(gains32, gains32);
+      __m128i out32 =
+          _mm_srai_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(samples, ones),
+                                        _mm_unpacklo_epi16(gains, round)),
+                         14);
+      // Narrow by truncation, matching the int16_t conversion in the scalar
+      // loop below.
+      out32 = _mm_srai_epi32(_mm_slli_epi32(out32, 16), 16);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(&signal[i]),
+                       _mm_packs_epi32(out32, out32));
+      factors = _mm_sub_epi32(factors, step);
+    }
+    factor -= static_cast<int>(i) * mute_slope;
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  if (gain_fits_int16) {
+    const int32_t kLaneSteps[4] = {0, 1, 2, 3};
+    int32x4_t factors = vsubq_s32(vdupq_n_s32(factor),
+                                  vmulq_n_s32(vld1q_s32(kLaneSteps),
+                                              mute_slope));
+    const int32x4_t step = vdupq_n_s32(4 * mute_slope);
+    for (; i + 4 <= length; i += 4) {
+      const int16x4_t gains = vmovn_s32(vshrq_n_s32(factors, 6));
+      const int32x4_t out32 =
+          vmlal_s16(vdupq_n_s32(8192), vld1_s16(&signal[i]), gains);
+      // Narrow by truncation, matching the int16_t conversion in the scalar
+      // loop below.
+      vst1_s16(&signal[i], vshrn_n_s32(out32, 14));
+      factors = vsubq_s32(factors, step);
+    }
+    factor -= static_cast<int>(i) * mute_slope;
+  }
+#endif
+  for (; i < length; i++) {
     signal[i] = ((factor >> 6) * signal[i] + 8192) >> 14;
     factor -= mute_slope;
   }
@@ -85,4 +85,57 @@ TEST(DspHelper, RampSignalAudioMultiVector) {
     }
   }
 }
+
+TEST(DspHelper, CrossFade) {
+  // Use an odd length to exercise both the vectorized part of the loop and
+  // the scalar tail.
+  static const int kLen = 101;
+  int16_t input1[kLen];
+  int16_t input2[kLen];
+  int16_t output[kLen];
+  for (int i = 0; i < kLen; ++i) {
+    input1[i] = static_cast<int16_t>(100 * i - 5000);
+    input2[i] = static_cast<int16_t>(3000 - 31 * i);
+  }
+  int16_t mix_factor = 16384;
+  const int16_t factor_decrement = 16384 / kLen;
+
+  DspHelper::CrossFade(input1, input2, kLen, &mix_factor, factor_decrement,
+                       output);
+
+  // Verify against the scalar reference computation.
+  int16_t factor = 16384;
+  int16_t complement_factor = 0;
+  for (int i = 0; i < kLen; ++i) {
+    EXPECT_EQ(
+        (factor * input1[i] + complement_factor * input2[i] + 8192) >> 14,
+        output[i]);
+    factor -= factor_decrement;
+    complement_factor += factor_decrement;
+  }
+  EXPECT_EQ(factor, mix_factor);
+}
+
+TEST(DspHelper, MuteSignal) {
+  // Use an odd length to exercise both the vectorized part of the loop and
+  // the scalar tail.
+  static const int kLen = 101;
+  int16_t signal[kLen];
+  int16_t reference[kLen];
+  for (int i = 0; i < kLen; ++i) {
+    signal[i] = static_cast<int16_t>(300 * i - 15000);
+    reference[i] = signal[i];
+  }
+  // Ramp from 1 to 0 (in Q14) over the array; |mute_slope| is in Q20.
+  const int mute_slope = (16384 << 6) / kLen;
+
+  DspHelper::MuteSignal(signal, mute_slope, kLen);
+
+  // Verify against the scalar reference computation.
+  int32_t factor = (16384 << 6) + 32;
+  for (int i = 0; i < kLen; ++i) {
+    EXPECT_EQ(((factor >> 6) * reference[i] + 8192) >> 14, signal[i]);
+    factor -= mute_slope;
+  }
+}
 }  // namespace webrtc
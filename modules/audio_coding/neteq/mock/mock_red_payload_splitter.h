@@ -18,7 +18,10 @@ namespace webrtc {
 
 class MockRedPayloadSplitter : public RedPayloadSplitter {
  public:
-  MOCK_METHOD(bool, SplitRed, (PacketList * packet_list), (override));
+  MOCK_METHOD(bool,
+              SplitRed,
+              (PacketList * packet_list, PacketPool* pool),
+              (override));
   MOCK_METHOD(void,
               CheckRedPayloads,
               (PacketList * packet_list,
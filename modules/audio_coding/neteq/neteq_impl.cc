@@ -37,6 +37,7 @@
 #include "modules/audio_coding/neteq/normal.h"
 #include "modules/audio_coding/neteq/packet.h"
 #include "modules/audio_coding/neteq/packet_buffer.h"
+#include "modules/audio_coding/neteq/packet_pool.h"
 #include "modules/audio_coding/neteq/post_decode_vad.h"
 #include "modules/audio_coding/neteq/preemptive_expand.h"
 #include "modules/audio_coding/neteq/red_payload_splitter.h"
@@ -50,6 +51,7 @@
 #include "rtc_base/sanitizer.h"
 #include "rtc_base/strings/audio_format_to_string.h"
 #include "rtc_base/trace_event.h"
+#include "system_wrappers/include/audio_pipeline_tap.h"
 #include "system_wrappers/include/clock.h"
 
 namespace webrtc {
@@ -171,6 +173,7 @@ int NetEqImpl::InsertPacket(const RTPHeader& rtp_header,
                             rtc::ArrayView<const uint8_t> payload) {
   rtc::MsanCheckInitialized(payload);
   TRACE_EVENT0("webrtc", "NetEqImpl::InsertPacket");
+  audio_pipeline_tap::Record(audio_pipeline_tap::Stage::kNetEqInsert);
   rtc::CritScope lock(&crit_sect_);
   if (InsertPacketInternal(rtp_header, payload) != 0) {
     return kFail;
@@ -255,6 +258,7 @@ int NetEqImpl::GetAudio(AudioFrame* audio_frame,
              last_output_sample_rate_hz_ == 32000 ||
              last_output_sample_rate_hz_ == 48000)
       << "Unexpected sample rate " << last_output_sample_rate_hz_;
+  audio_pipeline_tap::Record(audio_pipeline_tap::Stage::kNetEqGetAudio);
   return kOK;
 }
 
@@ -493,11 +497,13 @@ int NetEqImpl::InsertPacketInternal(const RTPHeader& rtp_header,
   int64_t receive_time_ms = clock_->TimeInMilliseconds();
   stats_->ReceivedPacket();
 
+  PacketPool* const packet_pool = packet_buffer_->packet_pool();
   PacketList packet_list;
-  // Insert packet in a packet list.
-  packet_list.push_back([&rtp_header, &payload, &receive_time_ms] {
-    // Convert to Packet.
-    Packet packet;
+  {
+    // Convert to Packet, reusing pooled storage to avoid allocating a list
+    // node and a payload buffer for every received packet.
+    Packet& packet = packet_pool->AcquireInsert(&packet_list,
+                                                packet_list.end());
     packet.payload_type = rtp_header.payloadType;
     packet.sequence_number = rtp_header.sequenceNumber;
     packet.timestamp = rtp_header.timestamp;
@@ -505,8 +511,7 @@ int NetEqImpl::InsertPacketInternal(const RTPHeader& rtp_header,
     packet.packet_info = RtpPacketInfo(rtp_header, receive_time_ms);
     // Waiting time will be set upon inserting the packet in the buffer.
     RTC_DCHECK(!packet.waiting_time);
-    return packet;
-  }());
+  }
 
   bool update_sample_rate_and_channels = first_packet_;
 
@@ -553,7 +558,7 @@ int NetEqImpl::InsertPacketInternal(const RTPHeader& rtp_header,
 
   // Check for RED payload type, and separate payloads into several packets.
   if (decoder_database_->IsRed(rtp_header.payloadType)) {
-    if (!red_payload_splitter_->SplitRed(&packet_list)) {
+    if (!red_payload_splitter_->SplitRed(&packet_list, packet_pool)) {
       return kRedundancySplitError;
     }
     // Only accept a few RED payloads of the same type as the main data,
@@ -598,7 +603,7 @@ int NetEqImpl::InsertPacketInternal(const RTPHeader& rtp_header,
       if (dtmf_buffer_->InsertEvent(event) != DtmfBuffer::kOK) {
         return kDtmfInsertError;
       }
-      it = packet_list.erase(it);
+      it = packet_pool->Recycle(&packet_list, it);
     } else {
       ++it;
     }
@@ -639,7 +644,7 @@ int NetEqImpl::InsertPacketInternal(const RTPHeader& rtp_header,
           info->GetDecoder()->ParsePayload(std::move(packet.payload),
                                            packet.timestamp);
       if (results.empty()) {
-        packet_list.pop_front();
+        packet_pool->Recycle(&packet_list, packet_list.begin());
       } else {
         bool first = true;
         for (auto& result : results) {
@@ -652,7 +657,9 @@ int NetEqImpl::InsertPacketInternal(const RTPHeader& rtp_header,
                                       packet_list.begin());
             first = false;
           } else {
-            parsed_packet_list.push_back(packet_from_result(result));
+            packet_pool->AcquireInsert(&parsed_packet_list,
+                                       parsed_packet_list.end()) =
+                packet_from_result(result);
           }
         }
       }
@@ -1310,7 +1317,7 @@ int NetEqImpl::Decode(PacketList* packet_list,
       if (!decoder) {
         RTC_LOG(LS_WARNING)
             << "Unknown payload type " << static_cast<int>(payload_type);
-        packet_list->clear();
+        packet_buffer_->packet_pool()->Recycle(packet_list);
         return kDecoderNotFound;
       }
       bool decoder_changed;
@@ -1323,7 +1330,7 @@ int NetEqImpl::Decode(PacketList* packet_list,
         if (!decoder_info) {
           RTC_LOG(LS_WARNING)
               << "Unknown payload type " << static_cast<int>(payload_type);
-          packet_list->clear();
+          packet_buffer_->packet_pool()->Recycle(packet_list);
           return kDecoderNotFound;
         }
         // If sampling rate or number of channels has changed, we need to make
@@ -1458,7 +1465,7 @@ int NetEqImpl::DecodeLoop(PacketList* packet_list,
     last_decoded_timestamps_.push_back(packet_list->front().timestamp);
     last_decoded_packet_infos_.push_back(
         std::move(packet_list->front().packet_info));
-    packet_list->pop_front();
+    packet_buffer_->packet_pool()->Recycle(packet_list, packet_list->begin());
     if (opt_result) {
       const auto& result = *opt_result;
       *speech_type = result.speech_type;
@@ -1474,13 +1481,13 @@ int NetEqImpl::DecodeLoop(PacketList* packet_list,
       RTC_LOG(LS_WARNING) << "Decode error";
       *decoded_length = -1;
       last_decoded_packet_infos_.clear();
-      packet_list->clear();
+      packet_buffer_->packet_pool()->Recycle(packet_list);
       break;
     }
     if (*decoded_length > rtc::dchecked_cast<int>(decoded_buffer_length_)) {
       // Guard against overflow.
       RTC_LOG(LS_WARNING) << "Decoded too much.";
-      packet_list->clear();
+      packet_buffer_->packet_pool()->Recycle(packet_list);
       return kDecodedTooMuch;
     }
   }  // End of decode loop.
@@ -1991,7 +1998,10 @@ int NetEqImpl::ExtractPackets(size_t required_samples,
     stats_->JitterBufferDelay(packet_duration, waiting_time_ms,
                               controller_->TargetLevelMs());
 
-    packet_list->push_back(std::move(*packet));  // Store packet in list.
+    // Store packet in list, reusing a pooled node if available.
+    packet_buffer_->packet_pool()->AcquireInsert(packet_list,
+                                                 packet_list->end()) =
+        std::move(*packet);
     packet = absl::nullopt;  // Ensure it's never used after the move.
 
     // Check what packet is available next.
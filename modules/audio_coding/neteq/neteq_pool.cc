@@ -0,0 +1,113 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/neteq_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <utility>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/task_utils/to_queued_task.h"
+
+namespace webrtc {
+
+NetEqPool::NetEqPool(size_t num_worker_queues,
+                     TaskQueueFactory* task_queue_factory) {
+  RTC_DCHECK(num_worker_queues == 0 || task_queue_factory);
+  workers_.reserve(num_worker_queues);
+  for (size_t i = 0; i < num_worker_queues; ++i) {
+    rtc::StringBuilder name;
+    name << "NetEqPoolWorker" << i;
+    workers_.push_back(task_queue_factory->CreateTaskQueue(
+        name.str(), TaskQueueFactory::Priority::NORMAL));
+  }
+}
+
+NetEqPool::~NetEqPool() = default;
+
+void NetEqPool::RegisterInstance(NetEq* neteq) {
+  RTC_DCHECK(neteq);
+  RTC_DCHECK(std::find(instances_.begin(), instances_.end(), neteq) ==
+             instances_.end());
+  instances_.push_back(neteq);
+}
+
+void NetEqPool::UnregisterInstance(NetEq* neteq) {
+  auto it = std::find(instances_.begin(), instances_.end(), neteq);
+  RTC_DCHECK(it != instances_.end());
+  instances_.erase(it);
+}
+
+bool NetEqPool::GetAudio(rtc::ArrayView<AudioFrame* const> audio_frames,
+                         rtc::ArrayView<bool> muted) {
+  RTC_DCHECK_EQ(audio_frames.size(), instances_.size());
+  RTC_DCHECK_EQ(muted.size(), instances_.size());
+  if (instances_.empty()) {
+    return true;
+  }
+  if (workers_.empty()) {
+    return GetAudioRange(0, instances_.size(), audio_frames, muted);
+  }
+
+  // Partition the instances into contiguous slices, one per worker plus one
+  // for the calling thread. The slices are disjoint, so the workers write to
+  // their parts of |audio_frames| and |muted| without synchronization.
+  const size_t num_slices =
+      std::min(workers_.size() + 1, instances_.size());
+  const size_t slice_size = instances_.size() / num_slices;
+  const size_t remainder = instances_.size() % num_slices;
+
+  std::atomic<size_t> pending_workers(num_slices - 1);
+  std::atomic<bool> workers_ok(true);
+  rtc::Event done;
+  size_t begin = slice_size + (remainder > 0 ? 1 : 0);
+  for (size_t slice = 1; slice < num_slices; ++slice) {
+    const size_t end = begin + slice_size + (slice < remainder ? 1 : 0);
+    workers_[slice - 1]->PostTask(ToQueuedTask([this, begin, end, audio_frames,
+                                                muted, &pending_workers,
+                                                &workers_ok, &done] {
+      if (!GetAudioRange(begin, end, audio_frames, muted)) {
+        workers_ok = false;
+      }
+      if (pending_workers.fetch_sub(1) == 1) {
+        done.Set();
+      }
+    }));
+    begin = end;
+  }
+  RTC_DCHECK_EQ(begin, instances_.size());
+
+  // Advance the first slice on the calling thread, then wait for the
+  // workers to finish theirs.
+  const bool caller_ok =
+      GetAudioRange(0, slice_size + (remainder > 0 ? 1 : 0), audio_frames,
+                    muted);
+  done.Wait(rtc::Event::kForever);
+  return caller_ok && workers_ok;
+}
+
+bool NetEqPool::GetAudioRange(size_t begin,
+                              size_t end,
+                              rtc::ArrayView<AudioFrame* const> audio_frames,
+                              rtc::ArrayView<bool> muted) {
+  bool ok = true;
+  for (size_t i = begin; i < end; ++i) {
+    if (instances_[i]->GetAudio(audio_frames[i], &muted[i]) != NetEq::kOK) {
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+}  // namespace webrtc
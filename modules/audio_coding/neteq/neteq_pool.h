@@ -0,0 +1,71 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_NETEQ_NETEQ_POOL_H_
+#define MODULES_AUDIO_CODING_NETEQ_NETEQ_POOL_H_
+
+#include <memory>
+#include <vector>
+
+#include "api/array_view.h"
+#include "api/audio/audio_frame.h"
+#include "api/neteq/neteq.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
+#include "rtc_base/constructor_magic.h"
+
+namespace webrtc {
+
+// Facade that advances many NetEq instances on one shared 10 ms tick,
+// instead of each receive stream driving its own instance from its own
+// timer. The instances are stored contiguously and advanced in registration
+// order, so that servers hosting many streams pay for one scheduling event
+// per tick rather than one per stream. Optionally, the instances are
+// advanced in parallel on a set of worker task queues.
+//
+// The pool does not own the registered instances, and all methods must be
+// called on the same thread.
+class NetEqPool {
+ public:
+  // |num_worker_queues| task queues are created with |task_queue_factory|
+  // and used to advance the instances in parallel; with 0 workers all
+  // instances are advanced on the calling thread, and |task_queue_factory|
+  // may be null.
+  NetEqPool(size_t num_worker_queues, TaskQueueFactory* task_queue_factory);
+  ~NetEqPool();
+
+  // Registers |neteq|, which must stay alive until it is unregistered or the
+  // pool is destroyed.
+  void RegisterInstance(NetEq* neteq);
+  void UnregisterInstance(NetEq* neteq);
+  size_t NumInstances() const { return instances_.size(); }
+
+  // Advances every registered instance by one 10 ms tick. The output of the
+  // k-th registered instance is written to |audio_frames[k]| and |muted[k]|;
+  // both views must have NumInstances() elements. Returns true if every
+  // instance returned NetEq::kOK.
+  bool GetAudio(rtc::ArrayView<AudioFrame* const> audio_frames,
+                rtc::ArrayView<bool> muted);
+
+ private:
+  // Advances the instances with indices in [begin, end).
+  bool GetAudioRange(size_t begin,
+                     size_t end,
+                     rtc::ArrayView<AudioFrame* const> audio_frames,
+                     rtc::ArrayView<bool> muted);
+
+  std::vector<NetEq*> instances_;
+  std::vector<std::unique_ptr<TaskQueueBase, TaskQueueDeleter>> workers_;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(NetEqPool);
+};
+
+}  // namespace webrtc
+#endif  // MODULES_AUDIO_CODING_NETEQ_NETEQ_POOL_H_
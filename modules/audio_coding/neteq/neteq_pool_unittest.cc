@@ -0,0 +1,142 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/neteq_pool.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "api/audio_codecs/builtin_audio_decoder_factory.h"
+#include "api/task_queue/default_task_queue_factory.h"
+#include "modules/audio_coding/codecs/pcm16b/pcm16b.h"
+#include "modules/audio_coding/neteq/default_neteq_factory.h"
+#include "system_wrappers/include/clock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kSampleRateHz = 8000;
+constexpr size_t kSamplesPerFrame = 80;  // 10 ms.
+constexpr int kPayloadType = 93;
+
+std::unique_ptr<NetEq> CreateNetEqInstance(Clock* clock) {
+  NetEq::Config config;
+  config.sample_rate_hz = kSampleRateHz;
+  std::unique_ptr<NetEq> neteq = DefaultNetEqFactory().CreateNetEq(
+      config, CreateBuiltinAudioDecoderFactory(), clock);
+  EXPECT_TRUE(neteq->RegisterPayloadType(
+      kPayloadType, SdpAudioFormat("l16", kSampleRateHz, 1)));
+  return neteq;
+}
+
+// Inserts one 10 ms PCM16b packet with a waveform that is deterministic in
+// |stream| and |frame_index|.
+void InsertPacket(NetEq* neteq, size_t stream, int frame_index) {
+  int16_t samples[kSamplesPerFrame];
+  for (size_t i = 0; i < kSamplesPerFrame; ++i) {
+    samples[i] = static_cast<int16_t>(
+        100 * static_cast<int>(stream + 1) *
+        (static_cast<int>((frame_index * kSamplesPerFrame + i) % 50) - 25));
+  }
+  uint8_t payload[sizeof(samples)];
+  const size_t payload_length =
+      WebRtcPcm16b_Encode(samples, kSamplesPerFrame, payload);
+  RTPHeader rtp_header;
+  rtp_header.payloadType = kPayloadType;
+  rtp_header.sequenceNumber = static_cast<uint16_t>(frame_index);
+  rtp_header.timestamp =
+      static_cast<uint32_t>(frame_index) * kSamplesPerFrame;
+  rtp_header.ssrc = 0x1234;
+  EXPECT_EQ(NetEq::kOK,
+            neteq->InsertPacket(rtp_header, rtc::ArrayView<const uint8_t>(
+                                                payload, payload_length)));
+}
+
+// Drives |kNumStreams| instances through a pool with |num_worker_queues|
+// workers, and verifies that each of them produces output identical to a
+// reference instance that is fed the same packets but pulled directly.
+void TestPoolAgainstReference(size_t num_worker_queues) {
+  constexpr size_t kNumStreams = 5;
+  constexpr int kNumFrames = 50;
+  SimulatedClock clock(0);
+  std::unique_ptr<TaskQueueFactory> task_queue_factory =
+      CreateDefaultTaskQueueFactory();
+  NetEqPool pool(num_worker_queues, task_queue_factory.get());
+
+  std::vector<std::unique_ptr<NetEq>> pooled;
+  std::vector<std::unique_ptr<NetEq>> reference;
+  for (size_t stream = 0; stream < kNumStreams; ++stream) {
+    pooled.push_back(CreateNetEqInstance(&clock));
+    reference.push_back(CreateNetEqInstance(&clock));
+    pool.RegisterInstance(pooled.back().get());
+  }
+  ASSERT_EQ(kNumStreams, pool.NumInstances());
+
+  std::vector<AudioFrame> frames(kNumStreams);
+  std::vector<AudioFrame*> frame_ptrs;
+  for (AudioFrame& frame : frames) {
+    frame_ptrs.push_back(&frame);
+  }
+  bool muted[kNumStreams];
+
+  for (int n = 0; n < kNumFrames; ++n) {
+    for (size_t stream = 0; stream < kNumStreams; ++stream) {
+      // Drop some packets, to also exercise expand and merge.
+      if ((n + static_cast<int>(stream)) % 7 == 3) {
+        continue;
+      }
+      InsertPacket(pooled[stream].get(), stream, n);
+      InsertPacket(reference[stream].get(), stream, n);
+    }
+    ASSERT_TRUE(pool.GetAudio(frame_ptrs, muted));
+    for (size_t stream = 0; stream < kNumStreams; ++stream) {
+      AudioFrame reference_frame;
+      bool reference_muted;
+      ASSERT_EQ(NetEq::kOK, reference[stream]->GetAudio(&reference_frame,
+                                                        &reference_muted));
+      EXPECT_EQ(reference_muted, muted[stream]);
+      EXPECT_EQ(reference_frame.sample_rate_hz_,
+                frames[stream].sample_rate_hz_);
+      ASSERT_EQ(reference_frame.samples_per_channel_,
+                frames[stream].samples_per_channel_);
+      EXPECT_EQ(0, std::memcmp(reference_frame.data(), frames[stream].data(),
+                               reference_frame.samples_per_channel_ *
+                                   sizeof(int16_t)));
+    }
+  }
+}
+
+TEST(NetEqPool, MatchesIndividuallyDrivenInstances) {
+  TestPoolAgainstReference(0);
+}
+
+TEST(NetEqPool, MatchesIndividuallyDrivenInstancesWithWorkers) {
+  TestPoolAgainstReference(2);
+}
+
+TEST(NetEqPool, RegisterAndUnregister) {
+  SimulatedClock clock(0);
+  NetEqPool pool(0, nullptr);
+  std::unique_ptr<NetEq> neteq = CreateNetEqInstance(&clock);
+  pool.RegisterInstance(neteq.get());
+  EXPECT_EQ(1u, pool.NumInstances());
+  AudioFrame frame;
+  AudioFrame* frame_ptr = &frame;
+  bool muted = false;
+  EXPECT_TRUE(pool.GetAudio(rtc::ArrayView<AudioFrame* const>(&frame_ptr, 1),
+                            rtc::ArrayView<bool>(&muted, 1)));
+  pool.UnregisterInstance(neteq.get());
+  EXPECT_EQ(0u, pool.NumInstances());
+}
+
+}  // namespace
+}  // namespace webrtc
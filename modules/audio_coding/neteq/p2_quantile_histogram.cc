@@ -0,0 +1,156 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/p2_quantile_histogram.h"
+
+#include <algorithm>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+constexpr int P2QuantileHistogram::kNumMarkers;
+
+P2QuantileHistogram::P2QuantileHistogram(size_t num_buckets,
+                                         int quantile,
+                                         int forget_factor)
+    : Histogram(num_buckets, forget_factor),
+      quantile_q30_(quantile),
+      p_(quantile / static_cast<double>(1 << 30)),
+      // A forget factor f weights old samples with a time constant of
+      // 1 / (1 - f) samples; represent at most twice that many.
+      max_count_(std::max(2 * kNumMarkers,
+                          2 * (1 << 15) /
+                              std::max(1, (1 << 15) - forget_factor))),
+      count_(0) {
+  RTC_DCHECK_GT(quantile_q30_, 0);
+  RTC_DCHECK_LT(quantile_q30_, 1 << 30);
+}
+
+P2QuantileHistogram::~P2QuantileHistogram() = default;
+
+void P2QuantileHistogram::Reset() {
+  Histogram::Reset();
+  count_ = 0;
+}
+
+void P2QuantileHistogram::Add(int index) {
+  RTC_DCHECK_GE(index, 0);
+  RTC_DCHECK_LT(index, NumBuckets());
+  const double x = index;
+  if (count_ < kNumMarkers) {
+    // Initialization phase: collect the first five samples.
+    heights_[count_] = x;
+    ++count_;
+    if (count_ == kNumMarkers) {
+      std::sort(heights_, heights_ + kNumMarkers);
+      for (int i = 0; i < kNumMarkers; ++i) {
+        positions_[i] = i + 1;
+      }
+      UpdateDesiredPositions();
+    }
+    return;
+  }
+
+  // Find the cell containing |x|, updating the extreme markers if |x| is a
+  // new minimum or maximum.
+  int cell;
+  if (x < heights_[0]) {
+    heights_[0] = x;
+    cell = 0;
+  } else if (x >= heights_[kNumMarkers - 1]) {
+    heights_[kNumMarkers - 1] = x;
+    cell = kNumMarkers - 2;
+  } else {
+    cell = 0;
+    while (x >= heights_[cell + 1]) {
+      ++cell;
+    }
+  }
+  for (int i = cell + 1; i < kNumMarkers; ++i) {
+    ++positions_[i];
+  }
+  ++count_;
+  UpdateDesiredPositions();
+
+  // Move the three middle markers towards their desired positions, adjusting
+  // their heights with a parabolic prediction when it stays between the
+  // neighboring markers, and linearly otherwise.
+  for (int i = 1; i < kNumMarkers - 1; ++i) {
+    const double delta = desired_positions_[i] - positions_[i];
+    if ((delta >= 1 && positions_[i + 1] - positions_[i] > 1) ||
+        (delta <= -1 && positions_[i - 1] - positions_[i] < -1)) {
+      const int direction = delta > 0 ? 1 : -1;
+      const double candidate = ParabolicEstimate(i, direction);
+      if (heights_[i - 1] < candidate && candidate < heights_[i + 1]) {
+        heights_[i] = candidate;
+      } else {
+        heights_[i] += direction * (heights_[i + direction] - heights_[i]) /
+                       (positions_[i + direction] - positions_[i]);
+      }
+      positions_[i] += direction;
+    }
+  }
+
+  if (count_ >= max_count_) {
+    HalveSampleCount();
+  }
+}
+
+int P2QuantileHistogram::Quantile(int probability) {
+  RTC_DCHECK_EQ(probability, quantile_q30_);
+  if (count_ == 0) {
+    return 0;
+  }
+  double estimate;
+  if (count_ < kNumMarkers) {
+    // Initialization phase; pick from the (unsorted) samples seen so far.
+    double sorted[kNumMarkers];
+    std::copy(heights_, heights_ + count_, sorted);
+    std::sort(sorted, sorted + count_);
+    estimate = sorted[std::min(count_ - 1, static_cast<int>(p_ * count_))];
+  } else {
+    // The middle marker tracks the |p_| quantile.
+    estimate = heights_[kNumMarkers / 2];
+  }
+  const int index = static_cast<int>(estimate + 0.5);
+  return std::min(std::max(index, 0), NumBuckets() - 1);
+}
+
+void P2QuantileHistogram::HalveSampleCount() {
+  positions_[0] = 1;
+  for (int i = 1; i < kNumMarkers; ++i) {
+    positions_[i] =
+        std::max((positions_[i] + 1) / 2, positions_[i - 1] + 1);
+  }
+  count_ = positions_[kNumMarkers - 1];
+  UpdateDesiredPositions();
+}
+
+double P2QuantileHistogram::ParabolicEstimate(int i, int direction) const {
+  const double a = (positions_[i] - positions_[i - 1] + direction) *
+                   (heights_[i + 1] - heights_[i]) /
+                   (positions_[i + 1] - positions_[i]);
+  const double b = (positions_[i + 1] - positions_[i] - direction) *
+                   (heights_[i] - heights_[i - 1]) /
+                   (positions_[i] - positions_[i - 1]);
+  return heights_[i] +
+         direction * (a + b) / (positions_[i + 1] - positions_[i - 1]);
+}
+
+void P2QuantileHistogram::UpdateDesiredPositions() {
+  desired_positions_[0] = 1;
+  desired_positions_[1] = 1 + (count_ - 1) * p_ / 2;
+  desired_positions_[2] = 1 + (count_ - 1) * p_;
+  desired_positions_[3] = 1 + (count_ - 1) * (1 + p_) / 2;
+  desired_positions_[4] = count_;
+}
+
+}  // namespace webrtc
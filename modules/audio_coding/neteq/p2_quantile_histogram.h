@@ -0,0 +1,70 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_NETEQ_P2_QUANTILE_HISTOGRAM_H_
+#define MODULES_AUDIO_CODING_NETEQ_P2_QUANTILE_HISTOGRAM_H_
+
+#include "modules/audio_coding/neteq/histogram.h"
+
+namespace webrtc {
+
+// Estimates a single quantile of the values passed to Add() with the P-square
+// algorithm (Jain & Chlamtac, 1985), which maintains five markers instead of
+// a full histogram. Each Add() performs a constant number of operations,
+// while the base class decays every bucket on every update. To keep tracking
+// a non-stationary delay distribution, the represented sample count is capped
+// based on |forget_factor|; see HalveSampleCount().
+class P2QuantileHistogram : public Histogram {
+ public:
+  // Creates an estimator of the |quantile| (in Q30, as in
+  // Histogram::Quantile()) of the added bucket indexes. |forget_factor| is in
+  // Q15 and has the same meaning as for the base class: the closer to 1 << 15,
+  // the slower old samples lose influence.
+  P2QuantileHistogram(size_t num_buckets, int quantile, int forget_factor);
+
+  ~P2QuantileHistogram() override;
+
+  // Resets the estimator to its starting state.
+  void Reset() override;
+
+  // Registers an observation of bucket |index|.
+  void Add(int index) override;
+
+  // Returns the current quantile estimate, as a bucket index. |probability|
+  // must equal the |quantile| given to the constructor; tracking one fixed
+  // quantile is what makes constant-time updates possible.
+  int Quantile(int probability) override;
+
+ private:
+  static constexpr int kNumMarkers = 5;
+
+  // Halves the weight of the samples seen so far by scaling the marker
+  // positions down, so that the estimate keeps adapting. This plays the role
+  // of the base class forget factor and runs only every |max_count_| packets.
+  void HalveSampleCount();
+
+  // The piecewise-parabolic marker height prediction from the P-square paper,
+  // for moving marker |i| one position in |direction| (+1 or -1).
+  double ParabolicEstimate(int i, int direction) const;
+
+  void UpdateDesiredPositions();
+
+  const int quantile_q30_;
+  const double p_;  // |quantile_q30_| as a fraction.
+  const int max_count_;
+  int count_;  // Number of samples represented, capped at |max_count_|.
+  double heights_[kNumMarkers];
+  int positions_[kNumMarkers];
+  double desired_positions_[kNumMarkers];
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_AUDIO_CODING_NETEQ_P2_QUANTILE_HISTOGRAM_H_
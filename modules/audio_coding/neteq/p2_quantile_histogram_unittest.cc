@@ -0,0 +1,85 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/p2_quantile_histogram.h"
+
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kNumBuckets = 100;
+constexpr int kQuantile = 1041529569;  // 0.97 in Q30.
+constexpr int kForgetFactor = 32745;   // 0.9993 in Q15.
+
+TEST(P2QuantileHistogramTest, FewSamples) {
+  P2QuantileHistogram histogram(kNumBuckets, kQuantile, kForgetFactor);
+  histogram.Reset();
+  EXPECT_EQ(0, histogram.Quantile(kQuantile));
+  histogram.Add(7);
+  EXPECT_EQ(7, histogram.Quantile(kQuantile));
+  histogram.Add(3);
+  histogram.Add(5);
+  // With few samples, the estimate is the largest sample seen so far.
+  EXPECT_EQ(7, histogram.Quantile(kQuantile));
+}
+
+TEST(P2QuantileHistogramTest, ConstantInput) {
+  P2QuantileHistogram histogram(kNumBuckets, kQuantile, kForgetFactor);
+  histogram.Reset();
+  for (int i = 0; i < 1000; ++i) {
+    histogram.Add(12);
+  }
+  EXPECT_EQ(12, histogram.Quantile(kQuantile));
+}
+
+TEST(P2QuantileHistogramTest, ConvergesOnUniformInput) {
+  P2QuantileHistogram histogram(kNumBuckets, kQuantile, kForgetFactor);
+  histogram.Reset();
+  // Deterministic pseudo-random sequence, approximately uniform over
+  // [0, kNumBuckets).
+  uint32_t state = 12345;
+  for (int i = 0; i < 10000; ++i) {
+    state = state * 1664525 + 1013904223;
+    histogram.Add((state >> 16) % kNumBuckets);
+  }
+  // The true 0.97 quantile of a uniform distribution over [0, 100) is 97.
+  EXPECT_NEAR(97, histogram.Quantile(kQuantile), 3);
+}
+
+TEST(P2QuantileHistogramTest, TracksChangingDistribution) {
+  P2QuantileHistogram histogram(kNumBuckets, kQuantile, kForgetFactor);
+  histogram.Reset();
+  for (int i = 0; i < 5000; ++i) {
+    histogram.Add(10);
+  }
+  EXPECT_EQ(10, histogram.Quantile(kQuantile));
+  // The distribution moves; the capped sample count must let the estimate
+  // follow within a few forgetting time constants.
+  for (int i = 0; i < 20000; ++i) {
+    histogram.Add(50);
+  }
+  EXPECT_NEAR(50, histogram.Quantile(kQuantile), 2);
+}
+
+TEST(P2QuantileHistogramTest, ResetRestartsEstimation) {
+  P2QuantileHistogram histogram(kNumBuckets, kQuantile, kForgetFactor);
+  histogram.Reset();
+  for (int i = 0; i < 1000; ++i) {
+    histogram.Add(42);
+  }
+  histogram.Reset();
+  EXPECT_EQ(0, histogram.Quantile(kQuantile));
+  histogram.Add(4);
+  EXPECT_EQ(4, histogram.Quantile(kQuantile));
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -65,16 +65,18 @@ void LogPacketDiscarded(int codec_level, StatisticsCalculator* stats) {
 
 PacketBuffer::PacketBuffer(size_t max_number_of_packets,
                            const TickTimer* tick_timer)
-    : max_number_of_packets_(max_number_of_packets), tick_timer_(tick_timer) {}
+    : max_number_of_packets_(max_number_of_packets),
+      pool_(max_number_of_packets),
+      tick_timer_(tick_timer) {}
 
 // Destructor. All packets in the buffer will be destroyed.
 PacketBuffer::~PacketBuffer() {
   Flush();
 }
 
-// Flush the buffer. All packets in the buffer will be destroyed.
+// Flush the buffer. All packets in the buffer will be recycled.
 void PacketBuffer::Flush() {
-  buffer_.clear();
+  pool_.Recycle(&buffer_);
 }
 
 bool PacketBuffer::Empty() const {
@@ -122,9 +124,10 @@ int PacketBuffer::InsertPacket(Packet&& packet, StatisticsCalculator* stats) {
   PacketList::iterator it = rit.base();
   if (it != buffer_.end() && packet.timestamp == it->timestamp) {
     LogPacketDiscarded(it->priority.codec_level, stats);
-    it = buffer_.erase(it);
+    it = pool_.Recycle(&buffer_, it);
   }
-  buffer_.insert(it, std::move(packet));  // Insert the packet at that position.
+  // Insert the packet at that position, reusing a recycled node if available.
+  pool_.AcquireInsert(&buffer_, it) = std::move(packet);
 
   return return_val;
 }
@@ -166,12 +169,14 @@ int PacketBuffer::InsertPacketList(
       // The buffer flushed, but this is not an error. We can still continue.
       flushed = true;
     } else if (return_val != kOK) {
-      // An error occurred. Delete remaining packets in list and return.
-      packet_list->clear();
+      // An error occurred. Recycle remaining packets in list and return.
+      pool_.Recycle(packet_list);
       return return_val;
     }
   }
-  packet_list->clear();
+  // Return the emptied nodes of |packet_list| to the pool, where they can be
+  // picked up again by the callers that build the insertion lists.
+  pool_.Recycle(packet_list);
   return flushed ? kFlushed : kOK;
 }
 
@@ -218,7 +223,7 @@ absl::optional<Packet> PacketBuffer::GetNextPacket() {
   absl::optional<Packet> packet(std::move(buffer_.front()));
   // Assert that the packet sanity checks in InsertPacket method works.
   RTC_DCHECK(!packet->empty());
-  buffer_.pop_front();
+  pool_.Recycle(&buffer_, buffer_.begin());
 
   return packet;
 }
@@ -231,21 +236,23 @@ int PacketBuffer::DiscardNextPacket(StatisticsCalculator* stats) {
   const Packet& packet = buffer_.front();
   RTC_DCHECK(!packet.empty());
   LogPacketDiscarded(packet.priority.codec_level, stats);
-  buffer_.pop_front();
+  pool_.Recycle(&buffer_, buffer_.begin());
   return kOK;
 }
 
 void PacketBuffer::DiscardOldPackets(uint32_t timestamp_limit,
                                      uint32_t horizon_samples,
                                      StatisticsCalculator* stats) {
-  buffer_.remove_if([timestamp_limit, horizon_samples, stats](const Packet& p) {
-    if (timestamp_limit == p.timestamp ||
-        !IsObsoleteTimestamp(p.timestamp, timestamp_limit, horizon_samples)) {
-      return false;
+  for (PacketList::iterator it = buffer_.begin(); it != buffer_.end();) {
+    if (timestamp_limit == it->timestamp ||
+        !IsObsoleteTimestamp(it->timestamp, timestamp_limit,
+                             horizon_samples)) {
+      ++it;
+      continue;
     }
-    LogPacketDiscarded(p.priority.codec_level, stats);
-    return true;
-  });
+    LogPacketDiscarded(it->priority.codec_level, stats);
+    it = pool_.Recycle(&buffer_, it);
+  }
 }
 
 void PacketBuffer::DiscardAllOldPackets(uint32_t timestamp_limit,
@@ -255,13 +262,14 @@ void PacketBuffer::DiscardAllOldPackets(uint32_t timestamp_limit,
 
 void PacketBuffer::DiscardPacketsWithPayloadType(uint8_t payload_type,
                                                  StatisticsCalculator* stats) {
-  buffer_.remove_if([payload_type, stats](const Packet& p) {
-    if (p.payload_type != payload_type) {
-      return false;
+  for (PacketList::iterator it = buffer_.begin(); it != buffer_.end();) {
+    if (it->payload_type != payload_type) {
+      ++it;
+      continue;
     }
-    LogPacketDiscarded(p.priority.codec_level, stats);
-    return true;
-  });
+    LogPacketDiscarded(it->priority.codec_level, stats);
+    it = pool_.Recycle(&buffer_, it);
+  }
 }
 
 size_t PacketBuffer::NumPacketsInBuffer() const {
@@ -14,6 +14,7 @@
 #include "absl/types/optional.h"
 #include "modules/audio_coding/neteq/decoder_database.h"
 #include "modules/audio_coding/neteq/packet.h"
+#include "modules/audio_coding/neteq/packet_pool.h"
 #include "modules/include/module_common_types_public.h"  // IsNewerTimestamp
 #include "rtc_base/constructor_magic.h"
 
@@ -131,6 +132,12 @@ class PacketBuffer {
   virtual bool ContainsDtxOrCngPacket(
       const DecoderDatabase* decoder_database) const;
 
+  // Returns the pool that recycles the storage of deleted packets. Callers
+  // that create packets destined for this buffer should draw them from the
+  // pool, and return consumed packets to it, to avoid allocations in steady
+  // state.
+  virtual PacketPool* packet_pool() { return &pool_; }
+
   // Static method returning true if |timestamp| is older than |timestamp_limit|
   // but less than |horizon_samples| behind |timestamp_limit|. For instance,
   // with timestamp_limit = 100 and horizon_samples = 10, a timestamp in the
@@ -148,6 +155,10 @@ class PacketBuffer {
  private:
   size_t max_number_of_packets_;
   PacketList buffer_;
+  // Recycles the nodes and payload allocations of deleted packets. Sized to
+  // the buffer capacity, so a full buffer can be flushed without deleting
+  // nodes.
+  PacketPool pool_;
   const TickTimer* tick_timer_;
   RTC_DISALLOW_COPY_AND_ASSIGN(PacketBuffer);
 };
@@ -0,0 +1,65 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/packet_pool.h"
+
+#include <iterator>
+
+#include "api/rtp_packet_info.h"
+
+namespace webrtc {
+namespace {
+
+// Brings |packet| back to a default-constructed state, except that the
+// payload buffer keeps its allocation.
+void ScrubPacket(Packet* packet) {
+  packet->timestamp = 0;
+  packet->sequence_number = 0;
+  packet->payload_type = 0;
+  packet->payload.Clear();  // Keeps the capacity.
+  packet->priority = Packet::Priority();
+  packet->packet_info = RtpPacketInfo();
+  packet->waiting_time.reset();
+  packet->frame.reset();
+}
+
+}  // namespace
+
+PacketPool::PacketPool(size_t max_pooled_packets)
+    : max_pooled_packets_(max_pooled_packets) {}
+
+PacketPool::~PacketPool() = default;
+
+Packet& PacketPool::AcquireInsert(PacketList* list, PacketList::iterator pos) {
+  if (pool_.empty()) {
+    return *list->emplace(pos);
+  }
+  list->splice(pos, pool_, pool_.begin());
+  return *--pos;
+}
+
+void PacketPool::Recycle(PacketList* list) {
+  for (PacketList::iterator it = list->begin(); it != list->end();) {
+    it = Recycle(list, it);
+  }
+}
+
+PacketList::iterator PacketPool::Recycle(PacketList* list,
+                                         PacketList::iterator pos) {
+  if (pool_.size() >= max_pooled_packets_) {
+    return list->erase(pos);
+  }
+  ScrubPacket(&*pos);
+  PacketList::iterator next = std::next(pos);
+  pool_.splice(pool_.end(), *list, pos);
+  return next;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,58 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_AUDIO_CODING_NETEQ_PACKET_POOL_H_
+#define MODULES_AUDIO_CODING_NETEQ_PACKET_POOL_H_
+
+#include <stddef.h>
+
+#include "modules/audio_coding/neteq/packet.h"
+#include "rtc_base/constructor_magic.h"
+
+namespace webrtc {
+
+// Pool of recycled PacketList nodes. NetEq churns tens of packets per second
+// through heap-allocated list nodes and payload buffers; by moving the nodes
+// of consumed packets into the pool instead of deleting them, and handing
+// them out again on insertion, steady-state packet handling stops hitting the
+// allocator. Payload buffer allocations are retained across recycling, so a
+// reused packet can typically receive its payload without reallocating.
+class PacketPool {
+ public:
+  // Creates a pool holding on to at most |max_pooled_packets| recycled nodes;
+  // nodes recycled beyond that are deleted.
+  explicit PacketPool(size_t max_pooled_packets);
+  ~PacketPool();
+
+  // Inserts a packet backed by pooled storage (when available) into |list|
+  // before |pos| and returns a reference to it. All packet fields are in a
+  // default-constructed state, except that the payload buffer keeps any
+  // previously allocated capacity. The caller must set the RTP header fields.
+  Packet& AcquireInsert(PacketList* list, PacketList::iterator pos);
+
+  // Moves all nodes of |list| into the pool. Frames, stopwatches and packet
+  // info are released; payload buffer allocations are kept for reuse.
+  void Recycle(PacketList* list);
+
+  // Moves the node at |pos| of |list| into the pool. Returns an iterator to
+  // the node following |pos|, like PacketList::erase().
+  PacketList::iterator Recycle(PacketList* list, PacketList::iterator pos);
+
+  // Returns the number of nodes currently held by the pool.
+  size_t size() const { return pool_.size(); }
+
+ private:
+  const size_t max_pooled_packets_;
+  PacketList pool_;
+  RTC_DISALLOW_COPY_AND_ASSIGN(PacketPool);
+};
+
+}  // namespace webrtc
+#endif  // MODULES_AUDIO_CODING_NETEQ_PACKET_POOL_H_
@@ -0,0 +1,100 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_coding/neteq/packet_pool.h"
+
+#include <iterator>
+
+#include "modules/audio_coding/neteq/packet.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+
+TEST(PacketPool, AcquireFromEmptyPool) {
+  PacketPool pool(10);
+  PacketList list;
+  Packet& packet = pool.AcquireInsert(&list, list.end());
+  EXPECT_EQ(1u, list.size());
+  EXPECT_EQ(&packet, &list.back());
+  EXPECT_EQ(0u, pool.size());
+  EXPECT_TRUE(packet.payload.empty());
+  EXPECT_FALSE(packet.frame);
+  EXPECT_FALSE(packet.waiting_time);
+}
+
+TEST(PacketPool, RecycleAndReuseKeepsPayloadCapacity) {
+  PacketPool pool(10);
+  PacketList list;
+  Packet& packet = pool.AcquireInsert(&list, list.end());
+  packet.timestamp = 1234;
+  packet.sequence_number = 17;
+  packet.payload.SetSize(100);
+  const size_t capacity = packet.payload.capacity();
+  EXPECT_GE(capacity, 100u);
+
+  pool.Recycle(&list);
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(1u, pool.size());
+
+  Packet& reused = pool.AcquireInsert(&list, list.end());
+  EXPECT_EQ(0u, pool.size());
+  // The reused packet must look default-constructed, except that the payload
+  // buffer keeps its allocation.
+  EXPECT_EQ(0u, reused.timestamp);
+  EXPECT_EQ(0, reused.sequence_number);
+  EXPECT_TRUE(reused.payload.empty());
+  EXPECT_EQ(capacity, reused.payload.capacity());
+  EXPECT_EQ(Packet::Priority(), reused.priority);
+  EXPECT_FALSE(reused.frame);
+  EXPECT_FALSE(reused.waiting_time);
+}
+
+TEST(PacketPool, InsertsAtGivenPosition) {
+  PacketPool pool(10);
+  PacketList list;
+  pool.AcquireInsert(&list, list.end()).timestamp = 10;
+  pool.AcquireInsert(&list, list.end()).timestamp = 30;
+  // Insert in between the two existing packets.
+  PacketList::iterator pos = std::next(list.begin());
+  pool.AcquireInsert(&list, pos).timestamp = 20;
+  ASSERT_EQ(3u, list.size());
+  uint32_t expected_timestamp = 10;
+  for (const Packet& packet : list) {
+    EXPECT_EQ(expected_timestamp, packet.timestamp);
+    expected_timestamp += 10;
+  }
+}
+
+TEST(PacketPool, RecycleSingleNodeReturnsNext) {
+  PacketPool pool(10);
+  PacketList list;
+  pool.AcquireInsert(&list, list.end()).timestamp = 10;
+  pool.AcquireInsert(&list, list.end()).timestamp = 20;
+  pool.AcquireInsert(&list, list.end()).timestamp = 30;
+  PacketList::iterator it = pool.Recycle(&list, std::next(list.begin()));
+  EXPECT_EQ(30u, it->timestamp);
+  EXPECT_EQ(2u, list.size());
+  EXPECT_EQ(1u, pool.size());
+}
+
+TEST(PacketPool, CapsNumberOfPooledPackets) {
+  PacketPool pool(2);
+  PacketList list;
+  for (int i = 0; i < 5; ++i) {
+    pool.AcquireInsert(&list, list.end());
+  }
+  EXPECT_EQ(5u, list.size());
+  pool.Recycle(&list);
+  EXPECT_TRUE(list.empty());
+  // Only two nodes are retained; the rest are deleted.
+  EXPECT_EQ(2u, pool.size());
+}
+
+}  // namespace webrtc
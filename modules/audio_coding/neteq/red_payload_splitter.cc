@@ -20,6 +20,7 @@
 
 #include "modules/audio_coding/neteq/decoder_database.h"
 #include "modules/audio_coding/neteq/packet.h"
+#include "modules/audio_coding/neteq/packet_pool.h"
 #include "rtc_base/buffer.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/safe_conversions.h"
@@ -33,7 +34,7 @@ namespace webrtc {
 // is replaced by the new ones in |new_packets|, so that |packet_list| becomes:
 // {A1, A2, ..., B, C, ...}. The method then continues with B, and C, until all
 // the original packets have been replaced by their split payloads.
-bool RedPayloadSplitter::SplitRed(PacketList* packet_list) {
+bool RedPayloadSplitter::SplitRed(PacketList* packet_list, PacketPool* pool) {
   // Too many RED blocks indicates that something is wrong. Clamp it at some
   // reasonable value.
   const size_t kMaxRedBlocks = 32;
@@ -111,7 +112,11 @@ bool RedPayloadSplitter::SplitRed(PacketList* packet_list) {
           break;
         }
 
-        Packet new_packet;
+        // Construct the packet in place at the front of the list, backed by
+        // pooled storage when a pool is provided.
+        Packet& new_packet =
+            pool ? pool->AcquireInsert(&new_packets, new_packets.begin())
+                 : *new_packets.emplace(new_packets.begin());
         new_packet.timestamp = new_header.timestamp;
         new_packet.payload_type = new_header.payload_type;
         new_packet.sequence_number = red_packet.sequence_number;
@@ -125,7 +130,6 @@ bool RedPayloadSplitter::SplitRed(PacketList* packet_list) {
             /*audio_level=*/absl::nullopt,
             /*absolute_capture_time=*/absl::nullopt,
             /*receive_time_ms=*/red_packet.packet_info.receive_time_ms());
-        new_packets.push_front(std::move(new_packet));
         payload_ptr += payload_length;
       }
       // Insert new packets into original list, before the element pointed to by
@@ -138,7 +142,7 @@ bool RedPayloadSplitter::SplitRed(PacketList* packet_list) {
     // Remove |it| from the packet list. This operation effectively moves the
     // iterator |it| to the next packet in the list. Thus, we do not have to
     // increment it manually.
-    it = packet_list->erase(it);
+    it = pool ? pool->Recycle(packet_list, it) : packet_list->erase(it);
   }
   return ret;
 }
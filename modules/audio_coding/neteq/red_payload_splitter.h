@@ -17,6 +17,7 @@
 namespace webrtc {
 
 class DecoderDatabase;
+class PacketPool;
 
 // This class handles splitting of RED payloads into smaller parts.
 // Codec-specific packet splitting can be performed by
@@ -32,8 +33,10 @@ class RedPayloadSplitter {
   // |packet_list| are properly deleted, and replaced by the new packets.
   // Note that all packets in |packet_list| must be RED payloads, i.e., have
   // RED headers according to RFC 2198 at the very beginning of the payload.
+  // If |pool| is given, the packets for the RED payloads are backed by pooled
+  // storage and the consumed RED packets are recycled into the pool.
   // Returns kOK or an error.
-  virtual bool SplitRed(PacketList* packet_list);
+  virtual bool SplitRed(PacketList* packet_list, PacketPool* pool = nullptr);
 
   // Checks all packets in |packet_list|. Packets that are DTMF events or
   // comfort noise payloads are kept. Except that, only one single payload type
@@ -30,6 +30,23 @@ TEST(NetEqPerformanceTest, Run) {
                             "ms", true);
 }
 
+// Runs a test with heavy packet losses and clock drift, to put emphasis on
+// the expand, merge, accelerate and preemptive-expand code paths.
+TEST(NetEqPerformanceTest, RunTimeStretch) {
+  const int kSimulationTimeMs = 10000000;
+  const int kQuickSimulationTimeMs = 100000;
+  const int kLossPeriod = 5;  // Drop every 5th packet.
+  const double kDriftFactor = 0.25;
+  int64_t runtime = webrtc::test::NetEqPerformanceTest::Run(
+      webrtc::field_trial::IsEnabled("WebRTC-QuickPerfTest")
+          ? kQuickSimulationTimeMs
+          : kSimulationTimeMs,
+      kLossPeriod, kDriftFactor);
+  ASSERT_GT(runtime, 0);
+  webrtc::test::PrintResult("neteq_performance", "", "20_pl_25_drift", runtime,
+                            "ms", true);
+}
+
 // Runs a test with neither packet losses nor clock drift, to put
 // emphasis on the "good-weather" code path, which is presumably much
 // more lightweight.
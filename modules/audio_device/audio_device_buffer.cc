@@ -20,7 +20,9 @@
 #include "rtc_base/bind.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/task_utils/pooled_task_queue_factory.h"
 #include "rtc_base/time_utils.h"
+#include "system_wrappers/include/audio_pipeline_tap.h"
 #include "system_wrappers/include/metrics.h"
 
 namespace webrtc {
@@ -41,10 +43,28 @@ static const size_t kMinValidCallTimeTimeInMilliseconds =
 static const double k2Pi = 6.28318530717959;
 #endif
 
+// Returns the factory used to create the timer queue of every
+// AudioDeviceBuffer in the process. The timer only wakes up every
+// |kTimerIntervalInSeconds| to read a few counters, so dedicating a thread
+// per instance (what CreateTaskQueue on a normal factory does) is wasteful
+// when many ADMs exist at once, e.g. in test rigs with dozens of virtual
+// devices. The pooled factory multiplexes all the timer queues onto one
+// shared worker thread while each queue keeps its own serial FIFO order, so
+// the RTC_DCHECK_RUN_ON(&task_queue_) annotations below still hold.
+// The factory is created on first use from the factory handed to the first
+// AudioDeviceBuffer and is intentionally leaked; |worker_factory| is only
+// used during construction.
+static TaskQueueFactory* SharedTimerQueueFactory(
+    TaskQueueFactory* worker_factory) {
+  static TaskQueueFactory* const factory = new PooledTaskQueueFactory(
+      *worker_factory, 1, kTimerQueueName, TaskQueueFactory::Priority::NORMAL);
+  return factory;
+}
+
 AudioDeviceBuffer::AudioDeviceBuffer(TaskQueueFactory* task_queue_factory)
-    : task_queue_(task_queue_factory->CreateTaskQueue(
-          kTimerQueueName,
-          TaskQueueFactory::Priority::NORMAL)),
+    : task_queue_(SharedTimerQueueFactory(task_queue_factory)
+                      ->CreateTaskQueue(kTimerQueueName,
+                                        TaskQueueFactory::Priority::NORMAL)),
       audio_transport_cb_(nullptr),
       rec_sample_rate_(0),
       play_sample_rate_(0),
@@ -264,6 +284,7 @@ int32_t AudioDeviceBuffer::DeliverRecordedData() {
     RTC_LOG(LS_WARNING) << "Invalid audio transport";
     return 0;
   }
+  audio_pipeline_tap::Record(audio_pipeline_tap::Stage::kAdmCapture);
   const size_t frames = rec_buffer_.size() / rec_channels_;
   const size_t bytes_per_frame = rec_channels_ * sizeof(int16_t);
   uint32_t new_mic_level_dummy = 0;
@@ -303,6 +324,7 @@ int32_t AudioDeviceBuffer::RequestPlayoutData(size_t samples_per_channel) {
   uint32_t res = audio_transport_cb_->NeedMorePlayData(
       samples_per_channel, bytes_per_frame, play_channels_, play_sample_rate_,
       play_buffer_.data(), num_samples_out, &elapsed_time_ms, &ntp_time_ms);
+  audio_pipeline_tap::Record(audio_pipeline_tap::Stage::kAdmPlayout);
   if (res != 0) {
     RTC_LOG(LS_ERROR) << "NeedMorePlayData() failed";
   }
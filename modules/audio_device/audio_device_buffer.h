@@ -145,8 +145,8 @@ class AudioDeviceBuffer {
   rtc::CriticalSection lock_;
 
   // Task queue used to invoke LogStats() periodically. Tasks are executed on a
-  // worker thread but it does not necessarily have to be the same thread for
-  // each task.
+  // worker thread, shared by all AudioDeviceBuffer instances in the process,
+  // but it does not necessarily have to be the same thread for each task.
   rtc::TaskQueue task_queue_;
 
   // Raw pointer to AudioTransport instance. Supplied to RegisterAudioCallback()
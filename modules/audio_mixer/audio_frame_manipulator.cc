@@ -16,20 +16,10 @@
 
 namespace webrtc {
 
-uint32_t AudioMixerCalculateEnergy(const AudioFrame& audio_frame) {
-  if (audio_frame.muted()) {
-    return 0;
-  }
-
-  uint32_t energy = 0;
-  const int16_t* frame_data = audio_frame.data();
-  for (size_t position = 0;
-       position < audio_frame.samples_per_channel_ * audio_frame.num_channels_;
-       position++) {
-    // TODO(aleloi): This can overflow. Convert to floats.
-    energy += frame_data[position] * frame_data[position];
-  }
-  return energy;
+float AudioMixerCalculateEnergy(const AudioFrame& audio_frame) {
+  // The sum of squares is cached on the frame, so it is computed at most once
+  // per frame no matter how many consumers ask for a level.
+  return audio_frame.level_info().sum_square;
 }
 
 void Ramp(float start_gain, float target_gain, AudioFrame* audio_frame) {
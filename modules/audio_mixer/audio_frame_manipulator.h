@@ -18,8 +18,8 @@
 
 namespace webrtc {
 
-// Updates the audioFrame's energy (based on its samples).
-uint32_t AudioMixerCalculateEnergy(const AudioFrame& audio_frame);
+// Returns the frame's energy (sum of squared samples); 0 for muted frames.
+float AudioMixerCalculateEnergy(const AudioFrame& audio_frame);
 
 // Ramps up or down the provided audio frame. Ramp(0, 1, frame) will
 // linearly increase the samples in the frame from 0 to full volume.
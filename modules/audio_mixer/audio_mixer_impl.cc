@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -41,7 +42,7 @@ struct SourceFrame {
   SourceFrame(AudioMixerImpl::SourceStatus* source_status,
               AudioFrame* audio_frame,
               bool muted,
-              uint32_t energy)
+              float energy)
       : source_status(source_status),
         audio_frame(audio_frame),
         muted(muted),
@@ -53,7 +54,7 @@ struct SourceFrame {
   AudioMixerImpl::SourceStatus* source_status = nullptr;
   AudioFrame* audio_frame = nullptr;
   bool muted = true;
-  uint32_t energy = 0;
+  float energy = 0.f;
 };
 
 // ShouldMixBefore(a, b) is used to select mixer sources.
@@ -87,7 +88,7 @@ AudioMixerImpl::SourceStatusList::const_iterator FindSourceInList(
     AudioMixerImpl::SourceStatusList const* audio_source_list) {
   return std::find_if(
       audio_source_list->begin(), audio_source_list->end(),
-      [audio_source](const std::unique_ptr<AudioMixerImpl::SourceStatus>& p) {
+      [audio_source](const std::shared_ptr<AudioMixerImpl::SourceStatus>& p) {
         return p->audio_source == audio_source;
       });
 }
@@ -99,7 +100,7 @@ AudioMixerImpl::AudioMixerImpl(
     : output_rate_calculator_(std::move(output_rate_calculator)),
       output_frequency_(0),
       sample_size_(0),
-      audio_source_list_(),
+      audio_source_list_(std::make_shared<const SourceStatusList>()),
       frame_combiner_(use_limiter) {}
 
 AudioMixerImpl::~AudioMixerImpl() {}
@@ -123,27 +124,33 @@ void AudioMixerImpl::Mix(size_t number_of_channels,
   RTC_DCHECK(number_of_channels >= 1);
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
 
-  CalculateOutputFrequency();
-
-  {
-    rtc::CritScope lock(&crit_);
-    const size_t number_of_streams = audio_source_list_.size();
-    frame_combiner_.Combine(GetAudioFromSources(), number_of_channels,
-                            OutputFrequency(), number_of_streams,
-                            audio_frame_for_mixing);
-  }
-
-  return;
+  // Hold the mix lock while pulling audio from the sources; RemoveSource()
+  // acquires it after unpublishing a source, so a source cannot be deleted
+  // by its owner while this mix still pulls from it. The lock is uncontended
+  // unless a removal is draining, so AddSource() and snapshot publication
+  // never block the audio callback. The snapshot must be loaded after the
+  // lock is taken; a list loaded before it could contain a source whose
+  // removal has already drained.
+  rtc::CritScope mix_scope(&mix_crit_);
+  const std::shared_ptr<const SourceStatusList> audio_source_list =
+      std::atomic_load(&audio_source_list_);
+
+  CalculateOutputFrequency(*audio_source_list);
+
+  const size_t number_of_streams = audio_source_list->size();
+  frame_combiner_.Combine(GetAudioFromSources(*audio_source_list),
+                          number_of_channels, OutputFrequency(),
+                          number_of_streams, audio_frame_for_mixing);
 }
 
-void AudioMixerImpl::CalculateOutputFrequency() {
+void AudioMixerImpl::CalculateOutputFrequency(
+    const SourceStatusList& audio_source_list) {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
-  rtc::CritScope lock(&crit_);
 
   std::vector<int> preferred_rates;
-  std::transform(audio_source_list_.begin(), audio_source_list_.end(),
+  std::transform(audio_source_list.begin(), audio_source_list.end(),
                  std::back_inserter(preferred_rates),
-                 [&](std::unique_ptr<SourceStatus>& a) {
+                 [&](const std::shared_ptr<SourceStatus>& a) {
                    return a->audio_source->PreferredSampleRate();
                  });
 
@@ -160,29 +167,45 @@ int AudioMixerImpl::OutputFrequency() const {
 bool AudioMixerImpl::AddSource(Source* audio_source) {
   RTC_DCHECK(audio_source);
   rtc::CritScope lock(&crit_);
-  RTC_DCHECK(FindSourceInList(audio_source, &audio_source_list_) ==
-             audio_source_list_.end())
+  const std::shared_ptr<const SourceStatusList> current_list =
+      std::atomic_load(&audio_source_list_);
+  RTC_DCHECK(FindSourceInList(audio_source, current_list.get()) ==
+             current_list->end())
       << "Source already added to mixer";
-  audio_source_list_.emplace_back(new SourceStatus(audio_source, false, 0));
+  auto new_list = std::make_shared<SourceStatusList>(*current_list);
+  new_list->emplace_back(new SourceStatus(audio_source, false, 0));
+  std::atomic_store(&audio_source_list_,
+                    std::shared_ptr<const SourceStatusList>(new_list));
   return true;
 }
 
 void AudioMixerImpl::RemoveSource(Source* audio_source) {
   RTC_DCHECK(audio_source);
   rtc::CritScope lock(&crit_);
-  const auto iter = FindSourceInList(audio_source, &audio_source_list_);
-  RTC_DCHECK(iter != audio_source_list_.end()) << "Source not present in mixer";
-  audio_source_list_.erase(iter);
+  const std::shared_ptr<const SourceStatusList> current_list =
+      std::atomic_load(&audio_source_list_);
+  const auto iter = FindSourceInList(audio_source, current_list.get());
+  RTC_DCHECK(iter != current_list->end()) << "Source not present in mixer";
+  auto new_list = std::make_shared<SourceStatusList>(*current_list);
+  new_list->erase(new_list->begin() + (iter - current_list->begin()));
+  std::atomic_store(&audio_source_list_,
+                    std::shared_ptr<const SourceStatusList>(new_list));
+  // The mixer does not own the source, so removal must be a barrier: block
+  // until any mix in progress - which may have loaded the old snapshot and
+  // be pulling audio from this source - has finished. After this, no mix
+  // can reach the source again and the caller may safely delete it.
+  rtc::CritScope mix_scope(&mix_crit_);
 }
 
-AudioFrameList AudioMixerImpl::GetAudioFromSources() {
+AudioFrameList AudioMixerImpl::GetAudioFromSources(
+    const SourceStatusList& audio_source_list) {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
   AudioFrameList result;
   std::vector<SourceFrame> audio_source_mixing_data_list;
   std::vector<SourceFrame> ramp_list;
 
   // Get audio from the audio sources and put it in the SourceFrame vector.
-  for (auto& source_and_status : audio_source_list_) {
+  for (const auto& source_and_status : audio_source_list) {
     const auto audio_frame_info =
         source_and_status->audio_source->GetAudioFrameWithInfo(
             OutputFrequency(), &source_and_status->audio_frame);
@@ -227,10 +250,11 @@ AudioFrameList AudioMixerImpl::GetAudioFromSources() {
 bool AudioMixerImpl::GetAudioSourceMixabilityStatusForTest(
     AudioMixerImpl::Source* audio_source) const {
   RTC_DCHECK_RUNS_SERIALIZED(&race_checker_);
-  rtc::CritScope lock(&crit_);
+  const std::shared_ptr<const SourceStatusList> audio_source_list =
+      std::atomic_load(&audio_source_list_);
 
-  const auto iter = FindSourceInList(audio_source, &audio_source_list_);
-  if (iter != audio_source_list_.end()) {
+  const auto iter = FindSourceInList(audio_source, audio_source_list.get());
+  if (iter != audio_source_list->end()) {
     return (*iter)->is_mixed;
   }
 
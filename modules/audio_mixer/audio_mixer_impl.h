@@ -43,7 +43,7 @@ class AudioMixerImpl : public AudioMixer {
     AudioFrame audio_frame;
   };
 
-  using SourceStatusList = std::vector<std::unique_ptr<SourceStatus>>;
+  using SourceStatusList = std::vector<std::shared_ptr<SourceStatus>>;
 
   // AudioProcessing only accepts 10 ms frames.
   static const int kFrameDurationInMs = 10;
@@ -76,19 +76,27 @@ class AudioMixerImpl : public AudioMixer {
 
  private:
   // Set mixing frequency through OutputFrequencyCalculator.
-  void CalculateOutputFrequency();
+  void CalculateOutputFrequency(const SourceStatusList& audio_source_list);
   // Get mixing frequency.
   int OutputFrequency() const;
 
-  // Compute what audio sources to mix from audio_source_list_. Ramp
+  // Compute what audio sources to mix from |audio_source_list|. Ramp
   // in and out. Update mixed status. Mixes up to
   // kMaximumAmountOfMixedAudioSources audio sources.
-  AudioFrameList GetAudioFromSources() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
+  AudioFrameList GetAudioFromSources(
+      const SourceStatusList& audio_source_list);
 
   // The critical section lock guards audio source insertion and
-  // removal, which can be done from any thread. The race checker
-  // checks that mixing is done sequentially.
+  // removal, which can be done from any thread. Mixing reads an
+  // immutable snapshot of the source list that is published with atomic
+  // shared_ptr operations, so the audio callback path never contends
+  // with AddSource(). The mix lock is held for the duration of a mix;
+  // RemoveSource() acquires it after unlinking a source so that it does
+  // not return while a mix in progress can still pull audio from the
+  // removed source, whose lifetime the caller controls. The race
+  // checker checks that mixing is done sequentially.
   rtc::CriticalSection crit_;
+  rtc::CriticalSection mix_crit_ RTC_ACQUIRED_AFTER(crit_);
   rtc::RaceChecker race_checker_;
 
   std::unique_ptr<OutputRateCalculator> output_rate_calculator_;
@@ -96,8 +104,11 @@ class AudioMixerImpl : public AudioMixer {
   int output_frequency_ RTC_GUARDED_BY(race_checker_);
   size_t sample_size_ RTC_GUARDED_BY(race_checker_);
 
-  // List of all audio sources. Note all lists are disjunct
-  SourceStatusList audio_source_list_ RTC_GUARDED_BY(crit_);  // May be mixed.
+  // Immutable snapshot of all audio sources, copied on insertion and
+  // removal and read with std::atomic_load by the mixing thread. The
+  // shared ownership keeps a removed source status alive until a mix in
+  // progress has finished with it. Note all lists are disjunct.
+  std::shared_ptr<const SourceStatusList> audio_source_list_;  // May be mixed.
 
   // Component that handles actual adding of audio frames.
   FrameCombiner frame_combiner_ RTC_GUARDED_BY(race_checker_);
@@ -10,6 +10,16 @@
 
 #include "modules/audio_mixer/frame_combiner.h"
 
+// Defines WEBRTC_ARCH_X86_FAMILY, used below.
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+
 #include <algorithm>
 #include <array>
 #include <cstdint>
@@ -74,6 +84,77 @@ void MixFewFramesWithNoLimiter(const std::vector<AudioFrame*>& mix_list,
             audio_frame_for_mixing->mutable_data());
 }
 
+// Widens mono int16 samples to float and adds them onto |destination|,
+// eight samples per iteration where SIMD is available.
+void AccumulateMonoFrame(const int16_t* source,
+                         float* destination,
+                         size_t samples) {
+  size_t k = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  for (; k + 8 <= samples; k += 8) {
+    const __m128i s16 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + k));
+    // Duplicate each lane into 32 bits, then shift arithmetically to
+    // sign-extend.
+    const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(s16, s16), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(s16, s16), 16);
+    _mm_storeu_ps(destination + k, _mm_add_ps(_mm_loadu_ps(destination + k),
+                                              _mm_cvtepi32_ps(lo)));
+    _mm_storeu_ps(
+        destination + k + 4,
+        _mm_add_ps(_mm_loadu_ps(destination + k + 4), _mm_cvtepi32_ps(hi)));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; k + 8 <= samples; k += 8) {
+    const int16x8_t s16 = vld1q_s16(source + k);
+    const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(s16)));
+    const float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(s16)));
+    vst1q_f32(destination + k, vaddq_f32(vld1q_f32(destination + k), lo));
+    vst1q_f32(destination + k + 4,
+              vaddq_f32(vld1q_f32(destination + k + 4), hi));
+  }
+#endif
+  for (; k < samples; ++k) {
+    destination[k] += source[k];
+  }
+}
+
+// Deinterleaves stereo int16 samples and adds them onto the two planar
+// float channels, four frames per iteration where SIMD is available.
+void AccumulateStereoFrame(const int16_t* interleaved,
+                           float* left,
+                           float* right,
+                           size_t samples_per_channel) {
+  size_t k = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  for (; k + 4 <= samples_per_channel; k += 4) {
+    // L0 R0 L1 R1 L2 R2 L3 R3.
+    const __m128i s16 =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(interleaved + 2 * k));
+    // Even lanes: shift left so the sample sits in the high half, then
+    // sign-extend back down. Odd lanes are already in the high halves.
+    const __m128i l32 = _mm_srai_epi32(_mm_slli_epi32(s16, 16), 16);
+    const __m128i r32 = _mm_srai_epi32(s16, 16);
+    _mm_storeu_ps(left + k,
+                  _mm_add_ps(_mm_loadu_ps(left + k), _mm_cvtepi32_ps(l32)));
+    _mm_storeu_ps(right + k,
+                  _mm_add_ps(_mm_loadu_ps(right + k), _mm_cvtepi32_ps(r32)));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; k + 4 <= samples_per_channel; k += 4) {
+    const int16x4x2_t s16 = vld2_s16(interleaved + 2 * k);
+    const float32x4_t l = vcvtq_f32_s32(vmovl_s16(s16.val[0]));
+    const float32x4_t r = vcvtq_f32_s32(vmovl_s16(s16.val[1]));
+    vst1q_f32(left + k, vaddq_f32(vld1q_f32(left + k), l));
+    vst1q_f32(right + k, vaddq_f32(vld1q_f32(right + k), r));
+  }
+#endif
+  for (; k < samples_per_channel; ++k) {
+    left[k] += interleaved[2 * k];
+    right[k] += interleaved[2 * k + 1];
+  }
+}
+
 void MixToFloatFrame(const std::vector<AudioFrame*>& mix_list,
                      size_t samples_per_channel,
                      size_t number_of_channels,
@@ -85,16 +166,26 @@ void MixToFloatFrame(const std::vector<AudioFrame*>& mix_list,
     std::fill(one_channel_buffer.begin(), one_channel_buffer.end(), 0.f);
   }
 
-  // Convert to FloatS16 and mix.
+  const size_t channels = std::min(number_of_channels,
+                                   FrameCombiner::kMaximumNumberOfChannels);
+  const size_t samples =
+      std::min(samples_per_channel, FrameCombiner::kMaximumChannelSize);
+
+  // Convert to FloatS16 and mix. Mono and stereo, by far the common cases,
+  // take the vectorized kernels above; other channel counts fall back to
+  // the generic strided loop.
   for (size_t i = 0; i < mix_list.size(); ++i) {
     const AudioFrame* const frame = mix_list[i];
-    for (size_t j = 0; j < std::min(number_of_channels,
-                                    FrameCombiner::kMaximumNumberOfChannels);
-         ++j) {
-      for (size_t k = 0; k < std::min(samples_per_channel,
-                                      FrameCombiner::kMaximumChannelSize);
-           ++k) {
-        (*mixing_buffer)[j][k] += frame->data()[number_of_channels * k + j];
+    if (channels == 1) {
+      AccumulateMonoFrame(frame->data(), &(*mixing_buffer)[0][0], samples);
+    } else if (channels == 2) {
+      AccumulateStereoFrame(frame->data(), &(*mixing_buffer)[0][0],
+                            &(*mixing_buffer)[1][0], samples);
+    } else {
+      for (size_t j = 0; j < channels; ++j) {
+        for (size_t k = 0; k < samples; ++k) {
+          (*mixing_buffer)[j][k] += frame->data()[number_of_channels * k + j];
+        }
       }
     }
   }
@@ -60,6 +60,9 @@ struct FftData {
         power_spectrum[kFftLengthBy2] = re[kFftLengthBy2] * re[kFftLengthBy2] +
                                         im[kFftLengthBy2] * im[kFftLengthBy2];
       } break;
+      case Aec3Optimization::kAvx2:
+        SpectrumAVX2(power_spectrum);
+        break;
 #endif
       default:
         std::transform(re.begin(), re.end(), im.begin(), power_spectrum.begin(),
@@ -67,6 +70,12 @@ struct FftData {
     }
   }
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  // Computes the power spectrum of the data using AVX2. Defined in a separate
+  // translation unit that is compiled with AVX2 support.
+  void SpectrumAVX2(rtc::ArrayView<float> power_spectrum) const;
+#endif
+
   // Copy the data from an interleaved array.
   void CopyFromPackedArray(const std::array<float, kFftLength>& v) {
     re[0] = v[0];
@@ -58,6 +58,9 @@ class VectorMath {
           x[j] = sqrtf(x[j]);
         }
       } break;
+      case Aec3Optimization::kAvx2:
+        SqrtAVX2(x);
+        break;
 #endif
 #if defined(WEBRTC_HAS_NEON)
       case Aec3Optimization::kNeon: {
@@ -133,6 +136,9 @@ class VectorMath {
           z[j] = x[j] * y[j];
         }
       } break;
+      case Aec3Optimization::kAvx2:
+        MultiplyAVX2(x, y, z);
+        break;
 #endif
 #if defined(WEBRTC_HAS_NEON)
       case Aec3Optimization::kNeon: {
@@ -179,6 +185,9 @@ class VectorMath {
           z[j] += x[j];
         }
       } break;
+      case Aec3Optimization::kAvx2:
+        AccumulateAVX2(x, z);
+        break;
 #endif
 #if defined(WEBRTC_HAS_NEON)
       case Aec3Optimization::kNeon: {
@@ -204,6 +213,16 @@ class VectorMath {
     }
   }
 
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  // AVX2 variants of the operations above. Defined in a separate translation
+  // unit that is compiled with AVX2 support.
+  void SqrtAVX2(rtc::ArrayView<float> x);
+  void MultiplyAVX2(rtc::ArrayView<const float> x,
+                    rtc::ArrayView<const float> y,
+                    rtc::ArrayView<float> z);
+  void AccumulateAVX2(rtc::ArrayView<const float> x, rtc::ArrayView<float> z);
+#endif
+
  private:
   Aec3Optimization optimization_;
 };
@@ -20,6 +20,7 @@
 #include "modules/audio_processing/include/aec_dump.h"
 #include "rtc_base/ignore_wundef.h"
 #include "rtc_base/race_checker.h"
+#include "rtc_base/system/async_file_writer.h"
 #include "rtc_base/system/file_wrapper.h"
 #include "rtc_base/task_queue.h"
 #include "rtc_base/thread_annotations.h"
@@ -77,7 +78,10 @@ class AecDumpImpl : public AecDump {
  private:
   std::unique_ptr<WriteToFileTask> CreateWriteToFileTask();
 
-  FileWrapper debug_file_;
+  // Serialized protobuf messages are appended here; the actual disk writes
+  // happen on the writer's own thread so that stalls do not block the
+  // shared worker queue.
+  AsyncFileWriter debug_file_;
   int64_t num_bytes_left_for_log_ = 0;
   rtc::RaceChecker race_checker_;
   rtc::TaskQueue* worker_queue_;
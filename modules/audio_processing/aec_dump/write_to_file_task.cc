@@ -14,7 +14,7 @@
 
 namespace webrtc {
 
-WriteToFileTask::WriteToFileTask(webrtc::FileWrapper* debug_file,
+WriteToFileTask::WriteToFileTask(webrtc::AsyncFileWriter* debug_file,
                                  int64_t* num_bytes_left_for_log)
     : debug_file_(debug_file),
       num_bytes_left_for_log_(num_bytes_left_for_log) {}
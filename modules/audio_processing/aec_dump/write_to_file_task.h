@@ -19,7 +19,7 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/event.h"
 #include "rtc_base/ignore_wundef.h"
-#include "rtc_base/system/file_wrapper.h"
+#include "rtc_base/system/async_file_writer.h"
 
 // Files generated at build-time by the protobuf compiler.
 RTC_PUSH_IGNORING_WUNDEF()
@@ -34,7 +34,7 @@ namespace webrtc {
 
 class WriteToFileTask : public QueuedTask {
  public:
-  WriteToFileTask(webrtc::FileWrapper* debug_file,
+  WriteToFileTask(webrtc::AsyncFileWriter* debug_file,
                   int64_t* num_bytes_left_for_log);
   ~WriteToFileTask() override;
 
@@ -47,7 +47,7 @@ class WriteToFileTask : public QueuedTask {
 
   bool Run() override;
 
-  webrtc::FileWrapper* const debug_file_;
+  webrtc::AsyncFileWriter* const debug_file_;
   audioproc::Event event_;
   int64_t* const num_bytes_left_for_log_;
 };
@@ -10,6 +10,16 @@
 
 #include "modules/audio_processing/agc2/limiter.h"
 
+// Defines WEBRTC_ARCH_X86_FAMILY, used below.
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#endif
+
 #include <algorithm>
 #include <array>
 #include <cmath>
@@ -42,6 +52,37 @@ void InterpolateFirstSubframe(float last_factor,
   }
 }
 
+// Writes start + step * j for j in [0, ramp.size()), four samples per
+// iteration where SIMD is available. Matches the scalar expression exactly
+// (multiply then add) so the per-sample factors do not depend on the
+// architecture.
+void FillLinearRamp(float start, float step, rtc::ArrayView<float> ramp) {
+  const size_t n = ramp.size();
+  size_t j = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  const __m128 start_ps = _mm_set1_ps(start);
+  const __m128 step_ps = _mm_set1_ps(step);
+  const __m128 offsets = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+  for (; j + 4 <= n; j += 4) {
+    const __m128 indices =
+        _mm_add_ps(_mm_set1_ps(static_cast<float>(j)), offsets);
+    _mm_storeu_ps(&ramp[j],
+                  _mm_add_ps(start_ps, _mm_mul_ps(step_ps, indices)));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  const float32x4_t start_f32 = vdupq_n_f32(start);
+  const float32x4_t offsets = {0.f, 1.f, 2.f, 3.f};
+  for (; j + 4 <= n; j += 4) {
+    const float32x4_t indices =
+        vaddq_f32(vdupq_n_f32(static_cast<float>(j)), offsets);
+    vst1q_f32(&ramp[j], vmlaq_n_f32(start_f32, indices, step));
+  }
+#endif
+  for (; j < n; ++j) {
+    ramp[j] = start + step * j;
+  }
+}
+
 void ComputePerSampleSubframeFactors(
     const std::array<float, kSubFramesInFrame + 1>& scaling_factors,
     size_t samples_per_channel,
@@ -64,10 +105,9 @@ void ComputePerSampleSubframeFactors(
     const float scaling_start = scaling_factors[i];
     const float scaling_end = scaling_factors[i + 1];
     const float scaling_diff = (scaling_end - scaling_start) / subframe_size;
-    for (size_t j = 0; j < subframe_size; ++j) {
-      per_sample_scaling_factors[subframe_start + j] =
-          scaling_start + scaling_diff * j;
-    }
+    FillLinearRamp(scaling_start, scaling_diff,
+                   per_sample_scaling_factors.subview(subframe_start,
+                                                      subframe_size));
   }
 }
 
@@ -77,7 +117,27 @@ void ScaleSamples(rtc::ArrayView<const float> per_sample_scaling_factors,
   RTC_DCHECK_EQ(samples_per_channel, per_sample_scaling_factors.size());
   for (size_t i = 0; i < signal.num_channels(); ++i) {
     auto channel = signal.channel(i);
-    for (size_t j = 0; j < samples_per_channel; ++j) {
+    size_t j = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+    const __m128 min_ps = _mm_set1_ps(kMinFloatS16Value);
+    const __m128 max_ps = _mm_set1_ps(kMaxFloatS16Value);
+    for (; j + 4 <= samples_per_channel; j += 4) {
+      __m128 x = _mm_mul_ps(_mm_loadu_ps(&channel[j]),
+                            _mm_loadu_ps(&per_sample_scaling_factors[j]));
+      x = _mm_min_ps(_mm_max_ps(x, min_ps), max_ps);
+      _mm_storeu_ps(&channel[j], x);
+    }
+#elif defined(WEBRTC_HAS_NEON)
+    const float32x4_t min_f32 = vdupq_n_f32(kMinFloatS16Value);
+    const float32x4_t max_f32 = vdupq_n_f32(kMaxFloatS16Value);
+    for (; j + 4 <= samples_per_channel; j += 4) {
+      float32x4_t x = vmulq_f32(vld1q_f32(&channel[j]),
+                                vld1q_f32(&per_sample_scaling_factors[j]));
+      x = vminq_f32(vmaxq_f32(x, min_f32), max_f32);
+      vst1q_f32(&channel[j], x);
+    }
+#endif
+    for (; j < samples_per_channel; ++j) {
       channel[j] = rtc::SafeClamp(channel[j] * per_sample_scaling_factors[j],
                                   kMinFloatS16Value, kMaxFloatS16Value);
     }
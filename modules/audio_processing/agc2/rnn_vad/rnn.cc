@@ -227,9 +227,61 @@ void ComputeFullyConnectedLayerOutput(
   }
 }
 
+#if defined(WEBRTC_ARCH_X86_FAMILY) || defined(WEBRTC_HAS_NEON)
+
 #if defined(WEBRTC_ARCH_X86_FAMILY)
-// Fully connected layer SSE2 implementation.
-void ComputeFullyConnectedLayerOutputSse2(
+// Computes the dot product of |a| and |b| with SSE2 operations, falling back
+// to scalar operations for the remaining items.
+float DotProductSse2(rtc::ArrayView<const float> a,
+                     rtc::ArrayView<const float> b) {
+  RTC_DCHECK_EQ(a.size(), b.size());
+  const size_t size_by_4 = a.size() >> 2;
+  const size_t offset = a.size() & ~3;
+  __m128 sum_128 = _mm_set1_ps(0);
+  const float* v = reinterpret_cast<const float*>(&sum_128);
+  const float* a_p = a.data();
+  const float* b_p = b.data();
+  for (size_t i = 0; i < size_by_4; ++i, a_p += 4, b_p += 4) {
+    sum_128 =
+        _mm_add_ps(sum_128, _mm_mul_ps(_mm_loadu_ps(a_p), _mm_loadu_ps(b_p)));
+  }
+  return std::inner_product(a.begin() + offset, a.end(), b.begin() + offset,
+                            v[0] + v[1] + v[2] + v[3]);
+}
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+// Computes the dot product of |a| and |b| with NEON operations, falling back
+// to scalar operations for the remaining items.
+float DotProductNeon(rtc::ArrayView<const float> a,
+                     rtc::ArrayView<const float> b) {
+  RTC_DCHECK_EQ(a.size(), b.size());
+  const size_t size_by_4 = a.size() >> 2;
+  const size_t offset = a.size() & ~3;
+  float32x4_t sum_f32x4 = vdupq_n_f32(0.f);
+  for (size_t i = 0; i < size_by_4; ++i) {
+    sum_f32x4 = vmlaq_f32(sum_f32x4, vld1q_f32(a.data() + 4 * i),
+                          vld1q_f32(b.data() + 4 * i));
+  }
+#if defined(WEBRTC_ARCH_ARM64)
+  const float sum = vaddvq_f32(sum_f32x4);
+#else
+  const float32x2_t sum_f32x2 =
+      vadd_f32(vget_low_f32(sum_f32x4), vget_high_f32(sum_f32x4));
+  const float sum = vget_lane_f32(vpadd_f32(sum_f32x2, sum_f32x2), 0);
+#endif
+  return std::inner_product(a.begin() + offset, a.end(), b.begin() + offset,
+                            sum);
+}
+#endif
+
+using DotProductFn = float (*)(rtc::ArrayView<const float> a,
+                               rtc::ArrayView<const float> b);
+
+// Fully connected layer implementation shared by the vectorized
+// optimizations, which only differ in the dot product kernel.
+void ComputeFullyConnectedLayerOutputVectorized(
+    DotProductFn dot_product,
     size_t input_size,
     size_t output_size,
     rtc::ArrayView<const float> input,
@@ -240,28 +292,109 @@ void ComputeFullyConnectedLayerOutputSse2(
   RTC_DCHECK_EQ(input.size(), input_size);
   RTC_DCHECK_EQ(bias.size(), output_size);
   RTC_DCHECK_EQ(weights.size(), input_size * output_size);
-  const size_t input_size_by_4 = input_size >> 2;
-  const size_t offset = input_size & ~3;
-  __m128 sum_wx_128;
-  const float* v = reinterpret_cast<const float*>(&sum_wx_128);
   for (size_t o = 0; o < output_size; ++o) {
-    // Perform 128 bit vector operations.
-    sum_wx_128 = _mm_set1_ps(0);
-    const float* x_p = input.data();
-    const float* w_p = weights.data() + o * input_size;
-    for (size_t i = 0; i < input_size_by_4; ++i, x_p += 4, w_p += 4) {
-      sum_wx_128 = _mm_add_ps(sum_wx_128,
-                              _mm_mul_ps(_mm_loadu_ps(x_p), _mm_loadu_ps(w_p)));
-    }
-    // Perform non-vector operations for any remaining items, sum up bias term
-    // and results from the vectorized code, and apply the activation function.
     output[o] = activation_function(
-        std::inner_product(input.begin() + offset, input.end(),
-                           weights.begin() + o * input_size + offset,
-                           bias[o] + v[0] + v[1] + v[2] + v[3]));
+        bias[o] +
+        dot_product(input, weights.subview(o * input_size, input_size)));
   }
 }
-#endif
+
+// Update/reset gate computation shared by the vectorized GRU optimizations.
+void ComputeGruUpdateResetGatesVectorized(
+    DotProductFn dot_product,
+    size_t input_size,
+    size_t output_size,
+    rtc::ArrayView<const float> weights,
+    rtc::ArrayView<const float> recurrent_weights,
+    rtc::ArrayView<const float> bias,
+    rtc::ArrayView<const float> input,
+    rtc::ArrayView<const float> state,
+    rtc::ArrayView<float> gate) {
+  for (size_t o = 0; o < output_size; ++o) {
+    gate[o] = SigmoidApproximated(
+        bias[o] +
+        dot_product(input, weights.subview(o * input_size, input_size)) +
+        dot_product(state.subview(0, output_size),
+                    recurrent_weights.subview(o * output_size, output_size)));
+  }
+}
+
+// Output gate computation shared by the vectorized GRU optimizations. The
+// recurrent state is gated with the reset gate up front so that the inner
+// loops reduce to plain dot products.
+void ComputeGruOutputGateVectorized(
+    DotProductFn dot_product,
+    size_t input_size,
+    size_t output_size,
+    rtc::ArrayView<const float> weights,
+    rtc::ArrayView<const float> recurrent_weights,
+    rtc::ArrayView<const float> bias,
+    rtc::ArrayView<const float> input,
+    rtc::ArrayView<const float> state,
+    rtc::ArrayView<const float> reset,
+    rtc::ArrayView<float> gate) {
+  std::array<float, kRecurrentLayersMaxUnits> gated_state;
+  for (size_t s = 0; s < output_size; ++s) {
+    gated_state[s] = state[s] * reset[s];
+  }
+  const rtc::ArrayView<const float> gated_state_view(gated_state.data(),
+                                                     output_size);
+  for (size_t o = 0; o < output_size; ++o) {
+    gate[o] = RectifiedLinearUnit(
+        bias[o] +
+        dot_product(input, weights.subview(o * input_size, input_size)) +
+        dot_product(gated_state_view,
+                    recurrent_weights.subview(o * output_size, output_size)));
+  }
+}
+
+// Vectorized GRU layer implementation, parametrized by the dot product
+// kernel.
+void ComputeGruLayerOutputVectorized(
+    DotProductFn dot_product,
+    size_t input_size,
+    size_t output_size,
+    rtc::ArrayView<const float> input,
+    rtc::ArrayView<const float> weights,
+    rtc::ArrayView<const float> recurrent_weights,
+    rtc::ArrayView<const float> bias,
+    rtc::ArrayView<float> state) {
+  RTC_DCHECK_EQ(input_size, input.size());
+  // Stride and offset used to read parameter arrays.
+  const size_t stride_in = input_size * output_size;
+  const size_t stride_out = output_size * output_size;
+
+  // Update gate.
+  std::array<float, kRecurrentLayersMaxUnits> update;
+  ComputeGruUpdateResetGatesVectorized(
+      dot_product, input_size, output_size, weights.subview(0, stride_in),
+      recurrent_weights.subview(0, stride_out), bias.subview(0, output_size),
+      input, state, update);
+
+  // Reset gate.
+  std::array<float, kRecurrentLayersMaxUnits> reset;
+  ComputeGruUpdateResetGatesVectorized(
+      dot_product, input_size, output_size,
+      weights.subview(stride_in, stride_in),
+      recurrent_weights.subview(stride_out, stride_out),
+      bias.subview(output_size, output_size), input, state, reset);
+
+  // Output gate.
+  std::array<float, kRecurrentLayersMaxUnits> output;
+  ComputeGruOutputGateVectorized(
+      dot_product, input_size, output_size,
+      weights.subview(2 * stride_in, stride_in),
+      recurrent_weights.subview(2 * stride_out, stride_out),
+      bias.subview(2 * output_size, output_size), input, state, reset, output);
+
+  // Update output through the update gates and update the state.
+  for (size_t o = 0; o < output_size; ++o) {
+    output[o] = update[o] * state[o] + (1.f - update[o]) * output[o];
+    state[o] = output[o];
+  }
+}
+
+#endif  // defined(WEBRTC_ARCH_X86_FAMILY) || defined(WEBRTC_HAS_NEON)
 
 }  // namespace
 
@@ -297,16 +430,16 @@ void FullyConnectedLayer::ComputeOutput(rtc::ArrayView<const float> input) {
   switch (optimization_) {
 #if defined(WEBRTC_ARCH_X86_FAMILY)
     case Optimization::kSse2:
-      ComputeFullyConnectedLayerOutputSse2(input_size_, output_size_, input,
-                                           bias_, weights_,
-                                           activation_function_, output_);
+      ComputeFullyConnectedLayerOutputVectorized(
+          &DotProductSse2, input_size_, output_size_, input, bias_, weights_,
+          activation_function_, output_);
       break;
 #endif
 #if defined(WEBRTC_HAS_NEON)
     case Optimization::kNeon:
-      // TODO(bugs.chromium.org/10480): Handle Optimization::kNeon.
-      ComputeFullyConnectedLayerOutput(input_size_, output_size_, input, bias_,
-                                       weights_, activation_function_, output_);
+      ComputeFullyConnectedLayerOutputVectorized(
+          &DotProductNeon, input_size_, output_size_, input, bias_, weights_,
+          activation_function_, output_);
       break;
 #endif
     default:
@@ -354,24 +487,30 @@ void GatedRecurrentLayer::Reset() {
 }
 
 void GatedRecurrentLayer::ComputeOutput(rtc::ArrayView<const float> input) {
+  ComputeOutput(input, state_);
+}
+
+void GatedRecurrentLayer::ComputeOutput(rtc::ArrayView<const float> input,
+                                        rtc::ArrayView<float> state) {
+  RTC_DCHECK_GE(state.size(), output_size_);
   switch (optimization_) {
 #if defined(WEBRTC_ARCH_X86_FAMILY)
     case Optimization::kSse2:
-      // TODO(bugs.chromium.org/10480): Handle Optimization::kSse2.
-      ComputeGruLayerOutput(input_size_, output_size_, input, weights_,
-                            recurrent_weights_, bias_, state_);
+      ComputeGruLayerOutputVectorized(&DotProductSse2, input_size_,
+                                      output_size_, input, weights_,
+                                      recurrent_weights_, bias_, state);
       break;
 #endif
 #if defined(WEBRTC_HAS_NEON)
     case Optimization::kNeon:
-      // TODO(bugs.chromium.org/10480): Handle Optimization::kNeon.
-      ComputeGruLayerOutput(input_size_, output_size_, input, weights_,
-                            recurrent_weights_, bias_, state_);
+      ComputeGruLayerOutputVectorized(&DotProductNeon, input_size_,
+                                      output_size_, input, weights_,
+                                      recurrent_weights_, bias_, state);
       break;
 #endif
     default:
       ComputeGruLayerOutput(input_size_, output_size_, input, weights_,
-                            recurrent_weights_, bias_, state_);
+                            recurrent_weights_, bias_, state);
   }
 }
 
@@ -421,5 +560,65 @@ float RnnBasedVad::ComputeVadProbability(
   return vad_output[0];
 }
 
+BatchedRnnVad::BatchedRnnVad(size_t num_streams)
+    : input_layer_(kInputLayerInputSize,
+                   kInputLayerOutputSize,
+                   kInputDenseBias,
+                   kInputDenseWeights,
+                   TansigApproximated,
+                   DetectOptimization()),
+      hidden_layer_(kInputLayerOutputSize,
+                    kHiddenLayerOutputSize,
+                    kHiddenGruBias,
+                    kHiddenGruWeights,
+                    kHiddenGruRecurrentWeights,
+                    DetectOptimization()),
+      output_layer_(kHiddenLayerOutputSize,
+                    kOutputLayerOutputSize,
+                    kOutputDenseBias,
+                    kOutputDenseWeights,
+                    SigmoidApproximated,
+                    DetectOptimization()),
+      states_(num_streams) {
+  RTC_DCHECK_GT(num_streams, 0);
+  // Input-output chaining size checks.
+  RTC_DCHECK_EQ(input_layer_.output_size(), hidden_layer_.input_size())
+      << "The input and the hidden layers sizes do not match.";
+  RTC_DCHECK_EQ(hidden_layer_.output_size(), output_layer_.input_size())
+      << "The hidden and the output layers sizes do not match.";
+  for (size_t stream = 0; stream < states_.size(); ++stream) {
+    Reset(stream);
+  }
+}
+
+BatchedRnnVad::~BatchedRnnVad() = default;
+
+void BatchedRnnVad::Reset(size_t stream) {
+  RTC_DCHECK_LT(stream, states_.size());
+  states_[stream].fill(0.f);
+}
+
+void BatchedRnnVad::ComputeVadProbabilities(
+    rtc::ArrayView<const float> feature_vectors,
+    rtc::ArrayView<const bool> is_silence,
+    rtc::ArrayView<float> probabilities) {
+  RTC_DCHECK_EQ(states_.size() * kFeatureVectorSize, feature_vectors.size());
+  RTC_DCHECK_EQ(states_.size(), is_silence.size());
+  RTC_DCHECK_EQ(states_.size(), probabilities.size());
+  for (size_t stream = 0; stream < states_.size(); ++stream) {
+    if (is_silence[stream]) {
+      Reset(stream);
+      probabilities[stream] = 0.f;
+      continue;
+    }
+    input_layer_.ComputeOutput(feature_vectors.subview(
+        stream * kFeatureVectorSize, kFeatureVectorSize));
+    hidden_layer_.ComputeOutput(input_layer_.GetOutput(), states_[stream]);
+    output_layer_.ComputeOutput(rtc::ArrayView<const float>(
+        states_[stream].data(), hidden_layer_.output_size()));
+    probabilities[stream] = output_layer_.GetOutput()[0];
+  }
+}
+
 }  // namespace rnn_vad
 }  // namespace webrtc
@@ -88,6 +88,11 @@ class GatedRecurrentLayer {
   void Reset();
   // Computes the recurrent layer output and updates the status.
   void ComputeOutput(rtc::ArrayView<const float> input);
+  // Like the above, but reads and updates the externally stored |state|,
+  // which must have at least output_size() elements. Used to run several
+  // independent streams through a single set of layer weights.
+  void ComputeOutput(rtc::ArrayView<const float> input,
+                     rtc::ArrayView<float> state);
 
  private:
   const size_t input_size_;
@@ -120,6 +125,36 @@ class RnnBasedVad {
   FullyConnectedLayer output_layer_;
 };
 
+// Recurrent network based VAD for a batch of independent streams. All the
+// streams share a single set of network weights, while the recurrent state is
+// kept separately for each stream; processing the streams back to back hence
+// loads the weights into the cache once per batch instead of once per stream.
+class BatchedRnnVad {
+ public:
+  explicit BatchedRnnVad(size_t num_streams);
+  BatchedRnnVad(const BatchedRnnVad&) = delete;
+  BatchedRnnVad& operator=(const BatchedRnnVad&) = delete;
+  ~BatchedRnnVad();
+  size_t num_streams() const { return states_.size(); }
+  // Resets the recurrent state of the given stream.
+  void Reset(size_t stream);
+  // Computes the probability of voice (range: [0.0, 1.0]) for every stream.
+  // |feature_vectors| is the concatenation of num_streams() feature vectors
+  // of kFeatureVectorSize elements each and |is_silence| holds one flag per
+  // stream; streams flagged as silent are reset and get probability 0.
+  // |probabilities| is filled with one probability per stream.
+  void ComputeVadProbabilities(rtc::ArrayView<const float> feature_vectors,
+                               rtc::ArrayView<const bool> is_silence,
+                               rtc::ArrayView<float> probabilities);
+
+ private:
+  FullyConnectedLayer input_layer_;
+  GatedRecurrentLayer hidden_layer_;
+  FullyConnectedLayer output_layer_;
+  // Per-stream recurrent state for |hidden_layer_|.
+  std::vector<std::array<float, kRecurrentLayersMaxUnits>> states_;
+};
+
 }  // namespace rnn_vad
 }  // namespace webrtc
 
@@ -199,6 +199,73 @@ TEST(RnnVadTest, CheckGatedRecurrentLayerSse2) {
 
 #endif  // WEBRTC_ARCH_X86_FAMILY
 
+#if defined(WEBRTC_HAS_NEON)
+
+// Like CheckFullyConnectedLayerOutput, but testing the NEON implementation.
+TEST(RnnVadTest, CheckFullyConnectedLayerOutputNeon) {
+  if (!IsOptimizationAvailable(Optimization::kNeon)) {
+    return;
+  }
+
+  FullyConnectedLayer fc(rnnoise::kInputLayerInputSize,
+                         rnnoise::kInputLayerOutputSize,
+                         rnnoise::kInputDenseBias, rnnoise::kInputDenseWeights,
+                         rnnoise::TansigApproximated, Optimization::kNeon);
+  TestFullyConnectedLayer(&fc, kFullyConnectedInputVector,
+                          kFullyConnectedExpectedOutput);
+}
+
+// Like CheckGatedRecurrentLayer, but testing the NEON implementation.
+TEST(RnnVadTest, CheckGatedRecurrentLayerNeon) {
+  if (!IsOptimizationAvailable(Optimization::kNeon)) {
+    return;
+  }
+
+  GatedRecurrentLayer gru(kGruInputSize, kGruOutputSize, kGruBias, kGruWeights,
+                          kGruRecurrentWeights, Optimization::kNeon);
+  TestGatedRecurrentLayer(&gru, kGruInputSequence, kGruExpectedOutputSequence);
+}
+
+#endif  // WEBRTC_HAS_NEON
+
+// Checks that the batched VAD produces the same probabilities as separate
+// single-stream VADs fed with the same feature vectors.
+TEST(RnnVadTest, BatchedRnnVadMatchesSingleStream) {
+  constexpr size_t kNumStreams = 3;
+  BatchedRnnVad batched_vad(kNumStreams);
+  RnnBasedVad single_stream_vads[kNumStreams];
+  // Derive a distinct feature vector for every stream.
+  std::array<float, kNumStreams * kFeatureVectorSize> feature_vectors;
+  for (size_t stream = 0; stream < kNumStreams; ++stream) {
+    for (size_t i = 0; i < kFeatureVectorSize; ++i) {
+      feature_vectors[stream * kFeatureVectorSize + i] =
+          kFullyConnectedInputVector[i] * (0.5f + 0.25f * stream);
+    }
+  }
+  std::array<bool, kNumStreams> is_silence;
+  std::array<float, kNumStreams> probabilities;
+  constexpr size_t kNumFrames = 5;
+  for (size_t frame = 0; frame < kNumFrames; ++frame) {
+    SCOPED_TRACE(frame);
+    for (size_t stream = 0; stream < kNumStreams; ++stream) {
+      // Flag one stream as silent in one frame to exercise the reset path.
+      is_silence[stream] = frame == 2 && stream == 1;
+    }
+    batched_vad.ComputeVadProbabilities(feature_vectors, is_silence,
+                                        probabilities);
+    for (size_t stream = 0; stream < kNumStreams; ++stream) {
+      SCOPED_TRACE(stream);
+      const float expected_probability =
+          single_stream_vads[stream].ComputeVadProbability(
+              rtc::ArrayView<const float, kFeatureVectorSize>(
+                  feature_vectors.data() + stream * kFeatureVectorSize,
+                  kFeatureVectorSize),
+              is_silence[stream]);
+      EXPECT_EQ(expected_probability, probabilities[stream]);
+    }
+  }
+}
+
 TEST(RnnVadTest, DISABLED_BenchmarkFullyConnectedLayer) {
   std::vector<std::unique_ptr<FullyConnectedLayer>> implementations;
   implementations.emplace_back(std::make_unique<FullyConnectedLayer>(
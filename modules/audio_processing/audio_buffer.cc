@@ -323,9 +323,7 @@ void AudioBuffer::CopyTo(const StreamConfig& stream_config,
         resampling_required ? float_buffer.data() : data_->channels()[0];
 
     if (config_num_channels == 1) {
-      for (size_t j = 0; j < output_num_frames_; ++j) {
-        interleaved[j] = FloatS16ToS16(deinterleaved[j]);
-      }
+      FloatS16ToS16(deinterleaved, output_num_frames_, interleaved);
     } else {
       for (size_t i = 0, k = 0; i < output_num_frames_; ++i) {
         float tmp = FloatS16ToS16(deinterleaved[i]);
@@ -225,6 +225,15 @@ bool AudioProcessingImpl::SubmoduleStates::RenderMultiBandProcessingActive()
   return false;
 }
 
+bool AudioProcessingImpl::SubmoduleStates::ResidualEchoDetectorActive() const {
+  return residual_echo_detector_enabled_;
+}
+
+bool AudioProcessingImpl::SubmoduleStates::RenderAnalysisActive() const {
+  return RenderMultiBandSubModulesActive() ||
+         RenderFullBandProcessingActive() || residual_echo_detector_enabled_;
+}
+
 bool AudioProcessingImpl::SubmoduleStates::HighPassFilteringRequired() const {
   return high_pass_filter_enabled_ || mobile_echo_controller_enabled_ ||
          noise_suppressor_enabled_;
@@ -422,6 +431,8 @@ int AudioProcessingImpl::InitializeLocked() {
   InitializePostProcessor();
   InitializePreProcessor();
 
+  CompileCapturePipeline();
+
   if (aec_dump_) {
     aec_dump_->WriteInitMessage(formats_.api_format, rtc::TimeUTCMillis());
   }
@@ -635,6 +646,8 @@ void AudioProcessingImpl::ApplyConfig(const AudioProcessing::Config& config) {
   // additional reinitializations on the next capture / render processing call.
   if (pipeline_config_changed) {
     InitializeLocked(formats_.api_format);
+  } else {
+    CompileCapturePipeline();
   }
 }
 
@@ -811,6 +824,60 @@ int AudioProcessingImpl::ProcessStream(const float* const* src,
   return kNoError;
 }
 
+int AudioProcessingImpl::ProcessStreams(
+    rtc::ArrayView<const float* const> src_streams,
+    const StreamConfig& stream_config,
+    rtc::ArrayView<float* const> dest_streams) {
+  TRACE_EVENT0("webrtc", "AudioProcessing::ProcessStreams_StreamConfig");
+  if (src_streams.empty() || src_streams.size() != dest_streams.size()) {
+    return kBadNumberChannelsError;
+  }
+  if (stream_config.num_channels() != 1u || stream_config.has_keyboard()) {
+    return kBadNumberChannelsError;
+  }
+  for (const float* src : src_streams) {
+    if (!src) {
+      return kNullPointerError;
+    }
+  }
+  for (float* dest : dest_streams) {
+    if (!dest) {
+      return kNullPointerError;
+    }
+  }
+
+  // Map the streams onto the channels of a single capture pass so that the
+  // lock acquisition, the render queue and runtime setting draining and the
+  // submodule dispatch are shared by the whole batch.
+  const StreamConfig batched_config(stream_config.sample_rate_hz(),
+                                    src_streams.size());
+  RETURN_ON_ERR(MaybeInitializeCapture(batched_config, batched_config));
+
+  rtc::CritScope cs_capture(&crit_capture_);
+
+  if (aec_dump_) {
+    RecordUnprocessedCaptureStream(src_streams.data());
+  }
+
+  capture_.capture_audio->CopyFrom(src_streams.data(), batched_config);
+  if (capture_.capture_fullband_audio) {
+    capture_.capture_fullband_audio->CopyFrom(src_streams.data(),
+                                              batched_config);
+  }
+  RETURN_ON_ERR(ProcessCaptureStreamLocked());
+  if (capture_.capture_fullband_audio) {
+    capture_.capture_fullband_audio->CopyTo(batched_config,
+                                            dest_streams.data());
+  } else {
+    capture_.capture_audio->CopyTo(batched_config, dest_streams.data());
+  }
+
+  if (aec_dump_) {
+    RecordProcessedCaptureStream(dest_streams.data());
+  }
+  return kNoError;
+}
+
 void AudioProcessingImpl::HandleCaptureRuntimeSettings() {
   RuntimeSetting setting;
   while (capture_runtime_settings_.Remove(&setting)) {
@@ -1060,259 +1127,428 @@ int AudioProcessingImpl::ProcessCaptureStreamLocked() {
   RTC_DCHECK_LE(
       !!submodules_.echo_controller + !!submodules_.echo_control_mobile, 1);
 
-  AudioBuffer* capture_buffer = capture_.capture_audio.get();  // For brevity.
-  AudioBuffer* linear_aec_buffer = capture_.linear_aec_output.get();
-
-  if (submodules_.high_pass_filter &&
-      config_.high_pass_filter.apply_in_full_band &&
-      !constants_.enforce_split_band_hpf) {
-    submodules_.high_pass_filter->Process(capture_buffer,
-                                          /*use_split_band_data=*/false);
+  // Run the stages that CompileCapturePipeline() scheduled for the current
+  // configuration.
+  for (CaptureStage stage : capture_pipeline_) {
+    RETURN_ON_ERR((this->*stage)());
   }
 
-  if (submodules_.pre_amplifier) {
-    submodules_.pre_amplifier->ApplyGain(AudioFrameView<float>(
-        capture_buffer->channels(), capture_buffer->num_channels(),
-        capture_buffer->num_frames()));
-  }
+  AudioBuffer* capture_buffer = FullBandCaptureBuffer();  // For brevity.
 
-  capture_input_rms_.Analyze(rtc::ArrayView<const float>(
+  capture_output_rms_.Analyze(rtc::ArrayView<const float>(
       capture_buffer->channels_const()[0],
       capture_nonlocked_.capture_processing_format.num_frames()));
-  const bool log_rms = ++capture_rms_interval_counter_ >= 1000;
-  if (log_rms) {
-    capture_rms_interval_counter_ = 0;
-    RmsLevel::Levels levels = capture_input_rms_.AverageAndPeak();
-    RTC_HISTOGRAM_COUNTS_LINEAR("WebRTC.Audio.ApmCaptureInputLevelAverageRms",
+  if (capture_rms_log_frame_) {
+    RmsLevel::Levels levels = capture_output_rms_.AverageAndPeak();
+    RTC_HISTOGRAM_COUNTS_LINEAR("WebRTC.Audio.ApmCaptureOutputLevelAverageRms",
                                 levels.average, 1, RmsLevel::kMinLevelDb, 64);
-    RTC_HISTOGRAM_COUNTS_LINEAR("WebRTC.Audio.ApmCaptureInputLevelPeakRms",
+    RTC_HISTOGRAM_COUNTS_LINEAR("WebRTC.Audio.ApmCaptureOutputLevelPeakRms",
                                 levels.peak, 1, RmsLevel::kMinLevelDb, 64);
   }
 
+  if (submodules_.agc_manager) {
+    int level = recommended_stream_analog_level_locked();
+    data_dumper_->DumpRaw("experimental_gain_control_stream_analog_level", 1,
+                          &level);
+  }
+
+  // Compute echo-related stats.
   if (submodules_.echo_controller) {
-    // Detect and flag any change in the analog gain.
-    int analog_mic_level = recommended_stream_analog_level_locked();
-    capture_.echo_path_gain_change =
-        capture_.prev_analog_mic_level != analog_mic_level &&
-        capture_.prev_analog_mic_level != -1;
-    capture_.prev_analog_mic_level = analog_mic_level;
-
-    // Detect and flag any change in the pre-amplifier gain.
-    if (submodules_.pre_amplifier) {
-      float pre_amp_gain = submodules_.pre_amplifier->GetGainFactor();
-      capture_.echo_path_gain_change =
-          capture_.echo_path_gain_change ||
-          (capture_.prev_pre_amp_gain != pre_amp_gain &&
-           capture_.prev_pre_amp_gain >= 0.f);
-      capture_.prev_pre_amp_gain = pre_amp_gain;
-    }
+    auto ec_metrics = submodules_.echo_controller->GetMetrics();
+    capture_.stats.echo_return_loss = ec_metrics.echo_return_loss;
+    capture_.stats.echo_return_loss_enhancement =
+        ec_metrics.echo_return_loss_enhancement;
+    capture_.stats.delay_ms = ec_metrics.delay_ms;
+  }
+  if (config_.residual_echo_detector.enabled) {
+    RTC_DCHECK(submodules_.echo_detector);
+    auto ed_metrics = submodules_.echo_detector->GetMetrics();
+    capture_.stats.residual_echo_likelihood = ed_metrics.echo_likelihood;
+    capture_.stats.residual_echo_likelihood_recent_max =
+        ed_metrics.echo_likelihood_recent_max;
+  }
 
-    // Detect volume change.
-    capture_.echo_path_gain_change =
-        capture_.echo_path_gain_change ||
-        (capture_.prev_playout_volume != capture_.playout_volume &&
-         capture_.prev_playout_volume >= 0);
-    capture_.prev_playout_volume = capture_.playout_volume;
+  // Pass stats for reporting.
+  stats_reporter_.UpdateStatistics(capture_.stats);
+
+  capture_.was_stream_delay_set = false;
+  return kNoError;
+}
+
+void AudioProcessingImpl::CompileCapturePipeline() {
+  // The conditions below mirror, in the original processing order, the
+  // branches that used to be evaluated for every frame in
+  // ProcessCaptureStreamLocked(). They only depend on the configuration and
+  // on which submodules have been created, both of which change solely in
+  // ApplyConfig() and InitializeLocked(); branching on per-frame data stays
+  // inside the stage bodies.
+  capture_pipeline_.clear();
+
+  if (submodules_.high_pass_filter &&
+      config_.high_pass_filter.apply_in_full_band &&
+      !constants_.enforce_split_band_hpf) {
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageHighPassFilterFullBand);
+  }
+
+  if (submodules_.pre_amplifier) {
+    capture_pipeline_.push_back(&AudioProcessingImpl::StagePreAmplifier);
+  }
+
+  capture_pipeline_.push_back(&AudioProcessingImpl::StageAnalyzeInputRms);
 
-    submodules_.echo_controller->AnalyzeCapture(capture_buffer);
+  if (submodules_.echo_controller) {
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageEchoControllerAnalyze);
   }
 
   if (submodules_.agc_manager) {
-    submodules_.agc_manager->AnalyzePreProcess(capture_buffer);
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageAgc1AnalyzePreProcess);
   }
 
   if (submodule_states_.CaptureMultiBandSubModulesActive() &&
       SampleRateSupportsMultiBand(
           capture_nonlocked_.capture_processing_format.sample_rate_hz())) {
-    capture_buffer->SplitIntoFrequencyBands();
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageSplitIntoFrequencyBands);
   }
 
   const bool multi_channel_capture = config_.pipeline.multi_channel_capture &&
                                      constants_.multi_channel_capture_support;
   if (submodules_.echo_controller && !multi_channel_capture) {
-    // Force down-mixing of the number of channels after the detection of
-    // capture signal saturation.
-    // TODO(peah): Look into ensuring that this kind of tampering with the
-    // AudioBuffer functionality should not be needed.
-    capture_buffer->set_num_channels(1);
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageDownmixForEchoController);
   }
 
   if (submodules_.high_pass_filter &&
       (!config_.high_pass_filter.apply_in_full_band ||
        constants_.enforce_split_band_hpf)) {
-    submodules_.high_pass_filter->Process(capture_buffer,
-                                          /*use_split_band_data=*/true);
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageHighPassFilterSplitBand);
   }
 
   if (submodules_.gain_control) {
-    RETURN_ON_ERR(
-        submodules_.gain_control->AnalyzeCaptureAudio(*capture_buffer));
+    capture_pipeline_.push_back(&AudioProcessingImpl::StageGainControlAnalyze);
   }
 
   if ((!config_.noise_suppression.analyze_linear_aec_output_when_available ||
-       !linear_aec_buffer || submodules_.echo_control_mobile) &&
+       !capture_.linear_aec_output || submodules_.echo_control_mobile) &&
       submodules_.noise_suppressor) {
-    submodules_.noise_suppressor->Analyze(*capture_buffer);
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageNoiseSuppressorAnalyze);
   }
 
   if (submodules_.echo_control_mobile) {
-    // Ensure that the stream delay was set before the call to the
-    // AECM ProcessCaptureAudio function.
-    if (!capture_.was_stream_delay_set) {
-      return AudioProcessing::kStreamParameterNotSetError;
-    }
+    capture_pipeline_.push_back(&AudioProcessingImpl::StageCheckStreamDelay);
 
     if (submodules_.noise_suppressor) {
-      submodules_.noise_suppressor->Process(capture_buffer);
+      capture_pipeline_.push_back(
+          &AudioProcessingImpl::StageNoiseSuppressorProcess);
     }
 
-    RETURN_ON_ERR(submodules_.echo_control_mobile->ProcessCaptureAudio(
-        capture_buffer, stream_delay_ms()));
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageEchoControlMobileProcess);
   } else {
     if (submodules_.echo_controller) {
-      data_dumper_->DumpRaw("stream_delay", stream_delay_ms());
-
-      if (capture_.was_stream_delay_set) {
-        submodules_.echo_controller->SetAudioBufferDelay(stream_delay_ms());
-      }
-
-      submodules_.echo_controller->ProcessCapture(
-          capture_buffer, linear_aec_buffer, capture_.echo_path_gain_change);
+      capture_pipeline_.push_back(
+          &AudioProcessingImpl::StageEchoControllerProcess);
     }
 
     if (config_.noise_suppression.analyze_linear_aec_output_when_available &&
-        linear_aec_buffer && submodules_.noise_suppressor) {
-      submodules_.noise_suppressor->Analyze(*linear_aec_buffer);
+        capture_.linear_aec_output && submodules_.noise_suppressor) {
+      capture_pipeline_.push_back(
+          &AudioProcessingImpl::StageNoiseSuppressorAnalyzeLinearAecOutput);
     }
 
     if (submodules_.noise_suppressor) {
-      submodules_.noise_suppressor->Process(capture_buffer);
+      capture_pipeline_.push_back(
+          &AudioProcessingImpl::StageNoiseSuppressorProcess);
     }
   }
 
   if (config_.voice_detection.enabled) {
-    capture_.stats.voice_detected =
-        submodules_.voice_detector->ProcessCaptureAudio(capture_buffer);
+    capture_pipeline_.push_back(&AudioProcessingImpl::StageVoiceDetector);
   } else {
     capture_.stats.voice_detected = absl::nullopt;
   }
 
   if (submodules_.agc_manager) {
-    submodules_.agc_manager->Process(capture_buffer);
-
-    absl::optional<int> new_digital_gain =
-        submodules_.agc_manager->GetDigitalComressionGain();
-    if (new_digital_gain && submodules_.gain_control) {
-      submodules_.gain_control->set_compression_gain_db(*new_digital_gain);
-    }
+    capture_pipeline_.push_back(&AudioProcessingImpl::StageAgc1Process);
   }
 
   if (submodules_.gain_control) {
-    // TODO(peah): Add reporting from AEC3 whether there is echo.
-    RETURN_ON_ERR(submodules_.gain_control->ProcessCaptureAudio(
-        capture_buffer, /*stream_has_echo*/ false));
+    capture_pipeline_.push_back(&AudioProcessingImpl::StageGainControlProcess);
   }
 
   if (submodule_states_.CaptureMultiBandProcessingPresent() &&
       SampleRateSupportsMultiBand(
           capture_nonlocked_.capture_processing_format.sample_rate_hz())) {
-    capture_buffer->MergeFrequencyBands();
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageMergeFrequencyBands);
   }
 
   if (capture_.capture_fullband_audio) {
-    const auto& ec = submodules_.echo_controller;
-    bool ec_active = ec ? ec->ActiveProcessing() : false;
-    // Only update the fullband buffer if the multiband processing has changed
-    // the signal. Keep the original signal otherwise.
-    if (submodule_states_.CaptureMultiBandProcessingActive(ec_active)) {
-      capture_buffer->CopyTo(capture_.capture_fullband_audio.get());
-    }
-    capture_buffer = capture_.capture_fullband_audio.get();
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageCopyToFullBandBuffer);
   }
 
   if (config_.residual_echo_detector.enabled) {
     RTC_DCHECK(submodules_.echo_detector);
-    submodules_.echo_detector->AnalyzeCaptureAudio(rtc::ArrayView<const float>(
-        capture_buffer->channels()[0], capture_buffer->num_frames()));
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageEchoDetectorAnalyze);
   }
 
-  // TODO(aluebs): Investigate if the transient suppression placement should be
-  // before or after the AGC.
   if (submodules_.transient_suppressor) {
-    float voice_probability = submodules_.agc_manager.get()
-                                  ? submodules_.agc_manager->voice_probability()
-                                  : 1.f;
-
-    submodules_.transient_suppressor->Suppress(
-        capture_buffer->channels()[0], capture_buffer->num_frames(),
-        capture_buffer->num_channels(),
-        capture_buffer->split_bands_const(0)[kBand0To8kHz],
-        capture_buffer->num_frames_per_band(),
-        capture_.keyboard_info.keyboard_data,
-        capture_.keyboard_info.num_keyboard_frames, voice_probability,
-        capture_.key_pressed);
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageTransientSuppressor);
   }
 
-  // Experimental APM sub-module that analyzes |capture_buffer|.
   if (submodules_.capture_analyzer) {
-    submodules_.capture_analyzer->Analyze(capture_buffer);
+    capture_pipeline_.push_back(&AudioProcessingImpl::StageCaptureAnalyzer);
   }
 
   if (submodules_.gain_controller2) {
-    submodules_.gain_controller2->NotifyAnalogLevel(
-        recommended_stream_analog_level_locked());
-    submodules_.gain_controller2->Process(capture_buffer);
+    capture_pipeline_.push_back(&AudioProcessingImpl::StageGainController2);
   }
 
   if (submodules_.capture_post_processor) {
-    submodules_.capture_post_processor->Process(capture_buffer);
+    capture_pipeline_.push_back(
+        &AudioProcessingImpl::StageCapturePostProcessor);
   }
 
-  // The level estimator operates on the recombined data.
   if (config_.level_estimation.enabled) {
-    submodules_.output_level_estimator->ProcessStream(*capture_buffer);
-    capture_.stats.output_rms_dbfs = submodules_.output_level_estimator->RMS();
+    capture_pipeline_.push_back(&AudioProcessingImpl::StageLevelEstimator);
   } else {
     capture_.stats.output_rms_dbfs = absl::nullopt;
   }
+}
 
-  capture_output_rms_.Analyze(rtc::ArrayView<const float>(
-      capture_buffer->channels_const()[0],
+AudioBuffer* AudioProcessingImpl::FullBandCaptureBuffer() {
+  return capture_.capture_fullband_audio
+             ? capture_.capture_fullband_audio.get()
+             : capture_.capture_audio.get();
+}
+
+int AudioProcessingImpl::StageHighPassFilterFullBand() {
+  submodules_.high_pass_filter->Process(capture_.capture_audio.get(),
+                                        /*use_split_band_data=*/false);
+  return kNoError;
+}
+
+int AudioProcessingImpl::StagePreAmplifier() {
+  AudioBuffer* capture_buffer = capture_.capture_audio.get();
+  submodules_.pre_amplifier->ApplyGain(AudioFrameView<float>(
+      capture_buffer->channels(), capture_buffer->num_channels(),
+      capture_buffer->num_frames()));
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageAnalyzeInputRms() {
+  capture_input_rms_.Analyze(rtc::ArrayView<const float>(
+      capture_.capture_audio->channels_const()[0],
       capture_nonlocked_.capture_processing_format.num_frames()));
-  if (log_rms) {
-    RmsLevel::Levels levels = capture_output_rms_.AverageAndPeak();
-    RTC_HISTOGRAM_COUNTS_LINEAR("WebRTC.Audio.ApmCaptureOutputLevelAverageRms",
+  capture_rms_log_frame_ = ++capture_rms_interval_counter_ >= 1000;
+  if (capture_rms_log_frame_) {
+    capture_rms_interval_counter_ = 0;
+    RmsLevel::Levels levels = capture_input_rms_.AverageAndPeak();
+    RTC_HISTOGRAM_COUNTS_LINEAR("WebRTC.Audio.ApmCaptureInputLevelAverageRms",
                                 levels.average, 1, RmsLevel::kMinLevelDb, 64);
-    RTC_HISTOGRAM_COUNTS_LINEAR("WebRTC.Audio.ApmCaptureOutputLevelPeakRms",
+    RTC_HISTOGRAM_COUNTS_LINEAR("WebRTC.Audio.ApmCaptureInputLevelPeakRms",
                                 levels.peak, 1, RmsLevel::kMinLevelDb, 64);
   }
+  return kNoError;
+}
 
-  if (submodules_.agc_manager) {
-    int level = recommended_stream_analog_level_locked();
-    data_dumper_->DumpRaw("experimental_gain_control_stream_analog_level", 1,
-                          &level);
+int AudioProcessingImpl::StageEchoControllerAnalyze() {
+  // Detect and flag any change in the analog gain.
+  int analog_mic_level = recommended_stream_analog_level_locked();
+  capture_.echo_path_gain_change =
+      capture_.prev_analog_mic_level != analog_mic_level &&
+      capture_.prev_analog_mic_level != -1;
+  capture_.prev_analog_mic_level = analog_mic_level;
+
+  // Detect and flag any change in the pre-amplifier gain.
+  if (submodules_.pre_amplifier) {
+    float pre_amp_gain = submodules_.pre_amplifier->GetGainFactor();
+    capture_.echo_path_gain_change =
+        capture_.echo_path_gain_change ||
+        (capture_.prev_pre_amp_gain != pre_amp_gain &&
+         capture_.prev_pre_amp_gain >= 0.f);
+    capture_.prev_pre_amp_gain = pre_amp_gain;
   }
 
-  // Compute echo-related stats.
-  if (submodules_.echo_controller) {
-    auto ec_metrics = submodules_.echo_controller->GetMetrics();
-    capture_.stats.echo_return_loss = ec_metrics.echo_return_loss;
-    capture_.stats.echo_return_loss_enhancement =
-        ec_metrics.echo_return_loss_enhancement;
-    capture_.stats.delay_ms = ec_metrics.delay_ms;
+  // Detect volume change.
+  capture_.echo_path_gain_change =
+      capture_.echo_path_gain_change ||
+      (capture_.prev_playout_volume != capture_.playout_volume &&
+       capture_.prev_playout_volume >= 0);
+  capture_.prev_playout_volume = capture_.playout_volume;
+
+  submodules_.echo_controller->AnalyzeCapture(capture_.capture_audio.get());
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageAgc1AnalyzePreProcess() {
+  submodules_.agc_manager->AnalyzePreProcess(capture_.capture_audio.get());
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageSplitIntoFrequencyBands() {
+  capture_.capture_audio->SplitIntoFrequencyBands();
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageDownmixForEchoController() {
+  // Force down-mixing of the number of channels after the detection of
+  // capture signal saturation.
+  // TODO(peah): Look into ensuring that this kind of tampering with the
+  // AudioBuffer functionality should not be needed.
+  capture_.capture_audio->set_num_channels(1);
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageHighPassFilterSplitBand() {
+  submodules_.high_pass_filter->Process(capture_.capture_audio.get(),
+                                        /*use_split_band_data=*/true);
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageGainControlAnalyze() {
+  return submodules_.gain_control->AnalyzeCaptureAudio(
+      *capture_.capture_audio);
+}
+
+int AudioProcessingImpl::StageNoiseSuppressorAnalyze() {
+  submodules_.noise_suppressor->Analyze(*capture_.capture_audio);
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageCheckStreamDelay() {
+  // Ensure that the stream delay was set before the call to the
+  // AECM ProcessCaptureAudio function.
+  if (!capture_.was_stream_delay_set) {
+    return AudioProcessing::kStreamParameterNotSetError;
   }
-  if (config_.residual_echo_detector.enabled) {
-    RTC_DCHECK(submodules_.echo_detector);
-    auto ed_metrics = submodules_.echo_detector->GetMetrics();
-    capture_.stats.residual_echo_likelihood = ed_metrics.echo_likelihood;
-    capture_.stats.residual_echo_likelihood_recent_max =
-        ed_metrics.echo_likelihood_recent_max;
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageEchoControlMobileProcess() {
+  return submodules_.echo_control_mobile->ProcessCaptureAudio(
+      capture_.capture_audio.get(), stream_delay_ms());
+}
+
+int AudioProcessingImpl::StageEchoControllerProcess() {
+  data_dumper_->DumpRaw("stream_delay", stream_delay_ms());
+
+  if (capture_.was_stream_delay_set) {
+    submodules_.echo_controller->SetAudioBufferDelay(stream_delay_ms());
   }
 
-  // Pass stats for reporting.
-  stats_reporter_.UpdateStatistics(capture_.stats);
+  submodules_.echo_controller->ProcessCapture(
+      capture_.capture_audio.get(), capture_.linear_aec_output.get(),
+      capture_.echo_path_gain_change);
+  return kNoError;
+}
 
-  capture_.was_stream_delay_set = false;
+int AudioProcessingImpl::StageNoiseSuppressorAnalyzeLinearAecOutput() {
+  submodules_.noise_suppressor->Analyze(*capture_.linear_aec_output);
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageNoiseSuppressorProcess() {
+  submodules_.noise_suppressor->Process(capture_.capture_audio.get());
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageVoiceDetector() {
+  capture_.stats.voice_detected =
+      submodules_.voice_detector->ProcessCaptureAudio(
+          capture_.capture_audio.get());
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageAgc1Process() {
+  submodules_.agc_manager->Process(capture_.capture_audio.get());
+
+  absl::optional<int> new_digital_gain =
+      submodules_.agc_manager->GetDigitalComressionGain();
+  if (new_digital_gain && submodules_.gain_control) {
+    submodules_.gain_control->set_compression_gain_db(*new_digital_gain);
+  }
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageGainControlProcess() {
+  // TODO(peah): Add reporting from AEC3 whether there is echo.
+  return submodules_.gain_control->ProcessCaptureAudio(
+      capture_.capture_audio.get(), /*stream_has_echo*/ false);
+}
+
+int AudioProcessingImpl::StageMergeFrequencyBands() {
+  capture_.capture_audio->MergeFrequencyBands();
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageCopyToFullBandBuffer() {
+  const auto& ec = submodules_.echo_controller;
+  bool ec_active = ec ? ec->ActiveProcessing() : false;
+  // Only update the fullband buffer if the multiband processing has changed
+  // the signal. Keep the original signal otherwise.
+  if (submodule_states_.CaptureMultiBandProcessingActive(ec_active)) {
+    capture_.capture_audio->CopyTo(capture_.capture_fullband_audio.get());
+  }
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageEchoDetectorAnalyze() {
+  AudioBuffer* capture_buffer = FullBandCaptureBuffer();
+  submodules_.echo_detector->AnalyzeCaptureAudio(rtc::ArrayView<const float>(
+      capture_buffer->channels()[0], capture_buffer->num_frames()));
+  return kNoError;
+}
+
+// TODO(aluebs): Investigate if the transient suppression placement should be
+// before or after the AGC.
+int AudioProcessingImpl::StageTransientSuppressor() {
+  AudioBuffer* capture_buffer = FullBandCaptureBuffer();
+  float voice_probability = submodules_.agc_manager.get()
+                                ? submodules_.agc_manager->voice_probability()
+                                : 1.f;
+
+  submodules_.transient_suppressor->Suppress(
+      capture_buffer->channels()[0], capture_buffer->num_frames(),
+      capture_buffer->num_channels(),
+      capture_buffer->split_bands_const(0)[kBand0To8kHz],
+      capture_buffer->num_frames_per_band(),
+      capture_.keyboard_info.keyboard_data,
+      capture_.keyboard_info.num_keyboard_frames, voice_probability,
+      capture_.key_pressed);
+  return kNoError;
+}
+
+// Experimental APM sub-module that analyzes the capture output.
+int AudioProcessingImpl::StageCaptureAnalyzer() {
+  submodules_.capture_analyzer->Analyze(FullBandCaptureBuffer());
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageGainController2() {
+  submodules_.gain_controller2->NotifyAnalogLevel(
+      recommended_stream_analog_level_locked());
+  submodules_.gain_controller2->Process(FullBandCaptureBuffer());
+  return kNoError;
+}
+
+int AudioProcessingImpl::StageCapturePostProcessor() {
+  submodules_.capture_post_processor->Process(FullBandCaptureBuffer());
+  return kNoError;
+}
+
+// The level estimator operates on the recombined data.
+int AudioProcessingImpl::StageLevelEstimator() {
+  submodules_.output_level_estimator->ProcessStream(*FullBandCaptureBuffer());
+  capture_.stats.output_rms_dbfs = submodules_.output_level_estimator->RMS();
   return kNoError;
 }
 
@@ -1375,6 +1611,15 @@ int AudioProcessingImpl::AnalyzeReverseStreamLocked(
     aec_dump_->WriteRenderStreamMessage(
         AudioFrameView<const float>(src, num_channels, channel_size));
   }
+  // When no submodule consumes the render signal, skip the deinterleave into
+  // the render buffer and the band-split machinery; only runtime settings
+  // still need to be serviced. This makes additional APM instances that
+  // observe an already-analyzed render signal close to free.
+  if (!submodule_states_.RenderAnalysisActive()) {
+    HandleRenderRuntimeSettings();
+    return kNoError;
+  }
+
   render_.render_audio->CopyFrom(src,
                                  formats_.api_format.reverse_input_stream());
   return ProcessRenderStreamLocked();
@@ -1412,6 +1657,13 @@ int AudioProcessingImpl::ProcessReverseStream(const int16_t* const src,
                                         input_config.num_channels());
   }
 
+  // See the float-pointer overload: bypass the render pipeline when nothing
+  // consumes the render signal.
+  if (!submodule_states_.RenderAnalysisActive()) {
+    HandleRenderRuntimeSettings();
+    return kNoError;
+  }
+
   render_.render_audio->CopyFrom(src, input_config);
   RETURN_ON_ERR(ProcessRenderStreamLocked());
   if (submodule_states_.RenderMultiBandProcessingActive() ||
@@ -1430,7 +1682,11 @@ int AudioProcessingImpl::ProcessRenderStreamLocked() {
     submodules_.render_pre_processor->Process(render_buffer);
   }
 
-  QueueNonbandedRenderAudio(render_buffer);
+  // Don't pack a render copy for the residual echo detector unless it is
+  // enabled; the packing and queue insert are pure overhead otherwise.
+  if (submodule_states_.ResidualEchoDetectorActive()) {
+    QueueNonbandedRenderAudio(render_buffer);
+  }
 
   if (submodule_states_.RenderMultiBandSubModulesActive() &&
       SampleRateSupportsMultiBand(
@@ -94,6 +94,9 @@ class AudioProcessingImpl : public AudioProcessing {
                     const StreamConfig& input_config,
                     const StreamConfig& output_config,
                     float* const* dest) override;
+  int ProcessStreams(rtc::ArrayView<const float* const> src_streams,
+                     const StreamConfig& stream_config,
+                     rtc::ArrayView<float* const> dest_streams) override;
   bool GetLinearAecOutput(
       rtc::ArrayView<std::array<float, 160>> linear_output) const override;
   void set_output_will_be_muted(bool muted) override;
@@ -212,6 +215,10 @@ class AudioProcessingImpl : public AudioProcessing {
     bool RenderMultiBandSubModulesActive() const;
     bool RenderFullBandProcessingActive() const;
     bool RenderMultiBandProcessingActive() const;
+    bool ResidualEchoDetectorActive() const;
+    // True if any submodule consumes the render signal. When false, the
+    // render path reduces to servicing runtime settings.
+    bool RenderAnalysisActive() const;
     bool HighPassFilteringRequired() const;
 
    private:
@@ -299,6 +306,62 @@ class AudioProcessingImpl : public AudioProcessing {
   // manner that are called with the render lock already acquired.
   int ProcessCaptureStreamLocked() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
 
+  // The capture processing is precompiled into a flat list of the stage
+  // methods below that are active for the current configuration, allowing
+  // ProcessCaptureStreamLocked() to run without per-frame configuration
+  // branching. Must be re-run whenever the configuration or the set of
+  // created submodules changes.
+  using CaptureStage = int (AudioProcessingImpl::*)();
+  void CompileCapturePipeline() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+
+  // Returns the buffer that the stages after the band merging operate on.
+  AudioBuffer* FullBandCaptureBuffer()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+
+  // Capture pipeline stages, in processing order. Each stage relies on
+  // CompileCapturePipeline() only having scheduled it when the
+  // corresponding submodule is active; the branching that remains inside
+  // the stages is on per-frame data.
+  int StageHighPassFilterFullBand()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StagePreAmplifier() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageAnalyzeInputRms() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageEchoControllerAnalyze()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageAgc1AnalyzePreProcess()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageSplitIntoFrequencyBands()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageDownmixForEchoController()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageHighPassFilterSplitBand()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageGainControlAnalyze() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageNoiseSuppressorAnalyze()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageCheckStreamDelay() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageEchoControlMobileProcess()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageEchoControllerProcess()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageNoiseSuppressorAnalyzeLinearAecOutput()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageNoiseSuppressorProcess()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageVoiceDetector() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageAgc1Process() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageGainControlProcess() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageMergeFrequencyBands() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageCopyToFullBandBuffer()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageEchoDetectorAnalyze() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageTransientSuppressor() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageCaptureAnalyzer() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageGainController2() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageCapturePostProcessor()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+  int StageLevelEstimator() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_capture_);
+
   // Render-side exclusive methods possibly running APM in a multi-threaded
   // manner that are called with the render lock already acquired.
   // TODO(ekm): Remove once all clients updated to new interface.
@@ -502,6 +565,11 @@ class AudioProcessingImpl : public AudioProcessing {
   RmsLevel capture_input_rms_ RTC_GUARDED_BY(crit_capture_);
   RmsLevel capture_output_rms_ RTC_GUARDED_BY(crit_capture_);
   int capture_rms_interval_counter_ RTC_GUARDED_BY(crit_capture_) = 0;
+  bool capture_rms_log_frame_ RTC_GUARDED_BY(crit_capture_) = false;
+
+  // Active capture stages for the current configuration, in processing
+  // order. Rebuilt by CompileCapturePipeline().
+  std::vector<CaptureStage> capture_pipeline_ RTC_GUARDED_BY(crit_capture_);
 
   // Lock protection not needed.
   std::unique_ptr<
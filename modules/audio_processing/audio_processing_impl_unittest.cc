@@ -202,6 +202,88 @@ TEST(AudioProcessingImplTest, UpdateCapturePreGainRuntimeSetting) {
       << "Frame should be amplified.";
 }
 
+TEST(AudioProcessingImplTest, BatchProcessingMatchesMultiChannelProcessing) {
+  // Tests that processing a batch of independent mono streams via
+  // ProcessStreams() is bitexact to processing the same audio as one
+  // multi-channel stream via ProcessStream().
+  std::unique_ptr<AudioProcessing> batch_apm(
+      AudioProcessingBuilderForTesting().Create());
+  std::unique_ptr<AudioProcessing> reference_apm(
+      AudioProcessingBuilderForTesting().Create());
+  webrtc::AudioProcessing::Config apm_config;
+  apm_config.high_pass_filter.enabled = true;
+  apm_config.noise_suppression.enabled = true;
+  apm_config.gain_controller1.enabled = false;
+  apm_config.gain_controller2.enabled = false;
+  batch_apm->ApplyConfig(apm_config);
+  reference_apm->ApplyConfig(apm_config);
+
+  constexpr int kSampleRateHz = 16000;
+  constexpr size_t kNumStreams = 3;
+  constexpr size_t kNumFrames = kSampleRateHz / 100;
+  const StreamConfig mono_config(kSampleRateHz, 1, /*has_keyboard=*/false);
+  const StreamConfig batched_config(kSampleRateHz, kNumStreams,
+                                    /*has_keyboard=*/false);
+
+  Random random_generator(42U);
+  std::array<std::array<float, kNumFrames>, kNumStreams> batch_audio;
+  std::array<std::array<float, kNumFrames>, kNumStreams> reference_audio;
+  std::array<float*, kNumStreams> batch_streams;
+  std::array<float*, kNumStreams> reference_channels;
+  for (size_t ch = 0; ch < kNumStreams; ++ch) {
+    batch_streams[ch] = batch_audio[ch].data();
+    reference_channels[ch] = reference_audio[ch].data();
+  }
+
+  for (int frame = 0; frame < 10; ++frame) {
+    for (size_t ch = 0; ch < kNumStreams; ++ch) {
+      for (size_t k = 0; k < kNumFrames; ++k) {
+        batch_audio[ch][k] = random_generator.Rand<float>() - 0.5f;
+      }
+      reference_audio[ch] = batch_audio[ch];
+    }
+
+    EXPECT_EQ(AudioProcessing::kNoError,
+              batch_apm->ProcessStreams(batch_streams, mono_config,
+                                        batch_streams));
+    EXPECT_EQ(AudioProcessing::kNoError,
+              reference_apm->ProcessStream(reference_channels.data(),
+                                           batched_config, batched_config,
+                                           reference_channels.data()));
+
+    for (size_t ch = 0; ch < kNumStreams; ++ch) {
+      for (size_t k = 0; k < kNumFrames; ++k) {
+        EXPECT_EQ(reference_audio[ch][k], batch_audio[ch][k]);
+      }
+    }
+  }
+}
+
+TEST(AudioProcessingImplTest, BatchProcessingRejectsInvalidArguments) {
+  std::unique_ptr<AudioProcessing> apm(
+      AudioProcessingBuilderForTesting().Create());
+
+  constexpr int kSampleRateHz = 16000;
+  constexpr size_t kNumFrames = kSampleRateHz / 100;
+  std::array<float, kNumFrames> audio;
+  audio.fill(0.f);
+  std::array<float*, 2> streams = {audio.data(), audio.data()};
+
+  // The number of input and output streams must match.
+  EXPECT_EQ(AudioProcessing::kBadNumberChannelsError,
+            apm->ProcessStreams(
+                rtc::ArrayView<const float* const>(streams.data(), 2),
+                StreamConfig(kSampleRateHz, 1),
+                rtc::ArrayView<float* const>(streams.data(), 1)));
+
+  // The per-stream configuration must be mono.
+  EXPECT_EQ(AudioProcessing::kBadNumberChannelsError,
+            apm->ProcessStreams(
+                rtc::ArrayView<const float* const>(streams.data(), 2),
+                StreamConfig(kSampleRateHz, 2),
+                rtc::ArrayView<float* const>(streams.data(), 2)));
+}
+
 TEST(AudioProcessingImplTest,
      EchoControllerObservesPreAmplifierEchoPathGainChange) {
   // Tests that the echo controller observes an echo path gain change when the
@@ -64,6 +64,23 @@ int GetDefaultMaxInternalRate() {
 
 constexpr int AudioProcessing::kNativeSampleRatesHz[];
 
+int AudioProcessing::ProcessStreams(
+    rtc::ArrayView<const float* const> src_streams,
+    const StreamConfig& stream_config,
+    rtc::ArrayView<float* const> dest_streams) {
+  if (src_streams.size() != dest_streams.size()) {
+    return kBadNumberChannelsError;
+  }
+  for (size_t k = 0; k < src_streams.size(); ++k) {
+    int error = ProcessStream(&src_streams[k], stream_config, stream_config,
+                              &dest_streams[k]);
+    if (error != kNoError) {
+      return error;
+    }
+  }
+  return kNoError;
+}
+
 void CustomProcessing::SetRuntimeSetting(
     AudioProcessing::RuntimeSetting setting) {}
 
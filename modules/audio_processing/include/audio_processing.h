@@ -547,6 +547,26 @@ class RTC_EXPORT AudioProcessing : public rtc::RefCountInterface {
                             const StreamConfig& output_config,
                             float* const* dest) = 0;
 
+  // Processes a batch of independent mono capture streams in one call. Each
+  // element of |src_streams| and |dest_streams| points to one 10 ms mono
+  // stream of deinterleaved float audio with the range [-1, 1], in the format
+  // given by |stream_config|, which must describe a single channel without a
+  // keyboard channel. The corresponding elements of |src_streams| and
+  // |dest_streams| may use the same memory, if desired.
+  //
+  // The streams are mapped onto the channels of a single capture pass, so
+  // per-call fixed overhead (locking, render queue draining, runtime setting
+  // handling and submodule dispatch) is paid once per batch rather than once
+  // per stream. This is intended for server-side use where one instance
+  // serves many participants via submodules that operate on channels
+  // independently (e.g. high-pass filtering and noise suppression);
+  // submodules that couple channels, such as echo cancellation and gain
+  // control, treat the batch as one multi-channel stream. The default
+  // implementation processes the streams one by one.
+  virtual int ProcessStreams(rtc::ArrayView<const float* const> src_streams,
+                             const StreamConfig& stream_config,
+                             rtc::ArrayView<float* const> dest_streams);
+
   // Accepts and produces a 10 ms frame of interleaved 16 bit integer audio for
   // the reverse direction audio stream as specified in |input_config| and
   // |output_config|. |src| and |dest| may use the same memory, if desired.
@@ -17,11 +17,47 @@
 
 #include "modules/audio_processing/ns/fast_math.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#endif
+#if defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+#include <arm_neon.h>
+#endif
 
 namespace webrtc {
 
+namespace {
+
+// Chooses the gain update variant matching the architecture, mirroring the
+// runtime dispatch in three_band_filter_bank.cc.
+WienerFilter::UpdateGainFunction ChooseUpdateGain() {
+// If we know the minimum architecture at compile time, avoid CPU detection.
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#if defined(__SSE2__)
+  return &WienerFilter::UpdateGainSSE2;
+#else
+  // x86 CPU detection required.
+  if (WebRtc_GetCPUInfo(kSSE2)) {
+    return &WienerFilter::UpdateGainSSE2;
+  }
+  return &WienerFilter::UpdateGainC;
+#endif
+#elif defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+  return &WienerFilter::UpdateGainNEON;
+#else
+  return &WienerFilter::UpdateGainC;
+#endif
+}
+
+}  // namespace
+
 WienerFilter::WienerFilter(const SuppressionParams& suppression_params)
-    : suppression_params_(suppression_params) {
+    : suppression_params_(suppression_params),
+      update_gain_(ChooseUpdateGain()) {
   filter_.fill(1.f);
   initial_spectral_estimate_.fill(0.f);
   spectrum_prev_process_.fill(0.f);
@@ -33,27 +69,8 @@ void WienerFilter::Update(
     rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
     rtc::ArrayView<const float, kFftSizeBy2Plus1> parametric_noise_spectrum,
     rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum) {
-  for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
-    // Previous estimate based on previous frame with gain filter.
-    float prev_tsa = spectrum_prev_process_[i] /
-                     (prev_noise_spectrum[i] + 0.0001f) * filter_[i];
-
-    // Current estimate.
-    float current_tsa;
-    if (signal_spectrum[i] > noise_spectrum[i]) {
-      current_tsa = signal_spectrum[i] / (noise_spectrum[i] + 0.0001f) - 1.f;
-    } else {
-      current_tsa = 0.f;
-    }
-
-    // Directed decision estimate is sum of two terms: current estimate and
-    // previous estimate.
-    float snr_prior = 0.98f * prev_tsa + (1.f - 0.98f) * current_tsa;
-    filter_[i] =
-        snr_prior / (suppression_params_.over_subtraction_factor + snr_prior);
-    filter_[i] = std::max(std::min(filter_[i], 1.f),
-                          suppression_params_.minimum_attenuating_gain);
-  }
+  update_gain_(suppression_params_, noise_spectrum, prev_noise_spectrum,
+               signal_spectrum, spectrum_prev_process_, filter_);
 
   if (num_analyzed_frames < kShortStartupPhaseBlocks) {
     for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
@@ -80,6 +97,149 @@ void WienerFilter::Update(
             spectrum_prev_process_.begin());
 }
 
+void WienerFilter::UpdateGainC(
+    const SuppressionParams& suppression_params,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> spectrum_prev_process,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> filter) {
+  for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
+    // Previous estimate based on previous frame with gain filter.
+    float prev_tsa = spectrum_prev_process[i] /
+                     (prev_noise_spectrum[i] + 0.0001f) * filter[i];
+
+    // Current estimate.
+    float current_tsa;
+    if (signal_spectrum[i] > noise_spectrum[i]) {
+      current_tsa = signal_spectrum[i] / (noise_spectrum[i] + 0.0001f) - 1.f;
+    } else {
+      current_tsa = 0.f;
+    }
+
+    // Directed decision estimate is sum of two terms: current estimate and
+    // previous estimate.
+    float snr_prior = 0.98f * prev_tsa + (1.f - 0.98f) * current_tsa;
+    filter[i] =
+        snr_prior / (suppression_params.over_subtraction_factor + snr_prior);
+    filter[i] = std::max(std::min(filter[i], 1.f),
+                         suppression_params.minimum_attenuating_gain);
+  }
+}
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+void WienerFilter::UpdateGainSSE2(
+    const SuppressionParams& suppression_params,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> spectrum_prev_process,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> filter) {
+  static_assert(kFftSizeBy2Plus1 % 4 == 1,
+                "A single scalar tail bin is assumed below.");
+  const __m128 kEpsilon = _mm_set1_ps(0.0001f);
+  const __m128 kOne = _mm_set1_ps(1.f);
+  const __m128 kPrevWeight = _mm_set1_ps(0.98f);
+  const __m128 kCurrentWeight = _mm_set1_ps(1.f - 0.98f);
+  const __m128 over_subtraction =
+      _mm_set1_ps(suppression_params.over_subtraction_factor);
+  const __m128 min_gain =
+      _mm_set1_ps(suppression_params.minimum_attenuating_gain);
+  for (size_t i = 0; i < kFftSizeBy2Plus1 - 1; i += 4) {
+    const __m128 prev_process = _mm_loadu_ps(&spectrum_prev_process[i]);
+    const __m128 prev_noise = _mm_loadu_ps(&prev_noise_spectrum[i]);
+    const __m128 noise = _mm_loadu_ps(&noise_spectrum[i]);
+    const __m128 signal = _mm_loadu_ps(&signal_spectrum[i]);
+    const __m128 gain = _mm_loadu_ps(&filter[i]);
+    const __m128 prev_tsa = _mm_mul_ps(
+        _mm_div_ps(prev_process, _mm_add_ps(prev_noise, kEpsilon)), gain);
+    // |current_tsa| is signal / (noise + epsilon) - 1 where the signal
+    // exceeds the noise estimate and 0 elsewhere.
+    const __m128 ratio =
+        _mm_sub_ps(_mm_div_ps(signal, _mm_add_ps(noise, kEpsilon)), kOne);
+    const __m128 current_tsa =
+        _mm_and_ps(_mm_cmpgt_ps(signal, noise), ratio);
+    const __m128 snr_prior =
+        _mm_add_ps(_mm_mul_ps(kPrevWeight, prev_tsa),
+                   _mm_mul_ps(kCurrentWeight, current_tsa));
+    __m128 new_gain =
+        _mm_div_ps(snr_prior, _mm_add_ps(over_subtraction, snr_prior));
+    new_gain = _mm_max_ps(_mm_min_ps(new_gain, kOne), min_gain);
+    _mm_storeu_ps(&filter[i], new_gain);
+  }
+
+  // Last bin, formula identical to UpdateGainC().
+  constexpr size_t i = kFftSizeBy2Plus1 - 1;
+  float prev_tsa = spectrum_prev_process[i] /
+                   (prev_noise_spectrum[i] + 0.0001f) * filter[i];
+  float current_tsa =
+      signal_spectrum[i] > noise_spectrum[i]
+          ? signal_spectrum[i] / (noise_spectrum[i] + 0.0001f) - 1.f
+          : 0.f;
+  float snr_prior = 0.98f * prev_tsa + (1.f - 0.98f) * current_tsa;
+  filter[i] =
+      snr_prior / (suppression_params.over_subtraction_factor + snr_prior);
+  filter[i] = std::max(std::min(filter[i], 1.f),
+                       suppression_params.minimum_attenuating_gain);
+}
+#endif
+
+#if defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+void WienerFilter::UpdateGainNEON(
+    const SuppressionParams& suppression_params,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+    rtc::ArrayView<const float, kFftSizeBy2Plus1> spectrum_prev_process,
+    rtc::ArrayView<float, kFftSizeBy2Plus1> filter) {
+  static_assert(kFftSizeBy2Plus1 % 4 == 1,
+                "A single scalar tail bin is assumed below.");
+  const float32x4_t kEpsilon = vdupq_n_f32(0.0001f);
+  const float32x4_t kOne = vdupq_n_f32(1.f);
+  const float32x4_t kPrevWeight = vdupq_n_f32(0.98f);
+  const float32x4_t kCurrentWeight = vdupq_n_f32(1.f - 0.98f);
+  const float32x4_t over_subtraction =
+      vdupq_n_f32(suppression_params.over_subtraction_factor);
+  const float32x4_t min_gain =
+      vdupq_n_f32(suppression_params.minimum_attenuating_gain);
+  const float32x4_t zero = vdupq_n_f32(0.f);
+  for (size_t i = 0; i < kFftSizeBy2Plus1 - 1; i += 4) {
+    const float32x4_t prev_process = vld1q_f32(&spectrum_prev_process[i]);
+    const float32x4_t prev_noise = vld1q_f32(&prev_noise_spectrum[i]);
+    const float32x4_t noise = vld1q_f32(&noise_spectrum[i]);
+    const float32x4_t signal = vld1q_f32(&signal_spectrum[i]);
+    const float32x4_t gain = vld1q_f32(&filter[i]);
+    const float32x4_t prev_tsa = vmulq_f32(
+        vdivq_f32(prev_process, vaddq_f32(prev_noise, kEpsilon)), gain);
+    const float32x4_t ratio =
+        vsubq_f32(vdivq_f32(signal, vaddq_f32(noise, kEpsilon)), kOne);
+    const float32x4_t current_tsa =
+        vbslq_f32(vcgtq_f32(signal, noise), ratio, zero);
+    const float32x4_t snr_prior =
+        vaddq_f32(vmulq_f32(kPrevWeight, prev_tsa),
+                  vmulq_f32(kCurrentWeight, current_tsa));
+    float32x4_t new_gain =
+        vdivq_f32(snr_prior, vaddq_f32(over_subtraction, snr_prior));
+    new_gain = vmaxq_f32(vminq_f32(new_gain, kOne), min_gain);
+    vst1q_f32(&filter[i], new_gain);
+  }
+
+  // Last bin, formula identical to UpdateGainC().
+  constexpr size_t i = kFftSizeBy2Plus1 - 1;
+  float prev_tsa = spectrum_prev_process[i] /
+                   (prev_noise_spectrum[i] + 0.0001f) * filter[i];
+  float current_tsa =
+      signal_spectrum[i] > noise_spectrum[i]
+          ? signal_spectrum[i] / (noise_spectrum[i] + 0.0001f) - 1.f
+          : 0.f;
+  float snr_prior = 0.98f * prev_tsa + (1.f - 0.98f) * current_tsa;
+  filter[i] =
+      snr_prior / (suppression_params.over_subtraction_factor + snr_prior);
+  filter[i] = std::max(std::min(filter[i], 1.f),
+                       suppression_params.minimum_attenuating_gain);
+}
+#endif
+
 float WienerFilter::ComputeOverallScalingFactor(
     int32_t num_analyzed_frames,
     float prior_speech_probability,
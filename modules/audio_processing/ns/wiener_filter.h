@@ -16,6 +16,7 @@
 #include "api/array_view.h"
 #include "modules/audio_processing/ns/ns_common.h"
 #include "modules/audio_processing/ns/suppression_params.h"
+#include "rtc_base/system/arch.h"
 
 namespace webrtc {
 
@@ -45,8 +46,46 @@ class WienerFilter {
     return filter_;
   }
 
+  using UpdateGainFunction = void (*)(
+      const SuppressionParams& suppression_params,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> spectrum_prev_process,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> filter);
+
+  // Computes the directed-decision Wiener gains for all frequency bins. The
+  // architecture-specific variants are bitexact to the C version and are
+  // selected at construction time. Exposed for testing.
+  static void UpdateGainC(
+      const SuppressionParams& suppression_params,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> spectrum_prev_process,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> filter);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  static void UpdateGainSSE2(
+      const SuppressionParams& suppression_params,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> spectrum_prev_process,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> filter);
+#endif
+#if defined(WEBRTC_HAS_NEON) && defined(WEBRTC_ARCH_ARM64)
+  static void UpdateGainNEON(
+      const SuppressionParams& suppression_params,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> prev_noise_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> signal_spectrum,
+      rtc::ArrayView<const float, kFftSizeBy2Plus1> spectrum_prev_process,
+      rtc::ArrayView<float, kFftSizeBy2Plus1> filter);
+#endif
+
  private:
   const SuppressionParams& suppression_params_;
+  const UpdateGainFunction update_gain_;
   std::array<float, kFftSizeBy2Plus1> spectrum_prev_process_;
   std::array<float, kFftSizeBy2Plus1> initial_spectral_estimate_;
   std::array<float, kFftSizeBy2Plus1> filter_;
@@ -0,0 +1,73 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/ns/wiener_filter.h"
+
+#include <array>
+
+#include "modules/audio_processing/ns/ns_common.h"
+#include "modules/audio_processing/ns/suppression_params.h"
+#include "rtc_base/random.h"
+#include "rtc_base/system/arch.h"
+#include "test/gtest.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#endif
+
+namespace webrtc {
+namespace {
+
+void PopulateSpectra(Random* rand_gen,
+                     std::array<float, kFftSizeBy2Plus1>* noise,
+                     std::array<float, kFftSizeBy2Plus1>* prev_noise,
+                     std::array<float, kFftSizeBy2Plus1>* signal,
+                     std::array<float, kFftSizeBy2Plus1>* prev_process) {
+  for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
+    (*noise)[i] = rand_gen->Rand<float>() * 1000.f;
+    (*prev_noise)[i] = rand_gen->Rand<float>() * 1000.f;
+    (*signal)[i] = rand_gen->Rand<float>() * 2000.f;
+    (*prev_process)[i] = rand_gen->Rand<float>() * 2000.f;
+  }
+}
+
+}  // namespace
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+// Verifies that the SSE2 gain update produces bitexact results compared to
+// the C reference implementation.
+TEST(WienerFilterUpdateGain, Sse2Bitexactness) {
+  if (!WebRtc_GetCPUInfo(kSSE2)) {
+    return;
+  }
+  Random rand_gen(42);
+  SuppressionParams params(NsConfig::SuppressionLevel::k12dB);
+  std::array<float, kFftSizeBy2Plus1> noise;
+  std::array<float, kFftSizeBy2Plus1> prev_noise;
+  std::array<float, kFftSizeBy2Plus1> signal;
+  std::array<float, kFftSizeBy2Plus1> prev_process;
+  std::array<float, kFftSizeBy2Plus1> filter_c;
+  std::array<float, kFftSizeBy2Plus1> filter_sse2;
+  filter_c.fill(1.f);
+  filter_sse2.fill(1.f);
+  for (int frame = 0; frame < 100; ++frame) {
+    PopulateSpectra(&rand_gen, &noise, &prev_noise, &signal, &prev_process);
+    WienerFilter::UpdateGainC(params, noise, prev_noise, signal, prev_process,
+                              filter_c);
+    WienerFilter::UpdateGainSSE2(params, noise, prev_noise, signal,
+                                 prev_process, filter_sse2);
+    for (size_t i = 0; i < kFftSizeBy2Plus1; ++i) {
+      EXPECT_EQ(filter_c[i], filter_sse2[i]);
+    }
+  }
+}
+#endif
+
+}  // namespace webrtc
@@ -95,6 +95,20 @@ void RmsLevel::Analyze(rtc::ArrayView<const float> data) {
   max_sum_square_ = std::max(max_sum_square_, sum_square);
 }
 
+void RmsLevel::AnalyzePrecomputed(float sum_square, size_t sample_count) {
+  if (sample_count == 0) {
+    return;
+  }
+  RTC_DCHECK_GE(sum_square, 0.f);
+
+  CheckBlockSize(sample_count);
+
+  sum_square_ += sum_square;
+  sample_count_ += sample_count;
+
+  max_sum_square_ = std::max(max_sum_square_, sum_square);
+}
+
 void RmsLevel::AnalyzeMuted(size_t length) {
   CheckBlockSize(length);
   sample_count_ += length;
@@ -47,6 +47,11 @@ class RmsLevel {
   void Analyze(rtc::ArrayView<const int16_t> data);
   void Analyze(rtc::ArrayView<const float> data);
 
+  // Accumulates a chunk whose sum of squared samples was already computed
+  // elsewhere, e.g. taken from AudioFrame::level_info(), so the samples are
+  // not scanned a second time.
+  void AnalyzePrecomputed(float sum_square, size_t sample_count);
+
   // If all samples with the given |length| have a magnitude of zero, this is
   // a shortcut to avoid some computation.
   void AnalyzeMuted(size_t length);
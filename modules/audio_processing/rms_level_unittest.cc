@@ -99,6 +99,24 @@ TEST(RmsLevelTest, Run1000HzHalfScale) {
   EXPECT_EQ(9, level->Average());  // -9 dBFS
 }
 
+TEST(RmsLevelTest, PrecomputedMatchesAnalyze) {
+  auto x = CreateInt16Sinusoid(1000, INT16_MAX, kSampleRateHz);
+  auto level = RunTest(x);
+  RmsLevel precomputed_level;
+  for (size_t n = 0; n + kBlockSizeSamples <= x.size();
+       n += kBlockSizeSamples) {
+    float sum_square = 0.f;
+    for (size_t i = n; i < n + kBlockSizeSamples; ++i) {
+      sum_square += static_cast<float>(x[i]) * x[i];
+    }
+    precomputed_level.AnalyzePrecomputed(sum_square, kBlockSizeSamples);
+  }
+  auto stats = level->AverageAndPeak();
+  auto precomputed_stats = precomputed_level.AverageAndPeak();
+  EXPECT_EQ(stats.average, precomputed_stats.average);
+  EXPECT_EQ(stats.peak, precomputed_stats.peak);
+}
+
 TEST(RmsLevelTest, RunZeros) {
   std::vector<int16_t> x(kSampleRateHz, 0);  // 1 second of pure silence.
   auto level = RunTest(x);
@@ -35,6 +35,11 @@
 #include <array>
 
 #include "rtc_base/checks.h"
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#endif
 
 namespace webrtc {
 namespace {
@@ -100,9 +105,35 @@ const float kDctModulation[ThreeBandFilterBank::kNumNonZeroFilters][kDctSize] =
      {1.f, -2.f, 1.f},
      {1.73205077f, 0.f, -1.73205077f}};
 
+// Chooses the filter core variant matching the architecture, mirroring the
+// runtime dispatch in common_audio/fir_filter_factory.cc.
+ThreeBandFilterBank::FilterCoreFunction ChooseFilterCore() {
+// If we know the minimum architecture at compile time, avoid CPU detection.
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  if (WebRtc_GetCPUInfo(kAVX2)) {
+    return &ThreeBandFilterBank::FilterCoreAVX2;
+  }
+#if defined(__SSE2__)
+  return &ThreeBandFilterBank::FilterCoreSSE2;
+#else
+  // x86 CPU detection required.
+  if (WebRtc_GetCPUInfo(kSSE2)) {
+    return &ThreeBandFilterBank::FilterCoreSSE2;
+  }
+  return &ThreeBandFilterBank::FilterCoreC;
+#endif
+#elif defined(WEBRTC_HAS_NEON)
+  return &ThreeBandFilterBank::FilterCoreNEON;
+#else
+  return &ThreeBandFilterBank::FilterCoreC;
+#endif
+}
+
+}  // namespace
+
 // Filters the input signal |in| with the filter |filter| using a shift by
 // |in_shift|, taking into account the previous state.
-void FilterCore(
+void ThreeBandFilterBank::FilterCoreC(
     rtc::ArrayView<const float, kFilterSize> filter,
     rtc::ArrayView<const float, ThreeBandFilterBank::kSplitBandSize> in,
     const int in_shift,
@@ -144,12 +175,10 @@ void FilterCore(
             in.end(), state.begin());
 }
 
-}  // namespace
-
 // Because the low-pass filter prototype has half bandwidth it is possible to
 // use a DCT to shift it in both directions at the same time, to the center
 // frequencies [1 / 12, 3 / 12, 5 / 12].
-ThreeBandFilterBank::ThreeBandFilterBank() {
+ThreeBandFilterBank::ThreeBandFilterBank() : filter_core_(ChooseFilterCore()) {
   RTC_DCHECK_EQ(state_analysis_.size(), kNumNonZeroFilters);
   RTC_DCHECK_EQ(state_synthesis_.size(), kNumNonZeroFilters);
   for (int k = 0; k < kNumNonZeroFilters; ++k) {
@@ -207,7 +236,7 @@ void ThreeBandFilterBank::Analysis(
 
       // Filter.
       std::array<float, kSplitBandSize> out_subsampled;
-      FilterCore(filter, in_subsampled, in_shift, out_subsampled, state);
+      filter_core_(filter, in_subsampled, in_shift, out_subsampled, state);
 
       // Band and modulate the output.
       for (int band = 0; band < ThreeBandFilterBank::kNumBands; ++band) {
@@ -261,7 +290,7 @@ void ThreeBandFilterBank::Synthesis(
 
       // Filter.
       std::array<float, kSplitBandSize> out_subsampled;
-      FilterCore(filter, in_subsampled, in_shift, out_subsampled, state);
+      filter_core_(filter, in_subsampled, in_shift, out_subsampled, state);
 
       // Upsample.
       constexpr float kUpsamplingScaling = kSubSampling;
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "api/array_view.h"
+#include "rtc_base/system/arch.h"
 
 namespace webrtc {
 
@@ -65,7 +66,45 @@ class ThreeBandFilterBank final {
   void Synthesis(rtc::ArrayView<const rtc::ArrayView<float>, kNumBands> in,
                  rtc::ArrayView<float, kFullBandSize> out);
 
+  using FilterCoreFunction =
+      void (*)(rtc::ArrayView<const float, kFilterSize> filter,
+               rtc::ArrayView<const float, kSplitBandSize> in,
+               int in_shift,
+               rtc::ArrayView<float, kSplitBandSize> out,
+               rtc::ArrayView<float, kMemorySize> state);
+
+  // Filters the subsampled input sequence |in| with the sparse FIR filter
+  // |filter|, shifted by |in_shift| samples, taking the previous filter
+  // |state| into account. The architecture-specific variants are bitexact to
+  // the C version and are selected at construction time. Exposed for testing.
+  static void FilterCoreC(rtc::ArrayView<const float, kFilterSize> filter,
+                          rtc::ArrayView<const float, kSplitBandSize> in,
+                          int in_shift,
+                          rtc::ArrayView<float, kSplitBandSize> out,
+                          rtc::ArrayView<float, kMemorySize> state);
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  static void FilterCoreSSE2(rtc::ArrayView<const float, kFilterSize> filter,
+                             rtc::ArrayView<const float, kSplitBandSize> in,
+                             int in_shift,
+                             rtc::ArrayView<float, kSplitBandSize> out,
+                             rtc::ArrayView<float, kMemorySize> state);
+  // Defined in a separate translation unit compiled with AVX2 support.
+  static void FilterCoreAVX2(rtc::ArrayView<const float, kFilterSize> filter,
+                             rtc::ArrayView<const float, kSplitBandSize> in,
+                             int in_shift,
+                             rtc::ArrayView<float, kSplitBandSize> out,
+                             rtc::ArrayView<float, kMemorySize> state);
+#endif
+#if defined(WEBRTC_HAS_NEON)
+  static void FilterCoreNEON(rtc::ArrayView<const float, kFilterSize> filter,
+                             rtc::ArrayView<const float, kSplitBandSize> in,
+                             int in_shift,
+                             rtc::ArrayView<float, kSplitBandSize> out,
+                             rtc::ArrayView<float, kMemorySize> state);
+#endif
+
  private:
+  const FilterCoreFunction filter_core_;
   std::array<std::array<float, kMemorySize>, kNumNonZeroFilters>
       state_analysis_;
   std::array<std::array<float, kMemorySize>, kNumNonZeroFilters>
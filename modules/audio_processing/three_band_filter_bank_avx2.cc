@@ -0,0 +1,79 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include <immintrin.h>
+
+#include <algorithm>
+
+#include "modules/audio_processing/three_band_filter_bank.h"
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+// AVX2 variant of ThreeBandFilterBank::FilterCoreC, filtering eight outputs
+// at a time in the state-free section. Fused multiply-adds are avoided to
+// keep the result bitexact to the C version.
+void ThreeBandFilterBank::FilterCoreAVX2(
+    rtc::ArrayView<const float, kFilterSize> filter,
+    rtc::ArrayView<const float, ThreeBandFilterBank::kSplitBandSize> in,
+    const int in_shift,
+    rtc::ArrayView<float, ThreeBandFilterBank::kSplitBandSize> out,
+    rtc::ArrayView<float, kMemorySize> state) {
+  constexpr int kMaxInShift = (kStride - 1);
+  RTC_DCHECK_GE(in_shift, 0);
+  RTC_DCHECK_LE(in_shift, kMaxInShift);
+  std::fill(out.begin(), out.end(), 0.f);
+
+  for (int k = 0; k < in_shift; ++k) {
+    for (int i = 0, j = kMemorySize + k - in_shift; i < kFilterSize;
+         ++i, j -= kStride) {
+      out[k] += state[j] * filter[i];
+    }
+  }
+
+  for (int k = in_shift, shift = 0; k < kFilterSize * kStride; ++k, ++shift) {
+    RTC_DCHECK_GE(shift, 0);
+    const int loop_limit = std::min(kFilterSize, 1 + (shift >> kStrideLog2));
+    for (int i = 0, j = shift; i < loop_limit; ++i, j -= kStride) {
+      out[k] += in[j] * filter[i];
+    }
+    for (int i = loop_limit, j = kMemorySize + shift - loop_limit * kStride;
+         i < kFilterSize; ++i, j -= kStride) {
+      out[k] += state[j] * filter[i];
+    }
+  }
+
+  __m256 f[kFilterSize];
+  for (int i = 0; i < kFilterSize; ++i) {
+    f[i] = _mm256_set1_ps(filter[i]);
+  }
+
+  static_assert((ThreeBandFilterBank::kSplitBandSize - kFilterSize * kStride) %
+                        8 ==
+                    0,
+                "The vectorized loop requires a multiple of eight samples");
+  for (int k = kFilterSize * kStride; k < ThreeBandFilterBank::kSplitBandSize;
+       k += 8) {
+    const int shift = k - in_shift;
+    __m256 out_k = _mm256_mul_ps(f[0], _mm256_loadu_ps(&in[shift]));
+    for (int i = 1; i < kFilterSize; ++i) {
+      out_k = _mm256_add_ps(
+          out_k,
+          _mm256_mul_ps(f[i], _mm256_loadu_ps(&in[shift - i * kStride])));
+    }
+    _mm256_storeu_ps(&out[k], out_k);
+  }
+
+  // Update current state.
+  std::copy(in.begin() + ThreeBandFilterBank::kSplitBandSize - kMemorySize,
+            in.end(), state.begin());
+}
+
+}  // namespace webrtc
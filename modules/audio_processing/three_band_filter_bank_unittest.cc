@@ -0,0 +1,77 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/audio_processing/three_band_filter_bank.h"
+
+#include <array>
+
+#include "rtc_base/random.h"
+#include "rtc_base/system/arch.h"
+#include "system_wrappers/include/cpu_features_wrapper.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+// Verifies that an optimized filter core produces output and state that are
+// bitexact to those of the C filter core, for all input shifts and across
+// several frames so that the filter state is exercised.
+void VerifyFilterCoreBitexactness(
+    ThreeBandFilterBank::FilterCoreFunction filter_core) {
+  Random random_generator(42U);
+  const std::array<float, kFilterSize> filter = {
+      {-0.00047749f, -0.00496888f, +0.16547118f, +0.00425496f}};
+
+  std::array<float, kMemorySize> state_c;
+  std::array<float, kMemorySize> state_optimized;
+  state_c.fill(0.f);
+  state_optimized.fill(0.f);
+
+  for (int frame = 0; frame < 10; ++frame) {
+    for (int in_shift = 0; in_shift < kStride; ++in_shift) {
+      std::array<float, ThreeBandFilterBank::kSplitBandSize> in;
+      for (float& sample : in) {
+        sample = random_generator.Rand<float>() - 0.5f;
+      }
+
+      std::array<float, ThreeBandFilterBank::kSplitBandSize> out_c;
+      std::array<float, ThreeBandFilterBank::kSplitBandSize> out_optimized;
+      ThreeBandFilterBank::FilterCoreC(filter, in, in_shift, out_c, state_c);
+      filter_core(filter, in, in_shift, out_optimized, state_optimized);
+
+      EXPECT_EQ(out_c, out_optimized);
+      EXPECT_EQ(state_c, state_optimized);
+    }
+  }
+}
+
+}  // namespace
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+TEST(ThreeBandFilterBank, FilterCoreSse2Bitexactness) {
+  if (WebRtc_GetCPUInfo(kSSE2) != 0) {
+    VerifyFilterCoreBitexactness(&ThreeBandFilterBank::FilterCoreSSE2);
+  }
+}
+
+TEST(ThreeBandFilterBank, FilterCoreAvx2Bitexactness) {
+  if (WebRtc_GetCPUInfo(kAVX2) != 0) {
+    VerifyFilterCoreBitexactness(&ThreeBandFilterBank::FilterCoreAVX2);
+  }
+}
+#endif
+
+#if defined(WEBRTC_HAS_NEON)
+TEST(ThreeBandFilterBank, FilterCoreNeonBitexactness) {
+  VerifyFilterCoreBitexactness(&ThreeBandFilterBank::FilterCoreNEON);
+}
+#endif
+
+}  // namespace webrtc
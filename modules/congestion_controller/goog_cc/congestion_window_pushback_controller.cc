@@ -21,6 +21,14 @@
 #include "rtc_base/experiments/rate_control_settings.h"
 
 namespace webrtc {
+namespace {
+
+// A stream whose oldest queued packet is older than this is considered
+// stalled; the pacer's queue time limit is already draining or dropping its
+// backlog, so that backlog should not push back the other streams.
+constexpr TimeDelta kStaleStreamQueueThreshold = TimeDelta::Millis(250);
+
+}  // namespace
 
 CongestionWindowPushbackController::CongestionWindowPushbackController(
     const WebRtcKeyValueConfig* key_value_config)
@@ -44,6 +52,16 @@ void CongestionWindowPushbackController::UpdatePacingQueue(
   pacing_bytes_ = pacing_bytes;
 }
 
+void CongestionWindowPushbackController::UpdatePacingStreamQueues(
+    const std::vector<PacerStreamQueueInfo>& stream_queues) {
+  int64_t stale_bytes = 0;
+  for (const PacerStreamQueueInfo& info : stream_queues) {
+    if (info.oldest_packet_wait_time > kStaleStreamQueueThreshold)
+      stale_bytes += info.size.bytes();
+  }
+  stale_pacing_bytes_ = stale_bytes;
+}
+
 void CongestionWindowPushbackController::SetDataWindow(DataSize data_window) {
   current_data_window_ = data_window;
 }
@@ -54,7 +72,7 @@ uint32_t CongestionWindowPushbackController::UpdateTargetBitrate(
     return bitrate_bps;
   int64_t total_bytes = outstanding_bytes_;
   if (add_pacing_)
-    total_bytes += pacing_bytes_;
+    total_bytes += std::max<int64_t>(0, pacing_bytes_ - stale_pacing_bytes_);
   double fill_ratio =
       total_bytes / static_cast<double>(current_data_window_->bytes());
   if (fill_ratio > 1.5) {
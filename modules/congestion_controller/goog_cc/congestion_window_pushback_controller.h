@@ -14,7 +14,10 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <vector>
+
 #include "absl/types/optional.h"
+#include "api/transport/network_types.h"
 #include "api/transport/webrtc_key_value_config.h"
 #include "api/units/data_size.h"
 
@@ -31,6 +34,13 @@ class CongestionWindowPushbackController {
       const WebRtcKeyValueConfig* key_value_config);
   void UpdateOutstandingData(int64_t outstanding_bytes);
   void UpdatePacingQueue(int64_t pacing_bytes);
+  // Per-stream breakdown of the pacer queue matching the latest
+  // UpdatePacingQueue() value. Bytes queued for streams whose oldest packet
+  // has gone stale are excluded from the window fill ratio: those streams are
+  // already throttled by the pacer queue time limit, and counting their
+  // backlog would push back healthy streams as well.
+  void UpdatePacingStreamQueues(
+      const std::vector<PacerStreamQueueInfo>& stream_queues);
   uint32_t UpdateTargetBitrate(uint32_t bitrate_bps);
   void SetDataWindow(DataSize data_window);
 
@@ -40,6 +50,7 @@ class CongestionWindowPushbackController {
   absl::optional<DataSize> current_data_window_;
   int64_t outstanding_bytes_ = 0;
   int64_t pacing_bytes_ = 0;
+  int64_t stale_pacing_bytes_ = 0;
   double encoding_rate_ratio_ = 1.0;
 };
 
@@ -101,5 +101,31 @@ TEST_F(CongestionWindowPushbackControllerTest, PushbackDropFrame) {
   EXPECT_GT(80000u, bitrate_bps);
 }
 
+TEST_F(CongestionWindowPushbackControllerTest, StalePacingBytesDoNotPushback) {
+  test::ScopedFieldTrials trials(
+      "WebRTC-AddPacingToCongestionWindowPushback/Enabled/");
+  cwnd_controller_.reset(
+      new CongestionWindowPushbackController(&field_trial_config_));
+  cwnd_controller_->UpdateOutstandingData(0);
+  cwnd_controller_->SetDataWindow(DataSize::Bytes(50000));
+  // The whole pacer queue belongs to one stream whose oldest packet is stale.
+  cwnd_controller_->UpdatePacingQueue(100000);
+  PacerStreamQueueInfo stale_stream;
+  stale_stream.ssrc = 123;
+  stale_stream.size = DataSize::Bytes(100000);
+  stale_stream.oldest_packet_wait_time = TimeDelta::Seconds(2);
+  cwnd_controller_->UpdatePacingStreamQueues({stale_stream});
+
+  uint32_t bitrate_bps = 80000;
+  bitrate_bps = cwnd_controller_->UpdateTargetBitrate(bitrate_bps);
+  EXPECT_EQ(80000u, bitrate_bps);
+
+  // If the queued data is fresh it counts against the window as before.
+  stale_stream.oldest_packet_wait_time = TimeDelta::Millis(50);
+  cwnd_controller_->UpdatePacingStreamQueues({stale_stream});
+  bitrate_bps = cwnd_controller_->UpdateTargetBitrate(bitrate_bps);
+  EXPECT_GT(80000u, bitrate_bps);
+}
+
 }  // namespace test
 }  // namespace webrtc
@@ -153,14 +153,57 @@ DelayBasedBwe::Result DelayBasedBwe::IncomingPacketFeedbackVector(
   bool delayed_feedback = true;
   bool recovered_from_overuse = false;
   BandwidthUsage prev_detector_state = active_delay_detector_->State();
+
+  // Reset if the stream has timed out.
+  if (last_seen_packet_.IsInfinite() ||
+      msg.feedback_time - last_seen_packet_ > kStreamTimeOut) {
+    video_inter_arrival_.reset(
+        new InterArrival(kTimestampGroupTicks, kTimestampToMs, true));
+    video_delay_detector_.reset(
+        new TrendlineEstimator(key_value_config_, network_state_predictor_));
+    audio_inter_arrival_.reset(
+        new InterArrival(kTimestampGroupTicks, kTimestampToMs, true));
+    audio_delay_detector_.reset(
+        new TrendlineEstimator(key_value_config_, network_state_predictor_));
+    active_delay_detector_ = video_delay_detector_.get();
+  }
+  last_seen_packet_ = msg.feedback_time;
+
+  // First phase: route the packets of the feedback interval to the audio or
+  // video inter-arrival filter and collect their timings.
+  std::vector<RoutedPacketFeedback> routed_packets;
+  std::vector<InterArrival::PacketTiming> video_timings;
+  std::vector<InterArrival::PacketTiming> audio_timings;
+  routed_packets.reserve(packet_feedback_vector.size());
+  video_timings.reserve(packet_feedback_vector.size());
   for (const auto& packet_feedback : packet_feedback_vector) {
     delayed_feedback = false;
-    IncomingPacketFeedback(packet_feedback, msg.feedback_time);
+    RoutePacketFeedback(packet_feedback, msg.feedback_time, &video_timings,
+                        &audio_timings, &routed_packets);
+  }
+
+  // Second phase: compute group deltas for the whole interval in one batched
+  // pass per filter, then replay the delay detector updates in order.
+  std::vector<InterArrival::Deltas> video_deltas(video_timings.size());
+  std::vector<InterArrival::Deltas> audio_deltas(audio_timings.size());
+  video_inter_arrival_->ComputeDeltas(video_timings, video_deltas);
+  audio_inter_arrival_->ComputeDeltas(audio_timings, audio_deltas);
+  for (const RoutedPacketFeedback& routed : routed_packets) {
+    const InterArrival::Deltas& deltas =
+        routed.audio ? audio_deltas[routed.timing_index]
+                     : video_deltas[routed.timing_index];
+    double send_delta_ms =
+        (1000.0 * deltas.send_time_delta) / (1 << kInterArrivalShift);
+    routed.delay_detector->Update(
+        deltas.arrival_time_delta_ms, send_delta_ms,
+        routed.packet_feedback->sent_packet.send_time.ms(),
+        routed.packet_feedback->receive_time.ms(),
+        routed.packet_feedback->sent_packet.size.bytes(), deltas.computed);
     if (prev_detector_state == BandwidthUsage::kBwUnderusing &&
-        active_delay_detector_->State() == BandwidthUsage::kBwNormal) {
+        routed.active_delay_detector->State() == BandwidthUsage::kBwNormal) {
       recovered_from_overuse = true;
     }
-    prev_detector_state = active_delay_detector_->State();
+    prev_detector_state = routed.active_delay_detector->State();
   }
 
   if (delayed_feedback) {
@@ -175,23 +218,12 @@ DelayBasedBwe::Result DelayBasedBwe::IncomingPacketFeedbackVector(
                              recovered_from_overuse, in_alr, msg.feedback_time);
 }
 
-void DelayBasedBwe::IncomingPacketFeedback(const PacketResult& packet_feedback,
-                                           Timestamp at_time) {
-  // Reset if the stream has timed out.
-  if (last_seen_packet_.IsInfinite() ||
-      at_time - last_seen_packet_ > kStreamTimeOut) {
-    video_inter_arrival_.reset(
-        new InterArrival(kTimestampGroupTicks, kTimestampToMs, true));
-    video_delay_detector_.reset(
-        new TrendlineEstimator(key_value_config_, network_state_predictor_));
-    audio_inter_arrival_.reset(
-        new InterArrival(kTimestampGroupTicks, kTimestampToMs, true));
-    audio_delay_detector_.reset(
-        new TrendlineEstimator(key_value_config_, network_state_predictor_));
-    active_delay_detector_ = video_delay_detector_.get();
-  }
-  last_seen_packet_ = at_time;
-
+void DelayBasedBwe::RoutePacketFeedback(
+    const PacketResult& packet_feedback,
+    Timestamp at_time,
+    std::vector<InterArrival::PacketTiming>* video_timings,
+    std::vector<InterArrival::PacketTiming>* audio_timings,
+    std::vector<RoutedPacketFeedback>* routed_packets) {
   // Ignore "small" packets if many/most packets in the call are "large". The
   // packet size may have a significant effect on the propagation delay,
   // especially at low bandwidths. Variations in packet size will then show up
@@ -242,17 +274,25 @@ void DelayBasedBwe::IncomingPacketFeedback(const PacketResult& packet_feedback,
   // so wrapping works properly.
   uint32_t timestamp = send_time_24bits << kAbsSendTimeInterArrivalUpshift;
 
-  uint32_t timestamp_delta = 0;
-  int64_t recv_delta_ms = 0;
-  int size_delta = 0;
-  bool calculated_deltas = inter_arrival_for_packet->ComputeDeltas(
-      timestamp, packet_feedback.receive_time.ms(), at_time.ms(),
-      packet_size.bytes(), &timestamp_delta, &recv_delta_ms, &size_delta);
-  double send_delta_ms = (1000.0 * timestamp_delta) / (1 << kInterArrivalShift);
-  delay_detector_for_packet->Update(recv_delta_ms, send_delta_ms,
-                                    packet_feedback.sent_packet.send_time.ms(),
-                                    packet_feedback.receive_time.ms(),
-                                    packet_size.bytes(), calculated_deltas);
+  const bool audio =
+      inter_arrival_for_packet == audio_inter_arrival_.get();
+  std::vector<InterArrival::PacketTiming>* timings =
+      audio ? audio_timings : video_timings;
+
+  InterArrival::PacketTiming timing;
+  timing.send_timestamp = timestamp;
+  timing.arrival_time_ms = packet_feedback.receive_time.ms();
+  timing.system_time_ms = at_time.ms();
+  timing.packet_size = packet_size.bytes();
+
+  RoutedPacketFeedback routed;
+  routed.packet_feedback = &packet_feedback;
+  routed.delay_detector = delay_detector_for_packet;
+  routed.active_delay_detector = active_delay_detector_;
+  routed.audio = audio;
+  routed.timing_index = timings->size();
+  timings->push_back(timing);
+  routed_packets->push_back(routed);
 }
 
 DataRate DelayBasedBwe::TriggerOveruse(Timestamp at_time,
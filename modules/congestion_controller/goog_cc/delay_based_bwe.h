@@ -98,8 +98,25 @@ class DelayBasedBwe {
 
  private:
   friend class GoogCcStatePrinter;
-  void IncomingPacketFeedback(const PacketResult& packet_feedback,
-                              Timestamp at_time);
+  // A packet routed to either the audio or the video inter-arrival filter,
+  // recorded so that the delay detector updates can be replayed after the
+  // batched group-delta computation.
+  struct RoutedPacketFeedback {
+    const PacketResult* packet_feedback;
+    DelayIncreaseDetectorInterface* delay_detector;
+    DelayIncreaseDetectorInterface* active_delay_detector;
+    bool audio;
+    size_t timing_index;
+  };
+  // First phase of feedback processing: applies the small-packet filter,
+  // routes |packet_feedback| to the audio or video inter-arrival filter and
+  // appends its timing to the corresponding batch.
+  void RoutePacketFeedback(
+      const PacketResult& packet_feedback,
+      Timestamp at_time,
+      std::vector<InterArrival::PacketTiming>* video_timings,
+      std::vector<InterArrival::PacketTiming>* audio_timings,
+      std::vector<RoutedPacketFeedback>* routed_packets);
   Result MaybeUpdateEstimate(
       absl::optional<DataRate> acked_bitrate,
       absl::optional<DataRate> probe_bitrate,
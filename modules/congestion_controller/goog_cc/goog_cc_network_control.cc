@@ -121,6 +121,9 @@ GoogCcNetworkController::GoogCcNetworkController(NetworkControllerConfig config,
           DataRate::Zero())),
       max_total_allocated_bitrate_(DataRate::Zero()) {
   RTC_DCHECK(config.constraints.at_time.IsFinite());
+  if (goog_cc_config.probing_plan) {
+    probe_controller_->SetProbingPlan(*goog_cc_config.probing_plan);
+  }
   ParseFieldTrial(
       {&safe_reset_on_route_change_, &safe_reset_acknowledged_rate_},
       key_value_config_->Lookup("WebRTC-Bwe-SafeResetOnRouteChange"));
@@ -200,6 +203,8 @@ NetworkControlUpdate GoogCcNetworkController::OnProcessInterval(
   if (congestion_window_pushback_controller_ && msg.pacer_queue) {
     congestion_window_pushback_controller_->UpdatePacingQueue(
         msg.pacer_queue->bytes());
+    congestion_window_pushback_controller_->UpdatePacingStreamQueues(
+        msg.pacer_stream_queues);
   }
   bandwidth_estimation_->UpdateEstimate(msg.at_time);
   absl::optional<int64_t> start_time_ms =
@@ -42,6 +42,7 @@ struct GoogCcConfig {
   std::unique_ptr<NetworkStateEstimator> network_state_estimator = nullptr;
   std::unique_ptr<NetworkStatePredictor> network_state_predictor = nullptr;
   bool feedback_only = false;
+  absl::optional<ProbingPlan> probing_plan;
 };
 
 class GoogCcNetworkController : public NetworkControllerInterface {
@@ -251,6 +251,27 @@ std::vector<ProbeClusterConfig> ProbeController::InitiateExponentialProbing(
   RTC_DCHECK(state_ == State::kInit);
   RTC_DCHECK_GT(start_bitrate_bps_, 0);
 
+  if (probing_plan_) {
+    std::vector<int64_t> planned_probes;
+    for (DataRate rate : probing_plan_->initial_probes) {
+      planned_probes.push_back(rate.bps());
+    }
+    if (planned_probes.empty() && probing_plan_->trusted_network) {
+      // The network is trusted to sustain the configured bitrates, so go
+      // straight for the max bitrate instead of climbing from the start
+      // bitrate.
+      planned_probes.push_back(max_bitrate_bps_ > 0
+                                   ? max_bitrate_bps_
+                                   : kDefaultMaxProbingBitrateBps);
+    }
+    if (!planned_probes.empty()) {
+      // On a trusted network the top of the ladder is assumed reachable, so
+      // there is no need to wait for probe results and probe further.
+      return InitiateProbing(at_time_ms, planned_probes,
+                             !probing_plan_->trusted_network);
+    }
+  }
+
   // When probing at 1.8 Mbps ( 6x 300), this represents a threshold of
   // 1.2 Mbps to continue probing.
   std::vector<int64_t> probes = {static_cast<int64_t>(
@@ -304,6 +325,10 @@ void ProbeController::EnablePeriodicAlrProbing(bool enable) {
   enable_periodic_alr_probing_ = enable;
 }
 
+void ProbeController::SetProbingPlan(const ProbingPlan& probing_plan) {
+  probing_plan_ = probing_plan;
+}
+
 void ProbeController::SetAlrStartTimeMs(
     absl::optional<int64_t> alr_start_time_ms) {
   alr_start_time_ms_ = alr_start_time_ms;
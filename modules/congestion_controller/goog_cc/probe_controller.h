@@ -84,6 +84,10 @@ class ProbeController {
 
   void EnablePeriodicAlrProbing(bool enable);
 
+  // Overrides the default startup probing behavior. The plan is kept across
+  // calls to Reset, like |enable_periodic_alr_probing_|.
+  void SetProbingPlan(const ProbingPlan& probing_plan);
+
   void SetAlrStartTimeMs(absl::optional<int64_t> alr_start_time);
   void SetAlrEndedTimeMs(int64_t alr_end_time);
 
@@ -94,7 +98,7 @@ class ProbeController {
   void SetMaxBitrate(int64_t max_bitrate_bps);
 
   // Resets the ProbeController to a state equivalent to as if it was just
-  // created EXCEPT for |enable_periodic_alr_probing_|.
+  // created EXCEPT for |enable_periodic_alr_probing_| and |probing_plan_|.
   void Reset(int64_t at_time_ms);
 
   RTC_WARN_UNUSED_RESULT std::vector<ProbeClusterConfig> Process(
@@ -128,6 +132,7 @@ class ProbeController {
   absl::optional<int64_t> alr_start_time_ms_;
   absl::optional<int64_t> alr_end_time_ms_;
   bool enable_periodic_alr_probing_;
+  absl::optional<ProbingPlan> probing_plan_;
   int64_t time_of_last_large_drop_ms_;
   int64_t bitrate_before_last_large_drop_bps_;
   int64_t max_total_allocated_bitrate_;
@@ -74,6 +74,51 @@ TEST_F(ProbeControllerTest, InitiatesProbingAtStart) {
   EXPECT_GE(probes.size(), 2u);
 }
 
+TEST_F(ProbeControllerTest, ProbingPlanLadderOverridesDefaultProbes) {
+  ProbingPlan plan;
+  plan.initial_probes = {DataRate::BitsPerSec(5000),
+                         DataRate::BitsPerSec(9000)};
+  probe_controller_->SetProbingPlan(plan);
+
+  auto probes = probe_controller_->SetBitrates(kMinBitrateBps, kStartBitrateBps,
+                                               kMaxBitrateBps, NowMs());
+  ASSERT_EQ(probes.size(), 2u);
+  EXPECT_EQ(probes[0].target_data_rate.bps(), 5000);
+  EXPECT_EQ(probes[1].target_data_rate.bps(), 9000);
+}
+
+TEST_F(ProbeControllerTest, TrustedNetworkProbesMaxBitrateDirectly) {
+  ProbingPlan plan;
+  plan.trusted_network = true;
+  probe_controller_->SetProbingPlan(plan);
+
+  auto probes = probe_controller_->SetBitrates(kMinBitrateBps, kStartBitrateBps,
+                                               kMaxBitrateBps, NowMs());
+  ASSERT_EQ(probes.size(), 1u);
+  EXPECT_EQ(probes[0].target_data_rate.bps(), kMaxBitrateBps);
+
+  // The top of the ladder is assumed reachable; no further probing is done
+  // when the estimate comes in.
+  probes = probe_controller_->SetEstimatedBitrate(kMaxBitrateBps, NowMs());
+  EXPECT_EQ(probes.size(), 0u);
+}
+
+TEST_F(ProbeControllerTest, ProbingPlanSurvivesReset) {
+  ProbingPlan plan;
+  plan.initial_probes = {DataRate::BitsPerSec(5000)};
+  probe_controller_->SetProbingPlan(plan);
+
+  auto probes = probe_controller_->SetBitrates(kMinBitrateBps, kStartBitrateBps,
+                                               kMaxBitrateBps, NowMs());
+  ASSERT_EQ(probes.size(), 1u);
+
+  probe_controller_->Reset(NowMs());
+  probes = probe_controller_->SetBitrates(kMinBitrateBps, kStartBitrateBps,
+                                          kMaxBitrateBps, NowMs());
+  ASSERT_EQ(probes.size(), 1u);
+  EXPECT_EQ(probes[0].target_data_rate.bps(), 5000);
+}
+
 TEST_F(ProbeControllerTest, ProbeOnlyWhenNetworkIsUp) {
   SetNetworkAvailable(false);
   auto probes = probe_controller_->SetBitrates(kMinBitrateBps, kStartBitrateBps,
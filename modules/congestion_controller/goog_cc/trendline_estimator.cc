@@ -51,59 +51,10 @@ size_t ReadTrendlineFilterWindowSize(
   return TrendlineEstimatorSettings::kDefaultTrendlineWindowSize;
 }
 
-absl::optional<double> LinearFitSlope(
-    const std::deque<TrendlineEstimator::PacketTiming>& packets) {
-  RTC_DCHECK(packets.size() >= 2);
-  // Compute the "center of mass".
-  double sum_x = 0;
-  double sum_y = 0;
-  for (const auto& packet : packets) {
-    sum_x += packet.arrival_time_ms;
-    sum_y += packet.smoothed_delay_ms;
-  }
-  double x_avg = sum_x / packets.size();
-  double y_avg = sum_y / packets.size();
-  // Compute the slope k = \sum (x_i-x_avg)(y_i-y_avg) / \sum (x_i-x_avg)^2
-  double numerator = 0;
-  double denominator = 0;
-  for (const auto& packet : packets) {
-    double x = packet.arrival_time_ms;
-    double y = packet.smoothed_delay_ms;
-    numerator += (x - x_avg) * (y - y_avg);
-    denominator += (x - x_avg) * (x - x_avg);
-  }
-  if (denominator == 0)
-    return absl::nullopt;
-  return numerator / denominator;
-}
-
-absl::optional<double> ComputeSlopeCap(
-    const std::deque<TrendlineEstimator::PacketTiming>& packets,
-    const TrendlineEstimatorSettings& settings) {
-  RTC_DCHECK(1 <= settings.beginning_packets &&
-             settings.beginning_packets < packets.size());
-  RTC_DCHECK(1 <= settings.end_packets &&
-             settings.end_packets < packets.size());
-  RTC_DCHECK(settings.beginning_packets + settings.end_packets <=
-             packets.size());
-  TrendlineEstimator::PacketTiming early = packets[0];
-  for (size_t i = 1; i < settings.beginning_packets; ++i) {
-    if (packets[i].raw_delay_ms < early.raw_delay_ms)
-      early = packets[i];
-  }
-  size_t late_start = packets.size() - settings.end_packets;
-  TrendlineEstimator::PacketTiming late = packets[late_start];
-  for (size_t i = late_start + 1; i < packets.size(); ++i) {
-    if (packets[i].raw_delay_ms < late.raw_delay_ms)
-      late = packets[i];
-  }
-  if (late.arrival_time_ms - early.arrival_time_ms < 1) {
-    return absl::nullopt;
-  }
-  return (late.raw_delay_ms - early.raw_delay_ms) /
-             (late.arrival_time_ms - early.arrival_time_ms) +
-         settings.cap_uncertainty;
-}
+// How often to recompute the regression sums from the stored samples. The
+// incremental updates accumulate floating-point drift proportional to the
+// number of updates, which a periodic rebuild keeps negligible.
+constexpr int kRegressionSumRebuildInterval = 1000;
 
 constexpr double kMaxAdaptOffsetMs = 15.0;
 constexpr double kOverUsingTimeThreshold = 10;
@@ -170,6 +121,12 @@ TrendlineEstimator::TrendlineEstimator(
       accumulated_delay_(0),
       smoothed_delay_(0),
       delay_hist_(),
+      hist_start_(0),
+      sum_x_(0),
+      sum_y_(0),
+      sum_xy_(0),
+      sum_xx_(0),
+      updates_since_sum_rebuild_(0),
       k_up_(0.0087),
       k_down_(0.039),
       overusing_time_threshold_(kOverUsingTimeThreshold),
@@ -187,6 +144,7 @@ TrendlineEstimator::TrendlineEstimator(
       << settings_.Parser()->Encode() << " and "
       << (network_state_predictor_ ? "injected" : "no")
       << " network state predictor";
+  delay_hist_.reserve(settings_.window_size);
 }
 
 TrendlineEstimator::~TrendlineEstimator() {}
@@ -211,20 +169,37 @@ void TrendlineEstimator::UpdateTrendline(double recv_delta_ms,
   BWE_TEST_LOGGING_PLOT(1, "smoothed_delay_ms", arrival_time_ms,
                         smoothed_delay_);
 
-  // Maintain packet window
-  delay_hist_.emplace_back(
+  // Maintain packet window. The oldest sample is overwritten in place once
+  // the window is full and the regression sums are updated incrementally,
+  // so the cost per packet group does not depend on the window size.
+  const PacketTiming new_timing(
       static_cast<double>(arrival_time_ms - first_arrival_time_ms_),
       smoothed_delay_, accumulated_delay_);
+  if (delay_hist_.size() < settings_.window_size) {
+    delay_hist_.push_back(new_timing);
+  } else {
+    const PacketTiming& evicted = delay_hist_[hist_start_];
+    sum_x_ -= evicted.arrival_time_ms;
+    sum_y_ -= evicted.smoothed_delay_ms;
+    sum_xy_ -= evicted.arrival_time_ms * evicted.smoothed_delay_ms;
+    sum_xx_ -= evicted.arrival_time_ms * evicted.arrival_time_ms;
+    delay_hist_[hist_start_] = new_timing;
+    hist_start_ = (hist_start_ + 1) % delay_hist_.size();
+  }
+  sum_x_ += new_timing.arrival_time_ms;
+  sum_y_ += new_timing.smoothed_delay_ms;
+  sum_xy_ += new_timing.arrival_time_ms * new_timing.smoothed_delay_ms;
+  sum_xx_ += new_timing.arrival_time_ms * new_timing.arrival_time_ms;
+  if (++updates_since_sum_rebuild_ >= kRegressionSumRebuildInterval)
+    RebuildRegressionSums();
   if (settings_.enable_sort) {
+    // The sums are order independent; sorting only affects the slope cap.
     for (size_t i = delay_hist_.size() - 1;
-         i > 0 &&
-         delay_hist_[i].arrival_time_ms < delay_hist_[i - 1].arrival_time_ms;
+         i > 0 && HistAt(i).arrival_time_ms < HistAt(i - 1).arrival_time_ms;
          --i) {
-      std::swap(delay_hist_[i], delay_hist_[i - 1]);
+      std::swap(HistAt(i), HistAt(i - 1));
     }
   }
-  if (delay_hist_.size() > settings_.window_size)
-    delay_hist_.pop_front();
 
   // Simple linear regression.
   double trend = prev_trend_;
@@ -234,9 +209,9 @@ void TrendlineEstimator::UpdateTrendline(double recv_delta_ms,
     // 0 < trend < 1   ->  the delay increases, queues are filling up
     //   trend == 0    ->  the delay does not change
     //   trend < 0     ->  the delay decreases, queues are being emptied
-    trend = LinearFitSlope(delay_hist_).value_or(trend);
+    trend = LinearFitSlope().value_or(trend);
     if (settings_.enable_cap) {
-      absl::optional<double> cap = ComputeSlopeCap(delay_hist_, settings_);
+      absl::optional<double> cap = ComputeSlopeCap();
       // We only use the cap to filter out overuse detections, not
       // to detect additional underuses.
       if (trend >= 0 && cap.has_value() && trend > cap.value()) {
@@ -330,4 +305,56 @@ void TrendlineEstimator::UpdateThreshold(double modified_trend,
   last_update_ms_ = now_ms;
 }
 
+absl::optional<double> TrendlineEstimator::LinearFitSlope() const {
+  RTC_DCHECK(delay_hist_.size() >= 2);
+  // The slope k = \sum (x_i-x_avg)(y_i-y_avg) / \sum (x_i-x_avg)^2, expanded
+  // to the running sums maintained in UpdateTrendline().
+  const double n = static_cast<double>(delay_hist_.size());
+  const double denominator = n * sum_xx_ - sum_x_ * sum_x_;
+  // Mathematically >= 0, with equality iff all arrival times are equal.
+  if (denominator <= 0)
+    return absl::nullopt;
+  return (n * sum_xy_ - sum_x_ * sum_y_) / denominator;
+}
+
+absl::optional<double> TrendlineEstimator::ComputeSlopeCap() const {
+  RTC_DCHECK(1 <= settings_.beginning_packets &&
+             settings_.beginning_packets < delay_hist_.size());
+  RTC_DCHECK(1 <= settings_.end_packets &&
+             settings_.end_packets < delay_hist_.size());
+  RTC_DCHECK(settings_.beginning_packets + settings_.end_packets <=
+             delay_hist_.size());
+  PacketTiming early = HistAt(0);
+  for (size_t i = 1; i < settings_.beginning_packets; ++i) {
+    if (HistAt(i).raw_delay_ms < early.raw_delay_ms)
+      early = HistAt(i);
+  }
+  size_t late_start = delay_hist_.size() - settings_.end_packets;
+  PacketTiming late = HistAt(late_start);
+  for (size_t i = late_start + 1; i < delay_hist_.size(); ++i) {
+    if (HistAt(i).raw_delay_ms < late.raw_delay_ms)
+      late = HistAt(i);
+  }
+  if (late.arrival_time_ms - early.arrival_time_ms < 1) {
+    return absl::nullopt;
+  }
+  return (late.raw_delay_ms - early.raw_delay_ms) /
+             (late.arrival_time_ms - early.arrival_time_ms) +
+         settings_.cap_uncertainty;
+}
+
+void TrendlineEstimator::RebuildRegressionSums() {
+  sum_x_ = 0;
+  sum_y_ = 0;
+  sum_xy_ = 0;
+  sum_xx_ = 0;
+  for (const PacketTiming& packet : delay_hist_) {
+    sum_x_ += packet.arrival_time_ms;
+    sum_y_ += packet.smoothed_delay_ms;
+    sum_xy_ += packet.arrival_time_ms * packet.smoothed_delay_ms;
+    sum_xx_ += packet.arrival_time_ms * packet.arrival_time_ms;
+  }
+  updates_since_sum_rebuild_ = 0;
+}
+
 }  // namespace webrtc
@@ -13,9 +13,9 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <deque>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "api/network_state_predictor.h"
 #include "api/transport/webrtc_key_value_config.h"
@@ -93,6 +93,24 @@ class TrendlineEstimator : public DelayIncreaseDetectorInterface {
 
   void UpdateThreshold(double modified_offset, int64_t now_ms);
 
+  // Returns the sample at logical position |index| in the window, where 0 is
+  // the oldest sample. Valid only for index < delay_hist_.size().
+  PacketTiming& HistAt(size_t index) {
+    return delay_hist_[(hist_start_ + index) % delay_hist_.size()];
+  }
+  const PacketTiming& HistAt(size_t index) const {
+    return delay_hist_[(hist_start_ + index) % delay_hist_.size()];
+  }
+
+  // Least squares slope over the window, computed from the running sums.
+  absl::optional<double> LinearFitSlope() const;
+  // Cap on the slope based on the minimum raw delay seen in the beginning
+  // and end of the window.
+  absl::optional<double> ComputeSlopeCap() const;
+  // Recomputes the running sums from the stored samples, bounding the
+  // floating-point drift that the incremental updates accumulate.
+  void RebuildRegressionSums();
+
   // Parameters.
   TrendlineEstimatorSettings settings_;
   const double smoothing_coef_;
@@ -104,8 +122,18 @@ class TrendlineEstimator : public DelayIncreaseDetectorInterface {
   // Exponential backoff filtering.
   double accumulated_delay_;
   double smoothed_delay_;
-  // Linear least squares regression.
-  std::deque<PacketTiming> delay_hist_;
+  // Linear least squares regression. The window is a fixed-capacity ring
+  // buffer: |delay_hist_| is allocated once to settings_.window_size entries
+  // and |hist_start_| points at the oldest sample.
+  std::vector<PacketTiming> delay_hist_;
+  size_t hist_start_;
+  // Running sums over the window, updated in O(1) as samples are added and
+  // evicted, so that the regression cost is independent of the window size.
+  double sum_x_;
+  double sum_y_;
+  double sum_xy_;
+  double sum_xx_;
+  int updates_since_sum_rebuild_;
 
   const double k_up_;
   const double k_down_;
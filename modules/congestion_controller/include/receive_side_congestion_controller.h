@@ -45,6 +45,12 @@ class ReceiveSideCongestionController : public CallStatsObserver,
                                 size_t payload_size,
                                 const RTPHeader& header);
 
+  // Batched variant of OnReceivedPacket() for callers that drain several
+  // packets from the socket in one go (see Socket::RecvFromBatch()). The
+  // feedback proxy and the wrapped estimator each take their lock once for
+  // the whole batch instead of once per packet.
+  virtual void OnReceivedPacketBatch(rtc::ArrayView<const PacketArrival> batch);
+
   void SetSendPeriodicFeedback(bool send_periodic_feedback);
   // TODO(nisse): Delete these methods, design a more specific interface.
   virtual RemoteBitrateEstimator* GetRemoteBitrateEstimator(bool send_side_bwe);
@@ -72,6 +78,10 @@ class ReceiveSideCongestionController : public CallStatsObserver,
                         size_t payload_size,
                         const RTPHeader& header) override;
 
+    // Takes |crit_sect_| once for the whole batch.
+    void IncomingPacketBatch(
+        rtc::ArrayView<const PacketArrival> batch) override;
+
     void Process() override;
 
     int64_t TimeUntilNextProcess() override;
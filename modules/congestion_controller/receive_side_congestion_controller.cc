@@ -10,6 +10,8 @@
 
 #include "modules/congestion_controller/include/receive_side_congestion_controller.h"
 
+#include <algorithm>
+
 #include "modules/pacing/packet_router.h"
 #include "modules/remote_bitrate_estimator/include/bwe_defines.h"
 #include "modules/remote_bitrate_estimator/remote_bitrate_estimator_abs_send_time.h"
@@ -43,6 +45,16 @@ void ReceiveSideCongestionController::WrappingBitrateEstimator::IncomingPacket(
   rbe_->IncomingPacket(arrival_time_ms, payload_size, header);
 }
 
+void ReceiveSideCongestionController::WrappingBitrateEstimator::
+    IncomingPacketBatch(rtc::ArrayView<const PacketArrival> batch) {
+  rtc::CritScope cs(&crit_sect_);
+  for (const PacketArrival& packet : batch) {
+    PickEstimatorFromHeader(packet.header);
+    rbe_->IncomingPacket(packet.arrival_time_ms, packet.payload_size,
+                         packet.header);
+  }
+}
+
 void ReceiveSideCongestionController::WrappingBitrateEstimator::Process() {
   rtc::CritScope cs(&crit_sect_);
   rbe_->Process();
@@ -145,6 +157,30 @@ void ReceiveSideCongestionController::OnReceivedPacket(
   }
 }
 
+void ReceiveSideCongestionController::OnReceivedPacketBatch(
+    rtc::ArrayView<const PacketArrival> batch) {
+  remote_estimator_proxy_.IncomingPacketBatch(batch);
+  // Receive-side BWE only looks at packets without the transport-wide
+  // sequence number extension. In practice a stream has the extension on
+  // either all or none of its packets, so a mixed batch needing the filtered
+  // copy is rare.
+  if (std::all_of(batch.begin(), batch.end(), [](const PacketArrival& packet) {
+        return !packet.header.extension.hasTransportSequenceNumber;
+      })) {
+    remote_bitrate_estimator_.IncomingPacketBatch(batch);
+    return;
+  }
+  std::vector<PacketArrival> receive_side_packets;
+  for (const PacketArrival& packet : batch) {
+    if (!packet.header.extension.hasTransportSequenceNumber) {
+      receive_side_packets.push_back(packet);
+    }
+  }
+  if (!receive_side_packets.empty()) {
+    remote_bitrate_estimator_.IncomingPacketBatch(receive_side_packets);
+  }
+}
+
 void ReceiveSideCongestionController::SetSendPeriodicFeedback(
     bool send_periodic_feedback) {
   remote_estimator_proxy_.SetSendPeriodicFeedback(send_periodic_feedback);
@@ -73,6 +73,41 @@ TEST(ReceiveSideCongestionControllerTest, OnReceivedPacketWithAbsSendTime) {
   EXPECT_EQ(header.ssrc, ssrcs[0]);
 }
 
+TEST(ReceiveSideCongestionControllerTest, OnReceivedPacketBatchWithAbsSendTime) {
+  StrictMock<MockPacketRouter> packet_router;
+  SimulatedClock clock_(123456);
+
+  ReceiveSideCongestionController controller(&clock_, &packet_router);
+
+  size_t payload_size = 1000;
+  RTPHeader header;
+  header.ssrc = 0x11eb21c;
+  header.extension.hasAbsoluteSendTime = true;
+
+  std::vector<unsigned int> ssrcs;
+  EXPECT_CALL(packet_router, OnReceiveBitrateChanged(_, _))
+      .WillRepeatedly(SaveArg<0>(&ssrcs));
+
+  std::vector<PacketArrival> batch;
+  for (int i = 0; i < 10; ++i) {
+    clock_.AdvanceTimeMilliseconds((1000 * payload_size) / kInitialBitrateBps);
+    int64_t now_ms = clock_.TimeInMilliseconds();
+    header.extension.absoluteSendTime = AbsSendTime(now_ms, 1000);
+    PacketArrival packet;
+    packet.arrival_time_ms = now_ms;
+    packet.payload_size = payload_size;
+    packet.header = header;
+    batch.push_back(packet);
+    if (batch.size() == 5) {
+      controller.OnReceivedPacketBatch(batch);
+      batch.clear();
+    }
+  }
+
+  ASSERT_EQ(1u, ssrcs.size());
+  EXPECT_EQ(header.ssrc, ssrcs[0]);
+}
+
 TEST(ReceiveSideCongestionControllerTest, ConvergesToCapacity) {
   Scenario s("recieve_cc_unit/converge");
   NetworkSimulationConfig net_conf;
@@ -43,10 +43,16 @@ void InFlightBytesTracker::RemoveInFlightPacketBytes(
     const PacketFeedback& packet) {
   if (packet.sent.send_time.IsInfinite())
     return;
-  auto it = in_flight_data_.find(packet.network_route);
+  RemoveInFlightBytes(packet.network_route, packet.sent.size);
+}
+
+void InFlightBytesTracker::RemoveInFlightBytes(
+    const rtc::NetworkRoute& network_route,
+    DataSize size) {
+  auto it = in_flight_data_.find(network_route);
   if (it != in_flight_data_.end()) {
-    RTC_DCHECK_GE(it->second, packet.sent.size);
-    it->second -= packet.sent.size;
+    RTC_DCHECK_GE(it->second, size);
+    it->second -= size;
     if (it->second.IsZero())
       in_flight_data_.erase(it);
   }
@@ -214,20 +220,53 @@ TransportFeedbackAdapter::ProcessTransportFeedbackInner(
   size_t failed_lookups = 0;
   size_t ignored = 0;
   TimeDelta packet_offset = TimeDelta::Zero();
+  // Feedback reports packets in increasing sequence number order, so the
+  // newly acked part of |history_| can be consumed with a single forward
+  // walk instead of a pair of O(log n) lookups per feedback packet.
+  // Starts at history_.begin() if last_ack_seq_num_ < 0, since any valid
+  // sequence number is >= 0.
+  auto ack_it = history_.upper_bound(last_ack_seq_num_);
+  // In-flight bytes for consecutive acked packets sharing a network route
+  // are accumulated here and removed with one batched update per route
+  // change rather than one map operation per packet.
+  bool has_pending_in_flight = false;
+  rtc::NetworkRoute pending_in_flight_route;
+  DataSize pending_in_flight_size = DataSize::Zero();
+  auto flush_pending_in_flight = [&] {
+    if (has_pending_in_flight) {
+      in_flight_.RemoveInFlightBytes(pending_in_flight_route,
+                                     pending_in_flight_size);
+      has_pending_in_flight = false;
+      pending_in_flight_size = DataSize::Zero();
+    }
+  };
   for (const auto& packet : feedback.GetAllPackets()) {
     int64_t seq_num = seq_num_unwrapper_.Unwrap(packet.sequence_number());
 
+    auto it = history_.end();
     if (seq_num > last_ack_seq_num_) {
-      // Starts at history_.begin() if last_ack_seq_num_ < 0, since any valid
-      // sequence number is >= 0.
-      for (auto it = history_.upper_bound(last_ack_seq_num_);
-           it != history_.upper_bound(seq_num); ++it) {
-        in_flight_.RemoveInFlightPacketBytes(it->second);
+      while (ack_it != history_.end() && ack_it->first <= seq_num) {
+        if (ack_it->second.sent.send_time.IsFinite()) {
+          if (!has_pending_in_flight ||
+              !(ack_it->second.network_route == pending_in_flight_route)) {
+            flush_pending_in_flight();
+            pending_in_flight_route = ack_it->second.network_route;
+            has_pending_in_flight = true;
+          }
+          pending_in_flight_size += ack_it->second.sent.size;
+        }
+        if (ack_it->first == seq_num)
+          it = ack_it;
+        ++ack_it;
       }
       last_ack_seq_num_ = seq_num;
+    } else {
+      // Already acked by an earlier feedback message. Received packets were
+      // erased from the history at that point, so this lookup normally only
+      // succeeds for packets previously reported as lost.
+      it = history_.find(seq_num);
     }
 
-    auto it = history_.find(seq_num);
     if (it == history_.end()) {
       ++failed_lookups;
       continue;
@@ -259,6 +298,7 @@ TransportFeedbackAdapter::ProcessTransportFeedbackInner(
       ++ignored;
     }
   }
+  flush_pending_in_flight();
 
   if (failed_lookups > 0) {
     RTC_LOG(LS_WARNING) << "Failed to lookup send time for " << failed_lookups
@@ -45,6 +45,11 @@ class InFlightBytesTracker {
  public:
   void AddInFlightPacketBytes(const PacketFeedback& packet);
   void RemoveInFlightPacketBytes(const PacketFeedback& packet);
+  // Batched variant of RemoveInFlightPacketBytes(): removes |size| bytes
+  // worth of packets that were all sent on |network_route| with a single
+  // map lookup.
+  void RemoveInFlightBytes(const rtc::NetworkRoute& network_route,
+                           DataSize size);
   DataSize GetOutstandingData(const rtc::NetworkRoute& network_route) const;
 
  private:
@@ -13,18 +13,33 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>
+#include <atomic>
 #include <utility>
+#include <vector>
 
 #include "modules/desktop_capture/desktop_geometry.h"
 #include "modules/desktop_capture/desktop_region.h"
 #include "modules/desktop_capture/differ_block.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
 #include "rtc_base/time_utils.h"
+#include "system_wrappers/include/cpu_info.h"
 
 namespace webrtc {
 
 namespace {
 
+// Only frames that produce at least this many tiles (block-rows) are diffed
+// across the worker pool; below this the thread wake-ups cost more than the
+// comparisons. A 1080p frame produces about 34 tiles.
+constexpr size_t kMinTilesForParallelDiff = 32;
+
+// Upper bound on the number of worker threads; the capture thread itself
+// also processes tiles while it waits.
+constexpr size_t kMaxDifferThreads = 7;
+
 // Returns true if (0, 0) - (|width|, |height|) vector in |old_buffer| and
 // |new_buffer| are equal. |width| should be less than 32
 // (defined by kBlockSize), otherwise BlockDifference() should be used.
@@ -109,12 +124,32 @@ void CompareRow(const uint8_t* old_buffer,
   }
 }
 
-// Compares |rect| area in |old_frame| and |new_frame|, and outputs dirty
-// regions into |output|.
-void CompareFrames(const DesktopFrame& old_frame,
-                   const DesktopFrame& new_frame,
-                   DesktopRect rect,
-                   DesktopRegion* const output) {
+// One block-row of a hint rectangle. Tiles are independent of each other, so
+// they can be compared on any thread; each tile collects the dirty rects it
+// finds in its own |output|, which is merged into the frame's updated region
+// once all tiles are done.
+struct DiffTile {
+  const uint8_t* old_buffer;
+  const uint8_t* new_buffer;
+  int left;
+  int right;
+  int top;
+  int bottom;
+  int stride;
+  DesktopRegion output;
+};
+
+void CompareTile(DiffTile* tile) {
+  CompareRow(tile->old_buffer, tile->new_buffer, tile->left, tile->right,
+             tile->top, tile->bottom, tile->stride, &tile->output);
+}
+
+// Splits the |rect| area of |old_frame| and |new_frame| into block-rows and
+// appends them to |tiles|.
+void CollectTiles(const DesktopFrame& old_frame,
+                  const DesktopFrame& new_frame,
+                  DesktopRect rect,
+                  std::vector<DiffTile>* tiles) {
   RTC_DCHECK(old_frame.size().equals(new_frame.size()));
   RTC_DCHECK_EQ(old_frame.stride(), new_frame.stride());
   rect.IntersectWith(DesktopRect::MakeSize(old_frame.size()));
@@ -131,19 +166,95 @@ void CompareFrames(const DesktopFrame& old_frame,
   int top = rect.top();
   // The last row may have a different height, so we handle it separately.
   for (int y = 0; y < y_block_count; y++) {
-    CompareRow(prev_block_row_start, curr_block_row_start, rect.left(),
-               rect.right(), top, top + kBlockSize, old_frame.stride(), output);
+    tiles->push_back(DiffTile{prev_block_row_start, curr_block_row_start,
+                              rect.left(), rect.right(), top, top + kBlockSize,
+                              old_frame.stride(), DesktopRegion()});
     top += kBlockSize;
     prev_block_row_start += block_y_stride;
     curr_block_row_start += block_y_stride;
   }
-  CompareRow(prev_block_row_start, curr_block_row_start, rect.left(),
-             rect.right(), top, top + last_y_block_height, old_frame.stride(),
-             output);
+  tiles->push_back(DiffTile{prev_block_row_start, curr_block_row_start,
+                            rect.left(), rect.right(), top,
+                            top + last_y_block_height, old_frame.stride(),
+                            DesktopRegion()});
 }
 
 }  // namespace
 
+// Compares tiles across a fixed set of worker threads. The workers sleep
+// between frames; the capture thread wakes them up, takes part in the work
+// itself and blocks until every tile has been compared.
+class DifferTilePool {
+ public:
+  explicit DifferTilePool(size_t thread_count) {
+    workers_.reserve(thread_count);
+    for (size_t i = 0; i < thread_count; i++) {
+      workers_.push_back(std::make_unique<Worker>(this));
+      workers_.back()->thread.Start();
+    }
+  }
+
+  ~DifferTilePool() {
+    quit_.store(true);
+    for (auto& worker : workers_) {
+      worker->start.Set();
+    }
+    for (auto& worker : workers_) {
+      worker->thread.Stop();
+    }
+  }
+
+  // Compares all |tiles|, blocking until they are done. Must not be called
+  // concurrently with itself.
+  void DiffTiles(std::vector<DiffTile>* tiles) {
+    tiles_ = tiles;
+    next_tile_.store(0);
+    for (auto& worker : workers_) {
+      worker->start.Set();
+    }
+    ProcessTiles();
+    for (auto& worker : workers_) {
+      worker->done.Wait(rtc::Event::kForever);
+    }
+    tiles_ = nullptr;
+  }
+
+ private:
+  struct Worker {
+    explicit Worker(DifferTilePool* pool)
+        : pool(pool), thread(&DifferTilePool::WorkerRun, this, "DifferTile") {}
+    DifferTilePool* const pool;
+    rtc::Event start;
+    rtc::Event done;
+    rtc::PlatformThread thread;
+  };
+
+  static void WorkerRun(void* obj) {
+    Worker* worker = static_cast<Worker*>(obj);
+    while (true) {
+      worker->start.Wait(rtc::Event::kForever);
+      if (worker->pool->quit_.load())
+        return;
+      worker->pool->ProcessTiles();
+      worker->done.Set();
+    }
+  }
+
+  void ProcessTiles() {
+    while (true) {
+      const size_t i = next_tile_.fetch_add(1);
+      if (i >= tiles_->size())
+        return;
+      CompareTile(&(*tiles_)[i]);
+    }
+  }
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<DiffTile>* tiles_ = nullptr;
+  std::atomic<size_t> next_tile_{0};
+  std::atomic<bool> quit_{false};
+};
+
 DesktopCapturerDifferWrapper::DesktopCapturerDifferWrapper(
     std::unique_ptr<DesktopCapturer> base_capturer)
     : base_capturer_(std::move(base_capturer)) {
@@ -207,9 +318,28 @@ void DesktopCapturerDifferWrapper::OnCaptureResult(
   if (last_frame_) {
     DesktopRegion hints;
     hints.Swap(frame->mutable_updated_region());
+    std::vector<DiffTile> tiles;
     for (DesktopRegion::Iterator it(hints); !it.IsAtEnd(); it.Advance()) {
-      CompareFrames(*last_frame_, *frame, it.rect(),
-                    frame->mutable_updated_region());
+      CollectTiles(*last_frame_, *frame, it.rect(), &tiles);
+    }
+
+    if (!tile_pool_ && tiles.size() >= kMinTilesForParallelDiff) {
+      const size_t cores = CpuInfo::DetectNumberOfCores();
+      if (cores > 1) {
+        tile_pool_ = std::make_unique<DifferTilePool>(
+            std::min(cores - 1, kMaxDifferThreads));
+      }
+    }
+    if (tile_pool_ && tiles.size() >= kMinTilesForParallelDiff) {
+      tile_pool_->DiffTiles(&tiles);
+    } else {
+      for (DiffTile& tile : tiles) {
+        CompareTile(&tile);
+      }
+    }
+
+    for (const DiffTile& tile : tiles) {
+      frame->mutable_updated_region()->AddRegion(tile.output);
     }
   } else {
     frame->mutable_updated_region()->SetRect(
@@ -23,6 +23,8 @@
 
 namespace webrtc {
 
+class DifferTilePool;
+
 // DesktopCapturer wrapper that calculates updated_region() by comparing frames
 // content. This class always expects the underlying DesktopCapturer
 // implementation returns a superset of updated regions in DestkopFrame. If a
@@ -61,6 +63,10 @@ class RTC_EXPORT DesktopCapturerDifferWrapper
   const std::unique_ptr<DesktopCapturer> base_capturer_;
   DesktopCapturer::Callback* callback_;
   std::unique_ptr<SharedDesktopFrame> last_frame_;
+  // Worker threads used to diff large frames tile-parallel. Created lazily
+  // the first time a frame produces enough tiles to be worth spreading over
+  // several cores; null on single-core machines and for small frames.
+  std::unique_ptr<DifferTilePool> tile_pool_;
 };
 
 }  // namespace webrtc
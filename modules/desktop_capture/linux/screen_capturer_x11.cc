@@ -223,6 +223,16 @@ void ScreenCapturerX11::Start(Callback* callback) {
   callback_ = callback;
 }
 
+void ScreenCapturerX11::SetSharedMemoryFactory(
+    std::unique_ptr<SharedMemoryFactory> shared_memory_factory) {
+  RTC_DCHECK(shared_memory_factory);
+  shared_memory_factory_ = std::move(shared_memory_factory);
+  // Make sure the frame buffers will be reallocated through the factory. The
+  // next capture will be a full-screen one, so no need to touch the invalid
+  // region history.
+  queue_.Reset();
+}
+
 void ScreenCapturerX11::CaptureFrame() {
   TRACE_EVENT0("webrtc", "ScreenCapturerX11::CaptureFrame");
   int64_t capture_start_time_nanos = rtc::TimeNanos();
@@ -247,8 +257,18 @@ void ScreenCapturerX11::CaptureFrame() {
   // Note that we can't reallocate other buffers at this point, since the caller
   // may still be reading from them.
   if (!queue_.current_frame()) {
-    std::unique_ptr<DesktopFrame> frame(
-        new BasicDesktopFrame(selected_monitor_rect_.size()));
+    std::unique_ptr<DesktopFrame> frame;
+    if (shared_memory_factory_) {
+      frame = SharedMemoryDesktopFrame::Create(selected_monitor_rect_.size(),
+                                               shared_memory_factory_.get());
+      if (!frame) {
+        RTC_LOG(LS_WARNING) << "Failed to create shared memory frame buffer.";
+        callback_->OnCaptureResult(Result::ERROR_TEMPORARY, nullptr);
+        return;
+      }
+    } else {
+      frame.reset(new BasicDesktopFrame(selected_monitor_rect_.size()));
+    }
 
     // We set the top-left of the frame so the mouse cursor will be composited
     // properly, and our frame buffer will not be overrun while blitting.
@@ -263,7 +283,10 @@ void ScreenCapturerX11::CaptureFrame() {
     return;
   }
 
-  last_invalid_region_ = result->updated_region();
+  for (int i = kNumBuffers - 2; i > 0; --i) {
+    last_invalid_regions_[i] = last_invalid_regions_[i - 1];
+  }
+  last_invalid_regions_[0] = result->updated_region();
   result->set_capture_time_ms((rtc::TimeNanos() - capture_start_time_nanos) /
                               rtc::kNumNanosecsPerMillisec);
   callback_->OnCaptureResult(Result::SUCCESS, std::move(result));
@@ -419,14 +442,22 @@ void ScreenCapturerX11::SynchronizeFrame() {
   // positives.
 
   // TODO(hclam): We can reduce the amount of copying here by subtracting
-  // |capturer_helper_|s region from |last_invalid_region_|.
+  // |capturer_helper_|s region from the invalid region history.
   // http://crbug.com/92354
   RTC_DCHECK(queue_.previous_frame());
 
   DesktopFrame* current = queue_.current_frame();
   DesktopFrame* last = queue_.previous_frame();
   RTC_DCHECK(current != last);
-  for (DesktopRegion::Iterator it(last_invalid_region_); !it.IsAtEnd();
+
+  // The current buffer was last written |kNumBuffers - 1| captures ago, so it
+  // has missed everything invalidated since; the previous frame is up-to-date
+  // as of the most recent capture.
+  DesktopRegion missed_region;
+  for (int i = 0; i < kNumBuffers - 1; ++i) {
+    missed_region.AddRegion(last_invalid_regions_[i]);
+  }
+  for (DesktopRegion::Iterator it(missed_region); !it.IsAtEnd();
        it.Advance()) {
     if (selected_monitor_rect_.ContainsRect(it.rect())) {
       DesktopRect r = it.rect();
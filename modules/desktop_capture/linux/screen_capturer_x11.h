@@ -54,6 +54,8 @@ class ScreenCapturerX11 : public DesktopCapturer,
 
   // DesktopCapturer interface.
   void Start(Callback* delegate) override;
+  void SetSharedMemoryFactory(
+      std::unique_ptr<SharedMemoryFactory> shared_memory_factory) override;
   void CaptureFrame() override;
   bool GetSourceList(SourceList* sources) override;
   bool SelectSource(SourceId id) override;
@@ -78,11 +80,9 @@ class ScreenCapturerX11 : public DesktopCapturer,
   // Called when the screen configuration is changed.
   void ScreenConfigurationChanged();
 
-  // Synchronize the current buffer with |last_buffer_|, by copying pixels from
-  // the area of |last_invalid_rects|.
-  // Note this only works on the assumption that kNumBuffers == 2, as
-  // |last_invalid_rects| holds the differences from the previous buffer and
-  // the one prior to that (which will then be the current buffer).
+  // Synchronize the current buffer with the previous frame, by copying pixels
+  // from the areas of |last_invalid_regions_|, which tracks what has changed
+  // in each of the captures since the current buffer was last written.
   void SynchronizeFrame();
 
   void DeinitXlib();
@@ -130,12 +130,21 @@ class ScreenCapturerX11 : public DesktopCapturer,
   // recently captured screen.
   ScreenCapturerHelper helper_;
 
-  // Queue of the frames buffers.
-  ScreenCaptureFrameQueue<SharedDesktopFrame> queue_;
-
-  // Invalid region from the previous capture. This is used to synchronize the
-  // current with the last buffer used.
-  DesktopRegion last_invalid_region_;
+  // Queue of the frames buffers. Triple-buffered, so a consumer may keep a
+  // reference to the delivered frame across one capture (e.g. while encoding
+  // it) without blocking reuse of the buffer being written.
+  static constexpr int kNumBuffers = 3;
+  ScreenCaptureFrameQueue<SharedDesktopFrame, kNumBuffers> queue_;
+
+  // Invalid regions from the last |kNumBuffers - 1| captures, most recent
+  // first. Their union is what the buffer about to be reused has missed;
+  // it is used to synchronize that buffer with the last one captured.
+  DesktopRegion last_invalid_regions_[kNumBuffers - 1];
+
+  // When set, frame buffers are allocated through this factory instead of
+  // in-process heap memory, so consumers in another process can map the
+  // frame instead of copying it.
+  std::unique_ptr<SharedMemoryFactory> shared_memory_factory_;
 
   std::unique_ptr<XAtomCache> atom_cache_;
 
@@ -34,7 +34,12 @@ namespace webrtc {
 // Frame consumer is expected to never hold more than kQueueLength frames
 // created by this function and it should release the earliest one before trying
 // to capture a new frame (i.e. before MoveToNextFrame() is called).
-template <typename FrameType>
+//
+// |QueueLength| is the number of buffers to rotate through. The default of 2
+// suffices when consumers release the frame before the next capture; capturers
+// whose consumers keep a reference across a capture (e.g. when encoding
+// overlaps capturing) can use 3.
+template <typename FrameType, int QueueLength = 2>
 class ScreenCaptureFrameQueue {
  public:
   ScreenCaptureFrameQueue() : current_(0) {}
@@ -69,7 +74,7 @@ class ScreenCaptureFrameQueue {
   // Index of the current frame.
   int current_;
 
-  static const int kQueueLength = 2;
+  static const int kQueueLength = QueueLength;
   std::unique_ptr<FrameType> frames_[kQueueLength];
 
   RTC_DISALLOW_COPY_AND_ASSIGN(ScreenCaptureFrameQueue);
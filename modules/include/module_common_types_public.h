@@ -36,6 +36,9 @@ inline bool IsNewer(U value, U prev_value) {
 
 // Utility class to unwrap a number to a larger type. The numbers will never be
 // unwrapped to a negative value.
+// See also SeqNumUnwrapper in rtc_base/numerics/sequence_number_util.h, which
+// supports arbitrary moduli and allows negative unwrapped values. Prefer one
+// of the two over re-implementing unwrapping in a module.
 template <typename U>
 class Unwrapper {
   static_assert(!std::numeric_limits<U>::is_signed, "U must be unsigned");
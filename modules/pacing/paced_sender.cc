@@ -145,6 +145,11 @@ DataSize PacedSender::QueueSizeData() const {
   return pacing_controller_.QueueSizeData();
 }
 
+std::vector<PacerStreamQueueInfo> PacedSender::GetStreamQueueInfos() const {
+  rtc::CritScope cs(&critsect_);
+  return pacing_controller_.GetStreamQueueInfos();
+}
+
 absl::optional<Timestamp> PacedSender::FirstSentPacketTime() const {
   rtc::CritScope cs(&critsect_);
   return pacing_controller_.FirstSentPacketTime();
@@ -105,6 +105,8 @@ class PacedSender : public Module,
 
   DataSize QueueSizeData() const override;
 
+  std::vector<PacerStreamQueueInfo> GetStreamQueueInfos() const override;
+
   // Returns the time when the first packet was sent;
   absl::optional<Timestamp> FirstSentPacketTime() const override;
 
@@ -23,6 +23,7 @@
 #include "rtc_base/experiments/field_trial_parser.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/time_utils.h"
+#include "system_wrappers/include/audio_pipeline_tap.h"
 #include "system_wrappers/include/clock.h"
 
 namespace webrtc {
@@ -269,6 +270,11 @@ DataSize PacingController::QueueSizeData() const {
   return packet_queue_.Size();
 }
 
+std::vector<PacerStreamQueueInfo> PacingController::GetStreamQueueInfos()
+    const {
+  return packet_queue_.GetStreamQueueInfos(CurrentTime());
+}
+
 DataSize PacingController::CurrentBufferLevel() const {
   return std::max(media_debt_, padding_debt_);
 }
@@ -557,6 +563,9 @@ void PacingController::ProcessPackets() {
       packet_size += DataSize::Bytes(rtp_packet->headers_size()) +
                      transport_overhead_per_packet_;
     }
+    if (packet_type == RtpPacketMediaType::kAudio) {
+      audio_pipeline_tap::Record(audio_pipeline_tap::Stage::kPacerDequeue);
+    }
     packet_sender_->SendRtpPacket(std::move(rtp_packet), pacing_info);
 
     data_sent += packet_size;
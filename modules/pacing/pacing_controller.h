@@ -119,6 +119,8 @@ class PacingController {
   size_t QueueSizePackets() const;
   // Totals size of packets in the pacer queue.
   DataSize QueueSizeData() const;
+  // Per-stream breakdown of the pacer queue.
+  std::vector<PacerStreamQueueInfo> GetStreamQueueInfos() const;
 
   // Current buffer level, i.e. max of media and padding debt.
   DataSize CurrentBufferLevel() const;
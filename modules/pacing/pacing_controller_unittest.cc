@@ -1371,6 +1371,38 @@ TEST_P(PacingControllerTest, QueueTimeGrowsOverTime) {
   EXPECT_EQ(TimeDelta::Zero(), pacer_->OldestPacketWaitTime());
 }
 
+TEST_P(PacingControllerTest, ReportsPerStreamQueueInfo) {
+  const uint32_t kFirstSsrc = 12345;
+  const uint32_t kSecondSsrc = 12346;
+  uint16_t sequence_number = 1234;
+  const size_t kPacketSize = 250;
+
+  EXPECT_TRUE(pacer_->GetStreamQueueInfos().empty());
+
+  Send(RtpPacketMediaType::kVideo, kFirstSsrc, sequence_number++,
+       clock_.TimeInMilliseconds(), kPacketSize);
+  Send(RtpPacketMediaType::kVideo, kFirstSsrc, sequence_number++,
+       clock_.TimeInMilliseconds(), kPacketSize);
+  clock_.AdvanceTimeMilliseconds(100);
+  Send(RtpPacketMediaType::kVideo, kSecondSsrc, sequence_number++,
+       clock_.TimeInMilliseconds(), kPacketSize);
+
+  std::vector<PacerStreamQueueInfo> infos = pacer_->GetStreamQueueInfos();
+  ASSERT_EQ(infos.size(), 2u);
+  for (const PacerStreamQueueInfo& info : infos) {
+    if (info.ssrc == kFirstSsrc) {
+      EXPECT_EQ(info.packet_count, 2u);
+      EXPECT_EQ(info.size, DataSize::Bytes(2 * kPacketSize));
+      EXPECT_EQ(info.oldest_packet_wait_time, TimeDelta::Millis(100));
+    } else {
+      EXPECT_EQ(info.ssrc, kSecondSsrc);
+      EXPECT_EQ(info.packet_count, 1u);
+      EXPECT_EQ(info.size, DataSize::Bytes(kPacketSize));
+      EXPECT_EQ(info.oldest_packet_wait_time, TimeDelta::Zero());
+    }
+  }
+}
+
 TEST_P(PacingControllerTest, ProbingWithInsertedPackets) {
   const size_t kPacketSize = 1200;
   const int kInitialBitrateBps = 300000;
@@ -36,6 +36,7 @@ PacketRouter::PacketRouter() : PacketRouter(0) {}
 
 PacketRouter::PacketRouter(uint16_t start_transport_seq)
     : last_send_module_(nullptr),
+      last_feedback_module_(nullptr),
       last_remb_time_ms_(rtc::TimeMillis()),
       last_send_bitrate_bps_(0),
       bitrate_bps_(0),
@@ -108,6 +109,9 @@ void PacketRouter::RemoveSendRtpModule(RtpRtcp* rtp_module) {
   if (last_send_module_ == rtp_module) {
     last_send_module_ = nullptr;
   }
+  if (last_feedback_module_ == rtp_module) {
+    last_feedback_module_ = nullptr;
+  }
 }
 
 void PacketRouter::AddReceiveRtpModule(RtcpFeedbackSenderInterface* rtcp_sender,
@@ -279,11 +283,19 @@ bool PacketRouter::SendCombinedRtcpPacket(
     std::vector<std::unique_ptr<rtcp::RtcpPacket>> packets) {
   rtc::CritScope cs(&modules_crit_);
 
-  // Prefer send modules.
+  // Prefer send modules. Typically the same module keeps being used, so
+  // check the cached one before scanning the list; RTCP may have been
+  // reconfigured on the cached module since it was last used.
+  if (last_feedback_module_ != nullptr &&
+      last_feedback_module_->RTCP() != RtcpMode::kOff) {
+    last_feedback_module_->SendCombinedRtcpPacket(std::move(packets));
+    return true;
+  }
   for (RtpRtcp* rtp_module : send_modules_list_) {
     if (rtp_module->RTCP() == RtcpMode::kOff) {
       continue;
     }
+    last_feedback_module_ = rtp_module;
     rtp_module->SendCombinedRtcpPacket(std::move(packets));
     return true;
   }
@@ -100,6 +100,10 @@ class PacketRouter : public RemoteBitrateObserver,
   std::list<RtpRtcp*> send_modules_list_ RTC_GUARDED_BY(modules_crit_);
   // The last module used to send media.
   RtpRtcp* last_send_module_ RTC_GUARDED_BY(modules_crit_);
+  // The last send module used to send RTCP feedback; caches the result of
+  // scanning |send_modules_list_| for a module with RTCP enabled, so that
+  // frequent transport feedback does not rescan the list on every send.
+  RtpRtcp* last_feedback_module_ RTC_GUARDED_BY(modules_crit_);
   // Rtcp modules of the rtp receivers.
   std::vector<RtcpFeedbackSenderInterface*> rtcp_feedback_senders_
       RTC_GUARDED_BY(modules_crit_);
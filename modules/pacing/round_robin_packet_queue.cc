@@ -11,10 +11,9 @@
 #include "modules/pacing/round_robin_packet_queue.h"
 
 #include <algorithm>
-#include <cstdint>
+#include <tuple>
 #include <utility>
 
-#include "absl/strings/match.h"
 #include "rtc_base/checks.h"
 
 namespace webrtc {
@@ -22,98 +21,79 @@ namespace {
 static constexpr DataSize kMaxLeadingSize = DataSize::Bytes(1400);
 }
 
-RoundRobinPacketQueue::QueuedPacket::QueuedPacket(const QueuedPacket& rhs) =
-    default;
-RoundRobinPacketQueue::QueuedPacket::~QueuedPacket() = default;
-
-RoundRobinPacketQueue::QueuedPacket::QueuedPacket(
-    int priority,
-    Timestamp enqueue_time,
-    uint64_t enqueue_order,
-    std::multiset<Timestamp>::iterator enqueue_time_it,
-    std::unique_ptr<RtpPacketToSend> packet)
-    : priority_(priority),
-      enqueue_time_(enqueue_time),
-      enqueue_order_(enqueue_order),
-      is_retransmission_(packet->packet_type() ==
-                         RtpPacketMediaType::kRetransmission),
-      enqueue_time_it_(enqueue_time_it),
-      owned_packet_(packet.release()) {}
-
-bool RoundRobinPacketQueue::QueuedPacket::operator<(
-    const RoundRobinPacketQueue::QueuedPacket& other) const {
-  if (priority_ != other.priority_)
-    return priority_ > other.priority_;
-  if (is_retransmission_ != other.is_retransmission_)
-    return other.is_retransmission_;
-
-  return enqueue_order_ > other.enqueue_order_;
-}
-
-int RoundRobinPacketQueue::QueuedPacket::Priority() const {
-  return priority_;
-}
-
-RtpPacketMediaType RoundRobinPacketQueue::QueuedPacket::Type() const {
-  return *owned_packet_->packet_type();
-}
-
-uint32_t RoundRobinPacketQueue::QueuedPacket::Ssrc() const {
-  return owned_packet_->Ssrc();
-}
-
-Timestamp RoundRobinPacketQueue::QueuedPacket::EnqueueTime() const {
-  return enqueue_time_;
-}
-
-bool RoundRobinPacketQueue::QueuedPacket::IsRetransmission() const {
-  return Type() == RtpPacketMediaType::kRetransmission;
-}
-
-uint64_t RoundRobinPacketQueue::QueuedPacket::EnqueueOrder() const {
-  return enqueue_order_;
-}
-
-RtpPacketToSend* RoundRobinPacketQueue::QueuedPacket::RtpPacket() const {
-  return owned_packet_;
-}
-
-void RoundRobinPacketQueue::QueuedPacket::UpdateEnqueueTimeIterator(
-    std::multiset<Timestamp>::iterator it) {
-  enqueue_time_it_ = it;
+void RoundRobinPacketQueue::PacketFifo::push_back(QueuedPacket* packet) {
+  packet->prev = tail_;
+  packet->next = nullptr;
+  if (tail_) {
+    tail_->next = packet;
+  } else {
+    head_ = packet;
+  }
+  tail_ = packet;
 }
 
-std::multiset<Timestamp>::iterator
-RoundRobinPacketQueue::QueuedPacket::EnqueueTimeIterator() const {
-  return enqueue_time_it_;
+RoundRobinPacketQueue::QueuedPacket*
+RoundRobinPacketQueue::PacketFifo::pop_front() {
+  RTC_DCHECK(head_);
+  QueuedPacket* packet = head_;
+  head_ = packet->next;
+  if (head_) {
+    head_->prev = nullptr;
+  } else {
+    tail_ = nullptr;
+  }
+  packet->prev = nullptr;
+  packet->next = nullptr;
+  return packet;
 }
 
-void RoundRobinPacketQueue::QueuedPacket::SubtractPauseTime(
-    TimeDelta pause_time_sum) {
-  enqueue_time_ -= pause_time_sum;
+void RoundRobinPacketQueue::StreamList::push_back(Stream* stream) {
+  stream->prev = tail_;
+  stream->next = nullptr;
+  if (tail_) {
+    tail_->next = stream;
+  } else {
+    head_ = stream;
+  }
+  tail_ = stream;
 }
 
-RoundRobinPacketQueue::PriorityPacketQueue::const_iterator
-RoundRobinPacketQueue::PriorityPacketQueue::begin() const {
-  return c.begin();
+void RoundRobinPacketQueue::StreamList::remove(Stream* stream) {
+  if (stream->prev) {
+    stream->prev->next = stream->next;
+  } else {
+    RTC_DCHECK_EQ(head_, stream);
+    head_ = stream->next;
+  }
+  if (stream->next) {
+    stream->next->prev = stream->prev;
+  } else {
+    RTC_DCHECK_EQ(tail_, stream);
+    tail_ = stream->prev;
+  }
+  stream->prev = nullptr;
+  stream->next = nullptr;
 }
 
-RoundRobinPacketQueue::PriorityPacketQueue::const_iterator
-RoundRobinPacketQueue::PriorityPacketQueue::end() const {
-  return c.end();
+RoundRobinPacketQueue::Stream*
+RoundRobinPacketQueue::StreamList::FindLeastUsedStream() const {
+  Stream* best = head_;
+  for (Stream* stream = head_; stream != nullptr; stream = stream->next) {
+    if (stream->size < best->size)
+      best = stream;
+  }
+  return best;
 }
 
-RoundRobinPacketQueue::Stream::Stream() : size(DataSize::Zero()), ssrc(0) {}
-RoundRobinPacketQueue::Stream::Stream(const Stream& stream) = default;
+RoundRobinPacketQueue::Stream::Stream()
+    : size(DataSize::Zero()),
+      ssrc(0),
+      packet_count(0),
+      scheduled_level(-1),
+      prev(nullptr),
+      next(nullptr) {}
 RoundRobinPacketQueue::Stream::~Stream() = default;
 
-bool IsEnabled(const WebRtcKeyValueConfig* field_trials, const char* name) {
-  if (!field_trials) {
-    return false;
-  }
-  return absl::StartsWith(field_trials->Lookup(name), "Enabled");
-}
-
 RoundRobinPacketQueue::RoundRobinPacketQueue(
     Timestamp start_time,
     const WebRtcKeyValueConfig* field_trials)
@@ -125,13 +105,19 @@ RoundRobinPacketQueue::RoundRobinPacketQueue(
       max_size_(kMaxLeadingSize),
       queue_time_sum_(TimeDelta::Zero()),
       pause_time_sum_(TimeDelta::Zero()),
+      packet_free_list_(nullptr),
+      single_packet_queue_(nullptr),
       include_overhead_(false) {}
 
 RoundRobinPacketQueue::~RoundRobinPacketQueue() {
-  // Make sure to release any packets owned by raw pointer in QueuedPacket.
   while (!Empty()) {
     Pop();
   }
+  while (packet_free_list_) {
+    QueuedPacket* packet = packet_free_list_;
+    packet_free_list_ = packet->next;
+    delete packet;
+  }
 }
 
 void RoundRobinPacketQueue::Push(int priority,
@@ -139,59 +125,71 @@ void RoundRobinPacketQueue::Push(int priority,
                                  uint64_t enqueue_order,
                                  std::unique_ptr<RtpPacketToSend> packet) {
   RTC_DCHECK(packet->packet_type().has_value());
-  if (size_packets_ == 0) {
+  RTC_DCHECK_GE(priority, 0);
+  RTC_DCHECK_LT(priority, kNumPriorityLevels);
+
+  QueuedPacket* queued_packet = AllocatePacket();
+  queued_packet->priority =
+      std::max(0, std::min(priority, kNumPriorityLevels - 1));
+  queued_packet->is_retransmission =
+      packet->packet_type() == RtpPacketMediaType::kRetransmission;
+  queued_packet->enqueue_time = enqueue_time;
+  queued_packet->packet = std::move(packet);
+
+  UpdateQueueTime(enqueue_time);
+  queued_packet->pause_time_at_enqueue = pause_time_sum_;
+  size_packets_ += 1;
+  size_ += PacketSize(*queued_packet);
+
+  if (size_packets_ == 1) {
     // Single packet fast-path.
-    single_packet_queue_.emplace(
-        QueuedPacket(priority, enqueue_time, enqueue_order,
-                     enqueue_times_.end(), std::move(packet)));
-    UpdateQueueTime(enqueue_time);
-    single_packet_queue_->SubtractPauseTime(pause_time_sum_);
-    size_packets_ = 1;
-    size_ += PacketSize(*single_packet_queue_);
+    single_packet_queue_ = queued_packet;
   } else {
     MaybePromoteSinglePacketToNormalQueue();
-    Push(QueuedPacket(priority, enqueue_time, enqueue_order,
-                      enqueue_times_.insert(enqueue_time), std::move(packet)));
+    Push(queued_packet);
   }
 }
 
 std::unique_ptr<RtpPacketToSend> RoundRobinPacketQueue::Pop() {
-  if (single_packet_queue_.has_value()) {
-    RTC_DCHECK(stream_priorities_.empty());
-    std::unique_ptr<RtpPacketToSend> rtp_packet(
-        single_packet_queue_->RtpPacket());
-    single_packet_queue_.reset();
+  if (single_packet_queue_ != nullptr) {
+    QueuedPacket* queued_packet = single_packet_queue_;
+    single_packet_queue_ = nullptr;
     queue_time_sum_ = TimeDelta::Zero();
     size_packets_ = 0;
     size_ = DataSize::Zero();
+    std::unique_ptr<RtpPacketToSend> rtp_packet =
+        std::move(queued_packet->packet);
+    FreePacket(queued_packet);
     return rtp_packet;
   }
 
   RTC_DCHECK(!Empty());
   Stream* stream = GetHighestPriorityStream();
-  const QueuedPacket& queued_packet = stream->packet_queue.top();
+  const int level = stream->scheduled_level;
+  RTC_DCHECK_EQ(level, TopPriorityLevel(*stream));
 
-  stream_priorities_.erase(stream->priority_it);
+  PacketFifo& retransmission_fifo = stream->retransmission_fifos[level];
+  QueuedPacket* queued_packet = !retransmission_fifo.empty()
+                                    ? retransmission_fifo.pop_front()
+                                    : stream->packet_fifos[level].pop_front();
+  stream->packet_count -= 1;
 
   // Calculate the total amount of time spent by this packet in the queue
-  // while in a non-paused state. Note that the |pause_time_sum_ms_| was
-  // subtracted from |packet.enqueue_time_ms| when the packet was pushed, and
-  // by subtracting it now we effectively remove the time spent in in the
-  // queue while in a paused state.
+  // while in a non-paused state. |pause_time_at_enqueue| was recorded when
+  // the packet was pushed; subtracting the pause time accumulated since then
+  // removes the time the packet spent in the queue while paused.
   TimeDelta time_in_non_paused_state =
-      time_last_updated_ - queued_packet.EnqueueTime() - pause_time_sum_;
+      time_last_updated_ - queued_packet->enqueue_time +
+      queued_packet->pause_time_at_enqueue - pause_time_sum_;
   queue_time_sum_ -= time_in_non_paused_state;
 
-  RTC_CHECK(queued_packet.EnqueueTimeIterator() != enqueue_times_.end());
-  enqueue_times_.erase(queued_packet.EnqueueTimeIterator());
-
-  // Update |bytes| of this stream. The general idea is that the stream that
+  // Update |size| of this stream. The general idea is that the stream that
   // has sent the least amount of bytes should have the highest priority.
   // The problem with that is if streams send with different rates, in which
   // case a "budget" will be built up for the stream sending at the lower
-  // rate. To avoid building a too large budget we limit |bytes| to be within
+  // rate. To avoid building a too large budget we limit |size| to be within
   // kMaxLeading bytes of the stream that has sent the most amount of bytes.
-  DataSize packet_size = PacketSize(queued_packet);
+  DataSize packet_size = PacketSize(*queued_packet);
   stream->size =
       std::max(stream->size + packet_size, max_size_ - kMaxLeadingSize);
   max_size_ = std::max(max_size_, stream->size);
@@ -200,28 +198,27 @@ std::unique_ptr<RtpPacketToSend> RoundRobinPacketQueue::Pop() {
   size_packets_ -= 1;
   RTC_CHECK(size_packets_ > 0 || queue_time_sum_ == TimeDelta::Zero());
 
-  std::unique_ptr<RtpPacketToSend> rtp_packet(queued_packet.RtpPacket());
-  stream->packet_queue.pop();
-
-  // If there are packets left to be sent, schedule the stream again.
-  RTC_CHECK(!IsSsrcScheduled(stream->ssrc));
-  if (stream->packet_queue.empty()) {
-    stream->priority_it = stream_priorities_.end();
-  } else {
-    int priority = stream->packet_queue.top().Priority();
-    stream->priority_it = stream_priorities_.emplace(
-        StreamPrioKey(priority, stream->size), stream->ssrc);
+  // If there are packets left to be sent, schedule the stream again. Always
+  // relinking the stream rotates it to the back of its level list, which
+  // keeps the round-robin rotation between streams of equal size.
+  scheduled_streams_[level].remove(stream);
+  stream->scheduled_level = -1;
+  const int new_level = TopPriorityLevel(*stream);
+  if (new_level < kNumPriorityLevels) {
+    ScheduleStream(stream, new_level);
   }
 
+  std::unique_ptr<RtpPacketToSend> rtp_packet =
+      std::move(queued_packet->packet);
+  FreePacket(queued_packet);
   return rtp_packet;
 }
 
 bool RoundRobinPacketQueue::Empty() const {
   if (size_packets_ == 0) {
-    RTC_DCHECK(!single_packet_queue_.has_value() && stream_priorities_.empty());
+    RTC_DCHECK(single_packet_queue_ == nullptr);
     return true;
   }
-  RTC_DCHECK(single_packet_queue_.has_value() || !stream_priorities_.empty());
   return false;
 }
 
@@ -235,34 +232,87 @@ DataSize RoundRobinPacketQueue::Size() const {
 
 absl::optional<Timestamp> RoundRobinPacketQueue::LeadingAudioPacketEnqueueTime()
     const {
-  if (single_packet_queue_.has_value()) {
-    if (single_packet_queue_->Type() == RtpPacketMediaType::kAudio) {
-      return single_packet_queue_->EnqueueTime();
-    }
-    return absl::nullopt;
-  }
-
-  if (stream_priorities_.empty()) {
-    return absl::nullopt;
+  const QueuedPacket* top_packet = nullptr;
+  if (single_packet_queue_ != nullptr) {
+    top_packet = single_packet_queue_;
+  } else if (size_packets_ > 0) {
+    top_packet = TopPacket(*GetHighestPriorityStream());
   }
-  uint32_t ssrc = stream_priorities_.begin()->second;
-
-  const auto& top_packet = streams_.find(ssrc)->second.packet_queue.top();
-  if (top_packet.Type() == RtpPacketMediaType::kAudio) {
-    return top_packet.EnqueueTime();
+  if (top_packet &&
+      top_packet->packet->packet_type() == RtpPacketMediaType::kAudio) {
+    return top_packet->enqueue_time - top_packet->pause_time_at_enqueue;
   }
   return absl::nullopt;
 }
 
 Timestamp RoundRobinPacketQueue::OldestEnqueueTime() const {
-  if (single_packet_queue_.has_value()) {
-    return single_packet_queue_->EnqueueTime();
+  if (single_packet_queue_ != nullptr) {
+    return single_packet_queue_->enqueue_time -
+           single_packet_queue_->pause_time_at_enqueue;
   }
 
   if (Empty())
     return Timestamp::MinusInfinity();
-  RTC_CHECK(!enqueue_times_.empty());
-  return *enqueue_times_.begin();
+
+  // Packets are pushed with non-decreasing enqueue times, so within each FIFO
+  // the front packet is the oldest one.
+  Timestamp oldest = Timestamp::PlusInfinity();
+  for (const auto& kv : streams_) {
+    const Stream& stream = kv.second;
+    if (stream.packet_count == 0)
+      continue;
+    for (int level = 0; level < kNumPriorityLevels; ++level) {
+      if (!stream.retransmission_fifos[level].empty()) {
+        oldest = std::min(
+            oldest, stream.retransmission_fifos[level].front()->enqueue_time);
+      }
+      if (!stream.packet_fifos[level].empty()) {
+        oldest =
+            std::min(oldest, stream.packet_fifos[level].front()->enqueue_time);
+      }
+    }
+  }
+  RTC_DCHECK(oldest.IsFinite());
+  return oldest;
+}
+
+std::vector<PacerStreamQueueInfo> RoundRobinPacketQueue::GetStreamQueueInfos(
+    Timestamp now) const {
+  std::vector<PacerStreamQueueInfo> infos;
+  if (single_packet_queue_ != nullptr) {
+    PacerStreamQueueInfo info;
+    info.ssrc = single_packet_queue_->packet->Ssrc();
+    info.packet_count = 1;
+    info.size = PacketSize(*single_packet_queue_);
+    info.oldest_packet_wait_time = now - single_packet_queue_->enqueue_time;
+    infos.push_back(info);
+    return infos;
+  }
+  for (const auto& kv : streams_) {
+    const Stream& stream = kv.second;
+    if (stream.packet_count == 0)
+      continue;
+    PacerStreamQueueInfo info;
+    info.ssrc = stream.ssrc;
+    info.packet_count = stream.packet_count;
+    // Within each FIFO the front packet is the oldest one.
+    Timestamp oldest = Timestamp::PlusInfinity();
+    for (int level = 0; level < kNumPriorityLevels; ++level) {
+      for (const PacketFifo* fifo :
+           {&stream.retransmission_fifos[level], &stream.packet_fifos[level]}) {
+        if (!fifo->empty())
+          oldest = std::min(oldest, fifo->front()->enqueue_time);
+        for (const QueuedPacket* packet = fifo->front(); packet != nullptr;
+             packet = packet->next) {
+          info.size += PacketSize(*packet);
+        }
+      }
+    }
+    RTC_DCHECK(oldest.IsFinite());
+    info.oldest_packet_wait_time = now - oldest;
+    infos.push_back(info);
+  }
+  return infos;
 }
 
 void RoundRobinPacketQueue::UpdateQueueTime(Timestamp now) {
@@ -292,10 +342,17 @@ void RoundRobinPacketQueue::SetIncludeOverhead() {
   MaybePromoteSinglePacketToNormalQueue();
   include_overhead_ = true;
   // We need to update the size to reflect overhead for existing packets.
-  for (const auto& stream : streams_) {
-    for (const QueuedPacket& packet : stream.second.packet_queue) {
-      size_ += DataSize::Bytes(packet.RtpPacket()->headers_size()) +
-               transport_overhead_per_packet_;
+  for (const auto& kv : streams_) {
+    const Stream& stream = kv.second;
+    for (int level = 0; level < kNumPriorityLevels; ++level) {
+      for (const PacketFifo* fifo :
+           {&stream.retransmission_fifos[level], &stream.packet_fifos[level]}) {
+        for (const QueuedPacket* packet = fifo->front(); packet != nullptr;
+             packet = packet->next) {
+          size_ += DataSize::Bytes(packet->packet->headers_size()) +
+                   transport_overhead_per_packet_;
+        }
+      }
     }
   }
 }
@@ -305,8 +362,8 @@ void RoundRobinPacketQueue::SetTransportOverhead(DataSize overhead_per_packet) {
   if (include_overhead_) {
     DataSize previous_overhead = transport_overhead_per_packet_;
     // We need to update the size to reflect overhead for existing packets.
-    for (const auto& stream : streams_) {
-      int packets = stream.second.packet_queue.size();
+    for (const auto& kv : streams_) {
+      int64_t packets = kv.second.packet_count;
       size_ -= packets * previous_overhead;
       size_ += packets * overhead_per_packet;
     }
@@ -320,87 +377,107 @@ TimeDelta RoundRobinPacketQueue::AverageQueueTime() const {
   return queue_time_sum_ / size_packets_;
 }
 
-void RoundRobinPacketQueue::Push(QueuedPacket packet) {
-  auto stream_info_it = streams_.find(packet.Ssrc());
+void RoundRobinPacketQueue::Push(QueuedPacket* packet) {
+  const uint32_t ssrc = packet->packet->Ssrc();
+  auto stream_info_it = streams_.find(ssrc);
   if (stream_info_it == streams_.end()) {
-    stream_info_it = streams_.emplace(packet.Ssrc(), Stream()).first;
-    stream_info_it->second.priority_it = stream_priorities_.end();
-    stream_info_it->second.ssrc = packet.Ssrc();
+    // std::map constructs the (non-copyable) Stream in place.
+    stream_info_it = streams_.emplace(std::piecewise_construct,
+                                      std::forward_as_tuple(ssrc),
+                                      std::forward_as_tuple())
+                         .first;
+    stream_info_it->second.ssrc = ssrc;
   }
 
   Stream* stream = &stream_info_it->second;
 
-  if (stream->priority_it == stream_priorities_.end()) {
-    // If the SSRC is not currently scheduled, add it to |stream_priorities_|.
-    RTC_CHECK(!IsSsrcScheduled(stream->ssrc));
-    stream->priority_it = stream_priorities_.emplace(
-        StreamPrioKey(packet.Priority(), stream->size), packet.Ssrc());
-  } else if (packet.Priority() < stream->priority_it->first.priority) {
-    // If the priority of this SSRC increased, remove the outdated StreamPrioKey
-    // and insert a new one with the new priority. Note that |priority_| uses
-    // lower ordinal for higher priority.
-    stream_priorities_.erase(stream->priority_it);
-    stream->priority_it = stream_priorities_.emplace(
-        StreamPrioKey(packet.Priority(), stream->size), packet.Ssrc());
+  const int level = packet->priority;
+  if (stream->scheduled_level == -1 || level < stream->scheduled_level) {
+    // If the stream is not currently scheduled, or the priority of this
+    // packet is higher than the level the stream is scheduled at, (re-)link
+    // the stream at the new level. Note that lower level numbers mean higher
+    // priority.
+    ScheduleStream(stream, level);
   }
-  RTC_CHECK(stream->priority_it != stream_priorities_.end());
 
-  if (packet.EnqueueTimeIterator() == enqueue_times_.end()) {
-    // Promotion from single-packet queue. Just add to enqueue times.
-    packet.UpdateEnqueueTimeIterator(
-        enqueue_times_.insert(packet.EnqueueTime()));
-  } else {
-    // In order to figure out how much time a packet has spent in the queue
-    // while not in a paused state, we subtract the total amount of time the
-    // queue has been paused so far, and when the packet is popped we subtract
-    // the total amount of time the queue has been paused at that moment. This
-    // way we subtract the total amount of time the packet has spent in the
-    // queue while in a paused state.
-    UpdateQueueTime(packet.EnqueueTime());
-    packet.SubtractPauseTime(pause_time_sum_);
-
-    size_packets_ += 1;
-    size_ += PacketSize(packet);
+  PacketFifo& fifo = packet->is_retransmission
+                         ? stream->retransmission_fifos[level]
+                         : stream->packet_fifos[level];
+  fifo.push_back(packet);
+  stream->packet_count += 1;
+}
+
+RoundRobinPacketQueue::QueuedPacket* RoundRobinPacketQueue::AllocatePacket() {
+  if (packet_free_list_ != nullptr) {
+    QueuedPacket* packet = packet_free_list_;
+    packet_free_list_ = packet->next;
+    packet->next = nullptr;
+    return packet;
   }
+  return new QueuedPacket();
+}
 
-  stream->packet_queue.push(packet);
+void RoundRobinPacketQueue::FreePacket(QueuedPacket* packet) {
+  RTC_DCHECK(packet->packet == nullptr);
+  packet->prev = nullptr;
+  packet->next = packet_free_list_;
+  packet_free_list_ = packet;
 }
 
 DataSize RoundRobinPacketQueue::PacketSize(const QueuedPacket& packet) const {
-  DataSize packet_size = DataSize::Bytes(packet.RtpPacket()->payload_size() +
-                                         packet.RtpPacket()->padding_size());
+  DataSize packet_size = DataSize::Bytes(packet.packet->payload_size() +
+                                         packet.packet->padding_size());
   if (include_overhead_) {
-    packet_size += DataSize::Bytes(packet.RtpPacket()->headers_size()) +
+    packet_size += DataSize::Bytes(packet.packet->headers_size()) +
                    transport_overhead_per_packet_;
   }
   return packet_size;
 }
 
 void RoundRobinPacketQueue::MaybePromoteSinglePacketToNormalQueue() {
-  if (single_packet_queue_.has_value()) {
-    Push(*single_packet_queue_);
-    single_packet_queue_.reset();
+  if (single_packet_queue_ != nullptr) {
+    QueuedPacket* packet = single_packet_queue_;
+    single_packet_queue_ = nullptr;
+    Push(packet);
   }
 }
 
-RoundRobinPacketQueue::Stream*
-RoundRobinPacketQueue::GetHighestPriorityStream() {
-  RTC_CHECK(!stream_priorities_.empty());
-  uint32_t ssrc = stream_priorities_.begin()->second;
+int RoundRobinPacketQueue::TopPriorityLevel(const Stream& stream) const {
+  for (int level = 0; level < kNumPriorityLevels; ++level) {
+    if (!stream.retransmission_fifos[level].empty() ||
+        !stream.packet_fifos[level].empty()) {
+      return level;
+    }
+  }
+  return kNumPriorityLevels;
+}
 
-  auto stream_info_it = streams_.find(ssrc);
-  RTC_CHECK(stream_info_it != streams_.end());
-  RTC_CHECK(stream_info_it->second.priority_it == stream_priorities_.begin());
-  RTC_CHECK(!stream_info_it->second.packet_queue.empty());
-  return &stream_info_it->second;
+const RoundRobinPacketQueue::QueuedPacket* RoundRobinPacketQueue::TopPacket(
+    const Stream& stream) const {
+  const int level = TopPriorityLevel(stream);
+  if (level == kNumPriorityLevels)
+    return nullptr;
+  if (!stream.retransmission_fifos[level].empty())
+    return stream.retransmission_fifos[level].front();
+  return stream.packet_fifos[level].front();
+}
+
+void RoundRobinPacketQueue::ScheduleStream(Stream* stream, int level) {
+  if (stream->scheduled_level != -1)
+    scheduled_streams_[stream->scheduled_level].remove(stream);
+  scheduled_streams_[level].push_back(stream);
+  stream->scheduled_level = level;
 }
 
-bool RoundRobinPacketQueue::IsSsrcScheduled(uint32_t ssrc) const {
-  for (const auto& scheduled_stream : stream_priorities_) {
-    if (scheduled_stream.second == ssrc)
-      return true;
+RoundRobinPacketQueue::Stream* RoundRobinPacketQueue::GetHighestPriorityStream()
+    const {
+  for (int level = 0; level < kNumPriorityLevels; ++level) {
+    if (!scheduled_streams_[level].empty()) {
+      return scheduled_streams_[level].FindLeastUsedStream();
+    }
   }
-  return false;
+  RTC_NOTREACHED();
+  return nullptr;
 }
 
 }  // namespace webrtc
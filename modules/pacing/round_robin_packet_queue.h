@@ -14,13 +14,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <list>
 #include <map>
 #include <memory>
-#include <queue>
-#include <set>
+#include <vector>
 
 #include "absl/types/optional.h"
+#include "api/transport/network_types.h"
 #include "api/transport/webrtc_key_value_config.h"
 #include "api/units/data_size.h"
 #include "api/units/time_delta.h"
@@ -31,6 +30,11 @@
 
 namespace webrtc {
 
+// A deficit round-robin packet queue for the pacer. Streams are scheduled
+// round-robin weighted by the amount of data sent per stream, and packets
+// within a stream are kept in intrusive doubly linked FIFOs indexed by a
+// small static array of priority levels, so both Push() and Pop() avoid
+// rebalancing of ordered containers on the per-packet path.
 class RoundRobinPacketQueue {
  public:
   RoundRobinPacketQueue(Timestamp start_time,
@@ -54,96 +58,106 @@ class RoundRobinPacketQueue {
 
   Timestamp OldestEnqueueTime() const;
   TimeDelta AverageQueueTime() const;
+  // Returns queue depth, size and oldest-packet age per stream with queued
+  // packets. Walks the queued packets, so call at introspection rate (stats
+  // polls), not per packet.
+  std::vector<PacerStreamQueueInfo> GetStreamQueueInfos(Timestamp now) const;
   void UpdateQueueTime(Timestamp now);
   void SetPauseState(bool paused, Timestamp now);
   void SetIncludeOverhead();
   void SetTransportOverhead(DataSize overhead_per_packet);
 
  private:
-  struct QueuedPacket {
-   public:
-    QueuedPacket(int priority,
-                 Timestamp enqueue_time,
-                 uint64_t enqueue_order,
-                 std::multiset<Timestamp>::iterator enqueue_time_it,
-                 std::unique_ptr<RtpPacketToSend> packet);
-    QueuedPacket(const QueuedPacket& rhs);
-    ~QueuedPacket();
-
-    bool operator<(const QueuedPacket& other) const;
-
-    int Priority() const;
-    RtpPacketMediaType Type() const;
-    uint32_t Ssrc() const;
-    Timestamp EnqueueTime() const;
-    bool IsRetransmission() const;
-    uint64_t EnqueueOrder() const;
-    RtpPacketToSend* RtpPacket() const;
-
-    std::multiset<Timestamp>::iterator EnqueueTimeIterator() const;
-    void UpdateEnqueueTimeIterator(std::multiset<Timestamp>::iterator it);
-    void SubtractPauseTime(TimeDelta pause_time_sum);
+  // The pacer maps every RtpPacketMediaType to one of these levels; see
+  // GetPriorityForType() in pacing_controller.cc. Lower level numbers take
+  // priority over higher.
+  static constexpr int kNumPriorityLevels = 5;
 
-   private:
-    int priority_;
-    Timestamp enqueue_time_;  // Absolute time of pacer queue entry.
-    uint64_t enqueue_order_;
-    bool is_retransmission_;  // Cached for performance.
-    std::multiset<Timestamp>::iterator enqueue_time_it_;
-    // Raw pointer since priority_queue doesn't allow for moving
-    // out of the container.
-    RtpPacketToSend* owned_packet_;
+  // A packet in the queue. Doubles as an intrusive doubly linked FIFO node;
+  // popped nodes are recycled through |packet_free_list_|.
+  struct QueuedPacket {
+    int priority = 0;
+    bool is_retransmission = false;
+    // Absolute time of pacer queue entry.
+    Timestamp enqueue_time = Timestamp::MinusInfinity();
+    // Value of |pause_time_sum_| when this packet was pushed. Used to exclude
+    // time spent in a paused state from the queue time of this packet.
+    TimeDelta pause_time_at_enqueue = TimeDelta::Zero();
+    std::unique_ptr<RtpPacketToSend> packet;
+
+    QueuedPacket* prev = nullptr;
+    QueuedPacket* next = nullptr;
   };
 
-  class PriorityPacketQueue : public std::priority_queue<QueuedPacket> {
+  // Intrusive FIFO of QueuedPackets. Does not own the nodes.
+  class PacketFifo {
    public:
-    using const_iterator = container_type::const_iterator;
-    const_iterator begin() const;
-    const_iterator end() const;
-  };
-
-  struct StreamPrioKey {
-    StreamPrioKey(int priority, DataSize size)
-        : priority(priority), size(size) {}
-
-    bool operator<(const StreamPrioKey& other) const {
-      if (priority != other.priority)
-        return priority < other.priority;
-      return size < other.size;
-    }
+    bool empty() const { return head_ == nullptr; }
+    QueuedPacket* front() const { return head_; }
+    void push_back(QueuedPacket* packet);
+    QueuedPacket* pop_front();
 
-    const int priority;
-    const DataSize size;
+   private:
+    QueuedPacket* head_ = nullptr;
+    QueuedPacket* tail_ = nullptr;
   };
 
   struct Stream {
     Stream();
-    Stream(const Stream&);
-
-    virtual ~Stream();
+    Stream(const Stream&) = delete;
+    Stream& operator=(const Stream&) = delete;
+    ~Stream();
 
+    // Accumulated amount of data sent for this stream; the deficit counter of
+    // the round-robin scheduling. The stream that has sent the least is
+    // scheduled first within a priority level.
     DataSize size;
     uint32_t ssrc;
+    size_t packet_count;
+
+    // Per priority level, retransmissions are sent before other packets of
+    // the same level, so each level holds two FIFOs.
+    PacketFifo retransmission_fifos[kNumPriorityLevels];
+    PacketFifo packet_fifos[kNumPriorityLevels];
+
+    // The priority level list in |scheduled_streams_| this stream is
+    // currently linked into, or -1 if the stream has no queued packets.
+    int scheduled_level;
+    Stream* prev;
+    Stream* next;
+  };
 
-    PriorityPacketQueue packet_queue;
+  // Intrusive doubly linked list of scheduled streams for one priority
+  // level. Does not own the nodes.
+  class StreamList {
+   public:
+    bool empty() const { return head_ == nullptr; }
+    Stream* front() const { return head_; }
+    void push_back(Stream* stream);
+    void remove(Stream* stream);
 
-    // Whenever a packet is inserted for this stream we check if |priority_it|
-    // points to an element in |stream_priorities_|, and if it does it means
-    // this stream has already been scheduled, and if the scheduled priority is
-    // lower than the priority of the incoming packet we reschedule this stream
-    // with the higher priority.
-    std::multimap<StreamPrioKey, uint32_t>::iterator priority_it;
+    // Returns the stream with the smallest |size|.
+    Stream* FindLeastUsedStream() const;
+
+   private:
+    Stream* head_ = nullptr;
+    Stream* tail_ = nullptr;
   };
 
-  void Push(QueuedPacket packet);
+  void Push(QueuedPacket* packet);
+  QueuedPacket* AllocatePacket();
+  void FreePacket(QueuedPacket* packet);
 
   DataSize PacketSize(const QueuedPacket& packet) const;
   void MaybePromoteSinglePacketToNormalQueue();
 
-  Stream* GetHighestPriorityStream();
-
-  // Just used to verify correctness.
-  bool IsSsrcScheduled(uint32_t ssrc) const;
+  // Returns the priority level of the first packet Pop() would return for
+  // |stream|, or kNumPriorityLevels if the stream has no queued packets.
+  int TopPriorityLevel(const Stream& stream) const;
+  const QueuedPacket* TopPacket(const Stream& stream) const;
+  // (Re-)links |stream| into the scheduled stream list matching |level|.
+  void ScheduleStream(Stream* stream, int level);
+  Stream* GetHighestPriorityStream() const;
 
   DataSize transport_overhead_per_packet_;
 
@@ -156,20 +170,19 @@ class RoundRobinPacketQueue {
   TimeDelta queue_time_sum_;
   TimeDelta pause_time_sum_;
 
-  // A map of streams used to prioritize from which stream to send next. We use
-  // a multimap instead of a priority_queue since the priority of a stream can
-  // change as a new packet is inserted, and a multimap allows us to remove and
-  // then reinsert a StreamPrioKey if the priority has increased.
-  std::multimap<StreamPrioKey, uint32_t> stream_priorities_;
+  // Scheduled streams per priority level. A stream is linked into the list
+  // of the highest-priority (lowest number) level among its queued packets.
+  StreamList scheduled_streams_[kNumPriorityLevels];
 
   // A map of SSRCs to Streams.
   std::map<uint32_t, Stream> streams_;
 
-  // The enqueue time of every packet currently in the queue. Used to figure out
-  // the age of the oldest packet in the queue.
-  std::multiset<Timestamp> enqueue_times_;
+  // Recycled QueuedPacket nodes, singly linked through |next|.
+  QueuedPacket* packet_free_list_;
 
-  absl::optional<QueuedPacket> single_packet_queue_;
+  // Fast path when a single packet is pushed into an empty queue; avoids the
+  // stream bookkeeping until a second packet arrives.
+  QueuedPacket* single_packet_queue_;
 
   bool include_overhead_;
 };
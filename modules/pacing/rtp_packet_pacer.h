@@ -13,7 +13,10 @@
 
 #include <stdint.h>
 
+#include <vector>
+
 #include "absl/types/optional.h"
+#include "api/transport/network_types.h"
 #include "api/units/data_rate.h"
 #include "api/units/data_size.h"
 #include "api/units/time_delta.h"
@@ -46,6 +49,10 @@ class RtpPacketPacer {
   // Sum of payload + padding bytes of all packets currently in the pacer queue.
   virtual DataSize QueueSizeData() const = 0;
 
+  // Per-stream breakdown of the pacer queue, for congestion window pushback
+  // and stats.
+  virtual std::vector<PacerStreamQueueInfo> GetStreamQueueInfos() const = 0;
+
   // Returns the time when the first packet was sent.
   virtual absl::optional<Timestamp> FirstSentPacketTime() const = 0;
 
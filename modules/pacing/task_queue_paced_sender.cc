@@ -11,11 +11,14 @@
 #include "modules/pacing/task_queue_paced_sender.h"
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 #include "absl/memory/memory.h"
+#include "absl/strings/match.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/event.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/task_queue_mpsc.h"
 #include "rtc_base/task_utils/to_queued_task.h"
 
 namespace webrtc {
@@ -27,6 +30,24 @@ constexpr TimeDelta kMaxTimeBetweenStatsUpdates = TimeDelta::Millis(33);
 // Don't call UpdateStats() more than |kMinTimeBetweenStatsUpdates| apart,
 // for performance reasons.
 constexpr TimeDelta kMinTimeBetweenStatsUpdates = TimeDelta::Millis(1);
+
+// The pacer is posted to from the worker and network threads once per
+// packet; the lock-free MPSC task queue keeps those posts cheap. It runs
+// the queue on its own thread, so it cannot be used when the caller
+// injects a task queue factory that controls time (as the simulated-time
+// tests do), which is why it stays behind a field trial.
+std::unique_ptr<TaskQueueBase, TaskQueueDeleter> CreatePacerTaskQueue(
+    const WebRtcKeyValueConfig* field_trials,
+    TaskQueueFactory* task_queue_factory) {
+  if (field_trials &&
+      absl::StartsWith(field_trials->Lookup("WebRTC-MpscTaskQueue"),
+                       "Enabled")) {
+    return CreateTaskQueueMpscFactory()->CreateTaskQueue(
+        "TaskQueuePacedSender", TaskQueueFactory::Priority::NORMAL);
+  }
+  return task_queue_factory->CreateTaskQueue(
+      "TaskQueuePacedSender", TaskQueueFactory::Priority::NORMAL);
+}
 }  // namespace
 
 TaskQueuePacedSender::TaskQueuePacedSender(
@@ -48,9 +69,8 @@ TaskQueuePacedSender::TaskQueuePacedSender(
       stats_update_scheduled_(false),
       last_stats_time_(Timestamp::MinusInfinity()),
       is_shutdown_(false),
-      task_queue_(task_queue_factory->CreateTaskQueue(
-          "TaskQueuePacedSender",
-          TaskQueueFactory::Priority::NORMAL)) {}
+      current_stats_(std::make_shared<const Stats>()),
+      task_queue_(CreatePacerTaskQueue(field_trials, task_queue_factory)) {}
 
 TaskQueuePacedSender::~TaskQueuePacedSender() {
   // Post an immediate task to mark the queue as shutting down.
@@ -168,6 +188,11 @@ DataSize TaskQueuePacedSender::QueueSizeData() const {
   return GetStats().queue_size;
 }
 
+std::vector<PacerStreamQueueInfo> TaskQueuePacedSender::GetStreamQueueInfos()
+    const {
+  return GetStats().stream_queues;
+}
+
 absl::optional<Timestamp> TaskQueuePacedSender::FirstSentPacketTime() const {
   return GetStats().first_sent_packet_time;
 }
@@ -202,9 +227,15 @@ void TaskQueuePacedSender::MaybeProcessPackets(
     next_process_time = pacing_controller_.NextSendTime();
   }
 
-  const TimeDelta min_sleep = pacing_controller_.IsProbing()
-                                  ? PacingController::kMinSleepTime
-                                  : hold_back_window_;
+  // The hold-back window exists to coalesce wakeups when packets are queued
+  // for sending. When probing, or when the queue is empty and the next send
+  // time is dictated by padding or the paused-process interval, there is
+  // nothing to coalesce; sleep precisely until the pacer's next send time
+  // instead of waking up on the hold-back granularity.
+  const bool apply_hold_back = !pacing_controller_.IsProbing() &&
+                               pacing_controller_.QueueSizePackets() > 0;
+  const TimeDelta min_sleep =
+      apply_hold_back ? hold_back_window_ : PacingController::kMinSleepTime;
   next_process_time = std::max(now + min_sleep, next_process_time);
 
   TimeDelta sleep_time = next_process_time - now;
@@ -244,13 +275,24 @@ void TaskQueuePacedSender::MaybeUpdateStats(bool is_scheduled_call) {
     return;
   }
 
-  rtc::CritScope cs(&stats_crit_);
-  current_stats_.expected_queue_time = pacing_controller_.ExpectedQueueTime();
-  current_stats_.first_sent_packet_time =
-      pacing_controller_.FirstSentPacketTime();
-  current_stats_.oldest_packet_wait_time =
-      pacing_controller_.OldestPacketWaitTime();
-  current_stats_.queue_size = pacing_controller_.QueueSizeData();
+  Stats stats;
+  stats.expected_queue_time = pacing_controller_.ExpectedQueueTime();
+  stats.first_sent_packet_time = pacing_controller_.FirstSentPacketTime();
+  stats.oldest_packet_wait_time = pacing_controller_.OldestPacketWaitTime();
+  stats.queue_size = pacing_controller_.QueueSizeData();
+  stats.stream_queues = pacing_controller_.GetStreamQueueInfos();
+
+  // Only publish a new snapshot if anything changed; when the pacer is idle
+  // this avoids an allocation per poll.
+  std::shared_ptr<const Stats> previous = std::atomic_load(&current_stats_);
+  if (stats.expected_queue_time != previous->expected_queue_time ||
+      stats.first_sent_packet_time != previous->first_sent_packet_time ||
+      stats.oldest_packet_wait_time != previous->oldest_packet_wait_time ||
+      stats.queue_size != previous->queue_size ||
+      stats.stream_queues != previous->stream_queues) {
+    std::atomic_store(&current_stats_,
+                      std::make_shared<const Stats>(stats));
+  }
   last_stats_time_ = now;
 
   bool pacer_drained = pacing_controller_.QueueSizePackets() == 0 &&
@@ -273,8 +315,7 @@ void TaskQueuePacedSender::MaybeUpdateStats(bool is_scheduled_call) {
 }
 
 TaskQueuePacedSender::Stats TaskQueuePacedSender::GetStats() const {
-  rtc::CritScope cs(&stats_crit_);
-  return current_stats_;
+  return *std::atomic_load(&current_stats_);
 }
 
 }  // namespace webrtc
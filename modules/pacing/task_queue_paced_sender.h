@@ -29,7 +29,6 @@
 #include "modules/pacing/packet_router.h"
 #include "modules/pacing/rtp_packet_pacer.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
-#include "rtc_base/critical_section.h"
 #include "rtc_base/synchronization/sequence_checker.h"
 #include "rtc_base/task_queue.h"
 #include "rtc_base/thread_annotations.h"
@@ -95,6 +94,9 @@ class TaskQueuePacedSender : public RtpPacketPacer,
   // Returns total size of all packets in the pacer queue.
   DataSize QueueSizeData() const override;
 
+  // Returns the per-stream breakdown of the pacer queue.
+  std::vector<PacerStreamQueueInfo> GetStreamQueueInfos() const override;
+
   // Returns the time when the first packet was sent;
   absl::optional<Timestamp> FirstSentPacketTime() const override;
 
@@ -116,6 +118,7 @@ class TaskQueuePacedSender : public RtpPacketPacer,
     DataSize queue_size;
     TimeDelta expected_queue_time;
     absl::optional<Timestamp> first_sent_packet_time;
+    std::vector<PacerStreamQueueInfo> stream_queues;
   };
 
   // Check if it is time to send packets, or schedule a delayed task if not.
@@ -164,8 +167,10 @@ class TaskQueuePacedSender : public RtpPacketPacer,
   // never drain.
   bool is_shutdown_ RTC_GUARDED_BY(task_queue_);
 
-  rtc::CriticalSection stats_crit_;
-  Stats current_stats_ RTC_GUARDED_BY(stats_crit_);
+  // Snapshot of the current stats, published from the task queue with
+  // std::atomic_store and read with std::atomic_load by the stats getters,
+  // so that polling the stats never blocks the send path on a lock.
+  std::shared_ptr<const Stats> current_stats_;
 
   rtc::TaskQueue task_queue_;
 };
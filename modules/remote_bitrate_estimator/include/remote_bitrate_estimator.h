@@ -17,6 +17,7 @@
 #include <memory>
 #include <vector>
 
+#include "api/array_view.h"
 #include "modules/include/module.h"
 #include "modules/include/module_common_types.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
@@ -49,6 +50,14 @@ class TransportFeedbackSenderInterface {
 // TODO(holmer): Remove when all implementations have been updated.
 struct ReceiveBandwidthEstimatorStats {};
 
+// One received packet of a batched estimator update, see
+// RemoteBitrateEstimator::IncomingPacketBatch().
+struct PacketArrival {
+  int64_t arrival_time_ms = 0;
+  size_t payload_size = 0;
+  RTPHeader header;
+};
+
 class RemoteBitrateEstimator : public CallStatsObserver, public Module {
  public:
   ~RemoteBitrateEstimator() override {}
@@ -62,6 +71,18 @@ class RemoteBitrateEstimator : public CallStatsObserver, public Module {
                               size_t payload_size,
                               const RTPHeader& header) = 0;
 
+  // Batched variant of IncomingPacket() for callers that drain several
+  // packets from the socket in one go (see Socket::RecvFromBatch()).
+  // Implementations guarding their state with a lock should override this to
+  // take the lock once per batch instead of once per packet. This default
+  // loops over IncomingPacket().
+  virtual void IncomingPacketBatch(rtc::ArrayView<const PacketArrival> batch) {
+    for (const PacketArrival& packet : batch) {
+      IncomingPacket(packet.arrival_time_ms, packet.payload_size,
+                     packet.header);
+    }
+  }
+
   // Removes all data for |ssrc|.
   virtual void RemoveStream(uint32_t ssrc) = 0;
 
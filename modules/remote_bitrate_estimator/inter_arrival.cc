@@ -13,6 +13,7 @@
 #include <cassert>
 
 #include "modules/include/module_common_types_public.h"
+#include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 
 namespace webrtc {
@@ -108,6 +109,21 @@ bool InterArrival::ComputeDeltas(uint32_t timestamp,
   return calculated_deltas;
 }
 
+void InterArrival::ComputeDeltas(rtc::ArrayView<const PacketTiming> packets,
+                                 rtc::ArrayView<Deltas> deltas) {
+  RTC_DCHECK_EQ(packets.size(), deltas.size());
+  // Group membership of a packet depends on the packets before it, so the
+  // pass is sequential; batching at this level amortizes the per-packet call
+  // protocol over a whole feedback interval.
+  for (size_t i = 0; i < packets.size(); ++i) {
+    const PacketTiming& packet = packets[i];
+    deltas[i].computed = ComputeDeltas(
+        packet.send_timestamp, packet.arrival_time_ms, packet.system_time_ms,
+        packet.packet_size, &deltas[i].send_time_delta,
+        &deltas[i].arrival_time_delta_ms, &deltas[i].packet_size_delta);
+  }
+}
+
 bool InterArrival::PacketInOrder(uint32_t timestamp) {
   if (current_timestamp_group_.IsFirstPacket()) {
     return true;
@@ -14,6 +14,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "api/array_view.h"
 #include "rtc_base/constructor_magic.h"
 
 namespace webrtc {
@@ -51,6 +52,31 @@ class InterArrival {
                      int64_t* arrival_time_delta_ms,
                      int* packet_size_delta);
 
+  // One packet observation for the batched ComputeDeltas() overload below.
+  struct PacketTiming {
+    uint32_t send_timestamp = 0;
+    int64_t arrival_time_ms = 0;
+    int64_t system_time_ms = 0;
+    size_t packet_size = 0;
+  };
+
+  // Deltas produced when a packet completes a timestamp group. |computed| is
+  // false for packets that did not complete a group.
+  struct Deltas {
+    bool computed = false;
+    uint32_t send_time_delta = 0;
+    int64_t arrival_time_delta_ms = 0;
+    int packet_size_delta = 0;
+  };
+
+  // Batched version of ComputeDeltas() above, intended for callers that
+  // process a whole feedback interval's worth of packets at a time. The
+  // packets in |packets| are ingested in one pass, in order, and the deltas
+  // completed by packet i are written to |deltas|[i]. |deltas| must be the
+  // same size as |packets|.
+  void ComputeDeltas(rtc::ArrayView<const PacketTiming> packets,
+                     rtc::ArrayView<Deltas> deltas);
+
  private:
   struct TimestampGroup {
     TimestampGroup()
@@ -0,0 +1,115 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/remote_bitrate_estimator/packet_arrival_map.h"
+
+#include <algorithm>
+
+namespace webrtc {
+
+constexpr size_t PacketArrivalTimeMap::kMaxNumberOfPackets;
+constexpr int64_t PacketArrivalTimeMap::kNotReceived;
+
+bool PacketArrivalTimeMap::has_received(int64_t sequence_number) const {
+  int64_t pos = sequence_number - begin_sequence_number_;
+  return pos >= 0 && pos < static_cast<int64_t>(arrival_times_.size()) &&
+         arrival_times_[pos] != kNotReceived;
+}
+
+int64_t PacketArrivalTimeMap::clamp(int64_t sequence_number) const {
+  return std::min(end_sequence_number(),
+                  std::max(sequence_number, begin_sequence_number()));
+}
+
+void PacketArrivalTimeMap::AddPacket(int64_t sequence_number,
+                                     int64_t arrival_time_ms) {
+  RTC_DCHECK_GE(arrival_time_ms, 0);
+  if (arrival_times_.empty()) {
+    begin_sequence_number_ = sequence_number;
+    arrival_times_.push_back(arrival_time_ms);
+    return;
+  }
+
+  int64_t pos = sequence_number - begin_sequence_number_;
+  if (pos >= 0 && pos < static_cast<int64_t>(arrival_times_.size())) {
+    // The packet is within the stored window; we are only interested in the
+    // first time a packet is received.
+    if (arrival_times_[pos] == kNotReceived) {
+      arrival_times_[pos] = arrival_time_ms;
+    }
+    return;
+  }
+
+  if (pos < 0) {
+    // The packet is reordered to before the stored window. Expand backwards
+    // to include it, unless that would exceed the maximum size.
+    size_t missing_packets = static_cast<size_t>(-pos);
+    if (missing_packets + arrival_times_.size() > kMaxNumberOfPackets) {
+      return;
+    }
+    arrival_times_.insert(arrival_times_.begin(), missing_packets,
+                          kNotReceived);
+    arrival_times_.front() = arrival_time_ms;
+    begin_sequence_number_ = sequence_number;
+    return;
+  }
+
+  // The packet is newer than the stored window. Fill the gap with
+  // not-received markers, unless the gap alone exceeds the maximum size in
+  // which case the history is of no use and is flushed.
+  int64_t missing_gap_packets =
+      pos - static_cast<int64_t>(arrival_times_.size());
+  if (missing_gap_packets >= static_cast<int64_t>(kMaxNumberOfPackets)) {
+    arrival_times_.clear();
+    begin_sequence_number_ = sequence_number;
+    arrival_times_.push_back(arrival_time_ms);
+    return;
+  }
+  if (missing_gap_packets > 0) {
+    arrival_times_.insert(arrival_times_.end(), missing_gap_packets,
+                          kNotReceived);
+  }
+  arrival_times_.push_back(arrival_time_ms);
+
+  // Limit the range of sequence numbers to keep feedback for.
+  while (arrival_times_.size() > kMaxNumberOfPackets) {
+    arrival_times_.pop_front();
+    ++begin_sequence_number_;
+  }
+}
+
+void PacketArrivalTimeMap::EraseTo(int64_t sequence_number) {
+  if (sequence_number <= begin_sequence_number_) {
+    return;
+  }
+  if (sequence_number >= end_sequence_number()) {
+    arrival_times_.clear();
+    begin_sequence_number_ = sequence_number;
+    return;
+  }
+  arrival_times_.erase(
+      arrival_times_.begin(),
+      arrival_times_.begin() + (sequence_number - begin_sequence_number_));
+  begin_sequence_number_ = sequence_number;
+}
+
+void PacketArrivalTimeMap::RemoveOldPackets(int64_t sequence_number,
+                                            int64_t arrival_time_limit_ms) {
+  // Entries not received compare as |kNotReceived| and are removed with
+  // their neighbors.
+  while (!arrival_times_.empty() &&
+         begin_sequence_number_ < sequence_number &&
+         arrival_times_.front() <= arrival_time_limit_ms) {
+    arrival_times_.pop_front();
+    ++begin_sequence_number_;
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,89 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_REMOTE_BITRATE_ESTIMATOR_PACKET_ARRIVAL_MAP_H_
+#define MODULES_REMOTE_BITRATE_ESTIMATOR_PACKET_ARRIVAL_MAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <deque>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+// PacketArrivalTimeMap stores the arrival time, in milliseconds, of packets
+// keyed by their unwrapped transport-wide sequence number. It replaces a
+// std::map in RemoteEstimatorProxy: packets arrive almost always in order,
+// so the times are kept in a ring of contiguous storage indexed by sequence
+// number, making insertion O(1) without per-packet allocation and feedback
+// building a linear scan. The map never holds more than
+// |kMaxNumberOfPackets| sequence numbers; adding newer packets drops the
+// oldest ones.
+class PacketArrivalTimeMap {
+ public:
+  // Impossible to request feedback older than what can be represented by 15
+  // bits.
+  static constexpr size_t kMaxNumberOfPackets = (1 << 15);
+
+  // Indicates if the packet with |sequence_number| has arrived.
+  bool has_received(int64_t sequence_number) const;
+
+  // Returns the sequence number of the first entry in the map.
+  int64_t begin_sequence_number() const { return begin_sequence_number_; }
+
+  // Returns the sequence number one past the last entry in the map.
+  int64_t end_sequence_number() const {
+    return begin_sequence_number_ +
+           static_cast<int64_t>(arrival_times_.size());
+  }
+
+  // Returns the arrival time in milliseconds of |sequence_number|, which
+  // must be in the range [begin_sequence_number, end_sequence_number).
+  // Sequence numbers in range that have not arrived yield a negative value.
+  int64_t get(int64_t sequence_number) const {
+    int64_t pos = sequence_number - begin_sequence_number_;
+    RTC_DCHECK_GE(pos, 0);
+    RTC_DCHECK_LT(pos, static_cast<int64_t>(arrival_times_.size()));
+    return arrival_times_[pos];
+  }
+
+  // Returns |sequence_number| clamped to [begin_sequence_number,
+  // end_sequence_number].
+  int64_t clamp(int64_t sequence_number) const;
+
+  // Records the fact that a packet with |sequence_number| arrived at
+  // |arrival_time_ms|. Packets older than the window, and repeats of
+  // already-recorded packets, are ignored.
+  void AddPacket(int64_t sequence_number, int64_t arrival_time_ms);
+
+  // Removes all entries with a sequence number below |sequence_number|.
+  void EraseTo(int64_t sequence_number);
+
+  // Removes entries from the beginning of the map as long as they are
+  // before |sequence_number| and arrived at or before
+  // |arrival_time_limit_ms|.
+  void RemoveOldPackets(int64_t sequence_number,
+                        int64_t arrival_time_limit_ms);
+
+ private:
+  // Marks a sequence number in range that has not (yet) arrived.
+  static constexpr int64_t kNotReceived = -1;
+
+  // Arrival times for the contiguous sequence number range starting at
+  // |begin_sequence_number_|; gaps hold |kNotReceived|.
+  std::deque<int64_t> arrival_times_;
+  int64_t begin_sequence_number_ = 0;
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_REMOTE_BITRATE_ESTIMATOR_PACKET_ARRIVAL_MAP_H_
@@ -0,0 +1,203 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "modules/remote_bitrate_estimator/packet_arrival_map.h"
+
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+TEST(PacketArrivalMapTest, IsConsistentWhenEmpty) {
+  PacketArrivalTimeMap map;
+
+  EXPECT_EQ(map.begin_sequence_number(), map.end_sequence_number());
+  EXPECT_FALSE(map.has_received(0));
+  EXPECT_EQ(map.clamp(-5), 0);
+  EXPECT_EQ(map.clamp(5), 0);
+}
+
+TEST(PacketArrivalMapTest, InsertsFirstItemIntoMap) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  EXPECT_EQ(map.begin_sequence_number(), 42);
+  EXPECT_EQ(map.end_sequence_number(), 43);
+
+  EXPECT_FALSE(map.has_received(41));
+  EXPECT_TRUE(map.has_received(42));
+  EXPECT_FALSE(map.has_received(43));
+  EXPECT_EQ(map.get(42), 10);
+
+  EXPECT_EQ(map.clamp(-100), 42);
+  EXPECT_EQ(map.clamp(42), 42);
+  EXPECT_EQ(map.clamp(100), 43);
+}
+
+TEST(PacketArrivalMapTest, InsertsWithGaps) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.AddPacket(45, 11);
+  EXPECT_EQ(map.begin_sequence_number(), 42);
+  EXPECT_EQ(map.end_sequence_number(), 46);
+
+  EXPECT_TRUE(map.has_received(42));
+  EXPECT_FALSE(map.has_received(43));
+  EXPECT_FALSE(map.has_received(44));
+  EXPECT_TRUE(map.has_received(45));
+  EXPECT_EQ(map.get(42), 10);
+  EXPECT_LT(map.get(43), 0);
+  EXPECT_LT(map.get(44), 0);
+  EXPECT_EQ(map.get(45), 11);
+}
+
+TEST(PacketArrivalMapTest, InsertsWithinBuffer) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.AddPacket(45, 11);
+  map.AddPacket(43, 12);
+  map.AddPacket(44, 13);
+
+  EXPECT_EQ(map.begin_sequence_number(), 42);
+  EXPECT_EQ(map.end_sequence_number(), 46);
+
+  EXPECT_EQ(map.get(42), 10);
+  EXPECT_EQ(map.get(43), 12);
+  EXPECT_EQ(map.get(44), 13);
+  EXPECT_EQ(map.get(45), 11);
+}
+
+TEST(PacketArrivalMapTest, IgnoresRepeatedInserts) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.AddPacket(42, 11);
+
+  EXPECT_EQ(map.begin_sequence_number(), 42);
+  EXPECT_EQ(map.end_sequence_number(), 43);
+  EXPECT_EQ(map.get(42), 10);
+}
+
+TEST(PacketArrivalMapTest, GrowsBackwardsForReorderedPackets) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.AddPacket(40, 11);
+
+  EXPECT_EQ(map.begin_sequence_number(), 40);
+  EXPECT_EQ(map.end_sequence_number(), 43);
+  EXPECT_EQ(map.get(40), 11);
+  EXPECT_FALSE(map.has_received(41));
+  EXPECT_EQ(map.get(42), 10);
+}
+
+TEST(PacketArrivalMapTest, IgnoresReorderedPacketsExceedingMaxSize) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.AddPacket(42 - PacketArrivalTimeMap::kMaxNumberOfPackets, 11);
+
+  EXPECT_EQ(map.begin_sequence_number(), 42);
+  EXPECT_EQ(map.end_sequence_number(), 43);
+}
+
+TEST(PacketArrivalMapTest, FlushesHistoryOnHugeForwardJump) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.AddPacket(42 + 2 * PacketArrivalTimeMap::kMaxNumberOfPackets, 11);
+
+  EXPECT_EQ(map.begin_sequence_number(),
+            42 + 2 * static_cast<int64_t>(
+                         PacketArrivalTimeMap::kMaxNumberOfPackets));
+  EXPECT_EQ(map.end_sequence_number(), map.begin_sequence_number() + 1);
+  EXPECT_EQ(map.get(map.begin_sequence_number()), 11);
+}
+
+TEST(PacketArrivalMapTest, LimitsNumberOfStoredPackets) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.AddPacket(42 + PacketArrivalTimeMap::kMaxNumberOfPackets, 11);
+
+  // Adding a packet exactly |kMaxNumberOfPackets| ahead drops the oldest
+  // entry to keep the size bounded.
+  EXPECT_EQ(map.begin_sequence_number(), 43);
+  EXPECT_EQ(map.end_sequence_number(),
+            43 + static_cast<int64_t>(
+                     PacketArrivalTimeMap::kMaxNumberOfPackets));
+  EXPECT_FALSE(map.has_received(42));
+}
+
+TEST(PacketArrivalMapTest, ErasesToNewStartSequenceNumber) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.AddPacket(43, 11);
+  map.AddPacket(44, 12);
+  map.AddPacket(45, 13);
+
+  map.EraseTo(44);
+  EXPECT_EQ(map.begin_sequence_number(), 44);
+  EXPECT_EQ(map.end_sequence_number(), 46);
+  EXPECT_FALSE(map.has_received(43));
+  EXPECT_EQ(map.get(44), 12);
+}
+
+TEST(PacketArrivalMapTest, EraseToIgnoresTooSmallSequenceNumbers) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.EraseTo(30);
+  EXPECT_EQ(map.begin_sequence_number(), 42);
+  EXPECT_EQ(map.end_sequence_number(), 43);
+}
+
+TEST(PacketArrivalMapTest, EraseToClearsWholeMapWhenAheadOfEnd) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.AddPacket(43, 11);
+
+  map.EraseTo(50);
+  EXPECT_EQ(map.begin_sequence_number(), 50);
+  EXPECT_EQ(map.end_sequence_number(), 50);
+}
+
+TEST(PacketArrivalMapTest, RemovesOldPackets) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.AddPacket(43, 11);
+  map.AddPacket(44, 12);
+  map.AddPacket(45, 13);
+
+  map.RemoveOldPackets(/*sequence_number=*/45, /*arrival_time_limit_ms=*/11);
+  EXPECT_EQ(map.begin_sequence_number(), 44);
+  EXPECT_EQ(map.end_sequence_number(), 46);
+}
+
+TEST(PacketArrivalMapTest, RemoveOldPacketsKeepsSequenceNumberAndNewer) {
+  PacketArrivalTimeMap map;
+
+  map.AddPacket(42, 10);
+  map.AddPacket(43, 11);
+  map.AddPacket(44, 12);
+
+  // All arrival times are at or below the limit, but entries at or after
+  // |sequence_number| are never removed.
+  map.RemoveOldPackets(/*sequence_number=*/43, /*arrival_time_limit_ms=*/100);
+  EXPECT_EQ(map.begin_sequence_number(), 43);
+  EXPECT_EQ(map.end_sequence_number(), 45);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -23,9 +23,6 @@
 
 namespace webrtc {
 
-// Impossible to request feedback older than what can be represented by 15 bits.
-const int RemoteEstimatorProxy::kMaxNumberOfPackets = (1 << 15);
-
 // The maximum allowed value for a timestamp in milliseconds. This is lower
 // than the numerical limit since we often convert to microseconds.
 static constexpr int64_t kMaxTimeMs =
@@ -57,11 +54,26 @@ RemoteEstimatorProxy::~RemoteEstimatorProxy() {}
 void RemoteEstimatorProxy::IncomingPacket(int64_t arrival_time_ms,
                                           size_t payload_size,
                                           const RTPHeader& header) {
+  rtc::CritScope cs(&lock_);
+  IncomingPacketInternal(arrival_time_ms, payload_size, header);
+}
+
+void RemoteEstimatorProxy::IncomingPacketBatch(
+    rtc::ArrayView<const PacketArrival> batch) {
+  rtc::CritScope cs(&lock_);
+  for (const PacketArrival& packet : batch) {
+    IncomingPacketInternal(packet.arrival_time_ms, packet.payload_size,
+                           packet.header);
+  }
+}
+
+void RemoteEstimatorProxy::IncomingPacketInternal(int64_t arrival_time_ms,
+                                                  size_t payload_size,
+                                                  const RTPHeader& header) {
   if (arrival_time_ms < 0 || arrival_time_ms > kMaxTimeMs) {
     RTC_LOG(LS_WARNING) << "Arrival time out of bounds: " << arrival_time_ms;
     return;
   }
-  rtc::CritScope cs(&lock_);
   media_ssrc_ = header.ssrc;
   int64_t seq = 0;
 
@@ -70,14 +82,11 @@ void RemoteEstimatorProxy::IncomingPacket(int64_t arrival_time_ms,
 
     if (send_periodic_feedback_) {
       if (periodic_window_start_seq_ &&
-          packet_arrival_times_.lower_bound(*periodic_window_start_seq_) ==
-              packet_arrival_times_.end()) {
+          *periodic_window_start_seq_ >=
+              packet_arrival_times_.end_sequence_number()) {
         // Start new feedback packet, cull old packets.
-        for (auto it = packet_arrival_times_.begin();
-             it != packet_arrival_times_.end() && it->first < seq &&
-             arrival_time_ms - it->second >= send_config_.back_window->ms();) {
-          it = packet_arrival_times_.erase(it);
-        }
+        packet_arrival_times_.RemoveOldPackets(
+            seq, arrival_time_ms - send_config_.back_window->ms());
       }
       if (!periodic_window_start_seq_ || seq < *periodic_window_start_seq_) {
         periodic_window_start_seq_ = seq;
@@ -85,23 +94,19 @@ void RemoteEstimatorProxy::IncomingPacket(int64_t arrival_time_ms,
     }
 
     // We are only interested in the first time a packet is received.
-    if (packet_arrival_times_.find(seq) != packet_arrival_times_.end())
+    if (packet_arrival_times_.has_received(seq))
       return;
 
-    packet_arrival_times_[seq] = arrival_time_ms;
-
-    // Limit the range of sequence numbers to send feedback for.
-    auto first_arrival_time_to_keep = packet_arrival_times_.lower_bound(
-        packet_arrival_times_.rbegin()->first - kMaxNumberOfPackets);
-    if (first_arrival_time_to_keep != packet_arrival_times_.begin()) {
-      packet_arrival_times_.erase(packet_arrival_times_.begin(),
-                                  first_arrival_time_to_keep);
-      if (send_periodic_feedback_) {
-        // |packet_arrival_times_| cannot be empty since we just added one
-        // element and the last element is not deleted.
-        RTC_DCHECK(!packet_arrival_times_.empty());
-        periodic_window_start_seq_ = packet_arrival_times_.begin()->first;
-      }
+    packet_arrival_times_.AddPacket(seq, arrival_time_ms);
+
+    // Limit the range of sequence numbers to send feedback for; AddPacket
+    // may have dropped the oldest packets, or ignored |seq| entirely as too
+    // old.
+    if (send_periodic_feedback_ &&
+        *periodic_window_start_seq_ <
+            packet_arrival_times_.begin_sequence_number()) {
+      periodic_window_start_seq_ =
+          packet_arrival_times_.begin_sequence_number();
     }
 
     if (header.extension.feedback_request) {
@@ -199,15 +204,26 @@ void RemoteEstimatorProxy::SendPeriodicFeedbacks() {
     }
   }
 
-  for (auto begin_iterator =
-           packet_arrival_times_.lower_bound(*periodic_window_start_seq_);
-       begin_iterator != packet_arrival_times_.cend();
-       begin_iterator =
-           packet_arrival_times_.lower_bound(*periodic_window_start_seq_)) {
+  int64_t packet_arrival_times_end_seq =
+      packet_arrival_times_.end_sequence_number();
+  for (;;) {
+    // Advance the window to the first received packet at or after it; when
+    // none remains, all feedback has been built.
+    int64_t begin_sequence_number =
+        packet_arrival_times_.clamp(*periodic_window_start_seq_);
+    while (begin_sequence_number < packet_arrival_times_end_seq &&
+           !packet_arrival_times_.has_received(begin_sequence_number)) {
+      ++begin_sequence_number;
+    }
+    if (begin_sequence_number >= packet_arrival_times_end_seq) {
+      break;
+    }
+
     auto feedback_packet = std::make_unique<rtcp::TransportFeedback>();
     periodic_window_start_seq_ = BuildFeedbackPacket(
         feedback_packet_count_++, media_ssrc_, *periodic_window_start_seq_,
-        begin_iterator, packet_arrival_times_.cend(), feedback_packet.get());
+        begin_sequence_number, packet_arrival_times_end_seq,
+        feedback_packet.get());
 
     RTC_DCHECK(feedback_sender_ != nullptr);
 
@@ -236,16 +252,26 @@ void RemoteEstimatorProxy::SendFeedbackOnRequest(
 
   int64_t first_sequence_number =
       sequence_number - feedback_request.sequence_count + 1;
-  auto begin_iterator =
-      packet_arrival_times_.lower_bound(first_sequence_number);
-  auto end_iterator = packet_arrival_times_.upper_bound(sequence_number);
+  int64_t begin_sequence_number =
+      packet_arrival_times_.clamp(first_sequence_number);
+  int64_t end_sequence_number =
+      packet_arrival_times_.clamp(sequence_number + 1);
+  while (begin_sequence_number < end_sequence_number &&
+         !packet_arrival_times_.has_received(begin_sequence_number)) {
+    ++begin_sequence_number;
+  }
+  if (begin_sequence_number >= end_sequence_number) {
+    // Nothing in the requested range was received; the requesting packet
+    // itself is normally in the map, unless it was too old to be recorded.
+    return;
+  }
 
   BuildFeedbackPacket(feedback_packet_count_++, media_ssrc_,
-                      first_sequence_number, begin_iterator, end_iterator,
-                      feedback_packet.get());
+                      first_sequence_number, begin_sequence_number,
+                      end_sequence_number, feedback_packet.get());
 
   // Clear up to the first packet that is included in this feedback packet.
-  packet_arrival_times_.erase(packet_arrival_times_.begin(), begin_iterator);
+  packet_arrival_times_.EraseTo(first_sequence_number);
 
   RTC_DCHECK(feedback_sender_ != nullptr);
   std::vector<std::unique_ptr<rtcp::RtcpPacket>> packets;
@@ -257,10 +283,11 @@ int64_t RemoteEstimatorProxy::BuildFeedbackPacket(
     uint8_t feedback_packet_count,
     uint32_t media_ssrc,
     int64_t base_sequence_number,
-    std::map<int64_t, int64_t>::const_iterator begin_iterator,
-    std::map<int64_t, int64_t>::const_iterator end_iterator,
+    int64_t begin_sequence_number,
+    int64_t end_sequence_number,
     rtcp::TransportFeedback* feedback_packet) {
-  RTC_DCHECK(begin_iterator != end_iterator);
+  RTC_DCHECK_LT(begin_sequence_number, end_sequence_number);
+  RTC_DCHECK(packet_arrival_times_.has_received(begin_sequence_number));
 
   // TODO(sprang): Measure receive times in microseconds and remove the
   // conversions below.
@@ -268,22 +295,28 @@ int64_t RemoteEstimatorProxy::BuildFeedbackPacket(
   // Base sequence number is the expected first sequence number. This is known,
   // but we might not have actually received it, so the base time shall be the
   // time of the first received packet in the feedback.
-  feedback_packet->SetBase(static_cast<uint16_t>(base_sequence_number & 0xFFFF),
-                           begin_iterator->second * 1000);
+  feedback_packet->SetBase(
+      static_cast<uint16_t>(base_sequence_number & 0xFFFF),
+      packet_arrival_times_.get(begin_sequence_number) * 1000);
   feedback_packet->SetFeedbackSequenceNumber(feedback_packet_count);
   int64_t next_sequence_number = base_sequence_number;
-  for (auto it = begin_iterator; it != end_iterator; ++it) {
+  for (int64_t seq = begin_sequence_number; seq < end_sequence_number; ++seq) {
+    int64_t arrival_time_ms = packet_arrival_times_.get(seq);
+    if (arrival_time_ms < 0) {
+      // Packet not received.
+      continue;
+    }
     if (!feedback_packet->AddReceivedPacket(
-            static_cast<uint16_t>(it->first & 0xFFFF), it->second * 1000)) {
+            static_cast<uint16_t>(seq & 0xFFFF), arrival_time_ms * 1000)) {
       // If we can't even add the first seq to the feedback packet, we won't be
       // able to build it at all.
-      RTC_CHECK(begin_iterator != it);
+      RTC_CHECK_NE(seq, begin_sequence_number);
 
       // Could not add timestamp, feedback packet might be full. Return and
       // try again with a fresh packet.
       break;
     }
-    next_sequence_number = it->first + 1;
+    next_sequence_number = seq + 1;
   }
   return next_sequence_number;
 }
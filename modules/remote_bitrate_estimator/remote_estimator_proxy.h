@@ -11,12 +11,12 @@
 #ifndef MODULES_REMOTE_BITRATE_ESTIMATOR_REMOTE_ESTIMATOR_PROXY_H_
 #define MODULES_REMOTE_BITRATE_ESTIMATOR_REMOTE_ESTIMATOR_PROXY_H_
 
-#include <map>
 #include <vector>
 
 #include "api/transport/network_control.h"
 #include "api/transport/webrtc_key_value_config.h"
 #include "modules/remote_bitrate_estimator/include/remote_bitrate_estimator.h"
+#include "modules/remote_bitrate_estimator/packet_arrival_map.h"
 #include "rtc_base/critical_section.h"
 #include "rtc_base/experiments/field_trial_parser.h"
 #include "rtc_base/numerics/sequence_number_util.h"
@@ -44,6 +44,8 @@ class RemoteEstimatorProxy : public RemoteBitrateEstimator {
   void IncomingPacket(int64_t arrival_time_ms,
                       size_t payload_size,
                       const RTPHeader& header) override;
+  // Takes |lock_| once for the whole batch.
+  void IncomingPacketBatch(rtc::ArrayView<const PacketArrival> batch) override;
   void RemoveStream(uint32_t ssrc) override {}
   bool LatestEstimate(std::vector<unsigned int>* ssrcs,
                       unsigned int* bitrate_bps) const override;
@@ -71,21 +73,25 @@ class RemoteEstimatorProxy : public RemoteBitrateEstimator {
     }
   };
 
-  static const int kMaxNumberOfPackets;
-
+  void IncomingPacketInternal(int64_t arrival_time_ms,
+                              size_t payload_size,
+                              const RTPHeader& header)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(&lock_);
   void SendPeriodicFeedbacks() RTC_EXCLUSIVE_LOCKS_REQUIRED(&lock_);
   void SendFeedbackOnRequest(int64_t sequence_number,
                              const FeedbackRequest& feedback_request)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(&lock_);
-  static int64_t BuildFeedbackPacket(
-      uint8_t feedback_packet_count,
-      uint32_t media_ssrc,
-      int64_t base_sequence_number,
-      std::map<int64_t, int64_t>::const_iterator
-          begin_iterator,  // |begin_iterator| is inclusive.
-      std::map<int64_t, int64_t>::const_iterator
-          end_iterator,  // |end_iterator| is exclusive.
-      rtcp::TransportFeedback* feedback_packet);
+  // Builds a feedback packet for the received packets in
+  // [|begin_sequence_number|, |end_sequence_number|), where the begin is
+  // inclusive and known to be received and the end is exclusive. Returns
+  // the sequence number the next feedback packet should start from.
+  int64_t BuildFeedbackPacket(uint8_t feedback_packet_count,
+                              uint32_t media_ssrc,
+                              int64_t base_sequence_number,
+                              int64_t begin_sequence_number,
+                              int64_t end_sequence_number,
+                              rtcp::TransportFeedback* feedback_packet)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(&lock_);
 
   Clock* const clock_;
   TransportFeedbackSenderInterface* const feedback_sender_;
@@ -100,8 +106,8 @@ class RemoteEstimatorProxy : public RemoteBitrateEstimator {
   uint8_t feedback_packet_count_ RTC_GUARDED_BY(&lock_);
   SeqNumUnwrapper<uint16_t> unwrapper_ RTC_GUARDED_BY(&lock_);
   absl::optional<int64_t> periodic_window_start_seq_ RTC_GUARDED_BY(&lock_);
-  // Map unwrapped seq -> time.
-  std::map<int64_t, int64_t> packet_arrival_times_ RTC_GUARDED_BY(&lock_);
+  // Unwrapped seq -> arrival time, in contiguous storage.
+  PacketArrivalTimeMap packet_arrival_times_ RTC_GUARDED_BY(&lock_);
   int64_t send_interval_ms_ RTC_GUARDED_BY(&lock_);
   bool send_periodic_feedback_ RTC_GUARDED_BY(&lock_);
 
@@ -42,6 +42,7 @@ class RateLimiter;
 class ReceiveStatisticsProvider;
 class RemoteBitrateEstimator;
 class RtcEventLog;
+class RtpPacketPool;
 class RTPSender;
 class Transport;
 class VideoBitrateAllocationObserver;
@@ -147,6 +148,13 @@ class RtpRtcp : public Module, public RtcpFeedbackSenderInterface {
 
     bool need_rtp_packet_infos = false;
 
+    // If set, send packet objects and their backing buffers are recycled
+    // through this pool instead of being heap-allocated per packet: new
+    // packets are acquired from the pool by RTPSender::AllocatePacket() and
+    // handed back when the packet history culls them. The pool must outlive
+    // the module and may be shared between modules.
+    RtpPacketPool* packet_pool = nullptr;
+
     // If true, the RTP packet history will select RTX packets based on
     // heuristics such as send time, retransmission count etc, in order to
     // make padding potentially more useful.
@@ -443,6 +451,15 @@ class RtpRtcp : public Module, public RtcpFeedbackSenderInterface {
   // Returns true if the module is configured to store packets.
   virtual bool StorePackets() const = 0;
 
+  // Approximate number of heap bytes currently held by the send-side packet
+  // history.
+  virtual size_t PacketHistoryMemoryUsage() const = 0;
+
+  // Releases up to |bytes| bytes from the send-side packet history under
+  // memory pressure, oldest packets first, keeping packets that are pending
+  // transmission. Returns the number of bytes released.
+  virtual size_t TrimPacketHistory(size_t bytes) = 0;
+
   virtual void SetVideoBitrateAllocation(
       const VideoBitrateAllocation& bitrate) = 0;
 
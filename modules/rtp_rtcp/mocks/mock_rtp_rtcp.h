@@ -197,6 +197,8 @@ class MockRtpRtcp : public RtpRtcp {
               (bool enable, uint16_t number_to_store),
               (override));
   MOCK_METHOD(bool, StorePackets, (), (const override));
+  MOCK_METHOD(size_t, PacketHistoryMemoryUsage, (), (const override));
+  MOCK_METHOD(size_t, TrimPacketHistory, (size_t bytes), (override));
   MOCK_METHOD(void,
               SendCombinedRtcpPacket,
               (std::vector<std::unique_ptr<rtcp::RtcpPacket>> rtcp_packets),
@@ -15,6 +15,14 @@
 #include <algorithm>
 #include <utility>
 
+#include "rtc_base/system/arch.h"
+
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+#include <emmintrin.h>
+#elif defined(WEBRTC_HAS_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "absl/algorithm/container.h"
 #include "modules/include/module_common_types_public.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
@@ -31,6 +39,37 @@ namespace webrtc {
 namespace {
 // Transport header size in bytes. Assume UDP/IPv4 as a reasonable minimum.
 constexpr size_t kTransportOverhead = 28;
+
+// XORs |length| bytes from |src| into |dst|. This is the inner loop of both
+// FEC encoding and recovery, so it is vectorized: 16 bytes per iteration with
+// SSE2/NEON and a word-wide fallback elsewhere. All loads/stores are
+// unaligned-safe.
+void XorBytes(const uint8_t* src, size_t length, uint8_t* dst) {
+  size_t i = 0;
+#if defined(WEBRTC_ARCH_X86_FAMILY)
+  for (; i + 16 <= length; i += 16) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<__m128i*>(dst + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(a, b));
+  }
+#elif defined(WEBRTC_HAS_NEON)
+  for (; i + 16 <= length; i += 16) {
+    vst1q_u8(dst + i, veorq_u8(vld1q_u8(src + i), vld1q_u8(dst + i)));
+  }
+#else
+  for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+    uint64_t a;
+    uint64_t b;
+    memcpy(&a, src + i, sizeof(a));
+    memcpy(&b, dst + i, sizeof(b));
+    b ^= a;
+    memcpy(dst + i, &b, sizeof(b));
+  }
+#endif
+  for (; i < length; ++i) {
+    dst[i] ^= src[i];
+  }
+}
 }  // namespace
 
 ForwardErrorCorrection::Packet::Packet() : data(0), ref_count_(0) {}
@@ -635,11 +674,8 @@ void ForwardErrorCorrection::XorPayloads(const Packet& src,
   if (dst_offset + payload_length > dst->data.size()) {
     dst->data.SetSize(dst_offset + payload_length);
   }
-  uint8_t* dst_data = dst->data.data();
-  const uint8_t* src_data = src.data.cdata();
-  for (size_t i = 0; i < payload_length; ++i) {
-    dst_data[dst_offset + i] ^= src_data[kRtpHeaderSize + i];
-  }
+  XorBytes(src.data.cdata() + kRtpHeaderSize, payload_length,
+           dst->data.data() + dst_offset);
 }
 
 bool ForwardErrorCorrection::RecoverPacket(const ReceivedFecPacket& fec_packet,
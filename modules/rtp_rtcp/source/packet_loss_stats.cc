@@ -10,131 +10,93 @@
 
 #include "modules/rtp_rtcp/source/packet_loss_stats.h"
 
-#include <cstdint>
-#include <iterator>
-#include <vector>
-
 #include "rtc_base/checks.h"
 
-// After this many packets are added, adding additional packets will cause the
-// oldest packets to be pruned from the buffer.
-static const int kBufferSize = 100;
-
 namespace webrtc {
 
+constexpr size_t PacketLossStats::kBufferSize;
+
 PacketLossStats::PacketLossStats()
-    : single_loss_historic_count_(0),
-      multiple_loss_historic_event_count_(0),
-      multiple_loss_historic_packet_count_(0) {}
+    : oldest_loss_index_(0),
+      recent_loss_count_(0),
+      single_loss_count_(0),
+      multiple_loss_event_count_(0),
+      multiple_loss_packet_count_(0) {}
 
 PacketLossStats::~PacketLossStats() = default;
 
 void PacketLossStats::AddLostPacket(uint16_t sequence_number) {
-  // Detect sequence number wrap around.
-  if (!lost_packets_buffer_.empty() &&
-      static_cast<int>(*(lost_packets_buffer_.rbegin())) - sequence_number >
-          0x8000) {
-    // The buffer contains large numbers and this is a small number.
-    lost_packets_wrapped_buffer_.insert(sequence_number);
-  } else {
-    lost_packets_buffer_.insert(sequence_number);
+  if (lost_packets_[sequence_number]) {
+    // Duplicate report.
+    return;
+  }
+  if (recent_loss_count_ == kBufferSize) {
+    ExpireOldestLoss();
+  }
+  recent_losses_[(oldest_loss_index_ + recent_loss_count_) % kBufferSize] =
+      sequence_number;
+  ++recent_loss_count_;
+
+  // Classify by looking at the neighboring sequence numbers; all arithmetic
+  // wraps with the sequence numbers.
+  const bool left = lost_packets_[static_cast<uint16_t>(sequence_number - 1)];
+  const bool right = lost_packets_[static_cast<uint16_t>(sequence_number + 1)];
+  lost_packets_[sequence_number] = true;
+  if (!left && !right) {
+    // Isolated so far; reclassified if a neighbor is reported lost later.
+    ++single_loss_count_;
+    return;
   }
-  if (lost_packets_wrapped_buffer_.size() + lost_packets_buffer_.size() >
-          kBufferSize ||
-      (!lost_packets_wrapped_buffer_.empty() &&
-       *(lost_packets_wrapped_buffer_.rbegin()) > 0x4000)) {
-    PruneBuffer();
+  // The packet joins (or merges) existing loss runs. Neighboring single
+  // losses become part of a multiple-packet event.
+  const int converted_singles =
+      (left && !lost_packets_[static_cast<uint16_t>(sequence_number - 2)]
+           ? 1
+           : 0) +
+      (right && !lost_packets_[static_cast<uint16_t>(sequence_number + 2)]
+           ? 1
+           : 0);
+  single_loss_count_ -= converted_singles;
+  multiple_loss_packet_count_ += 1 + converted_singles;
+  if (left && right) {
+    // Two runs merge into one event (plus one event for each pair of singles
+    // that formed it).
+    multiple_loss_event_count_ += converted_singles - 1;
+  } else {
+    multiple_loss_event_count_ += converted_singles;
   }
 }
 
 int PacketLossStats::GetSingleLossCount() const {
-  int single_loss_count, unused1, unused2;
-  ComputeLossCounts(&single_loss_count, &unused1, &unused2);
-  return single_loss_count;
+  return single_loss_count_;
 }
 
 int PacketLossStats::GetMultipleLossEventCount() const {
-  int event_count, unused1, unused2;
-  ComputeLossCounts(&unused1, &event_count, &unused2);
-  return event_count;
+  return multiple_loss_event_count_;
 }
 
 int PacketLossStats::GetMultipleLossPacketCount() const {
-  int packet_count, unused1, unused2;
-  ComputeLossCounts(&unused1, &unused2, &packet_count);
-  return packet_count;
+  return multiple_loss_packet_count_;
 }
 
-void PacketLossStats::ComputeLossCounts(
-    int* out_single_loss_count,
-    int* out_multiple_loss_event_count,
-    int* out_multiple_loss_packet_count) const {
-  *out_single_loss_count = single_loss_historic_count_;
-  *out_multiple_loss_event_count = multiple_loss_historic_event_count_;
-  *out_multiple_loss_packet_count = multiple_loss_historic_packet_count_;
-  if (lost_packets_buffer_.empty()) {
-    RTC_DCHECK(lost_packets_wrapped_buffer_.empty());
+void PacketLossStats::ExpireOldestLoss() {
+  RTC_DCHECK_GT(recent_loss_count_, 0u);
+  const uint16_t expired = recent_losses_[oldest_loss_index_];
+  oldest_loss_index_ = (oldest_loss_index_ + 1) % kBufferSize;
+  --recent_loss_count_;
+  if (!lost_packets_[expired]) {
+    // Already cleared together with an earlier expired loss in the same run.
     return;
   }
-  uint16_t last_num = 0;
-  int sequential_count = 0;
-  std::vector<const std::set<uint16_t>*> buffers;
-  buffers.push_back(&lost_packets_buffer_);
-  buffers.push_back(&lost_packets_wrapped_buffer_);
-  for (const auto* buffer : buffers) {
-    for (auto it = buffer->begin(); it != buffer->end(); ++it) {
-      uint16_t current_num = *it;
-      if (sequential_count > 0 && current_num != ((last_num + 1) & 0xFFFF)) {
-        if (sequential_count == 1) {
-          (*out_single_loss_count)++;
-        } else {
-          (*out_multiple_loss_event_count)++;
-          *out_multiple_loss_packet_count += sequential_count;
-        }
-        sequential_count = 0;
-      }
-      sequential_count++;
-      last_num = current_num;
-    }
-  }
-  if (sequential_count == 1) {
-    (*out_single_loss_count)++;
-  } else if (sequential_count > 1) {
-    (*out_multiple_loss_event_count)++;
-    *out_multiple_loss_packet_count += sequential_count;
-  }
-}
-
-void PacketLossStats::PruneBuffer() {
-  // Remove the oldest lost packet and any contiguous packets and move them
-  // into the historic counts.
-  auto it = lost_packets_buffer_.begin();
-  uint16_t last_removed = 0;
-  int remove_count = 0;
-  // Count adjacent packets and continue counting if it is wrap around by
-  // swapping in the wrapped buffer and letting our value wrap as well.
-  while (remove_count == 0 || (!lost_packets_buffer_.empty() &&
-                               *it == ((last_removed + 1) & 0xFFFF))) {
-    last_removed = *it;
-    remove_count++;
-    auto to_erase = it++;
-    lost_packets_buffer_.erase(to_erase);
-    if (lost_packets_buffer_.empty()) {
-      lost_packets_buffer_.swap(lost_packets_wrapped_buffer_);
-      it = lost_packets_buffer_.begin();
-    }
-  }
-  if (remove_count > 1) {
-    multiple_loss_historic_event_count_++;
-    multiple_loss_historic_packet_count_ += remove_count;
-  } else {
-    single_loss_historic_count_++;
+  // Clear the whole run, like the old set-based pruning removed contiguous
+  // blocks; its classification stays in the counts. At most
+  // |kBufferSize| + 1 bits are ever set, so these loops are bounded.
+  uint16_t run_start = expired;
+  while (lost_packets_[static_cast<uint16_t>(run_start - 1)]) {
+    --run_start;
   }
-  // Continue pruning if the wrapped buffer is beyond a threshold and there are
-  // things left in the pre-wrapped buffer.
-  if (!lost_packets_wrapped_buffer_.empty() &&
-      *(lost_packets_wrapped_buffer_.rbegin()) > 0x4000) {
-    PruneBuffer();
+  for (uint16_t i = run_start; lost_packets_[i]; ++i) {
+    lost_packets_[i] = false;
   }
 }
 
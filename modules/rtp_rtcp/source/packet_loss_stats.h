@@ -11,14 +11,18 @@
 #ifndef MODULES_RTP_RTCP_SOURCE_PACKET_LOSS_STATS_H_
 #define MODULES_RTP_RTCP_SOURCE_PACKET_LOSS_STATS_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
-#include <set>
+#include <bitset>
 
 namespace webrtc {
 
 // Keeps track of statistics of packet loss including whether losses are a
-// single packet or multiple packets in a row.
+// single packet or multiple packets in a row. Lost sequence numbers are kept
+// in a bitset with one bit per sequence number, so each reported loss costs a
+// constant number of operations and no allocation, and the memory use is
+// fixed regardless of how bursty the loss is.
 class PacketLossStats {
  public:
   PacketLossStats();
@@ -41,16 +45,27 @@ class PacketLossStats {
   int GetMultipleLossPacketCount() const;
 
  private:
-  std::set<uint16_t> lost_packets_buffer_;
-  std::set<uint16_t> lost_packets_wrapped_buffer_;
-  int single_loss_historic_count_;
-  int multiple_loss_historic_event_count_;
-  int multiple_loss_historic_packet_count_;
-
-  void ComputeLossCounts(int* out_single_loss_count,
-                         int* out_multiple_loss_event_count,
-                         int* out_multiple_loss_packet_count) const;
-  void PruneBuffer();
+  // After this many losses are added, adding another loss expires the oldest
+  // one from the bitset. Its contribution to the counts is kept.
+  static constexpr size_t kBufferSize = 100;
+
+  // Clears the loss run containing the oldest reported loss from
+  // |lost_packets_|, so that later losses next to it start a new event.
+  void ExpireOldestLoss();
+
+  // One bit per RTP sequence number.
+  std::bitset<0x10000> lost_packets_;
+  // Ring of the most recently reported lost sequence numbers, in insertion
+  // order, so the oldest losses can be expired.
+  uint16_t recent_losses_[kBufferSize];
+  size_t oldest_loss_index_;
+  size_t recent_loss_count_;
+  // Counts are classified incrementally as losses arrive, by inspecting the
+  // neighboring bits; a single loss is reclassified when a neighbor turns it
+  // into a multiple-packet event.
+  int single_loss_count_;
+  int multiple_loss_event_count_;
+  int multiple_loss_packet_count_;
 };
 
 }  // namespace webrtc
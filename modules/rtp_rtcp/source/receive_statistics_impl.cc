@@ -42,6 +42,7 @@ StreamStatisticianImpl::StreamStatisticianImpl(uint32_t ssrc,
       cumulative_loss_(0),
       cumulative_loss_rtcp_offset_(0),
       last_receive_time_ms_(0),
+      last_arrival_time_ms_(-1),
       last_received_timestamp_(0),
       received_seq_first_(-1),
       received_seq_max_(-1),
@@ -134,12 +135,23 @@ void StreamStatisticianImpl::UpdateCounters(const RtpPacketReceived& packet) {
   }
   last_received_timestamp_ = packet.Timestamp();
   last_receive_time_ms_ = now_ms;
+  last_arrival_time_ms_ = packet.arrival_time_ms() > 0
+                              ? packet.arrival_time_ms()
+                              : -1;
 }
 
 void StreamStatisticianImpl::UpdateJitter(const RtpPacketReceived& packet,
                                           int64_t receive_time_ms) {
   int64_t receive_diff_ms = receive_time_ms - last_receive_time_ms_;
   RTC_DCHECK_GE(receive_diff_ms, 0);
+  // Prefer the arrival time stamped once at the socket layer, when both this
+  // packet and the previous one carry it; it is the same stamp every consumer
+  // of the packet sees, and it does not include the queuing time between the
+  // network thread and this point.
+  if (packet.arrival_time_ms() > 0 && last_arrival_time_ms_ > 0 &&
+      packet.arrival_time_ms() >= last_arrival_time_ms_) {
+    receive_diff_ms = packet.arrival_time_ms() - last_arrival_time_ms_;
+  }
   uint32_t receive_diff_rtp = static_cast<uint32_t>(
       (receive_diff_ms * packet.payload_type_frequency()) / 1000);
   int32_t time_diff_samples =
@@ -314,7 +326,17 @@ void ReceiveStatisticsImpl::OnRtpPacket(const RtpPacketReceived& packet) {
   // StreamStatisticianImpl instance is created once and only destroyed when
   // this whole ReceiveStatisticsImpl is destroyed. StreamStatisticianImpl has
   // it's own locking so don't hold receive_statistics_lock_ (potential
-  // deadlock).
+  // deadlock). In steady state the statistician is found through the
+  // published snapshot without touching the lock shared by all SSRCs.
+  std::shared_ptr<const std::map<uint32_t, StreamStatisticianImpl*>> snapshot =
+      std::atomic_load(&statisticians_snapshot_);
+  if (snapshot != nullptr) {
+    const auto it = snapshot->find(packet.Ssrc());
+    if (it != snapshot->end()) {
+      it->second->UpdateCounters(packet);
+      return;
+    }
+  }
   GetOrCreateStatistician(packet.Ssrc())->UpdateCounters(packet);
 }
 
@@ -333,10 +355,19 @@ StreamStatisticianImpl* ReceiveStatisticsImpl::GetOrCreateStatistician(
   StreamStatisticianImpl*& impl = statisticians_[ssrc];
   if (impl == nullptr) {  // new element
     impl = new StreamStatisticianImpl(ssrc, clock_, max_reordering_threshold_);
+    PublishStatisticiansSnapshot();
   }
   return impl;
 }
 
+void ReceiveStatisticsImpl::PublishStatisticiansSnapshot() {
+  std::atomic_store(
+      &statisticians_snapshot_,
+      std::shared_ptr<const std::map<uint32_t, StreamStatisticianImpl*>>(
+          std::make_shared<std::map<uint32_t, StreamStatisticianImpl*>>(
+              statisticians_)));
+}
+
 void ReceiveStatisticsImpl::SetMaxReorderingThreshold(
     int max_reordering_threshold) {
   std::map<uint32_t, StreamStatisticianImpl*> statisticians;
@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <vector>
 
 #include "absl/types/optional.h"
@@ -82,6 +83,11 @@ class StreamStatisticianImpl : public StreamStatistician {
   int32_t cumulative_loss_rtcp_offset_ RTC_GUARDED_BY(&stream_lock_);
 
   int64_t last_receive_time_ms_ RTC_GUARDED_BY(&stream_lock_);
+  // Arrival time carried by the previous packet (stamped once at the socket
+  // layer), or -1 if it was not stamped. Used for jitter calculation, where
+  // it is preferred over |last_receive_time_ms_| since it is not skewed by
+  // queuing between the network thread and this class.
+  int64_t last_arrival_time_ms_ RTC_GUARDED_BY(&stream_lock_);
   uint32_t last_received_timestamp_ RTC_GUARDED_BY(&stream_lock_);
   SequenceNumberUnwrapper seq_unwrapper_ RTC_GUARDED_BY(&stream_lock_);
   int64_t received_seq_first_ RTC_GUARDED_BY(&stream_lock_);
@@ -122,12 +128,25 @@ class ReceiveStatisticsImpl : public ReceiveStatistics {
  private:
   StreamStatisticianImpl* GetOrCreateStatistician(uint32_t ssrc);
 
+  // Publishes a fresh read-only copy of |statisticians_| for the lock-free
+  // lookups on the packet path.
+  void PublishStatisticiansSnapshot()
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(receive_statistics_lock_);
+
   Clock* const clock_;
   rtc::CriticalSection receive_statistics_lock_;
   uint32_t last_returned_ssrc_;
   int max_reordering_threshold_ RTC_GUARDED_BY(receive_statistics_lock_);
   std::map<uint32_t, StreamStatisticianImpl*> statisticians_
       RTC_GUARDED_BY(receive_statistics_lock_);
+
+  // Copy-on-write snapshot of |statisticians_|, updated under
+  // |receive_statistics_lock_| whenever a statistician is added and read with
+  // std::atomic_load by OnRtpPacket, which must not contend on the lock
+  // shared by all SSRCs. Statisticians are never deleted until destruction,
+  // so the pointers in a snapshot stay valid.
+  std::shared_ptr<const std::map<uint32_t, StreamStatisticianImpl*>>
+      statisticians_snapshot_;
 };
 }  // namespace webrtc
 #endif  // MODULES_RTP_RTCP_SOURCE_RECEIVE_STATISTICS_IMPL_H_
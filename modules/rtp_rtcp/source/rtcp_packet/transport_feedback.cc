@@ -454,6 +454,9 @@ bool TransportFeedback::Parse(const CommonHeader& packet) {
 
   // Determine if timestamps, that is, recv_delta are included in the packet.
   if (end_index >= index + recv_delta_size) {
+    // Set explicitly, since a reused object may have parsed a packet without
+    // timestamps before.
+    include_timestamps_ = true;
     for (size_t delta_size : delta_sizes) {
       if (index + delta_size > end_index) {
         RTC_LOG(LS_WARNING) << "Buffer overflow while parsing packet.";
@@ -83,6 +83,26 @@ std::set<uint32_t> GetRegisteredSsrcs(const RtpRtcp::Configuration& config) {
 }  // namespace
 
 struct RTCPReceiver::PacketInformation {
+  // Resets to a freshly constructed state, but keeps allocated storage so
+  // that parsing the next compound packet can reuse it.
+  void Reset() {
+    packet_type_flags = 0;
+    remote_ssrc = 0;
+    nack_sequence_numbers.clear();
+    report_blocks.clear();
+    report_block_datas.clear();
+    rtt_ms = 0;
+    receiver_estimated_max_bitrate_bps = 0;
+    if (transport_feedback != nullptr) {
+      // Keep the parsed object so that TransportFeedback::Parse() can reuse
+      // its internal packet vectors.
+      recycled_transport_feedback = std::move(transport_feedback);
+    }
+    target_bitrate_allocation.reset();
+    network_state_estimate.reset();
+    loss_notification.reset();
+  }
+
   uint32_t packet_type_flags = 0;  // RTCPPacketTypeFlags bit field.
 
   uint32_t remote_ssrc = 0;
@@ -93,6 +113,8 @@ struct RTCPReceiver::PacketInformation {
   int64_t rtt_ms = 0;
   uint32_t receiver_estimated_max_bitrate_bps = 0;
   std::unique_ptr<rtcp::TransportFeedback> transport_feedback;
+  // Feedback object retained by Reset() for reuse by the next packet.
+  std::unique_ptr<rtcp::TransportFeedback> recycled_transport_feedback;
   absl::optional<VideoBitrateAllocation> target_bitrate_allocation;
   absl::optional<NetworkStateEstimate> network_state_estimate;
   std::unique_ptr<rtcp::LossNotification> loss_notification;
@@ -178,7 +200,12 @@ void RTCPReceiver::IncomingPacket(rtc::ArrayView<const uint8_t> packet) {
     return;
   }
 
-  PacketInformation packet_information;
+  RTC_CHECK_RUNS_SERIALIZED(&packet_info_race_checker_);
+  if (packet_info_scratch_ == nullptr) {
+    packet_info_scratch_.reset(new PacketInformation());
+  }
+  PacketInformation& packet_information = *packet_info_scratch_;
+  packet_information.Reset();
   if (!ParseCompoundPacket(packet, &packet_information))
     return;
   TriggerCallbacksFromRtcpPacket(packet_information);
@@ -965,10 +992,18 @@ void RTCPReceiver::HandleFir(const CommonHeader& rtcp_block,
 void RTCPReceiver::HandleTransportFeedback(
     const CommonHeader& rtcp_block,
     PacketInformation* packet_information) {
-  std::unique_ptr<rtcp::TransportFeedback> transport_feedback(
-      new rtcp::TransportFeedback());
+  // Reuse the feedback object from a previous packet if there is one;
+  // Parse() clears it and the internal packet vectors then keep their
+  // capacity from the last use.
+  std::unique_ptr<rtcp::TransportFeedback> transport_feedback =
+      std::move(packet_information->recycled_transport_feedback);
+  if (transport_feedback == nullptr) {
+    transport_feedback.reset(new rtcp::TransportFeedback());
+  }
   if (!transport_feedback->Parse(rtcp_block)) {
     ++num_skipped_packets_;
+    packet_information->recycled_transport_feedback =
+        std::move(transport_feedback);
     return;
   }
 
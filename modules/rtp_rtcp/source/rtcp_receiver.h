@@ -13,6 +13,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -25,6 +26,7 @@
 #include "modules/rtp_rtcp/source/rtcp_nack_stats.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/dlrr.h"
 #include "rtc_base/critical_section.h"
+#include "rtc_base/race_checker.h"
 #include "rtc_base/thread_annotations.h"
 #include "system_wrappers/include/ntp_time.h"
 
@@ -275,6 +277,14 @@ class RTCPReceiver final {
 
   size_t num_skipped_packets_;
   int64_t last_skipped_packets_warning_ms_;
+
+  // Scratch for parsing incoming compound packets, kept between calls so
+  // that the containers inside retain their capacity and parsing does not
+  // allocate in steady state. IncomingPacket() is always called serially;
+  // enforced by |packet_info_race_checker_|.
+  rtc::RaceChecker packet_info_race_checker_;
+  std::unique_ptr<PacketInformation> packet_info_scratch_
+      RTC_GUARDED_BY(packet_info_race_checker_);
 };
 }  // namespace webrtc
 #endif  // MODULES_RTP_RTCP_SOURCE_RTCP_RECEIVER_H_
@@ -20,7 +20,6 @@
 #include "logging/rtc_event_log/events/rtc_event_rtcp_packet_outgoing.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/app.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/bye.h"
-#include "modules/rtp_rtcp/source/rtcp_packet/compound_packet.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/extended_reports.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/fir.h"
 #include "modules/rtp_rtcp/source/rtcp_packet/loss_notification.h"
@@ -51,69 +50,6 @@ const uint32_t kRtcpAnyExtendedReports = kRtcpXrReceiverReferenceTime |
 constexpr int32_t kDefaultVideoReportInterval = 1000;
 constexpr int32_t kDefaultAudioReportInterval = 5000;
 
-class PacketContainer : public rtcp::CompoundPacket {
- public:
-  PacketContainer(Transport* transport, RtcEventLog* event_log)
-      : transport_(transport), event_log_(event_log) {}
-  ~PacketContainer() override {
-    for (RtcpPacket* packet : appended_packets_)
-      delete packet;
-  }
-
-  size_t SendPackets(size_t max_payload_length) {
-    size_t bytes_sent = 0;
-    Build(max_payload_length, [&](rtc::ArrayView<const uint8_t> packet) {
-      if (transport_->SendRtcp(packet.data(), packet.size())) {
-        bytes_sent += packet.size();
-        if (event_log_) {
-          event_log_->Log(std::make_unique<RtcEventRtcpPacketOutgoing>(packet));
-        }
-      }
-    });
-    return bytes_sent;
-  }
-
- private:
-  Transport* transport_;
-  RtcEventLog* const event_log_;
-
-  RTC_DISALLOW_IMPLICIT_CONSTRUCTORS(PacketContainer);
-};
-
-// Helper to put several RTCP packets into lower layer datagram RTCP packet.
-// Prefer to use this class instead of PacketContainer.
-class PacketSender {
- public:
-  PacketSender(rtcp::RtcpPacket::PacketReadyCallback callback,
-               size_t max_packet_size)
-      : callback_(callback), max_packet_size_(max_packet_size) {
-    RTC_CHECK_LE(max_packet_size, IP_PACKET_SIZE);
-  }
-  ~PacketSender() { RTC_DCHECK_EQ(index_, 0) << "Unsent rtcp packet."; }
-
-  // Appends a packet to pending compound packet.
-  // Sends rtcp packet if buffer is full and resets the buffer.
-  void AppendPacket(const rtcp::RtcpPacket& packet) {
-    packet.Create(buffer_, &index_, max_packet_size_, callback_);
-  }
-
-  // Sends pending rtcp packet.
-  void Send() {
-    if (index_ > 0) {
-      callback_(rtc::ArrayView<const uint8_t>(buffer_, index_));
-      index_ = 0;
-    }
-  }
-
-  bool IsEmpty() const { return index_ == 0; }
-
- private:
-  const rtcp::RtcpPacket::PacketReadyCallback callback_;
-  const size_t max_packet_size_;
-  size_t index_ = 0;
-  uint8_t buffer_[IP_PACKET_SIZE];
-};
-
 }  // namespace
 
 RTCPSender::FeedbackState::FeedbackState()
@@ -707,20 +643,27 @@ int32_t RTCPSender::SendCompoundRTCP(
     const std::set<RTCPPacketType>& packet_types,
     int32_t nack_size,
     const uint16_t* nack_list) {
-  PacketContainer container(transport_, event_log_);
-  size_t max_packet_size;
+  size_t bytes_sent = 0;
+  auto callback = [&](rtc::ArrayView<const uint8_t> packet) {
+    if (transport_->SendRtcp(packet.data(), packet.size())) {
+      bytes_sent += packet.size();
+      if (event_log_) {
+        event_log_->Log(std::make_unique<RtcEventRtcpPacketOutgoing>(packet));
+      }
+    }
+  };
 
+  absl::optional<int32_t> result;
   {
     rtc::CritScope lock(&critical_section_rtcp_sender_);
-    auto result = ComputeCompoundRTCPPacket(feedback_state, packet_types,
-                                            nack_size, nack_list, &container);
-    if (result) {
-      return *result;
-    }
-    max_packet_size = max_packet_size_;
+    PacketSender sender(callback, max_packet_size_);
+    result = ComputeCompoundRTCPPacket(feedback_state, packet_types, nack_size,
+                                       nack_list, sender);
+    sender.Send();
+  }
+  if (result) {
+    return *result;
   }
-
-  size_t bytes_sent = container.SendPackets(max_packet_size);
   return bytes_sent == 0 ? -1 : 0;
 }
 
@@ -729,13 +672,22 @@ int32_t RTCPSender::SendCompoundRTCPLocked(
     const std::set<RTCPPacketType>& packet_types,
     int32_t nack_size,
     const uint16_t* nack_list) {
-  PacketContainer container(transport_, event_log_);
+  size_t bytes_sent = 0;
+  auto callback = [&](rtc::ArrayView<const uint8_t> packet) {
+    if (transport_->SendRtcp(packet.data(), packet.size())) {
+      bytes_sent += packet.size();
+      if (event_log_) {
+        event_log_->Log(std::make_unique<RtcEventRtcpPacketOutgoing>(packet));
+      }
+    }
+  };
+  PacketSender sender(callback, max_packet_size_);
   auto result = ComputeCompoundRTCPPacket(feedback_state, packet_types,
-                                          nack_size, nack_list, &container);
+                                          nack_size, nack_list, sender);
+  sender.Send();
   if (result) {
     return *result;
   }
-  size_t bytes_sent = container.SendPackets(max_packet_size_);
   return bytes_sent == 0 ? -1 : 0;
 }
 
@@ -744,7 +696,7 @@ absl::optional<int32_t> RTCPSender::ComputeCompoundRTCPPacket(
     const std::set<RTCPPacketType>& packet_types,
     int32_t nack_size,
     const uint16_t* nack_list,
-    rtcp::CompoundPacket* out_packet) {
+    PacketSender& sender) {
   if (method_ == RtcpMode::kOff) {
     RTC_LOG(LS_WARNING) << "Can't send rtcp if it is disabled.";
     return -1;
@@ -800,13 +752,13 @@ absl::optional<int32_t> RTCPSender::ComputeCompoundRTCPPacket(
     if (builder_it->first == kRtcpBye) {
       packet_bye = std::move(packet);
     } else {
-      out_packet->Append(packet.release());
+      sender.AppendPacket(*packet);
     }
   }
 
   // Append the BYE now at the end
   if (packet_bye) {
-    out_packet->Append(packet_bye.release());
+    sender.AppendPacket(*packet_bye);
   }
 
   if (packet_type_counter_observer_ != nullptr) {
@@ -55,6 +55,14 @@ class RtcpTransceiver : public RtcpFeedbackSenderInterface {
                                        MediaReceiverRtcpObserver* observer,
                                        std::function<void()> on_removed);
 
+  // Registers a local media sender so its SenderReport is aggregated into the
+  // shared periodic compound packets. Calls to the provider will be done on
+  // the |config.task_queue|.
+  void AddMediaSender(uint32_t local_ssrc, MediaSenderStatsProvider* provider);
+  // Deregisters the sender. Might return before the provider is deregistered.
+  // Runs |on_removed| when it is.
+  void RemoveMediaSender(uint32_t local_ssrc, std::function<void()> on_removed);
+
   // Enables/disables sending rtcp packets eventually.
   // Packets may be sent after the SetReadyToSend(false) returns, but no new
   // packets will be scheduled.
@@ -38,6 +38,26 @@ class MediaReceiverRtcpObserver {
                                    const VideoBitrateAllocation& allocation) {}
 };
 
+// Interface through which a local media (rtp) sender provides the counters
+// needed to build a SenderReport on its behalf, so that one RtcpTransceiver
+// per transport can aggregate reports for all bundled local ssrcs into
+// shared compound packets on a single timer.
+class MediaSenderStatsProvider {
+ public:
+  struct SenderStats {
+    // Rtp timestamp corresponding to the report time the stats are taken at.
+    uint32_t rtp_timestamp = 0;
+    uint32_t packets_sent = 0;
+    uint32_t media_octets_sent = 0;
+  };
+
+  virtual ~MediaSenderStatsProvider() = default;
+
+  // |report_time| is the ntp time the SenderReport will carry; the returned
+  // rtp_timestamp should correspond to it.
+  virtual SenderStats GetSenderStats(NtpTime report_time) = 0;
+};
+
 struct RtcpTransceiverConfig {
   RtcpTransceiverConfig();
   RtcpTransceiverConfig(const RtcpTransceiverConfig&);
@@ -121,6 +121,16 @@ void RtcpTransceiverImpl::RemoveMediaReceiverRtcpObserver(
   stored.erase(it);
 }
 
+void RtcpTransceiverImpl::AddMediaSender(uint32_t local_ssrc,
+                                         MediaSenderStatsProvider* provider) {
+  RTC_DCHECK(provider);
+  local_senders_[local_ssrc] = provider;
+}
+
+void RtcpTransceiverImpl::RemoveMediaSender(uint32_t local_ssrc) {
+  local_senders_.erase(local_ssrc);
+}
+
 void RtcpTransceiverImpl::SetReadyToSend(bool ready) {
   if (config_.schedule_periodic_compound_packets) {
     if (ready_to_send_ && !ready)
@@ -354,10 +364,32 @@ void RtcpTransceiverImpl::CreateCompoundPacket(PacketSender* sender) {
   RTC_DCHECK(sender->IsEmpty());
   const uint32_t sender_ssrc = config_.feedback_ssrc;
   int64_t now_us = rtc::TimeMicros();
-  rtcp::ReceiverReport receiver_report;
-  receiver_report.SetSenderSsrc(sender_ssrc);
-  receiver_report.SetReportBlocks(CreateReportBlocks(now_us));
-  sender->AppendPacket(receiver_report);
+  std::vector<rtcp::ReportBlock> report_blocks = CreateReportBlocks(now_us);
+  if (local_senders_.empty()) {
+    rtcp::ReceiverReport receiver_report;
+    receiver_report.SetSenderSsrc(sender_ssrc);
+    receiver_report.SetReportBlocks(std::move(report_blocks));
+    sender->AppendPacket(receiver_report);
+  } else {
+    // One shared compound packet carries a SenderReport per local sender;
+    // the first report takes the report blocks.
+    NtpTime report_time = TimeMicrosToNtp(now_us);
+    for (const auto& ssrc_provider : local_senders_) {
+      MediaSenderStatsProvider::SenderStats stats =
+          ssrc_provider.second->GetSenderStats(report_time);
+      rtcp::SenderReport sender_report;
+      sender_report.SetSenderSsrc(ssrc_provider.first);
+      sender_report.SetNtp(report_time);
+      sender_report.SetRtpTimestamp(stats.rtp_timestamp);
+      sender_report.SetPacketCount(stats.packets_sent);
+      sender_report.SetOctetCount(stats.media_octets_sent);
+      if (!report_blocks.empty()) {
+        sender_report.SetReportBlocks(std::move(report_blocks));
+        report_blocks.clear();
+      }
+      sender->AppendPacket(sender_report);
+    }
+  }
 
   if (!config_.cname.empty()) {
     rtcp::Sdes sdes;
@@ -370,10 +402,9 @@ void RtcpTransceiverImpl::CreateCompoundPacket(PacketSender* sender) {
     remb_->SetSenderSsrc(sender_ssrc);
     sender->AppendPacket(*remb_);
   }
-  // TODO(bugs.webrtc.org/8239): Do not send rrtr if this packet starts with
-  // SenderReport instead of ReceiverReport
-  // when RtcpTransceiver supports rtp senders.
-  if (config_.non_sender_rtt_measurement) {
+  // rfc3611 section 4.4: the receiver reference time report is for use by
+  // non-senders, so skip it when this packet starts with SenderReports.
+  if (config_.non_sender_rtt_measurement && local_senders_.empty()) {
     rtcp::ExtendedReports xr;
 
     rtcp::Rrtr rrtr;
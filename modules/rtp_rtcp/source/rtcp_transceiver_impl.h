@@ -46,6 +46,12 @@ class RtcpTransceiverImpl {
   void RemoveMediaReceiverRtcpObserver(uint32_t remote_ssrc,
                                        MediaReceiverRtcpObserver* observer);
 
+  // Registers a local media sender. Compound packets then start with a
+  // SenderReport per registered ssrc instead of a ReceiverReport, so all
+  // bundled senders share the periodic timer and the datagrams.
+  void AddMediaSender(uint32_t local_ssrc, MediaSenderStatsProvider* provider);
+  void RemoveMediaSender(uint32_t local_ssrc);
+
   void SetReadyToSend(bool ready);
 
   void ReceivePacket(rtc::ArrayView<const uint8_t> packet, int64_t now_us);
@@ -106,6 +112,7 @@ class RtcpTransceiverImpl {
   // TODO(danilchap): Remove entries from remote_senders_ that are no longer
   // needed.
   std::map<uint32_t, RemoteSenderState> remote_senders_;
+  std::map<uint32_t, MediaSenderStatsProvider*> local_senders_;
   RepeatingTaskHandle periodic_task_handle_;
 };
 
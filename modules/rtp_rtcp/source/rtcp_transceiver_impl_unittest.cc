@@ -38,6 +38,7 @@ using ::testing::SizeIs;
 using ::testing::StrictMock;
 using ::webrtc::CompactNtp;
 using ::webrtc::CompactNtpRttToMs;
+using ::webrtc::MediaSenderStatsProvider;
 using ::webrtc::MockRtcpRttStats;
 using ::webrtc::MockTransport;
 using ::webrtc::NtpTime;
@@ -66,6 +67,15 @@ class MockMediaReceiverRtcpObserver : public webrtc::MediaReceiverRtcpObserver {
                void(uint32_t, const VideoBitrateAllocation&));
 };
 
+class FakeMediaSenderStatsProvider : public webrtc::MediaSenderStatsProvider {
+ public:
+  explicit FakeMediaSenderStatsProvider(SenderStats stats) : stats_(stats) {}
+  SenderStats GetSenderStats(NtpTime report_time) override { return stats_; }
+
+ private:
+  const SenderStats stats_;
+};
+
 // Since some tests will need to wait for this period, make it small to avoid
 // slowing tests too much. As long as there are test bots with high scheduler
 // granularity, small period should be ok.
@@ -537,6 +547,93 @@ TEST(RtcpTransceiverImplTest, ReceiverReportUsesReceiveStatistics) {
             kMediaSsrc);
 }
 
+TEST(RtcpTransceiverImplTest, SendsSenderReportsForRegisteredMediaSenders) {
+  const uint32_t kSenderSsrc1 = 1234;
+  const uint32_t kSenderSsrc2 = 5678;
+  MediaSenderStatsProvider::SenderStats stats1;
+  stats1.rtp_timestamp = 10203040;
+  stats1.packets_sent = 100;
+  stats1.media_octets_sent = 50000;
+  FakeMediaSenderStatsProvider provider1(stats1);
+  MediaSenderStatsProvider::SenderStats stats2;
+  stats2.rtp_timestamp = 40302010;
+  stats2.packets_sent = 200;
+  stats2.media_octets_sent = 90000;
+  FakeMediaSenderStatsProvider provider2(stats2);
+
+  RtcpTransceiverConfig config = DefaultTestConfig();
+  RtcpPacketParser rtcp_parser;
+  RtcpParserTransport transport(&rtcp_parser);
+  config.outgoing_transport = &transport;
+  RtcpTransceiverImpl rtcp_transceiver(config);
+  rtcp_transceiver.AddMediaSender(kSenderSsrc1, &provider1);
+  rtcp_transceiver.AddMediaSender(kSenderSsrc2, &provider2);
+
+  rtcp_transceiver.SendCompoundPacket();
+
+  // Both senders share one compound packet with one SenderReport each,
+  // replacing the ReceiverReport.
+  EXPECT_EQ(transport.num_packets(), 1);
+  EXPECT_EQ(rtcp_parser.sender_report()->num_packets(), 2);
+  EXPECT_EQ(rtcp_parser.receiver_report()->num_packets(), 0);
+  // The parser keeps the last parsed SenderReport, i.e. the 2nd sender's.
+  EXPECT_EQ(rtcp_parser.sender_report()->sender_ssrc(), kSenderSsrc2);
+  EXPECT_EQ(rtcp_parser.sender_report()->rtp_timestamp(),
+            stats2.rtp_timestamp);
+  EXPECT_EQ(rtcp_parser.sender_report()->sender_packet_count(),
+            stats2.packets_sent);
+  EXPECT_EQ(rtcp_parser.sender_report()->sender_octet_count(),
+            stats2.media_octets_sent);
+}
+
+TEST(RtcpTransceiverImplTest, SendsReceiverReportAfterMediaSenderRemoved) {
+  const uint32_t kSenderSsrc = 1234;
+  FakeMediaSenderStatsProvider provider({});
+
+  RtcpTransceiverConfig config = DefaultTestConfig();
+  RtcpPacketParser rtcp_parser;
+  RtcpParserTransport transport(&rtcp_parser);
+  config.outgoing_transport = &transport;
+  RtcpTransceiverImpl rtcp_transceiver(config);
+  rtcp_transceiver.AddMediaSender(kSenderSsrc, &provider);
+
+  rtcp_transceiver.SendCompoundPacket();
+  EXPECT_EQ(rtcp_parser.sender_report()->num_packets(), 1);
+  EXPECT_EQ(rtcp_parser.receiver_report()->num_packets(), 0);
+
+  rtcp_transceiver.RemoveMediaSender(kSenderSsrc);
+  rtcp_transceiver.SendCompoundPacket();
+  EXPECT_EQ(rtcp_parser.sender_report()->num_packets(), 1);
+  EXPECT_EQ(rtcp_parser.receiver_report()->num_packets(), 1);
+}
+
+TEST(RtcpTransceiverImplTest, AttachesReportBlocksToFirstSenderReport) {
+  const uint32_t kSenderSsrc = 1234;
+  const uint32_t kMediaSsrc = 54321;
+  MockReceiveStatisticsProvider receive_statistics;
+  std::vector<ReportBlock> report_blocks(1);
+  report_blocks[0].SetMediaSsrc(kMediaSsrc);
+  EXPECT_CALL(receive_statistics, RtcpReportBlocks(_))
+      .WillRepeatedly(Return(report_blocks));
+  FakeMediaSenderStatsProvider provider({});
+
+  RtcpTransceiverConfig config = DefaultTestConfig();
+  RtcpPacketParser rtcp_parser;
+  RtcpParserTransport transport(&rtcp_parser);
+  config.outgoing_transport = &transport;
+  config.receive_statistics = &receive_statistics;
+  RtcpTransceiverImpl rtcp_transceiver(config);
+  rtcp_transceiver.AddMediaSender(kSenderSsrc, &provider);
+
+  rtcp_transceiver.SendCompoundPacket();
+
+  ASSERT_EQ(rtcp_parser.sender_report()->num_packets(), 1);
+  ASSERT_THAT(rtcp_parser.sender_report()->report_blocks(),
+              SizeIs(report_blocks.size()));
+  EXPECT_EQ(rtcp_parser.sender_report()->report_blocks()[0].source_ssrc(),
+            kMediaSsrc);
+}
+
 TEST(RtcpTransceiverImplTest, MultipleObserversOnSameSsrc) {
   const uint32_t kRemoteSsrc = 12345;
   StrictMock<MockMediaReceiverRtcpObserver> observer1;
@@ -249,7 +249,6 @@ bool RtpPacketizerH264::NextPacket(RtpPacketToSend* rtp_packet) {
     uint8_t* buffer = rtp_packet->AllocatePayload(bytes_to_send);
     memcpy(buffer, packet.source_fragment.data(), bytes_to_send);
     packets_.pop();
-    input_fragments_.pop_front();
   } else if (packet.aggregated) {
     NextAggregatePacket(rtp_packet);
   } else {
@@ -282,7 +281,6 @@ void RtpPacketizerH264::NextAggregatePacket(RtpPacketToSend* rtp_packet) {
     memcpy(&buffer[index], fragment.data(), fragment.size());
     index += fragment.size();
     packets_.pop();
-    input_fragments_.pop_front();
     if (is_last_fragment)
       break;
     packet = &packets_.front();
@@ -312,8 +310,6 @@ void RtpPacketizerH264::NextFragmentPacket(RtpPacketToSend* rtp_packet) {
   buffer[0] = fu_indicator;
   buffer[1] = fu_header;
   memcpy(buffer + kFuAHeaderSize, fragment.data(), fragment.size());
-  if (packet->last_fragment)
-    input_fragments_.pop_front();
   packets_.pop();
 }
 
@@ -14,10 +14,10 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <deque>
 #include <memory>
 #include <queue>
 
+#include "absl/container/inlined_vector.h"
 #include "api/array_view.h"
 #include "modules/include/module_common_types.h"
 #include "modules/rtp_rtcp/source/rtp_format.h"
@@ -82,7 +82,11 @@ class RtpPacketizerH264 : public RtpPacketizer {
 
   const PayloadSizeLimits limits_;
   size_t num_packets_left_;
-  std::deque<rtc::ArrayView<const uint8_t>> input_fragments_;
+  // Views into the payload, one per NALU. Inlined so that packetizing a
+  // frame with a typical number of NALUs doesn't allocate; the PacketUnits
+  // reference the payload directly, so this is never copied from again after
+  // GeneratePackets().
+  absl::InlinedVector<rtc::ArrayView<const uint8_t>, 8> input_fragments_;
   std::queue<PacketUnit> packets_;
 
   RTC_DISALLOW_COPY_AND_ASSIGN(RtpPacketizerH264);
@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/rtp_forwarder.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+
+RtpForwarder::RtpForwarder() : random_(rtc::TimeMicros()) {}
+
+RtpForwarder::~RtpForwarder() = default;
+
+int RtpForwarder::AddSubscriber(const SubscriberConfig& config) {
+  RTC_DCHECK(!!config.transport != !!config.paced_sender);
+  rtc::CritScope cs(&crit_);
+  const int subscriber_id = next_subscriber_id_++;
+  Subscriber& subscriber = subscribers_[subscriber_id];
+  subscriber.config = config;
+  subscriber.next_sequence_number = random_.Rand<uint16_t>();
+  return subscriber_id;
+}
+
+void RtpForwarder::RemoveSubscriber(int subscriber_id) {
+  rtc::CritScope cs(&crit_);
+  subscribers_.erase(subscriber_id);
+}
+
+void RtpForwarder::OnRtpPacket(const RtpPacketReceived& packet) {
+  rtc::CritScope cs(&crit_);
+  if (subscribers_.empty()) {
+    return;
+  }
+  // One mutable copy of the packet serves every subscriber; only the
+  // rewritten header fields are touched between sends, so the copy-on-write
+  // payload is shared. The first rewrite unshares the buffer from the
+  // caller's packet, later rewrites are in place unless a pacer has
+  // retained a reference.
+  RtpPacketReceived working(packet);
+  for (auto& entry : subscribers_) {
+    Subscriber& subscriber = entry.second;
+    working.SetSsrc(subscriber.config.ssrc);
+    working.SetSequenceNumber(subscriber.next_sequence_number++);
+    if (subscriber.config.payload_type >= 0) {
+      working.SetPayloadType(subscriber.config.payload_type);
+    }
+    if (subscriber.config.transport) {
+      PacketOptions options;
+      subscriber.config.transport->SendRtp(working.data(), working.size(),
+                                           options);
+    } else {
+      auto to_send = std::make_unique<RtpPacketToSend>(nullptr);
+      // Shares |working|'s buffer until the next subscriber's rewrite.
+      to_send->Parse(working.Buffer());
+      to_send->set_packet_type(subscriber.config.audio
+                                   ? RtpPacketMediaType::kAudio
+                                   : RtpPacketMediaType::kVideo);
+      std::vector<std::unique_ptr<RtpPacketToSend>> packets;
+      packets.push_back(std::move(to_send));
+      subscriber.config.paced_sender->EnqueuePackets(std::move(packets));
+    }
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,83 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_RTP_RTCP_SOURCE_RTP_FORWARDER_H_
+#define MODULES_RTP_RTCP_SOURCE_RTP_FORWARDER_H_
+
+#include <map>
+
+#include "api/call/transport.h"
+#include "call/rtp_packet_sink_interface.h"
+#include "modules/rtp_rtcp/include/rtp_packet_sender.h"
+#include "modules/rtp_rtcp/source/rtp_packet_received.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/random.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Forwards RTP packets from one publisher to many subscribers, SFU style.
+// The payload and header extensions are left untouched and only the SSRC,
+// sequence number and (optionally) payload type are rewritten per
+// subscriber, so all subscribers share the publisher's extension layout and
+// no per-subscriber re-serialization takes place. Subscribers sending
+// directly through a Transport share a single packet buffer that is
+// rewritten in place between sends, so one payload buffer serves any number
+// of subscribers without copies.
+class RtpForwarder : public RtpPacketSinkInterface {
+ public:
+  struct SubscriberConfig {
+    // SSRC forwarded packets are rewritten to.
+    uint32_t ssrc = 0;
+    // Payload type to rewrite to, or -1 to keep the publisher's.
+    int payload_type = -1;
+    // Marks forwarded packets as audio or video for the pacer.
+    bool audio = false;
+    // Exactly one of |transport| and |paced_sender| must be set, and it
+    // must outlive the subscription. A |transport| is handed the rewritten
+    // packet synchronously and must not retain the buffer; subscribers on
+    // this path share one buffer with zero copies. Packets for a
+    // |paced_sender| (e.g. a PacedSender draining into
+    // PacketRouter::SendPacket) are paced per subscriber, which costs one
+    // buffer copy per packet since the pacer retains it.
+    Transport* transport = nullptr;
+    RtpPacketSender* paced_sender = nullptr;
+  };
+
+  RtpForwarder();
+  ~RtpForwarder() override;
+
+  RtpForwarder(const RtpForwarder&) = delete;
+  RtpForwarder& operator=(const RtpForwarder&) = delete;
+
+  // Adds a subscriber and returns the id to use with RemoveSubscriber().
+  // The subscriber's sequence numbers start at a random offset. May be
+  // called while packets are being forwarded.
+  int AddSubscriber(const SubscriberConfig& config);
+  void RemoveSubscriber(int subscriber_id);
+
+  // Implements RtpPacketSinkInterface; receives the publisher's packets.
+  void OnRtpPacket(const RtpPacketReceived& packet) override;
+
+ private:
+  struct Subscriber {
+    SubscriberConfig config;
+    uint16_t next_sequence_number = 0;
+  };
+
+  rtc::CriticalSection crit_;
+  Random random_ RTC_GUARDED_BY(crit_);
+  int next_subscriber_id_ RTC_GUARDED_BY(crit_) = 0;
+  std::map<int, Subscriber> subscribers_ RTC_GUARDED_BY(crit_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_RTP_FORWARDER_H_
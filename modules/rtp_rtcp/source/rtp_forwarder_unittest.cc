@@ -0,0 +1,156 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/rtp_forwarder.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "modules/rtp_rtcp/source/rtp_packet.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr uint32_t kPublisherSsrc = 0x12345678;
+constexpr uint32_t kSubscriberSsrc1 = 0x11111111;
+constexpr uint32_t kSubscriberSsrc2 = 0x22222222;
+constexpr uint8_t kPublisherPayloadType = 96;
+constexpr uint8_t kRewrittenPayloadType = 98;
+
+class RecordingTransport : public Transport {
+ public:
+  bool SendRtp(const uint8_t* packet,
+               size_t length,
+               const PacketOptions& options) override {
+    RtpPacket parsed;
+    EXPECT_TRUE(parsed.Parse(packet, length));
+    packets_.push_back(parsed);
+    return true;
+  }
+  bool SendRtcp(const uint8_t* packet, size_t length) override {
+    return true;
+  }
+
+  const std::vector<RtpPacket>& packets() const { return packets_; }
+
+ private:
+  std::vector<RtpPacket> packets_;
+};
+
+class RecordingPacketSender : public RtpPacketSender {
+ public:
+  void EnqueuePackets(
+      std::vector<std::unique_ptr<RtpPacketToSend>> packets) override {
+    for (auto& packet : packets) {
+      packets_.push_back(std::move(packet));
+    }
+  }
+
+  const std::vector<std::unique_ptr<RtpPacketToSend>>& packets() const {
+    return packets_;
+  }
+
+ private:
+  std::vector<std::unique_ptr<RtpPacketToSend>> packets_;
+};
+
+RtpPacketReceived MakePublisherPacket(uint16_t sequence_number) {
+  RtpPacketReceived packet;
+  packet.SetSsrc(kPublisherSsrc);
+  packet.SetPayloadType(kPublisherPayloadType);
+  packet.SetSequenceNumber(sequence_number);
+  packet.SetTimestamp(4711);
+  uint8_t* payload = packet.AllocatePayload(16);
+  for (uint8_t i = 0; i < 16; ++i) {
+    payload[i] = i;
+  }
+  return packet;
+}
+
+TEST(RtpForwarderTest, RewritesHeaderFieldsPerSubscriber) {
+  RtpForwarder forwarder;
+  RecordingTransport transport1;
+  RecordingTransport transport2;
+
+  RtpForwarder::SubscriberConfig config1;
+  config1.ssrc = kSubscriberSsrc1;
+  config1.transport = &transport1;
+  forwarder.AddSubscriber(config1);
+
+  RtpForwarder::SubscriberConfig config2;
+  config2.ssrc = kSubscriberSsrc2;
+  config2.payload_type = kRewrittenPayloadType;
+  config2.transport = &transport2;
+  forwarder.AddSubscriber(config2);
+
+  forwarder.OnRtpPacket(MakePublisherPacket(/*sequence_number=*/1000));
+  forwarder.OnRtpPacket(MakePublisherPacket(/*sequence_number=*/1001));
+
+  ASSERT_EQ(transport1.packets().size(), 2u);
+  ASSERT_EQ(transport2.packets().size(), 2u);
+
+  EXPECT_EQ(transport1.packets()[0].Ssrc(), kSubscriberSsrc1);
+  EXPECT_EQ(transport1.packets()[0].PayloadType(), kPublisherPayloadType);
+  EXPECT_EQ(transport2.packets()[0].Ssrc(), kSubscriberSsrc2);
+  EXPECT_EQ(transport2.packets()[0].PayloadType(), kRewrittenPayloadType);
+
+  // Per-subscriber sequence numbers are consecutive, independent of the
+  // publisher's.
+  for (const RecordingTransport* transport : {&transport1, &transport2}) {
+    EXPECT_EQ(
+        static_cast<uint16_t>(transport->packets()[0].SequenceNumber() + 1),
+        transport->packets()[1].SequenceNumber());
+  }
+
+  // Timestamp and payload are forwarded untouched.
+  EXPECT_EQ(transport1.packets()[0].Timestamp(), 4711u);
+  ASSERT_EQ(transport1.packets()[0].payload_size(), 16u);
+  EXPECT_EQ(transport1.packets()[0].payload()[7], 7);
+}
+
+TEST(RtpForwarderTest, EnqueuesPacedPacketsWithMediaType) {
+  RtpForwarder forwarder;
+  RecordingPacketSender paced_sender;
+
+  RtpForwarder::SubscriberConfig config;
+  config.ssrc = kSubscriberSsrc1;
+  config.audio = true;
+  config.paced_sender = &paced_sender;
+  forwarder.AddSubscriber(config);
+
+  forwarder.OnRtpPacket(MakePublisherPacket(/*sequence_number=*/0));
+
+  ASSERT_EQ(paced_sender.packets().size(), 1u);
+  EXPECT_EQ(paced_sender.packets()[0]->Ssrc(), kSubscriberSsrc1);
+  EXPECT_EQ(paced_sender.packets()[0]->packet_type(),
+            RtpPacketMediaType::kAudio);
+}
+
+TEST(RtpForwarderTest, RemovedSubscriberStopsReceiving) {
+  RtpForwarder forwarder;
+  RecordingTransport transport;
+
+  RtpForwarder::SubscriberConfig config;
+  config.ssrc = kSubscriberSsrc1;
+  config.transport = &transport;
+  int id = forwarder.AddSubscriber(config);
+
+  forwarder.OnRtpPacket(MakePublisherPacket(/*sequence_number=*/0));
+  forwarder.RemoveSubscriber(id);
+  forwarder.OnRtpPacket(MakePublisherPacket(/*sequence_number=*/1));
+
+  EXPECT_EQ(transport.packets().size(), 1u);
+}
+
+}  // namespace
+}  // namespace webrtc
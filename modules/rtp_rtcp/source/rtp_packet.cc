@@ -128,6 +128,28 @@ void RtpPacket::CopyHeaderFrom(const RtpPacket& packet) {
   padding_size_ = 0;
 }
 
+void RtpPacket::StampHeaderFrom(const RtpPacket& packet) {
+  RTC_DCHECK_GE(capacity(), packet.headers_size());
+
+  marker_ = packet.marker_;
+  payload_type_ = packet.payload_type_;
+  sequence_number_ = packet.sequence_number_;
+  timestamp_ = packet.timestamp_;
+  ssrc_ = packet.ssrc_;
+  payload_offset_ = packet.payload_offset_;
+  extensions_ = packet.extensions_;
+  // assign() rather than operator= to reuse any capacity this packet already
+  // holds, avoiding a reallocation when packets are recycled through a pool.
+  extension_entries_.assign(packet.extension_entries_.begin(),
+                            packet.extension_entries_.end());
+  extensions_size_ = packet.extensions_size_;
+  buffer_.SetSize(packet.headers_size());
+  memcpy(WriteAt(0), packet.data(), packet.headers_size());
+  // Reset payload and padding.
+  payload_size_ = 0;
+  padding_size_ = 0;
+}
+
 void RtpPacket::SetMarker(bool marker_bit) {
   marker_ = marker_bit;
   if (marker_) {
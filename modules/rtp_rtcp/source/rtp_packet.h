@@ -86,6 +86,12 @@ class RtpPacket {
 
   // Header setters.
   void CopyHeaderFrom(const RtpPacket& packet);
+  // As CopyHeaderFrom, but writes the header bytes into this packet's own
+  // buffer instead of aliasing |packet|'s buffer. The packet keeps its full
+  // capacity and later header writes do not copy-on-write a buffer shared
+  // with |packet|, making it suitable for stamping a prebuilt header onto
+  // many outgoing packets.
+  void StampHeaderFrom(const RtpPacket& packet);
   void SetMarker(bool marker_bit);
   void SetPayloadType(uint8_t payload_type);
   void SetSequenceNumber(uint16_t seq_no);
@@ -16,6 +16,7 @@
 #include <utility>
 
 #include "modules/include/module_common_types_public.h"
+#include "modules/rtp_rtcp/source/rtp_packet_pool.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
@@ -33,6 +34,9 @@ RtpPacketHistory::PacketState::PacketState() = default;
 RtpPacketHistory::PacketState::PacketState(const PacketState&) = default;
 RtpPacketHistory::PacketState::~PacketState() = default;
 
+RtpPacketHistory::StoredPacket::StoredPacket()
+    : StoredPacket(nullptr, absl::nullopt, 0) {}
+
 RtpPacketHistory::StoredPacket::StoredPacket(
     std::unique_ptr<RtpPacketToSend> packet,
     absl::optional<int64_t> send_time_ms,
@@ -76,6 +80,11 @@ bool RtpPacketHistory::MoreUseful::operator()(StoredPacket* lhs,
   if (lhs->times_retransmitted() != rhs->times_retransmitted()) {
     return lhs->times_retransmitted() < rhs->times_retransmitted();
   }
+  // Prefer key frame packets; losing one of those stalls decoding until the
+  // next key frame, so repeating them speculatively has the highest value.
+  if (lhs->packet_->is_key_frame() != rhs->packet_->is_key_frame()) {
+    return lhs->packet_->is_key_frame();
+  }
   // All else being equal, prefer newer packets.
   return lhs->insert_order() > rhs->insert_order();
 }
@@ -83,13 +92,24 @@ bool RtpPacketHistory::MoreUseful::operator()(StoredPacket* lhs,
 RtpPacketHistory::RtpPacketHistory(Clock* clock, bool enable_padding_prio)
     : clock_(clock),
       enable_padding_prio_(enable_padding_prio),
+      packet_pool_(nullptr),
       number_to_store_(0),
       mode_(StorageMode::kDisabled),
       rtt_ms_(-1),
-      packets_inserted_(0) {}
+      ring_mask_(0),
+      front_slot_(0),
+      history_size_(0),
+      front_seq_no_(0),
+      packets_inserted_(0),
+      bytes_stored_(0) {}
 
 RtpPacketHistory::~RtpPacketHistory() {}
 
+void RtpPacketHistory::SetPacketPool(RtpPacketPool* packet_pool) {
+  rtc::CritScope cs(&lock_);
+  packet_pool_ = packet_pool;
+}
+
 void RtpPacketHistory::SetStorePacketsStatus(StorageMode mode,
                                              size_t number_to_store) {
   RTC_DCHECK_LE(number_to_store, kMaxCapacity);
@@ -97,9 +117,9 @@ void RtpPacketHistory::SetStorePacketsStatus(StorageMode mode,
   if (mode != StorageMode::kDisabled && mode_ != StorageMode::kDisabled) {
     RTC_LOG(LS_WARNING) << "Purging packet history in order to re-set status.";
   }
-  Reset();
   mode_ = mode;
   number_to_store_ = std::min(kMaxCapacity, number_to_store);
+  Reset();
 }
 
 RtpPacketHistory::StorageMode RtpPacketHistory::GetStorageMode() const {
@@ -134,36 +154,58 @@ void RtpPacketHistory::PutRtpPacket(std::unique_ptr<RtpPacketToSend> packet,
   // Store packet.
   const uint16_t rtp_seq_no = packet->SequenceNumber();
   int packet_index = GetPacketIndex(rtp_seq_no);
-  if (packet_index >= 0u &&
-      static_cast<size_t>(packet_index) < packet_history_.size() &&
-      packet_history_[packet_index].packet_ != nullptr) {
+  if (packet_index >= 0 && static_cast<size_t>(packet_index) < history_size_ &&
+      PacketAt(packet_index).packet_ != nullptr) {
     RTC_LOG(LS_WARNING) << "Duplicate packet inserted: " << rtp_seq_no;
     // Remove previous packet to avoid inconsistent state.
     RemovePacket(packet_index);
     packet_index = GetPacketIndex(rtp_seq_no);
   }
 
-  // Packet to be inserted ahead of first packet, expand front.
-  for (; packet_index < 0; ++packet_index) {
-    packet_history_.emplace_front(nullptr, absl::nullopt, 0);
+  // Packet to be inserted behind the last packet; evict the oldest entries
+  // if the window would no longer fit in the ring.
+  while (history_size_ > 0 && packet_index > 0 &&
+         static_cast<size_t>(packet_index) >= packet_ring_.size()) {
+    RemovePacket(0);
+    packet_index = GetPacketIndex(rtp_seq_no);
   }
-  // Packet to be inserted behind last packet, expand back.
-  while (static_cast<int>(packet_history_.size()) <= packet_index) {
-    packet_history_.emplace_back(nullptr, absl::nullopt, 0);
+
+  if (history_size_ == 0) {
+    front_slot_ = 0;
+    front_seq_no_ = rtp_seq_no;
+    history_size_ = 1;
+    packet_index = 0;
+  } else if (packet_index < 0) {
+    // Packet to be inserted ahead of the first packet, expand the window at
+    // the front.
+    const size_t expand_by = static_cast<size_t>(-packet_index);
+    if (history_size_ + expand_by > packet_ring_.size()) {
+      RTC_LOG(LS_WARNING) << "Packet older than the stored window, dropping: "
+                          << rtp_seq_no;
+      return;
+    }
+    front_slot_ = (front_slot_ + packet_ring_.size() - expand_by) & ring_mask_;
+    front_seq_no_ = rtp_seq_no;
+    history_size_ += expand_by;
+    packet_index = 0;
+  } else if (static_cast<size_t>(packet_index) >= history_size_) {
+    // Expand the window at the back; the slots in between become holes.
+    history_size_ = packet_index + 1;
   }
 
   RTC_DCHECK_GE(packet_index, 0);
-  RTC_DCHECK_LT(packet_index, packet_history_.size());
-  RTC_DCHECK(packet_history_[packet_index].packet_ == nullptr);
+  RTC_DCHECK_LT(static_cast<size_t>(packet_index), history_size_);
+  RTC_DCHECK(PacketAt(packet_index).packet_ == nullptr);
 
-  packet_history_[packet_index] =
+  bytes_stored_ += packet->capacity();
+  PacketAt(packet_index) =
       StoredPacket(std::move(packet), send_time_ms, packets_inserted_++);
 
   if (enable_padding_prio_) {
     if (padding_priority_.size() >= kMaxPaddingtHistory - 1) {
       padding_priority_.erase(std::prev(padding_priority_.end()));
     }
-    auto prio_it = padding_priority_.insert(&packet_history_[packet_index]);
+    auto prio_it = padding_priority_.insert(&PacketAt(packet_index));
     RTC_DCHECK(prio_it.second) << "Failed to insert packet into prio set.";
   }
 }
@@ -240,6 +282,51 @@ std::unique_ptr<RtpPacketToSend> RtpPacketHistory::GetPacketAndMarkAsPending(
   return encapsulated_packet;
 }
 
+std::unique_ptr<RtpPacketToSend> RtpPacketHistory::GetRtxPacketAndMarkAsPending(
+    uint16_t sequence_number,
+    rtc::FunctionView<std::unique_ptr<RtpPacketToSend>(const RtpPacketToSend&)>
+        encapsulate,
+    rtc::FunctionView<bool(RtpPacketToSend*)> finalize) {
+  rtc::CritScope cs(&lock_);
+  if (mode_ == StorageMode::kDisabled) {
+    return nullptr;
+  }
+
+  StoredPacket* packet = GetStoredPacket(sequence_number);
+  if (packet == nullptr) {
+    return nullptr;
+  }
+
+  if (packet->pending_transmission_) {
+    // Packet already in pacer queue, ignore this request.
+    return nullptr;
+  }
+
+  if (!VerifyRtt(*packet, clock_->TimeInMilliseconds())) {
+    // Packet already resent within too short a time window, ignore.
+    return nullptr;
+  }
+
+  if (packet->cached_rtx_packet_ == nullptr) {
+    // First retransmission of this packet, build and cache the encapsulation.
+    packet->cached_rtx_packet_ = encapsulate(*packet->packet_);
+    if (packet->cached_rtx_packet_ == nullptr) {
+      return nullptr;
+    }
+    bytes_stored_ += packet->cached_rtx_packet_->capacity();
+  }
+
+  // The copy shares the payload buffer with the cached packet until
+  // |finalize| writes the per-transmission fields.
+  auto rtx_packet =
+      std::make_unique<RtpPacketToSend>(*packet->cached_rtx_packet_);
+  if (!finalize(rtx_packet.get())) {
+    return nullptr;
+  }
+  packet->pending_transmission_ = true;
+  return rtx_packet;
+}
+
 void RtpPacketHistory::MarkPacketAsSent(uint16_t sequence_number) {
   rtc::CritScope cs(&lock_);
   if (mode_ == StorageMode::kDisabled) {
@@ -269,11 +356,10 @@ absl::optional<RtpPacketHistory::PacketState> RtpPacketHistory::GetPacketState(
   }
 
   int packet_index = GetPacketIndex(sequence_number);
-  if (packet_index < 0 ||
-      static_cast<size_t>(packet_index) >= packet_history_.size()) {
+  if (packet_index < 0 || static_cast<size_t>(packet_index) >= history_size_) {
     return absl::nullopt;
   }
-  const StoredPacket& packet = packet_history_[packet_index];
+  const StoredPacket& packet = PacketAt(packet_index);
   if (packet.packet_ == nullptr) {
     return absl::nullopt;
   }
@@ -320,12 +406,11 @@ std::unique_ptr<RtpPacketToSend> RtpPacketHistory::GetPayloadPaddingPacket(
   if (enable_padding_prio_ && !padding_priority_.empty()) {
     auto best_packet_it = padding_priority_.begin();
     best_packet = *best_packet_it;
-  } else if (!enable_padding_prio_ && !packet_history_.empty()) {
+  } else if (!enable_padding_prio_ && history_size_ > 0) {
     // Prioritization not available, pick the last packet.
-    for (auto it = packet_history_.rbegin(); it != packet_history_.rend();
-         ++it) {
-      if (it->packet_ != nullptr) {
-        best_packet = &(*it);
+    for (int i = static_cast<int>(history_size_) - 1; i >= 0; --i) {
+      if (PacketAt(i).packet_ != nullptr) {
+        best_packet = &PacketAt(i);
         break;
       }
     }
@@ -361,7 +446,7 @@ void RtpPacketHistory::CullAcknowledgedPackets(
   for (uint16_t sequence_number : sequence_numbers) {
     int packet_index = GetPacketIndex(sequence_number);
     if (packet_index < 0 ||
-        static_cast<size_t>(packet_index) >= packet_history_.size()) {
+        static_cast<size_t>(packet_index) >= history_size_) {
       continue;
     }
     RemovePacket(packet_index);
@@ -388,23 +473,83 @@ void RtpPacketHistory::Clear() {
   Reset();
 }
 
+size_t RtpPacketHistory::UsedMemoryBytes() const {
+  rtc::CritScope cs(&lock_);
+  return bytes_stored_;
+}
+
+size_t RtpPacketHistory::TrimMemory(size_t bytes) {
+  rtc::CritScope cs(&lock_);
+  const size_t bytes_before = bytes_stored_;
+  int packet_index = 0;
+  while (bytes_before - bytes_stored_ < bytes &&
+         static_cast<size_t>(packet_index) < history_size_) {
+    const StoredPacket& stored_packet = PacketAt(packet_index);
+    if (stored_packet.packet_ == nullptr ||
+        stored_packet.pending_transmission_) {
+      // Holes hold no memory, and packets in the pacer queue must stay.
+      ++packet_index;
+      continue;
+    }
+    // Removing the front packet shrinks the window, so the same index then
+    // refers to the next packet; removing any other packet leaves a hole
+    // that the next iteration skips over.
+    RemovePacket(packet_index);
+  }
+  return bytes_before - bytes_stored_;
+}
+
+RtpPacketHistory::StoredPacket& RtpPacketHistory::PacketAt(int packet_index) {
+  RTC_DCHECK_GE(packet_index, 0);
+  RTC_DCHECK_LT(static_cast<size_t>(packet_index), history_size_);
+  return packet_ring_[(front_slot_ + packet_index) & ring_mask_];
+}
+
+const RtpPacketHistory::StoredPacket& RtpPacketHistory::PacketAt(
+    int packet_index) const {
+  RTC_DCHECK_GE(packet_index, 0);
+  RTC_DCHECK_LT(static_cast<size_t>(packet_index), history_size_);
+  return packet_ring_[(front_slot_ + packet_index) & ring_mask_];
+}
+
 void RtpPacketHistory::Reset() {
-  packet_history_.clear();
   padding_priority_.clear();
+  if (packet_pool_) {
+    for (StoredPacket& stored_packet : packet_ring_) {
+      packet_pool_->ReleaseSendPacket(std::move(stored_packet.packet_));
+      packet_pool_->ReleaseSendPacket(
+          std::move(stored_packet.cached_rtx_packet_));
+    }
+  }
+  packet_ring_.clear();
+  if (number_to_store_ > 0) {
+    // Round the configured size up to a power of two so that a sequence
+    // number maps to a ring slot with a mask instead of a modulo.
+    size_t ring_size = 1;
+    while (ring_size < number_to_store_) {
+      ring_size <<= 1;
+    }
+    packet_ring_.resize(ring_size);
+  }
+  ring_mask_ = packet_ring_.empty() ? 0 : packet_ring_.size() - 1;
+  front_slot_ = 0;
+  history_size_ = 0;
+  front_seq_no_ = 0;
+  bytes_stored_ = 0;
 }
 
 void RtpPacketHistory::CullOldPackets(int64_t now_ms) {
   int64_t packet_duration_ms =
       std::max(kMinPacketDurationRtt * rtt_ms_, kMinPacketDurationMs);
-  while (!packet_history_.empty()) {
-    if (packet_history_.size() >= kMaxCapacity) {
+  while (history_size_ > 0) {
+    if (history_size_ >= kMaxCapacity) {
       // We have reached the absolute max capacity, remove one packet
       // unconditionally.
       RemovePacket(0);
       continue;
     }
 
-    const StoredPacket& stored_packet = packet_history_.front();
+    const StoredPacket& stored_packet = PacketAt(0);
     if (stored_packet.pending_transmission_) {
       // Don't remove packets in the pacer queue, pending tranmission.
       return;
@@ -415,7 +560,7 @@ void RtpPacketHistory::CullOldPackets(int64_t now_ms) {
       return;
     }
 
-    if (packet_history_.size() >= number_to_store_ ||
+    if (history_size_ >= number_to_store_ ||
         *stored_packet.send_time_ms_ +
                 (packet_duration_ms * kPacketCullingDelayFactor) <=
             now_ms) {
@@ -429,34 +574,48 @@ void RtpPacketHistory::CullOldPackets(int64_t now_ms) {
   }
 }
 
-std::unique_ptr<RtpPacketToSend> RtpPacketHistory::RemovePacket(
-    int packet_index) {
-  // Move the packet out from the StoredPacket container.
-  std::unique_ptr<RtpPacketToSend> rtp_packet =
-      std::move(packet_history_[packet_index].packet_);
-
-  // Erase from padding priority set, if eligible.
+void RtpPacketHistory::RemovePacket(int packet_index) {
+  // Erase from padding priority set, if eligible. Must happen before the
+  // packet is moved out, since the set comparator inspects the packet.
   if (enable_padding_prio_) {
-    padding_priority_.erase(&packet_history_[packet_index]);
+    padding_priority_.erase(&PacketAt(packet_index));
+  }
+
+  // Move the packet, and any cached RTX encapsulation of it, out from the
+  // StoredPacket container. The history is where stored packets end their
+  // life, so hand them back to the pool for reuse when one is attached.
+  std::unique_ptr<RtpPacketToSend> rtp_packet =
+      std::move(PacketAt(packet_index).packet_);
+  std::unique_ptr<RtpPacketToSend> rtx_packet =
+      std::move(PacketAt(packet_index).cached_rtx_packet_);
+  if (rtp_packet)
+    bytes_stored_ -= rtp_packet->capacity();
+  if (rtx_packet)
+    bytes_stored_ -= rtx_packet->capacity();
+  if (packet_pool_) {
+    packet_pool_->ReleaseSendPacket(std::move(rtp_packet));
+    packet_pool_->ReleaseSendPacket(std::move(rtx_packet));
   }
 
   if (packet_index == 0) {
-    while (!packet_history_.empty() &&
-           packet_history_.front().packet_ == nullptr) {
-      packet_history_.pop_front();
+    // Shrink the window from the front, evicting the removed packet and any
+    // holes that follow it.
+    while (history_size_ > 0 && PacketAt(0).packet_ == nullptr) {
+      front_slot_ = (front_slot_ + 1) & ring_mask_;
+      ++front_seq_no_;
+      --history_size_;
     }
   }
-
-  return rtp_packet;
 }
 
 int RtpPacketHistory::GetPacketIndex(uint16_t sequence_number) const {
-  if (packet_history_.empty()) {
+  if (history_size_ == 0) {
     return 0;
   }
 
-  RTC_DCHECK(packet_history_.front().packet_ != nullptr);
-  int first_seq = packet_history_.front().packet_->SequenceNumber();
+  RTC_DCHECK(PacketAt(0).packet_ != nullptr);
+  RTC_DCHECK_EQ(PacketAt(0).packet_->SequenceNumber(), front_seq_no_);
+  int first_seq = front_seq_no_;
   if (first_seq == sequence_number) {
     return 0;
   }
@@ -480,11 +639,11 @@ int RtpPacketHistory::GetPacketIndex(uint16_t sequence_number) const {
 RtpPacketHistory::StoredPacket* RtpPacketHistory::GetStoredPacket(
     uint16_t sequence_number) {
   int index = GetPacketIndex(sequence_number);
-  if (index < 0 || static_cast<size_t>(index) >= packet_history_.size() ||
-      packet_history_[index].packet_ == nullptr) {
+  if (index < 0 || static_cast<size_t>(index) >= history_size_ ||
+      PacketAt(index).packet_ == nullptr) {
     return nullptr;
   }
-  return &packet_history_[index];
+  return &PacketAt(index);
 }
 
 RtpPacketHistory::PacketState RtpPacketHistory::StoredPacketToPacketState(
@@ -11,8 +11,6 @@
 #ifndef MODULES_RTP_RTCP_SOURCE_RTP_PACKET_HISTORY_H_
 #define MODULES_RTP_RTCP_SOURCE_RTP_PACKET_HISTORY_H_
 
-#include <deque>
-#include <map>
 #include <memory>
 #include <set>
 #include <vector>
@@ -26,6 +24,7 @@
 namespace webrtc {
 
 class Clock;
+class RtpPacketPool;
 class RtpPacketToSend;
 
 class RtpPacketHistory {
@@ -65,6 +64,12 @@ class RtpPacketHistory {
   RtpPacketHistory(Clock* clock, bool enable_padding_prio);
   ~RtpPacketHistory();
 
+  // Attach a packet pool that culled packets are handed back to for reuse
+  // instead of being deleted; the pool is where RTPSender::AllocatePacket()
+  // acquires new packets from, closing the recycle loop. |packet_pool| must
+  // outlive this history. May be null to detach.
+  void SetPacketPool(RtpPacketPool* packet_pool);
+
   // Set/get storage mode. Note that setting the state will clear the history,
   // even if setting the same state as is currently used.
   void SetStorePacketsStatus(StorageMode mode, size_t number_to_store);
@@ -101,6 +106,19 @@ class RtpPacketHistory {
       rtc::FunctionView<std::unique_ptr<RtpPacketToSend>(
           const RtpPacketToSend&)> encapsulate);
 
+  // Like GetPacketAndMarkAsPending() with an encapsulating function, but
+  // caches the encapsulated packet on the first call so that subsequent
+  // retransmissions of the same packet reuse the preserialized bytes;
+  // |encapsulate| is only invoked on a cache miss. |finalize| is invoked on
+  // every returned copy to stamp per-transmission fields such as the RTX
+  // sequence number; returning false aborts the retransmission and the
+  // packet is not marked as pending.
+  std::unique_ptr<RtpPacketToSend> GetRtxPacketAndMarkAsPending(
+      uint16_t sequence_number,
+      rtc::FunctionView<std::unique_ptr<RtpPacketToSend>(
+          const RtpPacketToSend&)> encapsulate,
+      rtc::FunctionView<bool(RtpPacketToSend*)> finalize);
+
   // Updates the send time for the given packet and increments the transmission
   // counter. Marks the packet as no longer being in the pacer queue.
   void MarkPacketAsSent(uint16_t sequence_number);
@@ -135,6 +153,16 @@ class RtpPacketHistory {
   // capacity.
   void Clear();
 
+  // Approximate number of heap bytes held by the stored packets, including
+  // cached RTX encapsulations.
+  size_t UsedMemoryBytes() const;
+
+  // Releases up to |bytes| bytes under memory pressure by removing stored
+  // packets, oldest first. Packets pending transmission in the pacer queue
+  // are kept. Returns the number of bytes released; removed packets can no
+  // longer be retransmitted or used as payload padding.
+  size_t TrimMemory(size_t bytes);
+
  private:
   struct MoreUseful;
   class StoredPacket;
@@ -142,6 +170,7 @@ class RtpPacketHistory {
 
   class StoredPacket {
    public:
+    StoredPacket();
     StoredPacket(std::unique_ptr<RtpPacketToSend> packet,
                  absl::optional<int64_t> send_time_ms,
                  uint64_t insert_order);
@@ -159,6 +188,11 @@ class RtpPacketHistory {
     // The actual packet.
     std::unique_ptr<RtpPacketToSend> packet_;
 
+    // Prebuilt encapsulation (RTX) of |packet_|, created on the first
+    // retransmission through GetRtxPacketAndMarkAsPending() and reused,
+    // modulo per-transmission fields, for subsequent ones.
+    std::unique_ptr<RtpPacketToSend> cached_rtx_packet_;
+
     // True if the packet is currently in the pacer queue pending transmission.
     bool pending_transmission_;
 
@@ -178,12 +212,18 @@ class RtpPacketHistory {
   // check if packet has too recently been sent.
   bool VerifyRtt(const StoredPacket& packet, int64_t now_ms) const
       RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // Accessors for the entry at the given index relative to the front of the
+  // stored window.
+  StoredPacket& PacketAt(int packet_index)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  const StoredPacket& PacketAt(int packet_index) const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
   void Reset() RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
   void CullOldPackets(int64_t now_ms) RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
   // Removes the packet from the history, and context/mapping that has been
-  // stored. Returns the RTP packet instance contained within the StoredPacket.
-  std::unique_ptr<RtpPacketToSend> RemovePacket(int packet_index)
-      RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+  // stored. The RTP packet instance contained within the StoredPacket is
+  // handed back to |packet_pool_| for reuse, when one is attached.
+  void RemovePacket(int packet_index) RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
   int GetPacketIndex(uint16_t sequence_number) const
       RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
   StoredPacket* GetStoredPacket(uint16_t sequence_number)
@@ -194,20 +234,33 @@ class RtpPacketHistory {
   Clock* const clock_;
   const bool enable_padding_prio_;
   rtc::CriticalSection lock_;
+  RtpPacketPool* packet_pool_ RTC_GUARDED_BY(lock_);
   size_t number_to_store_ RTC_GUARDED_BY(lock_);
   StorageMode mode_ RTC_GUARDED_BY(lock_);
   int64_t rtt_ms_ RTC_GUARDED_BY(lock_);
 
-  // Queue of stored packets, ordered by sequence number, with older packets in
-  // the front and new packets being added to the back. Note that there may be
-  // wrap-arounds so the back may have a lower sequence number.
+  // Fixed power-of-two ring of stored packets, sized from |number_to_store_|
+  // when the storage mode is set. Entries are addressed by sequence number
+  // relative to |front_seq_no_|, which is the sequence number of the logical
+  // index 0 stored in slot |front_slot_|. The window holds |history_size_|
+  // consecutive sequence numbers, older packets at the front and new packets
+  // being added to the back. Note that there may be wrap-arounds so the back
+  // may have a lower sequence number.
   // Packets may also be removed out-of-order, in which case there will be
-  // instances of StoredPacket with |packet_| set to nullptr. The first and last
-  // entry in the queue will however always be populated.
-  std::deque<StoredPacket> packet_history_ RTC_GUARDED_BY(lock_);
+  // instances of StoredPacket with |packet_| set to nullptr. Slot contents
+  // are stable for the lifetime of an entry, so the padding priority set can
+  // hold raw pointers into the ring.
+  std::vector<StoredPacket> packet_ring_ RTC_GUARDED_BY(lock_);
+  size_t ring_mask_ RTC_GUARDED_BY(lock_);   // |packet_ring_|.size() - 1.
+  size_t front_slot_ RTC_GUARDED_BY(lock_);  // Ring slot of logical index 0.
+  size_t history_size_ RTC_GUARDED_BY(lock_);  // Window span, incl. holes.
+  uint16_t front_seq_no_ RTC_GUARDED_BY(lock_);
 
   // Total number of packets with inserted.
   uint64_t packets_inserted_ RTC_GUARDED_BY(lock_);
+  // Sum of the buffer capacities of the stored packets and their cached RTX
+  // encapsulations, maintained on insertion and removal.
+  size_t bytes_stored_ RTC_GUARDED_BY(lock_);
   // Objects from |packet_history_| ordered by "most likely to be useful", used
   // in GetPayloadPaddingPacket().
   PacketPrioritySet padding_priority_ RTC_GUARDED_BY(lock_);
@@ -14,6 +14,7 @@
 #include <utility>
 
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
+#include "modules/rtp_rtcp/source/rtp_packet_pool.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 #include "system_wrappers/include/clock.h"
 #include "test/gmock.h"
@@ -631,6 +632,65 @@ TEST_P(RtpPacketHistoryTest, GetPacketWithEncapsulationAbortOnNullptr) {
   EXPECT_TRUE(hist_.GetPacketAndMarkAsPending(kStartSeqNum));
 }
 
+TEST_P(RtpPacketHistoryTest, RtxEncapsulationIsCachedAcrossRetransmissions) {
+  const int64_t kRttMs = 10;
+  hist_.SetRtt(kRttMs);
+  hist_.SetStorePacketsStatus(StorageMode::kStoreAndCull, 1);
+
+  hist_.PutRtpPacket(CreateRtpPacket(kStartSeqNum),
+                     fake_clock_.TimeInMicroseconds());
+
+  int encapsulations = 0;
+  uint16_t rtx_sequence_number = 1234;
+  auto encapsulate = [&](const RtpPacketToSend& packet) {
+    ++encapsulations;
+    return std::make_unique<RtpPacketToSend>(packet);
+  };
+  auto finalize = [&](RtpPacketToSend* rtx_packet) {
+    rtx_packet->SetSequenceNumber(rtx_sequence_number++);
+    return true;
+  };
+
+  std::unique_ptr<RtpPacketToSend> first_retransmission =
+      hist_.GetRtxPacketAndMarkAsPending(kStartSeqNum, encapsulate, finalize);
+  ASSERT_TRUE(first_retransmission);
+  EXPECT_EQ(1234, first_retransmission->SequenceNumber());
+
+  // Second retransmission reuses the cached encapsulation but gets a fresh
+  // sequence number.
+  hist_.MarkPacketAsSent(kStartSeqNum);
+  fake_clock_.AdvanceTimeMilliseconds(RtpPacketHistory::kMinPacketDurationMs);
+  std::unique_ptr<RtpPacketToSend> second_retransmission =
+      hist_.GetRtxPacketAndMarkAsPending(kStartSeqNum, encapsulate, finalize);
+  ASSERT_TRUE(second_retransmission);
+  EXPECT_EQ(1, encapsulations);
+  EXPECT_EQ(1235, second_retransmission->SequenceNumber());
+}
+
+TEST_P(RtpPacketHistoryTest, RtxRetransmissionAbortedOnFinalizeFailure) {
+  hist_.SetStorePacketsStatus(StorageMode::kStoreAndCull, 1);
+
+  hist_.PutRtpPacket(CreateRtpPacket(kStartSeqNum),
+                     fake_clock_.TimeInMicroseconds());
+
+  // The finalizer rejects the retransmission (rate limit exhausted?), so the
+  // packet must not be marked as pending.
+  EXPECT_FALSE(hist_.GetRtxPacketAndMarkAsPending(
+      kStartSeqNum,
+      [](const RtpPacketToSend& packet) {
+        return std::make_unique<RtpPacketToSend>(packet);
+      },
+      [](RtpPacketToSend*) { return false; }));
+
+  // New try, this time allowing the retransmission.
+  EXPECT_TRUE(hist_.GetRtxPacketAndMarkAsPending(
+      kStartSeqNum,
+      [](const RtpPacketToSend& packet) {
+        return std::make_unique<RtpPacketToSend>(packet);
+      },
+      [](RtpPacketToSend*) { return true; }));
+}
+
 TEST_P(RtpPacketHistoryTest, DontRemovePendingTransmissions) {
   const int64_t kRttMs = RtpPacketHistory::kMinPacketDurationMs * 2;
   const int64_t kPacketTimeoutMs =
@@ -835,6 +895,50 @@ TEST_P(RtpPacketHistoryTest, UsesLastPacketAsPaddingWithPrioOff) {
   EXPECT_EQ(hist_.GetPayloadPaddingPacket(), nullptr);
 }
 
+TEST_P(RtpPacketHistoryTest, TracksAndTrimsMemoryUsage) {
+  hist_.SetStorePacketsStatus(StorageMode::kStoreAndCull, 10);
+  EXPECT_EQ(hist_.UsedMemoryBytes(), 0u);
+
+  hist_.PutRtpPacket(CreateRtpPacket(kStartSeqNum),
+                     fake_clock_.TimeInMilliseconds());
+  hist_.PutRtpPacket(CreateRtpPacket(To16u(kStartSeqNum + 1)),
+                     fake_clock_.TimeInMilliseconds());
+  const size_t usage = hist_.UsedMemoryBytes();
+  EXPECT_GT(usage, 0u);
+
+  // Trimming removes whole packets, oldest first.
+  const size_t released = hist_.TrimMemory(1);
+  EXPECT_GT(released, 0u);
+  EXPECT_EQ(hist_.UsedMemoryBytes(), usage - released);
+  EXPECT_FALSE(hist_.GetPacketState(kStartSeqNum).has_value());
+  EXPECT_TRUE(hist_.GetPacketState(To16u(kStartSeqNum + 1)).has_value());
+
+  EXPECT_EQ(hist_.TrimMemory(usage), usage - released);
+  EXPECT_EQ(hist_.UsedMemoryBytes(), 0u);
+}
+
+TEST_P(RtpPacketHistoryTest, CulledPacketsAreReleasedToPacketPool) {
+  RtpPacketPool packet_pool;
+  hist_.SetPacketPool(&packet_pool);
+  hist_.SetStorePacketsStatus(StorageMode::kStoreAndCull, 10);
+
+  hist_.PutRtpPacket(CreateRtpPacket(kStartSeqNum),
+                     fake_clock_.TimeInMilliseconds());
+  hist_.PutRtpPacket(CreateRtpPacket(To16u(kStartSeqNum + 1)),
+                     fake_clock_.TimeInMilliseconds());
+  EXPECT_EQ(packet_pool.PooledPacketCount(), 0u);
+
+  // An acknowledged packet is culled from the history and handed back to the
+  // pool rather than deleted.
+  hist_.CullAcknowledgedPackets(std::vector<uint16_t>{kStartSeqNum});
+  EXPECT_EQ(packet_pool.PooledPacketCount(), 1u);
+  EXPECT_FALSE(hist_.GetPacketState(kStartSeqNum).has_value());
+
+  // Clearing the history recycles all remaining packets.
+  hist_.Clear();
+  EXPECT_EQ(packet_pool.PooledPacketCount(), 2u);
+}
+
 INSTANTIATE_TEST_SUITE_P(WithAndWithoutPaddingPrio,
                          RtpPacketHistoryTest,
                          ::testing::Bool());
@@ -0,0 +1,59 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/rtp_packet_pool.h"
+
+#include <utility>
+
+namespace webrtc {
+
+constexpr size_t RtpPacketPool::kDefaultMaxPooledPackets;
+
+RtpPacketPool::RtpPacketPool(size_t max_pooled_packets)
+    : max_pooled_packets_(max_pooled_packets) {}
+
+RtpPacketPool::~RtpPacketPool() = default;
+
+std::unique_ptr<RtpPacketToSend> RtpPacketPool::AcquireSendPacket(
+    const RtpHeaderExtensionMap* extensions,
+    size_t capacity) {
+  {
+    rtc::CritScope lock(&lock_);
+    while (!send_packets_.empty()) {
+      std::unique_ptr<RtpPacketToSend> packet =
+          std::move(send_packets_.back());
+      send_packets_.pop_back();
+      // Packets pooled with a smaller buffer than the caller needs are not
+      // useful for reuse; drop them instead of growing the buffer.
+      if (packet->capacity() < capacity)
+        continue;
+      packet->ClearForReuse();
+      if (extensions)
+        packet->IdentifyExtensions(*extensions);
+      return packet;
+    }
+  }
+  return std::make_unique<RtpPacketToSend>(extensions, capacity);
+}
+
+void RtpPacketPool::ReleaseSendPacket(std::unique_ptr<RtpPacketToSend> packet) {
+  if (!packet)
+    return;
+  rtc::CritScope lock(&lock_);
+  if (send_packets_.size() < max_pooled_packets_)
+    send_packets_.push_back(std::move(packet));
+}
+
+size_t RtpPacketPool::PooledPacketCount() const {
+  rtc::CritScope lock(&lock_);
+  return send_packets_.size();
+}
+
+}  // namespace webrtc
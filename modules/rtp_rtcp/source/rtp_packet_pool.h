@@ -0,0 +1,68 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef MODULES_RTP_RTCP_SOURCE_RTP_PACKET_POOL_H_
+#define MODULES_RTP_RTCP_SOURCE_RTP_PACKET_POOL_H_
+
+#include <stddef.h>
+
+#include <memory>
+#include <vector>
+
+#include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
+#include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Thread-safe freelist of send-side RTP packet objects. Recycling the packets,
+// and in particular the CopyOnWriteBuffers backing them, avoids one
+// malloc/free pair per packet on the send hot path. Packets are acquired by
+// RTPSender::AllocatePacket() and handed back by RtpPacketHistory when a
+// stored packet is culled, so in steady state media packets cycle between the
+// sender and the history through the pool. A pool instance can be shared
+// between several RtpRtcp modules via RtpRtcp::Configuration::packet_pool;
+// acquire and release may be called from any thread.
+class RtpPacketPool {
+ public:
+  static constexpr size_t kDefaultMaxPooledPackets = 256;
+
+  explicit RtpPacketPool(size_t max_pooled_packets = kDefaultMaxPooledPackets);
+  ~RtpPacketPool();
+
+  RtpPacketPool(const RtpPacketPool&) = delete;
+  RtpPacketPool& operator=(const RtpPacketPool&) = delete;
+
+  // Returns a cleared packet with at least |capacity| bytes of backing buffer
+  // and extensions identified by |extensions|. Falls back to a heap allocation
+  // when the freelist is empty, so callers never observe failure.
+  std::unique_ptr<RtpPacketToSend> AcquireSendPacket(
+      const RtpHeaderExtensionMap* extensions,
+      size_t capacity);
+
+  // Hands a packet back to the pool. If the pool is at capacity the packet is
+  // simply deleted. The packet's backing buffer may still be shared with
+  // copies in flight; in that case CopyOnWriteBuffer reallocates on the first
+  // write after reuse and correctness is unaffected.
+  void ReleaseSendPacket(std::unique_ptr<RtpPacketToSend> packet);
+
+  // Number of packets currently parked in the freelist, for tests and stats.
+  size_t PooledPacketCount() const;
+
+ private:
+  const size_t max_pooled_packets_;
+  rtc::CriticalSection lock_;
+  std::vector<std::unique_ptr<RtpPacketToSend>> send_packets_
+      RTC_GUARDED_BY(lock_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_RTP_RTCP_SOURCE_RTP_PACKET_POOL_H_
@@ -0,0 +1,84 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/rtp_rtcp/source/rtp_packet_pool.h"
+
+#include <memory>
+#include <utility>
+
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr size_t kCapacity = 1500;
+
+TEST(RtpPacketPoolTest, AcquireFromEmptyPoolAllocates) {
+  RtpPacketPool pool;
+  std::unique_ptr<RtpPacketToSend> packet =
+      pool.AcquireSendPacket(nullptr, kCapacity);
+  ASSERT_TRUE(packet);
+  EXPECT_GE(packet->capacity(), kCapacity);
+  EXPECT_EQ(pool.PooledPacketCount(), 0u);
+}
+
+TEST(RtpPacketPoolTest, ReleasedPacketIsReused) {
+  RtpPacketPool pool;
+  std::unique_ptr<RtpPacketToSend> packet =
+      pool.AcquireSendPacket(nullptr, kCapacity);
+  RtpPacketToSend* raw = packet.get();
+  pool.ReleaseSendPacket(std::move(packet));
+  EXPECT_EQ(pool.PooledPacketCount(), 1u);
+
+  std::unique_ptr<RtpPacketToSend> reused =
+      pool.AcquireSendPacket(nullptr, kCapacity);
+  EXPECT_EQ(reused.get(), raw);
+  EXPECT_EQ(pool.PooledPacketCount(), 0u);
+}
+
+TEST(RtpPacketPoolTest, ReusedPacketIsCleared) {
+  RtpPacketPool pool;
+  std::unique_ptr<RtpPacketToSend> packet =
+      pool.AcquireSendPacket(nullptr, kCapacity);
+  packet->SetSequenceNumber(1234);
+  packet->SetSsrc(0xabcd);
+  packet->set_capture_time_ms(5678);
+  packet->set_packet_type(RtpPacketMediaType::kVideo);
+  pool.ReleaseSendPacket(std::move(packet));
+
+  std::unique_ptr<RtpPacketToSend> reused =
+      pool.AcquireSendPacket(nullptr, kCapacity);
+  EXPECT_EQ(reused->SequenceNumber(), 0u);
+  EXPECT_EQ(reused->Ssrc(), 0u);
+  EXPECT_EQ(reused->capture_time_ms(), 0);
+  EXPECT_FALSE(reused->packet_type().has_value());
+}
+
+TEST(RtpPacketPoolTest, TooSmallPooledPacketIsDropped) {
+  RtpPacketPool pool;
+  pool.ReleaseSendPacket(
+      std::make_unique<RtpPacketToSend>(nullptr, kCapacity / 2));
+  std::unique_ptr<RtpPacketToSend> packet =
+      pool.AcquireSendPacket(nullptr, kCapacity);
+  EXPECT_GE(packet->capacity(), kCapacity);
+  EXPECT_EQ(pool.PooledPacketCount(), 0u);
+}
+
+TEST(RtpPacketPoolTest, PoolSizeIsBounded) {
+  RtpPacketPool pool(/*max_pooled_packets=*/2);
+  for (int i = 0; i < 4; ++i) {
+    pool.ReleaseSendPacket(
+        std::make_unique<RtpPacketToSend>(nullptr, kCapacity));
+  }
+  EXPECT_EQ(pool.PooledPacketCount(), 2u);
+}
+
+}  // namespace
+}  // namespace webrtc
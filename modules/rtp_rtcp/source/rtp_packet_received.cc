@@ -33,7 +33,7 @@ RtpPacketReceived& RtpPacketReceived::operator=(RtpPacketReceived&& packet) =
 
 RtpPacketReceived::~RtpPacketReceived() {}
 
-void RtpPacketReceived::GetHeader(RTPHeader* header) const {
+void RtpPacketReceived::GetBweHeader(RTPHeader* header) const {
   header->markerBit = Marker();
   header->payloadType = PayloadType();
   header->sequenceNumber = SequenceNumber();
@@ -52,14 +52,18 @@ void RtpPacketReceived::GetHeader(RTPHeader* header) const {
           &header->extension.transmissionTimeOffset);
   header->extension.hasAbsoluteSendTime =
       GetExtension<AbsoluteSendTime>(&header->extension.absoluteSendTime);
-  header->extension.absolute_capture_time =
-      GetExtension<AbsoluteCaptureTimeExtension>();
   header->extension.hasTransportSequenceNumber =
       GetExtension<TransportSequenceNumberV2>(
           &header->extension.transportSequenceNumber,
           &header->extension.feedback_request) ||
       GetExtension<TransportSequenceNumber>(
           &header->extension.transportSequenceNumber);
+}
+
+void RtpPacketReceived::GetHeader(RTPHeader* header) const {
+  GetBweHeader(header);
+  header->extension.absolute_capture_time =
+      GetExtension<AbsoluteCaptureTimeExtension>();
   header->extension.hasAudioLevel = GetExtension<AudioLevel>(
       &header->extension.voiceActivity, &header->extension.audioLevel);
   header->extension.hasVideoRotation =
@@ -37,6 +37,14 @@ class RtpPacketReceived : public RtpPacket {
   // directly. Function is there just for easier backward compatibilty.
   void GetHeader(RTPHeader* header) const;
 
+  // Like GetHeader(), but only converts the fixed header fields and the
+  // extensions bandwidth estimation reads (transmission offset, absolute
+  // send time and transport sequence number), leaving the media extensions
+  // at their defaults. Packets are already parsed into this class on
+  // reception; this keeps per-packet consumers that only feed the receive
+  // side congestion controller from paying for a full RTPHeader conversion.
+  void GetBweHeader(RTPHeader* header) const;
+
   // Time in local time base as close as it can to packet arrived on the
   // network.
   int64_t arrival_time_ms() const { return arrival_time_ms_; }
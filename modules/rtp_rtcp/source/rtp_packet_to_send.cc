@@ -28,4 +28,15 @@ RtpPacketToSend& RtpPacketToSend::operator=(RtpPacketToSend&& packet) = default;
 
 RtpPacketToSend::~RtpPacketToSend() = default;
 
+void RtpPacketToSend::ClearForReuse() {
+  Clear();
+  capture_time_ms_ = 0;
+  packet_type_.reset();
+  allow_retransmission_ = false;
+  retransmitted_sequence_number_.reset();
+  application_data_.clear();
+  is_first_packet_of_frame_ = false;
+  is_key_frame_ = false;
+}
+
 }  // namespace webrtc
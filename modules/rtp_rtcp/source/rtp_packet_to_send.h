@@ -108,6 +108,10 @@ class RtpPacketToSend : public RtpPacket {
   void set_is_key_frame(bool is_key_frame) { is_key_frame_ = is_key_frame; }
   bool is_key_frame() const { return is_key_frame_; }
 
+  // Resets both the rtp packet contents and the send-side metadata, keeping
+  // the backing buffer, so that the object can be recycled by RtpPacketPool.
+  void ClearForReuse();
+
  private:
   int64_t capture_time_ms_ = 0;
   absl::optional<RtpPacketMediaType> packet_type_;
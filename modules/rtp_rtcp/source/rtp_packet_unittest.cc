@@ -223,6 +223,29 @@ TEST(RtpPacketTest, CreateWithExtension) {
   EXPECT_THAT(kPacketWithTO, ElementsAreArray(packet.data(), packet.size()));
 }
 
+TEST(RtpPacketTest, CreateWithStampedHeader) {
+  RtpPacketToSend::ExtensionManager extensions;
+  extensions.Register<TransmissionOffset>(kTransmissionOffsetExtensionId);
+  RtpPacketToSend header_template(&extensions);
+  header_template.SetPayloadType(kPayloadType);
+  header_template.SetSequenceNumber(kSeqNum);
+  header_template.SetTimestamp(kTimestamp);
+  header_template.SetSsrc(kSsrc);
+  header_template.SetExtension<TransmissionOffset>(kTimeOffset);
+
+  RtpPacketToSend packet(&extensions);
+  const size_t capacity_before = packet.capacity();
+  packet.StampHeaderFrom(header_template);
+  EXPECT_THAT(kPacketWithTO, ElementsAreArray(packet.data(), packet.size()));
+  // Unlike CopyHeaderFrom, the stamped packet keeps its own buffer and full
+  // capacity, so modifying it leaves the template untouched.
+  EXPECT_EQ(capacity_before, packet.capacity());
+  packet.SetSequenceNumber(kSeqNum + 1);
+  EXPECT_EQ(kSeqNum, header_template.SequenceNumber());
+  EXPECT_THAT(kPacketWithTO, ElementsAreArray(header_template.data(),
+                                              header_template.size()));
+}
+
 TEST(RtpPacketTest, CreateWith2Extensions) {
   RtpPacketToSend::ExtensionManager extensions;
   extensions.Register<TransmissionOffset>(kTransmissionOffsetExtensionId);
@@ -46,7 +46,11 @@ ModuleRtpRtcpImpl::RtpSenderContext::RtpSenderContext(
       packet_generator(
           config,
           &packet_history,
-          config.paced_sender ? config.paced_sender : &non_paced_sender) {}
+          config.paced_sender ? config.paced_sender : &non_paced_sender) {
+  // The history is where stored send packets end their life; recycle them
+  // through the pool that AllocatePacket() draws from.
+  packet_history.SetPacketPool(config.packet_pool);
+}
 
 ModuleRtpRtcpImpl::ModuleRtpRtcpImpl(const Configuration& configuration)
     : rtcp_sender_(configuration),
@@ -90,7 +94,12 @@ void ModuleRtpRtcpImpl::Process() {
   const int64_t now = clock_->TimeInMilliseconds();
   // TODO(bugs.webrtc.org/11581): Figure out why we need to call Process() 200
   // times a second.
-  next_process_time_ = now + kRtpRtcpMaxIdleTimeProcessMs;
+  // Align the next tick to a wall-clock multiple of the process interval, so
+  // that every ModuleRtpRtcpImpl registered with the same process thread
+  // comes due in one wakeup and is serviced in the same pass, rather than
+  // each instance waking the thread at its own registration phase.
+  next_process_time_ = now + kRtpRtcpMaxIdleTimeProcessMs -
+                       (now % kRtpRtcpMaxIdleTimeProcessMs);
 
   if (rtp_sender_) {
     if (now >= last_bitrate_process_time_ + kRtpRtcpBitrateProcessTimeMs) {
@@ -689,6 +698,14 @@ bool ModuleRtpRtcpImpl::StorePackets() const {
          RtpPacketHistory::StorageMode::kDisabled;
 }
 
+size_t ModuleRtpRtcpImpl::PacketHistoryMemoryUsage() const {
+  return rtp_sender_ ? rtp_sender_->packet_history.UsedMemoryBytes() : 0;
+}
+
+size_t ModuleRtpRtcpImpl::TrimPacketHistory(size_t bytes) {
+  return rtp_sender_ ? rtp_sender_->packet_history.TrimMemory(bytes) : 0;
+}
+
 void ModuleRtpRtcpImpl::SendCombinedRtcpPacket(
     std::vector<std::unique_ptr<rtcp::RtcpPacket>> rtcp_packets) {
   rtcp_sender_.SendCombinedRtcpPacket(std::move(rtcp_packets));
@@ -786,18 +803,14 @@ bool ModuleRtpRtcpImpl::LastReceivedNTP(
 }
 
 void ModuleRtpRtcpImpl::set_rtt_ms(int64_t rtt_ms) {
-  {
-    rtc::CritScope cs(&critical_section_rtt_);
-    rtt_ms_ = rtt_ms;
-  }
+  rtt_ms_.store(rtt_ms, std::memory_order_relaxed);
   if (rtp_sender_) {
     rtp_sender_->packet_history.SetRtt(rtt_ms);
   }
 }
 
 int64_t ModuleRtpRtcpImpl::rtt_ms() const {
-  rtc::CritScope cs(&critical_section_rtt_);
-  return rtt_ms_;
+  return rtt_ms_.load(std::memory_order_relaxed);
 }
 
 void ModuleRtpRtcpImpl::SetVideoBitrateAllocation(
@@ -699,6 +699,14 @@ bool ModuleRtpRtcpImpl2::StorePackets() const {
          RtpPacketHistory::StorageMode::kDisabled;
 }
 
+size_t ModuleRtpRtcpImpl2::PacketHistoryMemoryUsage() const {
+  return rtp_sender_ ? rtp_sender_->packet_history.UsedMemoryBytes() : 0;
+}
+
+size_t ModuleRtpRtcpImpl2::TrimPacketHistory(size_t bytes) {
+  return rtp_sender_ ? rtp_sender_->packet_history.TrimMemory(bytes) : 0;
+}
+
 void ModuleRtpRtcpImpl2::SendCombinedRtcpPacket(
     std::vector<std::unique_ptr<rtcp::RtcpPacket>> rtcp_packets) {
   rtcp_sender_.SendCombinedRtcpPacket(std::move(rtcp_packets));
@@ -796,18 +804,14 @@ bool ModuleRtpRtcpImpl2::LastReceivedNTP(
 }
 
 void ModuleRtpRtcpImpl2::set_rtt_ms(int64_t rtt_ms) {
-  {
-    rtc::CritScope cs(&critical_section_rtt_);
-    rtt_ms_ = rtt_ms;
-  }
+  rtt_ms_.store(rtt_ms, std::memory_order_relaxed);
   if (rtp_sender_) {
     rtp_sender_->packet_history.SetRtt(rtt_ms);
   }
 }
 
 int64_t ModuleRtpRtcpImpl2::rtt_ms() const {
-  rtc::CritScope cs(&critical_section_rtt_);
-  return rtt_ms_;
+  return rtt_ms_.load(std::memory_order_relaxed);
 }
 
 void ModuleRtpRtcpImpl2::SetVideoBitrateAllocation(
@@ -14,6 +14,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <set>
 #include <string>
@@ -33,7 +34,6 @@
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 #include "modules/rtp_rtcp/source/rtp_sender.h"
 #include "modules/rtp_rtcp/source/rtp_sender_egress.h"
-#include "rtc_base/critical_section.h"
 #include "rtc_base/gtest_prod_util.h"
 #include "rtc_base/synchronization/sequence_checker.h"
 
@@ -235,6 +235,10 @@ class ModuleRtpRtcpImpl2 final : public RtpRtcp,
 
   bool StorePackets() const override;
 
+  size_t PacketHistoryMemoryUsage() const override;
+
+  size_t TrimPacketHistory(size_t bytes) override;
+
   void SendCombinedRtcpPacket(
       std::vector<std::unique_ptr<rtcp::RtcpPacket>> rtcp_packets) override;
 
@@ -345,9 +349,9 @@ class ModuleRtpRtcpImpl2 final : public RtpRtcp,
 
   RtcpRttStats* const rtt_stats_;
 
-  // The processed RTT from RtcpRttStats.
-  rtc::CriticalSection critical_section_rtt_;
-  int64_t rtt_ms_;
+  // The processed RTT from RtcpRttStats. Atomic so that the send path can
+  // read it without taking a lock.
+  std::atomic<int64_t> rtt_ms_;
 };
 
 }  // namespace webrtc
@@ -24,6 +24,7 @@
 #include "modules/rtp_rtcp/source/byte_io.h"
 #include "modules/rtp_rtcp/source/rtp_generic_frame_descriptor_extension.h"
 #include "modules/rtp_rtcp/source/rtp_header_extensions.h"
+#include "modules/rtp_rtcp/source/rtp_packet_pool.h"
 #include "modules/rtp_rtcp/source/rtp_packet_to_send.h"
 #include "modules/rtp_rtcp/source/time_util.h"
 #include "rtc_base/arraysize.h"
@@ -167,6 +168,7 @@ RTPSender::RTPSender(const RtpRtcp::Configuration& config,
       max_padding_size_factor_(GetMaxPaddingSizeFactor(config.field_trials)),
       packet_history_(packet_history),
       paced_sender_(packet_sender),
+      packet_pool_(config.packet_pool),
       sending_media_(true),                   // Default to sending media.
       max_packet_size_(IP_PACKET_SIZE - 28),  // Default is IP-v4/UDP.
       last_payload_type_(-1),
@@ -226,6 +228,9 @@ rtc::ArrayView<const RtpExtensionSize> RTPSender::AudioExtensionSizes() {
 void RTPSender::SetExtmapAllowMixed(bool extmap_allow_mixed) {
   rtc::CritScope lock(&send_critsect_);
   rtp_header_extension_map_.SetExtmapAllowMixed(extmap_allow_mixed);
+  // Changes how extensions are serialized, so the prebuilt header is stale.
+  header_template_ = nullptr;
+  padding_packet_template_ = nullptr;
 }
 
 int32_t RTPSender::RegisterRtpHeaderExtension(RTPExtensionType type,
@@ -312,29 +317,50 @@ int32_t RTPSender::ReSendPacket(uint16_t packet_id) {
   const int32_t packet_size = static_cast<int32_t>(stored_packet->packet_size);
   const bool rtx = (RtxStatus() & kRtxRetransmitted) > 0;
 
-  std::unique_ptr<RtpPacketToSend> packet =
-      packet_history_->GetPacketAndMarkAsPending(
-          packet_id, [&](const RtpPacketToSend& stored_packet) {
-            // Check if we're overusing retransmission bitrate.
-            // TODO(sprang): Add histograms for nack success or failure
-            // reasons.
-            std::unique_ptr<RtpPacketToSend> retransmit_packet;
-            if (retransmission_rate_limiter_ &&
-                !retransmission_rate_limiter_->TryUseRate(packet_size)) {
-              return retransmit_packet;
-            }
-            if (rtx) {
-              retransmit_packet = BuildRtxPacket(stored_packet);
-            } else {
-              retransmit_packet =
-                  std::make_unique<RtpPacketToSend>(stored_packet);
-            }
-            if (retransmit_packet) {
-              retransmit_packet->set_retransmitted_sequence_number(
-                  stored_packet.SequenceNumber());
-            }
+  std::unique_ptr<RtpPacketToSend> packet;
+  if (rtx) {
+    // The RTX encapsulation is built once and cached in the history; later
+    // retransmissions of the same packet copy the prebuilt bytes and only
+    // stamp a fresh RTX sequence number.
+    packet = packet_history_->GetRtxPacketAndMarkAsPending(
+        packet_id,
+        [&](const RtpPacketToSend& stored_packet) {
+          std::unique_ptr<RtpPacketToSend> rtx_packet =
+              BuildUnsequencedRtxPacket(stored_packet);
+          if (rtx_packet) {
+            rtx_packet->set_retransmitted_sequence_number(
+                stored_packet.SequenceNumber());
+          }
+          return rtx_packet;
+        },
+        [&](RtpPacketToSend* rtx_packet) {
+          // Check if we're overusing retransmission bitrate.
+          // TODO(sprang): Add histograms for nack success or failure
+          // reasons.
+          if (retransmission_rate_limiter_ &&
+              !retransmission_rate_limiter_->TryUseRate(packet_size)) {
+            return false;
+          }
+          AssignRtxSequenceNumber(rtx_packet);
+          return true;
+        });
+  } else {
+    packet = packet_history_->GetPacketAndMarkAsPending(
+        packet_id, [&](const RtpPacketToSend& stored_packet) {
+          // Check if we're overusing retransmission bitrate.
+          // TODO(sprang): Add histograms for nack success or failure
+          // reasons.
+          std::unique_ptr<RtpPacketToSend> retransmit_packet;
+          if (retransmission_rate_limiter_ &&
+              !retransmission_rate_limiter_->TryUseRate(packet_size)) {
             return retransmit_packet;
-          });
+          }
+          retransmit_packet = std::make_unique<RtpPacketToSend>(stored_packet);
+          retransmit_packet->set_retransmitted_sequence_number(
+              stored_packet.SequenceNumber());
+          return retransmit_packet;
+        });
+  }
   if (!packet) {
     return -1;
   }
@@ -446,12 +472,6 @@ std::vector<std::unique_ptr<RtpPacketToSend>> RTPSender::GeneratePadding(
   }
 
   while (bytes_left > 0) {
-    auto padding_packet =
-        std::make_unique<RtpPacketToSend>(&rtp_header_extension_map_);
-    padding_packet->set_packet_type(RtpPacketMediaType::kPadding);
-    padding_packet->SetMarker(false);
-    padding_packet->SetTimestamp(last_rtp_timestamp_);
-    padding_packet->set_capture_time_ms(capture_time_ms_);
     if (rtx_ == kRtxOff) {
       if (last_payload_type_ == -1) {
         break;
@@ -463,10 +483,6 @@ std::vector<std::unique_ptr<RtpPacketToSend>> RTPSender::GeneratePadding(
       if (!audio_configured_ && !last_packet_marker_bit_) {
         break;
       }
-
-      padding_packet->SetSsrc(ssrc_);
-      padding_packet->SetPayloadType(last_payload_type_);
-      padding_packet->SetSequenceNumber(sequence_number_++);
     } else {
       // Without abs-send-time or transport sequence number a media packet
       // must be sent before padding so that the timestamps used for
@@ -477,6 +493,31 @@ std::vector<std::unique_ptr<RtpPacketToSend>> RTPSender::GeneratePadding(
                 TransportSequenceNumber::kId))) {
         break;
       }
+      RTC_DCHECK(rtx_ssrc_);
+    }
+
+    // (Re)build the cached template if it does not match the current
+    // configuration. In the steady state, in particular during the
+    // multi-packet bursts requested when probing, this only happens once.
+    const uint32_t padding_ssrc = rtx_ == kRtxOff ? ssrc_ : *rtx_ssrc_;
+    const uint8_t padding_payload_type =
+        rtx_ == kRtxOff ? last_payload_type_
+                        : rtx_payload_type_map_.begin()->second;
+    if (!padding_packet_template_ ||
+        padding_packet_template_->Ssrc() != padding_ssrc ||
+        padding_packet_template_->PayloadType() != padding_payload_type ||
+        padding_packet_template_->padding_size() != padding_bytes_in_packet) {
+      padding_packet_template_ =
+          BuildPaddingPacketTemplate(padding_bytes_in_packet);
+    }
+
+    auto padding_packet =
+        std::make_unique<RtpPacketToSend>(*padding_packet_template_);
+    padding_packet->SetTimestamp(last_rtp_timestamp_);
+    padding_packet->set_capture_time_ms(capture_time_ms_);
+    if (rtx_ == kRtxOff) {
+      padding_packet->SetSequenceNumber(sequence_number_++);
+    } else {
       // Only change the timestamp of padding packets sent over RTX.
       // Padding only packets over RTP has to be sent as part of a media
       // frame (and therefore the same timestamp).
@@ -488,23 +529,9 @@ std::vector<std::unique_ptr<RtpPacketToSend>> RTPSender::GeneratePadding(
         padding_packet->set_capture_time_ms(padding_packet->capture_time_ms() +
                                             (now_ms - last_timestamp_time_ms_));
       }
-      RTC_DCHECK(rtx_ssrc_);
-      padding_packet->SetSsrc(*rtx_ssrc_);
       padding_packet->SetSequenceNumber(sequence_number_rtx_++);
-      padding_packet->SetPayloadType(rtx_payload_type_map_.begin()->second);
-    }
-
-    if (rtp_header_extension_map_.IsRegistered(TransportSequenceNumber::kId)) {
-      padding_packet->ReserveExtension<TransportSequenceNumber>();
-    }
-    if (rtp_header_extension_map_.IsRegistered(TransmissionOffset::kId)) {
-      padding_packet->ReserveExtension<TransmissionOffset>();
-    }
-    if (rtp_header_extension_map_.IsRegistered(AbsoluteSendTime::kId)) {
-      padding_packet->ReserveExtension<AbsoluteSendTime>();
     }
 
-    padding_packet->SetPadding(padding_bytes_in_packet);
     bytes_left -= std::min(bytes_left, padding_bytes_in_packet);
     padding_packets.push_back(std::move(padding_packet));
   }
@@ -512,6 +539,34 @@ std::vector<std::unique_ptr<RtpPacketToSend>> RTPSender::GeneratePadding(
   return padding_packets;
 }
 
+std::unique_ptr<RtpPacketToSend> RTPSender::BuildPaddingPacketTemplate(
+    size_t padding_size) const {
+  auto packet = std::make_unique<RtpPacketToSend>(&rtp_header_extension_map_);
+  packet->set_packet_type(RtpPacketMediaType::kPadding);
+  packet->SetMarker(false);
+  if (rtx_ == kRtxOff) {
+    packet->SetSsrc(ssrc_);
+    packet->SetPayloadType(last_payload_type_);
+  } else {
+    RTC_DCHECK(rtx_ssrc_);
+    packet->SetSsrc(*rtx_ssrc_);
+    packet->SetPayloadType(rtx_payload_type_map_.begin()->second);
+  }
+
+  if (rtp_header_extension_map_.IsRegistered(TransportSequenceNumber::kId)) {
+    packet->ReserveExtension<TransportSequenceNumber>();
+  }
+  if (rtp_header_extension_map_.IsRegistered(TransmissionOffset::kId)) {
+    packet->ReserveExtension<TransmissionOffset>();
+  }
+  if (rtp_header_extension_map_.IsRegistered(AbsoluteSendTime::kId)) {
+    packet->ReserveExtension<AbsoluteSendTime>();
+  }
+
+  packet->SetPadding(padding_size);
+  return packet;
+}
+
 bool RTPSender::SendToNetwork(std::unique_ptr<RtpPacketToSend> packet) {
   RTC_DCHECK(packet);
   int64_t now_ms = clock_->TimeInMilliseconds();
@@ -572,8 +627,26 @@ std::unique_ptr<RtpPacketToSend> RTPSender::AllocatePacket() const {
   // While sending slightly oversized packet increase chance of dropped packet,
   // it is better than crash on drop packet without trying to send it.
   static constexpr int kExtraCapacity = 16;
-  auto packet = std::make_unique<RtpPacketToSend>(
-      &rtp_header_extension_map_, max_packet_size_ + kExtraCapacity);
+  std::unique_ptr<RtpPacketToSend> packet;
+  if (packet_pool_) {
+    packet = packet_pool_->AcquireSendPacket(&rtp_header_extension_map_,
+                                             max_packet_size_ + kExtraCapacity);
+  } else {
+    packet = std::make_unique<RtpPacketToSend>(
+        &rtp_header_extension_map_, max_packet_size_ + kExtraCapacity);
+  }
+  if (!header_template_) {
+    header_template_ = BuildHeaderTemplate();
+  }
+  // Stamp the prebuilt header onto the packet in a single copy instead of
+  // re-running extension lookup and allocation for every packet.
+  packet->StampHeaderFrom(*header_template_);
+  return packet;
+}
+
+std::unique_ptr<RtpPacket> RTPSender::BuildHeaderTemplate() const {
+  auto packet =
+      std::make_unique<RtpPacket>(&rtp_header_extension_map_, max_packet_size_);
   packet->SetSsrc(ssrc_);
   packet->SetCsrcs(csrcs_);
   // Reserve extensions, if registered, RtpSender set in SendToNetwork.
@@ -744,6 +817,16 @@ static void CopyHeaderAndExtensionsToRtxPacket(const RtpPacketToSend& packet,
 
 std::unique_ptr<RtpPacketToSend> RTPSender::BuildRtxPacket(
     const RtpPacketToSend& packet) {
+  std::unique_ptr<RtpPacketToSend> rtx_packet =
+      BuildUnsequencedRtxPacket(packet);
+  if (rtx_packet) {
+    AssignRtxSequenceNumber(rtx_packet.get());
+  }
+  return rtx_packet;
+}
+
+std::unique_ptr<RtpPacketToSend> RTPSender::BuildUnsequencedRtxPacket(
+    const RtpPacketToSend& packet) {
   std::unique_ptr<RtpPacketToSend> rtx_packet;
 
   // Add original RTP header.
@@ -764,9 +847,6 @@ std::unique_ptr<RtpPacketToSend> RTPSender::BuildRtxPacket(
 
     rtx_packet->SetPayloadType(kv->second);
 
-    // Replace sequence number.
-    rtx_packet->SetSequenceNumber(sequence_number_rtx_++);
-
     // Replace SSRC.
     rtx_packet->SetSsrc(*rtx_ssrc_);
 
@@ -813,6 +893,11 @@ std::unique_ptr<RtpPacketToSend> RTPSender::BuildRtxPacket(
   return rtx_packet;
 }
 
+void RTPSender::AssignRtxSequenceNumber(RtpPacketToSend* rtx_packet) {
+  rtc::CritScope lock(&send_critsect_);
+  rtx_packet->SetSequenceNumber(sequence_number_rtx_++);
+}
+
 void RTPSender::SetRtpState(const RtpState& rtp_state) {
   rtc::CritScope lock(&send_critsect_);
   sequence_number_ = rtp_state.sequence_number;
@@ -896,5 +981,10 @@ void RTPSender::UpdateHeaderSizes() {
   max_media_packet_header_ =
       rtp_header_length + RtpHeaderExtensionSize(non_volatile_extensions,
                                                  rtp_header_extension_map_);
+  // Every mutation that affects the header layout funnels through here, so
+  // this is also where the prebuilt header and padding templates are
+  // invalidated.
+  header_template_ = nullptr;
+  padding_packet_template_ = nullptr;
 }
 }  // namespace webrtc
@@ -41,6 +41,7 @@ namespace webrtc {
 class FrameEncryptorInterface;
 class RateLimiter;
 class RtcEventLog;
+class RtpPacketPool;
 class RtpPacketToSend;
 
 class RTPSender {
@@ -149,10 +150,31 @@ class RTPSender {
   std::unique_ptr<RtpPacketToSend> BuildRtxPacket(
       const RtpPacketToSend& packet);
 
+  // Builds an RTX packet from |packet| without assigning an RTX sequence
+  // number. Used together with AssignRtxSequenceNumber() so that a prebuilt
+  // RTX packet can be cached in the packet history and reused, with only the
+  // sequence number stamped per transmission.
+  std::unique_ptr<RtpPacketToSend> BuildUnsequencedRtxPacket(
+      const RtpPacketToSend& packet);
+  void AssignRtxSequenceNumber(RtpPacketToSend* rtx_packet);
+
   bool IsFecPacket(const RtpPacketToSend& packet) const;
 
   void UpdateHeaderSizes() RTC_EXCLUSIVE_LOCKS_REQUIRED(send_critsect_);
 
+  // Builds the header template stamped onto packets by AllocatePacket():
+  // SSRC, CSRCs and the header extensions every outgoing packet carries,
+  // serialized once per configuration instead of once per packet.
+  std::unique_ptr<RtpPacket> BuildHeaderTemplate() const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(send_critsect_);
+
+  // Builds the packet copied by GeneratePadding() for non-payload padding:
+  // header, reserved extensions and the zero-filled padding block are
+  // serialized once, so the packets of a probe burst only need sequence
+  // number and timestamp stamping.
+  std::unique_ptr<RtpPacketToSend> BuildPaddingPacketTemplate(
+      size_t padding_size) const RTC_EXCLUSIVE_LOCKS_REQUIRED(send_critsect_);
+
   Clock* const clock_;
   Random random_ RTC_GUARDED_BY(send_critsect_);
 
@@ -167,6 +189,9 @@ class RTPSender {
 
   RtpPacketHistory* const packet_history_;
   RtpPacketSender* const paced_sender_;
+  // Optional pool recycling packet objects and their backing buffers; may be
+  // null in which case packets are heap-allocated.
+  RtpPacketPool* const packet_pool_;
 
   rtc::CriticalSection send_critsect_;
 
@@ -205,6 +230,18 @@ class RTPSender {
   std::map<int8_t, int8_t> rtx_payload_type_map_ RTC_GUARDED_BY(send_critsect_);
   bool supports_bwe_extension_ RTC_GUARDED_BY(send_critsect_);
 
+  // Lazily built by AllocatePacket() and reset by any configuration change
+  // that affects the header layout (see BuildHeaderTemplate()). Mutable
+  // because AllocatePacket() is const.
+  mutable std::unique_ptr<RtpPacket> header_template_
+      RTC_GUARDED_BY(send_critsect_);
+
+  // Lazily built by GeneratePadding() and invalidated together with
+  // |header_template_|; additionally rebuilt if the SSRC, payload type or
+  // padding size it was stamped with no longer match.
+  std::unique_ptr<RtpPacketToSend> padding_packet_template_
+      RTC_GUARDED_BY(send_critsect_);
+
   RateLimiter* const retransmission_rate_limiter_;
 
   RTC_DISALLOW_IMPLICIT_CONSTRUCTORS(RTPSender);
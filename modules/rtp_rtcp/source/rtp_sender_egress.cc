@@ -10,6 +10,7 @@
 
 #include "modules/rtp_rtcp/source/rtp_sender_egress.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -23,7 +24,6 @@
 namespace webrtc {
 namespace {
 constexpr uint32_t kTimestampTicksPerMs = 90;
-constexpr int kSendSideDelayWindowMs = 1000;
 constexpr int kBitrateStatisticsWindowMs = 1000;
 constexpr size_t kRtpSequenceNumberMapMaxEntries = 1 << 13;
 
@@ -76,7 +76,10 @@ RtpSenderEgress::RtpSenderEgress(const RtpRtcp::Configuration& config,
       media_has_been_sent_(false),
       force_part_of_allocation_(false),
       timestamp_offset_(0),
-      max_delay_it_(send_delays_.end()),
+      send_delay_slots_(),
+      newest_delay_slot_time_ms_(-1),
+      num_delays_(0),
+      max_delay_ms_(-1),
       sum_delays_ms_(0),
       total_packet_send_delay_ms_(0),
       send_rates_(kNumMediaTypes,
@@ -166,6 +169,9 @@ void RtpSenderEgress::SendPacket(RtpPacketToSend* packet,
   // Downstream code actually uses this flag to distinguish between media and
   // everything else.
   options.is_retransmit = !is_media;
+  // Media packets commonly leave the pacer in same-destination bursts; let
+  // the socket layer coalesce them into one syscall.
+  options.batchable = is_media;
   if (auto packet_id = packet->GetExtension<TransportSequenceNumber>()) {
     options.packet_id = *packet_id;
     options.included_in_feedback = true;
@@ -329,26 +335,6 @@ void RtpSenderEgress::UpdateDelayStatistics(int64_t capture_time_ms,
   uint64_t total_packet_send_delay_ms = 0;
   {
     rtc::CritScope cs(&lock_);
-    // Compute the max and average of the recent capture-to-send delays.
-    // The time complexity of the current approach depends on the distribution
-    // of the delay values. This could be done more efficiently.
-
-    // Remove elements older than kSendSideDelayWindowMs.
-    auto lower_bound =
-        send_delays_.lower_bound(now_ms - kSendSideDelayWindowMs);
-    for (auto it = send_delays_.begin(); it != lower_bound; ++it) {
-      if (max_delay_it_ == it) {
-        max_delay_it_ = send_delays_.end();
-      }
-      sum_delays_ms_ -= it->second;
-    }
-    send_delays_.erase(send_delays_.begin(), lower_bound);
-    if (max_delay_it_ == send_delays_.end()) {
-      // Removed the previous max. Need to recompute.
-      RecomputeMaxSendDelay();
-    }
-
-    // Add the new element.
     RTC_DCHECK_GE(now_ms, 0);
     RTC_DCHECK_LE(now_ms, std::numeric_limits<int64_t>::max() / 2);
     RTC_DCHECK_GE(capture_time_ms, 0);
@@ -356,50 +342,70 @@ void RtpSenderEgress::UpdateDelayStatistics(int64_t capture_time_ms,
     int64_t diff_ms = now_ms - capture_time_ms;
     RTC_DCHECK_GE(diff_ms, static_cast<int64_t>(0));
     RTC_DCHECK_LE(diff_ms, std::numeric_limits<int>::max());
-    int new_send_delay = rtc::dchecked_cast<int>(now_ms - capture_time_ms);
-    SendDelayMap::iterator it;
-    bool inserted;
-    std::tie(it, inserted) =
-        send_delays_.insert(std::make_pair(now_ms, new_send_delay));
-    if (!inserted) {
-      // TODO(terelius): If we have multiple delay measurements during the same
-      // millisecond then we keep the most recent one. It is not clear that this
-      // is the right decision, but it preserves an earlier behavior.
-      int previous_send_delay = it->second;
-      sum_delays_ms_ -= previous_send_delay;
-      it->second = new_send_delay;
-      if (max_delay_it_ == it && new_send_delay < previous_send_delay) {
+    int new_send_delay = rtc::dchecked_cast<int>(diff_ms);
+
+    if (newest_delay_slot_time_ms_ == -1) {
+      newest_delay_slot_time_ms_ = now_ms;
+    } else if (now_ms < newest_delay_slot_time_ms_ - kSendSideDelayWindowMs) {
+      // The clock jumped backwards past the tracked window; drop the sample.
+      return;
+    } else if (now_ms > newest_delay_slot_time_ms_) {
+      // Evict the slots that are being reused for the new send times. Each
+      // such slot last held delays recorded exactly kSendDelaySlots
+      // milliseconds earlier, which now fall outside the window.
+      int64_t steps = std::min<int64_t>(now_ms - newest_delay_slot_time_ms_,
+                                        kSendDelaySlots);
+      bool max_evicted = false;
+      for (int64_t time_ms = now_ms - steps + 1; time_ms <= now_ms;
+           ++time_ms) {
+        SendDelaySlot& slot = send_delay_slots_[time_ms % kSendDelaySlots];
+        if (slot.count > 0) {
+          sum_delays_ms_ -= slot.sum_ms;
+          num_delays_ -= slot.count;
+          if (slot.max_ms >= max_delay_ms_)
+            max_evicted = true;
+          slot.sum_ms = 0;
+          slot.count = 0;
+        }
+      }
+      newest_delay_slot_time_ms_ = now_ms;
+      if (max_evicted) {
+        // Evicted the previous max. Need to recompute.
         RecomputeMaxSendDelay();
       }
     }
-    if (max_delay_it_ == send_delays_.end() ||
-        it->second >= max_delay_it_->second) {
-      max_delay_it_ = it;
-    }
+
+    SendDelaySlot& slot = send_delay_slots_[now_ms % kSendDelaySlots];
+    slot.sum_ms += new_send_delay;
+    if (slot.count == 0 || new_send_delay > slot.max_ms)
+      slot.max_ms = new_send_delay;
+    ++slot.count;
+
     sum_delays_ms_ += new_send_delay;
+    ++num_delays_;
+    if (new_send_delay > max_delay_ms_)
+      max_delay_ms_ = new_send_delay;
     total_packet_send_delay_ms_ += new_send_delay;
     total_packet_send_delay_ms = total_packet_send_delay_ms_;
 
-    size_t num_delays = send_delays_.size();
-    RTC_DCHECK(max_delay_it_ != send_delays_.end());
-    max_delay_ms = rtc::dchecked_cast<int>(max_delay_it_->second);
-    int64_t avg_ms = (sum_delays_ms_ + num_delays / 2) / num_delays;
+    RTC_DCHECK_GT(num_delays_, 0);
+    RTC_DCHECK_GE(max_delay_ms_, 0);
+    max_delay_ms = max_delay_ms_;
+    int64_t avg_ms = (sum_delays_ms_ + num_delays_ / 2) / num_delays_;
     RTC_DCHECK_GE(avg_ms, static_cast<int64_t>(0));
     RTC_DCHECK_LE(avg_ms,
                   static_cast<int64_t>(std::numeric_limits<int>::max()));
-    avg_delay_ms =
-        rtc::dchecked_cast<int>((sum_delays_ms_ + num_delays / 2) / num_delays);
+    avg_delay_ms = rtc::dchecked_cast<int>(avg_ms);
   }
   send_side_delay_observer_->SendSideDelayUpdated(
       avg_delay_ms, max_delay_ms, total_packet_send_delay_ms, ssrc);
 }
 
 void RtpSenderEgress::RecomputeMaxSendDelay() {
-  max_delay_it_ = send_delays_.begin();
-  for (auto it = send_delays_.begin(); it != send_delays_.end(); ++it) {
-    if (it->second >= max_delay_it_->second) {
-      max_delay_it_ = it;
-    }
+  max_delay_ms_ = -1;
+  for (const SendDelaySlot& slot : send_delay_slots_) {
+    if (slot.count > 0 && slot.max_ms > max_delay_ms_)
+      max_delay_ms_ = slot.max_ms;
   }
 }
 
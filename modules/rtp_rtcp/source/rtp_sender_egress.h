@@ -11,7 +11,6 @@
 #ifndef MODULES_RTP_RTCP_SOURCE_RTP_SENDER_EGRESS_H_
 #define MODULES_RTP_RTCP_SOURCE_RTP_SENDER_EGRESS_H_
 
-#include <map>
 #include <memory>
 #include <vector>
 
@@ -79,10 +78,18 @@ class RtpSenderEgress {
       RTC_LOCKS_EXCLUDED(lock_);
 
  private:
-  // Maps capture time in milliseconds to send-side delay in milliseconds.
   // Send-side delay is the difference between transmission time and capture
-  // time.
-  typedef std::map<int64_t, int> SendDelayMap;
+  // time. Delays are aggregated over a kSendSideDelayWindowMs sliding window
+  // with one slot per millisecond; the slots are reused in a ring as time
+  // advances, so per-packet updates are allocation-free.
+  struct SendDelaySlot {
+    int sum_ms;
+    int count;
+    int max_ms;
+  };
+  static constexpr int kSendSideDelayWindowMs = 1000;
+  // One slot per millisecond in the window, endpoints inclusive.
+  static constexpr int kSendDelaySlots = kSendSideDelayWindowMs + 1;
 
   RtpSendRates GetSendRatesLocked() const RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
   bool HasCorrectSsrc(const RtpPacketToSend& packet) const;
@@ -126,9 +133,13 @@ class RtpSenderEgress {
   bool force_part_of_allocation_ RTC_GUARDED_BY(lock_);
   uint32_t timestamp_offset_ RTC_GUARDED_BY(lock_);
 
-  SendDelayMap send_delays_ RTC_GUARDED_BY(lock_);
-  SendDelayMap::const_iterator max_delay_it_ RTC_GUARDED_BY(lock_);
-  // The sum of delays over a kSendSideDelayWindowMs sliding window.
+  SendDelaySlot send_delay_slots_[kSendDelaySlots] RTC_GUARDED_BY(lock_);
+  // Send time of the most recently recorded delay, or -1 before the first
+  // packet. Slots for older times wrap around |send_delay_slots_|.
+  int64_t newest_delay_slot_time_ms_ RTC_GUARDED_BY(lock_);
+  // Aggregates over the kSendSideDelayWindowMs sliding window.
+  int num_delays_ RTC_GUARDED_BY(lock_);
+  int max_delay_ms_ RTC_GUARDED_BY(lock_);
   int64_t sum_delays_ms_ RTC_GUARDED_BY(lock_);
   uint64_t total_packet_send_delay_ms_ RTC_GUARDED_BY(lock_);
   StreamDataCounters rtp_stats_ RTC_GUARDED_BY(lock_);
@@ -708,11 +708,11 @@ TEST_P(RtpSenderTestWithoutPacer, OnSendSideDelayUpdated) {
       capture_time_ms, kPayloadData, nullptr, video_header,
       kDefaultExpectedRetransmissionTimeMs));
 
-  // Send another packet at the same time, which replaces the last packet.
-  // Since this packet has 0 ms delay, the average is now 5 ms and max is 10 ms.
+  // Send another packet at the same time with 0 ms delay. All three packets
+  // are part of the window, so the average is 10 ms and max stays at 20 ms.
   // The total counter stays the same though.
-  // TODO(terelius): Is is not clear that this is the right behavior.
-  EXPECT_CALL(send_side_delay_observer_, SendSideDelayUpdated(5, 10, 30, kSsrc))
+  EXPECT_CALL(send_side_delay_observer_,
+              SendSideDelayUpdated(10, 20, 30, kSsrc))
       .Times(1);
   capture_time_ms = fake_clock_.TimeInMilliseconds();
   video_header.frame_type = VideoFrameType::kVideoFrameKey;
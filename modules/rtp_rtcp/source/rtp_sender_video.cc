@@ -395,7 +395,7 @@ bool RTPSenderVideo::SendVideo(
     int64_t capture_time_ms,
     rtc::ArrayView<const uint8_t> payload,
     const RTPFragmentationHeader* fragmentation,
-    RTPVideoHeader video_header,
+    const RTPVideoHeader& video_header,
     absl::optional<int64_t> expected_retransmission_time_ms) {
 #if RTC_TRACE_EVENTS_ENABLED
   TRACE_EVENT_ASYNC_STEP1("webrtc", "Video", capture_time_ms, "Send", "type",
@@ -484,8 +484,14 @@ bool RTPSenderVideo::SendVideo(
 
   // Minimization of the vp8 descriptor may erase temporal_id, so save it.
   const uint8_t temporal_id = GetTemporalId(video_header);
+  // When the descriptor has to be rewritten, copy the header into the scratch
+  // member instead of taking the (large) header by value on every call.
+  const RTPVideoHeader* packetization_header = &video_header;
   if (has_generic_descriptor) {
-    MinimizeDescriptor(&video_header);
+    minimized_video_header_ = video_header;
+    if (MinimizeDescriptor(&minimized_video_header_)) {
+      packetization_header = &minimized_video_header_;
+    }
   }
 
   // TODO(benwright@webrtc.org) - Allocate enough to always encrypt inline.
@@ -505,7 +511,7 @@ bool RTPSenderVideo::SendVideo(
     // Enable header authentication if the field trial isn't disabled.
     std::vector<uint8_t> additional_data;
     if (generic_descriptor_auth_experiment_) {
-      additional_data = RtpDescriptorAuthentication(video_header);
+      additional_data = RtpDescriptorAuthentication(*packetization_header);
     }
 
     if (frame_encryptor_->Encrypt(
@@ -523,7 +529,7 @@ bool RTPSenderVideo::SendVideo(
   }
 
   std::unique_ptr<RtpPacketizer> packetizer = RtpPacketizer::Create(
-      codec_type, payload, limits, video_header, fragmentation);
+      codec_type, payload, limits, *packetization_header, fragmentation);
 
   // TODO(bugs.webrtc.org/10714): retransmission_settings_ should generally be
   // replaced by expected_retransmission_time_ms.has_value(). For now, though,
@@ -572,6 +578,8 @@ bool RTPSenderVideo::SendVideo(
     }
 
     packet->set_first_packet_of_frame(i == 0);
+    packet->set_is_key_frame(video_header.frame_type ==
+                             VideoFrameType::kVideoFrameKey);
 
     if (!packetizer->NextPacket(packet.get()))
       return false;
@@ -672,7 +680,7 @@ bool RTPSenderVideo::SendEncodedImage(
     uint32_t rtp_timestamp,
     const EncodedImage& encoded_image,
     const RTPFragmentationHeader* fragmentation,
-    RTPVideoHeader video_header,
+    const RTPVideoHeader& video_header,
     absl::optional<int64_t> expected_retransmission_time_ms) {
   if (frame_transformer_delegate_) {
     // The frame will be sent async once transformed.
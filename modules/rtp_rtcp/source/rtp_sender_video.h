@@ -95,7 +95,7 @@ class RTPSenderVideo {
                  int64_t capture_time_ms,
                  rtc::ArrayView<const uint8_t> payload,
                  const RTPFragmentationHeader* fragmentation,
-                 RTPVideoHeader video_header,
+                 const RTPVideoHeader& video_header,
                  absl::optional<int64_t> expected_retransmission_time_ms);
 
   bool SendEncodedImage(
@@ -104,7 +104,7 @@ class RTPSenderVideo {
       uint32_t rtp_timestamp,
       const EncodedImage& encoded_image,
       const RTPFragmentationHeader* fragmentation,
-      RTPVideoHeader video_header,
+      const RTPVideoHeader& video_header,
       absl::optional<int64_t> expected_retransmission_time_ms);
 
   // Configures video structures produced by encoder to send using the
@@ -178,6 +178,12 @@ class RTPSenderVideo {
   std::unique_ptr<FrameDependencyStructure> video_structure_
       RTC_GUARDED_BY(send_checker_);
 
+  // Scratch header reused across frames when the codec specific descriptor
+  // has to be rewritten before packetization; the incoming header is passed
+  // by const reference and must not be modified. Reusing one instance keeps
+  // the contained containers' allocations alive between frames.
+  RTPVideoHeader minimized_video_header_ RTC_GUARDED_BY(send_checker_);
+
   // Current target playout delay.
   PlayoutDelay current_playout_delay_ RTC_GUARDED_BY(send_checker_);
   // Flag indicating if we need to propagate |current_playout_delay_| in order
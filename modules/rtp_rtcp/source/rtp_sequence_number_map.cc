@@ -49,6 +49,15 @@ void RtpSequenceNumberMap::InsertPacket(uint16_t sequence_number, Info info) {
     return;
   }
 
+  // Common case - in-order insertion with room to spare. The new element is
+  // ahead of everything stored, so no existing entry becomes obsolete and the
+  // binary search below would erase nothing.
+  if (associations_.size() < max_entries_ &&
+      AheadOf(sequence_number, associations_.back().sequence_number)) {
+    associations_.emplace_back(sequence_number, info);
+    return;
+  }
+
   std::deque<Association>::iterator erase_to = associations_.begin();
 
   RTC_DCHECK_LE(associations_.size(), max_entries_);
@@ -108,6 +117,12 @@ absl::optional<RtpSequenceNumberMap::Info> RtpSequenceNumberMap::Get(
     return absl::nullopt;
   }
 
+  // Queries are most often for recently recorded packets, so check the newest
+  // association before the binary search.
+  if (associations_.back().sequence_number == sequence_number) {
+    return associations_.back().info;
+  }
+
   const uint16_t offset =
       static_cast<uint16_t>(0) - associations_.front().sequence_number;
 
@@ -16,10 +16,28 @@
 #include "api/array_view.h"
 #include "api/scoped_refptr.h"
 #include "api/video/encoded_image.h"
+#include "common_video/include/encoded_image_buffer_pool.h"
 #include "rtc_base/checks.h"
 
 namespace webrtc {
 
+rtc::scoped_refptr<EncodedImageBuffer>
+VideoRtpDepacketizer::AllocateBitstreamBuffer(size_t size) {
+  if (bitstream_pool_ != nullptr) {
+    rtc::scoped_refptr<EncodedImageBuffer> buffer =
+        bitstream_pool_->GetBuffer(size);
+    if (buffer != nullptr) {
+      // A recycled buffer may be larger than requested; shrink it so that
+      // consumers relying on size() see the exact frame size.
+      if (buffer->size() != size) {
+        buffer->Realloc(size);
+      }
+      return buffer;
+    }
+  }
+  return EncodedImageBuffer::Create(size);
+}
+
 rtc::scoped_refptr<EncodedImageBuffer> VideoRtpDepacketizer::AssembleFrame(
     rtc::ArrayView<const rtc::ArrayView<const uint8_t>> rtp_payloads) {
   size_t frame_size = 0;
@@ -28,7 +46,7 @@ rtc::scoped_refptr<EncodedImageBuffer> VideoRtpDepacketizer::AssembleFrame(
   }
 
   rtc::scoped_refptr<EncodedImageBuffer> bitstream =
-      EncodedImageBuffer::Create(frame_size);
+      AllocateBitstreamBuffer(frame_size);
 
   uint8_t* write_at = bitstream->data();
   for (rtc::ArrayView<const uint8_t> payload : rtp_payloads) {
@@ -22,6 +22,8 @@
 
 namespace webrtc {
 
+class EncodedImageBufferPool;
+
 class VideoRtpDepacketizer {
  public:
   struct ParsedRtpPayload {
@@ -34,6 +36,21 @@ class VideoRtpDepacketizer {
       rtc::CopyOnWriteBuffer rtp_payload) = 0;
   virtual rtc::scoped_refptr<EncodedImageBuffer> AssembleFrame(
       rtc::ArrayView<const rtc::ArrayView<const uint8_t>> rtp_payloads);
+
+  // Recycles the bitstream buffers returned by AssembleFrame through |pool|
+  // instead of allocating a fresh buffer per frame. |pool| must outlive this
+  // depacketizer; buffers still referenced downstream are never reused.
+  void SetBitstreamBufferPool(EncodedImageBufferPool* pool) {
+    bitstream_pool_ = pool;
+  }
+
+ protected:
+  // Returns a buffer of exactly |size| bytes, recycled from the configured
+  // pool when one is available.
+  rtc::scoped_refptr<EncodedImageBuffer> AllocateBitstreamBuffer(size_t size);
+
+ private:
+  EncodedImageBufferPool* bitstream_pool_ = nullptr;
 };
 
 }  // namespace webrtc
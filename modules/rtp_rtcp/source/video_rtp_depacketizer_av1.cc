@@ -351,7 +351,7 @@ rtc::scoped_refptr<EncodedImageBuffer> VideoRtpDepacketizerAv1::AssembleFrame(
   }
 
   rtc::scoped_refptr<EncodedImageBuffer> bitstream =
-      EncodedImageBuffer::Create(frame_size);
+      AllocateBitstreamBuffer(frame_size);
   uint8_t* write_at = bitstream->data();
   for (const ObuInfo& obu_info : obu_infos) {
     // Copy the obu_header and obu_size fields.
@@ -10,6 +10,7 @@
 
 #include "modules/utility/source/process_thread_impl.h"
 
+#include <algorithm>
 #include <string>
 
 #include "modules/include/module.h"
@@ -111,7 +112,7 @@ void ProcessThreadImpl::WakeUp(Module* module) {
     rtc::CritScope lock(&lock_);
     for (ModuleCallback& m : modules_) {
       if (m.module == module)
-        m.next_callback = kCallProcessImmediately;
+        ScheduleModule(&m, kCallProcessImmediately);
     }
   }
   wake_up_.Set();
@@ -169,6 +170,9 @@ void ProcessThreadImpl::RegisterModule(Module* module,
   {
     rtc::CritScope lock(&lock_);
     modules_.push_back(ModuleCallback(module, from));
+    // A deadline of 0 expires immediately, so the module's
+    // TimeUntilNextProcess() is queried on the next pass of Process().
+    ScheduleModule(&modules_.back(), 0);
   }
 
   // Wake the thread calling ProcessThreadImpl::Process() to update the
@@ -183,6 +187,15 @@ void ProcessThreadImpl::DeRegisterModule(Module* module) {
 
   {
     rtc::CritScope lock(&lock_);
+    // Drop any scheduled deadlines before the callback they point into is
+    // destroyed.
+    module_deadlines_.erase(
+        std::remove_if(module_deadlines_.begin(), module_deadlines_.end(),
+                       [&module](const ModuleDeadline& deadline) {
+                         return deadline.callback->module == module;
+                       }),
+        module_deadlines_.end());
+    std::make_heap(module_deadlines_.begin(), module_deadlines_.end());
     modules_.remove_if(
         [&module](const ModuleCallback& m) { return m.module == module; });
   }
@@ -208,31 +221,55 @@ bool ProcessThreadImpl::Process() {
     rtc::CritScope lock(&lock_);
     if (stop_)
       return false;
-    for (ModuleCallback& m : modules_) {
+    // Entries rescheduled inside the loop may expire immediately again; cap
+    // the number of pops at the heap's initial size so that each module runs
+    // at most once per pass and the task queue below cannot be starved.
+    size_t pops_left = module_deadlines_.size();
+    while (pops_left > 0 && !module_deadlines_.empty() &&
+           module_deadlines_.front().deadline <= now) {
+      --pops_left;
+      std::pop_heap(module_deadlines_.begin(), module_deadlines_.end());
+      const ModuleDeadline deadline = module_deadlines_.back();
+      module_deadlines_.pop_back();
+      ModuleCallback* m = deadline.callback;
+      if (deadline.sequence != m->schedule_sequence) {
+        // The module was rescheduled after this entry was pushed; the entry
+        // carrying the current sequence is elsewhere in the heap.
+        continue;
+      }
+
       // TODO(tommi): Would be good to measure the time TimeUntilNextProcess
       // takes and dcheck if it takes too long (e.g. >=10ms).  Ideally this
       // operation should not require taking a lock, so querying all modules
       // should run in a matter of nanoseconds.
-      if (m.next_callback == 0)
-        m.next_callback = GetNextCallbackTime(m.module, now);
+      if (m->next_callback == 0)
+        m->next_callback = GetNextCallbackTime(m->module, now);
 
-      if (m.next_callback <= now ||
-          m.next_callback == kCallProcessImmediately) {
+      if (m->next_callback <= now ||
+          m->next_callback == kCallProcessImmediately) {
         {
           TRACE_EVENT2("webrtc", "ModuleProcess", "function",
-                       m.location.function_name(), "file",
-                       m.location.file_name());
-          m.module->Process();
+                       m->location.function_name(), "file",
+                       m->location.file_name());
+          m->module->Process();
         }
         // Use a new 'now' reference to calculate when the next callback
         // should occur.  We'll continue to use 'now' above for the baseline
         // of calculating how long we should wait, to reduce variance.
         int64_t new_now = rtc::TimeMillis();
-        m.next_callback = GetNextCallbackTime(m.module, new_now);
+        ScheduleModule(m, GetNextCallbackTime(m->module, new_now));
+      } else {
+        // Not due yet (the deadline belonged to an older schedule); put the
+        // module back under its current callback time.
+        ScheduleModule(m, m->next_callback);
       }
+    }
 
-      if (m.next_callback < next_checkpoint)
-        next_checkpoint = m.next_callback;
+    // All entries with expired deadlines were popped above, so the top of
+    // the heap is the earliest pending module callback.
+    if (!module_deadlines_.empty() &&
+        module_deadlines_.front().deadline < next_checkpoint) {
+      next_checkpoint = module_deadlines_.front().deadline;
     }
 
     while (!delayed_tasks_.empty() && delayed_tasks_.top().run_at_ms <= now) {
@@ -262,4 +299,11 @@ bool ProcessThreadImpl::Process() {
 
   return true;
 }
+
+void ProcessThreadImpl::ScheduleModule(ModuleCallback* m, int64_t deadline) {
+  m->next_callback = deadline;
+  ++m->schedule_sequence;
+  module_deadlines_.emplace_back(deadline, m);
+  std::push_heap(module_deadlines_.begin(), module_deadlines_.end());
+}
 }  // namespace webrtc
@@ -16,6 +16,7 @@
 #include <list>
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include "api/task_queue/queued_task.h"
 #include "modules/include/module.h"
@@ -61,11 +62,33 @@ class ProcessThreadImpl : public ProcessThread {
 
     Module* const module;
     int64_t next_callback = 0;  // Absolute timestamp.
+    // Incremented every time the module is (re)scheduled, so entries in
+    // |module_deadlines_| carrying an older sequence can be recognized as
+    // stale and dropped when popped.
+    uint32_t schedule_sequence = 0;
     const rtc::Location location;
 
    private:
     ModuleCallback& operator=(ModuleCallback&);
   };
+  // An entry in the deadline-ordered schedule of module callbacks. Entries
+  // are not removed when a module is rescheduled; they are invalidated via
+  // |schedule_sequence| and skipped when they reach the top of the heap.
+  struct ModuleDeadline {
+    ModuleDeadline(int64_t deadline, ModuleCallback* callback)
+        : deadline(deadline),
+          callback(callback),
+          sequence(callback->schedule_sequence) {}
+    friend bool operator<(const ModuleDeadline& lhs,
+                          const ModuleDeadline& rhs) {
+      // Earliest deadline should be at the top of the heap.
+      return lhs.deadline > rhs.deadline;
+    }
+
+    int64_t deadline;
+    ModuleCallback* callback;
+    uint32_t sequence;
+  };
   struct DelayedTask {
     DelayedTask(int64_t run_at_ms, std::unique_ptr<QueuedTask> task)
         : run_at_ms(run_at_ms), task(task.release()) {}
@@ -86,6 +109,11 @@ class ProcessThreadImpl : public ProcessThread {
 
   void Delete() override;
 
+  // Records |deadline| as |m|'s next callback time and pushes a matching
+  // entry onto |module_deadlines_|, invalidating any entries pushed earlier.
+  void ScheduleModule(ModuleCallback* m, int64_t deadline)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
   // Warning: For some reason, if |lock_| comes immediately before |modules_|
   // with the current class layout, we will  start to have mysterious crashes
   // on Mac 10.9 debug.  I (Tommi) suspect we're hitting some obscure alignemnt
@@ -100,6 +128,10 @@ class ProcessThreadImpl : public ProcessThread {
   std::unique_ptr<rtc::PlatformThread> thread_;
 
   ModuleList modules_;
+  // Min-heap (via std::push_heap/std::pop_heap) over the modules' next
+  // callback times, so Process() only touches modules whose deadline has
+  // expired instead of querying every registered module on each wakeup.
+  std::vector<ModuleDeadline> module_deadlines_ RTC_GUARDED_BY(lock_);
   std::queue<QueuedTask*> queue_;
   std::priority_queue<DelayedTask> delayed_tasks_ RTC_GUARDED_BY(lock_);
   bool stop_;
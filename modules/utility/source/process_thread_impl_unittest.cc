@@ -299,6 +299,48 @@ TEST(ProcessThreadImpl, WakeUp) {
   EXPECT_LE(diff, 100u);
 }
 
+// Tests that waking up one module does not run other modules whose
+// callback deadlines have not expired.
+TEST(ProcessThreadImpl, WakeUpProcessesOnlyTargetModule) {
+  ProcessThreadImpl thread("ProcessThread");
+  thread.Start();
+
+  rtc::Event woken_called;
+
+  MockModule idle_module;
+  int idle_process_count = 0;
+  EXPECT_CALL(idle_module, TimeUntilNextProcess())
+      .WillOnce(Return(0))
+      .WillRepeatedly(Return(10000));
+  EXPECT_CALL(idle_module, Process())
+      .WillRepeatedly(DoAll(Increment(&idle_process_count), Return()));
+  EXPECT_CALL(idle_module, ProcessThreadAttached(&thread)).Times(1);
+
+  MockModule woken_module;
+  EXPECT_CALL(woken_module, TimeUntilNextProcess())
+      .WillRepeatedly(Return(10000));
+  EXPECT_CALL(woken_module, Process())
+      .WillRepeatedly(DoAll(SetEvent(&woken_called), Return()));
+  EXPECT_CALL(woken_module, ProcessThreadAttached(&thread)).Times(1);
+
+  thread.RegisterModule(&idle_module, RTC_FROM_HERE);
+  thread.RegisterModule(&woken_module, RTC_FROM_HERE);
+
+  for (int i = 0; i < 5; ++i) {
+    thread.WakeUp(&woken_module);
+    EXPECT_TRUE(woken_called.Wait(kEventWaitTimeout));
+    woken_called.Reset();
+  }
+
+  EXPECT_CALL(idle_module, ProcessThreadAttached(nullptr)).Times(1);
+  EXPECT_CALL(woken_module, ProcessThreadAttached(nullptr)).Times(1);
+  thread.Stop();
+
+  // The idle module runs once when registered and then not again while only
+  // |woken_module| was woken up.
+  EXPECT_EQ(1, idle_process_count);
+}
+
 // Tests that we can post a task that gets run straight away on the worker
 // thread.
 TEST(ProcessThreadImpl, PostTask) {
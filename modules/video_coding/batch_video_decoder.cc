@@ -0,0 +1,180 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/video_coding/batch_video_decoder.h"
+
+#include <string>
+#include <utility>
+
+#include "modules/video_coding/include/video_error_codes.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+#include "rtc_base/strings/string_builder.h"
+
+namespace webrtc {
+
+class BatchVideoDecoder::StreamContext : public DecodedImageCallback {
+ public:
+  StreamContext(int stream_id,
+                int worker_index,
+                std::unique_ptr<VideoDecoder> decoder,
+                DecodeSink* sink)
+      : stream_id_(stream_id),
+        worker_index_(worker_index),
+        decoder_(std::move(decoder)),
+        sink_(sink) {}
+
+  int worker_index() const { return worker_index_; }
+
+  // Called on the worker queue.
+  void Init(const VideoCodec& settings) {
+    int32_t ret = decoder_->InitDecode(&settings, /*number_of_cores=*/1);
+    if (ret != WEBRTC_VIDEO_CODEC_OK) {
+      RTC_LOG(LS_ERROR) << "Failed to initialize decoder for batch stream "
+                        << stream_id_ << ", error: " << ret;
+      sink_->OnDecodeError(stream_id_, ret);
+      decoder_ = nullptr;
+      return;
+    }
+    decoder_->RegisterDecodeCompleteCallback(this);
+  }
+
+  // Called on the worker queue.
+  void Decode(const EncodedImage& frame, int64_t render_time_ms) {
+    if (!decoder_) {
+      return;
+    }
+    int32_t ret =
+        decoder_->Decode(frame, /*missing_frames=*/false, render_time_ms);
+    if (ret < WEBRTC_VIDEO_CODEC_OK) {
+      sink_->OnDecodeError(stream_id_, ret);
+    }
+  }
+
+  // Called on the worker queue.
+  void Release() {
+    if (decoder_) {
+      decoder_->Release();
+    }
+  }
+
+  // DecodedImageCallback implementation, called by the decoder from within
+  // Decode() on the worker queue.
+  int32_t Decoded(VideoFrame& decoded_image) override {
+    sink_->OnFrameDecoded(stream_id_, decoded_image);
+    return 0;
+  }
+  int32_t Decoded(VideoFrame& decoded_image, int64_t decode_time_ms) override {
+    return Decoded(decoded_image);
+  }
+  void Decoded(VideoFrame& decoded_image,
+               absl::optional<int32_t> decode_time_ms,
+               absl::optional<uint8_t> qp) override {
+    Decoded(decoded_image);
+  }
+
+ private:
+  const int stream_id_;
+  const int worker_index_;
+  std::unique_ptr<VideoDecoder> decoder_;
+  DecodeSink* const sink_;
+};
+
+BatchVideoDecoder::BatchVideoDecoder(VideoDecoderFactory* decoder_factory,
+                                     TaskQueueFactory* task_queue_factory,
+                                     DecodeSink* sink,
+                                     int num_workers)
+    : decoder_factory_(decoder_factory), sink_(sink), next_stream_id_(0) {
+  RTC_DCHECK(decoder_factory_);
+  RTC_DCHECK(sink_);
+  RTC_DCHECK_GT(num_workers, 0);
+  workers_.reserve(num_workers);
+  for (int i = 0; i < num_workers; ++i) {
+    rtc::StringBuilder name;
+    name << "BatchDecoder" << i;
+    workers_.push_back(
+        std::make_unique<rtc::TaskQueue>(task_queue_factory->CreateTaskQueue(
+            name.str(), TaskQueueFactory::Priority::NORMAL)));
+  }
+}
+
+BatchVideoDecoder::~BatchVideoDecoder() {
+  // Release the decoders on their workers, behind any in-flight decodes.
+  {
+    rtc::CritScope cs(&crit_);
+    for (auto& entry : streams_) {
+      StreamContext* stream = entry.second.get();
+      workers_[stream->worker_index()]->PostTask(
+          [stream] { stream->Release(); });
+    }
+  }
+  // Destroying the workers blocks until their current task has finished and
+  // drops tasks still queued. The contexts themselves are released when
+  // |streams_| is destroyed, after the workers have stopped.
+  workers_.clear();
+}
+
+int BatchVideoDecoder::AddStream(const SdpVideoFormat& format,
+                                 const VideoCodec& settings) {
+  std::unique_ptr<VideoDecoder> decoder =
+      decoder_factory_->CreateVideoDecoder(format);
+  if (!decoder) {
+    RTC_LOG(LS_WARNING) << "No decoder for payload format " << format.name;
+    return -1;
+  }
+  rtc::CritScope cs(&crit_);
+  const int stream_id = next_stream_id_++;
+  const int worker_index = stream_id % static_cast<int>(workers_.size());
+  auto context = std::make_unique<StreamContext>(
+      stream_id, worker_index, std::move(decoder), sink_);
+  StreamContext* stream = context.get();
+  streams_[stream_id] = std::move(context);
+  workers_[worker_index]->PostTask(
+      [stream, settings] { stream->Init(settings); });
+  return stream_id;
+}
+
+void BatchVideoDecoder::RemoveStream(int stream_id) {
+  std::unique_ptr<StreamContext> context;
+  {
+    rtc::CritScope cs(&crit_);
+    auto it = streams_.find(stream_id);
+    if (it == streams_.end()) {
+      return;
+    }
+    context = std::move(it->second);
+    streams_.erase(it);
+  }
+  // Queue the release behind the stream's pending decodes; the lambda drops
+  // the last reference to the context when it has run.
+  StreamContext* stream = context.get();
+  workers_[stream->worker_index()]->PostTask(
+      [context = std::move(context)] { context->Release(); });
+}
+
+void BatchVideoDecoder::Decode(int stream_id,
+                               EncodedImage frame,
+                               int64_t render_time_ms) {
+  StreamContext* stream = nullptr;
+  {
+    rtc::CritScope cs(&crit_);
+    auto it = streams_.find(stream_id);
+    if (it == streams_.end()) {
+      return;
+    }
+    stream = it->second.get();
+  }
+  workers_[stream->worker_index()]->PostTask(
+      [stream, frame = std::move(frame), render_time_ms] {
+        stream->Decode(frame, render_time_ms);
+      });
+}
+
+}  // namespace webrtc
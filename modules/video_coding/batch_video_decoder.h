@@ -0,0 +1,95 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef MODULES_VIDEO_CODING_BATCH_VIDEO_DECODER_H_
+#define MODULES_VIDEO_CODING_BATCH_VIDEO_DECODER_H_
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "api/task_queue/task_queue_factory.h"
+#include "api/video/encoded_image.h"
+#include "api/video/video_frame.h"
+#include "api/video_codecs/sdp_video_format.h"
+#include "api/video_codecs/video_codec.h"
+#include "api/video_codecs/video_decoder.h"
+#include "api/video_codecs/video_decoder_factory.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/task_queue.h"
+
+namespace webrtc {
+
+// Decodes encoded frames from many streams on a small, shared pool of worker
+// queues instead of requiring one decode thread per stream. Each stream gets
+// its own decoder instance (decoders are stateful), but all streams assigned
+// to a worker share that worker's thread, so e.g. 500 low resolution streams
+// can be decoded with a handful of threads. Intended for recording and
+// analysis servers; the normal receive path still uses VCMGenericDecoder.
+class BatchVideoDecoder {
+ public:
+  // Receives decode completions for all streams. Called on a worker queue;
+  // calls for one stream are serialized in submission order, calls for
+  // different streams may happen concurrently on different workers.
+  class DecodeSink {
+   public:
+    virtual void OnFrameDecoded(int stream_id, VideoFrame frame) = 0;
+    virtual void OnDecodeError(int stream_id, int32_t error_code) = 0;
+
+   protected:
+    virtual ~DecodeSink() = default;
+  };
+
+  // |decoder_factory|, |task_queue_factory| and |sink| must outlive this
+  // instance. |num_workers| worker queues are created up front.
+  BatchVideoDecoder(VideoDecoderFactory* decoder_factory,
+                    TaskQueueFactory* task_queue_factory,
+                    DecodeSink* sink,
+                    int num_workers);
+  // Stops the workers. Blocks until in-flight decode tasks have finished;
+  // frames still queued behind them are dropped.
+  ~BatchVideoDecoder();
+
+  BatchVideoDecoder(const BatchVideoDecoder&) = delete;
+  BatchVideoDecoder& operator=(const BatchVideoDecoder&) = delete;
+
+  // Registers a stream and creates its decoder on the worker the stream is
+  // assigned to (round-robin). Returns the stream id to use with Decode().
+  // Returns -1 if |decoder_factory| does not support |format|.
+  int AddStream(const SdpVideoFormat& format, const VideoCodec& settings);
+
+  // Releases the stream's decoder once queued frames have been decoded.
+  // Decode() calls for |stream_id| made after this return are dropped.
+  void RemoveStream(int stream_id);
+
+  // Queues |frame| for decoding. Cheap; the payload buffer is refcounted.
+  // For any one stream, AddStream/Decode/RemoveStream must be called from
+  // the same sequence.
+  void Decode(int stream_id, EncodedImage frame, int64_t render_time_ms);
+
+ private:
+  // Owns one stream's decoder and forwards its decode callback, tagged with
+  // the stream id, to the shared sink. Lives on its worker queue after
+  // creation.
+  class StreamContext;
+
+  VideoDecoderFactory* const decoder_factory_;
+  DecodeSink* const sink_;
+  std::vector<std::unique_ptr<rtc::TaskQueue>> workers_;
+
+  rtc::CriticalSection crit_;
+  int next_stream_id_ RTC_GUARDED_BY(crit_);
+  std::map<int, std::unique_ptr<StreamContext>> streams_
+      RTC_GUARDED_BY(crit_);
+};
+
+}  // namespace webrtc
+
+#endif  // MODULES_VIDEO_CODING_BATCH_VIDEO_DECODER_H_
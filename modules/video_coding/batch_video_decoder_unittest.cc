@@ -0,0 +1,149 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "modules/video_coding/batch_video_decoder.h"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "api/task_queue/default_task_queue_factory.h"
+#include "api/video_codecs/sdp_video_format.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/event.h"
+#include "test/fake_decoder.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int64_t kWaitTimeoutMs = 5000;
+
+class FakeDecoderFactory : public VideoDecoderFactory {
+ public:
+  std::vector<SdpVideoFormat> GetSupportedFormats() const override {
+    return {SdpVideoFormat("VP8")};
+  }
+  std::unique_ptr<VideoDecoder> CreateVideoDecoder(
+      const SdpVideoFormat& format) override {
+    return std::make_unique<test::FakeDecoder>();
+  }
+};
+
+class CountingSink : public BatchVideoDecoder::DecodeSink {
+ public:
+  void OnFrameDecoded(int stream_id, VideoFrame frame) override {
+    rtc::CritScope cs(&lock_);
+    ++decoded_frames_[stream_id];
+    if (--expected_frames_ == 0) {
+      all_frames_decoded_.Set();
+    }
+  }
+
+  void OnDecodeError(int stream_id, int32_t error_code) override {
+    rtc::CritScope cs(&lock_);
+    ++errors_;
+  }
+
+  void ExpectFrames(int num_frames) {
+    rtc::CritScope cs(&lock_);
+    expected_frames_ = num_frames;
+  }
+
+  bool WaitForExpectedFrames() {
+    return all_frames_decoded_.Wait(kWaitTimeoutMs);
+  }
+
+  int decoded_frames(int stream_id) {
+    rtc::CritScope cs(&lock_);
+    return decoded_frames_[stream_id];
+  }
+
+  int errors() {
+    rtc::CritScope cs(&lock_);
+    return errors_;
+  }
+
+ private:
+  rtc::CriticalSection lock_;
+  std::map<int, int> decoded_frames_ RTC_GUARDED_BY(lock_);
+  int expected_frames_ RTC_GUARDED_BY(lock_) = 0;
+  int errors_ RTC_GUARDED_BY(lock_) = 0;
+  rtc::Event all_frames_decoded_;
+};
+
+EncodedImage MakeEncodedFrame(uint32_t timestamp) {
+  EncodedImage frame;
+  frame.SetEncodedData(EncodedImageBuffer::Create(/*size=*/100));
+  frame.SetTimestamp(timestamp);
+  frame._frameType = VideoFrameType::kVideoFrameKey;
+  return frame;
+}
+
+TEST(BatchVideoDecoderTest, DecodesManyStreamsOnFewWorkers) {
+  FakeDecoderFactory decoder_factory;
+  std::unique_ptr<TaskQueueFactory> task_queue_factory =
+      CreateDefaultTaskQueueFactory();
+  CountingSink sink;
+  BatchVideoDecoder batch_decoder(&decoder_factory, task_queue_factory.get(),
+                                  &sink, /*num_workers=*/2);
+
+  constexpr int kNumStreams = 10;
+  constexpr int kFramesPerStream = 5;
+  VideoCodec settings;
+  settings.codecType = kVideoCodecVP8;
+  std::vector<int> stream_ids;
+  for (int i = 0; i < kNumStreams; ++i) {
+    int stream_id = batch_decoder.AddStream(SdpVideoFormat("VP8"), settings);
+    ASSERT_NE(stream_id, -1);
+    stream_ids.push_back(stream_id);
+  }
+
+  sink.ExpectFrames(kNumStreams * kFramesPerStream);
+  for (int frame = 0; frame < kFramesPerStream; ++frame) {
+    for (int stream_id : stream_ids) {
+      batch_decoder.Decode(stream_id,
+                           MakeEncodedFrame(/*timestamp=*/90 * frame),
+                           /*render_time_ms=*/0);
+    }
+  }
+  EXPECT_TRUE(sink.WaitForExpectedFrames());
+  for (int stream_id : stream_ids) {
+    EXPECT_EQ(sink.decoded_frames(stream_id), kFramesPerStream);
+  }
+  EXPECT_EQ(sink.errors(), 0);
+}
+
+TEST(BatchVideoDecoderTest, DropsFramesForRemovedStream) {
+  FakeDecoderFactory decoder_factory;
+  std::unique_ptr<TaskQueueFactory> task_queue_factory =
+      CreateDefaultTaskQueueFactory();
+  CountingSink sink;
+  BatchVideoDecoder batch_decoder(&decoder_factory, task_queue_factory.get(),
+                                  &sink, /*num_workers=*/1);
+
+  VideoCodec settings;
+  settings.codecType = kVideoCodecVP8;
+  int stream_id = batch_decoder.AddStream(SdpVideoFormat("VP8"), settings);
+  ASSERT_NE(stream_id, -1);
+
+  sink.ExpectFrames(1);
+  batch_decoder.Decode(stream_id, MakeEncodedFrame(/*timestamp=*/0),
+                       /*render_time_ms=*/0);
+  EXPECT_TRUE(sink.WaitForExpectedFrames());
+
+  batch_decoder.RemoveStream(stream_id);
+  batch_decoder.Decode(stream_id, MakeEncodedFrame(/*timestamp=*/90),
+                       /*render_time_ms=*/0);
+  EXPECT_EQ(sink.decoded_frames(stream_id), 1);
+}
+
+}  // namespace
+}  // namespace webrtc
@@ -491,10 +491,20 @@ int32_t H264EncoderImpl::Encode(
     // Encoder can skip frames to save bandwidth in which case
     // |encoded_images_[i]._length| == 0.
     if (encoded_images_[i].size() > 0) {
-      // Parse QP.
-      h264_bitstream_parser_.ParseBitstream(encoded_images_[i].data(),
-                                            encoded_images_[i].size());
-      h264_bitstream_parser_.GetLastSliceQp(&encoded_images_[i].qp_);
+      // Get the QP from the encoder instead of re-parsing the bitstream we
+      // just produced. The statistics QP is averaged over recently encoded
+      // frames, which is accurate enough for the consumers of |qp_| (the
+      // quality scaler and stats), and skips a bitstream parse per frame.
+      SEncoderStatistics encoder_stats;
+      if (encoders_[i]->GetOption(ENCODER_OPTION_GET_STATISTICS,
+                                  &encoder_stats) == cmResultSuccess) {
+        encoded_images_[i].qp_ = encoder_stats.uiAverageFrameQP;
+      } else {
+        // Fall back to parsing the QP out of the bitstream.
+        h264_bitstream_parser_.ParseBitstream(encoded_images_[i].data(),
+                                              encoded_images_[i].size());
+        h264_bitstream_parser_.GetLastSliceQp(&encoded_images_[i].qp_);
+      }
 
       // Deliver encoded image.
       CodecSpecificInfo codec_specific;
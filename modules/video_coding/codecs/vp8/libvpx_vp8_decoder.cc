@@ -23,8 +23,10 @@
 #include "api/video/video_frame.h"
 #include "api/video/video_frame_buffer.h"
 #include "api/video/video_rotation.h"
+#include "common_video/include/video_frame_buffer.h"
 #include "modules/video_coding/codecs/vp8/include/vp8.h"
 #include "modules/video_coding/include/video_error_codes.h"
+#include "rtc_base/callback.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/numerics/exp_filter.h"
 #include "rtc_base/time_utils.h"
@@ -96,8 +98,11 @@ class LibvpxVp8Decoder::QpSmoother {
   rtc::ExpFilter smoother_;
 };
 
-LibvpxVp8Decoder::LibvpxVp8Decoder()
-    : use_postproc_arm_(
+LibvpxVp8Decoder::LibvpxVp8Decoder() : LibvpxVp8Decoder(Config()) {}
+
+LibvpxVp8Decoder::LibvpxVp8Decoder(Config config)
+    : config_(config),
+      use_postproc_arm_(
           webrtc::field_trial::IsEnabled(kVp8PostProcArmFieldTrial)),
       buffer_pool_(false, 300 /* max_number_of_buffers*/),
       decode_complete_callback_(NULL),
@@ -133,9 +138,12 @@ int LibvpxVp8Decoder::InitDecode(const VideoCodec* inst, int number_of_cores) {
 
 #if defined(WEBRTC_ARCH_ARM) || defined(WEBRTC_ARCH_ARM64) || \
     defined(WEBRTC_ANDROID)
-  vpx_codec_flags_t flags = use_postproc_arm_ ? VPX_CODEC_USE_POSTPROC : 0;
+  vpx_codec_flags_t flags = use_postproc_arm_ && !config_.disable_postproc
+                                ? VPX_CODEC_USE_POSTPROC
+                                : 0;
 #else
-  vpx_codec_flags_t flags = VPX_CODEC_USE_POSTPROC;
+  vpx_codec_flags_t flags =
+      config_.disable_postproc ? 0 : VPX_CODEC_USE_POSTPROC;
 #endif
 
   if (vpx_codec_dec_init(decoder_, vpx_codec_vp8_dx(), &cfg, flags)) {
@@ -176,7 +184,7 @@ int LibvpxVp8Decoder::Decode(const EncodedImage& input_image,
 // Post process configurations.
 #if defined(WEBRTC_ARCH_ARM) || defined(WEBRTC_ARCH_ARM64) || \
     defined(WEBRTC_ANDROID)
-  if (use_postproc_arm_) {
+  if (use_postproc_arm_ && !config_.disable_postproc) {
     vp8_postproc_cfg_t ppcfg;
     ppcfg.post_proc_flag = VP8_MFQE;
     // For low resolutions, use stronger deblocking filter.
@@ -200,16 +208,18 @@ int LibvpxVp8Decoder::Decode(const EncodedImage& input_image,
     vpx_codec_control(decoder_, VP8_SET_POSTPROC, &ppcfg);
   }
 #else
-  vp8_postproc_cfg_t ppcfg;
-  // MFQE enabled to reduce key frame popping.
-  ppcfg.post_proc_flag = VP8_MFQE | VP8_DEBLOCK;
-  // For VGA resolutions and lower, enable the demacroblocker postproc.
-  if (last_frame_width_ * last_frame_height_ <= 640 * 360) {
-    ppcfg.post_proc_flag |= VP8_DEMACROBLOCK;
+  if (!config_.disable_postproc) {
+    vp8_postproc_cfg_t ppcfg;
+    // MFQE enabled to reduce key frame popping.
+    ppcfg.post_proc_flag = VP8_MFQE | VP8_DEBLOCK;
+    // For VGA resolutions and lower, enable the demacroblocker postproc.
+    if (last_frame_width_ * last_frame_height_ <= 640 * 360) {
+      ppcfg.post_proc_flag |= VP8_DEMACROBLOCK;
+    }
+    // Strength of deblocking filter. Valid range:[0,16]
+    ppcfg.deblocking_level = 3;
+    vpx_codec_control(decoder_, VP8_SET_POSTPROC, &ppcfg);
   }
-  // Strength of deblocking filter. Valid range:[0,16]
-  ppcfg.deblocking_level = 3;
-  vpx_codec_control(decoder_, VP8_SET_POSTPROC, &ppcfg);
 #endif
 
   // Always start with a complete key frame.
@@ -306,23 +316,37 @@ int LibvpxVp8Decoder::ReturnFrame(
   }
   last_frame_width_ = img->d_w;
   last_frame_height_ = img->d_h;
-  // Allocate memory for decoded image.
-  rtc::scoped_refptr<I420Buffer> buffer =
-      buffer_pool_.CreateBuffer(img->d_w, img->d_h);
-  if (!buffer.get()) {
-    // Pool has too many pending frames.
-    RTC_HISTOGRAM_BOOLEAN("WebRTC.Video.LibvpxVp8Decoder.TooManyPendingFrames",
-                          1);
-    return WEBRTC_VIDEO_CODEC_NO_OUTPUT;
-  }
+  rtc::scoped_refptr<VideoFrameBuffer> buffer;
+  if (config_.zero_copy_output) {
+    // Wrap libvpx's internal frame buffer without copying. Unlike VP9, the
+    // VP8 decoder does not support external frame buffers, so the wrapped
+    // planes are only valid until the next vpx_codec_decode() call; the
+    // decode callback has to consume the frame synchronously and there is
+    // nothing to release afterwards.
+    buffer = WrapI420Buffer(img->d_w, img->d_h, img->planes[VPX_PLANE_Y],
+                            img->stride[VPX_PLANE_Y], img->planes[VPX_PLANE_U],
+                            img->stride[VPX_PLANE_U], img->planes[VPX_PLANE_V],
+                            img->stride[VPX_PLANE_V], rtc::Callback0<void>());
+  } else {
+    // Allocate memory for decoded image.
+    rtc::scoped_refptr<I420Buffer> i420_buffer =
+        buffer_pool_.CreateBuffer(img->d_w, img->d_h);
+    if (!i420_buffer.get()) {
+      // Pool has too many pending frames.
+      RTC_HISTOGRAM_BOOLEAN(
+          "WebRTC.Video.LibvpxVp8Decoder.TooManyPendingFrames", 1);
+      return WEBRTC_VIDEO_CODEC_NO_OUTPUT;
+    }
 
-  libyuv::I420Copy(img->planes[VPX_PLANE_Y], img->stride[VPX_PLANE_Y],
-                   img->planes[VPX_PLANE_U], img->stride[VPX_PLANE_U],
-                   img->planes[VPX_PLANE_V], img->stride[VPX_PLANE_V],
-                   buffer->MutableDataY(), buffer->StrideY(),
-                   buffer->MutableDataU(), buffer->StrideU(),
-                   buffer->MutableDataV(), buffer->StrideV(), img->d_w,
-                   img->d_h);
+    libyuv::I420Copy(img->planes[VPX_PLANE_Y], img->stride[VPX_PLANE_Y],
+                     img->planes[VPX_PLANE_U], img->stride[VPX_PLANE_U],
+                     img->planes[VPX_PLANE_V], img->stride[VPX_PLANE_V],
+                     i420_buffer->MutableDataY(), i420_buffer->StrideY(),
+                     i420_buffer->MutableDataU(), i420_buffer->StrideU(),
+                     i420_buffer->MutableDataV(), i420_buffer->StrideV(),
+                     img->d_w, img->d_h);
+    buffer = i420_buffer;
+  }
 
   VideoFrame decoded_image = VideoFrame::Builder()
                                  .set_video_frame_buffer(buffer)
@@ -25,7 +25,21 @@ namespace webrtc {
 
 class LibvpxVp8Decoder : public VideoDecoder {
  public:
+  // Decode behavior tweaks, mainly for offline analysis pipelines.
+  struct Config {
+    // Skips all libvpx postprocessing (deblocking, MFQE). Saves a
+    // significant share of the decode cost when the visual quality of the
+    // output is not a concern.
+    bool disable_postproc = false;
+    // Delivers decoded frames wrapping libvpx's internal image planes
+    // instead of copying them into pool backed I420 buffers. The wrapped
+    // planes are only valid until the next Decode() call, so the decode
+    // callback must consume (or copy) the frame synchronously.
+    bool zero_copy_output = false;
+  };
+
   LibvpxVp8Decoder();
+  explicit LibvpxVp8Decoder(Config config);
   ~LibvpxVp8Decoder() override;
 
   int InitDecode(const VideoCodec* inst, int number_of_cores) override;
@@ -51,6 +65,7 @@ class LibvpxVp8Decoder : public VideoDecoder {
                   uint32_t timeStamp,
                   int qp,
                   const webrtc::ColorSpace* explicit_color_space);
+  const Config config_;
   const bool use_postproc_arm_;
 
   I420BufferPool buffer_pool_;
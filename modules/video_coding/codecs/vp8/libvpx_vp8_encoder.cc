@@ -306,6 +306,7 @@ int LibvpxVp8Encoder::Release() {
   int ret_val = WEBRTC_VIDEO_CODEC_OK;
 
   encoded_images_.clear();
+  encoded_buffer_pool_.Release();
 
   if (inited_) {
     for (auto it = encoders_.rbegin(); it != encoders_.rend(); ++it) {
@@ -1147,9 +1148,11 @@ int LibvpxVp8Encoder::GetEncodedPartitions(const VideoFrame& input_image,
       }
     }
 
-    // TODO(nisse): Introduce some buffer cache or buffer pool, to reduce
-    // allocations and/or copy operations.
-    auto buffer = EncodedImageBuffer::Create(encoded_size);
+    rtc::scoped_refptr<EncodedImageBuffer> buffer =
+        encoded_buffer_pool_.GetBuffer(encoded_size);
+    if (!buffer) {
+      buffer = EncodedImageBuffer::Create(encoded_size);
+    }
 
     iter = NULL;
     size_t encoded_pos = 0;
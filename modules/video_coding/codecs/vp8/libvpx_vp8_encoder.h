@@ -21,6 +21,7 @@
 #include "api/video_codecs/video_encoder.h"
 #include "api/video_codecs/vp8_frame_buffer_controller.h"
 #include "api/video_codecs/vp8_frame_config.h"
+#include "common_video/include/encoded_image_buffer_pool.h"
 #include "modules/video_coding/codecs/vp8/include/vp8.h"
 #include "modules/video_coding/codecs/vp8/libvpx_interface.h"
 #include "modules/video_coding/include/video_codec_interface.h"
@@ -118,6 +119,9 @@ class LibvpxVp8Encoder : public VideoEncoder {
   std::vector<int> cpu_speed_;
   std::vector<vpx_image_t> raw_images_;
   std::vector<EncodedImage> encoded_images_;
+  // Recycles the buffers backing |encoded_images_| between frames, so the
+  // bitstream copy out of libvpx is the only per-frame work left on this path.
+  EncodedImageBufferPool encoded_buffer_pool_;
   std::vector<vpx_codec_ctx_t> encoders_;
   std::vector<vpx_codec_enc_cfg_t> vpx_configs_;
   std::vector<Vp8EncoderConfig> config_overrides_;
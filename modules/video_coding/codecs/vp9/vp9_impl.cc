@@ -219,6 +219,10 @@ VP9EncoderImpl::VP9EncoderImpl(const cricket::VideoCodec& codec)
       inited_(false),
       timestamp_(0),
       cpu_speed_(3),
+      adaptive_speed_enabled_(false),
+      base_cpu_speed_(3),
+      speed_window_bytes_(0),
+      speed_window_frames_(0),
       rc_max_intra_target_(0),
       encoder_(nullptr),
       config_(nullptr),
@@ -267,6 +271,8 @@ void VP9EncoderImpl::SetFecControllerOverride(
 int VP9EncoderImpl::Release() {
   int ret_val = WEBRTC_VIDEO_CODEC_OK;
 
+  encoded_buffer_pool_.Release();
+
   if (encoder_ != nullptr) {
     if (inited_) {
       if (vpx_codec_destroy(encoder_)) {
@@ -563,11 +569,23 @@ int VP9EncoderImpl::InitEncode(const VideoCodec* inst,
   config_->kf_max_dist = inst->VP9().keyFrameInterval;
   config_->kf_min_dist = config_->kf_max_dist;
   config_->rc_resize_allowed = inst->VP9().automaticResizeOn ? 1 : 0;
-  // Determine number of threads based on the image size and #cores.
-  config_->g_threads =
-      NumberOfThreads(config_->g_w, config_->g_h, settings.number_of_cores);
+  // Determine number of threads based on the image size and #cores, unless
+  // an explicit cap is configured.
+  if (inst->VP9().maxEncoderThreads > 0) {
+    config_->g_threads = std::min(inst->VP9().maxEncoderThreads,
+                                  static_cast<int>(settings.number_of_cores));
+  } else {
+    config_->g_threads =
+        NumberOfThreads(config_->g_w, config_->g_h, settings.number_of_cores);
+  }
 
   cpu_speed_ = GetCpuSpeed(config_->g_w, config_->g_h);
+  base_cpu_speed_ = cpu_speed_;
+  // Speed adaptation only handles the single layer rate control mode.
+  adaptive_speed_enabled_ =
+      inst->VP9().adaptiveSpeedOn && num_spatial_layers_ == 1;
+  speed_window_bytes_ = 0;
+  speed_window_frames_ = 0;
 
   is_flexible_mode_ = inst->VP9().flexibleMode;
 
@@ -646,7 +664,9 @@ int VP9EncoderImpl::NumberOfThreads(int width,
                                     int number_of_cores) {
   // Keep the number of encoder threads equal to the possible number of column
   // tiles, which is (1, 2, 4, 8). See comments below for VP9E_SET_TILE_COLUMNS.
-  if (width * height >= 1280 * 720 && number_of_cores > 4) {
+  if (width * height >= 1920 * 1080 && number_of_cores > 8) {
+    return 8;
+  } else if (width * height >= 1280 * 720 && number_of_cores > 4) {
     return 4;
   } else if (width * height >= 640 * 360 && number_of_cores > 2) {
     return 2;
@@ -736,7 +756,8 @@ int VP9EncoderImpl::InitAndSetControlSettings(const VideoCodec* inst) {
   vpx_codec_control(encoder_, VP9E_SET_AQ_MODE,
                     inst->VP9().adaptiveQpMode ? 3 : 0);
 
-  vpx_codec_control(encoder_, VP9E_SET_FRAME_PARALLEL_DECODING, 0);
+  vpx_codec_control(encoder_, VP9E_SET_FRAME_PARALLEL_DECODING,
+                    inst->VP9().frameParallelDecodingOn ? 1 : 0);
   vpx_codec_control(encoder_, VP9E_SET_SVC_GF_TEMPORAL_REF, 0);
 
   if (is_svc_) {
@@ -804,11 +825,15 @@ int VP9EncoderImpl::InitAndSetControlSettings(const VideoCodec* inst) {
   // Control function to set the number of column tiles in encoding a frame, in
   // log2 unit: e.g., 0 = 1 tile column, 1 = 2 tile columns, 2 = 4 tile columns.
   // The number tile columns will be capped by the encoder based on image size
-  // (minimum width of tile column is 256 pixels, maximum is 4096).
-  vpx_codec_control(encoder_, VP9E_SET_TILE_COLUMNS, (config_->g_threads >> 1));
+  // (minimum width of tile column is 256 pixels, maximum is 4096). Unless
+  // configured explicitly, use one tile column per thread pair.
+  vpx_codec_control(encoder_, VP9E_SET_TILE_COLUMNS,
+                    inst->VP9().tileColumnsLog2 >= 0
+                        ? inst->VP9().tileColumnsLog2
+                        : static_cast<int>(config_->g_threads >> 1));
 
-  // Turn on row-based multithreading.
-  vpx_codec_control(encoder_, VP9E_SET_ROW_MT, 1);
+  // Turn on row-based multithreading, unless disabled.
+  vpx_codec_control(encoder_, VP9E_SET_ROW_MT, inst->VP9().rowMtOn ? 1 : 0);
 
 #if !defined(WEBRTC_ARCH_ARM) && !defined(WEBRTC_ARCH_ARM64) && \
     !defined(ANDROID)
@@ -1057,6 +1082,11 @@ int VP9EncoderImpl::Encode(const VideoFrame& input_image,
   }
   timestamp_ += duration;
 
+  if (adaptive_speed_enabled_) {
+    ++speed_window_frames_;
+    MaybeAdaptSpeed();
+  }
+
   if (layer_buffering_) {
     const bool end_of_picture = true;
     DeliverBufferedFrame(end_of_picture);
@@ -1065,6 +1095,39 @@ int VP9EncoderImpl::Encode(const VideoFrame& input_image,
   return WEBRTC_VIDEO_CODEC_OK;
 }
 
+void VP9EncoderImpl::MaybeAdaptSpeed() {
+  RTC_DCHECK(adaptive_speed_enabled_);
+  const int window_frames =
+      std::max(15, static_cast<int>(codec_.maxFramerate));
+  if (speed_window_frames_ < window_frames) {
+    return;
+  }
+  const int64_t target_bps = current_bitrate_allocation_.get_sum_bps();
+  if (target_bps > 0) {
+    // Average bitrate produced over the window, assuming the frames were
+    // spaced at the nominal frame rate.
+    const int64_t produced_bps = static_cast<int64_t>(speed_window_bytes_) *
+                                 8 * codec_.maxFramerate /
+                                 speed_window_frames_;
+    int new_speed = cpu_speed_;
+    if (produced_bps * 100 > target_bps * 115) {
+      // Overshooting; trade some quality for a faster encode to let rate
+      // control catch up. 8 is the fastest usable real-time speed setting.
+      new_speed = std::min(cpu_speed_ + 1, 8);
+    } else if (produced_bps * 100 < target_bps * 85) {
+      // Rate control has recovered; restore quality towards the configured
+      // speed setting.
+      new_speed = std::max(cpu_speed_ - 1, base_cpu_speed_);
+    }
+    if (new_speed != cpu_speed_) {
+      cpu_speed_ = new_speed;
+      vpx_codec_control(encoder_, VP8E_SET_CPUUSED, cpu_speed_);
+    }
+  }
+  speed_window_bytes_ = 0;
+  speed_window_frames_ = 0;
+}
+
 void VP9EncoderImpl::PopulateCodecSpecific(CodecSpecificInfo* codec_specific,
                                            absl::optional<int>* spatial_idx,
                                            const vpx_codec_cx_pkt& pkt,
@@ -1451,10 +1514,15 @@ int VP9EncoderImpl::GetEncodedLayerFrame(const vpx_codec_cx_pkt* pkt) {
     DeliverBufferedFrame(end_of_picture);
   }
 
-  // TODO(nisse): Introduce some buffer cache or buffer pool, to reduce
-  // allocations and/or copy operations.
-  encoded_image_.SetEncodedData(EncodedImageBuffer::Create(
-      static_cast<const uint8_t*>(pkt->data.frame.buf), pkt->data.frame.sz));
+  rtc::scoped_refptr<EncodedImageBuffer> buffer =
+      encoded_buffer_pool_.GetBuffer(pkt->data.frame.sz);
+  if (!buffer) {
+    buffer = EncodedImageBuffer::Create(pkt->data.frame.sz);
+  }
+  memcpy(buffer->data(), pkt->data.frame.buf, pkt->data.frame.sz);
+  encoded_image_.SetEncodedData(buffer);
+  encoded_image_.set_size(pkt->data.frame.sz);
+  speed_window_bytes_ += pkt->data.frame.sz;
 
   const bool is_key_frame =
       (pkt->data.frame.flags & VPX_FRAME_IS_KEY) ? true : false;
@@ -21,6 +21,7 @@
 
 #include "api/fec_controller_override.h"
 #include "api/video_codecs/video_encoder.h"
+#include "common_video/include/encoded_image_buffer_pool.h"
 #include "media/base/vp9_profile.h"
 #include "modules/video_coding/codecs/vp9/include/vp9.h"
 #include "modules/video_coding/codecs/vp9/vp9_frame_buffer_pool.h"
@@ -88,6 +89,10 @@ class VP9EncoderImpl : public VP9Encoder {
 
   bool DropFrame(uint8_t spatial_idx, uint32_t rtp_timestamp);
 
+  // Adjusts the libvpx speed setting based on the bitrate produced over the
+  // last adaptation window. Only active with |adaptive_speed_enabled_|.
+  void MaybeAdaptSpeed();
+
   // Determine maximum target for Intra frames
   //
   // Input:
@@ -99,6 +104,8 @@ class VP9EncoderImpl : public VP9Encoder {
   size_t SteadyStateSize(int sid, int tid);
 
   EncodedImage encoded_image_;
+  // Recycles the buffers backing |encoded_image_| between frames.
+  EncodedImageBufferPool encoded_buffer_pool_;
   CodecSpecificInfo codec_specific_;
   EncodedImageCallback* encoded_complete_callback_;
   VideoCodec codec_;
@@ -106,6 +113,11 @@ class VP9EncoderImpl : public VP9Encoder {
   bool inited_;
   int64_t timestamp_;
   int cpu_speed_;
+  // Overshoot driven speed adaptation, see VideoCodecVP9::adaptiveSpeedOn.
+  bool adaptive_speed_enabled_;
+  int base_cpu_speed_;
+  size_t speed_window_bytes_;
+  int speed_window_frames_;
   uint32_t rc_max_intra_target_;
   vpx_codec_ctx_t* encoder_;
   vpx_codec_enc_cfg_t* config_;
@@ -10,10 +10,92 @@
 
 #include "modules/video_coding/decoder_database.h"
 
+#include <utility>
+#include <vector>
+
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
+#include "rtc_base/strings/string_builder.h"
 
 namespace webrtc {
+namespace {
+
+// Upper bound on the number of parked decoder instances. Parked hardware
+// decoders can pin scarce codec sessions, so keep the cache small.
+constexpr size_t kMaxCachedDecoderInstances = 8;
+
+}  // namespace
+
+VideoDecoderInstanceCache* VideoDecoderInstanceCache::GetInstance() {
+  static VideoDecoderInstanceCache* const instance =
+      new VideoDecoderInstanceCache();
+  return instance;
+}
+
+// static
+std::string VideoDecoderInstanceCache::MakeKey(const SdpVideoFormat& format,
+                                               const std::string& stream_id) {
+  rtc::StringBuilder sb;
+  sb << format.name << "|" << stream_id;
+  // |parameters| is an ordered map, so equal formats produce equal keys.
+  for (const auto& param : format.parameters)
+    sb << "|" << param.first << "=" << param.second;
+  return sb.Release();
+}
+
+std::unique_ptr<VideoDecoder> VideoDecoderInstanceCache::Retrieve(
+    const void* owner,
+    const std::string& key) {
+  rtc::CritScope cs(&lock_);
+  for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+    if (it->owner == owner && it->key == key) {
+      std::unique_ptr<VideoDecoder> decoder = std::move(it->decoder);
+      entries_.erase(it);
+      return decoder;
+    }
+  }
+  return nullptr;
+}
+
+void VideoDecoderInstanceCache::Park(const void* owner,
+                                     const std::string& key,
+                                     std::unique_ptr<VideoDecoder> decoder) {
+  if (!decoder)
+    return;
+  // Destroy evicted decoders outside the lock; decoder teardown can be slow.
+  std::vector<std::unique_ptr<VideoDecoder>> evicted;
+  {
+    rtc::CritScope cs(&lock_);
+    entries_.push_front({owner, key, std::move(decoder)});
+    while (entries_.size() > kMaxCachedDecoderInstances) {
+      evicted.push_back(std::move(entries_.back().decoder));
+      entries_.pop_back();
+    }
+  }
+}
+
+void VideoDecoderInstanceCache::EvictOwner(const void* owner) {
+  std::vector<std::unique_ptr<VideoDecoder>> evicted;
+  {
+    rtc::CritScope cs(&lock_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (it->owner == owner) {
+        evicted.push_back(std::move(it->decoder));
+        it = entries_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+void VideoDecoderInstanceCache::Flush() {
+  std::list<Entry> entries;
+  {
+    rtc::CritScope cs(&lock_);
+    entries.swap(entries_);
+  }
+}
 
 VCMDecoderMapItem::VCMDecoderMapItem(VideoCodec* settings,
                                      int number_of_cores,
@@ -11,13 +11,73 @@
 #ifndef MODULES_VIDEO_CODING_DECODER_DATABASE_H_
 #define MODULES_VIDEO_CODING_DECODER_DATABASE_H_
 
+#include <list>
 #include <map>
 #include <memory>
+#include <string>
 
+#include "api/video_codecs/sdp_video_format.h"
 #include "modules/video_coding/generic_decoder.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/thread_annotations.h"
 
 namespace webrtc {
 
+// A process-wide cache of initialized VideoDecoder instances. Creating a
+// decoder can take hundreds of milliseconds for some hardware
+// implementations, a price paid on every Start() of a receive stream even
+// when an equivalent decoder was torn down moments earlier (e.g. a viewer
+// pausing and resuming a layer). Receive streams park their decoders here on
+// Stop() and try to reattach a matching instance on Start() instead of going
+// through the decoder factory again. Entries are keyed by the SDP video
+// format and the stream id the decoder was created for, and are evicted in
+// least-recently-parked order when the cache is full.
+//
+// Every entry is tagged with an |owner|, and owners must call EvictOwner()
+// before they are destroyed: a parked decoder may reference objects (e.g.
+// the decoder factory) whose lifetime the owner controls, so it must never
+// outlive it. All methods may be called from any thread.
+class VideoDecoderInstanceCache {
+ public:
+  static VideoDecoderInstanceCache* GetInstance();
+
+  // Builds the cache key for a decoder created for |format| on the stream
+  // identified by |stream_id|.
+  static std::string MakeKey(const SdpVideoFormat& format,
+                             const std::string& stream_id);
+
+  // Returns a previously parked decoder matching |owner| and |key|, or
+  // nullptr if none is cached. The returned decoder is removed from the
+  // cache.
+  std::unique_ptr<VideoDecoder> Retrieve(const void* owner,
+                                         const std::string& key);
+
+  // Parks an initialized decoder for later reattachment. If the cache is
+  // full, the least recently parked decoder is destroyed.
+  void Park(const void* owner,
+            const std::string& key,
+            std::unique_ptr<VideoDecoder> decoder);
+
+  // Destroys all decoders parked by |owner|.
+  void EvictOwner(const void* owner);
+
+  // Destroys all parked decoders.
+  void Flush();
+
+ private:
+  struct Entry {
+    const void* owner;
+    std::string key;
+    std::unique_ptr<VideoDecoder> decoder;
+  };
+
+  VideoDecoderInstanceCache() = default;
+
+  rtc::CriticalSection lock_;
+  // Most recently parked first.
+  std::list<Entry> entries_ RTC_GUARDED_BY(lock_);
+};
+
 struct VCMDecoderMapItem {
  public:
   VCMDecoderMapItem(VideoCodec* settings,
@@ -58,6 +58,7 @@ void FecControllerDefault::SetEncodingData(size_t width,
   loss_prot_logic_->UpdateFrameSize(width, height);
   loss_prot_logic_->UpdateNumLayers(num_temporal_layers);
   max_payload_size_ = max_payload_size;
+  profile_valid_ = false;
 }
 
 float FecControllerDefault::GetProtectionOverheadRateThreshold() {
@@ -113,25 +114,41 @@ uint32_t FecControllerDefault::UpdateFecRates(
     if (loss_prot_logic_->SelectedType() == media_optimization::kNone) {
       return estimated_bitrate_bps;
     }
-    // Update method will compute the robustness settings for the given
-    // protection method and the overhead cost
-    // the protection method is set by the user via SetVideoProtection.
-    loss_prot_logic_->UpdateMethod();
-    // Get the bit cost of protection method, based on the amount of
-    // overhead data actually transmitted (including headers) the last
-    // second.
-    // Get the FEC code rate for Key frames (set to 0 when NA).
-    key_fec_params.fec_rate =
-        loss_prot_logic_->SelectedMethod()->RequiredProtectionFactorK();
-    // Get the FEC code rate for Delta frames (set to 0 when NA).
-    delta_fec_params.fec_rate =
-        loss_prot_logic_->SelectedMethod()->RequiredProtectionFactorD();
-    // The RTP module currently requires the same |max_fec_frames| for both
-    // key and delta frames.
-    delta_fec_params.max_fec_frames =
-        loss_prot_logic_->SelectedMethod()->MaxFramesFec();
-    key_fec_params.max_fec_frames =
-        loss_prot_logic_->SelectedMethod()->MaxFramesFec();
+    // The protection factors are a pure function of the quantized inputs
+    // below (plus the slower-moving per-frame state tracked in
+    // UpdateWithEncodedData() and SetEncodingData(), which invalidate the
+    // cache when they shift). Skip re-running the filter math while the
+    // inputs land in the same buckets as the previous update.
+    ProtectionProfileKey key;
+    key.packet_loss = packet_loss_enc;
+    key.rtt_bucket = round_trip_time_ms / 10;
+    key.bitrate_bucket_kbps = static_cast<int>(target_bitrate_kbps / 50);
+    key.framerate_fps = actual_framerate_fps;
+    if (!profile_valid_ || key != profile_key_) {
+      // Update method will compute the robustness settings for the given
+      // protection method and the overhead cost
+      // the protection method is set by the user via SetVideoProtection.
+      loss_prot_logic_->UpdateMethod();
+      // Get the bit cost of protection method, based on the amount of
+      // overhead data actually transmitted (including headers) the last
+      // second.
+      // Get the FEC code rate for Key frames (set to 0 when NA).
+      cached_key_fec_params_.fec_rate =
+          loss_prot_logic_->SelectedMethod()->RequiredProtectionFactorK();
+      // Get the FEC code rate for Delta frames (set to 0 when NA).
+      cached_delta_fec_params_.fec_rate =
+          loss_prot_logic_->SelectedMethod()->RequiredProtectionFactorD();
+      // The RTP module currently requires the same |max_fec_frames| for both
+      // key and delta frames.
+      cached_delta_fec_params_.max_fec_frames =
+          loss_prot_logic_->SelectedMethod()->MaxFramesFec();
+      cached_key_fec_params_.max_fec_frames =
+          loss_prot_logic_->SelectedMethod()->MaxFramesFec();
+      profile_key_ = key;
+      profile_valid_ = true;
+    }
+    delta_fec_params = cached_delta_fec_params_;
+    key_fec_params = cached_key_fec_params_;
   }
   // Set the FEC packet mask type. |kFecMaskBursty| is more effective for
   // consecutive losses and little/no packet re-ordering. As we currently
@@ -177,6 +194,7 @@ void FecControllerDefault::SetProtectionMethod(bool enable_fec,
   }
   CritScope lock(&crit_sect_);
   loss_prot_logic_->SetMethod(method);
+  profile_valid_ = false;
 }
 
 void FecControllerDefault::UpdateWithEncodedData(
@@ -193,9 +211,21 @@ void FecControllerDefault::UpdateWithEncodedData(
       if (delta_frame) {
         loss_prot_logic_->UpdatePacketsPerFrame(min_packets_per_frame,
                                                 clock_->TimeInMilliseconds());
+        // The filtered packets-per-frame feeds the protection tables, but
+        // only integer steps move them; invalidate the cached profile only
+        // when the bucket changes.
+        const int packets_per_frame_bucket =
+            static_cast<int>(min_packets_per_frame + 0.5f);
+        if (packets_per_frame_bucket != last_packets_per_frame_bucket_) {
+          last_packets_per_frame_bucket_ = packets_per_frame_bucket;
+          profile_valid_ = false;
+        }
       } else {
         loss_prot_logic_->UpdatePacketsPerFrameKey(
             min_packets_per_frame, clock_->TimeInMilliseconds());
+        // Key frames are rare and also update the key frame size below;
+        // always recompute after one.
+        profile_valid_ = false;
       }
     }
     if (!delta_frame && encoded_length > 0) {
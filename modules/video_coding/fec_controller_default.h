@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "api/fec_controller.h"
+#include "modules/include/module_fec_types.h"
 #include "modules/video_coding/media_opt_util.h"
 #include "rtc_base/constructor_magic.h"
 #include "rtc_base/critical_section.h"
@@ -52,12 +53,44 @@ class FecControllerDefault : public FecController {
 
  private:
   enum { kBitrateAverageWinMs = 1000 };
+
+  // Quantized inputs to the loss-protection filter math. While consecutive
+  // UpdateFecRates() calls map to the same key, the previously computed
+  // protection profile is reused instead of re-running the filter update.
+  struct ProtectionProfileKey {
+    bool operator==(const ProtectionProfileKey& o) const {
+      return packet_loss == o.packet_loss && rtt_bucket == o.rtt_bucket &&
+             bitrate_bucket_kbps == o.bitrate_bucket_kbps &&
+             framerate_fps == o.framerate_fps;
+    }
+    bool operator!=(const ProtectionProfileKey& o) const {
+      return !(*this == o);
+    }
+
+    uint8_t packet_loss = 0;
+    int64_t rtt_bucket = -1;
+    int bitrate_bucket_kbps = -1;
+    int framerate_fps = -1;
+  };
+
   Clock* const clock_;
   VCMProtectionCallback* protection_callback_;
   rtc::CriticalSection crit_sect_;
   std::unique_ptr<media_optimization::VCMLossProtectionLogic> loss_prot_logic_
       RTC_GUARDED_BY(crit_sect_);
   size_t max_payload_size_ RTC_GUARDED_BY(crit_sect_);
+
+  // Cached output of the last protection-factor computation and the inputs
+  // it was computed for. Invalidated whenever state feeding the computation
+  // changes outside of UpdateFecRates(), see InvalidateProtectionProfile().
+  bool profile_valid_ RTC_GUARDED_BY(crit_sect_) = false;
+  ProtectionProfileKey profile_key_ RTC_GUARDED_BY(crit_sect_);
+  FecProtectionParams cached_delta_fec_params_ RTC_GUARDED_BY(crit_sect_);
+  FecProtectionParams cached_key_fec_params_ RTC_GUARDED_BY(crit_sect_);
+  // Packets-per-frame of the last encoded delta frame, rounded to an
+  // integer; the protection tables only move when this bucket does.
+  int last_packets_per_frame_bucket_ RTC_GUARDED_BY(crit_sect_) = -1;
+
   RTC_DISALLOW_COPY_AND_ASSIGN(FecControllerDefault);
   const float overhead_threshold_;
 };
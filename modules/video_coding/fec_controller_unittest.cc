@@ -111,4 +111,45 @@ TEST_F(ProtectionBitrateCalculatorTest, NoProtection) {
   EXPECT_EQ(kMaxBitrateBps, target_bitrate);
 }
 
+TEST_F(ProtectionBitrateCalculatorTest, CachedProfileTracksLossChanges) {
+  static const uint32_t kMaxBitrateBps = 130000;
+
+  class RecordingCallback : public VCMProtectionCallback {
+   public:
+    int ProtectionRequest(const FecProtectionParams* delta_params,
+                          const FecProtectionParams* key_params,
+                          uint32_t* sent_video_rate_bps,
+                          uint32_t* sent_nack_rate_bps,
+                          uint32_t* sent_fec_rate_bps) override {
+      delta_fec_rate_ = delta_params->fec_rate;
+      *sent_video_rate_bps = kCodecBitrateBps;
+      *sent_nack_rate_bps = 0;
+      *sent_fec_rate_bps = kCodecBitrateBps / 10;
+      return 0;
+    }
+
+    uint8_t delta_fec_rate_ = 0;
+  } callback;
+
+  fec_controller_.SetProtectionCallback(&callback);
+  fec_controller_.SetProtectionMethod(true /*enable_fec*/,
+                                      true /* enable_nack */);
+  fec_controller_.SetEncodingData(640, 480, 1, 1000);
+
+  // Identical inputs hit the cached protection profile and must yield the
+  // same protection factors as a fresh computation.
+  fec_controller_.UpdateFecRates(kMaxBitrateBps, 30, 64,
+                                 std::vector<bool>(1, false), 100);
+  const uint8_t first_fec_rate = callback.delta_fec_rate_;
+  fec_controller_.UpdateFecRates(kMaxBitrateBps, 30, 64,
+                                 std::vector<bool>(1, false), 100);
+  EXPECT_EQ(first_fec_rate, callback.delta_fec_rate_);
+
+  // A clearly higher loss rate must invalidate the cache and raise the
+  // protection factor.
+  fec_controller_.UpdateFecRates(kMaxBitrateBps, 30, 200,
+                                 std::vector<bool>(1, false), 100);
+  EXPECT_GT(callback.delta_fec_rate_, first_fec_rate);
+}
+
 }  // namespace webrtc
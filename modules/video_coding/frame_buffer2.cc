@@ -58,6 +58,9 @@ FrameBuffer::FrameBuffer(Clock* clock,
       timing_(timing),
       inter_frame_delay_(clock_->TimeInMilliseconds()),
       stopped_(false),
+      low_latency_mode_(false),
+      max_decode_ahead_frames_(0),
+      next_frame_decoded_ahead_(false),
       protection_mode_(kProtectionNack),
       stats_callback_(stats_callback),
       last_log_non_decoded_ms_(-kLogNonDecodedIntervalMs),
@@ -126,6 +129,7 @@ void FrameBuffer::StartWaitForNextFrameOnQueue() {
 int64_t FrameBuffer::FindNextFrame(int64_t now_ms) {
   int64_t wait_ms = latest_return_time_ms_ - now_ms;
   frames_to_decode_.clear();
+  next_frame_decoded_ahead_ = false;
 
   // |last_continuous_frame_| may be empty below, but nullopt is smaller
   // than everything else and loop will immediately terminate as expected.
@@ -200,8 +204,38 @@ int64_t FrameBuffer::FindNextFrame(int64_t now_ms) {
     if (frame->RenderTime() == -1) {
       frame->SetRenderTime(timing_->RenderTimeMs(frame->Timestamp(), now_ms));
     }
+
+    if (low_latency_mode_) {
+      // The frame is continuous and decodable; deliver it immediately. The
+      // render time is still stamped above so downstream smoothing and
+      // stats keep working if they are enabled.
+      wait_ms = 0;
+      break;
+    }
+
     wait_ms = timing_->MaxWaitingTime(frame->RenderTime(), now_ms);
 
+    // The frame is complete and decodable but not due yet, while the
+    // decoder is already waiting for it — an idle decode slot. If a
+    // decode-ahead slot is free, hand the frame out now; the decoded frame
+    // queues in the prerenderer smoothing buffer, and the slack built up
+    // absorbs a later decode time spike (typically a keyframe) that would
+    // otherwise miss its render deadline.
+    if (wait_ms > 0 && max_decode_ahead_frames_ > 0) {
+      while (!decode_ahead_render_times_.empty() &&
+             decode_ahead_render_times_.front() <= now_ms) {
+        decode_ahead_render_times_.pop_front();
+      }
+      if (decode_ahead_render_times_.size() <
+          static_cast<size_t>(max_decode_ahead_frames_)) {
+        // The slot is claimed in GetNextFrame(), when the frame is actually
+        // handed out; FindNextFrame() may run several times before that.
+        next_frame_decoded_ahead_ = true;
+        wait_ms = 0;
+        break;
+      }
+    }
+
     // This will cause the frame buffer to prefer high framerate rather
     // than high resolution in the case of the decoder not decoding fast
     // enough and the stream has multiple spatial and temporal layers.
@@ -236,6 +270,13 @@ EncodedFrame* FrameBuffer::GetNextFrame() {
     render_time_ms = timing_->RenderTimeMs(first_frame->Timestamp(), now_ms);
   }
 
+  if (next_frame_decoded_ahead_) {
+    // The frame is handed out before its scheduled decode time; occupy a
+    // decode-ahead slot until its render time passes.
+    decode_ahead_render_times_.push_back(render_time_ms);
+    next_frame_decoded_ahead_ = false;
+  }
+
   for (FrameMap::iterator& frame_it : frames_to_decode_) {
     RTC_DCHECK(frame_it != frames_.end());
     EncodedFrame* frame = frame_it->second.frame.release();
@@ -266,7 +307,12 @@ EncodedFrame* FrameBuffer::GetNextFrame() {
     frames_out.push_back(frame);
   }
 
-  if (!superframe_delayed_by_retransmission) {
+  VCMTiming::VideoDelayTimings timings;
+  if (low_latency_mode_) {
+    // Jitter estimation is skipped entirely; the timing module keeps the
+    // configured minimum delay, so the target delay never inflates.
+    timings = timing_->GetTimings();
+  } else if (!superframe_delayed_by_retransmission) {
     int64_t frame_delay;
 
     if (inter_frame_delay_.CalculateDelay(first_frame->Timestamp(),
@@ -280,15 +326,18 @@ EncodedFrame* FrameBuffer::GetNextFrame() {
       rtt_mult = rtt_mult_settings_->rtt_mult_setting;
       rtt_mult_add_cap_ms = rtt_mult_settings_->rtt_mult_add_cap_ms;
     }
-    timing_->SetJitterDelay(
-        jitter_estimator_.GetJitterEstimate(rtt_mult, rtt_mult_add_cap_ms));
-    timing_->UpdateCurrentDelay(render_time_ms, now_ms);
+    // Updates both delays and reads back the resulting timings under a
+    // single VCMTiming lock acquisition.
+    timings = timing_->SetJitterDelayAndUpdateCurrentDelay(
+        jitter_estimator_.GetJitterEstimate(rtt_mult, rtt_mult_add_cap_ms),
+        render_time_ms, now_ms);
   } else {
     if (RttMultExperiment::RttMultEnabled() || add_rtt_to_playout_delay_)
       jitter_estimator_.FrameNacked();
+    timings = timing_->GetTimings();
   }
 
-  UpdateJitterDelay();
+  UpdateJitterDelay(timings);
   UpdateTimingFrameInfo();
 
   if (frames_out.size() == 1) {
@@ -333,6 +382,17 @@ void FrameBuffer::SetProtectionMode(VCMVideoProtection mode) {
   protection_mode_ = mode;
 }
 
+void FrameBuffer::SetLowLatencyMode(bool enabled) {
+  rtc::CritScope lock(&crit_);
+  low_latency_mode_ = enabled;
+}
+
+void FrameBuffer::SetMaxDecodeAheadFrames(int max_frames) {
+  rtc::CritScope lock(&crit_);
+  RTC_DCHECK_GE(max_frames, 0);
+  max_decode_ahead_frames_ = max_frames;
+}
+
 void FrameBuffer::Start() {
   TRACE_EVENT0("webrtc", "FrameBuffer::Start");
   rtc::CritScope lock(&crit_);
@@ -354,6 +414,11 @@ void FrameBuffer::Clear() {
   ClearFramesAndHistory();
 }
 
+size_t FrameBuffer::Size() const {
+  rtc::CritScope lock(&crit_);
+  return frames_.size();
+}
+
 void FrameBuffer::UpdateRtt(int64_t rtt_ms) {
   rtc::CritScope lock(&crit_);
   jitter_estimator_.UpdateRtt(rtt_ms);
@@ -668,24 +733,16 @@ bool FrameBuffer::UpdateFrameInfoWithIncomingFrame(const EncodedFrame& frame,
   return true;
 }
 
-void FrameBuffer::UpdateJitterDelay() {
+void FrameBuffer::UpdateJitterDelay(
+    const VCMTiming::VideoDelayTimings& timings) {
   TRACE_EVENT0("webrtc", "FrameBuffer::UpdateJitterDelay");
-  if (!stats_callback_)
+  if (!stats_callback_ || timings.num_decoded_frames == 0)
     return;
 
-  int max_decode_ms;
-  int current_delay_ms;
-  int target_delay_ms;
-  int jitter_buffer_ms;
-  int min_playout_delay_ms;
-  int render_delay_ms;
-  if (timing_->GetTimings(&max_decode_ms, &current_delay_ms, &target_delay_ms,
-                          &jitter_buffer_ms, &min_playout_delay_ms,
-                          &render_delay_ms)) {
-    stats_callback_->OnFrameBufferTimingsUpdated(
-        max_decode_ms, current_delay_ms, target_delay_ms, jitter_buffer_ms,
-        min_playout_delay_ms, render_delay_ms);
-  }
+  stats_callback_->OnFrameBufferTimingsUpdated(
+      timings.max_decode_ms, timings.current_delay_ms, timings.target_delay_ms,
+      timings.jitter_buffer_ms, timings.min_playout_delay_ms,
+      timings.render_delay_ms, timings.num_decode_budget_overruns);
 }
 
 void FrameBuffer::UpdateTimingFrameInfo() {
@@ -710,6 +767,8 @@ void FrameBuffer::ClearFramesAndHistory() {
   frames_.clear();
   last_continuous_frame_.reset();
   frames_to_decode_.clear();
+  next_frame_decoded_ahead_ = false;
+  decode_ahead_render_times_.clear();
   decoded_frames_history_.Clear();
 }
 
@@ -12,6 +12,7 @@
 #define MODULES_VIDEO_CODING_FRAME_BUFFER2_H_
 
 #include <array>
+#include <deque>
 #include <map>
 #include <memory>
 #include <utility>
@@ -22,6 +23,7 @@
 #include "modules/video_coding/include/video_coding_defines.h"
 #include "modules/video_coding/inter_frame_delay.h"
 #include "modules/video_coding/jitter_estimator.h"
+#include "modules/video_coding/timing.h"
 #include "modules/video_coding/utility/decoded_frames_history.h"
 #include "rtc_base/constructor_magic.h"
 #include "rtc_base/critical_section.h"
@@ -38,7 +40,6 @@ namespace webrtc {
 class Clock;
 class VCMReceiveStatisticsCallback;
 class VCMJitterEstimator;
-class VCMTiming;
 
 namespace video_coding {
 
@@ -71,6 +72,22 @@ class FrameBuffer {
   //                 implemented.
   void SetProtectionMode(VCMVideoProtection mode);
 
+  // When enabled, frames are returned as soon as they are continuous and
+  // decodable, without waiting for their render time, and the jitter
+  // estimate is no longer applied to the timing module. Intended for
+  // networks with negligible jitter where latency is prioritized over
+  // smooth playout.
+  void SetLowLatencyMode(bool enabled);
+
+  // Allows up to |max_frames| continuous, decodable frames to be handed to
+  // the decoder before their scheduled decode time while the decoder is
+  // idle, i.e. already waiting in NextFrame(). The decoded frames queue in
+  // the prerenderer smoothing buffer, building slack that absorbs decode
+  // time spikes (typically keyframes) without render misses. Only enable
+  // when prerenderer smoothing is on, otherwise early frames render early.
+  // 0 (the default) disables decode-ahead.
+  void SetMaxDecodeAheadFrames(int max_frames);
+
   // Start the frame buffer, has no effect if the frame buffer is started.
   // The frame buffer is started upon construction.
   void Start();
@@ -85,6 +102,11 @@ class FrameBuffer {
   // Clears the FrameBuffer, removing all the buffered frames.
   void Clear();
 
+  // Returns the number of frames currently held by the buffer, i.e. frames
+  // that have been inserted but not yet extracted for decoding. Used as a
+  // backlog measure by the receive-side load shedder.
+  size_t Size() const;
+
  private:
   struct FrameInfo {
     FrameInfo();
@@ -140,7 +162,8 @@ class FrameBuffer {
                                         FrameMap::iterator info)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
 
-  void UpdateJitterDelay() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
+  void UpdateJitterDelay(const VCMTiming::VideoDelayTimings& timings)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
 
   void UpdateTimingFrameInfo() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
 
@@ -167,7 +190,7 @@ class FrameBuffer {
   FrameMap frames_ RTC_GUARDED_BY(crit_);
   DecodedFramesHistory decoded_frames_history_ RTC_GUARDED_BY(crit_);
 
-  rtc::CriticalSection crit_;
+  mutable rtc::CriticalSection crit_;
   Clock* const clock_;
 
   rtc::TaskQueue* callback_queue_ RTC_GUARDED_BY(crit_);
@@ -184,6 +207,15 @@ class FrameBuffer {
       RTC_GUARDED_BY(crit_);
   std::vector<FrameMap::iterator> frames_to_decode_ RTC_GUARDED_BY(crit_);
   bool stopped_ RTC_GUARDED_BY(crit_);
+  bool low_latency_mode_ RTC_GUARDED_BY(crit_);
+
+  // Decode-ahead state; see SetMaxDecodeAheadFrames(). The deque holds the
+  // render times of frames handed out before their scheduled decode time
+  // that have not reached their render time yet; its size is the number of
+  // decode-ahead slots currently in use.
+  int max_decode_ahead_frames_ RTC_GUARDED_BY(crit_);
+  bool next_frame_decoded_ahead_ RTC_GUARDED_BY(crit_);
+  std::deque<int64_t> decode_ahead_render_times_ RTC_GUARDED_BY(crit_);
   VCMVideoProtection protection_mode_ RTC_GUARDED_BY(crit_);
   VCMReceiveStatisticsCallback* const stats_callback_;
   int64_t last_log_non_decoded_ms_ RTC_GUARDED_BY(crit_);
@@ -60,28 +60,26 @@ class VCMTimingFake : public VCMTiming {
     return render_time_ms - now_ms - kDecodeTime;
   }
 
-  bool GetTimings(int* max_decode_ms,
-                  int* current_delay_ms,
-                  int* target_delay_ms,
-                  int* jitter_buffer_ms,
-                  int* min_playout_delay_ms,
-                  int* render_delay_ms) const override {
-    return true;
+  VideoDelayTimings GetTimings() const override {
+    // Pretend that a frame has been decoded so that the timings are always
+    // reported to the stats callback.
+    VideoDelayTimings timings = VCMTiming::GetTimings();
+    timings.num_decoded_frames = 1;
+    return timings;
   }
 
-  int GetCurrentJitter() {
-    int max_decode_ms;
-    int current_delay_ms;
-    int target_delay_ms;
-    int jitter_buffer_ms;
-    int min_playout_delay_ms;
-    int render_delay_ms;
-    VCMTiming::GetTimings(&max_decode_ms, &current_delay_ms, &target_delay_ms,
-                          &jitter_buffer_ms, &min_playout_delay_ms,
-                          &render_delay_ms);
-    return jitter_buffer_ms;
+  VideoDelayTimings SetJitterDelayAndUpdateCurrentDelay(
+      int jitter_delay_ms,
+      int64_t render_time_ms,
+      int64_t actual_decode_time_ms) override {
+    VideoDelayTimings timings = VCMTiming::SetJitterDelayAndUpdateCurrentDelay(
+        jitter_delay_ms, render_time_ms, actual_decode_time_ms);
+    timings.num_decoded_frames = 1;
+    return timings;
   }
 
+  int GetCurrentJitter() { return VCMTiming::GetTimings().jitter_buffer_ms; }
+
  private:
   static constexpr int kDelayMs = 50;
   static constexpr int kDecodeTime = kDelayMs / 2;
@@ -115,13 +113,14 @@ class VCMReceiveStatisticsCallbackMock : public VCMReceiveStatisticsCallback {
   MOCK_METHOD1(OnDroppedFrames, void(uint32_t frames_dropped));
   MOCK_METHOD1(OnDiscardedPacketsUpdated, void(int discarded_packets));
   MOCK_METHOD1(OnFrameCountsUpdated, void(const FrameCounts& frame_counts));
-  MOCK_METHOD6(OnFrameBufferTimingsUpdated,
+  MOCK_METHOD7(OnFrameBufferTimingsUpdated,
                void(int max_decode_ms,
                     int current_delay_ms,
                     int target_delay_ms,
                     int jitter_buffer_ms,
                     int min_playout_delay_ms,
-                    int render_delay_ms));
+                    int render_delay_ms,
+                    size_t decode_budget_overruns));
   MOCK_METHOD1(OnTimingFrameInfoUpdated, void(const TimingFrameInfo& info));
 };
 
@@ -260,6 +259,43 @@ TEST_F(TestFrameBuffer2, WaitForFrame) {
   CheckFrame(0, pid, 0);
 }
 
+TEST_F(TestFrameBuffer2, LowLatencyModeDeliversWithoutWaiting) {
+  uint16_t pid = Rand();
+  uint32_t ts = Rand();
+
+  buffer_->SetLowLatencyMode(true);
+  ExtractFrame(50);
+  InsertFrame(pid, 0, ts, false, true, kFrameSize);
+  // The frame is delivered as soon as it is decodable, without advancing
+  // the clock towards its render time.
+  time_controller_.AdvanceTime(TimeDelta::Millis(0));
+  CheckFrame(0, pid, 0);
+  EXPECT_NE(-1, frames_[0]->RenderTimeMs());
+}
+
+TEST_F(TestFrameBuffer2, DecodeAheadDeliversEarlyUpToLimit) {
+  uint16_t pid = Rand();
+  uint32_t ts = Rand();
+
+  buffer_->SetMaxDecodeAheadFrames(1);
+
+  // With a free decode-ahead slot, the first frame is handed out without
+  // waiting for its decode deadline.
+  ExtractFrame(50);
+  InsertFrame(pid, 0, ts, false, true, kFrameSize);
+  time_controller_.AdvanceTime(TimeDelta::Millis(0));
+  CheckFrame(0, pid, 0);
+
+  // The slot stays occupied until the first frame's render time passes, so
+  // the second frame is not handed out early.
+  ExtractFrame(50);
+  InsertFrame(pid + 1, 0, ts + kFps10, false, true, kFrameSize, pid);
+  time_controller_.AdvanceTime(TimeDelta::Millis(0));
+  EXPECT_EQ(1u, frames_.size());
+  time_controller_.AdvanceTime(TimeDelta::Millis(50));
+  CheckFrame(1, pid + 1, 0);
+}
+
 TEST_F(TestFrameBuffer2, OneSuperFrame) {
   uint16_t pid = Rand();
   uint32_t ts = Rand();
@@ -544,7 +580,7 @@ TEST_F(TestFrameBuffer2, StatsCallback) {
 
   EXPECT_CALL(stats_callback_,
               OnCompleteFrame(true, kFrameSize, VideoContentType::UNSPECIFIED));
-  EXPECT_CALL(stats_callback_, OnFrameBufferTimingsUpdated(_, _, _, _, _, _));
+  EXPECT_CALL(stats_callback_, OnFrameBufferTimingsUpdated(_, _, _, _, _, _, _));
 
   {
     std::unique_ptr<FrameObjectFake> frame(new FrameObjectFake());
@@ -11,8 +11,8 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <iterator>
-#include <set>
 
 #include "absl/algorithm/container.h"
 #include "absl/container/inlined_vector.h"
@@ -35,8 +35,11 @@ absl::InlinedVector<int64_t, 5> FrameDependenciesCalculator::FromBuffersUsage(
       buffers_.resize(buffer_usage.id + 1);
     }
   }
-  std::set<int64_t> direct_depenendencies;
-  std::set<int64_t> indirect_depenendencies;
+  // Kept sorted and deduplicated. Inlined so that gathering the dependencies
+  // for the structures used in practice does not allocate, unlike the
+  // node-per-entry std::set this replaces.
+  absl::InlinedVector<int64_t, 5> direct_depenendencies;
+  absl::InlinedVector<int64_t, 10> indirect_depenendencies;
   if (frame_type == VideoFrameType::kVideoFrameDelta) {
     for (const CodecBufferUsage& buffer_usage : buffers_usage) {
       if (!buffer_usage.referenced) {
@@ -49,10 +52,22 @@ absl::InlinedVector<int64_t, 5> FrameDependenciesCalculator::FromBuffersUsage(
                           << " that was never updated.";
         continue;
       }
-      direct_depenendencies.insert(*buffer.frame_id);
-      indirect_depenendencies.insert(buffer.dependencies.begin(),
+      direct_depenendencies.push_back(*buffer.frame_id);
+      // |buffer.dependencies| is sorted, but concatenating several buffers'
+      // dependencies may interleave, so the result is re-sorted below.
+      indirect_depenendencies.insert(indirect_depenendencies.end(),
+                                     buffer.dependencies.begin(),
                                      buffer.dependencies.end());
     }
+    absl::c_sort(direct_depenendencies);
+    direct_depenendencies.erase(
+        std::unique(direct_depenendencies.begin(), direct_depenendencies.end()),
+        direct_depenendencies.end());
+    absl::c_sort(indirect_depenendencies);
+    indirect_depenendencies.erase(
+        std::unique(indirect_depenendencies.begin(),
+                    indirect_depenendencies.end()),
+        indirect_depenendencies.end());
     // Reduce references: if frame #3 depends on frame #2 and #1, and frame #2
     // depends on frame #1, then frame #3 needs to depend just on frame #2.
     // Though this set diff removes only 1 level of indirection, it seems
@@ -206,6 +206,31 @@ H264SpsPpsTracker::FixedBitstream H264SpsPpsTracker::CopyAndFixBitstream(
   return fixed;
 }
 
+H264SpsPpsTracker::FixedBitstream H264SpsPpsTracker::CopyAndFixBitstream(
+    rtc::CopyOnWriteBuffer bitstream,
+    RTPVideoHeader* video_header) {
+  RTC_DCHECK(video_header);
+  RTC_DCHECK(video_header->codec == kVideoCodecH264);
+
+  const auto& h264_header =
+      absl::get<RTPVideoHeaderH264>(video_header->video_type_header);
+
+  // Packets that continue a fragmented NAL unit carry no NALU headers, so
+  // they need neither start codes nor parameter sets inserted. The rewriting
+  // path below would produce a byte-identical copy; pass the buffer through
+  // instead. This is the bulk of the packets of any large H.264 frame.
+  if (h264_header.packetization_type != kH264StapA &&
+      h264_header.nalus_length == 0) {
+    H264SpsPpsTracker::FixedBitstream fixed;
+    fixed.action = kInsert;
+    fixed.bitstream = std::move(bitstream);
+    return fixed;
+  }
+
+  return CopyAndFixBitstream(
+      rtc::MakeArrayView(bitstream.cdata(), bitstream.size()), video_header);
+}
+
 void H264SpsPpsTracker::InsertSpsPpsNalus(const std::vector<uint8_t>& sps,
                                           const std::vector<uint8_t>& pps) {
   constexpr size_t kNaluHeaderOffset = 1;
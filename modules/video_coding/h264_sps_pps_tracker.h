@@ -39,6 +39,12 @@ class H264SpsPpsTracker {
   FixedBitstream CopyAndFixBitstream(rtc::ArrayView<const uint8_t> bitstream,
                                      RTPVideoHeader* video_header);
 
+  // As above, but when the packet needs no rewriting (no start codes and no
+  // out-of-band SPS/PPS to insert) the returned bitstream shares |bitstream|'s
+  // buffer instead of copying it.
+  FixedBitstream CopyAndFixBitstream(rtc::CopyOnWriteBuffer bitstream,
+                                     RTPVideoHeader* video_header);
+
   void InsertSpsPpsNalus(const std::vector<uint8_t>& sps,
                          const std::vector<uint8_t>& pps);
 
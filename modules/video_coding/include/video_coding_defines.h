@@ -81,7 +81,8 @@ class VCMReceiveStatisticsCallback {
                                            int target_delay_ms,
                                            int jitter_buffer_ms,
                                            int min_playout_delay_ms,
-                                           int render_delay_ms) = 0;
+                                           int render_delay_ms,
+                                           size_t decode_budget_overruns) = 0;
 
   virtual void OnTimingFrameInfoUpdated(const TimingFrameInfo& info) = 0;
 
@@ -32,6 +32,10 @@ static constexpr int64_t kFsAccuStartupSamples = 5;
 static constexpr double kMaxFramerateEstimate = 200.0;
 static constexpr int64_t kNackCountTimeoutMs = 60000;
 static constexpr double kDefaultMaxTimestampDeviationInSigmas = 3.5;
+// Tolerance for reusing a memoized pow(alpha, rate_scale) result. At 30 fps
+// the rate scale moves by ~0.03 per fps of frame rate noise, and the scaled
+// alpha is only sensitive to it at the 1e-5 level, far below filter noise.
+static constexpr double kRateScaleTolerance = 0.01;
 }  // namespace
 
 VCMJitterEstimator::VCMJitterEstimator(Clock* clock)
@@ -90,6 +94,10 @@ void VCMJitterEstimator::Reset() {
   _theta[0] = 1 / (512e3 / 8);
   _theta[1] = 0;
   _varNoise = 4.0;
+  var_noise_sqrt_ = 2.0;
+  cached_alpha_base_ = -1.0;
+  cached_rate_scale_ = -1.0;
+  cached_scaled_alpha_ = 0.0;
 
   _thetaCov[0][0] = 1e-4;
   _thetaCov[1][1] = 1e2;
@@ -157,8 +165,8 @@ void VCMJitterEstimator::UpdateEstimate(int64_t frameDelayMS,
   _prevFrameSize = frameSizeBytes;
 
   // Cap frameDelayMS based on the current time deviation noise.
-  int64_t max_time_deviation_ms =
-      static_cast<int64_t>(time_deviation_upper_bound_ * sqrt(_varNoise) + 0.5);
+  int64_t max_time_deviation_ms = static_cast<int64_t>(
+      time_deviation_upper_bound_ * var_noise_sqrt_ + 0.5);
   frameDelayMS = std::max(std::min(frameDelayMS, max_time_deviation_ms),
                           -max_time_deviation_ms);
 
@@ -168,7 +176,7 @@ void VCMJitterEstimator::UpdateEstimate(int64_t frameDelayMS,
   // line slope.
   double deviation = DeviationFromExpectedDelay(frameDelayMS, deltaFS);
 
-  if (fabs(deviation) < _numStdDevDelayOutlier * sqrt(_varNoise) ||
+  if (fabs(deviation) < _numStdDevDelayOutlier * var_noise_sqrt_ ||
       frameSizeBytes >
           _avgFrameSize + _numStdDevFrameSizeOutlier * sqrt(_varFrameSize)) {
     // Update the variance of the deviation from the line given by the Kalman
@@ -188,7 +196,7 @@ void VCMJitterEstimator::UpdateEstimate(int64_t frameDelayMS,
   } else {
     int nStdDev =
         (deviation >= 0) ? _numStdDevDelayOutlier : -_numStdDevDelayOutlier;
-    EstimateRandomJitter(nStdDev * sqrt(_varNoise), incompleteFrame);
+    EstimateRandomJitter(nStdDev * var_noise_sqrt_, incompleteFrame);
   }
   // Post process the total estimated jitter
   if (_startupCount >= kStartupDelaySamples) {
@@ -240,7 +248,7 @@ void VCMJitterEstimator::KalmanEstimateChannel(int64_t frameDelayMS,
   double sigma = (300.0 * exp(-fabs(static_cast<double>(deltaFSBytes)) /
                               (1e0 * _maxFrameSize)) +
                   1) *
-                 sqrt(_varNoise);
+                 var_noise_sqrt_;
   if (sigma < 1.0) {
     sigma = 1.0;
   }
@@ -324,7 +332,17 @@ void VCMJitterEstimator::EstimateRandomJitter(double d_dT,
           (_alphaCount * rate_scale + (kStartupDelaySamples - _alphaCount)) /
           kStartupDelaySamples;
     }
-    alpha = pow(alpha, rate_scale);
+    // pow() dominates the per-frame cost of this filter, but its inputs move
+    // slowly: |alpha| saturates after |_alphaCountMax| samples and
+    // |rate_scale| tracks the smoothed frame rate. Reuse the previous result
+    // while the inputs stay within kRateScaleTolerance.
+    if (alpha != cached_alpha_base_ ||
+        fabs(rate_scale - cached_rate_scale_) > kRateScaleTolerance) {
+      cached_alpha_base_ = alpha;
+      cached_rate_scale_ = rate_scale;
+      cached_scaled_alpha_ = pow(alpha, rate_scale);
+    }
+    alpha = cached_scaled_alpha_;
   }
 
   double avgNoise = alpha * _avgNoise + (1 - alpha) * d_dT;
@@ -339,10 +357,11 @@ void VCMJitterEstimator::EstimateRandomJitter(double d_dT,
     // all samples as outliers.
     _varNoise = 1.0;
   }
+  var_noise_sqrt_ = sqrt(_varNoise);
 }
 
 double VCMJitterEstimator::NoiseThreshold() const {
-  double noiseThreshold = _noiseStdDevs * sqrt(_varNoise) - _noiseStdDevOffset;
+  double noiseThreshold = _noiseStdDevs * var_noise_sqrt_ - _noiseStdDevOffset;
   if (noiseThreshold < 1.0) {
     noiseThreshold = 1.0;
   }
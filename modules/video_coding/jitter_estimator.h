@@ -148,6 +148,18 @@ class VCMJitterEstimator {
                              // but never goes above _nackLimit
   VCMRttFilter _rttFilter;
 
+  // Cached value of sqrt(_varNoise). The noise standard deviation is needed
+  // several times per frame and again for every jitter estimate read; keeping
+  // it alongside the variance turns those into plain loads. Must be updated
+  // whenever |_varNoise| is.
+  double var_noise_sqrt_;
+
+  // Memoized result of the pow() call in EstimateRandomJitter(), together
+  // with the inputs it was computed from. See the comment at the use site.
+  double cached_alpha_base_;
+  double cached_rate_scale_;
+  double cached_scaled_alpha_;
+
   rtc::RollingAccumulator<uint64_t> fps_counter_;
   const double time_deviation_upper_bound_;
   const bool enable_reduced_delay_;
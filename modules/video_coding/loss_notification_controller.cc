@@ -128,6 +128,22 @@ void LossNotificationController::OnAssembledFrame(
   RTC_DCHECK(it.second);
 }
 
+void LossNotificationController::OnDiscardedFrame(uint16_t last_seq_num) {
+  RTC_DCHECK_RUN_ON(&sequence_checker_);
+
+  if (!last_decodable_non_discardable_ ||
+      !AheadOf(last_seq_num, last_decodable_non_discardable_->first_seq_num)) {
+    return;
+  }
+
+  // The frame itself was assembled and its dependencies were decodable, so
+  // the decodability flag is set. The gap between the last decoded and last
+  // received sequence numbers tells the sender which layers go unconsumed.
+  loss_notification_sender_->SendLossNotification(
+      last_decodable_non_discardable_->first_seq_num, last_seq_num,
+      /*decodability_flag=*/true, /*buffering_allowed=*/true);
+}
+
 void LossNotificationController::DiscardOldInformation() {
   constexpr size_t kExpectedKeyFrameIntervalFrames = 3000;
   constexpr size_t kMaxSize = 2 * kExpectedKeyFrameIntervalFrames;
@@ -45,6 +45,12 @@ class LossNotificationController {
                         bool discardable,
                         rtc::ArrayView<const int64_t> frame_dependencies);
 
+  // An assembled frame was intentionally discarded by the receiver before
+  // decoding, e.g. because of load shedding. Reported to the sender as a
+  // loss notification, so that it may restrict itself to the layers the
+  // receiver still consumes.
+  void OnDiscardedFrame(uint16_t last_seq_num);
+
  private:
   void DiscardOldInformation();
 
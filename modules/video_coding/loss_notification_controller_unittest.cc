@@ -604,4 +604,43 @@ TEST_F(
                          expected_decodability_flag_last);
 }
 
+class LossNotificationControllerDiscardedFrameTest
+    : public LossNotificationControllerBaseTest {
+ protected:
+  void ReceiveFrame(uint16_t seq_num,
+                    int64_t frame_id,
+                    bool is_keyframe,
+                    std::vector<int64_t> ref_frame_ids) {
+    OnReceivedPacket(CreatePacket(true, true, seq_num, frame_id, is_keyframe,
+                                  std::move(ref_frame_ids)));
+    OnAssembledFrame(seq_num, frame_id, false);
+  }
+};
+
+TEST_F(LossNotificationControllerDiscardedFrameTest,
+       DiscardedFrameProducesLossNotification) {
+  ReceiveFrame(100, 0, true, {});
+
+  // A discardable frame arrives and is shed by the receiver; the sender is
+  // informed that the frame went unconsumed although it was decodable.
+  OnReceivedPacket(CreatePacket(true, true, 101, 1, false, {0}));
+  uut_.OnDiscardedFrame(101);
+
+  const bool expected_decodability_flag = true;
+  ExpectLossNotification(100, 101, expected_decodability_flag);
+}
+
+TEST_F(LossNotificationControllerDiscardedFrameTest,
+       DiscardedFrameBeforeAnyDecodableFrameIsIgnored) {
+  uut_.OnDiscardedFrame(101);
+  EXPECT_FALSE(LastLossNotification());
+}
+
+TEST_F(LossNotificationControllerDiscardedFrameTest,
+       DiscardedFrameNotAheadOfLastDecodableFrameIsIgnored) {
+  ReceiveFrame(100, 0, true, {});
+  uut_.OnDiscardedFrame(100);
+  EXPECT_FALSE(LastLossNotification());
+}
+
 }  //  namespace webrtc
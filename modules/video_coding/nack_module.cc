@@ -171,11 +171,11 @@ int NackModule::OnReceivedPacket(uint16_t seq_num,
   newest_seq_num_ = seq_num;
 
   // Are there any nacks that are waiting for this seq_num.
-  std::vector<uint16_t> nack_batch = GetNackBatch(kSeqNumOnly);
-  if (!nack_batch.empty()) {
+  GetNackBatch(kSeqNumOnly, &on_receive_nack_batch_);
+  if (!on_receive_nack_batch_.empty()) {
     // This batch of NACKs is triggered externally; the initiator can
     // batch them with other feedback messages.
-    nack_sender_->SendNack(nack_batch, /*buffering_allowed=*/true);
+    nack_sender_->SendNack(on_receive_nack_batch_, /*buffering_allowed=*/true);
   }
 
   return 0;
@@ -209,31 +209,26 @@ int64_t NackModule::TimeUntilNextProcess() {
 
 void NackModule::Process() {
   if (nack_sender_) {
-    std::vector<uint16_t> nack_batch;
     {
       rtc::CritScope lock(&crit_);
-      nack_batch = GetNackBatch(kTimeOnly);
+      GetNackBatch(kTimeOnly, &process_nack_batch_);
     }
 
-    if (!nack_batch.empty()) {
+    if (!process_nack_batch_.empty()) {
       // This batch of NACKs is triggered externally; there is no external
       // initiator who can batch them with other feedback messages.
-      nack_sender_->SendNack(nack_batch, /*buffering_allowed=*/false);
+      nack_sender_->SendNack(process_nack_batch_, /*buffering_allowed=*/false);
     }
   }
 
-  // Update the next_process_time_ms_ in intervals to achieve
-  // the targeted frequency over time. Also add multiple intervals
-  // in case of a skip in time as to not make uneccessary
-  // calls to Process in order to catch up.
+  // Schedule the next tick on a process-interval grid in wall-clock time
+  // rather than at now + interval. All NackModules sharing a process thread
+  // then become due in the same wakeup, so the thread wakes up once per
+  // interval for all receive streams instead of once per stream. This also
+  // absorbs skips in time without extra catch-up calls to Process.
   int64_t now_ms = clock_->TimeInMilliseconds();
-  if (next_process_time_ms_ == -1) {
-    next_process_time_ms_ = now_ms + kProcessIntervalMs;
-  } else {
-    next_process_time_ms_ = next_process_time_ms_ + kProcessIntervalMs +
-                            (now_ms - next_process_time_ms_) /
-                                kProcessIntervalMs * kProcessIntervalMs;
-  }
+  next_process_time_ms_ =
+      now_ms + kProcessIntervalMs - (now_ms % kProcessIntervalMs);
 }
 
 bool NackModule::RemovePacketsUntilKeyFrame() {
@@ -289,11 +284,12 @@ void NackModule::AddPacketsToNack(uint16_t seq_num_start,
   }
 }
 
-std::vector<uint16_t> NackModule::GetNackBatch(NackFilterOptions options) {
+void NackModule::GetNackBatch(NackFilterOptions options,
+                              std::vector<uint16_t>* nack_batch) {
   bool consider_seq_num = options != kTimeOnly;
   bool consider_timestamp = options != kSeqNumOnly;
   Timestamp now = clock_->CurrentTime();
-  std::vector<uint16_t> nack_batch;
+  nack_batch->clear();
   auto it = nack_list_.begin();
   while (it != nack_list_.end()) {
     TimeDelta resend_delay = TimeDelta::Millis(rtt_ms_);
@@ -317,7 +313,7 @@ std::vector<uint16_t> NackModule::GetNackBatch(NackFilterOptions options) {
         AheadOrAt(newest_seq_num_, it->second.send_at_seq_num);
     if (delay_timed_out && ((consider_seq_num && nack_on_seq_num_passed) ||
                             (consider_timestamp && nack_on_rtt_passed))) {
-      nack_batch.emplace_back(it->second.seq_num);
+      nack_batch->emplace_back(it->second.seq_num);
       ++it->second.retries;
       it->second.sent_at_time = now.ms();
       if (it->second.retries >= kMaxNackRetries) {
@@ -331,7 +327,6 @@ std::vector<uint16_t> NackModule::GetNackBatch(NackFilterOptions options) {
     }
     ++it;
   }
-  return nack_batch;
 }
 
 void NackModule::UpdateReorderingStatistics(uint16_t seq_num) {
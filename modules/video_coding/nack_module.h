@@ -84,7 +84,10 @@ class NackModule : public Module {
   // Removes packets from the nack list until the next keyframe. Returns true
   // if packets were removed.
   bool RemovePacketsUntilKeyFrame() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
-  std::vector<uint16_t> GetNackBatch(NackFilterOptions options)
+  // Fills |nack_batch| (clearing any previous content) with the sequence
+  // numbers that should be nacked now.
+  void GetNackBatch(NackFilterOptions options,
+                    std::vector<uint16_t>* nack_batch)
       RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
 
   // Update the reordering distribution.
@@ -115,6 +118,14 @@ class NackModule : public Module {
   int64_t rtt_ms_ RTC_GUARDED_BY(crit_);
   uint16_t newest_seq_num_ RTC_GUARDED_BY(crit_);
 
+  // Preallocated buffers for the outgoing nack batches, so that neither the
+  // per-packet path nor the periodic process tick allocates a fresh vector.
+  // |on_receive_nack_batch_| is used by OnReceivedPacket under |crit_|;
+  // |process_nack_batch_| is only touched on the process thread, where it is
+  // also read after |crit_| has been released, so it cannot be guarded.
+  std::vector<uint16_t> on_receive_nack_batch_ RTC_GUARDED_BY(crit_);
+  std::vector<uint16_t> process_nack_batch_;
+
   // Only touched on the process thread.
   int64_t next_process_time_ms_;
 
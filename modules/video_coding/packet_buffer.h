@@ -55,9 +55,6 @@ class PacketBuffer {
       return video_header.is_last_packet_in_frame;
     }
 
-    // If all its previous packets have been inserted into the packet buffer.
-    // Set and used internally by the PacketBuffer.
-    bool continuous = false;
     bool marker_bit = false;
     uint8_t payload_type = 0;
     uint16_t seq_num = 0;
@@ -92,7 +89,26 @@ class PacketBuffer {
   absl::optional<int64_t> LastReceivedPacketMs() const;
   absl::optional<int64_t> LastReceivedKeyframePacketMs() const;
 
+  // Number of payload bytes held by the currently stored packets.
+  size_t UsedMemoryBytes() const;
+
  private:
+  // A slot in the circular buffer. The metadata needed to determine packet
+  // continuity is mirrored from the stored packet into the slot itself, so
+  // the scan in PotentialNewFrame walks a contiguous array instead of
+  // dereferencing every packet.
+  struct StoredPacket {
+    uint16_t seq_num = 0;
+    uint32_t timestamp = 0;
+    // True if the slot holds a packet.
+    bool used = false;
+    // True if all previous packets have been inserted into the buffer.
+    bool continuous = false;
+    bool frame_begin = false;
+    bool frame_end = false;
+    std::unique_ptr<Packet> packet;
+  };
+
   Clock* const clock_;
 
   // Tries to expand the buffer.
@@ -126,7 +142,7 @@ class PacketBuffer {
 
   // Buffer that holds the the inserted packets and information needed to
   // determine continuity between them.
-  std::vector<std::unique_ptr<Packet>> buffer_ RTC_GUARDED_BY(crit_);
+  std::vector<StoredPacket> buffer_ RTC_GUARDED_BY(crit_);
 
   // Timestamp of the last received packet/keyframe packet.
   absl::optional<int64_t> last_received_packet_ms_ RTC_GUARDED_BY(crit_);
@@ -135,6 +151,10 @@ class PacketBuffer {
   absl::optional<uint32_t> last_received_keyframe_rtp_timestamp_
       RTC_GUARDED_BY(crit_);
 
+  // Sum of the payload sizes of the stored packets, maintained on insertion
+  // and removal.
+  size_t payload_bytes_ RTC_GUARDED_BY(crit_);
+
   absl::optional<uint16_t> newest_inserted_seq_num_ RTC_GUARDED_BY(crit_);
   std::set<uint16_t, DescendingSeqNumComp<uint16_t>> missing_packets_
       RTC_GUARDED_BY(crit_);
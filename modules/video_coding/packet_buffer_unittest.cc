@@ -144,6 +144,25 @@ TEST_F(PacketBufferTest, InsertOnePacket) {
   EXPECT_THAT(Insert(seq_num, kKeyFrame, kFirst, kLast).packets, SizeIs(1));
 }
 
+TEST_F(PacketBufferTest, TracksUsedMemory) {
+  const uint16_t seq_num = Rand();
+  const uint8_t payload[16] = {};
+  EXPECT_EQ(packet_buffer_.UsedMemoryBytes(), 0u);
+  Insert(seq_num, kKeyFrame, kFirst, kNotLast, payload);
+  EXPECT_EQ(packet_buffer_.UsedMemoryBytes(), sizeof(payload));
+  Insert(seq_num + 1, kDeltaFrame, kNotFirst, kNotLast, payload);
+  EXPECT_EQ(packet_buffer_.UsedMemoryBytes(), 2 * sizeof(payload));
+
+  // Packets handed out as an assembled frame no longer count.
+  Insert(seq_num + 2, kDeltaFrame, kNotFirst, kLast, payload);
+  EXPECT_EQ(packet_buffer_.UsedMemoryBytes(), 0u);
+
+  Insert(seq_num + 3, kDeltaFrame, kFirst, kNotLast, payload);
+  EXPECT_EQ(packet_buffer_.UsedMemoryBytes(), sizeof(payload));
+  packet_buffer_.Clear();
+  EXPECT_EQ(packet_buffer_.UsedMemoryBytes(), 0u);
+}
+
 TEST_F(PacketBufferTest, InsertMultiplePackets) {
   const uint16_t seq_num = Rand();
   EXPECT_THAT(Insert(seq_num, kKeyFrame, kFirst, kLast).packets, SizeIs(1));
@@ -453,11 +453,9 @@ TEST_F(VCMReceiverTimingTest, FrameForDecodingPreferLateDecoding) {
   int64_t arrive_timestamps[kNumFrames];
   int64_t render_timestamps[kNumFrames];
 
-  int render_delay_ms;
-  int max_decode_ms;
-  int dummy;
-  timing_.GetTimings(&max_decode_ms, &dummy, &dummy, &dummy, &dummy,
-                     &render_delay_ms);
+  const VCMTiming::VideoDelayTimings timings = timing_.GetTimings();
+  const int render_delay_ms = timings.render_delay_ms;
+  const int max_decode_ms = timings.max_decode_ms;
 
   // Construct test samples.
   // render_timestamps are the timestamps stored in the Frame;
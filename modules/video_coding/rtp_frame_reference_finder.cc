@@ -512,8 +512,11 @@ RtpFrameReferenceFinder::FrameDecision RtpFrameReferenceFinder::ManageFrameVp9(
       current_ss_idx_ = Add<kMaxGofSaved>(current_ss_idx_, 1);
       scalability_structures_[current_ss_idx_] = gof;
       scalability_structures_[current_ss_idx_].pid_start = frame->id.picture_id;
+      BuildGofLookupTable(scalability_structures_[current_ss_idx_],
+                          &gof_lookup_tables_[current_ss_idx_]);
       gof_info_.emplace(unwrapped_tl0,
                         GofInfo(&scalability_structures_[current_ss_idx_],
+                                &gof_lookup_tables_[current_ss_idx_],
                                 frame->id.picture_id));
     }
 
@@ -555,10 +558,12 @@ RtpFrameReferenceFinder::FrameDecision RtpFrameReferenceFinder::ManageFrameVp9(
       return kStash;
 
     if (codec_header.temporal_idx == 0) {
-      gof_info_it = gof_info_
-                        .emplace(unwrapped_tl0, GofInfo(gof_info_it->second.gof,
-                                                        frame->id.picture_id))
-                        .first;
+      gof_info_it =
+          gof_info_
+              .emplace(unwrapped_tl0, GofInfo(gof_info_it->second.gof,
+                                              gof_info_it->second.lookup,
+                                              frame->id.picture_id))
+              .first;
     }
 
     info = &gof_info_it->second;
@@ -577,30 +582,31 @@ RtpFrameReferenceFinder::FrameDecision RtpFrameReferenceFinder::ManageFrameVp9(
     return kStash;
 
   if (codec_header.temporal_up_switch)
-    up_switch_.emplace(frame->id.picture_id, codec_header.temporal_idx);
+    up_switch_.Insert(frame->id.picture_id, codec_header.temporal_idx);
 
   // Clean out old info about up switch frames.
   uint16_t old_picture_id = Subtract<kPicIdLength>(frame->id.picture_id, 50);
-  auto up_switch_erase_to = up_switch_.lower_bound(old_picture_id);
-  up_switch_.erase(up_switch_.begin(), up_switch_erase_to);
+  up_switch_.RemoveOlderThan(old_picture_id);
 
   size_t diff = ForwardDiff<uint16_t, kPicIdLength>(info->gof->pid_start,
                                                     frame->id.picture_id);
-  size_t gof_idx = diff % info->gof->num_frames_in_gof;
+  const GofFrameLookup& frame_lookup =
+      info->lookup->frames[diff % info->lookup->num_frames_in_gof];
 
-  if (info->gof->num_ref_pics[gof_idx] > EncodedFrame::kMaxFrameReferences) {
+  if (frame_lookup.num_ref_pics > EncodedFrame::kMaxFrameReferences) {
     return kDrop;
   }
   // Populate references according to the scalability structure.
-  frame->num_references = info->gof->num_ref_pics[gof_idx];
+  frame->num_references = frame_lookup.num_ref_pics;
   for (size_t i = 0; i < frame->num_references; ++i) {
-    frame->references[i] = Subtract<kPicIdLength>(
-        frame->id.picture_id, info->gof->pid_diff[gof_idx][i]);
+    frame->references[i] = Subtract<kPicIdLength>(frame->id.picture_id,
+                                                  frame_lookup.pid_diff[i]);
 
     // If this is a reference to a frame earlier than the last up switch point,
     // then ignore this reference.
-    if (UpSwitchInIntervalVp9(frame->id.picture_id, codec_header.temporal_idx,
-                              frame->references[i])) {
+    if (up_switch_.UpSwitchInInterval(frame->id.picture_id,
+                                      codec_header.temporal_idx,
+                                      frame->references[i])) {
       --frame->num_references;
     }
   }
@@ -618,10 +624,10 @@ bool RtpFrameReferenceFinder::MissingRequiredFrameVp9(uint16_t picture_id,
                                                       const GofInfo& info) {
   size_t diff =
       ForwardDiff<uint16_t, kPicIdLength>(info.gof->pid_start, picture_id);
-  size_t gof_idx = diff % info.gof->num_frames_in_gof;
-  size_t temporal_idx = info.gof->temporal_idx[gof_idx];
+  const GofFrameLookup& frame_lookup =
+      info.lookup->frames[diff % info.lookup->num_frames_in_gof];
 
-  if (temporal_idx >= kMaxTemporalLayers) {
+  if (!frame_lookup.valid_temporal_idx) {
     RTC_LOG(LS_WARNING) << "At most " << kMaxTemporalLayers
                         << " temporal "
                            "layers are supported.";
@@ -631,16 +637,12 @@ bool RtpFrameReferenceFinder::MissingRequiredFrameVp9(uint16_t picture_id,
   // For every reference this frame has, check if there is a frame missing in
   // the interval (|ref_pid|, |picture_id|) in any of the lower temporal
   // layers. If so, we are missing a required frame.
-  uint8_t num_references = info.gof->num_ref_pics[gof_idx];
-  for (size_t i = 0; i < num_references; ++i) {
+  for (size_t i = 0; i < frame_lookup.num_ref_pics; ++i) {
     uint16_t ref_pid =
-        Subtract<kPicIdLength>(picture_id, info.gof->pid_diff[gof_idx][i]);
-    for (size_t l = 0; l < temporal_idx; ++l) {
-      auto missing_frame_it = missing_frames_for_layer_[l].lower_bound(ref_pid);
-      if (missing_frame_it != missing_frames_for_layer_[l].end() &&
-          AheadOf<uint16_t, kPicIdLength>(picture_id, *missing_frame_it)) {
+        Subtract<kPicIdLength>(picture_id, frame_lookup.pid_diff[i]);
+    for (size_t l = 0; l < frame_lookup.temporal_idx; ++l) {
+      if (missing_frames_for_layer_[l].MissingInInterval(ref_pid, picture_id))
         return true;
-      }
     }
   }
   return false;
@@ -649,7 +651,7 @@ bool RtpFrameReferenceFinder::MissingRequiredFrameVp9(uint16_t picture_id,
 void RtpFrameReferenceFinder::FrameReceivedVp9(uint16_t picture_id,
                                                GofInfo* info) {
   int last_picture_id = info->last_picture_id;
-  size_t gof_size = std::min(info->gof->num_frames_in_gof, kMaxVp9FramesInGof);
+  size_t gof_size = info->lookup->num_frames_in_gof;
 
   // If there is a gap, find which temporal layer the missing frames
   // belong to and add the frame as missing for that temporal layer.
@@ -664,15 +666,16 @@ void RtpFrameReferenceFinder::FrameReceivedVp9(uint16_t picture_id,
       gof_idx = (gof_idx + 1) % gof_size;
       RTC_CHECK(gof_idx < kMaxVp9FramesInGof);
 
-      size_t temporal_idx = info->gof->temporal_idx[gof_idx];
-      if (temporal_idx >= kMaxTemporalLayers) {
+      const GofFrameLookup& frame_lookup = info->lookup->frames[gof_idx];
+      if (!frame_lookup.valid_temporal_idx) {
         RTC_LOG(LS_WARNING) << "At most " << kMaxTemporalLayers
                             << " temporal "
                                "layers are supported.";
         return;
       }
 
-      missing_frames_for_layer_[temporal_idx].insert(last_picture_id);
+      missing_frames_for_layer_[frame_lookup.temporal_idx].Insert(
+          last_picture_id);
       last_picture_id = Add<kPicIdLength>(last_picture_id, 1);
     }
 
@@ -683,29 +686,103 @@ void RtpFrameReferenceFinder::FrameReceivedVp9(uint16_t picture_id,
     size_t gof_idx = diff % gof_size;
     RTC_CHECK(gof_idx < kMaxVp9FramesInGof);
 
-    size_t temporal_idx = info->gof->temporal_idx[gof_idx];
-    if (temporal_idx >= kMaxTemporalLayers) {
+    const GofFrameLookup& frame_lookup = info->lookup->frames[gof_idx];
+    if (!frame_lookup.valid_temporal_idx) {
       RTC_LOG(LS_WARNING) << "At most " << kMaxTemporalLayers
                           << " temporal "
                              "layers are supported.";
       return;
     }
 
-    missing_frames_for_layer_[temporal_idx].erase(picture_id);
+    missing_frames_for_layer_[frame_lookup.temporal_idx].Erase(picture_id);
+  }
+}
+
+// static
+void RtpFrameReferenceFinder::BuildGofLookupTable(const GofInfoVP9& gof,
+                                                  GofLookupTable* table) {
+  table->num_frames_in_gof =
+      std::min(gof.num_frames_in_gof, kMaxVp9FramesInGof);
+  for (size_t i = 0; i < table->num_frames_in_gof; ++i) {
+    GofFrameLookup& frame_lookup = table->frames[i];
+    frame_lookup.temporal_idx = gof.temporal_idx[i];
+    frame_lookup.valid_temporal_idx = gof.temporal_idx[i] < kMaxTemporalLayers;
+    frame_lookup.num_ref_pics = gof.num_ref_pics[i];
+    for (size_t j = 0; j < kMaxVp9RefPics; ++j)
+      frame_lookup.pid_diff[j] = gof.pid_diff[i][j];
+  }
+}
+
+void RtpFrameReferenceFinder::UpSwitchRing::Insert(uint16_t picture_id,
+                                                   uint8_t temporal_idx) {
+  for (size_t i = 0; i < size_; ++i) {
+    if (entries_[i].picture_id == picture_id)
+      return;
+  }
+  if (size_ == kCapacity) {
+    std::copy(entries_.begin() + 1, entries_.end(), entries_.begin());
+    --size_;
   }
+  entries_[size_++] = {picture_id, temporal_idx};
 }
 
-bool RtpFrameReferenceFinder::UpSwitchInIntervalVp9(uint16_t picture_id,
-                                                    uint8_t temporal_idx,
-                                                    uint16_t pid_ref) {
-  for (auto up_switch_it = up_switch_.upper_bound(pid_ref);
-       up_switch_it != up_switch_.end() &&
-       AheadOf<uint16_t, kPicIdLength>(picture_id, up_switch_it->first);
-       ++up_switch_it) {
-    if (up_switch_it->second < temporal_idx)
+void RtpFrameReferenceFinder::UpSwitchRing::RemoveOlderThan(
+    uint16_t picture_id) {
+  size_t new_size = 0;
+  for (size_t i = 0; i < size_; ++i) {
+    if (!AheadOf<uint16_t, kPicIdLength>(picture_id, entries_[i].picture_id))
+      entries_[new_size++] = entries_[i];
+  }
+  size_ = new_size;
+}
+
+bool RtpFrameReferenceFinder::UpSwitchRing::UpSwitchInInterval(
+    uint16_t picture_id,
+    uint8_t temporal_idx,
+    uint16_t pid_ref) const {
+  for (size_t i = 0; i < size_; ++i) {
+    if (entries_[i].temporal_idx < temporal_idx &&
+        AheadOf<uint16_t, kPicIdLength>(entries_[i].picture_id, pid_ref) &&
+        AheadOf<uint16_t, kPicIdLength>(picture_id, entries_[i].picture_id)) {
       return true;
+    }
+  }
+  return false;
+}
+
+void RtpFrameReferenceFinder::MissingFrameRing::Insert(uint16_t picture_id) {
+  for (size_t i = 0; i < size_; ++i) {
+    if (picture_ids_[i] == picture_id)
+      return;
+  }
+  if (size_ == kCapacity) {
+    std::copy(picture_ids_.begin() + 1, picture_ids_.end(),
+              picture_ids_.begin());
+    --size_;
+  }
+  picture_ids_[size_++] = picture_id;
+}
+
+void RtpFrameReferenceFinder::MissingFrameRing::Erase(uint16_t picture_id) {
+  for (size_t i = 0; i < size_; ++i) {
+    if (picture_ids_[i] == picture_id) {
+      std::copy(picture_ids_.begin() + i + 1, picture_ids_.begin() + size_,
+                picture_ids_.begin() + i);
+      --size_;
+      return;
+    }
   }
+}
 
+bool RtpFrameReferenceFinder::MissingFrameRing::MissingInInterval(
+    uint16_t pid_from,
+    uint16_t pid_to) const {
+  for (size_t i = 0; i < size_; ++i) {
+    if (!AheadOf<uint16_t, kPicIdLength>(pid_from, picture_ids_[i]) &&
+        AheadOf<uint16_t, kPicIdLength>(pid_to, picture_ids_[i])) {
+      return true;
+    }
+  }
   return false;
 }
 
@@ -72,13 +72,80 @@ class RtpFrameReferenceFinder {
 
   enum FrameDecision { kStash, kHandOff, kDrop };
 
+  // Precomputed per-frame slot of a scalability structure, built once when
+  // the structure is received so that per-frame reference resolution is
+  // plain array reads. See BuildGofLookupTable().
+  struct GofFrameLookup {
+    uint8_t temporal_idx;
+    // False if the signaled temporal index is out of range; such frames are
+    // dropped.
+    bool valid_temporal_idx;
+    uint8_t num_ref_pics;
+    uint8_t pid_diff[kMaxVp9RefPics];
+  };
+
+  struct GofLookupTable {
+    size_t num_frames_in_gof;
+    GofFrameLookup frames[kMaxVp9FramesInGof];
+  };
+
   struct GofInfo {
-    GofInfo(GofInfoVP9* gof, uint16_t last_picture_id)
-        : gof(gof), last_picture_id(last_picture_id) {}
+    GofInfo(GofInfoVP9* gof,
+            const GofLookupTable* lookup,
+            uint16_t last_picture_id)
+        : gof(gof), lookup(lookup), last_picture_id(last_picture_id) {}
     GofInfoVP9* gof;
+    const GofLookupTable* lookup;
     uint16_t last_picture_id;
   };
 
+  // Fixed-size replacement for a picture id ordered std::map/std::set; the
+  // bookkeeping below runs for every frame, and node based containers cost
+  // an allocation per insert. The ring keeps the most recent |kCapacity|
+  // entries in insertion order and drops the oldest one on overflow.
+  class UpSwitchRing {
+   public:
+    // Records that |picture_id| had the up switch flag set for
+    // |temporal_idx|. No-op if |picture_id| is already recorded.
+    void Insert(uint16_t picture_id, uint8_t temporal_idx);
+
+    // Removes all entries older than |picture_id|.
+    void RemoveOlderThan(uint16_t picture_id);
+
+    // Checks if there is a recorded frame with the up-switch flag set in the
+    // interval (|pid_ref|, |picture_id|) with temporal layer smaller than
+    // |temporal_idx|.
+    bool UpSwitchInInterval(uint16_t picture_id,
+                            uint8_t temporal_idx,
+                            uint16_t pid_ref) const;
+
+   private:
+    static constexpr size_t kCapacity = 64;
+    struct Entry {
+      uint16_t picture_id;
+      uint8_t temporal_idx;
+    };
+    std::array<Entry, kCapacity> entries_;
+    size_t size_ = 0;
+  };
+
+  // Fixed-size replacement for the per temporal layer std::set of missing
+  // picture ids, see |missing_frames_for_layer_|.
+  class MissingFrameRing {
+   public:
+    void Insert(uint16_t picture_id);
+    void Erase(uint16_t picture_id);
+
+    // Checks if a missing frame is recorded in the interval
+    // [|pid_from|, |pid_to|).
+    bool MissingInInterval(uint16_t pid_from, uint16_t pid_to) const;
+
+   private:
+    static constexpr size_t kCapacity = 128;
+    std::array<uint16_t, kCapacity> picture_ids_;
+    size_t size_ = 0;
+  };
+
   // Find the relevant group of pictures and update its "last-picture-id-with
   // padding" sequence number.
   void UpdateLastPictureIdWithPadding(uint16_t seq_num);
@@ -120,11 +187,8 @@ class RtpFrameReferenceFinder {
   // if this is an already missing frame then it will be removed.
   void FrameReceivedVp9(uint16_t picture_id, GofInfo* info);
 
-  // Check if there is a frame with the up-switch flag set in the interval
-  // (|pid_ref|, |picture_id|) with temporal layer smaller than |temporal_idx|.
-  bool UpSwitchInIntervalVp9(uint16_t picture_id,
-                             uint8_t temporal_idx,
-                             uint16_t pid_ref);
+  // Flattens |gof| into per-frame lookup entries in |table|.
+  static void BuildGofLookupTable(const GofInfoVP9& gof, GofLookupTable* table);
 
   // Unwrap |frame|s picture id and its references to 16 bits.
   void UnwrapPictureIds(RtpFrameObject* frame);
@@ -186,18 +250,19 @@ class RtpFrameReferenceFinder {
   // Holds received scalability structures.
   std::array<GofInfoVP9, kMaxGofSaved> scalability_structures_;
 
+  // Precomputed lookup tables for the corresponding entries of
+  // |scalability_structures_|.
+  std::array<GofLookupTable, kMaxGofSaved> gof_lookup_tables_;
+
   // Holds the the Gof information for a given unwrapped TL0 picture index.
   std::map<int64_t, GofInfo> gof_info_;
 
   // Keep track of which picture id and which temporal layer that had the
   // up switch flag set.
-  std::map<uint16_t, uint8_t, DescendingSeqNumComp<uint16_t, kPicIdLength>>
-      up_switch_;
+  UpSwitchRing up_switch_;
 
-  // For every temporal layer, keep a set of which frames that are missing.
-  std::array<std::set<uint16_t, DescendingSeqNumComp<uint16_t, kPicIdLength>>,
-             kMaxTemporalLayers>
-      missing_frames_for_layer_;
+  // For every temporal layer, keep track of which frames that are missing.
+  std::array<MissingFrameRing, kMaxTemporalLayers> missing_frames_for_layer_;
 
   // How far frames have been cleared by sequence number. A frame will be
   // cleared if it contains a packet with a sequence number older than
@@ -13,6 +13,7 @@
 #include <assert.h>
 
 #include <algorithm>
+#include <memory>
 
 #include "rtc_base/time/timestamp_extrapolator.h"
 #include "system_wrappers/include/clock.h"
@@ -31,7 +32,8 @@ VCMTiming::VCMTiming(Clock* clock, VCMTiming* master_timing)
       current_delay_ms_(0),
       prev_frame_timestamp_(0),
       timing_frame_info_(),
-      num_decoded_frames_(0) {
+      num_decoded_frames_(0),
+      num_decode_budget_overruns_(0) {
   if (master_timing == NULL) {
     master_ = true;
     ts_extrapolator_ = new TimestampExtrapolator(clock_->TimeInMilliseconds());
@@ -84,6 +86,10 @@ int VCMTiming::max_playout_delay() {
 
 void VCMTiming::SetJitterDelay(int jitter_delay_ms) {
   rtc::CritScope cs(&crit_sect_);
+  SetJitterDelayInternal(jitter_delay_ms);
+}
+
+void VCMTiming::SetJitterDelayInternal(int jitter_delay_ms) {
   if (jitter_delay_ms != jitter_delay_ms_) {
     jitter_delay_ms_ = jitter_delay_ms;
     // When in initial state, set current delay to minimum delay.
@@ -136,6 +142,11 @@ void VCMTiming::UpdateCurrentDelay(uint32_t frame_timestamp) {
 void VCMTiming::UpdateCurrentDelay(int64_t render_time_ms,
                                    int64_t actual_decode_time_ms) {
   rtc::CritScope cs(&crit_sect_);
+  UpdateCurrentDelayInternal(render_time_ms, actual_decode_time_ms);
+}
+
+void VCMTiming::UpdateCurrentDelayInternal(int64_t render_time_ms,
+                                           int64_t actual_decode_time_ms) {
   uint32_t target_delay_ms = TargetDelayInternal();
   int64_t delayed_ms =
       actual_decode_time_ms -
@@ -159,6 +170,12 @@ void VCMTiming::StopDecodeTimer(uint32_t /*time_stamp*/,
 
 void VCMTiming::StopDecodeTimer(int32_t decode_time_ms, int64_t now_ms) {
   rtc::CritScope cs(&crit_sect_);
+  // Compare against the budget before this frame's sample is added to the
+  // filter, so a slow frame cannot raise the budget it is judged against.
+  // The first frame is not counted since the budget is still the default.
+  if (num_decoded_frames_ > 0 && decode_time_ms > RequiredDecodeTimeMs()) {
+    ++num_decode_budget_overruns_;
+  }
   codec_timer_->AddTiming(decode_time_ms, now_ms);
   assert(decode_time_ms >= 0);
   ++num_decoded_frames_;
@@ -220,30 +237,45 @@ int VCMTiming::TargetDelayInternal() const {
                   jitter_delay_ms_ + RequiredDecodeTimeMs() + render_delay_ms_);
 }
 
-bool VCMTiming::GetTimings(int* max_decode_ms,
-                           int* current_delay_ms,
-                           int* target_delay_ms,
-                           int* jitter_buffer_ms,
-                           int* min_playout_delay_ms,
-                           int* render_delay_ms) const {
+VCMTiming::VideoDelayTimings VCMTiming::GetTimings() const {
   rtc::CritScope cs(&crit_sect_);
-  *max_decode_ms = RequiredDecodeTimeMs();
-  *current_delay_ms = current_delay_ms_;
-  *target_delay_ms = TargetDelayInternal();
-  *jitter_buffer_ms = jitter_delay_ms_;
-  *min_playout_delay_ms = min_playout_delay_ms_;
-  *render_delay_ms = render_delay_ms_;
-  return (num_decoded_frames_ > 0);
+  return GetTimingsInternal();
 }
 
-void VCMTiming::SetTimingFrameInfo(const TimingFrameInfo& info) {
+VCMTiming::VideoDelayTimings VCMTiming::GetTimingsInternal() const {
+  VideoDelayTimings timings;
+  timings.max_decode_ms = RequiredDecodeTimeMs();
+  timings.current_delay_ms = current_delay_ms_;
+  timings.target_delay_ms = TargetDelayInternal();
+  timings.jitter_buffer_ms = jitter_delay_ms_;
+  timings.min_playout_delay_ms = min_playout_delay_ms_;
+  timings.render_delay_ms = render_delay_ms_;
+  timings.num_decoded_frames = num_decoded_frames_;
+  timings.num_decode_budget_overruns = num_decode_budget_overruns_;
+  return timings;
+}
+
+VCMTiming::VideoDelayTimings VCMTiming::SetJitterDelayAndUpdateCurrentDelay(
+    int jitter_delay_ms,
+    int64_t render_time_ms,
+    int64_t actual_decode_time_ms) {
   rtc::CritScope cs(&crit_sect_);
-  timing_frame_info_.emplace(info);
+  SetJitterDelayInternal(jitter_delay_ms);
+  UpdateCurrentDelayInternal(render_time_ms, actual_decode_time_ms);
+  return GetTimingsInternal();
+}
+
+void VCMTiming::SetTimingFrameInfo(const TimingFrameInfo& info) {
+  std::atomic_store(&timing_frame_info_,
+                    std::make_shared<const TimingFrameInfo>(info));
 }
 
 absl::optional<TimingFrameInfo> VCMTiming::GetTimingFrameInfo() {
-  rtc::CritScope cs(&crit_sect_);
-  return timing_frame_info_;
+  std::shared_ptr<const TimingFrameInfo> info =
+      std::atomic_load(&timing_frame_info_);
+  if (!info)
+    return absl::nullopt;
+  return *info;
 }
 
 }  // namespace webrtc
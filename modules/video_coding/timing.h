@@ -88,14 +88,34 @@ class VCMTiming {
   // render delay.
   int TargetVideoDelay() const;
 
-  // Return current timing information. Returns true if the first frame has been
-  // decoded, false otherwise.
-  virtual bool GetTimings(int* max_decode_ms,
-                          int* current_delay_ms,
-                          int* target_delay_ms,
-                          int* jitter_buffer_ms,
-                          int* min_playout_delay_ms,
-                          int* render_delay_ms) const;
+  // Current timing information, as reported to the stats callbacks. The
+  // values are only meaningful once at least one frame has been decoded,
+  // i.e. when |num_decoded_frames| > 0.
+  struct VideoDelayTimings {
+    int max_decode_ms = 0;
+    int current_delay_ms = 0;
+    int target_delay_ms = 0;
+    int jitter_buffer_ms = 0;
+    int min_playout_delay_ms = 0;
+    int render_delay_ms = 0;
+    size_t num_decoded_frames = 0;
+    // Number of frames whose actual decode time exceeded the decode time
+    // budgeted for them (the percentile estimate from VCMCodecTimer). These
+    // are the frames that risk missing their render time.
+    size_t num_decode_budget_overruns = 0;
+  };
+
+  // Return current timing information.
+  virtual VideoDelayTimings GetTimings() const;
+
+  // Sets the jitter delay and updates the current delay in a single critical
+  // section, equivalent to SetJitterDelay() followed by UpdateCurrentDelay(),
+  // and returns the resulting timings. Used on the per-frame path to avoid
+  // three separate lock acquisitions.
+  virtual VideoDelayTimings SetJitterDelayAndUpdateCurrentDelay(
+      int jitter_delay_ms,
+      int64_t render_time_ms,
+      int64_t actual_decode_time_ms);
 
   void SetTimingFrameInfo(const TimingFrameInfo& info);
   absl::optional<TimingFrameInfo> GetTimingFrameInfo();
@@ -110,6 +130,14 @@ class VCMTiming {
   int TargetDelayInternal() const RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_sect_);
 
  private:
+  void SetJitterDelayInternal(int jitter_delay_ms)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_sect_);
+  void UpdateCurrentDelayInternal(int64_t render_time_ms,
+                                  int64_t actual_decode_time_ms)
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_sect_);
+  VideoDelayTimings GetTimingsInternal() const
+      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_sect_);
+
   rtc::CriticalSection crit_sect_;
   Clock* const clock_;
   bool master_ RTC_GUARDED_BY(crit_sect_);
@@ -126,8 +154,11 @@ class VCMTiming {
   int jitter_delay_ms_ RTC_GUARDED_BY(crit_sect_);
   int current_delay_ms_ RTC_GUARDED_BY(crit_sect_);
   uint32_t prev_frame_timestamp_ RTC_GUARDED_BY(crit_sect_);
-  absl::optional<TimingFrameInfo> timing_frame_info_ RTC_GUARDED_BY(crit_sect_);
+  // Accessed with std::atomic_load/atomic_store so that readers on the
+  // per-frame path do not need to take |crit_sect_|.
+  std::shared_ptr<const TimingFrameInfo> timing_frame_info_;
   size_t num_decoded_frames_ RTC_GUARDED_BY(crit_sect_);
+  size_t num_decode_budget_overruns_ RTC_GUARDED_BY(crit_sect_);
 };
 }  // namespace webrtc
 
@@ -71,13 +71,15 @@ int AsyncStunTCPSocket::Send(const void* pv,
   if (cb != expected_pkt_len)
     return -1;
 
-  AppendToOutBuffer(pv, cb);
-
+  // Write the packet, and any ChannelData padding, straight from the
+  // caller's buffer; only what the socket does not accept ends up in the
+  // out buffer.
   RTC_DCHECK(pad_bytes < 4);
-  char padding[4] = {0};
-  AppendToOutBuffer(padding, pad_bytes);
+  static const char kPadding[4] = {0};
+  rtc::Socket::SendBuffer buffers[2] = {
+      {pv, cb}, {kPadding, static_cast<size_t>(pad_bytes)}};
 
-  int res = FlushOutBuffer();
+  int res = SendVectored(buffers, pad_bytes > 0 ? 2 : 1);
   if (res <= 0) {
     // drop packet if we made no progress
     ClearOutBuffer();
@@ -116,8 +118,7 @@ void AsyncStunTCPSocket::ProcessInput(char* data, size_t* len) {
       return;
     }
 
-    SignalReadPacket(this, data, expected_pkt_len, remote_addr,
-                     rtc::TimeMicros());
+    DispatchReadPacket(data, expected_pkt_len, remote_addr, rtc::TimeMicros());
 
     *len -= actual_length;
     if (*len > 0) {
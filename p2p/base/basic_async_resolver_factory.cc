@@ -10,12 +10,255 @@
 
 #include "p2p/base/basic_async_resolver_factory.h"
 
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/algorithm/container.h"
+#include "rtc_base/async_invoker.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/location.h"
+#include "rtc_base/logging.h"
 #include "rtc_base/net_helpers.h"
+#include "rtc_base/third_party/sigslot/sigslot.h"
+#include "rtc_base/thread.h"
 
 namespace webrtc {
+namespace {
+
+// Upper bound on underlying resolutions running at once. Each one occupies a
+// short-lived thread (see rtc::AsyncResolver), so this bounds the thread
+// fan-out when a large batch of hostname candidates arrives.
+constexpr size_t kMaxConcurrentResolutions = 4;
+// Number of resolved hostnames kept for reuse, trimmed least-recently-used
+// first. mDNS hostnames are stable per device, so reconnects hit the cache.
+constexpr size_t kMaxCachedResolutions = 100;
+
+}  // namespace
+
+// State shared between the factory and all resolvers it created: the result
+// cache, the currently running lookups with their waiters, and the queue of
+// lookups waiting for a free slot.
+class BasicAsyncResolverFactory::SharedState : public sigslot::has_slots<> {
+ public:
+  struct Result {
+    int error = -1;
+    std::vector<rtc::IPAddress> addresses;
+  };
+
+  ~SharedState() {
+    for (auto& kv : lookups_) {
+      if (kv.second.resolver != nullptr) {
+        kv.second.resolver->Destroy(false);
+      }
+    }
+    // |invoker_| cancels the deferred destruction of these on teardown, so
+    // destroy them here instead.
+    for (rtc::AsyncResolver* resolver : pending_destroy_) {
+      resolver->Destroy(false);
+    }
+  }
+
+  // Returns the cached result for |hostname|, or nullptr. A hit moves the
+  // entry to the front of the LRU list.
+  const Result* FindCached(const std::string& hostname) {
+    auto it = absl::c_find_if(cache_, [&](const CacheEntry& entry) {
+      return entry.hostname == hostname;
+    });
+    if (it == cache_.end())
+      return nullptr;
+    cache_.splice(cache_.begin(), cache_, it);
+    return &cache_.front().result;
+  }
+
+  // Requests resolution of |addr| on behalf of |waiter|. Joins the lookup
+  // already running or queued for the same hostname if there is one.
+  void Request(PooledResolver* waiter, const rtc::SocketAddress& addr) {
+    const std::string& hostname = addr.hostname();
+    auto it = lookups_.find(hostname);
+    if (it != lookups_.end()) {
+      it->second.waiters.push_back(waiter);
+      return;
+    }
+    Lookup& lookup = lookups_[hostname];
+    lookup.addr = addr;
+    lookup.waiters.push_back(waiter);
+    if (running_ < kMaxConcurrentResolutions) {
+      StartLookup(hostname);
+    } else {
+      queue_.push_back(hostname);
+    }
+  }
+
+  // Detaches |waiter| from its pending lookup. A running lookup is left to
+  // complete and fill the cache; a queued lookup with no waiters left is
+  // dropped.
+  void Cancel(PooledResolver* waiter) {
+    for (auto it = lookups_.begin(); it != lookups_.end(); ++it) {
+      auto waiter_it = absl::c_find(it->second.waiters, waiter);
+      if (waiter_it == it->second.waiters.end())
+        continue;
+      it->second.waiters.erase(waiter_it);
+      if (it->second.waiters.empty() && it->second.resolver == nullptr) {
+        queue_.remove(it->first);
+        lookups_.erase(it);
+      }
+      return;
+    }
+  }
+
+ private:
+  struct CacheEntry {
+    std::string hostname;
+    Result result;
+  };
+  struct Lookup {
+    rtc::SocketAddress addr;
+    // The running underlying resolver, or null while queued.
+    rtc::AsyncResolver* resolver = nullptr;
+    std::vector<PooledResolver*> waiters;
+  };
+
+  void StartLookup(const std::string& hostname) {
+    Lookup& lookup = lookups_[hostname];
+    RTC_DCHECK(lookup.resolver == nullptr);
+    lookup.resolver = new rtc::AsyncResolver();
+    lookup.resolver->SignalDone.connect(this, &SharedState::OnLookupDone);
+    running_ += 1;
+    lookup.resolver->Start(lookup.addr);
+  }
+
+  void OnLookupDone(rtc::AsyncResolverInterface* resolver);
+
+  std::list<CacheEntry> cache_;  // Most recently used first.
+  std::map<std::string, Lookup> lookups_;
+  std::list<std::string> queue_;  // Hostnames waiting for a free slot.
+  // Finished underlying resolvers whose deferred Destroy() has not run yet.
+  std::vector<rtc::AsyncResolver*> pending_destroy_;
+  size_t running_ = 0;
+  rtc::AsyncInvoker invoker_;
+};
+
+// The resolver handed out to callers. Forwards to the shared state and keeps
+// the per-request result, so the AsyncResolverInterface contract (one Start,
+// one SignalDone, explicit Destroy) is unchanged.
+class BasicAsyncResolverFactory::PooledResolver
+    : public rtc::AsyncResolverInterface {
+ public:
+  explicit PooledResolver(
+      rtc::scoped_refptr<rtc::RefCountedObject<SharedState>> state)
+      : state_(std::move(state)) {}
+
+  void Start(const rtc::SocketAddress& addr) override {
+    addr_ = addr;
+    const SharedState::Result* cached = state_->FindCached(addr.hostname());
+    if (cached != nullptr) {
+      error_ = cached->error;
+      addresses_ = cached->addresses;
+      // Complete asynchronously, like a real resolution would; the invoker
+      // cancels the callback if this resolver is destroyed first.
+      invoker_.AsyncInvoke<void>(RTC_FROM_HERE, rtc::Thread::Current(),
+                                 [this] { SignalDone(this); });
+      return;
+    }
+    resolution_pending_ = true;
+    state_->Request(this, addr);
+  }
+
+  bool GetResolvedAddress(int family, rtc::SocketAddress* addr) const override {
+    if (error_ != 0 || addresses_.empty())
+      return false;
+    *addr = addr_;
+    for (const rtc::IPAddress& address : addresses_) {
+      if (family == address.family()) {
+        addr->SetResolvedIP(address);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  int GetError() const override { return error_; }
+
+  void Destroy(bool wait) override {
+    if (resolution_pending_) {
+      state_->Cancel(this);
+    }
+    delete this;
+  }
+
+  // Called by SharedState when the shared lookup completed.
+  void OnResult(const SharedState::Result& result) {
+    RTC_DCHECK(resolution_pending_);
+    resolution_pending_ = false;
+    error_ = result.error;
+    addresses_ = result.addresses;
+    SignalDone(this);
+  }
+
+ private:
+  ~PooledResolver() override = default;
+
+  const rtc::scoped_refptr<rtc::RefCountedObject<SharedState>> state_;
+  rtc::SocketAddress addr_;
+  int error_ = -1;
+  std::vector<rtc::IPAddress> addresses_;
+  bool resolution_pending_ = false;
+  rtc::AsyncInvoker invoker_;
+};
+
+void BasicAsyncResolverFactory::SharedState::OnLookupDone(
+    rtc::AsyncResolverInterface* resolver) {
+  auto it = absl::c_find_if(lookups_, [resolver](const auto& kv) {
+    return kv.second.resolver == resolver;
+  });
+  RTC_DCHECK(it != lookups_.end());
+
+  Result result;
+  result.error = resolver->GetError();
+  result.addresses = static_cast<rtc::AsyncResolver*>(resolver)->addresses();
+  cache_.push_front({it->first, result});
+  if (cache_.size() > kMaxCachedResolutions) {
+    cache_.pop_back();
+  }
+
+  std::vector<PooledResolver*> waiters = std::move(it->second.waiters);
+  lookups_.erase(it);
+  // Destroying the underlying resolver from within its own SignalDone
+  // handler is not safe, defer it; see the same pattern in
+  // P2PTransportChannel::OnCandidateResolved.
+  rtc::AsyncResolver* done = static_cast<rtc::AsyncResolver*>(resolver);
+  pending_destroy_.push_back(done);
+  invoker_.AsyncInvoke<void>(RTC_FROM_HERE, rtc::Thread::Current(),
+                             [this, done] {
+                               pending_destroy_.erase(
+                                   absl::c_find(pending_destroy_, done));
+                               done->Destroy(false);
+                             });
+  running_ -= 1;
+
+  // Start the next queued lookup before notifying, so the pool stays full
+  // while the waiters process their results.
+  while (running_ < kMaxConcurrentResolutions && !queue_.empty()) {
+    std::string next = std::move(queue_.front());
+    queue_.pop_front();
+    StartLookup(next);
+  }
+
+  for (PooledResolver* waiter : waiters) {
+    waiter->OnResult(result);
+  }
+}
+
+BasicAsyncResolverFactory::BasicAsyncResolverFactory()
+    : state_(new rtc::RefCountedObject<SharedState>()) {}
+
+BasicAsyncResolverFactory::~BasicAsyncResolverFactory() = default;
 
 rtc::AsyncResolverInterface* BasicAsyncResolverFactory::Create() {
-  return new rtc::AsyncResolver();
+  return new PooledResolver(state_);
 }
 
 }  // namespace webrtc
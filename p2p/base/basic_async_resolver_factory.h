@@ -12,13 +12,38 @@
 #define P2P_BASE_BASIC_ASYNC_RESOLVER_FACTORY_H_
 
 #include "api/async_resolver_factory.h"
+#include "api/scoped_refptr.h"
 #include "rtc_base/async_resolver_interface.h"
+#include "rtc_base/ref_counted_object.h"
 
 namespace webrtc {
 
+// Creates resolvers that share one pool of underlying rtc::AsyncResolver
+// lookups:
+//  - results are cached per hostname, so re-signaled candidates and ICE
+//    restarts do not resolve the same name again;
+//  - concurrent lookups of the same hostname are coalesced onto a single
+//    resolution, so a batch of mDNS candidates from one signaling message
+//    costs one lookup per distinct hostname;
+//  - a bounded number of underlying resolutions (each one a short-lived
+//    thread, see rtc::AsyncResolver) run at a time, further lookups are
+//    queued.
+// The factory and every resolver it creates must be used on the same thread
+// (the network thread in the PeerConnection case).
 class BasicAsyncResolverFactory : public AsyncResolverFactory {
  public:
+  BasicAsyncResolverFactory();
+  ~BasicAsyncResolverFactory() override;
+
   rtc::AsyncResolverInterface* Create() override;
+
+ private:
+  class SharedState;
+  class PooledResolver;
+
+  // Shared with the resolvers, so outstanding lookups stay valid if the
+  // factory is destroyed first.
+  rtc::scoped_refptr<rtc::RefCountedObject<SharedState>> state_;
 };
 
 }  // namespace webrtc
@@ -32,12 +32,42 @@ class BasicAsyncResolverFactoryTest : public ::testing::Test,
     ASSERT_TRUE_WAIT(address_resolved_, 10000 /*ms*/);
   }
 
+  // Starts two resolutions of the same hostname through one factory. The
+  // first populates the shared cache, and both resolvers must signal
+  // completion independently.
+  void TestSharedResolution() {
+    BasicAsyncResolverFactory factory;
+    rtc::AsyncResolverInterface* resolver1 = factory.Create();
+    rtc::AsyncResolverInterface* resolver2 = factory.Create();
+    ASSERT_TRUE(resolver1);
+    ASSERT_TRUE(resolver2);
+    resolver1->SignalDone.connect(
+        this, &BasicAsyncResolverFactoryTest::SetAddressResolved);
+    resolver2->SignalDone.connect(
+        this, &BasicAsyncResolverFactoryTest::CountResolution);
+
+    rtc::SocketAddress address("", 0);
+    resolver1->Start(address);
+    ASSERT_TRUE_WAIT(address_resolved_, 10000 /*ms*/);
+    // The second resolution of the same hostname is served from the cache.
+    resolver2->Start(address);
+    ASSERT_TRUE_WAIT(resolution_count_ == 1, 10000 /*ms*/);
+    EXPECT_EQ(resolver1->GetError(), resolver2->GetError());
+    resolver1->Destroy(false);
+    resolver2->Destroy(false);
+  }
+
   void SetAddressResolved(rtc::AsyncResolverInterface* resolver) {
     address_resolved_ = true;
   }
 
+  void CountResolution(rtc::AsyncResolverInterface* resolver) {
+    ++resolution_count_;
+  }
+
  private:
   bool address_resolved_ = false;
+  int resolution_count_ = 0;
 };
 
 // This test is primarily intended to let tools check that the created resolver
@@ -46,4 +76,8 @@ TEST_F(BasicAsyncResolverFactoryTest, TestCreate) {
   TestCreate();
 }
 
+TEST_F(BasicAsyncResolverFactoryTest, TestSharedResolution) {
+  TestSharedResolution();
+}
+
 }  // namespace webrtc
@@ -67,21 +67,27 @@ BasicIceController::~BasicIceController() {}
 
 void BasicIceController::SetIceConfig(const IceConfig& config) {
   config_ = config;
+  RescheduleAllPingDeadlines(rtc::TimeMillis());
 }
 
 void BasicIceController::SetSelectedConnection(
     const Connection* selected_connection) {
   selected_connection_ = selected_connection;
+  RescheduleAllPingDeadlines(rtc::TimeMillis());
 }
 
 void BasicIceController::AddConnection(const Connection* connection) {
   connections_.push_back(connection);
   unpinged_connections_.insert(connection);
+  connections_needing_weak_pings_.insert(connection);
+  ping_wheel_.Schedule(connection, rtc::TimeMillis());
 }
 
 void BasicIceController::OnConnectionDestroyed(const Connection* connection) {
   pinged_connections_.erase(connection);
   unpinged_connections_.erase(connection);
+  connections_needing_weak_pings_.erase(connection);
+  ping_wheel_.Cancel(connection);
   connections_.erase(absl::c_find(connections_, connection));
 }
 
@@ -94,21 +100,28 @@ bool BasicIceController::HasPingableConnection() const {
 
 IceControllerInterface::PingResult BasicIceController::SelectConnectionToPing(
     int64_t last_ping_sent_ms) {
+  int64_t now = rtc::TimeMillis();
   // When the selected connection is not receiving or not writable, or any
   // active connection has not been pinged enough times, use the weak ping
-  // interval.
+  // interval. |connections_needing_weak_pings_| is maintained incrementally
+  // so this does not scan the full connection list.
   bool need_more_pings_at_weak_interval =
-      absl::c_any_of(connections_, [](const Connection* conn) {
-        return conn->active() &&
-               conn->num_pings_sent() < MIN_PINGS_AT_WEAK_PING_INTERVAL;
-      });
+      absl::c_any_of(connections_needing_weak_pings_,
+                     [](const Connection* conn) { return conn->active(); });
   int ping_interval = (weak() || need_more_pings_at_weak_interval)
                           ? weak_ping_interval()
                           : strong_ping_interval();
 
   const Connection* conn = nullptr;
-  if (rtc::TimeMillis() >= last_ping_sent_ms + ping_interval) {
-    conn = FindNextPingableConnection();
+  if (now >= last_ping_sent_ms + ping_interval) {
+    // In the steady (strong) state, consult the timing wheel first; if no
+    // connection has reached its ping deadline there is nothing to select
+    // and the full scan can be skipped. In the weak state every connection
+    // is pingable, so the deadlines don't apply.
+    if (weak() || need_more_pings_at_weak_interval ||
+        ping_wheel_.HasExpiredDeadline(now)) {
+      conn = FindNextPingableConnection();
+    }
   }
   PingResult res(conn, std::min(ping_interval, check_receiving_interval()));
   return res;
@@ -118,6 +131,12 @@ void BasicIceController::MarkConnectionPinged(const Connection* conn) {
   if (conn && pinged_connections_.insert(conn).second) {
     unpinged_connections_.erase(conn);
   }
+  if (conn) {
+    if (conn->num_pings_sent() >= MIN_PINGS_AT_WEAK_PING_INTERVAL) {
+      connections_needing_weak_pings_.erase(conn);
+    }
+    ReschedulePingDeadline(conn, rtc::TimeMillis());
+  }
 }
 
 // Returns the next pingable connection to ping.
@@ -258,6 +277,56 @@ int BasicIceController::CalculateActiveWritablePingInterval(
                                         : weak_or_stablizing_interval;
 }
 
+absl::optional<int64_t> BasicIceController::NextPingDeadline(
+    const Connection* conn,
+    int64_t now) const {
+  // This mirrors the structure of IsPingable(): connections that IsPingable()
+  // rejects regardless of time get no deadline (their pingability only
+  // changes together with connection state, which triggers a reschedule),
+  // time-limited connections get the time at which IsPingable() starts
+  // returning true, and the rest are due immediately.
+  if (conn->state() == IceCandidatePairState::FAILED) {
+    return absl::nullopt;
+  }
+  if (!conn->connected() && !conn->writable()) {
+    return absl::nullopt;
+  }
+  if (conn->TooManyOutstandingPings(field_trials_->max_outstanding_pings)) {
+    return absl::nullopt;
+  }
+  if (IsBackupConnection(conn)) {
+    if (conn->rtt_samples() == 0) {
+      return now;
+    }
+    return conn->last_ping_response_received() +
+           config_.backup_connection_ping_interval_or_default();
+  }
+  if (!conn->active()) {
+    return absl::nullopt;
+  }
+  if (!conn->writable()) {
+    return now;
+  }
+  return conn->last_ping_sent() +
+         CalculateActiveWritablePingInterval(conn, now);
+}
+
+void BasicIceController::ReschedulePingDeadline(const Connection* conn,
+                                                int64_t now) {
+  absl::optional<int64_t> deadline = NextPingDeadline(conn, now);
+  if (deadline) {
+    ping_wheel_.Schedule(conn, *deadline);
+  } else {
+    ping_wheel_.Cancel(conn);
+  }
+}
+
+void BasicIceController::RescheduleAllPingDeadlines(int64_t now) {
+  for (const Connection* conn : connections_) {
+    ReschedulePingDeadline(conn, now);
+  }
+}
+
 // Is the connection in a state for us to even consider pinging the other side?
 // We consider a connection pingable even if it's not connected because that's
 // how a TCP connection is kicked into reconnecting on the active side.
@@ -338,13 +407,9 @@ const Connection* BasicIceController::MorePingable(const Connection* conn1,
     return least_recently_pinged_conn;
   }
 
-  // During the initial state when nothing has been pinged yet, return the first
-  // one in the ordered |connections_|.
-  auto connections = connections_;
-  return *(std::find_if(connections.begin(), connections.end(),
-                        [conn1, conn2](const Connection* conn) {
-                          return conn == conn1 || conn == conn2;
-                        }));
+  // During the initial state when nothing has been pinged yet, return the
+  // better ranked one, as the old sorted |connections_| order would have.
+  return RanksBefore(conn2, conn1) ? conn2 : conn1;
 }
 
 const Connection* BasicIceController::MostLikelyToWork(
@@ -382,19 +447,21 @@ const Connection* BasicIceController::LeastRecentlyPinged(
 
 std::map<const rtc::Network*, const Connection*>
 BasicIceController::GetBestConnectionByNetwork() const {
-  // |connections_| has been sorted, so the first one in the list on a given
-  // network is the best connection on the network, except that the selected
-  // connection is always the best connection on the network.
+  // Select the best-ranked connection per network in one pass, except that
+  // the selected connection is always the best connection on its network.
   std::map<const rtc::Network*, const Connection*> best_connection_by_network;
   if (selected_connection_) {
     best_connection_by_network[selected_connection_->network()] =
         selected_connection_;
   }
-  // TODO(honghaiz): Need to update this if |connections_| are not sorted.
   for (const Connection* conn : connections_) {
-    const rtc::Network* network = conn->network();
-    // This only inserts when the network does not exist in the map.
-    best_connection_by_network.insert(std::make_pair(network, conn));
+    auto inserted = best_connection_by_network.insert(
+        std::make_pair(conn->network(), conn));
+    const Connection*& best = inserted.first->second;
+    if (!inserted.second && best != selected_connection_ &&
+        RanksBefore(conn, best)) {
+      best = conn;
+    }
   }
   return best_connection_by_network;
 }
@@ -523,29 +590,28 @@ IceControllerInterface::SwitchResult BasicIceController::ShouldSwitchConnection(
 
 IceControllerInterface::SwitchResult
 BasicIceController::SortAndSwitchConnection(IceControllerEvent reason) {
-  // Find the best alternative connection by sorting.  It is important to note
-  // that amongst equal preference, writable connections, this will choose the
-  // one whose estimated latency is lowest.  So it is the only one that we
-  // need to consider switching to.
-  // TODO(honghaiz): Don't sort;  Just use std::max_element in the right places.
-  absl::c_stable_sort(
-      connections_, [this](const Connection* a, const Connection* b) {
-        int cmp = CompareConnections(a, b, absl::nullopt, nullptr);
-        if (cmp != 0) {
-          return cmp > 0;
-        }
-        // Otherwise, sort based on latency estimate.
-        return a->rtt() < b->rtt();
-      });
+  // Find the best alternative connection with a single selection pass instead
+  // of sorting all connections; only the top connection needs to be
+  // considered for switching, and per-network bests are selected the same way
+  // in GetBestConnectionByNetwork(). Amongst equally ranked connections the
+  // earliest-added one wins, matching what stable_sort used to put first.
+  const Connection* top_connection = nullptr;
+  for (const Connection* conn : connections_) {
+    if (top_connection == nullptr || RanksBefore(conn, top_connection)) {
+      top_connection = conn;
+    }
+  }
 
-  RTC_LOG(LS_VERBOSE) << "Sorting " << connections_.size()
+  RTC_LOG(LS_VERBOSE) << "Ranking " << connections_.size()
                       << " available connections";
   for (size_t i = 0; i < connections_.size(); ++i) {
     RTC_LOG(LS_VERBOSE) << connections_[i]->ToString();
   }
 
-  const Connection* top_connection =
-      (!connections_.empty()) ? connections_[0] : nullptr;
+  // Connection states may have changed; they determine the ping deadlines,
+  // so refresh the timing wheel while we're here. Sorting only happens on
+  // state changes, not on every ping tick.
+  RescheduleAllPingDeadlines(rtc::TimeMillis());
 
   return ShouldSwitchConnection(reason, top_connection);
 }
@@ -688,6 +754,16 @@ int BasicIceController::CompareConnectionCandidates(const Connection* a,
   return 0;
 }
 
+bool BasicIceController::RanksBefore(const Connection* a,
+                                     const Connection* b) const {
+  int cmp = CompareConnections(a, b, absl::nullopt, nullptr);
+  if (cmp != 0) {
+    return cmp > 0;
+  }
+  // Otherwise, rank based on latency estimate.
+  return a->rtt() < b->rtt();
+}
+
 int BasicIceController::CompareConnections(
     const Connection* a,
     const Connection* b,
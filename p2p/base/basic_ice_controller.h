@@ -20,6 +20,7 @@
 #include "p2p/base/ice_controller_factory_interface.h"
 #include "p2p/base/ice_controller_interface.h"
 #include "p2p/base/p2p_transport_channel.h"
+#include "p2p/base/ping_timing_wheel.h"
 
 namespace cricket {
 
@@ -107,6 +108,16 @@ class BasicIceController : public IceControllerInterface {
   bool ReadyToSend(const Connection* connection) const;
   bool PresumedWritable(const Connection* conn) const;
 
+  // The next time |conn| may need to be pinged, for the ping timing wheel.
+  // nullopt if |conn| cannot be pinged until its state changes (and a
+  // reschedule happens).
+  absl::optional<int64_t> NextPingDeadline(const Connection* conn,
+                                           int64_t now) const;
+  void ReschedulePingDeadline(const Connection* conn, int64_t now);
+  // Recomputes the deadlines of all connections. Called when state that the
+  // deadlines depend on changes (selection, config, connection states).
+  void RescheduleAllPingDeadlines(int64_t now);
+
   int CompareCandidatePairNetworks(
       const Connection* a,
       const Connection* b,
@@ -131,6 +142,12 @@ class BasicIceController : public IceControllerInterface {
   // and static preferences. Does not include latency. Used by both sorting
   // and ShouldSwitchSelectedConnection().
   // Returns a positive value if |a| is better than |b|.
+  // True if |a| ranks strictly better than |b|, i.e. CompareConnections()
+  // with the rtt estimate as the final tie breaker. This is the order the
+  // full sort in SortAndSwitchConnection() used to establish; now it is only
+  // applied in selection passes for the top connection overall and per
+  // network.
+  bool RanksBefore(const Connection* a, const Connection* b) const;
   int CompareConnections(const Connection* a,
                          const Connection* b,
                          absl::optional<int64_t> receiving_unchanged_threshold,
@@ -156,6 +173,16 @@ class BasicIceController : public IceControllerInterface {
   std::set<const Connection*> pinged_connections_;
   std::set<const Connection*> unpinged_connections_;
 
+  // Tracks when each connection is next due for a ping so that
+  // SelectConnectionToPing() can skip the full connection scan on ticks
+  // where nothing is due.
+  PingTimingWheel ping_wheel_;
+  // Active connections that have not yet been pinged
+  // MIN_PINGS_AT_WEAK_PING_INTERVAL times; they keep the channel on the weak
+  // ping interval. Maintained incrementally to avoid scanning all
+  // connections on every tick.
+  std::set<const Connection*> connections_needing_weak_pings_;
+
   // Timestamp for when we got the first selectable connection.
   int64_t initial_select_timestamp_ms_ = 0;
 };
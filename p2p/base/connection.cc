@@ -449,6 +449,13 @@ void Connection::OnSendStunPacket(const void* data,
   }
 }
 
+void Connection::SetReadPacketCallback(ReadPacketCallback callback) {
+  RTC_DCHECK(!callback || !read_packet_callback_)
+      << "A read packet callback is already registered; clear it before "
+         "handing the connection to a new consumer.";
+  read_packet_callback_ = std::move(callback);
+}
+
 void Connection::OnReadPacket(const char* data,
                               size_t size,
                               int64_t packet_time_us) {
@@ -461,7 +468,11 @@ void Connection::OnReadPacket(const char* data,
     last_data_received_ = rtc::TimeMillis();
     UpdateReceiving(last_data_received_);
     recv_rate_tracker_.AddSamples(size);
-    SignalReadPacket(this, data, size, packet_time_us);
+    if (read_packet_callback_) {
+      read_packet_callback_(this, data, size, packet_time_us);
+    } else {
+      SignalReadPacket(this, data, size, packet_time_us);
+    }
 
     // If timed out sending writability checks, start up again
     if (!pruned_ && (write_state_ == STATE_WRITE_TIMEOUT)) {
@@ -705,7 +716,7 @@ void Connection::SendResponseMessage(const StunMessage& response) {
   const rtc::SocketAddress& addr = remote_candidate_.address();
 
   // Send the response message.
-  rtc::ByteBufferWriter buf;
+  rtc::ByteBufferWriter buf(kStunHeaderSize + response.length());
   response.Write(&buf);
   rtc::PacketOptions options(port_->StunDscpValue());
   options.info_signaled_after_sent.packet_type =
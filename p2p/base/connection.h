@@ -11,6 +11,7 @@
 #ifndef P2P_BASE_CONNECTION_H_
 #define P2P_BASE_CONNECTION_H_
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -160,6 +161,15 @@ class Connection : public CandidatePairInterface,
 
   sigslot::signal4<Connection*, const char*, size_t, int64_t> SignalReadPacket;
 
+  // Direct-dispatch alternative to SignalReadPacket for received data
+  // packets. The channel owning the connection is its only read consumer in
+  // production; when set, data packets are handed to |callback| instead of
+  // being routed through sigslot. May only transition between null and
+  // non-null. Must be called on the connection's thread.
+  using ReadPacketCallback =
+      std::function<void(Connection*, const char*, size_t, int64_t)>;
+  void SetReadPacketCallback(ReadPacketCallback callback);
+
   sigslot::signal1<Connection*> SignalReadyToSend;
 
   // Called when a packet is received on this connection.
@@ -393,6 +403,10 @@ class Connection : public CandidatePairInterface,
   // to last message ack:ed STUN_BINDING_REQUEST.
   bool ShouldSendGoogPing(const StunMessage* message);
 
+  // When set, OnReadPacket() delivers data packets here instead of firing
+  // SignalReadPacket; see SetReadPacketCallback().
+  ReadPacketCallback read_packet_callback_;
+
   WriteState write_state_;
   bool receiving_;
   bool connected_;
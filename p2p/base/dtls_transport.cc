@@ -78,6 +78,20 @@ rtc::StreamResult StreamInterfaceChannel::Read(void* buffer,
   if (state_ == rtc::SS_OPENING)
     return rtc::SR_BLOCK;
 
+  {
+    rtc::CritScope cs(&crit_);
+    // Serve the packet currently being dispatched by OnPacketReceived()
+    // straight from the transport's buffer, skipping the queue round-trip.
+    // Only when no older packets are queued, so records are not reordered.
+    if (pending_packet_data_ != nullptr && packets_.size() == 0) {
+      *read = std::min(buffer_len, pending_packet_size_);
+      memcpy(buffer, pending_packet_data_, *read);
+      pending_packet_data_ = nullptr;
+      pending_packet_size_ = 0;
+      return rtc::SR_SUCCESS;
+    }
+  }
+
   if (!packets_.ReadFront(buffer, buffer_len, read)) {
     return rtc::SR_BLOCK;
   }
@@ -102,6 +116,30 @@ rtc::StreamResult StreamInterfaceChannel::Write(const void* data,
 }
 
 bool StreamInterfaceChannel::OnPacketReceived(const char* data, size_t size) {
+  // Expose the caller's buffer to Read() for the duration of the event
+  // dispatch. The SSL stream normally reads the record out within the
+  // SignalEvent call below, in which case it is copied once, directly into
+  // the record buffer, instead of in and out of |packets_|.
+  {
+    rtc::CritScope cs(&crit_);
+    pending_packet_data_ = data;
+    pending_packet_size_ = size;
+  }
+  SignalEvent(this, rtc::SE_READ, 0);
+  {
+    rtc::CritScope cs(&crit_);
+    if (pending_packet_data_ == nullptr) {
+      // Consumed during the dispatch; nothing left to do.
+      return true;
+    }
+    pending_packet_data_ = nullptr;
+    pending_packet_size_ = 0;
+  }
+
+  // The read did not happen inside the dispatch (e.g. a handshake step is
+  // running on the offload thread and will pull the packet later); fall back
+  // to queueing a copy and signal again so a consumer that went back to
+  // sleep after finding no data re-attempts the read.
   if (packets_.size() > 0) {
     RTC_LOG(LS_WARNING) << "Packet already in queue.";
   }
@@ -122,6 +160,9 @@ rtc::StreamState StreamInterfaceChannel::GetState() const {
 }
 
 void StreamInterfaceChannel::Close() {
+  rtc::CritScope cs(&crit_);
+  pending_packet_data_ = nullptr;
+  pending_packet_size_ = 0;
   packets_.Clear();
   state_ = rtc::SS_CLOSED;
 }
@@ -204,6 +245,17 @@ bool DtlsTransport::SetSslMaxProtocolVersion(rtc::SSLProtocolVersion version) {
   return true;
 }
 
+bool DtlsTransport::SetHandshakeOffloadThread(rtc::Thread* thread) {
+  if (dtls_active_) {
+    RTC_LOG(LS_ERROR) << "Not changing handshake offload thread "
+                         "while DTLS is negotiating";
+    return false;
+  }
+
+  handshake_offload_thread_ = thread;
+  return true;
+}
+
 bool DtlsTransport::SetDtlsRole(rtc::SSLRole role) {
   if (dtls_) {
     RTC_DCHECK(dtls_role_);
@@ -350,6 +402,11 @@ bool DtlsTransport::SetupDtls() {
   dtls_->SetIdentity(local_certificate_->identity()->Clone());
   dtls_->SetMode(rtc::SSL_MODE_DTLS);
   dtls_->SetMaxProtocolVersion(ssl_max_version_);
+  if (handshake_offload_thread_) {
+    // StreamInterfaceChannel's packet queue is thread safe, so the offload
+    // thread may read from it while the network thread appends packets.
+    dtls_->SetHandshakeOffloadThread(handshake_offload_thread_);
+  }
   dtls_->SetServerRole(*dtls_role_);
   dtls_->SignalEvent.connect(this, &DtlsTransport::OnDtlsEvent);
   dtls_->SignalSSLHandshakeError.connect(this,
@@ -21,6 +21,7 @@
 #include "rtc_base/buffer.h"
 #include "rtc_base/buffer_queue.h"
 #include "rtc_base/constructor_magic.h"
+#include "rtc_base/critical_section.h"
 #include "rtc_base/ssl_stream_adapter.h"
 #include "rtc_base/stream.h"
 #include "rtc_base/strings/string_builder.h"
@@ -38,7 +39,11 @@ class StreamInterfaceChannel : public rtc::StreamInterface {
  public:
   explicit StreamInterfaceChannel(IceTransportInternal* ice_transport);
 
-  // Push in a packet; this gets pulled out from Read().
+  // Push in a packet; this gets pulled out from Read(). In the common case
+  // the SSL stream reads the packet out synchronously inside this call, and
+  // Read() then copies straight from the caller's buffer; the packet is only
+  // copied into the internal queue when the read arrives asynchronously
+  // (e.g. from the handshake offload thread).
   bool OnPacketReceived(const char* data, size_t size);
 
   // Implementations of StreamInterface
@@ -58,6 +63,14 @@ class StreamInterfaceChannel : public rtc::StreamInterface {
   rtc::StreamState state_;
   rtc::BufferQueue packets_;
 
+  // The packet currently being dispatched by OnPacketReceived(), exposed to
+  // Read() for the duration of the synchronous SignalEvent dispatch so the
+  // record does not have to round-trip through |packets_|. Guarded since
+  // Read() may also run on the handshake offload thread.
+  rtc::CriticalSection crit_;
+  const char* pending_packet_data_ RTC_GUARDED_BY(crit_) = nullptr;
+  size_t pending_packet_size_ RTC_GUARDED_BY(crit_) = 0;
+
   RTC_DISALLOW_COPY_AND_ASSIGN(StreamInterfaceChannel);
 };
 
@@ -142,6 +155,13 @@ class DtlsTransport : public DtlsTransportInternal {
 
   bool SetSslMaxProtocolVersion(rtc::SSLProtocolVersion version) override;
 
+  // Offloads the CPU-heavy DTLS handshake steps to |thread|, so that a storm
+  // of simultaneous handshakes does not stall the network thread. Only state
+  // transitions and packet sends stay on the network thread. Must be called
+  // before the handshake starts; null (the default) keeps the handshake
+  // inline.
+  bool SetHandshakeOffloadThread(rtc::Thread* thread);
+
   // Find out which TLS version was negotiated
   bool GetSslVersionBytes(int* version) const override;
   // Find out which DTLS-SRTP cipher was negotiated
@@ -235,6 +255,9 @@ class DtlsTransport : public DtlsTransportInternal {
   rtc::scoped_refptr<rtc::RTCCertificate> local_certificate_;
   absl::optional<rtc::SSLRole> dtls_role_;
   rtc::SSLProtocolVersion ssl_max_version_;
+  // Thread that runs the CPU-heavy handshake steps, or null to run them on
+  // the network thread. Not owned.
+  rtc::Thread* handshake_offload_thread_ = nullptr;
   webrtc::CryptoOptions crypto_options_;
   rtc::Buffer remote_fingerprint_value_;
   std::string remote_fingerprint_algorithm_;
@@ -238,8 +238,14 @@ void P2PTransportChannel::AddConnection(Connection* connection) {
   connection->set_unwritable_timeout(config_.ice_unwritable_timeout);
   connection->set_unwritable_min_checks(config_.ice_unwritable_min_checks);
   connection->set_inactive_timeout(config_.ice_inactive_timeout);
-  connection->SignalReadPacket.connect(this,
-                                       &P2PTransportChannel::OnReadPacket);
+  // The channel is the connection's only read consumer; take the direct
+  // callback instead of SignalReadPacket to skip sigslot dispatch on the
+  // per-packet path.
+  connection->SetReadPacketCallback(
+      [this](Connection* connection, const char* data, size_t size,
+             int64_t packet_time_us) {
+        OnReadPacket(connection, data, size, packet_time_us);
+      });
   connection->SignalReadyToSend.connect(this,
                                         &P2PTransportChannel::OnReadyToSend);
   connection->SignalStateChange.connect(
@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "p2p/base/ping_timing_wheel.h"
+
+#include "rtc_base/checks.h"
+
+namespace cricket {
+
+namespace {
+
+// 128 slots of 32 ms cover ~4 seconds per lap, enough for one full lap to
+// span the stable writable connection ping interval. Deadlines further out
+// simply stay in their slot for another lap.
+constexpr size_t kNumSlots = 128;
+constexpr int64_t kSlotGranularityMs = 32;
+
+}  // namespace
+
+PingTimingWheel::PingTimingWheel() : slots_(kNumSlots) {}
+
+PingTimingWheel::~PingTimingWheel() = default;
+
+size_t PingTimingWheel::SlotIndex(int64_t deadline_ms) const {
+  RTC_DCHECK_GE(deadline_ms, 0);
+  return (deadline_ms / kSlotGranularityMs) % kNumSlots;
+}
+
+void PingTimingWheel::Schedule(const Connection* conn, int64_t deadline_ms) {
+  expired_.erase(conn);
+  deadlines_[conn] = deadline_ms;
+  if (deadline_ms <= cursor_ms_) {
+    // Already past due; don't bother placing it in a slot.
+    expired_.insert(conn);
+    return;
+  }
+  // Stale entries for a previous deadline of |conn| are left in their slots
+  // and discarded when those slots are processed.
+  slots_[SlotIndex(deadline_ms)].emplace_back(conn, deadline_ms);
+}
+
+void PingTimingWheel::Cancel(const Connection* conn) {
+  deadlines_.erase(conn);
+  expired_.erase(conn);
+}
+
+void PingTimingWheel::Advance(int64_t now_ms) {
+  if (now_ms <= cursor_ms_) {
+    return;
+  }
+  // Process every slot from the cursor's own (it may hold deadlines between
+  // |cursor_ms_| and the end of the slot) through the one |now_ms| falls in;
+  // if more than a full lap has elapsed, every slot is due exactly once.
+  size_t num_slots_to_process =
+      static_cast<size_t>(now_ms / kSlotGranularityMs -
+                          cursor_ms_ / kSlotGranularityMs) +
+      1;
+  if (num_slots_to_process > kNumSlots) {
+    num_slots_to_process = kNumSlots;
+  }
+  size_t first_slot = SlotIndex(cursor_ms_);
+  for (size_t i = 0; i < num_slots_to_process; ++i) {
+    ExpireSlot((first_slot + i) % kNumSlots, now_ms);
+  }
+  cursor_ms_ = now_ms;
+}
+
+void PingTimingWheel::ExpireSlot(size_t slot_index, int64_t now_ms) {
+  std::vector<std::pair<const Connection*, int64_t>>& slot =
+      slots_[slot_index];
+  size_t kept = 0;
+  for (size_t j = 0; j < slot.size(); ++j) {
+    auto it = deadlines_.find(slot[j].first);
+    if (it == deadlines_.end() || it->second != slot[j].second) {
+      // Cancelled or rescheduled; drop the stale entry.
+      continue;
+    }
+    if (slot[j].second <= now_ms) {
+      expired_.insert(slot[j].first);
+      continue;
+    }
+    // Scheduled for a later lap; keep it in the slot.
+    slot[kept++] = slot[j];
+  }
+  slot.resize(kept);
+}
+
+bool PingTimingWheel::HasExpiredDeadline(int64_t now_ms) {
+  Advance(now_ms);
+  return !expired_.empty();
+}
+
+}  // namespace cricket
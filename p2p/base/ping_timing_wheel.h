@@ -0,0 +1,76 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef P2P_BASE_PING_TIMING_WHEEL_H_
+#define P2P_BASE_PING_TIMING_WHEEL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace cricket {
+
+class Connection;
+
+// A hashed timing wheel tracking the next ping deadline of each registered
+// connection. It lets the ping loop answer "is any connection due for a
+// ping?" without scanning the full connection list on every tick, which
+// matters when a process hosts many candidate pairs.
+//
+// Deadlines are bucketed into fixed-width slots; advancing the wheel to the
+// current time only touches the slots that have elapsed since the previous
+// call. An expired deadline stays expired until the connection is
+// rescheduled or cancelled. This class is not thread safe; like the rest of
+// the ICE machinery it is meant to be used on the network thread only.
+class PingTimingWheel {
+ public:
+  PingTimingWheel();
+  ~PingTimingWheel();
+
+  PingTimingWheel(const PingTimingWheel&) = delete;
+  PingTimingWheel& operator=(const PingTimingWheel&) = delete;
+
+  // Registers |conn| with the given deadline, replacing any previously
+  // scheduled or expired deadline.
+  void Schedule(const Connection* conn, int64_t deadline_ms);
+  // Removes |conn| from the wheel. No-op if it is not registered.
+  void Cancel(const Connection* conn);
+
+  // Advances the wheel to |now_ms| and returns true if any registered
+  // deadline has expired.
+  bool HasExpiredDeadline(int64_t now_ms);
+
+  size_t size() const { return deadlines_.size(); }
+
+ private:
+  size_t SlotIndex(int64_t deadline_ms) const;
+  void Advance(int64_t now_ms);
+  // Moves entries of |slot_index| whose deadline has passed to |expired_|,
+  // dropping stale entries along the way.
+  void ExpireSlot(size_t slot_index, int64_t now_ms);
+
+  // Authoritative deadline per connection; slot entries that disagree with
+  // this map are stale and dropped when their slot is processed.
+  std::map<const Connection*, int64_t> deadlines_;
+  std::vector<std::vector<std::pair<const Connection*, int64_t>>> slots_;
+  std::set<const Connection*> expired_;
+  // The time the wheel has been advanced to, in ms. Slots between
+  // |cursor_ms_| and now are processed by the next HasExpiredDeadline()
+  // call.
+  int64_t cursor_ms_ = 0;
+};
+
+}  // namespace cricket
+
+#endif  // P2P_BASE_PING_TIMING_WHEEL_H_
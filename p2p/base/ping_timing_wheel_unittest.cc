@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "p2p/base/ping_timing_wheel.h"
+
+#include "test/gtest.h"
+
+namespace cricket {
+
+namespace {
+
+// The wheel only uses registered pointers as keys; it never dereferences
+// them, so opaque non-null pointers are enough for testing.
+const Connection* MakeConnectionKey(uintptr_t id) {
+  return reinterpret_cast<const Connection*>(id);
+}
+
+}  // namespace
+
+TEST(PingTimingWheelTest, EmptyWheelHasNoExpiredDeadline) {
+  PingTimingWheel wheel;
+  EXPECT_FALSE(wheel.HasExpiredDeadline(0));
+  EXPECT_FALSE(wheel.HasExpiredDeadline(1000000));
+}
+
+TEST(PingTimingWheelTest, DeadlineExpiresWhenTimePasses) {
+  PingTimingWheel wheel;
+  const Connection* conn = MakeConnectionKey(1);
+  wheel.Schedule(conn, 100);
+  EXPECT_FALSE(wheel.HasExpiredDeadline(99));
+  EXPECT_TRUE(wheel.HasExpiredDeadline(100));
+  // An expired deadline stays expired until rescheduled or cancelled.
+  EXPECT_TRUE(wheel.HasExpiredDeadline(5000));
+}
+
+TEST(PingTimingWheelTest, PastDeadlineExpiresImmediately) {
+  PingTimingWheel wheel;
+  const Connection* conn = MakeConnectionKey(1);
+  EXPECT_FALSE(wheel.HasExpiredDeadline(1000));
+  wheel.Schedule(conn, 500);
+  EXPECT_TRUE(wheel.HasExpiredDeadline(1000));
+}
+
+TEST(PingTimingWheelTest, DeadlineInPartiallyElapsedSlotExpires) {
+  PingTimingWheel wheel;
+  const Connection* conn = MakeConnectionKey(1);
+  // Advance into the middle of a slot, then schedule a deadline that falls
+  // later in that same slot.
+  EXPECT_FALSE(wheel.HasExpiredDeadline(33));
+  wheel.Schedule(conn, 40);
+  EXPECT_TRUE(wheel.HasExpiredDeadline(70));
+}
+
+TEST(PingTimingWheelTest, RescheduleReplacesDeadline) {
+  PingTimingWheel wheel;
+  const Connection* conn = MakeConnectionKey(1);
+  wheel.Schedule(conn, 100);
+  wheel.Schedule(conn, 10000);
+  EXPECT_EQ(1u, wheel.size());
+  EXPECT_FALSE(wheel.HasExpiredDeadline(100));
+  EXPECT_FALSE(wheel.HasExpiredDeadline(9999));
+  EXPECT_TRUE(wheel.HasExpiredDeadline(10000));
+}
+
+TEST(PingTimingWheelTest, RescheduleClearsExpiry) {
+  PingTimingWheel wheel;
+  const Connection* conn = MakeConnectionKey(1);
+  wheel.Schedule(conn, 100);
+  EXPECT_TRUE(wheel.HasExpiredDeadline(200));
+  wheel.Schedule(conn, 300);
+  EXPECT_FALSE(wheel.HasExpiredDeadline(200));
+  EXPECT_TRUE(wheel.HasExpiredDeadline(300));
+}
+
+TEST(PingTimingWheelTest, CancelRemovesDeadline) {
+  PingTimingWheel wheel;
+  const Connection* conn = MakeConnectionKey(1);
+  wheel.Schedule(conn, 100);
+  wheel.Cancel(conn);
+  EXPECT_EQ(0u, wheel.size());
+  EXPECT_FALSE(wheel.HasExpiredDeadline(200));
+}
+
+TEST(PingTimingWheelTest, DeadlineBeyondOneLapExpiresOnTime) {
+  PingTimingWheel wheel;
+  const Connection* conn = MakeConnectionKey(1);
+  // Far beyond the wheel horizon, so the entry must survive several laps.
+  wheel.Schedule(conn, 60000);
+  for (int64_t now = 0; now < 60000; now += 48) {
+    EXPECT_FALSE(wheel.HasExpiredDeadline(now));
+  }
+  EXPECT_TRUE(wheel.HasExpiredDeadline(60000));
+}
+
+TEST(PingTimingWheelTest, TracksManyConnectionsIndependently) {
+  PingTimingWheel wheel;
+  constexpr int kNumConnections = 500;
+  for (int i = 0; i < kNumConnections; ++i) {
+    wheel.Schedule(MakeConnectionKey(i + 1), 1000 + 13 * i);
+  }
+  EXPECT_EQ(static_cast<size_t>(kNumConnections), wheel.size());
+  EXPECT_FALSE(wheel.HasExpiredDeadline(999));
+  EXPECT_TRUE(wheel.HasExpiredDeadline(1000));
+  // Reschedule all of them into the future again.
+  for (int i = 0; i < kNumConnections; ++i) {
+    wheel.Schedule(MakeConnectionKey(i + 1), 100000 + 13 * i);
+  }
+  EXPECT_FALSE(wheel.HasExpiredDeadline(99999));
+  EXPECT_TRUE(wheel.HasExpiredDeadline(100000));
+}
+
+}  // namespace cricket
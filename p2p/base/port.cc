@@ -19,6 +19,8 @@
 
 #include "absl/algorithm/container.h"
 #include "absl/strings/match.h"
+#include "absl/types/optional.h"
+#include "api/array_view.h"
 #include "p2p/base/connection.h"
 #include "p2p/base/port_allocator.h"
 #include "rtc_base/checks.h"
@@ -430,19 +432,22 @@ bool Port::GetStunMessage(const char* data,
                           const rtc::SocketAddress& addr,
                           std::unique_ptr<IceMessage>* out_msg,
                           std::string* out_username) {
-  // NOTE: This could clearly be optimized to avoid allocating any memory.
-  //       However, at the data rates we'll be looking at on the client side,
-  //       this probably isn't worth worrying about.
   RTC_DCHECK(out_msg != NULL);
   RTC_DCHECK(out_username != NULL);
   out_username->clear();
 
-  // Don't bother parsing the packet if we can tell it's not STUN.
+  // Don't bother parsing the packet if we can tell it's not STUN. The view
+  // validates the header and the attribute framing in place, so junk and
+  // non-STUN packets are rejected here without allocating any memory.
+  absl::optional<StunMessageView> view = StunMessageView::Parse(
+      rtc::MakeArrayView(reinterpret_cast<const uint8_t*>(data), size));
+  if (!view || !view->has_magic_cookie()) {
+    return false;
+  }
   // In ICE mode, all STUN packets will have a valid fingerprint.
   // Except GOOG_PING_REQUEST/RESPONSE that does not send fingerprint.
-  int types[] = {GOOG_PING_REQUEST, GOOG_PING_RESPONSE,
-                 GOOG_PING_ERROR_RESPONSE};
-  if (!StunMessage::IsStunMethod(types, data, size) &&
+  if (view->type() != GOOG_PING_REQUEST && view->type() != GOOG_PING_RESPONSE &&
+      view->type() != GOOG_PING_ERROR_RESPONSE &&
       !StunMessage::ValidateFingerprint(data, size)) {
     return false;
   }
@@ -756,7 +761,7 @@ void Port::SendBindingErrorResponse(StunMessage* request,
   }
 
   // Send the response message.
-  rtc::ByteBufferWriter buf;
+  rtc::ByteBufferWriter buf(kStunHeaderSize + response.length());
   response.Write(&buf);
   rtc::PacketOptions options(StunDscpValue());
   options.info_signaled_after_sent.packet_type =
@@ -795,7 +800,7 @@ void Port::SendUnknownAttributesErrorResponse(
   response.AddFingerprint();
 
   // Send the response message.
-  rtc::ByteBufferWriter buf;
+  rtc::ByteBufferWriter buf(kStunHeaderSize + response.length());
   response.Write(&buf);
   rtc::PacketOptions options(StunDscpValue());
   options.info_signaled_after_sent.packet_type =
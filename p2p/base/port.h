@@ -11,10 +11,10 @@
 #ifndef P2P_BASE_PORT_H_
 #define P2P_BASE_PORT_H_
 
-#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -265,8 +265,17 @@ class Port : public PortInterface,
   sigslot::signal1<Port*> SignalPortError;
 
   // Returns a map containing all of the connections of this port, keyed by the
-  // remote address.
-  typedef std::map<rtc::SocketAddress, Connection*> AddressMap;
+  // remote address. The map is hashed rather than ordered: GetConnection() is
+  // on the receive path of every packet arriving on a shared socket, so
+  // lookups should cost one hash and, in the common case, one address
+  // comparison.
+  struct AddressHash {
+    size_t operator()(const rtc::SocketAddress& addr) const {
+      return addr.Hash();
+    }
+  };
+  typedef std::unordered_map<rtc::SocketAddress, Connection*, AddressHash>
+      AddressMap;
   const AddressMap& connections() { return connections_; }
 
   // Returns the connection to the given address or NULL if none exists.
@@ -23,6 +23,7 @@
 #include "rtc_base/logging.h"
 #include "rtc_base/net_helpers.h"
 #include "rtc_base/strings/string_builder.h"
+#include "rtc_base/time_utils.h"
 
 namespace cricket {
 
@@ -33,6 +34,39 @@ const int RETRY_TIMEOUT = 50 * 1000;  // 50 seconds
 // |kSendErrorLogLimit| messages. Start again after a successful send.
 const int kSendErrorLogLimit = 5;
 
+StunMappingCache::StunMappingCache(int ttl_ms) : ttl_ms_(ttl_ms) {}
+
+StunMappingCache::~StunMappingCache() = default;
+
+std::string StunMappingCache::MakeKey(const std::string& network_name,
+                                      const rtc::IPAddress& local_ip,
+                                      const rtc::SocketAddress& server) {
+  rtc::StringBuilder key;
+  key << network_name << "|" << local_ip.ToString() << "|" << server.ToString();
+  return key.Release();
+}
+
+void StunMappingCache::Put(const std::string& network_name,
+                           const rtc::IPAddress& local_ip,
+                           const rtc::SocketAddress& server,
+                           const rtc::SocketAddress& reflexive) {
+  Entry& entry = entries_[MakeKey(network_name, local_ip, server)];
+  entry.reflexive = reflexive;
+  entry.expires_ms = rtc::TimeMillis() + ttl_ms_;
+}
+
+bool StunMappingCache::Get(const std::string& network_name,
+                           const rtc::IPAddress& local_ip,
+                           const rtc::SocketAddress& server,
+                           rtc::SocketAddress* reflexive) const {
+  auto it = entries_.find(MakeKey(network_name, local_ip, server));
+  if (it == entries_.end() || rtc::TimeMillis() >= it->second.expires_ms) {
+    return false;
+  }
+  *reflexive = it->second.reflexive;
+  return true;
+}
+
 // Handles a binding request sent to the STUN server.
 class StunBindingRequest : public StunRequest {
  public:
@@ -221,7 +255,14 @@ bool UDPPort::Init() {
       RTC_LOG(LS_WARNING) << ToString() << ": UDP socket creation failed";
       return false;
     }
-    socket_->SignalReadPacket.connect(this, &UDPPort::OnReadPacket);
+    // The port is the socket's only read consumer; use the direct callback
+    // instead of SignalReadPacket to skip sigslot dispatch per packet.
+    socket_->SetReadPacketCallback(
+        [this](rtc::AsyncPacketSocket* socket, const char* data, size_t size,
+               const rtc::SocketAddress& remote_addr,
+               const int64_t& packet_time_us) {
+          OnReadPacket(socket, data, size, remote_addr, packet_time_us);
+        });
   }
   socket_->SignalSentPacket.connect(this, &UDPPort::OnSentPacket);
   socket_->SignalReadyToSend.connect(this, &UDPPort::OnReadyToSend);
@@ -472,6 +513,10 @@ void UDPPort::SendStunBindingRequest(const rtc::SocketAddress& stun_addr) {
     if (IsCompatibleAddress(stun_addr)) {
       requests_.Send(
           new StunBindingRequest(this, stun_addr, rtc::TimeMillis()));
+      // While the request is in flight, the mapping a previous session
+      // learned on this network is the best guess at the outcome; surface
+      // it so checks can start without waiting out the round-trip.
+      MaybeAddCachedStunCandidate(stun_addr);
     } else {
       // Since we can't send stun messages to the server, we should mark this
       // port ready.
@@ -483,6 +528,38 @@ void UDPPort::SendStunBindingRequest(const rtc::SocketAddress& stun_addr) {
   }
 }
 
+void UDPPort::MaybeAddCachedStunCandidate(const rtc::SocketAddress& stun_addr) {
+  if (!stun_mapping_cache_) {
+    return;
+  }
+  rtc::SocketAddress cached_addr;
+  if (!stun_mapping_cache_->Get(Network()->name(),
+                                socket_->GetLocalAddress().ipaddr(), stun_addr,
+                                &cached_addr)) {
+    return;
+  }
+  // Mirror the checks in OnStunBindingRequestSucceeded: a mapping identical
+  // to the local address of a shared socket or to an existing candidate adds
+  // nothing.
+  if ((SharedSocket() && cached_addr == socket_->GetLocalAddress()) ||
+      HasCandidateWithAddress(cached_addr)) {
+    return;
+  }
+  rtc::SocketAddress related_address = socket_->GetLocalAddress();
+  if (!MaybeSetDefaultLocalAddress(&related_address)) {
+    related_address =
+        rtc::EmptySocketAddressWithFamily(related_address.family());
+  }
+  RTC_LOG(LS_INFO) << ToString()
+                   << ": Adding cached srflx candidate "
+                   << cached_addr.ToSensitiveString();
+  rtc::StringBuilder url;
+  url << "stun:" << stun_addr.ipaddr().ToString() << ":" << stun_addr.port();
+  AddAddress(cached_addr, socket_->GetLocalAddress(), related_address,
+             UDP_PROTOCOL_NAME, "", "", STUN_PORT_TYPE,
+             ICE_TYPE_PREFERENCE_SRFLX, 0, url.str(), false);
+}
+
 bool UDPPort::MaybeSetDefaultLocalAddress(rtc::SocketAddress* addr) const {
   if (!addr->IsAnyIP() || !emit_local_for_anyaddress_ ||
       !Network()->default_local_address_provider()) {
@@ -514,6 +591,11 @@ void UDPPort::OnStunBindingRequestSucceeded(
     return;
   }
   bind_request_succeeded_servers_.insert(stun_server_addr);
+  if (stun_mapping_cache_) {
+    stun_mapping_cache_->Put(Network()->name(),
+                             socket_->GetLocalAddress().ipaddr(),
+                             stun_server_addr, stun_reflected_addr);
+  }
   // If socket is shared and |stun_reflected_addr| is equal to local socket
   // address, or if the same address has been added by another STUN server,
   // then discarding the stun address.
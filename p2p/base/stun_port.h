@@ -29,6 +29,47 @@ static const int INFINITE_LIFETIME = -1;
 // Lifetime for STUN ports on high-cost networks: 2 minutes
 static const int HIGH_COST_PORT_KEEPALIVE_LIFETIME = 2 * 60 * 1000;
 
+// Remembers the server-reflexive address a STUN binding discovered, keyed by
+// the local network and STUN server, so a later gathering session on the same
+// network can surface its likely srflx candidate without waiting for a new
+// binding round-trip. The cached address is only a hint: connectivity checks
+// validate it, and the port still sends a binding request whose response adds
+// the authoritative candidate if the NAT assigned a different mapping.
+// Owned by the port allocator, which outlives the sessions sharing it; used
+// on the network thread only.
+class StunMappingCache {
+ public:
+  // NAT UDP mappings commonly time out after tens of seconds of silence, so
+  // entries older than this are too likely stale to be worth signaling.
+  static const int kDefaultTtlMs = 60 * 1000;
+
+  explicit StunMappingCache(int ttl_ms = kDefaultTtlMs);
+  ~StunMappingCache();
+
+  void Put(const std::string& network_name,
+           const rtc::IPAddress& local_ip,
+           const rtc::SocketAddress& server,
+           const rtc::SocketAddress& reflexive);
+  // Returns true and fills |reflexive| if a fresh entry exists.
+  bool Get(const std::string& network_name,
+           const rtc::IPAddress& local_ip,
+           const rtc::SocketAddress& server,
+           rtc::SocketAddress* reflexive) const;
+
+ private:
+  struct Entry {
+    rtc::SocketAddress reflexive;
+    int64_t expires_ms;
+  };
+
+  static std::string MakeKey(const std::string& network_name,
+                             const rtc::IPAddress& local_ip,
+                             const rtc::SocketAddress& server);
+
+  const int ttl_ms_;
+  std::map<std::string, Entry> entries_;
+};
+
 // Communicates using the address on the outside of a NAT.
 class UDPPort : public Port {
  public:
@@ -118,6 +159,13 @@ class UDPPort : public Port {
     return requests_.HasRequest(msg_type);
   }
 
+  // Sets the cross-session mapping cache, which must outlive this port. When
+  // set, a binding request for a server with a fresh cached mapping signals
+  // the cached srflx candidate immediately (see StunMappingCache).
+  void set_stun_mapping_cache(StunMappingCache* cache) {
+    stun_mapping_cache_ = cache;
+  }
+
  protected:
   UDPPort(rtc::Thread* thread,
           rtc::PacketSocketFactory* factory,
@@ -212,6 +260,10 @@ class UDPPort : public Port {
 
   void SendStunBindingRequest(const rtc::SocketAddress& stun_addr);
 
+  // Signals the srflx candidate a previous session discovered for
+  // |stun_addr| on this network, if the cache has a fresh one.
+  void MaybeAddCachedStunCandidate(const rtc::SocketAddress& stun_addr);
+
   // Below methods handles binding request responses.
   void OnStunBindingRequestSucceeded(
       int rtt_ms,
@@ -255,6 +307,10 @@ class UDPPort : public Port {
 
   StunStats stats_;
 
+  // Cross-session server-reflexive mapping cache, owned by the port
+  // allocator. Null unless the allocator wires it up.
+  StunMappingCache* stun_mapping_cache_ = nullptr;
+
   // This is true by default and false when
   // PORTALLOCATOR_DISABLE_DEFAULT_LOCAL_CANDIDATE is specified.
   bool emit_local_for_anyaddress_;
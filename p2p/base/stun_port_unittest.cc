@@ -457,3 +457,20 @@ TEST_F(StunPortTest, TestStunPacketsHaveDscpPacketOption) {
       .WillRepeatedly(Return(100));
   EXPECT_TRUE_SIMULATED_WAIT(done(), kTimeoutMs, fake_clock);
 }
+
+// Test that cached mappings are keyed by network and server, and stop being
+// returned once the TTL elapses.
+TEST(StunMappingCacheTest, EntriesAreKeyedAndExpire) {
+  rtc::ScopedFakeClock fake_clock;
+  cricket::StunMappingCache cache(/*ttl_ms=*/1000);
+  const SocketAddress server("99.99.99.1", 3478);
+  const SocketAddress mapping("1.2.3.4", 5678);
+  SocketAddress out;
+  EXPECT_FALSE(cache.Get("eth0", kLocalAddr.ipaddr(), server, &out));
+  cache.Put("eth0", kLocalAddr.ipaddr(), server, mapping);
+  EXPECT_TRUE(cache.Get("eth0", kLocalAddr.ipaddr(), server, &out));
+  EXPECT_EQ(mapping, out);
+  EXPECT_FALSE(cache.Get("wlan0", kLocalAddr.ipaddr(), server, &out));
+  fake_clock.AdvanceTime(webrtc::TimeDelta::Millis(1001));
+  EXPECT_FALSE(cache.Get("eth0", kLocalAddr.ipaddr(), server, &out));
+}
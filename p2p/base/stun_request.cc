@@ -241,7 +241,7 @@ void StunRequest::OnMessage(rtc::Message* pmsg) {
 
   tstamp_ = rtc::TimeMillis();
 
-  rtc::ByteBufferWriter buf;
+  rtc::ByteBufferWriter buf(kStunHeaderSize + msg_->length());
   msg_->Write(&buf);
   manager_->SignalSendPacket(buf.Data(), buf.Length(), this);
 
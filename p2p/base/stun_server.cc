@@ -76,7 +76,7 @@ void StunServer::SendErrorResponse(const StunMessage& msg,
 
 void StunServer::SendResponse(const StunMessage& msg,
                               const rtc::SocketAddress& addr) {
-  rtc::ByteBufferWriter buf;
+  rtc::ByteBufferWriter buf(kStunHeaderSize + msg.length());
   msg.Write(&buf);
   rtc::PacketOptions options;
   if (socket_->SendTo(buf.Data(), buf.Length(), addr, options) < 0)
@@ -149,7 +149,7 @@ Connection* TCPPort::CreateConnection(const Candidate& address,
     // Incoming connection; we already created a socket and connected signals,
     // so we need to hand off the "read packet" responsibility to
     // TCPConnection.
-    socket->SignalReadPacket.disconnect(this);
+    socket->SetReadPacketCallback(nullptr);
     conn = new TCPConnection(this, address, socket);
   } else {
     // Outgoing connection, which will create a new socket for which we still
@@ -280,7 +280,12 @@ void TCPPort::OnNewConnection(rtc::AsyncPacketSocket* socket,
   Incoming incoming;
   incoming.addr = new_socket->GetRemoteAddress();
   incoming.socket = new_socket;
-  incoming.socket->SignalReadPacket.connect(this, &TCPPort::OnReadPacket);
+  incoming.socket->SetReadPacketCallback(
+      [this](rtc::AsyncPacketSocket* socket, const char* data, size_t size,
+             const rtc::SocketAddress& remote_addr,
+             const int64_t& packet_time_us) {
+        OnReadPacket(socket, data, size, remote_addr, packet_time_us);
+      });
   incoming.socket->SignalReadyToSend.connect(this, &TCPPort::OnReadyToSend);
   incoming.socket->SignalSentPacket.connect(this, &TCPPort::OnSentPacket);
 
@@ -594,7 +599,12 @@ void TCPConnection::ConnectSocketSignals(rtc::AsyncPacketSocket* socket) {
   if (outgoing_) {
     socket->SignalConnect.connect(this, &TCPConnection::OnConnect);
   }
-  socket->SignalReadPacket.connect(this, &TCPConnection::OnReadPacket);
+  socket->SetReadPacketCallback(
+      [this](rtc::AsyncPacketSocket* socket, const char* data, size_t size,
+             const rtc::SocketAddress& remote_addr,
+             const int64_t& packet_time_us) {
+        OnReadPacket(socket, data, size, remote_addr, packet_time_us);
+      });
   socket->SignalReadyToSend.connect(this, &TCPConnection::OnReadyToSend);
   socket->SignalClose.connect(this, &TCPConnection::OnClose);
 }
@@ -211,6 +211,10 @@ class TurnEntry : public sigslot::has_slots<> {
   absl::optional<int64_t> destruction_timestamp_;
 
   std::string remote_ufrag_;
+
+  // Scratch buffer reused by Send() for the wrapped (ChannelData or Send
+  // indication) packet, so steady-state sends do not heap allocate.
+  rtc::ByteBufferWriter send_buf_;
 };
 
 TurnPort::TurnPort(rtc::Thread* thread,
@@ -423,7 +427,12 @@ bool TurnPort::CreateTurnClientSocket() {
 
   if (!SharedSocket()) {
     // If socket is shared, AllocationSequence will receive the packet.
-    socket_->SignalReadPacket.connect(this, &TurnPort::OnReadPacket);
+    socket_->SetReadPacketCallback(
+        [this](rtc::AsyncPacketSocket* socket, const char* data, size_t size,
+               const rtc::SocketAddress& remote_addr,
+               const int64_t& packet_time_us) {
+          OnReadPacket(socket, data, size, remote_addr, packet_time_us);
+        });
   }
 
   socket_->SignalReadyToSend.connect(this, &TurnPort::OnReadyToSend);
@@ -1181,16 +1190,13 @@ bool TurnPort::HasPermission(const rtc::IPAddress& ipaddr) const {
 }
 
 TurnEntry* TurnPort::FindEntry(const rtc::SocketAddress& addr) const {
-  auto it = absl::c_find_if(
-      entries_, [&addr](const TurnEntry* e) { return e->address() == addr; });
-  return (it != entries_.end()) ? *it : NULL;
+  auto it = entries_by_address_.find(addr);
+  return (it != entries_by_address_.end()) ? it->second : NULL;
 }
 
 TurnEntry* TurnPort::FindEntry(int channel_id) const {
-  auto it = absl::c_find_if(entries_, [&channel_id](const TurnEntry* e) {
-    return e->channel_id() == channel_id;
-  });
-  return (it != entries_.end()) ? *it : NULL;
+  auto it = entries_by_channel_id_.find(channel_id);
+  return (it != entries_by_channel_id_.end()) ? it->second : NULL;
 }
 
 bool TurnPort::EntryExists(TurnEntry* e) {
@@ -1209,6 +1215,8 @@ bool TurnPort::CreateOrRefreshEntry(const rtc::SocketAddress& addr,
   if (entry == nullptr) {
     entry = new TurnEntry(this, channel_number, addr, remote_ufrag);
     entries_.push_back(entry);
+    entries_by_address_[addr] = entry;
+    entries_by_channel_id_[channel_number] = entry;
     return true;
   } else {
     if (entry->destruction_timestamp()) {
@@ -1244,6 +1252,8 @@ void TurnPort::DestroyEntry(TurnEntry* entry) {
   RTC_DCHECK(entry != NULL);
   entry->SignalDestroyed(entry);
   entries_.remove(entry);
+  entries_by_address_.erase(entry->address());
+  entries_by_channel_id_.erase(entry->channel_id());
   delete entry;
 }
 
@@ -1286,7 +1296,9 @@ bool TurnPort::SetEntryChannelId(const rtc::SocketAddress& address,
   if (!entry) {
     return false;
   }
+  entries_by_channel_id_.erase(entry->channel_id());
   entry->set_channel_id(channel_id);
+  entries_by_channel_id_[channel_id] = entry;
   return true;
 }
 
@@ -1788,7 +1800,8 @@ int TurnEntry::Send(const void* data,
                     size_t size,
                     bool payload,
                     const rtc::PacketOptions& options) {
-  rtc::ByteBufferWriter buf;
+  rtc::ByteBufferWriter& buf = send_buf_;
+  buf.Clear();
   if (state_ != STATE_BOUND ||
       !port_->TurnCustomizerAllowChannelData(data, size, payload)) {
     // If we haven't bound the channel yet, we have to use a Send Indication.
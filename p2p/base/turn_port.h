@@ -378,6 +378,10 @@ class TurnPort : public Port {
 
   int next_channel_number_;
   EntryList entries_;
+  // Indexes over |entries_|, so the per-packet lookups (ChannelData receive
+  // and the send-side wrap in SendTo) don't walk the entry list.
+  std::map<int, TurnEntry*> entries_by_channel_id_;
+  std::map<rtc::SocketAddress, TurnEntry*> entries_by_address_;
 
   PortState state_;
   // By default the value will be set to 0. This value will be used in
@@ -525,12 +525,12 @@ void TurnServer::SendErrorResponseWithAlternateServer(
 
 void TurnServer::SendStun(TurnServerConnection* conn, StunMessage* msg) {
   RTC_DCHECK(thread_checker_.IsCurrent());
-  rtc::ByteBufferWriter buf;
   // Add a SOFTWARE attribute if one is set.
   if (!software_.empty()) {
     msg->AddAttribute(std::make_unique<StunByteStringAttribute>(
         STUN_ATTR_SOFTWARE, software_));
   }
+  rtc::ByteBufferWriter buf(kStunHeaderSize + msg->length());
   msg->Write(&buf);
   Send(conn, buf);
 }
@@ -231,6 +231,14 @@ PortAllocatorSession* BasicPortAllocator::CreateSessionInternal(
   return session;
 }
 
+StunMappingCache* BasicPortAllocator::stun_mapping_cache() {
+  CheckRunOnValidThreadAndInitialized();
+  if (!stun_mapping_cache_) {
+    stun_mapping_cache_.reset(new StunMappingCache());
+  }
+  return stun_mapping_cache_.get();
+}
+
 void BasicPortAllocator::AddTurnServer(const RelayServerConfig& turn_server) {
   CheckRunOnValidThreadAndInitialized();
   std::vector<RelayServerConfig> new_turn_servers = turn_servers();
@@ -1238,8 +1246,12 @@ void AllocationSequence::Init() {
         rtc::SocketAddress(network_->GetBestIP(), 0),
         session_->allocator()->min_port(), session_->allocator()->max_port()));
     if (udp_socket_) {
-      udp_socket_->SignalReadPacket.connect(this,
-                                            &AllocationSequence::OnReadPacket);
+      udp_socket_->SetReadPacketCallback(
+          [this](rtc::AsyncPacketSocket* socket, const char* data, size_t size,
+                 const rtc::SocketAddress& remote_addr,
+                 const int64_t& packet_time_us) {
+            OnReadPacket(socket, data, size, remote_addr, packet_time_us);
+          });
     }
     // Continuing if |udp_socket_| is NULL, as local TCP and RelayPort using TCP
     // are next available options to setup a communication channel.
@@ -1419,6 +1431,7 @@ void AllocationSequence::CreateUDPPorts() {
   }
 
   if (port) {
+    port->set_stun_mapping_cache(session_->allocator()->stun_mapping_cache());
     // If shared socket is enabled, STUN candidate will be allocated by the
     // UDPPort.
     if (IsFlagSet(PORTALLOCATOR_ENABLE_SHARED_SOCKET)) {
@@ -1481,6 +1494,7 @@ void AllocationSequence::CreateStunPorts() {
       session_->allocator()->origin(),
       session_->allocator()->stun_candidate_keepalive_interval());
   if (port) {
+    port->set_stun_mapping_cache(session_->allocator()->stun_mapping_cache());
     session_->AddAllocatedPort(port.release(), this, true);
     // Since StunPort is not created using shared socket, |port| will not be
     // added to the dequeue.
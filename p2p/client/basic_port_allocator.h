@@ -26,6 +26,8 @@
 
 namespace cricket {
 
+class StunMappingCache;
+
 class RTC_EXPORT BasicPortAllocator : public PortAllocator {
  public:
   // note: The (optional) relay_port_factory is owned by caller
@@ -75,6 +77,11 @@ class RTC_EXPORT BasicPortAllocator : public PortAllocator {
     return relay_port_factory_;
   }
 
+  // Cache of server-reflexive mappings shared by this allocator's sessions,
+  // so a reconnect can signal its likely srflx candidates before the new
+  // STUN round-trips complete. Created on first use.
+  StunMappingCache* stun_mapping_cache();
+
  private:
   void OnIceRegathering(PortAllocatorSession* session,
                         IceRegatheringReason reason);
@@ -93,6 +100,9 @@ class RTC_EXPORT BasicPortAllocator : public PortAllocator {
 
   // This instance is created if caller does pass a factory.
   std::unique_ptr<RelayPortFactoryInterface> default_relay_port_factory_;
+
+  // Lazily created by stun_mapping_cache().
+  std::unique_ptr<StunMappingCache> stun_mapping_cache_;
 };
 
 struct PortConfiguration;
@@ -188,6 +188,7 @@ VoiceChannel* ChannelManager::CreateVoiceChannel(
     const cricket::MediaConfig& media_config,
     webrtc::RtpTransportInternal* rtp_transport,
     const webrtc::MediaTransportConfig& media_transport_config,
+    rtc::Thread* network_thread,
     rtc::Thread* signaling_thread,
     const std::string& content_name,
     bool srtp_required,
@@ -197,9 +198,9 @@ VoiceChannel* ChannelManager::CreateVoiceChannel(
   if (!worker_thread_->IsCurrent()) {
     return worker_thread_->Invoke<VoiceChannel*>(RTC_FROM_HERE, [&] {
       return CreateVoiceChannel(call, media_config, rtp_transport,
-                                media_transport_config, signaling_thread,
-                                content_name, srtp_required, crypto_options,
-                                ssrc_generator, options);
+                                media_transport_config, network_thread,
+                                signaling_thread, content_name, srtp_required,
+                                crypto_options, ssrc_generator, options);
     });
   }
 
@@ -217,7 +218,7 @@ VoiceChannel* ChannelManager::CreateVoiceChannel(
   }
 
   auto voice_channel = std::make_unique<VoiceChannel>(
-      worker_thread_, network_thread_, signaling_thread,
+      worker_thread_, network_thread, signaling_thread,
       absl::WrapUnique(media_channel), content_name, srtp_required,
       crypto_options, ssrc_generator);
 
@@ -258,6 +259,7 @@ VideoChannel* ChannelManager::CreateVideoChannel(
     const cricket::MediaConfig& media_config,
     webrtc::RtpTransportInternal* rtp_transport,
     const webrtc::MediaTransportConfig& media_transport_config,
+    rtc::Thread* network_thread,
     rtc::Thread* signaling_thread,
     const std::string& content_name,
     bool srtp_required,
@@ -267,10 +269,11 @@ VideoChannel* ChannelManager::CreateVideoChannel(
     webrtc::VideoBitrateAllocatorFactory* video_bitrate_allocator_factory) {
   if (!worker_thread_->IsCurrent()) {
     return worker_thread_->Invoke<VideoChannel*>(RTC_FROM_HERE, [&] {
-      return CreateVideoChannel(
-          call, media_config, rtp_transport, media_transport_config,
-          signaling_thread, content_name, srtp_required, crypto_options,
-          ssrc_generator, options, video_bitrate_allocator_factory);
+      return CreateVideoChannel(call, media_config, rtp_transport,
+                                media_transport_config, network_thread,
+                                signaling_thread, content_name, srtp_required,
+                                crypto_options, ssrc_generator, options,
+                                video_bitrate_allocator_factory);
     });
   }
 
@@ -289,7 +292,7 @@ VideoChannel* ChannelManager::CreateVideoChannel(
   }
 
   auto video_channel = std::make_unique<VideoChannel>(
-      worker_thread_, network_thread_, signaling_thread,
+      worker_thread_, network_thread, signaling_thread,
       absl::WrapUnique(media_channel), content_name, srtp_required,
       crypto_options, ssrc_generator);
 
@@ -328,6 +331,7 @@ void ChannelManager::DestroyVideoChannel(VideoChannel* video_channel) {
 RtpDataChannel* ChannelManager::CreateRtpDataChannel(
     const cricket::MediaConfig& media_config,
     webrtc::RtpTransportInternal* rtp_transport,
+    rtc::Thread* network_thread,
     rtc::Thread* signaling_thread,
     const std::string& content_name,
     bool srtp_required,
@@ -335,9 +339,9 @@ RtpDataChannel* ChannelManager::CreateRtpDataChannel(
     rtc::UniqueRandomIdGenerator* ssrc_generator) {
   if (!worker_thread_->IsCurrent()) {
     return worker_thread_->Invoke<RtpDataChannel*>(RTC_FROM_HERE, [&] {
-      return CreateRtpDataChannel(media_config, rtp_transport, signaling_thread,
-                                  content_name, srtp_required, crypto_options,
-                                  ssrc_generator);
+      return CreateRtpDataChannel(media_config, rtp_transport, network_thread,
+                                  signaling_thread, content_name, srtp_required,
+                                  crypto_options, ssrc_generator);
     });
   }
 
@@ -350,7 +354,7 @@ RtpDataChannel* ChannelManager::CreateRtpDataChannel(
   }
 
   auto data_channel = std::make_unique<RtpDataChannel>(
-      worker_thread_, network_thread_, signaling_thread,
+      worker_thread_, network_thread, signaling_thread,
       absl::WrapUnique(media_channel), content_name, srtp_required,
       crypto_options, ssrc_generator);
 
@@ -97,11 +97,15 @@ class ChannelManager final {
   // call the appropriate Destroy*Channel method when done.
 
   // Creates a voice channel, to be associated with the specified session.
+  // |network_thread| is the thread |rtp_transport| runs on; it defaults to
+  // network_thread() but differs when the session is pinned to a sharded
+  // network thread.
   VoiceChannel* CreateVoiceChannel(
       webrtc::Call* call,
       const cricket::MediaConfig& media_config,
       webrtc::RtpTransportInternal* rtp_transport,
       const webrtc::MediaTransportConfig& media_transport_config,
+      rtc::Thread* network_thread,
       rtc::Thread* signaling_thread,
       const std::string& content_name,
       bool srtp_required,
@@ -119,6 +123,7 @@ class ChannelManager final {
       const cricket::MediaConfig& media_config,
       webrtc::RtpTransportInternal* rtp_transport,
       const webrtc::MediaTransportConfig& media_transport_config,
+      rtc::Thread* network_thread,
       rtc::Thread* signaling_thread,
       const std::string& content_name,
       bool srtp_required,
@@ -132,6 +137,7 @@ class ChannelManager final {
   RtpDataChannel* CreateRtpDataChannel(
       const cricket::MediaConfig& media_config,
       webrtc::RtpTransportInternal* rtp_transport,
+      rtc::Thread* network_thread,
       rtc::Thread* signaling_thread,
       const std::string& content_name,
       bool srtp_required,
@@ -13,6 +13,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "media/sctp/sctp_transport_internal.h"
 #include "pc/sctp_utils.h"
@@ -610,18 +611,62 @@ void DataChannel::SendQueuedDataMessages() {
 
   RTC_DCHECK(state_ == kOpen || state_ == kClosing);
 
+  if (!IsSctpLike(data_channel_type_)) {
+    while (!queued_send_data_.Empty()) {
+      std::unique_ptr<DataBuffer> buffer = queued_send_data_.PopFront();
+      if (!SendDataMessage(*buffer, false)) {
+        // Return the message to the front of the queue if sending is aborted.
+        queued_send_data_.PushFront(std::move(buffer));
+        break;
+      }
+    }
+    return;
+  }
+
+  // SCTP sends are dispatched to the network thread, so drain the queue as a
+  // single batch to pay the cross-thread hop once per drain instead of once
+  // per message.
+  std::vector<std::unique_ptr<DataBuffer>> buffers;
+  std::vector<std::pair<cricket::SendDataParams, rtc::CopyOnWriteBuffer>>
+      messages;
   while (!queued_send_data_.Empty()) {
     std::unique_ptr<DataBuffer> buffer = queued_send_data_.PopFront();
-    if (!SendDataMessage(*buffer, false)) {
-      // Return the message to the front of the queue if sending is aborted.
-      queued_send_data_.PushFront(std::move(buffer));
-      break;
+    messages.emplace_back(MakeSendDataParams(*buffer), buffer->data);
+    buffers.push_back(std::move(buffer));
+  }
+
+  cricket::SendDataResult send_result = cricket::SDR_SUCCESS;
+  size_t num_sent = provider_->SendDataBatch(messages, &send_result);
+  for (size_t i = 0; i < num_sent; ++i) {
+    const DataBuffer& buffer = *buffers[i];
+    ++messages_sent_;
+    bytes_sent_ += buffer.size();
+    RTC_DCHECK(buffered_amount_ >= buffer.size());
+    buffered_amount_ -= buffer.size();
+    if (observer_ && buffer.size() > 0) {
+      observer_->OnBufferedAmountChange(buffer.size());
     }
   }
+  if (num_sent == buffers.size()) {
+    return;
+  }
+
+  // Return the unsent messages to the front of the queue, preserving order.
+  for (size_t i = buffers.size(); i > num_sent; --i) {
+    queued_send_data_.PushFront(std::move(buffers[i - 1]));
+  }
+  if (send_result != cricket::SDR_BLOCK) {
+    RTC_LOG(LS_ERROR)
+        << "Closing the DataChannel due to a failure to send data, "
+           "send_result = "
+        << send_result;
+    CloseAbruptlyWithError(
+        RTCError(RTCErrorType::NETWORK_ERROR, "Failure to send data"));
+  }
 }
 
-bool DataChannel::SendDataMessage(const DataBuffer& buffer,
-                                  bool queue_if_blocked) {
+cricket::SendDataParams DataChannel::MakeSendDataParams(
+    const DataBuffer& buffer) const {
   cricket::SendDataParams send_params;
 
   if (IsSctpLike(data_channel_type_)) {
@@ -643,6 +688,12 @@ bool DataChannel::SendDataMessage(const DataBuffer& buffer,
     send_params.ssrc = send_ssrc_;
   }
   send_params.type = buffer.binary ? cricket::DMT_BINARY : cricket::DMT_TEXT;
+  return send_params;
+}
+
+bool DataChannel::SendDataMessage(const DataBuffer& buffer,
+                                  bool queue_if_blocked) {
+  cricket::SendDataParams send_params = MakeSendDataParams(buffer);
 
   cricket::SendDataResult send_result = cricket::SDR_SUCCESS;
   bool success = provider_->SendData(send_params, buffer.data, &send_result);
@@ -15,6 +15,8 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "api/data_channel_interface.h"
 #include "api/priority.h"
@@ -38,6 +40,24 @@ class DataChannelProviderInterface {
   virtual bool SendData(const cricket::SendDataParams& params,
                         const rtc::CopyOnWriteBuffer& payload,
                         cricket::SendDataResult* result) = 0;
+  // Sends several messages to the transport as one batch, stopping at the
+  // first failure. Returns the number of messages sent; |result| carries the
+  // result of the first failed send, if any. The default implementation sends
+  // the messages one at a time; implementations that dispatch each send to
+  // another thread should override this to pay that cost once per batch.
+  virtual size_t SendDataBatch(
+      const std::vector<std::pair<cricket::SendDataParams,
+                                  rtc::CopyOnWriteBuffer>>& messages,
+      cricket::SendDataResult* result) {
+    size_t num_sent = 0;
+    for (const auto& message : messages) {
+      if (!SendData(message.first, message.second, result)) {
+        break;
+      }
+      ++num_sent;
+    }
+    return num_sent;
+  }
   // Connects to the transport signals.
   virtual bool ConnectDataChannel(DataChannel* data_channel) = 0;
   // Disconnects from the transport signals.
@@ -274,6 +294,7 @@ class DataChannel : public DataChannelInterface, public sigslot::has_slots<> {
   void DeliverQueuedReceivedData();
 
   void SendQueuedDataMessages();
+  cricket::SendDataParams MakeSendDataParams(const DataBuffer& buffer) const;
   bool SendDataMessage(const DataBuffer& buffer, bool queue_if_blocked);
   bool QueueSendDataMessage(const DataBuffer& buffer);
 
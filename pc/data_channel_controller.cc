@@ -27,32 +27,9 @@ bool DataChannelController::SendData(const cricket::SendDataParams& params,
                                      cricket::SendDataResult* result) {
   // RTC_DCHECK_RUN_ON(signaling_thread());
   if (data_channel_transport()) {
-    SendDataParams send_params;
-    send_params.type = ToWebrtcDataMessageType(params.type);
-    send_params.ordered = params.ordered;
-    if (params.max_rtx_count >= 0) {
-      send_params.max_rtx_count = params.max_rtx_count;
-    } else if (params.max_rtx_ms >= 0) {
-      send_params.max_rtx_ms = params.max_rtx_ms;
-    }
-
-    RTCError error = network_thread()->Invoke<RTCError>(
-        RTC_FROM_HERE, [this, params, send_params, payload] {
-          return data_channel_transport()->SendData(params.sid, send_params,
-                                                    payload);
-        });
-
-    if (error.ok()) {
-      *result = cricket::SendDataResult::SDR_SUCCESS;
-      return true;
-    } else if (error.type() == RTCErrorType::RESOURCE_EXHAUSTED) {
-      // SCTP transport uses RESOURCE_EXHAUSTED when it's blocked.
-      // TODO(mellem):  Stop using RTCError here and get rid of the mapping.
-      *result = cricket::SendDataResult::SDR_BLOCK;
-      return false;
-    }
-    *result = cricket::SendDataResult::SDR_ERROR;
-    return false;
+    return network_thread()->Invoke<bool>(RTC_FROM_HERE, [&] {
+      return SendDataOnTransport(params, payload, result);
+    });
   } else if (rtp_data_channel()) {
     return rtp_data_channel()->SendData(params, payload, result);
   }
@@ -60,6 +37,57 @@ bool DataChannelController::SendData(const cricket::SendDataParams& params,
   return false;
 }
 
+size_t DataChannelController::SendDataBatch(
+    const std::vector<
+        std::pair<cricket::SendDataParams, rtc::CopyOnWriteBuffer>>& messages,
+    cricket::SendDataResult* result) {
+  // RTC_DCHECK_RUN_ON(signaling_thread());
+  if (data_channel_transport()) {
+    // Dispatch the whole batch to the network thread in one hop instead of
+    // paying a blocking Invoke per message.
+    return network_thread()->Invoke<size_t>(RTC_FROM_HERE, [&] {
+      size_t num_sent = 0;
+      for (const auto& message : messages) {
+        if (!SendDataOnTransport(message.first, message.second, result)) {
+          break;
+        }
+        ++num_sent;
+      }
+      return num_sent;
+    });
+  }
+  return DataChannelProviderInterface::SendDataBatch(messages, result);
+}
+
+bool DataChannelController::SendDataOnTransport(
+    const cricket::SendDataParams& params,
+    const rtc::CopyOnWriteBuffer& payload,
+    cricket::SendDataResult* result) {
+  SendDataParams send_params;
+  send_params.type = ToWebrtcDataMessageType(params.type);
+  send_params.ordered = params.ordered;
+  if (params.max_rtx_count >= 0) {
+    send_params.max_rtx_count = params.max_rtx_count;
+  } else if (params.max_rtx_ms >= 0) {
+    send_params.max_rtx_ms = params.max_rtx_ms;
+  }
+
+  RTCError error =
+      data_channel_transport()->SendData(params.sid, send_params, payload);
+
+  if (error.ok()) {
+    *result = cricket::SendDataResult::SDR_SUCCESS;
+    return true;
+  } else if (error.type() == RTCErrorType::RESOURCE_EXHAUSTED) {
+    // SCTP transport uses RESOURCE_EXHAUSTED when it's blocked.
+    // TODO(mellem):  Stop using RTCError here and get rid of the mapping.
+    *result = cricket::SendDataResult::SDR_BLOCK;
+    return false;
+  }
+  *result = cricket::SendDataResult::SDR_ERROR;
+  return false;
+}
+
 bool DataChannelController::ConnectDataChannel(
     DataChannel* webrtc_data_channel) {
   RTC_DCHECK_RUN_ON(signaling_thread());
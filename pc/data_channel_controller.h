@@ -14,6 +14,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "pc/channel.h"
@@ -39,6 +40,10 @@ class DataChannelController : public DataChannelProviderInterface,
   bool SendData(const cricket::SendDataParams& params,
                 const rtc::CopyOnWriteBuffer& payload,
                 cricket::SendDataResult* result) override;
+  size_t SendDataBatch(
+      const std::vector<std::pair<cricket::SendDataParams,
+                                  rtc::CopyOnWriteBuffer>>& messages,
+      cricket::SendDataResult* result) override;
   bool ConnectDataChannel(DataChannel* webrtc_data_channel) override;
   void DisconnectDataChannel(DataChannel* webrtc_data_channel) override;
   void AddSctpDataStream(int sid) override;
@@ -146,6 +151,13 @@ class DataChannelController : public DataChannelProviderInterface,
       const std::vector<std::string>& active_channels,
       bool is_local_update) RTC_RUN_ON(signaling_thread());
 
+  // Sends |payload| over |data_channel_transport()|. Called on the network
+  // thread, where SendData and SendDataBatch dispatch their sends to.
+  bool SendDataOnTransport(const cricket::SendDataParams& params,
+                           const rtc::CopyOnWriteBuffer& payload,
+                           cricket::SendDataResult* result)
+      RTC_RUN_ON(network_thread());
+
   rtc::Thread* network_thread() const;
   rtc::Thread* signaling_thread() const;
 
@@ -207,6 +207,34 @@ TEST_F(SctpDataChannelTest, QueuedDataSentWhenUnblocked) {
   EXPECT_EQ(1U, observer_->on_buffered_amount_change_count());
 }
 
+// Tests that a backlog of queued messages is drained as one batch when the
+// channel becomes unblocked, with stats and bufferedAmount updated for every
+// message.
+TEST_F(SctpDataChannelTest, QueuedDataBatchSentWhenUnblocked) {
+  AddObserver();
+  SetChannelReady();
+  provider_->set_send_blocked(true);
+  std::vector<webrtc::DataBuffer> buffers({
+      webrtc::DataBuffer("message 1"),
+      webrtc::DataBuffer("msg 2"),
+      webrtc::DataBuffer("message three"),
+  });
+  size_t queued_bytes = 0;
+  for (const auto& buffer : buffers) {
+    EXPECT_TRUE(webrtc_data_channel_->Send(buffer));
+    queued_bytes += buffer.size();
+  }
+  EXPECT_EQ(0U, webrtc_data_channel_->messages_sent());
+  EXPECT_EQ(queued_bytes, webrtc_data_channel_->buffered_amount());
+
+  provider_->set_send_blocked(false);
+  SetChannelReady();
+  EXPECT_EQ(buffers.size(), webrtc_data_channel_->messages_sent());
+  EXPECT_EQ(queued_bytes, webrtc_data_channel_->bytes_sent());
+  EXPECT_EQ(0U, webrtc_data_channel_->buffered_amount());
+  EXPECT_EQ(buffers.size(), observer_->on_buffered_amount_change_count());
+}
+
 // Tests that no crash when the channel is blocked right away while trying to
 // send queued data.
 TEST_F(SctpDataChannelTest, BlockedWhenSendQueuedDataNoCrash) {
@@ -31,6 +31,48 @@ using webrtc::SdpType;
 
 namespace cricket {
 
+namespace {
+
+bool TransportDescriptionsMatch(const TransportDescription& a,
+                                const TransportDescription& b) {
+  bool fingerprints_match =
+      (!a.identity_fingerprint && !b.identity_fingerprint) ||
+      (a.identity_fingerprint && b.identity_fingerprint &&
+       *a.identity_fingerprint == *b.identity_fingerprint);
+  return fingerprints_match && a.transport_options == b.transport_options &&
+         a.ice_ufrag == b.ice_ufrag && a.ice_pwd == b.ice_pwd &&
+         a.ice_mode == b.ice_mode && a.connection_role == b.connection_role &&
+         a.opaque_parameters == b.opaque_parameters;
+}
+
+bool CryptosMatch(const std::vector<CryptoParams>& a,
+                  const std::vector<CryptoParams>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].tag != b[i].tag || a[i].cipher_suite != b[i].cipher_suite ||
+        a[i].key_params != b[i].key_params ||
+        a[i].session_params != b[i].session_params) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool JsepTransportDescriptionsMatch(const JsepTransportDescription& a,
+                                    const JsepTransportDescription& b) {
+  return a.rtcp_mux_enabled == b.rtcp_mux_enabled &&
+         CryptosMatch(a.cryptos, b.cryptos) &&
+         a.encrypted_header_extension_ids == b.encrypted_header_extension_ids &&
+         a.rtp_abs_sendtime_extn_id == b.rtp_abs_sendtime_extn_id &&
+         a.media_alt_protocol == b.media_alt_protocol &&
+         a.data_alt_protocol == b.data_alt_protocol &&
+         TransportDescriptionsMatch(a.transport_desc, b.transport_desc);
+}
+
+}  // namespace
+
 JsepTransportDescription::JsepTransportDescription() {}
 
 JsepTransportDescription::JsepTransportDescription(
@@ -171,6 +213,33 @@ JsepTransport::~JsepTransport() {
   // ICE will be the last transport to be deleted.
 }
 
+bool JsepTransport::CanSkipIdenticalDescription(
+    const JsepTransportDescription& jsep_description,
+    SdpType type,
+    const JsepTransportDescription* applied_description,
+    absl::optional<SdpType> applied_type) const {
+  // Provisional answers keep the offer/answer state machines in flight, so
+  // they are always applied. An identical description of a different type
+  // (e.g. an offer matching the last answer) may still complete pending
+  // negotiation and cannot be skipped either.
+  if (!applied_description || applied_type != absl::optional<SdpType>(type) ||
+      type == SdpType::kPrAnswer) {
+    return false;
+  }
+  // Only skip once the RTCP mux and SDES negotiations have settled;
+  // re-applying an identical description in those states is a no-op. If
+  // either negotiation is still pending, the description must go through the
+  // state machines.
+  if (!rtcp_mux_negotiator_.IsFullyActive()) {
+    return false;
+  }
+  if (!jsep_description.cryptos.empty() && !sdes_negotiator_.IsActive()) {
+    return false;
+  }
+  return JsepTransportDescriptionsMatch(*applied_description,
+                                        jsep_description);
+}
+
 webrtc::RTCError JsepTransport::SetLocalJsepTransportDescription(
     const JsepTransportDescription& jsep_description,
     SdpType type) {
@@ -178,6 +247,12 @@ webrtc::RTCError JsepTransport::SetLocalJsepTransportDescription(
 
   RTC_DCHECK_RUN_ON(network_thread_);
 
+  if (CanSkipIdenticalDescription(jsep_description, type,
+                                  local_description_.get(),
+                                  local_description_type_)) {
+    return webrtc::RTCError::OK();
+  }
+
   IceParameters ice_parameters =
       jsep_description.transport_desc.GetIceParameters();
   webrtc::RTCError ice_parameters_result = ice_parameters.Validate();
@@ -219,6 +294,7 @@ webrtc::RTCError JsepTransport::SetLocalJsepTransportDescription(
                             local_description_->transport_desc.ice_pwd,
                             ice_parameters.ufrag, ice_parameters.pwd);
   local_description_.reset(new JsepTransportDescription(jsep_description));
+  local_description_type_ = type;
 
   rtc::SSLFingerprint* local_fp =
       local_description_->transport_desc.identity_fingerprint.get();
@@ -229,6 +305,7 @@ webrtc::RTCError JsepTransport::SetLocalJsepTransportDescription(
     error = VerifyCertificateFingerprint(local_certificate_, local_fp);
     if (!error.ok()) {
       local_description_.reset();
+      local_description_type_.reset();
       return error;
     }
   }
@@ -251,6 +328,7 @@ webrtc::RTCError JsepTransport::SetLocalJsepTransportDescription(
   }
   if (!error.ok()) {
     local_description_.reset();
+    local_description_type_.reset();
     return error;
   }
   {
@@ -272,11 +350,18 @@ webrtc::RTCError JsepTransport::SetRemoteJsepTransportDescription(
 
   RTC_DCHECK_RUN_ON(network_thread_);
 
+  if (CanSkipIdenticalDescription(jsep_description, type,
+                                  remote_description_.get(),
+                                  remote_description_type_)) {
+    return webrtc::RTCError::OK();
+  }
+
   IceParameters ice_parameters =
       jsep_description.transport_desc.GetIceParameters();
   webrtc::RTCError ice_parameters_result = ice_parameters.Validate();
   if (!ice_parameters_result.ok()) {
     remote_description_.reset();
+    remote_description_type_.reset();
     rtc::StringBuilder sb;
     sb << "Invalid ICE parameters: " << ice_parameters_result.message();
     return webrtc::RTCError(webrtc::RTCErrorType::INVALID_PARAMETER,
@@ -314,6 +399,7 @@ webrtc::RTCError JsepTransport::SetRemoteJsepTransportDescription(
   }
 
   remote_description_.reset(new JsepTransportDescription(jsep_description));
+  remote_description_type_ = type;
   RTC_DCHECK(rtp_dtls_transport());
   SetRemoteIceParameters(ice_parameters, rtp_dtls_transport()->ice_transport());
 
@@ -329,6 +415,7 @@ webrtc::RTCError JsepTransport::SetRemoteJsepTransportDescription(
   }
   if (!error.ok()) {
     remote_description_.reset();
+    remote_description_type_.reset();
     return error;
   }
   return webrtc::RTCError::OK();
@@ -288,6 +288,19 @@ class JsepTransport : public sigslot::has_slots<> {
     }
   }
 
+  // Returns true if applying |jsep_description| with |type| would be a no-op:
+  // an identical description of the same type has already been applied for
+  // this side and the offer/answer state machines have fully settled, so none
+  // of the per-transport work below would change any state. Renegotiations in
+  // large sessions leave most transports untouched, and this lets them be
+  // skipped entirely.
+  bool CanSkipIdenticalDescription(
+      const JsepTransportDescription& jsep_description,
+      webrtc::SdpType type,
+      const JsepTransportDescription* applied_description,
+      absl::optional<webrtc::SdpType> applied_type) const
+      RTC_RUN_ON(network_thread_);
+
   bool SetRtcpMux(bool enable, webrtc::SdpType type, ContentSource source);
 
   void ActivateRtcpMux();
@@ -364,6 +377,12 @@ class JsepTransport : public sigslot::has_slots<> {
       RTC_GUARDED_BY(network_thread_);
   std::unique_ptr<JsepTransportDescription> remote_description_
       RTC_GUARDED_BY(network_thread_);
+  // The SdpType each of the descriptions above was applied with, used to
+  // detect when re-applying a description would be a no-op.
+  absl::optional<webrtc::SdpType> local_description_type_
+      RTC_GUARDED_BY(network_thread_);
+  absl::optional<webrtc::SdpType> remote_description_type_
+      RTC_GUARDED_BY(network_thread_);
 
   // Ice transport which may be used by any of upper-layer transports (below).
   // Owned by JsepTransport and guaranteed to outlive the transports below.
@@ -704,6 +704,64 @@ TEST_F(JsepTransport2Test, ValidDtlsReofferFromAnswerer) {
           .ok());
 }
 
+// Test that re-applying identical descriptions of the same type in the same
+// direction is a no-op once negotiation has completed, and that a
+// renegotiation with changed ICE credentials is still applied.
+TEST_F(JsepTransport2Test, IdenticalRenegotiationIsSkipped) {
+  rtc::scoped_refptr<rtc::RTCCertificate> certificate =
+      rtc::RTCCertificate::Create(
+          rtc::SSLIdentity::Create("testing", rtc::KT_ECDSA));
+  bool rtcp_mux_enabled = true;
+  jsep_transport_ = CreateJsepTransport2(rtcp_mux_enabled, SrtpMode::kDtlsSrtp);
+  jsep_transport_->SetLocalCertificate(certificate);
+
+  JsepTransportDescription local_offer =
+      MakeJsepTransportDescription(rtcp_mux_enabled, kIceUfrag1, kIcePwd1,
+                                   certificate, CONNECTIONROLE_ACTPASS);
+  JsepTransportDescription remote_answer =
+      MakeJsepTransportDescription(rtcp_mux_enabled, kIceUfrag2, kIcePwd2,
+                                   certificate, CONNECTIONROLE_ACTIVE);
+
+  EXPECT_TRUE(
+      jsep_transport_
+          ->SetLocalJsepTransportDescription(local_offer, SdpType::kOffer)
+          .ok());
+  EXPECT_TRUE(
+      jsep_transport_
+          ->SetRemoteJsepTransportDescription(remote_answer, SdpType::kAnswer)
+          .ok());
+
+  // Re-applying the identical round is skipped; the previously applied
+  // descriptions are left in place rather than rebuilt.
+  const JsepTransportDescription* applied_local =
+      jsep_transport_->local_description();
+  const JsepTransportDescription* applied_remote =
+      jsep_transport_->remote_description();
+  EXPECT_TRUE(
+      jsep_transport_
+          ->SetLocalJsepTransportDescription(local_offer, SdpType::kOffer)
+          .ok());
+  EXPECT_TRUE(
+      jsep_transport_
+          ->SetRemoteJsepTransportDescription(remote_answer, SdpType::kAnswer)
+          .ok());
+  EXPECT_EQ(applied_local, jsep_transport_->local_description());
+  EXPECT_EQ(applied_remote, jsep_transport_->remote_description());
+
+  // An ICE restart changes the credentials and must go through the full
+  // application path.
+  JsepTransportDescription restart_offer =
+      MakeJsepTransportDescription(rtcp_mux_enabled, "U003", kIcePwd1,
+                                   certificate, CONNECTIONROLE_ACTPASS);
+  EXPECT_TRUE(
+      jsep_transport_
+          ->SetLocalJsepTransportDescription(restart_offer, SdpType::kOffer)
+          .ok());
+  EXPECT_NE(applied_local, jsep_transport_->local_description());
+  EXPECT_EQ("U003",
+            jsep_transport_->local_description()->transport_desc.ice_ufrag);
+}
+
 // Test that a reoffer in the opposite direction fails if the role changes.
 // Inverse of test above.
 TEST_F(JsepTransport2Test, InvalidDtlsReofferFromAnswerer) {
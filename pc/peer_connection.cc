@@ -1032,9 +1032,11 @@ void ExtractSharedMediaSessionOptions(
 }
 
 PeerConnection::PeerConnection(PeerConnectionFactory* factory,
+                               rtc::Thread* network_thread,
                                std::unique_ptr<RtcEventLog> event_log,
                                std::unique_ptr<Call> call)
     : factory_(factory),
+      network_thread_(network_thread),
       event_log_(std::move(event_log)),
       event_log_ptr_(event_log_.get()),
       operations_chain_(rtc::OperationsChain::Create()),
@@ -1293,7 +1295,8 @@ bool PeerConnection::Initialize(
     }
   }
 
-  sctp_factory_ = factory_->CreateSctpTransportInternalFactory();
+  sctp_factory_ =
+      factory_->CreateSctpTransportInternalFactory(network_thread());
 
   if (use_datagram_transport_for_data_channels_) {
     if (configuration.enable_rtp_data_channel) {
@@ -6617,8 +6620,8 @@ cricket::VoiceChannel* PeerConnection::CreateVoiceChannel(
 
   cricket::VoiceChannel* voice_channel = channel_manager()->CreateVoiceChannel(
       call_ptr_, configuration_.media_config, rtp_transport,
-      media_transport_config, signaling_thread(), mid, SrtpRequired(),
-      GetCryptoOptions(), &ssrc_generator_, audio_options_);
+      media_transport_config, network_thread(), signaling_thread(), mid,
+      SrtpRequired(), GetCryptoOptions(), &ssrc_generator_, audio_options_);
   if (!voice_channel) {
     return nullptr;
   }
@@ -6640,8 +6643,8 @@ cricket::VideoChannel* PeerConnection::CreateVideoChannel(
 
   cricket::VideoChannel* video_channel = channel_manager()->CreateVideoChannel(
       call_ptr_, configuration_.media_config, rtp_transport,
-      media_transport_config, signaling_thread(), mid, SrtpRequired(),
-      GetCryptoOptions(), &ssrc_generator_, video_options_,
+      media_transport_config, network_thread(), signaling_thread(), mid,
+      SrtpRequired(), GetCryptoOptions(), &ssrc_generator_, video_options_,
       video_bitrate_allocator_factory_.get());
   if (!video_channel) {
     return nullptr;
@@ -6680,8 +6683,9 @@ bool PeerConnection::CreateDataChannel(const std::string& mid) {
       RtpTransportInternal* rtp_transport = GetRtpTransport(mid);
       data_channel_controller_.set_rtp_data_channel(
           channel_manager()->CreateRtpDataChannel(
-              configuration_.media_config, rtp_transport, signaling_thread(),
-              mid, SrtpRequired(), GetCryptoOptions(), &ssrc_generator_));
+              configuration_.media_config, rtp_transport, network_thread(),
+              signaling_thread(), mid, SrtpRequired(), GetCryptoOptions(),
+              &ssrc_generator_));
       if (!data_channel_controller_.rtp_data_channel()) {
         return false;
       }
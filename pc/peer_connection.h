@@ -112,9 +112,13 @@ class PeerConnection : public PeerConnectionInternal,
     MAX_VALUE = 0x80000,
   };
 
-  explicit PeerConnection(PeerConnectionFactory* factory,
-                          std::unique_ptr<RtcEventLog> event_log,
-                          std::unique_ptr<Call> call);
+  // |network_thread| is the thread this connection is pinned to; it is the
+  // factory's shared network thread unless network thread sharding is enabled
+  // (see PeerConnectionFactoryInterface::Options::network_thread_pool_size).
+  PeerConnection(PeerConnectionFactory* factory,
+                 rtc::Thread* network_thread,
+                 std::unique_ptr<RtcEventLog> event_log,
+                 std::unique_ptr<Call> call);
 
   bool Initialize(
       const PeerConnectionInterface::RTCConfiguration& configuration,
@@ -245,9 +249,7 @@ class PeerConnection : public PeerConnectionInternal,
   void Close() override;
 
   // PeerConnectionInternal implementation.
-  rtc::Thread* network_thread() const final {
-    return factory_->network_thread();
-  }
+  rtc::Thread* network_thread() const final { return network_thread_; }
   rtc::Thread* worker_thread() const final { return factory_->worker_thread(); }
   rtc::Thread* signaling_thread() const final {
     return factory_->signaling_thread();
@@ -1183,6 +1185,8 @@ class PeerConnection : public PeerConnectionInternal,
   // PeerConnectionFactoryInterface all instances created using the raw pointer
   // will refer to the same reference count.
   const rtc::scoped_refptr<PeerConnectionFactory> factory_;
+  // The network thread this connection is pinned to; see the constructor.
+  rtc::Thread* const network_thread_;
   PeerConnectionObserver* observer_ RTC_GUARDED_BY(signaling_thread()) =
       nullptr;
 
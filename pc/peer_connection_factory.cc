@@ -38,12 +38,14 @@
 #include "pc/media_stream.h"
 #include "pc/peer_connection.h"
 #include "pc/rtp_parameters_conversion.h"
+#include "pc/srtp_session.h"
 #include "pc/video_track.h"
 #include "rtc_base/bind.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/experiments/field_trial_parser.h"
 #include "rtc_base/experiments/field_trial_units.h"
 #include "rtc_base/numerics/safe_conversions.h"
+#include "rtc_base/string_encode.h"
 #include "rtc_base/system/file_wrapper.h"
 
 namespace webrtc {
@@ -119,6 +121,13 @@ PeerConnectionFactory::~PeerConnectionFactory() {
   // |default_socket_factory_| and |default_network_manager_|.
   default_socket_factory_ = nullptr;
   default_network_manager_ = nullptr;
+  // Destroy the shard-bound networking objects before stopping the shard
+  // threads, mirroring the teardown order of the defaults above.
+  for (NetworkThreadShard& shard : network_thread_pool_) {
+    shard.socket_factory = nullptr;
+    shard.network_manager = nullptr;
+  }
+  network_thread_pool_.clear();
 
   if (wraps_current_thread_)
     rtc::ThreadManager::Instance()->UnwrapCurrentThread();
@@ -155,6 +164,24 @@ void PeerConnectionFactory::SetOptions(const Options& options) {
   options_ = options;
 }
 
+void PeerConnectionFactory::PrewarmStartup() {
+  RTC_DCHECK(signaling_thread_->IsCurrent());
+  // libsrtp initialization takes a global lock and, depending on the build
+  // configuration, runs cipher self-tests; doing it now keeps that cost off
+  // the first call's SRTP key installation.
+  cricket::SrtpSession::EnsureLibsrtpInitialized();
+  // Enumerating the codecs forces any lazy initialization in the media engine
+  // and its codec factories (hardware codec queries in particular) to happen
+  // ahead of the first offer. The results are discarded; only the side effect
+  // matters.
+  cricket::AudioCodecs audio_codecs;
+  channel_manager_->GetSupportedAudioSendCodecs(&audio_codecs);
+  channel_manager_->GetSupportedAudioReceiveCodecs(&audio_codecs);
+  cricket::VideoCodecs video_codecs;
+  channel_manager_->GetSupportedVideoSendCodecs(&video_codecs);
+  channel_manager_->GetSupportedVideoReceiveCodecs(&video_codecs);
+}
+
 RtpCapabilities PeerConnectionFactory::GetRtpSenderCapabilities(
     cricket::MediaType kind) const {
   RTC_DCHECK_RUN_ON(signaling_thread_);
@@ -246,24 +273,35 @@ PeerConnectionFactory::CreatePeerConnection(
       << "You can't set both allocator and packet_socket_factory; "
          "the former is going away (see bugs.webrtc.org/7447";
 
+  // An injected allocator is bound to the caller's chosen network thread, so
+  // only connections using the default allocator can be pinned to a shard.
+  const NetworkThreadShard* shard =
+      dependencies.allocator ? nullptr : AssignNetworkShard();
+  rtc::Thread* const network_thread =
+      shard ? shard->thread.get() : network_thread_;
+
   // Set internal defaults if optional dependencies are not set.
   if (!dependencies.cert_generator) {
     dependencies.cert_generator =
         std::make_unique<rtc::RTCCertificateGenerator>(signaling_thread_,
-                                                       network_thread_);
+                                                       network_thread);
   }
   if (!dependencies.allocator) {
     rtc::PacketSocketFactory* packet_socket_factory;
     if (dependencies.packet_socket_factory)
       packet_socket_factory = dependencies.packet_socket_factory.get();
+    else if (shard)
+      packet_socket_factory = shard->socket_factory.get();
     else
       packet_socket_factory = default_socket_factory_.get();
 
-    network_thread_->Invoke<void>(RTC_FROM_HERE, [this, &configuration,
-                                                  &dependencies,
-                                                  &packet_socket_factory]() {
+    rtc::NetworkManager* network_manager =
+        shard ? shard->network_manager.get() : default_network_manager_.get();
+    network_thread->Invoke<void>(RTC_FROM_HERE, [&configuration, &dependencies,
+                                                 &packet_socket_factory,
+                                                 &network_manager]() {
       dependencies.allocator = std::make_unique<cricket::BasicPortAllocator>(
-          default_network_manager_.get(), packet_socket_factory,
+          network_manager, packet_socket_factory,
           configuration.turn_customizer);
     });
   }
@@ -278,7 +316,7 @@ PeerConnectionFactory::CreatePeerConnection(
         std::make_unique<DefaultIceTransportFactory>();
   }
 
-  network_thread_->Invoke<void>(
+  network_thread->Invoke<void>(
       RTC_FROM_HERE,
       rtc::Bind(&cricket::PortAllocator::SetNetworkIgnoreMask,
                 dependencies.allocator.get(), options_.network_ignore_mask));
@@ -293,8 +331,8 @@ PeerConnectionFactory::CreatePeerConnection(
       rtc::Bind(&PeerConnectionFactory::CreateCall_w, this, event_log.get()));
 
   rtc::scoped_refptr<PeerConnection> pc(
-      new rtc::RefCountedObject<PeerConnection>(this, std::move(event_log),
-                                                std::move(call)));
+      new rtc::RefCountedObject<PeerConnection>(
+          this, network_thread, std::move(event_log), std::move(call)));
   ActionsBeforeInitializeForTesting(pc);
   if (!pc->Initialize(configuration, std::move(dependencies))) {
     return nullptr;
@@ -327,14 +365,40 @@ rtc::scoped_refptr<AudioTrackInterface> PeerConnectionFactory::CreateAudioTrack(
 }
 
 std::unique_ptr<cricket::SctpTransportInternalFactory>
-PeerConnectionFactory::CreateSctpTransportInternalFactory() {
+PeerConnectionFactory::CreateSctpTransportInternalFactory(
+    rtc::Thread* network_thread) {
 #ifdef HAVE_SCTP
-  return std::make_unique<cricket::SctpTransportFactory>(network_thread());
+  return std::make_unique<cricket::SctpTransportFactory>(network_thread);
 #else
   return nullptr;
 #endif
 }
 
+const PeerConnectionFactory::NetworkThreadShard*
+PeerConnectionFactory::AssignNetworkShard() {
+  RTC_DCHECK(signaling_thread_->IsCurrent());
+  if (options_.network_thread_pool_size <= 1) {
+    return nullptr;
+  }
+  if (network_thread_pool_.empty()) {
+    // The pool size is fixed at the first sharded connection; later changes
+    // to the option are ignored rather than rebalancing live connections.
+    for (int i = 0; i < options_.network_thread_pool_size; ++i) {
+      NetworkThreadShard shard;
+      shard.thread = rtc::Thread::CreateWithSocketServer();
+      shard.thread->SetName("pc_network_thread" + rtc::ToString(i), nullptr);
+      shard.thread->Start();
+      shard.network_manager = std::make_unique<rtc::BasicNetworkManager>();
+      shard.socket_factory =
+          std::make_unique<rtc::BasicPacketSocketFactory>(shard.thread.get());
+      network_thread_pool_.push_back(std::move(shard));
+    }
+  }
+  const NetworkThreadShard* shard = &network_thread_pool_[next_network_shard_];
+  next_network_shard_ = (next_network_shard_ + 1) % network_thread_pool_.size();
+  return shard;
+}
+
 cricket::ChannelManager* PeerConnectionFactory::channel_manager() {
   return channel_manager_.get();
 }
@@ -37,6 +37,8 @@ class PeerConnectionFactory : public PeerConnectionFactoryInterface {
  public:
   void SetOptions(const Options& options) override;
 
+  void PrewarmStartup() override;
+
   rtc::scoped_refptr<PeerConnectionInterface> CreatePeerConnection(
       const PeerConnectionInterface::RTCConfiguration& configuration,
       std::unique_ptr<cricket::PortAllocator> allocator,
@@ -72,8 +74,12 @@ class PeerConnectionFactory : public PeerConnectionFactoryInterface {
   bool StartAecDump(FILE* file, int64_t max_size_bytes) override;
   void StopAecDump() override;
 
+  // |network_thread| is the thread the created transports will run on; it is
+  // the connection's assigned network thread, which differs from
+  // network_thread() when network thread sharding is enabled (see
+  // Options::network_thread_pool_size).
   virtual std::unique_ptr<cricket::SctpTransportInternalFactory>
-  CreateSctpTransportInternalFactory();
+  CreateSctpTransportInternalFactory(rtc::Thread* network_thread);
 
   virtual cricket::ChannelManager* channel_manager();
 
@@ -104,8 +110,23 @@ class PeerConnectionFactory : public PeerConnectionFactoryInterface {
   virtual ~PeerConnectionFactory();
 
  private:
+  // One shard of the optional network thread pool: a network thread plus the
+  // thread-bound networking objects that would otherwise be the factory-wide
+  // defaults. Sockets created through |socket_factory| live on |thread|, so a
+  // connection pinned to a shard never hops threads on its data path.
+  struct NetworkThreadShard {
+    std::unique_ptr<rtc::Thread> thread;
+    std::unique_ptr<rtc::BasicNetworkManager> network_manager;
+    std::unique_ptr<rtc::BasicPacketSocketFactory> socket_factory;
+  };
+
   bool IsTrialEnabled(absl::string_view key) const;
 
+  // Returns the shard the next created PeerConnection should be pinned to, or
+  // null when sharding is disabled (Options::network_thread_pool_size <= 1).
+  // Creates the pool threads on first use.
+  const NetworkThreadShard* AssignNetworkShard();
+
   std::unique_ptr<RtcEventLog> CreateRtcEventLog_w();
   std::unique_ptr<Call> CreateCall_w(RtcEventLog* event_log);
 
@@ -120,6 +141,10 @@ class PeerConnectionFactory : public PeerConnectionFactoryInterface {
   std::unique_ptr<cricket::ChannelManager> channel_manager_;
   std::unique_ptr<rtc::BasicNetworkManager> default_network_manager_;
   std::unique_ptr<rtc::BasicPacketSocketFactory> default_socket_factory_;
+  // Network thread shards, created lazily by AssignNetworkShard() when
+  // Options::network_thread_pool_size asks for them.
+  std::vector<NetworkThreadShard> network_thread_pool_;
+  size_t next_network_shard_ = 0;
   std::unique_ptr<cricket::MediaEngineInterface> media_engine_;
   std::unique_ptr<webrtc::CallFactoryInterface> call_factory_;
   std::unique_ptr<RtcEventLogFactoryInterface> event_log_factory_;
@@ -1801,23 +1801,61 @@ void RTCStatsCollector::ProduceTransportStats_n(
 std::map<std::string, RTCStatsCollector::CertificateStatsPair>
 RTCStatsCollector::PrepareTransportCertificateStats_n(
     const std::map<std::string, cricket::TransportStats>&
-        transport_stats_by_name) const {
+        transport_stats_by_name) {
   RTC_DCHECK(network_thread_->IsCurrent());
   std::map<std::string, CertificateStatsPair> transport_cert_stats;
+
+  // Remove cache entries for transports that no longer exist.
+  for (auto it = transport_cert_stats_cache_n_.begin();
+       it != transport_cert_stats_cache_n_.end();) {
+    if (transport_stats_by_name.find(it->first) ==
+        transport_stats_by_name.end()) {
+      it = transport_cert_stats_cache_n_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
   for (const auto& entry : transport_stats_by_name) {
     const std::string& transport_name = entry.first;
+    TransportCertificateCacheEntry& cache_entry =
+        transport_cert_stats_cache_n_[transport_name];
 
     CertificateStatsPair certificate_stats_pair;
     rtc::scoped_refptr<rtc::RTCCertificate> local_certificate;
     if (pc_->GetLocalCertificate(transport_name, &local_certificate)) {
-      certificate_stats_pair.local =
-          local_certificate->GetSSLCertificateChain().GetStats();
+      // The certificate stats are expensive to produce (hashing and base64
+      // encoding of the whole chain); recompute them only if the certificate
+      // itself changed.
+      if (cache_entry.local_certificate != local_certificate ||
+          !cache_entry.stats.local) {
+        cache_entry.local_certificate = local_certificate;
+        cache_entry.stats.local =
+            local_certificate->GetSSLCertificateChain().GetStats();
+      }
+      certificate_stats_pair.local = cache_entry.stats.local->Copy();
+    } else {
+      cache_entry.local_certificate = nullptr;
+      cache_entry.stats.local.reset();
     }
 
     std::unique_ptr<rtc::SSLCertChain> remote_cert_chain =
         pc_->GetRemoteSSLCertChain(transport_name);
-    if (remote_cert_chain) {
-      certificate_stats_pair.remote = remote_cert_chain->GetStats();
+    if (remote_cert_chain && remote_cert_chain->GetSize() > 0) {
+      // There is no stable identity for the remote chain, so key the cached
+      // stats on the DER encoding of the leaf certificate; producing that is
+      // much cheaper than hashing and encoding the chain.
+      rtc::Buffer leaf_der;
+      remote_cert_chain->Get(0).ToDER(&leaf_der);
+      if (cache_entry.remote_leaf_der != leaf_der ||
+          !cache_entry.stats.remote) {
+        cache_entry.remote_leaf_der = std::move(leaf_der);
+        cache_entry.stats.remote = remote_cert_chain->GetStats();
+      }
+      certificate_stats_pair.remote = cache_entry.stats.remote->Copy();
+    } else {
+      cache_entry.remote_leaf_der.Clear();
+      cache_entry.stats.remote.reset();
     }
 
     transport_cert_stats.insert(
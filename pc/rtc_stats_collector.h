@@ -27,8 +27,10 @@
 #include "pc/data_channel.h"
 #include "pc/peer_connection_internal.h"
 #include "pc/track_media_info_map.h"
+#include "rtc_base/buffer.h"
 #include "rtc_base/event.h"
 #include "rtc_base/ref_count.h"
+#include "rtc_base/rtc_certificate.h"
 #include "rtc_base/ssl_identity.h"
 #include "rtc_base/third_party/sigslot/sigslot.h"
 #include "rtc_base/time_utils.h"
@@ -214,7 +216,7 @@ class RTCStatsCollector : public virtual rtc::RefCountInterface,
   std::map<std::string, CertificateStatsPair>
   PrepareTransportCertificateStats_n(
       const std::map<std::string, cricket::TransportStats>&
-          transport_stats_by_name) const;
+          transport_stats_by_name);
   std::vector<RtpTransceiverStatsInfo> PrepareTransceiverStatsInfos_s() const;
   std::set<std::string> PrepareTransportNames_s() const;
 
@@ -261,6 +263,21 @@ class RTCStatsCollector : public virtual rtc::RefCountInterface,
   std::vector<RtpTransceiverStatsInfo> transceiver_stats_infos_;
   std::set<std::string> transport_names_;
 
+  // Cached certificate stats per transport, only touched on the network
+  // thread. Certificates are immutable while a DTLS association lasts, but
+  // rtc::SSLCertificate::GetStats() re-hashes and re-base64-encodes the
+  // whole chain, which is wasteful when stats are polled frequently. The
+  // cache is self-validating: the local entry is keyed on the
+  // RTCCertificate instance and the remote entry on the leaf certificate's
+  // DER encoding, so certificate changes are picked up on the next poll.
+  struct TransportCertificateCacheEntry {
+    rtc::scoped_refptr<rtc::RTCCertificate> local_certificate;
+    rtc::Buffer remote_leaf_der;
+    CertificateStatsPair stats;
+  };
+  std::map<std::string, TransportCertificateCacheEntry>
+      transport_cert_stats_cache_n_;
+
   Call::Stats call_stats_;
 
   // A timestamp, in microseconds, that is based on a timer that is
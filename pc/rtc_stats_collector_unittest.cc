@@ -812,6 +812,51 @@ TEST_F(RTCStatsCollectorTest, CollectRTCCertificateStatsSingle) {
   ExpectReportContainsCertificateInfo(report, *remote_certinfo);
 }
 
+TEST_F(RTCStatsCollectorTest, CachedCertificateStatsSurviveCertificateChange) {
+  const char kTransportName[] = "transport";
+
+  pc_->AddVoiceChannel("audio", kTransportName);
+
+  std::unique_ptr<CertificateInfo> local_certinfo =
+      CreateFakeCertificateAndInfoFromDers(
+          std::vector<std::string>({"(local) single certificate"}));
+  pc_->SetLocalCertificate(kTransportName, local_certinfo->certificate);
+
+  std::unique_ptr<CertificateInfo> remote_certinfo =
+      CreateFakeCertificateAndInfoFromDers(
+          std::vector<std::string>({"(remote) single certificate"}));
+  pc_->SetRemoteCertChain(
+      kTransportName,
+      remote_certinfo->certificate->GetSSLCertificateChain().Clone());
+
+  rtc::scoped_refptr<const RTCStatsReport> report =
+      stats_->GetFreshStatsReport();
+  ExpectReportContainsCertificateInfo(report, *local_certinfo);
+  ExpectReportContainsCertificateInfo(report, *remote_certinfo);
+
+  // A second fresh report is served from the collector's certificate stats
+  // cache; it must contain the same certificate information.
+  report = stats_->GetFreshStatsReport();
+  ExpectReportContainsCertificateInfo(report, *local_certinfo);
+  ExpectReportContainsCertificateInfo(report, *remote_certinfo);
+
+  // Changing the certificates invalidates the cached stats.
+  std::unique_ptr<CertificateInfo> new_local_certinfo =
+      CreateFakeCertificateAndInfoFromDers(
+          std::vector<std::string>({"(local) new certificate"}));
+  pc_->SetLocalCertificate(kTransportName, new_local_certinfo->certificate);
+  std::unique_ptr<CertificateInfo> new_remote_certinfo =
+      CreateFakeCertificateAndInfoFromDers(
+          std::vector<std::string>({"(remote) new certificate"}));
+  pc_->SetRemoteCertChain(
+      kTransportName,
+      new_remote_certinfo->certificate->GetSSLCertificateChain().Clone());
+
+  report = stats_->GetFreshStatsReport();
+  ExpectReportContainsCertificateInfo(report, *new_local_certinfo);
+  ExpectReportContainsCertificateInfo(report, *new_remote_certinfo);
+}
+
 TEST_F(RTCStatsCollectorTest, CollectRTCCodecStats) {
   // Audio
   cricket::VoiceMediaInfo voice_media_info;
@@ -208,8 +208,10 @@ bool WriteDataChannelOpenMessage(const std::string& label,
     }
   }
 
-  rtc::ByteBufferWriter buffer(NULL,
-                               20 + label.length() + config.protocol.length());
+  // Typical open messages fit in the writer's inline storage, so building
+  // the payload does not allocate.
+  rtc::InlineByteBufferWriter<256> buffer(20 + label.length() +
+                                          config.protocol.length());
   // TODO(tommi): Add error handling and check resulting length.
   buffer.WriteUInt8(DATA_CHANNEL_OPEN_MESSAGE_TYPE);
   buffer.WriteUInt8(channel_type);
@@ -264,29 +264,35 @@ const ContentGroup* SessionDescription::GetGroupByName(
 ContentInfo::~ContentInfo() {
 }
 
-// Copy operator.
+// Copy operator. Shares the description; see the header comment.
 ContentInfo::ContentInfo(const ContentInfo& o)
     : name(o.name),
       type(o.type),
       rejected(o.rejected),
       bundle_only(o.bundle_only),
-      description_(o.description_->Clone()) {}
+      description_(o.description_) {}
 
 ContentInfo& ContentInfo::operator=(const ContentInfo& o) {
   name = o.name;
   type = o.type;
   rejected = o.rejected;
   bundle_only = o.bundle_only;
-  description_ = o.description_->Clone();
+  description_ = o.description_;
   return *this;
 }
 
 const MediaContentDescription* ContentInfo::media_description() const {
-  return description_.get();
+  return description_ ? description_->value.get() : nullptr;
 }
 
 MediaContentDescription* ContentInfo::media_description() {
-  return description_.get();
+  if (description_ && !description_->HasOneRef()) {
+    // Detach from copies sharing the description before handing out a
+    // mutable pointer.
+    description_ = new rtc::RefCountedObject<SharedDescription>(
+        description_->value->Clone());
+  }
+  return description_ ? description_->value.get() : nullptr;
 }
 
 }  // namespace cricket
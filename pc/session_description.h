@@ -22,6 +22,7 @@
 
 #include "absl/memory/memory.h"
 #include "api/crypto_params.h"
+#include "api/scoped_refptr.h"
 #include "api/media_types.h"
 #include "api/rtp_parameters.h"
 #include "api/rtp_transceiver_interface.h"
@@ -32,6 +33,7 @@
 #include "pc/media_protocol_names.h"
 #include "pc/simulcast_description.h"
 #include "rtc_base/deprecation.h"
+#include "rtc_base/ref_counted_object.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/system/rtc_export.h"
 
@@ -432,7 +434,12 @@ class RTC_EXPORT ContentInfo {
  public:
   explicit ContentInfo(MediaProtocolType type) : type(type) {}
   ~ContentInfo();
-  // Copy
+  // Copies share the description with the source until one of them asks for
+  // a mutable pointer through media_description(); the first such access
+  // clones the shared description, so copying an unchanged m-section costs a
+  // refcount bump instead of a deep copy. This makes SessionDescription
+  // copies cheap during renegotiation, where most sections carry over
+  // untouched between description generations.
   ContentInfo(const ContentInfo& o);
   ContentInfo& operator=(const ContentInfo& o);
   ContentInfo(ContentInfo&& o) = default;
@@ -442,12 +449,15 @@ class RTC_EXPORT ContentInfo {
   std::string mid() const { return name; }
   void set_mid(const std::string& mid) { this->name = mid; }
 
-  // Alias for |description|.
+  // Alias for |description|. The non-const overload detaches from any copies
+  // sharing the description, so the returned pointer is safe to mutate; note
+  // that pointers fetched before a copy was taken may still alias the copy.
   MediaContentDescription* media_description();
   const MediaContentDescription* media_description() const;
 
   void set_media_description(std::unique_ptr<MediaContentDescription> desc) {
-    description_ = std::move(desc);
+    description_ =
+        new rtc::RefCountedObject<SharedDescription>(std::move(desc));
   }
 
   // TODO(bugs.webrtc.org/8620): Rename this to mid.
@@ -458,7 +468,16 @@ class RTC_EXPORT ContentInfo {
 
  private:
   friend class SessionDescription;
-  std::unique_ptr<MediaContentDescription> description_;
+
+  // Refcounted holder that lets copies of a ContentInfo share one
+  // description, following the rtc::CopyOnWriteBuffer pattern.
+  struct SharedDescription {
+    explicit SharedDescription(std::unique_ptr<MediaContentDescription> d)
+        : value(std::move(d)) {}
+    std::unique_ptr<MediaContentDescription> value;
+  };
+
+  rtc::scoped_refptr<rtc::RefCountedObject<SharedDescription>> description_;
 };
 
 typedef std::vector<std::string> ContentNames;
@@ -141,4 +141,31 @@ TEST(SessionDescriptionTest, AddContentTransfersExtmapAllowMixedSetting) {
                 ->extmap_allow_mixed_enum());
 }
 
+TEST(SessionDescriptionTest, CloneSharesUnmodifiedContents) {
+  SessionDescription session_desc;
+  std::unique_ptr<MediaContentDescription> audio_desc =
+      std::make_unique<AudioContentDescription>();
+  audio_desc->set_protocol(kMediaProtocolAvpf);
+  session_desc.AddContent("audio", MediaProtocolType::kRtp,
+                          std::move(audio_desc));
+
+  std::unique_ptr<SessionDescription> copy = session_desc.Clone();
+  // Const access does not detach; the clone reads the same description.
+  const SessionDescription& const_original = session_desc;
+  const SessionDescription& const_copy = *copy;
+  EXPECT_EQ(const_original.GetContentDescriptionByName("audio"),
+            const_copy.GetContentDescriptionByName("audio"));
+
+  // Asking for a mutable description detaches the clone, and mutations no
+  // longer reach the original.
+  MediaContentDescription* mutable_desc =
+      copy->GetContentDescriptionByName("audio");
+  EXPECT_NE(mutable_desc, const_original.GetContentDescriptionByName("audio"));
+  mutable_desc->set_protocol(kMediaProtocolSavpf);
+  EXPECT_EQ(kMediaProtocolAvpf,
+            const_original.GetContentDescriptionByName("audio")->protocol());
+  EXPECT_EQ(kMediaProtocolSavpf,
+            const_copy.GetContentDescriptionByName("audio")->protocol());
+}
+
 }  // namespace cricket
@@ -155,6 +155,40 @@ bool SrtpSession::UnprotectRtp(void* p, int in_len, int* out_len) {
   return true;
 }
 
+size_t SrtpSession::UnprotectRtp(rtc::ArrayView<BatchedRtpPacket> packets) {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  if (!session_) {
+    RTC_LOG(LS_WARNING) << "Failed to unprotect SRTP batch: no SRTP Session";
+    return 0;
+  }
+
+  // libsrtp has no multi-packet entry point, so each packet still goes
+  // through srtp_unprotect; the batch shape amortizes the per-call dispatch
+  // and the failure bookkeeping below across the whole drain.
+  size_t num_decrypted = 0;
+  for (BatchedRtpPacket& packet : packets) {
+    packet.out_len = packet.in_len;
+    int err = srtp_unprotect(session_, packet.data, &packet.out_len);
+    packet.decrypted = (err == srtp_err_status_ok);
+    if (packet.decrypted) {
+      ++num_decrypted;
+      continue;
+    }
+    // Limit the error logging to avoid excessive logs when there are lots of
+    // bad packets.
+    const int kFailureLogThrottleCount = 100;
+    if (decryption_failure_count_ % kFailureLogThrottleCount == 0) {
+      RTC_LOG(LS_WARNING) << "Failed to unprotect SRTP packet, err=" << err
+                          << ", previous failure count: "
+                          << decryption_failure_count_;
+    }
+    ++decryption_failure_count_;
+    RTC_HISTOGRAM_ENUMERATION("WebRTC.PeerConnection.SrtpUnprotectError",
+                              static_cast<int>(err), kSrtpErrorCodeBoundary);
+  }
+  return num_decrypted;
+}
+
 bool SrtpSession::UnprotectRtcp(void* p, int in_len, int* out_len) {
   RTC_DCHECK(thread_checker_.IsCurrent());
   if (!session_) {
@@ -371,6 +405,14 @@ void ProhibitLibsrtpInitialization() {
   ++g_libsrtp_usage_count;
 }
 
+// static
+bool SrtpSession::EnsureLibsrtpInitialized() {
+  // The usage count is deliberately left incremented, pinning the library
+  // initialized even when all sessions are gone; a prewarmed process should
+  // not pay for a re-init on its next call either.
+  return IncrementLibsrtpUsageCountAndMaybeInit();
+}
+
 // static
 bool SrtpSession::IncrementLibsrtpUsageCountAndMaybeInit() {
   rtc::GlobalLockScope ls(&g_libsrtp_lock);
@@ -13,6 +13,7 @@
 
 #include <vector>
 
+#include "api/array_view.h"
 #include "api/scoped_refptr.h"
 #include "rtc_base/thread_checker.h"
 
@@ -33,6 +34,14 @@ class SrtpSession {
   SrtpSession();
   ~SrtpSession();
 
+  // Performs the one-time libsrtp library initialization if it has not
+  // happened yet, and keeps it initialized for the remainder of the process
+  // lifetime. Everything this does also happens lazily when the first session
+  // key is set; calling it early (see PeerConnectionFactoryInterface::
+  // PrewarmStartup) keeps the cost off the first call's setup path. Returns
+  // false if libsrtp failed to initialize.
+  static bool EnsureLibsrtpInitialized();
+
   // Configures the session for sending data using the specified
   // cipher-suite and key. Receiving must be done by a separate session.
   bool SetSend(int cs,
@@ -70,6 +79,23 @@ class SrtpSession {
   bool UnprotectRtp(void* data, int in_len, int* out_len);
   bool UnprotectRtcp(void* data, int in_len, int* out_len);
 
+  // An RTP packet to be decrypted in place by the batched UnprotectRtp()
+  // below. |data| holds |in_len| encrypted bytes on input; on return
+  // |decrypted| says whether decryption succeeded and, if so, |out_len| is
+  // the decrypted length.
+  struct BatchedRtpPacket {
+    void* data;
+    int in_len;
+    int out_len = 0;
+    bool decrypted = false;
+  };
+  // Batched version of UnprotectRtp(). Decrypts every packet in |packets| in
+  // place with a single entry into the session, so callers that drain
+  // several packets from the socket in one go (e.g. with recvmmsg) pay the
+  // per-call dispatch and failure bookkeeping once per batch instead of once
+  // per packet. Returns the number of packets successfully decrypted.
+  size_t UnprotectRtp(rtc::ArrayView<BatchedRtpPacket> packets);
+
   // Helper method to get authentication params.
   bool GetRtpAuthParams(uint8_t** key, int* key_len, int* tag_len);
 
@@ -13,7 +13,9 @@
 #include <string.h>
 
 #include <string>
+#include <vector>
 
+#include "api/array_view.h"
 #include "media/base/fake_rtp.h"
 #include "pc/test/srtp_test_util.h"
 #include "rtc_base/byte_order.h"
@@ -190,6 +192,69 @@ TEST_F(SrtpSessionTest, TestBuffersTooSmall) {
                                sizeof(rtcp_packet_) - 14, &out_len));
 }
 
+// Test that a batch of protected packets can be decrypted in one call and
+// that the result matches per-packet unprotection.
+TEST_F(SrtpSessionTest, TestBatchUnprotect) {
+  EXPECT_TRUE(s1_.SetSend(SRTP_AES128_CM_SHA1_80, kTestKey1, kTestKeyLen,
+                          kEncryptedHeaderExtensionIds));
+  EXPECT_TRUE(s2_.SetRecv(SRTP_AES128_CM_SHA1_80, kTestKey1, kTestKeyLen,
+                          kEncryptedHeaderExtensionIds));
+
+  constexpr size_t kNumPackets = 5;
+  char packets[kNumPackets][sizeof(kPcmuFrame) + 10];
+  std::vector<cricket::SrtpSession::BatchedRtpPacket> batch;
+  for (size_t i = 0; i < kNumPackets; ++i) {
+    memcpy(packets[i], kPcmuFrame, sizeof(kPcmuFrame));
+    SetBE16(reinterpret_cast<uint8_t*>(packets[i]) + 2,
+            static_cast<uint16_t>(i + 1));
+    int out_len = 0;
+    EXPECT_TRUE(s1_.ProtectRtp(packets[i], sizeof(kPcmuFrame),
+                               sizeof(packets[i]), &out_len));
+    batch.push_back({packets[i], out_len});
+  }
+
+  EXPECT_EQ(kNumPackets, s2_.UnprotectRtp(rtc::MakeArrayView(
+                             batch.data(), batch.size())));
+  for (size_t i = 0; i < kNumPackets; ++i) {
+    EXPECT_TRUE(batch[i].decrypted);
+    EXPECT_EQ(static_cast<int>(sizeof(kPcmuFrame)), batch[i].out_len);
+    // Everything except the rewritten sequence number must match the
+    // original frame.
+    EXPECT_EQ(0, memcmp(packets[i], kPcmuFrame, 2));
+    EXPECT_EQ(0, memcmp(packets[i] + 4, kPcmuFrame + 4,
+                        sizeof(kPcmuFrame) - 4));
+  }
+}
+
+// Test that one bad packet in a batch doesn't affect the others.
+TEST_F(SrtpSessionTest, TestBatchUnprotectTamperedPacket) {
+  EXPECT_TRUE(s1_.SetSend(SRTP_AES128_CM_SHA1_80, kTestKey1, kTestKeyLen,
+                          kEncryptedHeaderExtensionIds));
+  EXPECT_TRUE(s2_.SetRecv(SRTP_AES128_CM_SHA1_80, kTestKey1, kTestKeyLen,
+                          kEncryptedHeaderExtensionIds));
+
+  constexpr size_t kNumPackets = 3;
+  char packets[kNumPackets][sizeof(kPcmuFrame) + 10];
+  std::vector<cricket::SrtpSession::BatchedRtpPacket> batch;
+  for (size_t i = 0; i < kNumPackets; ++i) {
+    memcpy(packets[i], kPcmuFrame, sizeof(kPcmuFrame));
+    SetBE16(reinterpret_cast<uint8_t*>(packets[i]) + 2,
+            static_cast<uint16_t>(i + 1));
+    int out_len = 0;
+    EXPECT_TRUE(s1_.ProtectRtp(packets[i], sizeof(kPcmuFrame),
+                               sizeof(packets[i]), &out_len));
+    batch.push_back({packets[i], out_len});
+  }
+  // Corrupt a payload byte of the middle packet.
+  packets[1][sizeof(kPcmuFrame) - 1] ^= 0xff;
+
+  EXPECT_EQ(kNumPackets - 1, s2_.UnprotectRtp(rtc::MakeArrayView(
+                                 batch.data(), batch.size())));
+  EXPECT_TRUE(batch[0].decrypted);
+  EXPECT_FALSE(batch[1].decrypted);
+  EXPECT_TRUE(batch[2].decrypted);
+}
+
 TEST_F(SrtpSessionTest, TestReplay) {
   static const uint16_t kMaxSeqnum = static_cast<uint16_t>(-1);
   static const uint16_t seqnum_big = 62275;
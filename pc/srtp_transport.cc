@@ -128,6 +128,10 @@ bool SrtpTransport::SendRtpPacket(rtc::CopyOnWriteBuffer* packet,
   rtc::PacketOptions updated_options = options;
   TRACE_EVENT0("webrtc", "SRTP Encode");
   bool res;
+  // Make sure the auth tag fits so that libsrtp can write it in place; done
+  // before taking the data pointer so that any copy-on-write reallocation
+  // happens at most once.
+  packet->EnsureCapacity(packet->size() + cricket::kMaxSrtpHmacOverhead);
   uint8_t* data = packet->data();
   int len = rtc::checked_cast<int>(packet->size());
 // If ENABLE_EXTERNAL_AUTH flag is on then packet authentication is not done
@@ -185,6 +189,10 @@ bool SrtpTransport::SendRtcpPacket(rtc::CopyOnWriteBuffer* packet,
   }
 
   TRACE_EVENT0("webrtc", "SRTP Encode");
+  // SRTCP appends both the auth tag and the SRTCP index; reserve room for
+  // them up front so ProtectRtcp works in place.
+  packet->EnsureCapacity(packet->size() + cricket::kMaxSrtpHmacOverhead +
+                         cricket::kSrtcpIndexLen);
   uint8_t* data = packet->data();
   int len = rtc::checked_cast<int>(packet->size());
   if (!ProtectRtcp(data, len, static_cast<int>(packet->capacity()), &len)) {
@@ -821,20 +821,44 @@ void StatsCollector::ExtractSessionInfo() {
   report->AddBoolean(StatsReport::kStatsValueNameInitiator,
                      pc_->initial_offerer());
 
-  cricket::CandidateStatsList pooled_candidate_stats_list =
-      pc_->GetPooledCandidateStats();
-
-  for (const cricket::CandidateStats& stats : pooled_candidate_stats_list) {
-    AddCandidateReport(stats, true);
-  }
-
+  // |transceivers_| is only accessible on the signaling thread, so the
+  // transport names must be resolved before hopping to the network thread.
   std::set<std::string> transport_names;
   for (const auto& entry : pc_->GetTransportNamesByMid()) {
     transport_names.insert(entry.second);
   }
 
-  std::map<std::string, cricket::TransportStats> transport_stats_by_name =
-      pc_->GetTransportStatsByNames(transport_names);
+  // Gather all network-thread state in a single Invoke. Each of the getters
+  // called in the lambda hops to the network thread on its own when called
+  // from here, which would cost one round trip per transport; called on the
+  // network thread they run inline.
+  cricket::CandidateStatsList pooled_candidate_stats_list;
+  std::map<std::string, cricket::TransportStats> transport_stats_by_name;
+  std::map<std::string, rtc::scoped_refptr<rtc::RTCCertificate>>
+      local_certs_by_transport;
+  std::map<std::string, std::unique_ptr<rtc::SSLCertChain>>
+      remote_cert_chains_by_transport;
+  pc_->network_thread()->Invoke<void>(RTC_FROM_HERE, [&] {
+    pooled_candidate_stats_list = pc_->GetPooledCandidateStats();
+    transport_stats_by_name = pc_->GetTransportStatsByNames(transport_names);
+    for (const auto& entry : transport_stats_by_name) {
+      const std::string& transport_name = entry.first;
+      rtc::scoped_refptr<rtc::RTCCertificate> certificate;
+      if (pc_->GetLocalCertificate(transport_name, &certificate)) {
+        local_certs_by_transport[transport_name] = std::move(certificate);
+      }
+      std::unique_ptr<rtc::SSLCertChain> remote_cert_chain =
+          pc_->GetRemoteSSLCertChain(transport_name);
+      if (remote_cert_chain) {
+        remote_cert_chains_by_transport[transport_name] =
+            std::move(remote_cert_chain);
+      }
+    }
+  });
+
+  for (const cricket::CandidateStats& stats : pooled_candidate_stats_list) {
+    AddCandidateReport(stats, true);
+  }
 
   for (const auto& entry : transport_stats_by_name) {
     const std::string& transport_name = entry.first;
@@ -845,18 +869,18 @@ void StatsCollector::ExtractSessionInfo() {
     // same local and remote certificates.
     //
     StatsReport::Id local_cert_report_id, remote_cert_report_id;
-    rtc::scoped_refptr<rtc::RTCCertificate> certificate;
-    if (pc_->GetLocalCertificate(transport_name, &certificate)) {
+    auto local_cert_it = local_certs_by_transport.find(transport_name);
+    if (local_cert_it != local_certs_by_transport.end()) {
       StatsReport* r = AddCertificateReports(
-          certificate->GetSSLCertificateChain().GetStats());
+          local_cert_it->second->GetSSLCertificateChain().GetStats());
       if (r)
         local_cert_report_id = r->id();
     }
 
-    std::unique_ptr<rtc::SSLCertChain> remote_cert_chain =
-        pc_->GetRemoteSSLCertChain(transport_name);
-    if (remote_cert_chain) {
-      StatsReport* r = AddCertificateReports(remote_cert_chain->GetStats());
+    auto remote_cert_it = remote_cert_chains_by_transport.find(transport_name);
+    if (remote_cert_it != remote_cert_chains_by_transport.end()) {
+      StatsReport* r =
+          AddCertificateReports(remote_cert_it->second->GetStats());
       if (r)
         remote_cert_report_id = r->id();
     }
@@ -24,7 +24,9 @@
 #include <vector>
 
 #include "absl/algorithm/container.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
+#include "absl/strings/string_view.h"
 #include "api/candidate.h"
 #include "api/crypto_params.h"
 #include "api/jsep_ice_candidate.h"
@@ -629,6 +631,16 @@ static bool GetValue(const std::string& message,
   return true;
 }
 
+// As above, for tokens produced by the copy-free rtc::split overload. The
+// tokens this is used on are short, so the temporary std::string normally
+// stays within the small-string optimization and does not allocate.
+static bool GetValue(absl::string_view message,
+                     const std::string& attribute,
+                     std::string* value,
+                     SdpParseError* error) {
+  return GetValue(std::string(message), attribute, value, error);
+}
+
 static bool CaseInsensitiveFind(std::string str1, std::string str2) {
   absl::c_transform(str1, str1.begin(), ::tolower);
   absl::c_transform(str2, str2.begin(), ::tolower);
@@ -648,6 +660,14 @@ static bool GetValueFromString(const std::string& line,
   return true;
 }
 
+template <class T>
+static bool GetValueFromString(const std::string& line,
+                               absl::string_view s,
+                               T* t,
+                               SdpParseError* error) {
+  return GetValueFromString(line, std::string(s), t, error);
+}
+
 static bool GetPayloadTypeFromString(const std::string& line,
                                      const std::string& s,
                                      int* payload_type,
@@ -3609,8 +3629,11 @@ bool ParseRtpmapAttribute(const std::string& line,
                           const std::vector<int>& payload_types,
                           MediaContentDescription* media_desc,
                           SdpParseError* error) {
-  std::vector<std::string> fields;
-  rtc::split(line.substr(kLinePrefixLength), kSdpDelimiterSpaceChar, &fields);
+  // The fields are views into |line|; the per-field copies the std::string
+  // overload of rtc::split makes add up on offers with many m-sections.
+  std::vector<absl::string_view> fields;
+  rtc::split(absl::string_view(line).substr(kLinePrefixLength),
+             kSdpDelimiterSpaceChar, &fields);
   // RFC 4566
   // a=rtpmap:<payload type> <encoding name>/<clock rate>[/<encodingparameters>]
   const size_t expected_min_fields = 2;
@@ -3633,9 +3656,8 @@ bool ParseRtpmapAttribute(const std::string& line,
                         << line;
     return true;
   }
-  const std::string& encoder = fields[1];
-  std::vector<std::string> codec_params;
-  rtc::split(encoder, '/', &codec_params);
+  std::vector<absl::string_view> codec_params;
+  rtc::split(fields[1], '/', &codec_params);
   // <encoding name>/<clock rate>[/<encodingparameters>]
   // 2 mandatory fields
   if (codec_params.size() < 2 || codec_params.size() > 3) {
@@ -3644,7 +3666,7 @@ bool ParseRtpmapAttribute(const std::string& line,
                        "[/<encodingparameters>]\".",
                        error);
   }
-  const std::string& encoding_name = codec_params[0];
+  const std::string encoding_name(codec_params[0]);
   int clock_rate = 0;
   if (!GetValueFromString(line, codec_params[1], &clock_rate, error)) {
     return false;
@@ -3723,13 +3745,14 @@ bool ParseFmtpAttributes(const std::string& line,
     return false;
   }
 
-  // Parse out format specific parameters.
-  std::vector<std::string> fields;
+  // Parse out format specific parameters. The fields are views into
+  // |line_params| to avoid a copy per parameter.
+  std::vector<absl::string_view> fields;
   rtc::split(line_params, kSdpDelimiterSemicolonChar, &fields);
 
   cricket::CodecParameterMap codec_params;
-  for (auto& iter : fields) {
-    if (iter.find(kSdpDelimiterEqual) == std::string::npos) {
+  for (absl::string_view iter : fields) {
+    if (iter.find(kSdpDelimiterEqualChar) == absl::string_view::npos) {
       // Only fmtps with equals are currently supported. Other fmtp types
       // should be ignored. Unknown fmtps do not constitute an error.
       continue;
@@ -3737,7 +3760,8 @@ bool ParseFmtpAttributes(const std::string& line,
 
     std::string name;
     std::string value;
-    if (!ParseFmtpParam(rtc::string_trim(iter), &name, &value, error)) {
+    if (!ParseFmtpParam(std::string(absl::StripAsciiWhitespace(iter)), &name,
+                        &value, error)) {
       return false;
     }
     codec_params[name] = value;
@@ -3760,8 +3784,8 @@ bool ParsePacketizationAttribute(const std::string& line,
   if (media_type != cricket::MEDIA_TYPE_VIDEO) {
     return true;
   }
-  std::vector<std::string> packetization_fields;
-  rtc::split(line.c_str(), kSdpDelimiterSpaceChar, &packetization_fields);
+  std::vector<absl::string_view> packetization_fields;
+  rtc::split(line, kSdpDelimiterSpaceChar, &packetization_fields);
   if (packetization_fields.size() < 2) {
     return ParseFailedGetValue(line, kAttributePacketization, error);
   }
@@ -3775,7 +3799,7 @@ bool ParsePacketizationAttribute(const std::string& line,
                                 error)) {
     return false;
   }
-  std::string packetization = packetization_fields[1];
+  std::string packetization(packetization_fields[1]);
   UpdateVideoCodecPacketization(media_desc->as_video(), payload_type,
                                 packetization);
   return true;
@@ -3789,8 +3813,8 @@ bool ParseRtcpFbAttribute(const std::string& line,
       media_type != cricket::MEDIA_TYPE_VIDEO) {
     return true;
   }
-  std::vector<std::string> rtcp_fb_fields;
-  rtc::split(line.c_str(), kSdpDelimiterSpaceChar, &rtcp_fb_fields);
+  std::vector<absl::string_view> rtcp_fb_fields;
+  rtc::split(line, kSdpDelimiterSpaceChar, &rtcp_fb_fields);
   if (rtcp_fb_fields.size() < 2) {
     return ParseFailedGetValue(line, kAttributeRtcpFb, error);
   }
@@ -3806,11 +3830,11 @@ bool ParseRtcpFbAttribute(const std::string& line,
       return false;
     }
   }
-  std::string id = rtcp_fb_fields[1];
+  std::string id(rtcp_fb_fields[1]);
   std::string param = "";
-  for (std::vector<std::string>::iterator iter = rtcp_fb_fields.begin() + 2;
-       iter != rtcp_fb_fields.end(); ++iter) {
-    param.append(*iter);
+  for (auto iter = rtcp_fb_fields.begin() + 2; iter != rtcp_fb_fields.end();
+       ++iter) {
+    param.append(iter->data(), iter->size());
   }
   const cricket::FeedbackParam feedback_param(id, param);
 
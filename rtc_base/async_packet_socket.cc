@@ -10,6 +10,8 @@
 
 #include "rtc_base/async_packet_socket.h"
 
+#include "rtc_base/checks.h"
+
 namespace rtc {
 
 PacketTimeUpdateParams::PacketTimeUpdateParams() = default;
@@ -28,6 +30,24 @@ AsyncPacketSocket::AsyncPacketSocket() = default;
 
 AsyncPacketSocket::~AsyncPacketSocket() = default;
 
+void AsyncPacketSocket::SetReadPacketCallback(ReadPacketCallback callback) {
+  RTC_DCHECK(!callback || !read_packet_callback_)
+      << "A read packet callback is already registered; clear it before "
+         "handing the socket to a new consumer.";
+  read_packet_callback_ = std::move(callback);
+}
+
+void AsyncPacketSocket::DispatchReadPacket(const char* data,
+                                           size_t size,
+                                           const SocketAddress& address,
+                                           const int64_t& packet_time_us) {
+  if (read_packet_callback_) {
+    read_packet_callback_(this, data, size, address, packet_time_us);
+  } else {
+    SignalReadPacket(this, data, size, address, packet_time_us);
+  }
+}
+
 void CopySocketInformationToPacketInfo(size_t packet_size_bytes,
                                        const AsyncPacketSocket& socket_from,
                                        bool is_connectionless,
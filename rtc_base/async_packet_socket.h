@@ -11,6 +11,8 @@
 #ifndef RTC_BASE_ASYNC_PACKET_SOCKET_H_
 #define RTC_BASE_ASYNC_PACKET_SOCKET_H_
 
+#include <functional>
+#include <utility>
 #include <vector>
 
 #include "rtc_base/constructor_magic.h"
@@ -49,6 +51,17 @@ struct RTC_EXPORT PacketOptions {
   // When used with RTP packets (for example, webrtc::PacketOptions), the value
   // should be 16 bits. A value of -1 represents "not set".
   int64_t packet_id = -1;
+  // Pacer-assigned transmit time in microseconds on the rtc::TimeMicros()
+  // clock, or -1 to send immediately. Only honored when the underlying
+  // socket has Socket::OPT_TXTIME enabled, in which case the kernel delays
+  // the actual transmit until this time (see Socket::SendToAtTime()).
+  int64_t launch_time_us = -1;
+  // Set when the sender expects more packets for the same destination in the
+  // current loop turn (for example, packets of a pacer burst). A batching
+  // socket (see AsyncUDPSocket) may briefly queue the packet and hand the
+  // whole run to the kernel in one syscall (see Socket::SendToBatch());
+  // non-batching sockets send immediately as usual.
+  bool batchable = false;
   PacketTimeUpdateParams packet_time_params;
   // PacketInfo is passed to SentPacket when signaling this packet is sent.
   PacketInfo info_signaled_after_sent;
@@ -109,6 +122,30 @@ class RTC_EXPORT AsyncPacketSocket : public sigslot::has_slots<> {
                    const int64_t&>
       SignalReadPacket;
 
+  // Direct-dispatch alternative to SignalReadPacket for the per-packet hot
+  // path. Every production socket has exactly one read consumer, wired once
+  // at setup; routing each packet through the sigslot signal above still
+  // pays for slot-list iteration and the sigslot mutex. When a callback is
+  // set, DispatchReadPacket() invokes it instead of SignalReadPacket.
+  using ReadPacketCallback = std::function<void(AsyncPacketSocket*,
+                                                const char*,
+                                                size_t,
+                                                const SocketAddress&,
+                                                const int64_t&)>;
+
+  // Sets the read callback, replacing SignalReadPacket dispatch. May only
+  // transition between null and non-null; to hand a socket off to a new
+  // consumer, clear the callback first. Must not be called while a packet
+  // may be in flight, i.e. only from the socket's own thread.
+  void SetReadPacketCallback(ReadPacketCallback callback);
+
+  // Called by subclasses (and socket wrappers) to deliver a received packet
+  // to the registered callback, or to SignalReadPacket when none is set.
+  void DispatchReadPacket(const char* data,
+                          size_t size,
+                          const SocketAddress& address,
+                          const int64_t& packet_time_us);
+
   // Emitted each time a packet is sent.
   sigslot::signal2<AsyncPacketSocket*, const SentPacket&> SignalSentPacket;
 
@@ -133,6 +170,8 @@ class RTC_EXPORT AsyncPacketSocket : public sigslot::has_slots<> {
   sigslot::signal2<AsyncPacketSocket*, AsyncPacketSocket*> SignalNewConnection;
 
  private:
+  ReadPacketCallback read_packet_callback_;
+
   RTC_DISALLOW_COPY_AND_ASSIGN(AsyncPacketSocket);
 };
 
@@ -17,6 +17,7 @@
 #include <memory>
 
 #include "api/array_view.h"
+#include "rtc_base/arraysize.h"
 #include "rtc_base/byte_order.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
@@ -193,6 +194,64 @@ void AsyncTCPSocketBase::AppendToOutBuffer(const void* pv, size_t cb) {
   outbuf_.AppendData(static_cast<const uint8_t*>(pv), cb);
 }
 
+int AsyncTCPSocketBase::SendVectored(const Socket::SendBuffer* buffers,
+                                     size_t count) {
+  RTC_DCHECK(!listen_);
+  RTC_DCHECK(IsOutBufferEmpty());
+  RTC_DCHECK_LE(count, kMaxSendBuffers);
+
+  Socket::SendBuffer pending[kMaxSendBuffers];
+  size_t total = 0;
+  for (size_t i = 0; i < count; ++i) {
+    pending[i] = buffers[i];
+    total += buffers[i].size;
+  }
+  RTC_DCHECK_LE(total, max_outsize_);
+
+  size_t first = 0;  // Index of the first buffer with unsent bytes.
+  size_t total_sent = 0;
+  int res = 0;
+  while (first < count) {
+    res = socket_->SendV(pending + first, count - first);
+    if (res <= 0) {
+      break;
+    }
+    total_sent += res;
+    // Pop the buffers that went out whole and trim the sent prefix off the
+    // first partially written one.
+    size_t progress = static_cast<size_t>(res);
+    while (first < count && progress >= pending[first].size) {
+      progress -= pending[first].size;
+      ++first;
+    }
+    if (first < count) {
+      pending[first].data =
+          static_cast<const uint8_t*>(pending[first].data) + progress;
+      pending[first].size -= progress;
+    } else {
+      RTC_DCHECK_EQ(progress, 0);
+    }
+  }
+  if (first == count) {
+    // Everything was written; nothing needs to be queued.
+    RTC_DCHECK_EQ(total_sent, total);
+    return static_cast<int>(total);
+  }
+  // In the special case of EWOULDBLOCK, signal that we had a partial write.
+  if (socket_->GetError() == EWOULDBLOCK) {
+    res = static_cast<int>(total_sent);
+  }
+  if (total_sent > 0) {
+    // Queue only the unsent remainder; OnWriteEvent() will flush it. If
+    // nothing was sent the caller drops the packet, so there is nothing
+    // to queue.
+    for (size_t i = first; i < count; ++i) {
+      AppendToOutBuffer(pending[i].data, pending[i].size);
+    }
+  }
+  return res;
+}
+
 void AsyncTCPSocketBase::OnConnectEvent(AsyncSocket* socket) {
   SignalConnect(this);
 }
@@ -302,11 +361,13 @@ int AsyncTCPSocket::Send(const void* pv,
   if (!IsOutBufferEmpty())
     return static_cast<int>(cb);
 
+  // Write the length frame and the payload straight from the caller's
+  // buffer; only what the socket does not accept ends up in the out
+  // buffer.
   PacketLength pkt_len = HostToNetwork16(static_cast<PacketLength>(cb));
-  AppendToOutBuffer(&pkt_len, kPacketLenSize);
-  AppendToOutBuffer(pv, cb);
+  Socket::SendBuffer buffers[2] = {{&pkt_len, kPacketLenSize}, {pv, cb}};
 
-  int res = FlushOutBuffer();
+  int res = SendVectored(buffers, arraysize(buffers));
   if (res <= 0) {
     // drop packet if we made no progress
     ClearOutBuffer();
@@ -333,8 +394,8 @@ void AsyncTCPSocket::ProcessInput(char* data, size_t* len) {
     if (*len < kPacketLenSize + pkt_len)
       return;
 
-    SignalReadPacket(this, data + kPacketLenSize, pkt_len, remote_addr,
-                     TimeMicros());
+    DispatchReadPacket(data + kPacketLenSize, pkt_len, remote_addr,
+                       TimeMicros());
 
     *len -= kPacketLenSize + pkt_len;
     if (*len > 0) {
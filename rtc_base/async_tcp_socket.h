@@ -65,6 +65,15 @@ class AsyncTCPSocketBase : public AsyncPacketSocket {
   // Add data to |outbuf_|.
   void AppendToOutBuffer(const void* pv, size_t cb);
 
+  // Sends the |count| buffers in |buffers| (at most kMaxSendBuffers)
+  // straight from the caller's memory with a vectored write, so framing
+  // headers and payloads are not copied into |outbuf_| first. Only the
+  // remainder of a partial send is queued in |outbuf_|, to be flushed on
+  // the next write event. Requires |outbuf_| to be empty. Returns the
+  // same values as FlushOutBuffer().
+  static constexpr size_t kMaxSendBuffers = 4;
+  int SendVectored(const Socket::SendBuffer* buffers, size_t count);
+
   // Helper methods for |outpos_|.
   bool IsOutBufferEmpty() const { return outbuf_.size() == 0; }
   void ClearOutBuffer() { outbuf_.Clear(); }
@@ -10,14 +10,75 @@
 
 #include "rtc_base/async_tcp_socket.h"
 
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "rtc_base/gunit.h"
 #include "rtc_base/virtual_socket_server.h"
 
 namespace rtc {
 
+// An AsyncSocket that records what is written to it and can be told to
+// accept only part of it, for testing the vectored send path.
+class CapturingFakeSocket : public AsyncSocket {
+ public:
+  SocketAddress GetLocalAddress() const override { return SocketAddress(); }
+  SocketAddress GetRemoteAddress() const override { return SocketAddress(); }
+  int Bind(const SocketAddress& addr) override { return 0; }
+  int Connect(const SocketAddress& addr) override { return 0; }
+  int Send(const void* pv, size_t cb) override {
+    SendBuffer buffer = {pv, cb};
+    return SendV(&buffer, 1);
+  }
+  int SendV(const SendBuffer* buffers, size_t count) override {
+    ++send_calls;
+    buffers_in_last_send = count;
+    size_t accepted = 0;
+    for (size_t i = 0; i < count && accepted < send_budget; ++i) {
+      size_t len = std::min(buffers[i].size, send_budget - accepted);
+      const uint8_t* data = static_cast<const uint8_t*>(buffers[i].data);
+      wire.insert(wire.end(), data, data + len);
+      accepted += len;
+    }
+    if (send_budget != SIZE_MAX)
+      send_budget -= accepted;
+    if (accepted == 0) {
+      error = EWOULDBLOCK;
+      return -1;
+    }
+    return static_cast<int>(accepted);
+  }
+  int SendTo(const void* pv, size_t cb, const SocketAddress& addr) override {
+    return Send(pv, cb);
+  }
+  int Recv(void* pv, size_t cb, int64_t* timestamp) override { return -1; }
+  int RecvFrom(void* pv,
+               size_t cb,
+               SocketAddress* paddr,
+               int64_t* timestamp) override {
+    return -1;
+  }
+  int Listen(int backlog) override { return 0; }
+  AsyncSocket* Accept(SocketAddress* paddr) override { return nullptr; }
+  int Close() override { return 0; }
+  int GetError() const override { return error; }
+  void SetError(int err) override { error = err; }
+  ConnState GetState() const override { return CS_CONNECTED; }
+  int GetOption(Option opt, int* value) override { return 0; }
+  int SetOption(Option opt, int value) override { return 0; }
+
+  std::vector<uint8_t> wire;
+  size_t send_budget = SIZE_MAX;
+  size_t buffers_in_last_send = 0;
+  int send_calls = 0;
+  int error = 0;
+};
+
 class AsyncTCPSocketTest : public ::testing::Test, public sigslot::has_slots<> {
  public:
   AsyncTCPSocketTest()
@@ -44,4 +105,43 @@ TEST_F(AsyncTCPSocketTest, OnWriteEvent) {
   EXPECT_TRUE(ready_to_send_);
 }
 
+TEST(AsyncTCPSocketSendTest, SendsFrameAndPayloadInOneVectoredWrite) {
+  CapturingFakeSocket* socket = new CapturingFakeSocket();
+  AsyncTCPSocket tcp_socket(socket, false);
+
+  const char kData[] = "hello";
+  EXPECT_EQ(5, tcp_socket.Send(kData, 5, PacketOptions()));
+  ASSERT_EQ(7u, socket->wire.size());
+  // 2-byte big-endian length frame, then the payload, from one gather
+  // write rather than a copy into the out buffer.
+  EXPECT_EQ(0, socket->wire[0]);
+  EXPECT_EQ(5, socket->wire[1]);
+  EXPECT_EQ(0, memcmp(&socket->wire[2], kData, 5));
+  EXPECT_EQ(1, socket->send_calls);
+  EXPECT_EQ(2u, socket->buffers_in_last_send);
+}
+
+TEST(AsyncTCPSocketSendTest, PartialSendQueuesOnlyRemainder) {
+  CapturingFakeSocket* socket = new CapturingFakeSocket();
+  AsyncTCPSocket tcp_socket(socket, false);
+
+  // Let the socket take the frame plus one payload byte, then block.
+  socket->send_budget = 3;
+  const char kData[] = "hello";
+  EXPECT_EQ(5, tcp_socket.Send(kData, 5, PacketOptions()));
+  EXPECT_EQ(3u, socket->wire.size());
+
+  // A second send while blocked is silently dropped.
+  EXPECT_EQ(5, tcp_socket.Send(kData, 5, PacketOptions()));
+  EXPECT_EQ(3u, socket->wire.size());
+
+  // The write event flushes the queued remainder; nothing is re-sent.
+  socket->send_budget = SIZE_MAX;
+  socket->SignalWriteEvent(socket);
+  ASSERT_EQ(7u, socket->wire.size());
+  EXPECT_EQ(0, socket->wire[0]);
+  EXPECT_EQ(5, socket->wire[1]);
+  EXPECT_EQ(0, memcmp(&socket->wire[2], kData, 5));
+}
+
 }  // namespace rtc
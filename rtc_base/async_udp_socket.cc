@@ -11,6 +11,7 @@
 #include "rtc_base/async_udp_socket.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include <string>
 
@@ -18,6 +19,7 @@
 #include "rtc_base/logging.h"
 #include "rtc_base/network/sent_packet.h"
 #include "rtc_base/third_party/sigslot/sigslot.h"
+#include "rtc_base/thread.h"
 #include "rtc_base/time_utils.h"
 
 namespace rtc {
@@ -45,7 +47,6 @@ AsyncUDPSocket* AsyncUDPSocket::Create(SocketFactory* factory,
 
 AsyncUDPSocket::AsyncUDPSocket(AsyncSocket* socket) : socket_(socket) {
   size_ = BUF_SIZE;
-  buf_ = new char[size_];
 
   // The socket should start out readable but not writable.
   socket_->SignalReadEvent.connect(this, &AsyncUDPSocket::OnReadEvent);
@@ -53,7 +54,9 @@ AsyncUDPSocket::AsyncUDPSocket(AsyncSocket* socket) : socket_(socket) {
 }
 
 AsyncUDPSocket::~AsyncUDPSocket() {
-  delete[] buf_;
+  // The MessageHandler base clears the posted flush message; any packets
+  // still batched go out before the socket is torn down.
+  FlushSendBatch();
 }
 
 SocketAddress AsyncUDPSocket::GetLocalAddress() const {
@@ -70,6 +73,9 @@ int AsyncUDPSocket::Send(const void* pv,
   rtc::SentPacket sent_packet(options.packet_id, rtc::TimeMillis(),
                               options.info_signaled_after_sent);
   CopySocketInformationToPacketInfo(cb, *this, false, &sent_packet.info);
+  // Flush first so a batched burst is not reordered behind this packet.
+  FlushSendBatch();
+  ApplyDscp(options.dscp);
   int ret = socket_->Send(pv, cb);
   SignalSentPacket(this, sent_packet);
   return ret;
@@ -82,11 +88,78 @@ int AsyncUDPSocket::SendTo(const void* pv,
   rtc::SentPacket sent_packet(options.packet_id, rtc::TimeMillis(),
                               options.info_signaled_after_sent);
   CopySocketInformationToPacketInfo(cb, *this, true, &sent_packet.info);
-  int ret = socket_->SendTo(pv, cb, addr);
+  if (options.batchable && options.launch_time_us < 0 &&
+      cb <= kMaxBatchedPacketSize && Thread::Current() != nullptr) {
+    // Batchable packets are held until the end of the loop turn, so the
+    // rest of the burst being posted to this thread can join them in one
+    // Socket::SendToBatch() call. A destination change or a full buffer
+    // flushes early to preserve ordering.
+    if (pending_send_count_ > 0 &&
+        (addr != pending_send_addr_ || options.dscp != pending_send_dscp_ ||
+         pending_send_count_ == kSendBatchSize)) {
+      FlushSendBatch();
+    }
+    if (!send_batch_buf_) {
+      send_batch_buf_.reset(new char[kSendBatchSize * kMaxBatchedPacketSize]);
+    }
+    memcpy(send_batch_buf_.get() + pending_send_count_ * kMaxBatchedPacketSize,
+           pv, cb);
+    pending_send_sizes_[pending_send_count_] = cb;
+    pending_send_addr_ = addr;
+    pending_send_dscp_ = options.dscp;
+    ++pending_send_count_;
+    if (!flush_posted_) {
+      Thread::Current()->Post(RTC_FROM_HERE, this);
+      flush_posted_ = true;
+    }
+    // Signaled here rather than at flush time so the feedback-generating
+    // code sees the same ordering as with immediate sends; the flush is at
+    // most one loop turn away.
+    SignalSentPacket(this, sent_packet);
+    return static_cast<int>(cb);
+  }
+  // Flush first so a batched burst is not reordered behind this packet.
+  FlushSendBatch();
+  ApplyDscp(options.dscp);
+  int ret =
+      options.launch_time_us >= 0
+          ? socket_->SendToAtTime(pv, cb, addr, options.launch_time_us)
+          : socket_->SendTo(pv, cb, addr);
   SignalSentPacket(this, sent_packet);
   return ret;
 }
 
+void AsyncUDPSocket::FlushSendBatch() {
+  if (pending_send_count_ == 0)
+    return;
+  Socket::SendBuffer buffers[kSendBatchSize];
+  for (size_t i = 0; i < pending_send_count_; ++i) {
+    buffers[i].data = send_batch_buf_.get() + i * kMaxBatchedPacketSize;
+    buffers[i].size = pending_send_sizes_[i];
+  }
+  size_t count = pending_send_count_;
+  pending_send_count_ = 0;
+  ApplyDscp(pending_send_dscp_);
+  int sent = socket_->SendToBatch(buffers, count, pending_send_addr_);
+  if (sent < 0 || static_cast<size_t>(sent) < count) {
+    // Packets that did not make it are dropped, consistent with this class
+    // not buffering sends under high load.
+    RTC_LOG(LS_VERBOSE) << "SendToBatch sent " << sent << " of " << count
+                        << " packets, error " << socket_->GetError();
+  }
+}
+
+void AsyncUDPSocket::ApplyDscp(DiffServCodePoint dscp) {
+  if (dscp == DSCP_NO_CHANGE)
+    return;
+  socket_->SetOption(Socket::OPT_DSCP, dscp);
+}
+
+void AsyncUDPSocket::OnMessage(Message* msg) {
+  flush_posted_ = false;
+  FlushSendBatch();
+}
+
 int AsyncUDPSocket::Close() {
   return socket_->Close();
 }
@@ -114,10 +187,18 @@ void AsyncUDPSocket::SetError(int error) {
 void AsyncUDPSocket::OnReadEvent(AsyncSocket* socket) {
   RTC_DCHECK(socket_.get() == socket);
 
-  SocketAddress remote_addr;
-  int64_t timestamp;
-  int len = socket_->RecvFrom(buf_, size_, &remote_addr, &timestamp);
-  if (len < 0) {
+  // The batch buffers are only needed on sockets that actually receive, so
+  // allocation is deferred until the first read event.
+  if (!batch_buf_) {
+    batch_buf_.reset(new char[kReceiveBatchSize * size_]);
+  }
+  Socket::ReceivedDatagram datagrams[kReceiveBatchSize];
+  for (size_t i = 0; i < kReceiveBatchSize; ++i) {
+    datagrams[i].buffer = batch_buf_.get() + i * size_;
+    datagrams[i].buffer_size = size_;
+  }
+  int count = socket_->RecvFromBatch(datagrams, kReceiveBatchSize);
+  if (count < 0) {
     // An error here typically means we got an ICMP error in response to our
     // send datagram, indicating the remote address was unreachable.
     // When doing ICE, this kind of thing will often happen.
@@ -130,8 +211,21 @@ void AsyncUDPSocket::OnReadEvent(AsyncSocket* socket) {
 
   // TODO: Make sure that we got all of the packet.
   // If we did not, then we should resize our buffer to be large enough.
-  SignalReadPacket(this, buf_, static_cast<size_t>(len), remote_addr,
-                   (timestamp > -1 ? timestamp : TimeMicros()));
+  // Read the fallback time once for the whole batch; the packets arrived
+  // together, and one clock read per packet adds up at high packet rates.
+  int64_t fallback_timestamp = -1;
+  for (int i = 0; i < count; ++i) {
+    const Socket::ReceivedDatagram& datagram = datagrams[i];
+    int64_t timestamp = datagram.timestamp;
+    if (timestamp <= -1) {
+      if (fallback_timestamp == -1) {
+        fallback_timestamp = TimeMicros();
+      }
+      timestamp = fallback_timestamp;
+    }
+    DispatchReadPacket(static_cast<const char*>(datagram.buffer),
+                       datagram.received, datagram.source_addr, timestamp);
+  }
 }
 
 void AsyncUDPSocket::OnWriteEvent(AsyncSocket* socket) {
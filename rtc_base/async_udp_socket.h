@@ -17,6 +17,7 @@
 
 #include "rtc_base/async_packet_socket.h"
 #include "rtc_base/async_socket.h"
+#include "rtc_base/message_handler.h"
 #include "rtc_base/socket.h"
 #include "rtc_base/socket_address.h"
 #include "rtc_base/socket_factory.h"
@@ -24,8 +25,11 @@
 namespace rtc {
 
 // Provides the ability to receive packets asynchronously.  Sends are not
-// buffered since it is acceptable to drop packets under high load.
-class AsyncUDPSocket : public AsyncPacketSocket {
+// buffered since it is acceptable to drop packets under high load, except
+// that packets marked PacketOptions::batchable are held until the end of
+// the current loop turn so a burst for one destination goes to the kernel
+// in a single Socket::SendToBatch() call.
+class AsyncUDPSocket : public AsyncPacketSocket, public MessageHandler {
  public:
   // Binds |socket| and creates AsyncUDPSocket for it. Takes ownership
   // of |socket|. Returns null if bind() fails (|socket| is destroyed
@@ -56,15 +60,47 @@ class AsyncUDPSocket : public AsyncPacketSocket {
   int GetError() const override;
   void SetError(int error) override;
 
+  // Flushes any batched sends; see PacketOptions::batchable.
+  void OnMessage(Message* msg) override;
+
  private:
   // Called when the underlying socket is ready to be read from.
   void OnReadEvent(AsyncSocket* socket);
   // Called when the underlying socket is ready to send.
   void OnWriteEvent(AsyncSocket* socket);
+  // Hands the pending batchable packets to the socket in one call.
+  void FlushSendBatch();
+  // Applies |dscp| to the socket before a send. The underlying socket caches
+  // the current marking, so re-asserting an unchanged priority costs no
+  // syscall; see PhysicalSocket::SetOption().
+  void ApplyDscp(DiffServCodePoint dscp);
+
+  // Number of datagrams read per wakeup; bounds both the batch buffer size
+  // and how long one read event can monopolize the network thread.
+  static constexpr size_t kReceiveBatchSize = 4;
+  // Most batchable packets a flush hands to Socket::SendToBatch() at once.
+  static constexpr size_t kSendBatchSize = 16;
+  // Packets larger than this bypass batching; media packets stay well under
+  // it, and it keeps the copy into the batch buffer cheap.
+  static constexpr size_t kMaxBatchedPacketSize = 2048;
 
   std::unique_ptr<AsyncSocket> socket_;
-  char* buf_;
+  // Lazily allocated storage for kReceiveBatchSize datagrams of size_ bytes
+  // each, filled by Socket::RecvFromBatch().
+  std::unique_ptr<char[]> batch_buf_;
   size_t size_;
+  // Lazily allocated storage for kSendBatchSize batchable packets of
+  // kMaxBatchedPacketSize bytes each, flushed by FlushSendBatch().
+  std::unique_ptr<char[]> send_batch_buf_;
+  size_t pending_send_sizes_[kSendBatchSize];
+  size_t pending_send_count_ = 0;
+  SocketAddress pending_send_addr_;
+  // Marking shared by all packets in the pending batch; a packet with a
+  // different priority flushes the batch first, so one batch never mixes
+  // DSCP values.
+  DiffServCodePoint pending_send_dscp_ = DSCP_NO_CHANGE;
+  // True while a flush message is queued on the current thread.
+  bool flush_posted_ = false;
 };
 
 }  // namespace rtc
@@ -15,6 +15,7 @@
 
 #include "rtc_base/gunit.h"
 #include "rtc_base/physical_socket_server.h"
+#include "rtc_base/thread.h"
 #include "rtc_base/virtual_socket_server.h"
 
 namespace rtc {
@@ -33,12 +34,21 @@ class AsyncUdpSocketTest : public ::testing::Test, public sigslot::has_slots<> {
 
   void OnReadyToSend(rtc::AsyncPacketSocket* socket) { ready_to_send_ = true; }
 
+  void OnPacket(rtc::AsyncPacketSocket* socket,
+                const char* data,
+                size_t size,
+                const SocketAddress& addr,
+                const int64_t& timestamp) {
+    ++packets_received_;
+  }
+
  protected:
   std::unique_ptr<PhysicalSocketServer> pss_;
   std::unique_ptr<VirtualSocketServer> vss_;
   AsyncSocket* socket_;
   std::unique_ptr<AsyncUDPSocket> udp_socket_;
   bool ready_to_send_;
+  int packets_received_ = 0;
 };
 
 TEST_F(AsyncUdpSocketTest, OnWriteEvent) {
@@ -47,4 +57,22 @@ TEST_F(AsyncUdpSocketTest, OnWriteEvent) {
   EXPECT_TRUE(ready_to_send_);
 }
 
+TEST_F(AsyncUdpSocketTest, BatchableSendsAreFlushedWithinTheLoopTurn) {
+  AutoSocketServerThread thread(vss_.get());
+  ASSERT_EQ(0, socket_->Bind(SocketAddress("127.0.0.1", 0)));
+  std::unique_ptr<AsyncUDPSocket> receiver(
+      AsyncUDPSocket::Create(vss_.get(), SocketAddress("127.0.0.1", 0)));
+  ASSERT_NE(nullptr, receiver);
+  receiver->SignalReadPacket.connect(this, &AsyncUdpSocketTest::OnPacket);
+
+  rtc::PacketOptions options;
+  options.batchable = true;
+  const char payload[] = "abc";
+  const SocketAddress dest = receiver->GetLocalAddress();
+  EXPECT_EQ(3, udp_socket_->SendTo(payload, 3, dest, options));
+  EXPECT_EQ(3, udp_socket_->SendTo(payload, 3, dest, options));
+  // Both packets go out when the posted flush runs, before any new work.
+  EXPECT_EQ_WAIT(2, packets_received_, 1000);
+}
+
 }  // namespace rtc
@@ -16,6 +16,9 @@ namespace rtc {
 
 ByteBufferWriter::ByteBufferWriter() : ByteBufferWriterT() {}
 
+ByteBufferWriter::ByteBufferWriter(size_t capacity)
+    : ByteBufferWriterT(capacity) {}
+
 ByteBufferWriter::ByteBufferWriter(const char* bytes, size_t len)
     : ByteBufferWriterT(bytes, len) {}
 
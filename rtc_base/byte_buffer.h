@@ -13,7 +13,10 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
+#include <algorithm>
+#include <memory>
 #include <string>
 
 #include "rtc_base/buffer.h"
@@ -27,6 +30,9 @@ template <class BufferClassT>
 class ByteBufferWriterT {
  public:
   ByteBufferWriterT() { Construct(nullptr, kDefaultCapacity); }
+  // Preallocates exactly |capacity| bytes up front, for callers that can
+  // compute the serialized length before writing.
+  explicit ByteBufferWriterT(size_t capacity) { Construct(nullptr, capacity); }
   ByteBufferWriterT(const char* bytes, size_t len) { Construct(bytes, len); }
 
   const char* Data() const { return buffer_.data(); }
@@ -110,12 +116,94 @@ class ByteBufferWriterT {
 class ByteBufferWriter : public ByteBufferWriterT<BufferT<char>> {
  public:
   ByteBufferWriter();
+  explicit ByteBufferWriter(size_t capacity);
   ByteBufferWriter(const char* bytes, size_t len);
 
  private:
   RTC_DISALLOW_COPY_AND_ASSIGN(ByteBufferWriter);
 };
 
+// Backing store for ByteBufferWriterT with |InlineCapacity| bytes of
+// storage inside the object itself, typically on the stack. Contents that
+// outgrow the inline capacity spill into a heap allocation; until then no
+// allocation is performed. Implements the subset of the BufferT<char>
+// interface that ByteBufferWriterT needs.
+template <size_t InlineCapacity>
+class InlineBuffer {
+ public:
+  InlineBuffer() = default;
+
+  const char* data() const { return data_; }
+  char* data() { return data_; }
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+
+  void AppendData(const char* data, size_t size) {
+    const size_t new_size = size_ + size;
+    EnsureCapacityWithHeadroom(new_size);
+    memcpy(data_ + size_, data, size);
+    size_ = new_size;
+  }
+
+  // Like BufferT::SetSize, bytes between the old and new size are left
+  // uninitialized when growing.
+  void SetSize(size_t size) {
+    EnsureCapacityWithHeadroom(size);
+    size_ = size;
+  }
+
+  void EnsureCapacity(size_t capacity) {
+    if (capacity <= capacity_)
+      return;
+    Grow(capacity);
+  }
+
+  void Clear() { size_ = 0; }
+
+ private:
+  void EnsureCapacityWithHeadroom(size_t capacity) {
+    if (capacity <= capacity_)
+      return;
+    // Grow by at least 1.5x to prevent quadratic copying, as BufferT does.
+    Grow(std::max(capacity, capacity_ + capacity_ / 2));
+  }
+
+  void Grow(size_t new_capacity) {
+    std::unique_ptr<char[]> new_data(new char[new_capacity]);
+    memcpy(new_data.get(), data_, size_);
+    heap_data_ = std::move(new_data);
+    data_ = heap_data_.get();
+    capacity_ = new_capacity;
+  }
+
+  char inline_data_[InlineCapacity];
+  std::unique_ptr<char[]> heap_data_;
+  char* data_ = inline_data_;
+  size_t size_ = 0;
+  size_t capacity_ = InlineCapacity;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(InlineBuffer);
+};
+
+// ByteBufferWriter variant with |InlineCapacity| bytes of inline storage,
+// so that messages no longer than that serialize without heap allocation.
+// The optional constructor argument preallocates capacity for a computed
+// length that may exceed the inline capacity. Note that this class does
+// not derive from ByteBufferWriter and so cannot be passed to interfaces
+// taking one; it is for serialization paths that own the writer type.
+template <size_t InlineCapacity>
+class InlineByteBufferWriter
+    : public ByteBufferWriterT<InlineBuffer<InlineCapacity>> {
+ public:
+  InlineByteBufferWriter()
+      : ByteBufferWriterT<InlineBuffer<InlineCapacity>>(InlineCapacity) {}
+  explicit InlineByteBufferWriter(size_t capacity)
+      : ByteBufferWriterT<InlineBuffer<InlineCapacity>>(capacity) {}
+
+ private:
+  RTC_DISALLOW_COPY_AND_ASSIGN(InlineByteBufferWriter);
+};
+
 // The ByteBufferReader references the passed data, i.e. the pointer must be
 // valid during the lifetime of the reader.
 class ByteBufferReader {
@@ -12,6 +12,8 @@
 
 #include <string.h>
 
+#include <string>
+
 #include "rtc_base/arraysize.h"
 #include "rtc_base/byte_order.h"
 #include "test/gtest.h"
@@ -81,6 +83,57 @@ TEST(ByteBufferTest, TestBufferLength) {
   EXPECT_EQ(size, buffer.Length());
 }
 
+TEST(ByteBufferTest, TestExactCapacityConstructor) {
+  ByteBufferWriter buffer(123);
+  EXPECT_EQ(123u, buffer.Capacity());
+  EXPECT_EQ(0u, buffer.Length());
+}
+
+TEST(ByteBufferTest, TestInlineWriterStaysInlineWithinCapacity) {
+  InlineByteBufferWriter<64> buffer;
+  EXPECT_EQ(64u, buffer.Capacity());
+  const char* inline_data = buffer.Data();
+  for (int i = 0; i < 16; ++i) {
+    buffer.WriteUInt32(i);
+  }
+  // Writes within the inline capacity do not reallocate.
+  EXPECT_EQ(64u, buffer.Length());
+  EXPECT_EQ(64u, buffer.Capacity());
+  EXPECT_EQ(inline_data, buffer.Data());
+
+  ByteBufferReader reader(buffer.Data(), buffer.Length());
+  for (uint32_t i = 0; i < 16; ++i) {
+    uint32_t val;
+    EXPECT_TRUE(reader.ReadUInt32(&val));
+    EXPECT_EQ(i, val);
+  }
+}
+
+TEST(ByteBufferTest, TestInlineWriterSpillsToHeap) {
+  InlineByteBufferWriter<16> buffer;
+  std::string val;
+  for (char ch = 'A'; ch <= 'Z'; ++ch) {
+    val.push_back(ch);
+  }
+  buffer.WriteString(val);
+  EXPECT_EQ(val.size(), buffer.Length());
+  EXPECT_LE(val.size(), buffer.Capacity());
+
+  std::string read_val;
+  ByteBufferReader reader(buffer.Data(), buffer.Length());
+  EXPECT_TRUE(reader.ReadString(&read_val, val.size()));
+  EXPECT_EQ(val, read_val);
+
+  buffer.Clear();
+  EXPECT_EQ(0u, buffer.Length());
+}
+
+TEST(ByteBufferTest, TestInlineWriterPreallocatesComputedLength) {
+  InlineByteBufferWriter<16> buffer(100);
+  EXPECT_EQ(100u, buffer.Capacity());
+  EXPECT_EQ(0u, buffer.Length());
+}
+
 TEST(ByteBufferTest, TestReadWriteBuffer) {
   ByteBufferWriter buffer;
   ByteBufferReader read_buf(nullptr, 0);
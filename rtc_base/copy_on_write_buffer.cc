@@ -12,8 +12,117 @@
 
 #include <stddef.h>
 
+#include "rtc_base/critical_section.h"
+#include "rtc_base/thread_annotations.h"
+
 namespace rtc {
 
+namespace internal {
+namespace {
+
+// Only whole buffers in the common full-packet capacity class are kept
+// alive for reuse; everything smaller or larger goes back to the heap
+// (the control block still passes through its own free list).
+constexpr size_t kMinPooledPacketCapacity = 1200;
+constexpr size_t kMaxPooledPacketCapacity = 2048;
+constexpr size_t kMaxPooledPacketBuffers = 32;
+constexpr size_t kMaxPooledControlBlocks = 256;
+
+struct BufferPools {
+  CriticalSection lock;
+  RefCountedBuffer* packet_buffers[kMaxPooledPacketBuffers] RTC_GUARDED_BY(
+      lock);
+  size_t num_packet_buffers RTC_GUARDED_BY(lock) = 0;
+  void* control_blocks[kMaxPooledControlBlocks] RTC_GUARDED_BY(lock);
+  size_t num_control_blocks RTC_GUARDED_BY(lock) = 0;
+};
+
+BufferPools& GetBufferPools() {
+  // Deliberately leaked, so buffers released during shutdown can still be
+  // returned safely.
+  static BufferPools& pools = *new BufferPools();
+  return pools;
+}
+
+// Parks |buffer|, with its payload array, for reuse by TakePooledBuffer().
+// Returns false if the buffer is outside the pooled capacity class or the
+// pool is full; the caller then frees it the regular way.
+bool ReturnToPool(RefCountedBuffer* buffer) {
+  const size_t capacity = buffer->capacity();
+  if (capacity < kMinPooledPacketCapacity ||
+      capacity > kMaxPooledPacketCapacity) {
+    return false;
+  }
+  buffer->Clear();
+  BufferPools& pools = GetBufferPools();
+  CritScope cs(&pools.lock);
+  if (pools.num_packet_buffers == kMaxPooledPacketBuffers) {
+    return false;
+  }
+  pools.packet_buffers[pools.num_packet_buffers++] = buffer;
+  return true;
+}
+
+}  // namespace
+
+RefCountedBuffer* TakePooledBuffer(size_t capacity) {
+  if (capacity < kMinPooledPacketCapacity ||
+      capacity > kMaxPooledPacketCapacity) {
+    return nullptr;
+  }
+  BufferPools& pools = GetBufferPools();
+  CritScope cs(&pools.lock);
+  for (size_t i = 0; i < pools.num_packet_buffers; ++i) {
+    RefCountedBuffer* buffer = pools.packet_buffers[i];
+    // Reuse only exact capacity matches, so that a recycled buffer is
+    // indistinguishable from a freshly allocated one.
+    if (buffer->capacity() == capacity) {
+      pools.packet_buffers[i] =
+          pools.packet_buffers[--pools.num_packet_buffers];
+      return buffer;
+    }
+  }
+  return nullptr;
+}
+
+void* RefCountedBuffer::operator new(size_t size) {
+  RTC_DCHECK_EQ(size, sizeof(RefCountedBuffer));
+  BufferPools& pools = GetBufferPools();
+  {
+    CritScope cs(&pools.lock);
+    if (pools.num_control_blocks > 0) {
+      return pools.control_blocks[--pools.num_control_blocks];
+    }
+  }
+  return ::operator new(size);
+}
+
+void RefCountedBuffer::operator delete(void* ptr) {
+  BufferPools& pools = GetBufferPools();
+  {
+    CritScope cs(&pools.lock);
+    if (pools.num_control_blocks < kMaxPooledControlBlocks) {
+      pools.control_blocks[pools.num_control_blocks++] = ptr;
+      return;
+    }
+  }
+  ::operator delete(ptr);
+}
+
+RefCountReleaseStatus RefCountedBuffer::Release() const {
+  const auto status = ref_count_.DecRef();
+  if (status == RefCountReleaseStatus::kDroppedLastRef) {
+    // The pool takes over the non-const ownership that |delete this|
+    // would otherwise reclaim.
+    if (!ReturnToPool(const_cast<RefCountedBuffer*>(this))) {
+      delete this;
+    }
+  }
+  return status;
+}
+
+}  // namespace internal
+
 CopyOnWriteBuffer::CopyOnWriteBuffer() : offset_(0), size_(0) {
   RTC_DCHECK(IsConsistent());
 }
@@ -32,7 +141,7 @@ CopyOnWriteBuffer::CopyOnWriteBuffer(const std::string& s)
     : CopyOnWriteBuffer(s.data(), s.length()) {}
 
 CopyOnWriteBuffer::CopyOnWriteBuffer(size_t size)
-    : buffer_(size > 0 ? new RefCountedObject<Buffer>(size) : nullptr),
+    : buffer_(size > 0 ? internal::AllocateBuffer(size) : nullptr),
       offset_(0),
       size_(size) {
   RTC_DCHECK(IsConsistent());
@@ -40,7 +149,7 @@ CopyOnWriteBuffer::CopyOnWriteBuffer(size_t size)
 
 CopyOnWriteBuffer::CopyOnWriteBuffer(size_t size, size_t capacity)
     : buffer_(size > 0 || capacity > 0
-                  ? new RefCountedObject<Buffer>(size, capacity)
+                  ? internal::AllocateBuffer(size, capacity)
                   : nullptr),
       offset_(0),
       size_(size) {
@@ -61,7 +170,7 @@ void CopyOnWriteBuffer::SetSize(size_t size) {
   RTC_DCHECK(IsConsistent());
   if (!buffer_) {
     if (size > 0) {
-      buffer_ = new RefCountedObject<Buffer>(size);
+      buffer_ = internal::AllocateBuffer(size);
       offset_ = 0;
       size_ = size;
     }
@@ -84,7 +193,7 @@ void CopyOnWriteBuffer::EnsureCapacity(size_t new_capacity) {
   RTC_DCHECK(IsConsistent());
   if (!buffer_) {
     if (new_capacity > 0) {
-      buffer_ = new RefCountedObject<Buffer>(0, new_capacity);
+      buffer_ = internal::AllocateBuffer(0, new_capacity);
       offset_ = 0;
       size_ = 0;
     }
@@ -105,7 +214,7 @@ void CopyOnWriteBuffer::Clear() {
   if (buffer_->HasOneRef()) {
     buffer_->Clear();
   } else {
-    buffer_ = new RefCountedObject<Buffer>(0, capacity());
+    buffer_ = internal::AllocateBuffer(0, capacity());
   }
   offset_ = 0;
   size_ = 0;
@@ -117,8 +226,8 @@ void CopyOnWriteBuffer::UnshareAndEnsureCapacity(size_t new_capacity) {
     return;
   }
 
-  buffer_ = new RefCountedObject<Buffer>(buffer_->data() + offset_, size_,
-                                         new_capacity);
+  buffer_ = internal::AllocateBuffer(buffer_->data() + offset_, size_,
+                                     new_capacity);
   offset_ = 0;
   RTC_DCHECK(IsConsistent());
 }
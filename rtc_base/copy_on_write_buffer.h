@@ -27,6 +27,72 @@
 
 namespace rtc {
 
+namespace internal {
+
+// Reference counted rtc::Buffer whose allocations are recycled, since
+// nearly every packet in the system flows through CopyOnWriteBuffer:
+//  * The fixed-size object itself (the control block of every buffer,
+//    including tiny RTCP, STUN and DTMF payloads) comes from a free list
+//    through the class-level operator new/delete.
+//  * Buffers in the full-packet capacity class additionally keep their
+//    payload array and are handed out again by AllocateBuffer(), so
+//    clone-on-write of MTU sized packets stays off the heap allocator in
+//    steady state.
+// Both pools are bounded and shared between threads behind a lock.
+// Recycling is invisible to callers: a reused buffer reports exactly the
+// requested capacity, like a freshly allocated one.
+class RTC_EXPORT RefCountedBuffer final : public RefCountedObject<Buffer> {
+ public:
+  template <typename... Args>
+  explicit RefCountedBuffer(Args&&... args)
+      : RefCountedObject<Buffer>(std::forward<Args>(args)...) {}
+
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr);
+
+  RefCountReleaseStatus Release() const override;
+};
+
+// Takes a buffer with exactly the requested capacity out of the packet
+// buffer pool, or returns null if none is available.
+RTC_EXPORT RefCountedBuffer* TakePooledBuffer(size_t capacity);
+
+// The allocation functions below match the rtc::Buffer constructors they
+// forward to, but prefer recycling a pooled buffer over hitting the heap.
+inline RefCountedBuffer* AllocateBuffer(size_t size, size_t capacity) {
+  RefCountedBuffer* pooled = TakePooledBuffer(capacity);
+  if (pooled) {
+    pooled->SetSize(size);
+    return pooled;
+  }
+  return new RefCountedBuffer(size, capacity);
+}
+
+inline RefCountedBuffer* AllocateBuffer(size_t size) {
+  return AllocateBuffer(size, size);
+}
+
+template <typename T,
+          typename std::enable_if<BufferCompat<uint8_t, T>::value>::type* =
+              nullptr>
+RefCountedBuffer* AllocateBuffer(const T* data, size_t size, size_t capacity) {
+  RefCountedBuffer* pooled = TakePooledBuffer(capacity);
+  if (pooled) {
+    pooled->SetData(data, size);
+    return pooled;
+  }
+  return new RefCountedBuffer(data, size, capacity);
+}
+
+template <typename T,
+          typename std::enable_if<BufferCompat<uint8_t, T>::value>::type* =
+              nullptr>
+RefCountedBuffer* AllocateBuffer(const T* data, size_t size) {
+  return AllocateBuffer(data, size, size);
+}
+
+}  // namespace internal
+
 class RTC_EXPORT CopyOnWriteBuffer {
  public:
   // An empty buffer.
@@ -164,9 +230,9 @@ class RTC_EXPORT CopyOnWriteBuffer {
   void SetData(const T* data, size_t size) {
     RTC_DCHECK(IsConsistent());
     if (!buffer_) {
-      buffer_ = size > 0 ? new RefCountedObject<Buffer>(data, size) : nullptr;
+      buffer_ = size > 0 ? internal::AllocateBuffer(data, size) : nullptr;
     } else if (!buffer_->HasOneRef()) {
-      buffer_ = new RefCountedObject<Buffer>(data, size, capacity());
+      buffer_ = internal::AllocateBuffer(data, size, capacity());
     } else {
       buffer_->SetData(data, size);
     }
@@ -201,7 +267,7 @@ class RTC_EXPORT CopyOnWriteBuffer {
   void AppendData(const T* data, size_t size) {
     RTC_DCHECK(IsConsistent());
     if (!buffer_) {
-      buffer_ = new RefCountedObject<Buffer>(data, size);
+      buffer_ = internal::AllocateBuffer(data, size);
       offset_ = 0;
       size_ = size;
       RTC_DCHECK(IsConsistent());
@@ -365,4 +365,20 @@ TEST(CopyOnWriteBufferTest, SlicesAreIndependent) {
   EXPECT_EQ(buf.cdata() + 3, slice.cdata());
 }
 
+TEST(CopyOnWriteBufferTest, RecycledBufferReportsRequestedCapacity) {
+  // Full-packet buffers are recycled through a pool; a reused buffer must
+  // be indistinguishable from a freshly allocated one.
+  { CopyOnWriteBuffer buf(1500); }
+  CopyOnWriteBuffer buf(kTestData, 16, 1500);
+  EXPECT_EQ(16u, buf.size());
+  EXPECT_EQ(1500u, buf.capacity());
+  EXPECT_EQ(0, memcmp(buf.cdata(), kTestData, 16));
+}
+
+TEST(CopyOnWriteBufferTest, RecycledBufferRequiresExactCapacityMatch) {
+  { CopyOnWriteBuffer buf(1504); }
+  CopyOnWriteBuffer buf(1500);
+  EXPECT_EQ(1500u, buf.capacity());
+}
+
 }  // namespace rtc
@@ -41,6 +41,7 @@ static const int kMaxLogLineSize = 1024 - 60;
 #include <vector>
 
 #include "absl/base/attributes.h"
+#include "rtc_base/atomic_ops.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/critical_section.h"
 #include "rtc_base/platform_thread_types.h"
@@ -52,14 +53,20 @@ static const int kMaxLogLineSize = 1024 - 60;
 
 namespace rtc {
 namespace {
-// By default, release builds don't log, debug builds at info level
+// By default, release builds don't log, debug builds at info level.
+// The severity thresholds are read with atomic ops on the fast path of
+// every log statement, so that filtered messages never touch a lock; they
+// are written under |g_log_crit| whenever the configuration changes.
 #if !defined(NDEBUG)
-static LoggingSeverity g_min_sev = LS_INFO;
-static LoggingSeverity g_dbg_sev = LS_INFO;
+static volatile int g_min_sev = LS_INFO;
+static volatile int g_dbg_sev = LS_INFO;
 #else
-static LoggingSeverity g_min_sev = LS_NONE;
-static LoggingSeverity g_dbg_sev = LS_NONE;
+static volatile int g_min_sev = LS_NONE;
+static volatile int g_dbg_sev = LS_NONE;
 #endif
+// Minimum severity over the registered sinks only (LS_NONE when there are
+// none), so the common sink-less case can skip |g_log_crit| entirely.
+static volatile int g_streams_min_sev = LS_NONE;
 
 // Return the filename portion of the string (that following the last slash).
 const char* FilenameFromPath(const char* file) {
@@ -185,7 +192,7 @@ LogMessage::~LogMessage() {
 
   const std::string str = print_stream_.Release();
 
-  if (severity_ >= g_dbg_sev) {
+  if (severity_ >= AtomicOps::AcquireLoad(&g_dbg_sev)) {
 #if defined(WEBRTC_ANDROID)
     OutputToDebug(str, severity_, tag_);
 #else
@@ -193,6 +200,12 @@ LogMessage::~LogMessage() {
 #endif
   }
 
+  // Don't touch the global lock unless some sink actually wants the
+  // message; with no (or filtered) sinks this keeps concurrent threads
+  // from serializing on |g_log_crit|.
+  if (severity_ < AtomicOps::AcquireLoad(&g_streams_min_sev))
+    return;
+
   CritScope cs(&g_log_crit);
   for (LogSink* entry = streams_; entry != nullptr; entry = entry->next_) {
     if (severity_ >= entry->min_severity_) {
@@ -216,11 +229,11 @@ rtc::StringBuilder& LogMessage::stream() {
 }
 
 int LogMessage::GetMinLogSeverity() {
-  return g_min_sev;
+  return AtomicOps::AcquireLoad(&g_min_sev);
 }
 
 LoggingSeverity LogMessage::GetLogToDebug() {
-  return g_dbg_sev;
+  return static_cast<LoggingSeverity>(AtomicOps::AcquireLoad(&g_dbg_sev));
 }
 int64_t LogMessage::LogStartTime() {
   static const int64_t g_start = SystemTimeMillis();
@@ -241,7 +254,7 @@ void LogMessage::LogTimestamps(bool on) {
 }
 
 void LogMessage::LogToDebug(LoggingSeverity min_sev) {
-  g_dbg_sev = min_sev;
+  AtomicOps::ReleaseStore(&g_dbg_sev, min_sev);
   CritScope cs(&g_log_crit);
   UpdateMinLogSeverity();
 }
@@ -332,11 +345,14 @@ void LogMessage::ConfigureLogging(const char* params) {
 
 void LogMessage::UpdateMinLogSeverity()
     RTC_EXCLUSIVE_LOCKS_REQUIRED(g_log_crit) {
-  LoggingSeverity min_sev = g_dbg_sev;
+  int streams_min_sev = LS_NONE;
   for (LogSink* entry = streams_; entry != nullptr; entry = entry->next_) {
-    min_sev = std::min(min_sev, entry->min_severity_);
+    streams_min_sev = std::min<int>(streams_min_sev, entry->min_severity_);
   }
-  g_min_sev = min_sev;
+  AtomicOps::ReleaseStore(&g_streams_min_sev, streams_min_sev);
+  AtomicOps::ReleaseStore(
+      &g_min_sev,
+      std::min(AtomicOps::AcquireLoad(&g_dbg_sev), streams_min_sev));
 }
 
 #if defined(WEBRTC_ANDROID)
@@ -433,14 +449,11 @@ void LogMessage::OutputToDebug(const std::string& str,
 
 // static
 bool LogMessage::IsNoop(LoggingSeverity severity) {
-  if (severity >= g_dbg_sev || severity >= g_min_sev)
-    return false;
-
-  // TODO(tommi): We're grabbing this lock for every LogMessage instance that
-  // is going to be logged. This introduces unnecessary synchronization for
-  // a feature that's mostly used for testing.
-  CritScope cs(&g_log_crit);
-  return streams_ == nullptr;
+  // |g_min_sev| already folds in the minimum severity of the registered
+  // sinks (see UpdateMinLogSeverity), so a single atomic load suffices and
+  // filtered messages stay away from |g_log_crit|. This runs inline in
+  // every RTC_LOG statement before any argument is evaluated.
+  return severity < AtomicOps::AcquireLoad(&g_min_sev);
 }
 
 void LogMessage::FinishPrintStream() {
@@ -476,10 +476,10 @@ class LogMessage {
   // Parses the provided parameter stream to configure the options above.
   // Useful for configuring logging from the command line.
   static void ConfigureLogging(const char* params);
-  // Checks the current global debug severity and if the |streams_| collection
-  // is empty. If |severity| is smaller than the global severity and if the
-  // |streams_| collection is empty, the LogMessage will be considered a noop
-  // LogMessage.
+  // Returns true when no output (debug or registered sink) wants messages
+  // of the given |severity|, i.e. the LogMessage would be a noop. This is a
+  // single atomic load and is checked inline by the RTC_LOG macros before
+  // any of their arguments are evaluated.
   static bool IsNoop(LoggingSeverity severity);
 #else
   // Next methods do nothing; no one will call these functions.
@@ -586,8 +586,11 @@ class LogMessage {
 // Logging Helpers
 //////////////////////////////////////////////////////////////////////
 
+// The severity is checked before the streamer is constructed, so when a
+// message is filtered neither the macro arguments nor the formatting code
+// run; a disabled log statement costs one atomic load.
 #define RTC_LOG_FILE_LINE(sev, file, line)            \
-  RTC_LOG_ENABLED() &&                                \
+  RTC_LOG_ENABLED() && !::rtc::LogMessage::IsNoop(sev) && \
       ::rtc::webrtc_logging_impl::LogCall() &         \
           ::rtc::webrtc_logging_impl::LogStreamer<>() \
               << ::rtc::webrtc_logging_impl::LogMetadata(file, line, sev)
@@ -615,7 +618,8 @@ inline bool LogCheckLevel(LoggingSeverity sev) {
 }
 
 #define RTC_LOG_E(sev, ctx, err)                                               \
-  RTC_LOG_ENABLED() && ::rtc::webrtc_logging_impl::LogCall() &                 \
+  RTC_LOG_ENABLED() && !::rtc::LogMessage::IsNoop(::rtc::sev) &&               \
+                           ::rtc::webrtc_logging_impl::LogCall() &             \
                            ::rtc::webrtc_logging_impl::LogStreamer<>()         \
                                << ::rtc::webrtc_logging_impl::LogMetadataErr { \
     {__FILE__, __LINE__, ::rtc::sev}, ::rtc::ERRCTX_##ctx, (err)               \
@@ -652,7 +656,8 @@ inline const char* AdaptString(const std::string& str) {
 }  // namespace webrtc_logging_impl
 
 #define RTC_LOG_TAG(sev, tag)                                                  \
-  RTC_LOG_ENABLED() && ::rtc::webrtc_logging_impl::LogCall() &                 \
+  RTC_LOG_ENABLED() && !::rtc::LogMessage::IsNoop(sev) &&                      \
+                           ::rtc::webrtc_logging_impl::LogCall() &             \
                            ::rtc::webrtc_logging_impl::LogStreamer<>()         \
                                << ::rtc::webrtc_logging_impl::LogMetadataTag { \
     sev, ::rtc::webrtc_logging_impl::AdaptString(tag)                          \
@@ -0,0 +1,182 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/netlink_network_monitor.h"
+
+#include <errno.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "rtc_base/checks.h"
+#include "rtc_base/logging.h"
+
+namespace rtc {
+
+namespace {
+
+// Large enough for a full burst of link/address messages; the kernel
+// reports ENOBUFS if its queue overflows anyway, which we treat as a
+// change.
+constexpr size_t kNetlinkReadBufferSize = 4096;
+
+bool IsNetworkChangeMessage(uint16_t nlmsg_type) {
+  switch (nlmsg_type) {
+    case RTM_NEWLINK:
+    case RTM_DELLINK:
+    case RTM_NEWADDR:
+    case RTM_DELADDR:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+NetlinkNetworkMonitor::NetlinkNetworkMonitor() = default;
+
+NetlinkNetworkMonitor::~NetlinkNetworkMonitor() {
+  Stop();
+}
+
+void NetlinkNetworkMonitor::Start() {
+  if (thread_) {
+    return;
+  }
+
+  netlink_fd_ = ::socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+  if (netlink_fd_ < 0) {
+    RTC_LOG_ERR(LS_WARNING) << "Failed to open rtnetlink socket";
+    return;
+  }
+
+  struct sockaddr_nl addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.nl_family = AF_NETLINK;
+  addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+  if (::bind(netlink_fd_, reinterpret_cast<struct sockaddr*>(&addr),
+             sizeof(addr)) < 0) {
+    RTC_LOG_ERR(LS_WARNING) << "Failed to bind rtnetlink socket";
+    CloseSockets();
+    return;
+  }
+
+  if (::pipe(wakeup_pipe_) < 0) {
+    RTC_LOG_ERR(LS_WARNING) << "Failed to create netlink wakeup pipe";
+    CloseSockets();
+    return;
+  }
+
+  thread_.reset(new PlatformThread(&NetlinkNetworkMonitor::MonitorThreadRun,
+                                   this, "NetlinkMonitor"));
+  thread_->Start();
+}
+
+void NetlinkNetworkMonitor::Stop() {
+  if (!thread_) {
+    return;
+  }
+  // Unblock the monitor thread's poll() and join it before closing the
+  // descriptors it reads from.
+  char signal_byte = 0;
+  RTC_DCHECK(wakeup_pipe_[1] != -1);
+  if (::write(wakeup_pipe_[1], &signal_byte, 1) < 0) {
+    RTC_LOG_ERR(LS_ERROR) << "Failed to signal netlink monitor thread";
+  }
+  thread_->Stop();
+  thread_.reset();
+  CloseSockets();
+}
+
+AdapterType NetlinkNetworkMonitor::GetAdapterType(
+    const std::string& interface_name) {
+  return ADAPTER_TYPE_UNKNOWN;
+}
+
+void NetlinkNetworkMonitor::MonitorThreadRun(void* obj) {
+  static_cast<NetlinkNetworkMonitor*>(obj)->MonitorThread();
+}
+
+void NetlinkNetworkMonitor::MonitorThread() {
+  while (true) {
+    struct pollfd fds[] = {{netlink_fd_, POLLIN, 0},
+                           {wakeup_pipe_[0], POLLIN, 0}};
+    if (::poll(fds, 2, -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      RTC_LOG_ERR(LS_ERROR) << "poll() on rtnetlink socket failed";
+      return;
+    }
+    if (fds[1].revents != 0) {
+      // Stop() was called.
+      return;
+    }
+    if ((fds[0].revents & POLLIN) == 0) {
+      continue;
+    }
+
+    // Drain everything already queued so that one burst of kernel messages
+    // (e.g. an interface coming up with several addresses) produces a
+    // single update.
+    bool changed = false;
+    while (true) {
+      alignas(struct nlmsghdr) char buffer[kNetlinkReadBufferSize];
+      ssize_t bytes = ::recv(netlink_fd_, buffer, sizeof(buffer),
+                             MSG_DONTWAIT);
+      if (bytes < 0) {
+        if (errno == ENOBUFS) {
+          // The kernel dropped notifications; the full enumeration
+          // triggered below resynchronizes the network list.
+          changed = true;
+          continue;
+        }
+        break;
+      }
+      size_t length = static_cast<size_t>(bytes);
+      size_t offset = 0;
+      while (offset + sizeof(struct nlmsghdr) <= length) {
+        const struct nlmsghdr* header =
+            reinterpret_cast<const struct nlmsghdr*>(buffer + offset);
+        if (header->nlmsg_len < sizeof(struct nlmsghdr) ||
+            header->nlmsg_len > length - offset) {
+          break;
+        }
+        if (IsNetworkChangeMessage(header->nlmsg_type)) {
+          changed = true;
+        }
+        offset += NLMSG_ALIGN(header->nlmsg_len);
+      }
+    }
+    if (changed) {
+      // The base class forwards this to the worker thread.
+      OnNetworksChanged();
+    }
+  }
+}
+
+void NetlinkNetworkMonitor::CloseSockets() {
+  if (netlink_fd_ != -1) {
+    ::close(netlink_fd_);
+    netlink_fd_ = -1;
+  }
+  for (int& fd : wakeup_pipe_) {
+    if (fd != -1) {
+      ::close(fd);
+      fd = -1;
+    }
+  }
+}
+
+}  // namespace rtc
@@ -0,0 +1,61 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_NETLINK_NETWORK_MONITOR_H_
+#define RTC_BASE_NETLINK_NETWORK_MONITOR_H_
+
+#include <memory>
+#include <string>
+
+#include "rtc_base/network_monitor.h"
+#include "rtc_base/platform_thread.h"
+
+namespace rtc {
+
+// Network monitor that subscribes to interface and address change
+// notifications from the kernel over an rtnetlink socket (RTMGRP_LINK and
+// the IPv4/IPv6 address groups). A burst of kernel messages is coalesced
+// into a single OnNetworksChanged() call; the actual interface list is
+// still produced by BasicNetworkManager's getifaddrs() enumeration, which
+// this monitor merely triggers, so MergeNetworkList() applies the deltas.
+// This makes network updates event-driven on Linux hosts with many
+// interfaces instead of relying on the fixed two-second polling cycle.
+class NetlinkNetworkMonitor : public NetworkMonitorBase {
+ public:
+  NetlinkNetworkMonitor();
+  ~NetlinkNetworkMonitor() override;
+
+  void Start() override;
+  void Stop() override;
+
+  // Returns true while the monitor thread is listening on the netlink
+  // socket. When the socket could not be opened (e.g. in a sandbox that
+  // disallows AF_NETLINK), callers should keep polling at the regular
+  // cadence.
+  bool IsActive() const { return thread_ != nullptr; }
+
+  // The kernel notifications carry no adapter type information; returning
+  // unknown makes BasicNetworkManager fall back to its name matching rules.
+  AdapterType GetAdapterType(const std::string& interface_name) override;
+
+ private:
+  static void MonitorThreadRun(void* obj);
+  void MonitorThread();
+  void CloseSockets();
+
+  int netlink_fd_ = -1;
+  // Written by Stop() to unblock the monitor thread's poll().
+  int wakeup_pipe_[2] = {-1, -1};
+  std::unique_ptr<PlatformThread> thread_;
+};
+
+}  // namespace rtc
+
+#endif  // RTC_BASE_NETLINK_NETWORK_MONITOR_H_
@@ -30,6 +30,9 @@
 #include "rtc_base/checks.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/network_monitor.h"
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+#include "rtc_base/netlink_network_monitor.h"
+#endif
 #include "rtc_base/socket.h"  // includes something that makes windows happy
 #include "rtc_base/string_encode.h"
 #include "rtc_base/string_utils.h"
@@ -46,6 +49,12 @@ const uint32_t kSignalNetworksMessage = 2;
 // Fetch list of networks every two seconds.
 const int kNetworksUpdateIntervalMs = 2000;
 
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+// When a netlink monitor delivers kernel change notifications, the
+// periodic enumeration is only a safety net and can run far less often.
+const int kNetworksUpdateFallbackIntervalMs = 30000;
+#endif
+
 const int kHighestNetworkPreference = 127;
 
 typedef struct {
@@ -828,6 +837,18 @@ void BasicNetworkManager::StopUpdating() {
 void BasicNetworkManager::StartNetworkMonitor() {
   NetworkMonitorFactory* factory = NetworkMonitorFactory::GetFactory();
   if (factory == nullptr) {
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+    // Without a platform factory, fall back to the rtnetlink monitor so
+    // that network changes are picked up from kernel notifications rather
+    // than only by the periodic enumeration.
+    if (!network_monitor_) {
+      netlink_monitor_ = new NetlinkNetworkMonitor();
+      network_monitor_.reset(netlink_monitor_);
+      network_monitor_->SignalNetworksChanged.connect(
+          this, &BasicNetworkManager::OnNetworksChanged);
+    }
+    network_monitor_->Start();
+#endif
     return;
   }
   if (!network_monitor_) {
@@ -913,7 +934,13 @@ void BasicNetworkManager::UpdateNetworksOnce() {
 
 void BasicNetworkManager::UpdateNetworksContinually() {
   UpdateNetworksOnce();
-  thread_->PostDelayed(RTC_FROM_HERE, kNetworksUpdateIntervalMs, this,
+  int interval_ms = kNetworksUpdateIntervalMs;
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+  if (netlink_monitor_ && netlink_monitor_->IsActive()) {
+    interval_ms = kNetworksUpdateFallbackIntervalMs;
+  }
+#endif
+  thread_->PostDelayed(RTC_FROM_HERE, interval_ms, this,
                        kUpdateNetworksMessage);
 }
 
@@ -36,6 +36,7 @@ extern const char kPublicIPv4Host[];
 extern const char kPublicIPv6Host[];
 
 class IfAddrsConverter;
+class NetlinkNetworkMonitor;
 class Network;
 class NetworkMonitorInterface;
 class Thread;
@@ -279,6 +280,11 @@ class RTC_EXPORT BasicNetworkManager : public NetworkManagerBase,
   int start_count_;
   std::vector<std::string> network_ignore_list_;
   std::unique_ptr<NetworkMonitorInterface> network_monitor_;
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+  // Points into |network_monitor_| when the fallback rtnetlink monitor is
+  // in use; null when a platform factory provided the monitor.
+  NetlinkNetworkMonitor* netlink_monitor_ = nullptr;
+#endif
 };
 
 // Represents a Unix-type network interface, with a name and single address.
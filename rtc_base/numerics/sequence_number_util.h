@@ -84,6 +84,9 @@ struct DescendingSeqNumComp {
 
 // A sequence number unwrapper where the first unwrapped value equals the
 // first value being unwrapped.
+// See also Unwrapper in modules/include/module_common_types_public.h, which
+// never unwraps to a negative value and supports peeking without updating
+// state. Prefer one of the two over re-implementing unwrapping.
 template <typename T, T M = 0>
 class SeqNumUnwrapper {
   static_assert(
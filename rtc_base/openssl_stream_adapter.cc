@@ -21,11 +21,13 @@
 #include <openssl/ssl.h>
 #endif
 
+#include <deque>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "rtc_base/checks.h"
+#include "rtc_base/critical_section.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/numerics/safe_conversions.h"
 #include "rtc_base/openssl.h"
@@ -261,6 +263,77 @@ static long stream_ctrl(BIO* b, int cmd, long num, void* ptr) {
   }
 }
 
+/////////////////////////////////////////////////////////////////////////////
+// BufferedWriteProxy
+/////////////////////////////////////////////////////////////////////////////
+
+// Stands between the SSL BIO and the wrapped stream when the handshake is
+// offloaded. Reads pass straight through, which requires the wrapped stream
+// to allow reads from the offload thread. While a handshake step is running,
+// writes are queued here instead of touching the wrapped stream, and are
+// flushed from the owner thread when the step completes. Each queued write
+// is replayed as one Write call, preserving DTLS packet boundaries.
+class OpenSSLStreamAdapter::BufferedWriteProxy : public StreamInterface {
+ public:
+  explicit BufferedWriteProxy(StreamInterface* target) : target_(target) {}
+
+  StreamState GetState() const override { return target_->GetState(); }
+
+  StreamResult Read(void* buffer,
+                    size_t buffer_len,
+                    size_t* read,
+                    int* error) override {
+    return target_->Read(buffer, buffer_len, read, error);
+  }
+
+  StreamResult Write(const void* data,
+                     size_t data_len,
+                     size_t* written,
+                     int* error) override {
+    {
+      CritScope cs(&crit_);
+      if (buffering_) {
+        packets_.push_back(Buffer(static_cast<const uint8_t*>(data), data_len));
+        if (written) {
+          *written = data_len;
+        }
+        return SR_SUCCESS;
+      }
+    }
+    return target_->Write(data, data_len, written, error);
+  }
+
+  void Close() override { target_->Close(); }
+
+  void SetBuffering(bool buffering) {
+    CritScope cs(&crit_);
+    buffering_ = buffering;
+  }
+
+  // Replays the queued writes to the wrapped stream; must be called on the
+  // thread that owns it. Writes that the stream cannot take yet stay queued
+  // until the next flush.
+  void FlushQueuedWrites() {
+    CritScope cs(&crit_);
+    while (!packets_.empty()) {
+      const Buffer& packet = packets_.front();
+      size_t written;
+      int error;
+      if (target_->Write(packet.data(), packet.size(), &written, &error) ==
+          SR_BLOCK) {
+        return;
+      }
+      packets_.pop_front();
+    }
+  }
+
+ private:
+  StreamInterface* const target_;
+  CriticalSection crit_;
+  bool buffering_ RTC_GUARDED_BY(crit_) = false;
+  std::deque<Buffer> packets_ RTC_GUARDED_BY(crit_);
+};
+
 /////////////////////////////////////////////////////////////////////////////
 // OpenSSLStreamAdapter
 /////////////////////////////////////////////////////////////////////////////
@@ -522,6 +595,11 @@ void OpenSSLStreamAdapter::SetInitialRetransmissionTimeout(int timeout_ms) {
   dtls_handshake_timeout_ms_ = timeout_ms;
 }
 
+void OpenSSLStreamAdapter::SetHandshakeOffloadThread(Thread* thread) {
+  RTC_DCHECK(state_ == SSL_NONE);
+  handshake_offload_thread_ = thread;
+}
+
 //
 // StreamInterface Implementation
 //
@@ -733,6 +811,20 @@ void OpenSSLStreamAdapter::OnEvent(StreamInterface* stream,
   int signal_error = 0;
   RTC_DCHECK(stream == this->stream());
 
+  if (owner_thread_ && !owner_thread_->IsCurrent()) {
+    // With the handshake offloaded, the wrapped stream may signal events on
+    // other threads; marshal them back to the owner thread.
+    owner_thread_->Post(
+        RTC_FROM_HERE, this, MSG_STREAM_EVENT,
+        new TypedMessageData<std::pair<int, int>>(std::make_pair(events, err)));
+    return;
+  }
+  if (handshake_write_proxy_ && (events & SE_WRITE)) {
+    // Flush handshake packets that were left queued because the stream could
+    // not take them earlier.
+    handshake_write_proxy_->FlushQueuedWrites();
+  }
+
   if ((events & SE_OPEN)) {
     RTC_LOG(LS_VERBOSE) << "OpenSSLStreamAdapter::OnEvent SE_OPEN";
     if (state_ != SSL_WAIT) {
@@ -801,7 +893,21 @@ int OpenSSLStreamAdapter::BeginSSL() {
     return -1;
   }
 
-  bio = BIO_new_stream(static_cast<StreamInterface*>(stream()));
+  if (handshake_offload_thread_ && ssl_mode_ != SSL_MODE_DTLS) {
+    RTC_LOG(LS_WARNING) << "Handshake offload is only supported in DTLS mode.";
+    handshake_offload_thread_ = nullptr;
+  }
+  if (handshake_offload_thread_) {
+    // Handshake steps run on the offload thread, but handshake packets must
+    // only be sent from this thread; route the SSL writes through a proxy
+    // that queues them while a step is in flight.
+    owner_thread_ = Thread::Current();
+    handshake_write_proxy_.reset(
+        new BufferedWriteProxy(static_cast<StreamInterface*>(stream())));
+    bio = BIO_new_stream(handshake_write_proxy_.get());
+  } else {
+    bio = BIO_new_stream(static_cast<StreamInterface*>(stream()));
+  }
   if (!bio) {
     return -1;
   }
@@ -839,9 +945,31 @@ int OpenSSLStreamAdapter::ContinueSSL() {
   // Clear the DTLS timer
   Thread::Current()->Clear(this, MSG_TIMEOUT);
 
+  if (handshake_offload_thread_) {
+    if (handshake_step_pending_) {
+      // A step is already running on the offload thread. Run another one
+      // when it completes, so that the data that triggered this call gets
+      // processed.
+      handshake_retry_needed_ = true;
+      return 0;
+    }
+    handshake_step_pending_ = true;
+    handshake_write_proxy_->SetBuffering(true);
+    handshake_offload_thread_->PostTask(RTC_FROM_HERE, [this] {
+      const int code =
+          (role_ == SSL_CLIENT) ? SSL_connect(ssl_) : SSL_accept(ssl_);
+      handshake_step_code_ = code;
+      handshake_step_ssl_error_ = SSL_get_error(ssl_, code);
+      owner_thread_->Post(RTC_FROM_HERE, this, MSG_HANDSHAKE_STEP_DONE);
+    });
+    return 0;
+  }
+
   const int code = (role_ == SSL_CLIENT) ? SSL_connect(ssl_) : SSL_accept(ssl_);
-  const int ssl_error = SSL_get_error(ssl_, code);
+  return ProcessHandshakeStepResult(code, SSL_get_error(ssl_, code));
+}
 
+int OpenSSLStreamAdapter::ProcessHandshakeStepResult(int code, int ssl_error) {
   switch (ssl_error) {
     case SSL_ERROR_NONE:
       RTC_LOG(LS_VERBOSE) << " -- success";
@@ -894,6 +1022,38 @@ int OpenSSLStreamAdapter::ContinueSSL() {
   return 0;
 }
 
+void OpenSSLStreamAdapter::OnHandshakeStepDone() {
+  RTC_DCHECK(owner_thread_->IsCurrent());
+  RTC_DCHECK(handshake_step_pending_);
+  handshake_step_pending_ = false;
+  const bool retry = handshake_retry_needed_;
+  handshake_retry_needed_ = false;
+
+  // Send the handshake packets that the step produced, now that we are back
+  // on the owner thread.
+  handshake_write_proxy_->SetBuffering(false);
+  handshake_write_proxy_->FlushQueuedWrites();
+
+  if (state_ != SSL_CONNECTING) {
+    // The stream was closed while the step was in flight.
+    return;
+  }
+
+  const int ssl_error = handshake_step_ssl_error_;
+  if (int err = ProcessHandshakeStepResult(handshake_step_code_, ssl_error)) {
+    Error("ContinueSSL", err, 0, true);
+    return;
+  }
+  if (retry && state_ == SSL_CONNECTING &&
+      (ssl_error == SSL_ERROR_WANT_READ || ssl_error == SSL_ERROR_WANT_WRITE)) {
+    // More data arrived while the step was running; run another step to
+    // process it.
+    if (int err = ContinueSSL()) {
+      Error("ContinueSSL", err, 0, true);
+    }
+  }
+}
+
 void OpenSSLStreamAdapter::Error(const char* context,
                                  int err,
                                  uint8_t alert,
@@ -911,6 +1071,17 @@ void OpenSSLStreamAdapter::Error(const char* context,
 void OpenSSLStreamAdapter::Cleanup(uint8_t alert) {
   RTC_LOG(LS_INFO) << "Cleanup";
 
+  if (handshake_step_pending_) {
+    // A handshake step may still be running on the offload thread; wait for
+    // it to finish before tearing down the SSL object it is using.
+    handshake_offload_thread_->Invoke<void>(RTC_FROM_HERE, [] {});
+    handshake_step_pending_ = false;
+  }
+  if (owner_thread_) {
+    owner_thread_->Clear(this, MSG_HANDSHAKE_STEP_DONE);
+    owner_thread_->Clear(this, MSG_STREAM_EVENT);
+  }
+
   if (state_ != SSL_ERROR) {
     state_ = SSL_CLOSED;
     ssl_error_code_ = 0;
@@ -954,8 +1125,21 @@ void OpenSSLStreamAdapter::OnMessage(Message* msg) {
   // Process our own messages and then pass others to the superclass
   if (MSG_TIMEOUT == msg->message_id) {
     RTC_LOG(LS_INFO) << "DTLS timeout expired";
+    if (handshake_step_pending_) {
+      // The SSL object is in use on the offload thread; handle the timeout
+      // when the step completes.
+      handshake_retry_needed_ = true;
+      return;
+    }
     DTLSv1_handle_timeout(ssl_);
     ContinueSSL();
+  } else if (MSG_HANDSHAKE_STEP_DONE == msg->message_id) {
+    OnHandshakeStepDone();
+  } else if (MSG_STREAM_EVENT == msg->message_id) {
+    TypedMessageData<std::pair<int, int>>* data =
+        static_cast<TypedMessageData<std::pair<int, int>>*>(msg->pdata);
+    OnEvent(stream(), data->data().first, data->data().second);
+    delete data;
   } else {
     StreamInterface::OnMessage(msg);
   }
@@ -79,6 +79,7 @@ class OpenSSLStreamAdapter final : public SSLStreamAdapter {
   void SetMode(SSLMode mode) override;
   void SetMaxProtocolVersion(SSLProtocolVersion version) override;
   void SetInitialRetransmissionTimeout(int timeout_ms) override;
+  void SetHandshakeOffloadThread(Thread* thread) override;
 
   StreamResult Read(void* data,
                     size_t data_len,
@@ -137,7 +138,12 @@ class OpenSSLStreamAdapter final : public SSLStreamAdapter {
     SSL_CLOSED       // Clean close
   };
 
-  enum { MSG_TIMEOUT = MSG_MAX + 1 };
+  enum { MSG_TIMEOUT = MSG_MAX + 1, MSG_HANDSHAKE_STEP_DONE, MSG_STREAM_EVENT };
+
+  // Buffers SSL writes while a handshake step runs on the offload thread, so
+  // that packets are only sent from the owner thread. Defined in the .cc
+  // file.
+  class BufferedWriteProxy;
 
   // The following three methods return 0 on success and a negative
   // error code on failure. The error code may be from OpenSSL or -1
@@ -148,6 +154,12 @@ class OpenSSLStreamAdapter final : public SSLStreamAdapter {
   int BeginSSL();
   // Perform SSL negotiation steps.
   int ContinueSSL();
+  // Handle the outcome of one SSL_connect/SSL_accept call: transition state,
+  // arm the DTLS retransmission timer, or report the handshake error.
+  int ProcessHandshakeStepResult(int code, int ssl_error);
+  // Called on the owner thread when a handshake step that was offloaded with
+  // SetHandshakeOffloadThread has finished.
+  void OnHandshakeStepDone();
 
   // Error handler helper. signal is given as true for errors in
   // asynchronous contexts (when an error method was not returned
@@ -218,6 +230,22 @@ class OpenSSLStreamAdapter final : public SSLStreamAdapter {
   // be too aggressive for low bandwidth links.
   int dtls_handshake_timeout_ms_ = 50;
 
+  // Thread that runs the CPU-heavy handshake steps, or null to run them
+  // inline. See SetHandshakeOffloadThread.
+  Thread* handshake_offload_thread_ = nullptr;
+  // The thread that drives this stream; set when the offloaded handshake
+  // begins, and null when offload is not in use.
+  Thread* owner_thread_ = nullptr;
+  std::unique_ptr<BufferedWriteProxy> handshake_write_proxy_;
+  // True while a handshake step is running on the offload thread.
+  bool handshake_step_pending_ = false;
+  // True if data arrived while a step was in flight, so that another step
+  // must be run when it completes.
+  bool handshake_retry_needed_ = false;
+  // Result of the last offloaded handshake step.
+  int handshake_step_code_ = 0;
+  int handshake_step_ssl_error_ = 0;
+
   // TODO(https://bugs.webrtc.org/10261): Completely remove this option in M84.
   const bool support_legacy_tls_protocols_flag_;
 };
@@ -42,6 +42,7 @@
 #include <algorithm>
 #include <map>
 
+#include "absl/types/optional.h"
 #include "rtc_base/arraysize.h"
 #include "rtc_base/byte_order.h"
 #include "rtc_base/checks.h"
@@ -51,7 +52,17 @@
 #include "rtc_base/time_utils.h"
 
 #if defined(WEBRTC_LINUX)
+#include <linux/net_tstamp.h>  // for struct sock_txtime
 #include <linux/sockios.h>
+#include <netinet/udp.h>
+// UDP GSO appeared in Linux 4.18; define the constants when building against
+// older kernel headers so the runtime probe in SendToBatch() still works.
+#if !defined(UDP_SEGMENT)
+#define UDP_SEGMENT 103
+#endif
+#if !defined(SOL_UDP)
+#define SOL_UDP 17
+#endif
 #endif
 
 #if defined(WEBRTC_WIN)
@@ -89,6 +100,25 @@ int64_t GetSocketRecvTimestamp(int socket) {
 }
 #endif
 
+#if defined(WEBRTC_LINUX) && defined(SO_TIMESTAMPNS)
+// Returns the SCM_TIMESTAMPNS kernel arrival time attached to a received
+// message, in microseconds since the epoch (the same clock as SIOCGSTAMP),
+// or -1 if the control message is not present. Unlike the SIOCGSTAMP ioctl,
+// this costs no extra syscall and is exact per packet in a batched receive.
+int64_t GetTimestampFromCmsgs(msghdr* msg) {
+  for (cmsghdr* cmsg = CMSG_FIRSTHDR(msg); cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(msg, cmsg)) {
+    if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+      struct timespec ts;
+      memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+      return rtc::kNumMicrosecsPerSec * static_cast<int64_t>(ts.tv_sec) +
+             ts.tv_nsec / 1000;
+    }
+  }
+  return -1;
+}
+#endif
+
 #if defined(WEBRTC_WIN)
 typedef char* SockOptArg;
 #endif
@@ -143,6 +173,14 @@ bool PhysicalSocket::Create(int family, int type) {
   UpdateLastError();
   if (udp_) {
     SetEnabledEvents(DE_READ | DE_WRITE);
+#if defined(WEBRTC_LINUX) && defined(SO_TIMESTAMPNS)
+    // Have the kernel attach the arrival time to each datagram, so that
+    // receives do not need a SIOCGSTAMP ioctl per packet.
+    int enable = 1;
+    timestampns_enabled_ =
+        ::setsockopt(s_, SOL_SOCKET, SO_TIMESTAMPNS, &enable,
+                     sizeof(enable)) == 0;
+#endif
   }
   return s_ != INVALID_SOCKET;
 }
@@ -281,6 +319,10 @@ AsyncSocket::ConnState PhysicalSocket::GetState() const {
 }
 
 int PhysicalSocket::GetOption(Option opt, int* value) {
+  if (opt == OPT_TXTIME) {
+    *value = txtime_enabled_ ? 1 : 0;
+    return 0;
+  }
   int slevel;
   int sopt;
   if (TranslateOption(opt, &slevel, &sopt) == -1)
@@ -304,10 +346,42 @@ int PhysicalSocket::GetOption(Option opt, int* value) {
 }
 
 int PhysicalSocket::SetOption(Option opt, int value) {
+  if (opt == OPT_TXTIME) {
+#if defined(WEBRTC_LINUX) && defined(SO_TXTIME)
+    if (!value) {
+      // The kernel has no interface for turning SO_TXTIME off again; just
+      // stop attaching launch times to outgoing packets.
+      txtime_enabled_ = false;
+      return 0;
+    }
+    struct sock_txtime txtime;
+    memset(&txtime, 0, sizeof(txtime));
+    // rtc::TimeMicros() reads CLOCK_MONOTONIC, so launch times computed
+    // from it can be passed to SendToAtTime() unmodified.
+    txtime.clockid = CLOCK_MONOTONIC;
+    int result =
+        ::setsockopt(s_, SOL_SOCKET, SO_TXTIME, (SockOptArg)&txtime,
+                     sizeof(txtime));
+    if (result == 0) {
+      txtime_enabled_ = true;
+    } else {
+      UpdateLastError();
+    }
+    return result;
+#else
+    RTC_LOG(LS_WARNING) << "Socket::OPT_TXTIME not supported.";
+    return -1;
+#endif
+  }
+  if (opt == OPT_DSCP && value == current_dscp_) {
+    // The kernel already has this marking; skip the syscall.
+    return 0;
+  }
   int slevel;
   int sopt;
   if (TranslateOption(opt, &slevel, &sopt) == -1)
     return -1;
+  const int dscp_value = value;
   if (opt == OPT_DONTFRAGMENT) {
 #if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
     value = (value) ? IP_PMTUDISC_DO : IP_PMTUDISC_DONT;
@@ -324,7 +398,11 @@ int PhysicalSocket::SetOption(Option opt, int value) {
     ::setsockopt(s_, IPPROTO_IP, IP_TOS, (SockOptArg)&value, sizeof(value));
   }
 #endif
-  return ::setsockopt(s_, slevel, sopt, (SockOptArg)&value, sizeof(value));
+  int result = ::setsockopt(s_, slevel, sopt, (SockOptArg)&value, sizeof(value));
+  if (opt == OPT_DSCP && result == 0) {
+    current_dscp_ = dscp_value;
+  }
+  return result;
 }
 
 int PhysicalSocket::Send(const void* pv, size_t cb) {
@@ -352,6 +430,45 @@ int PhysicalSocket::Send(const void* pv, size_t cb) {
   return sent;
 }
 
+int PhysicalSocket::SendV(const SendBuffer* buffers, size_t count) {
+#if defined(WEBRTC_POSIX)
+  static constexpr size_t kMaxSendBuffers = 16;
+  if (count > kMaxSendBuffers)
+    count = kMaxSendBuffers;  // Callers handle the resulting short write.
+  iovec iovs[kMaxSendBuffers];
+  size_t total = 0;
+  for (size_t i = 0; i < count; ++i) {
+    iovs[i].iov_base = const_cast<void*>(buffers[i].data);
+    iovs[i].iov_len = buffers[i].size;
+    total += buffers[i].size;
+  }
+  msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = iovs;
+  msg.msg_iovlen = count;
+  // sendmsg() rather than writev(), so the SIGPIPE suppression flag used
+  // by Send() applies to the gather path as well.
+  int sent = ::sendmsg(s_,
+                       &msg,
+#if defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+                       MSG_NOSIGNAL
+#else
+                       0
+#endif
+  );
+  UpdateLastError();
+  MaybeRemapSendError();
+  RTC_DCHECK(sent <= static_cast<int>(total));
+  if ((sent > 0 && sent < static_cast<int>(total)) ||
+      (sent < 0 && IsBlockingError(GetError()))) {
+    EnableEvents(DE_WRITE);
+  }
+  return sent;
+#else
+  return Socket::SendV(buffers, count);
+#endif
+}
+
 int PhysicalSocket::SendTo(const void* buffer,
                            size_t length,
                            const SocketAddress& addr) {
@@ -377,6 +494,142 @@ int PhysicalSocket::SendTo(const void* buffer,
   return sent;
 }
 
+int PhysicalSocket::SendToAtTime(const void* buffer,
+                                 size_t length,
+                                 const SocketAddress& addr,
+                                 int64_t launch_time_us) {
+#if defined(WEBRTC_LINUX) && defined(SO_TXTIME)
+  if (txtime_enabled_ && launch_time_us >= 0) {
+    sockaddr_storage saddr;
+    size_t len = addr.ToSockAddrStorage(&saddr);
+    iovec iov;
+    iov.iov_base = const_cast<void*>(buffer);
+    iov.iov_len = length;
+    char control[CMSG_SPACE(sizeof(uint64_t))];
+    memset(control, 0, sizeof(control));
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = &saddr;
+    msg.msg_namelen = static_cast<socklen_t>(len);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_TXTIME;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(uint64_t));
+    uint64_t txtime_ns = static_cast<uint64_t>(launch_time_us) * 1000;
+    memcpy(CMSG_DATA(cmsg), &txtime_ns, sizeof(txtime_ns));
+    // Suppress SIGPIPE, as in Send() above.
+    int sent = ::sendmsg(s_, &msg, MSG_NOSIGNAL);
+    UpdateLastError();
+    MaybeRemapSendError();
+    RTC_DCHECK(sent <= static_cast<int>(length));
+    if ((sent > 0 && sent < static_cast<int>(length)) ||
+        (sent < 0 && IsBlockingError(GetError()))) {
+      EnableEvents(DE_WRITE);
+    }
+    return sent;
+  }
+#endif
+  return SendTo(buffer, length, addr);
+}
+
+int PhysicalSocket::SendToBatch(const SendBuffer* datagrams,
+                                size_t count,
+                                const SocketAddress& addr) {
+#if defined(WEBRTC_LINUX)
+  static constexpr size_t kMaxBatchSize = 64;  // Kernel limit for UDP GSO.
+  if (count > kMaxBatchSize)
+    count = kMaxBatchSize;  // Callers handle the resulting short batch.
+  sockaddr_storage saddr;
+  size_t saddr_len = addr.ToSockAddrStorage(&saddr);
+  if (udp_ && gso_supported_ && count > 1) {
+    // A batch qualifies for GSO when all datagrams share the size of the
+    // first one, except that the last may be shorter; the kernel cuts the
+    // super-datagram into wire packets of that segment size.
+    size_t segment_size = datagrams[0].size;
+    size_t total = 0;
+    bool uniform = segment_size > 0 && segment_size <= 0xFFFF;
+    for (size_t i = 0; i < count && uniform; ++i) {
+      if (datagrams[i].size != segment_size &&
+          (i != count - 1 || datagrams[i].size > segment_size)) {
+        uniform = false;
+      }
+      total += datagrams[i].size;
+    }
+    if (uniform && total <= 0xFFFF) {
+      iovec iovs[kMaxBatchSize];
+      for (size_t i = 0; i < count; ++i) {
+        iovs[i].iov_base = const_cast<void*>(datagrams[i].data);
+        iovs[i].iov_len = datagrams[i].size;
+      }
+      char control[CMSG_SPACE(sizeof(uint16_t))];
+      memset(control, 0, sizeof(control));
+      msghdr msg;
+      memset(&msg, 0, sizeof(msg));
+      msg.msg_name = &saddr;
+      msg.msg_namelen = static_cast<socklen_t>(saddr_len);
+      msg.msg_iov = iovs;
+      msg.msg_iovlen = count;
+      msg.msg_control = control;
+      msg.msg_controllen = sizeof(control);
+      cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+      cmsg->cmsg_level = SOL_UDP;
+      cmsg->cmsg_type = UDP_SEGMENT;
+      cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+      uint16_t gso_size = static_cast<uint16_t>(segment_size);
+      memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+      // Suppress SIGPIPE, as in Send() above.
+      int sent = ::sendmsg(s_, &msg, MSG_NOSIGNAL);
+      UpdateLastError();
+      MaybeRemapSendError();
+      if (sent >= 0) {
+        // The kernel accepts a GSO super-datagram atomically.
+        RTC_DCHECK_EQ(sent, static_cast<int>(total));
+        return static_cast<int>(count);
+      }
+      if (IsBlockingError(GetError())) {
+        EnableEvents(DE_WRITE);
+        return 0;
+      }
+      // EIO/EINVAL here typically means the kernel or NIC path lacks GSO
+      // support; remember that and retry the batch without it.
+      gso_supported_ = false;
+    }
+  }
+  // Mixed sizes (or no GSO): still one syscall for the whole batch.
+  mmsghdr msgs[kMaxBatchSize];
+  iovec iovs[kMaxBatchSize];
+  memset(msgs, 0, sizeof(mmsghdr) * count);
+  for (size_t i = 0; i < count; ++i) {
+    iovs[i].iov_base = const_cast<void*>(datagrams[i].data);
+    iovs[i].iov_len = datagrams[i].size;
+    msgs[i].msg_hdr.msg_name = &saddr;
+    msgs[i].msg_hdr.msg_namelen = static_cast<socklen_t>(saddr_len);
+    msgs[i].msg_hdr.msg_iov = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+  }
+  int sent = ::sendmmsg(s_, msgs, static_cast<unsigned int>(count),
+                        MSG_NOSIGNAL);
+  UpdateLastError();
+  MaybeRemapSendError();
+  if (sent < 0) {
+    if (IsBlockingError(GetError())) {
+      EnableEvents(DE_WRITE);
+      return 0;
+    }
+    return SOCKET_ERROR;
+  }
+  if (static_cast<size_t>(sent) < count)
+    EnableEvents(DE_WRITE);
+  return sent;
+#else
+  return Socket::SendToBatch(datagrams, count, addr);
+#endif
+}
+
 int PhysicalSocket::Recv(void* buffer, size_t length, int64_t* timestamp) {
   int received =
       ::recv(s_, static_cast<char*>(buffer), static_cast<int>(length), 0);
@@ -413,10 +666,36 @@ int PhysicalSocket::RecvFrom(void* buffer,
   sockaddr_storage addr_storage;
   socklen_t addr_len = sizeof(addr_storage);
   sockaddr* addr = reinterpret_cast<sockaddr*>(&addr_storage);
-  int received = ::recvfrom(s_, static_cast<char*>(buffer),
-                            static_cast<int>(length), 0, addr, &addr_len);
-  if (timestamp) {
-    *timestamp = GetSocketRecvTimestamp(s_);
+  int received = -1;
+  bool use_recvfrom = true;
+#if defined(WEBRTC_LINUX) && defined(SO_TIMESTAMPNS)
+  if (timestampns_enabled_) {
+    use_recvfrom = false;
+    iovec iov;
+    iov.iov_base = buffer;
+    iov.iov_len = length;
+    char control[CMSG_SPACE(sizeof(struct timespec))];
+    msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = addr;
+    msg.msg_namelen = addr_len;
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    received = ::recvmsg(s_, &msg, 0);
+    addr_len = msg.msg_namelen;
+    if (timestamp) {
+      *timestamp = received >= 0 ? GetTimestampFromCmsgs(&msg) : -1;
+    }
+  }
+#endif
+  if (use_recvfrom) {
+    received = ::recvfrom(s_, static_cast<char*>(buffer),
+                          static_cast<int>(length), 0, addr, &addr_len);
+    if (timestamp) {
+      *timestamp = GetSocketRecvTimestamp(s_);
+    }
   }
   UpdateLastError();
   if ((received >= 0) && (out_addr != nullptr))
@@ -432,6 +711,76 @@ int PhysicalSocket::RecvFrom(void* buffer,
   return received;
 }
 
+int PhysicalSocket::RecvFromBatch(ReceivedDatagram* datagrams, size_t count) {
+#if defined(WEBRTC_LINUX)
+  static constexpr size_t kMaxBatchSize = 64;
+  if (count > kMaxBatchSize)
+    count = kMaxBatchSize;
+  mmsghdr msgs[kMaxBatchSize];
+  iovec iovs[kMaxBatchSize];
+  sockaddr_storage addr_storages[kMaxBatchSize];
+#if defined(SO_TIMESTAMPNS)
+  char controls[kMaxBatchSize][CMSG_SPACE(sizeof(struct timespec))];
+#endif
+  memset(msgs, 0, count * sizeof(mmsghdr));
+  for (size_t i = 0; i < count; ++i) {
+    iovs[i].iov_base = datagrams[i].buffer;
+    iovs[i].iov_len = datagrams[i].buffer_size;
+    msgs[i].msg_hdr.msg_iov = &iovs[i];
+    msgs[i].msg_hdr.msg_iovlen = 1;
+    msgs[i].msg_hdr.msg_name = &addr_storages[i];
+    msgs[i].msg_hdr.msg_namelen = sizeof(addr_storages[i]);
+#if defined(SO_TIMESTAMPNS)
+    if (timestampns_enabled_) {
+      msgs[i].msg_hdr.msg_control = controls[i];
+      msgs[i].msg_hdr.msg_controllen = sizeof(controls[i]);
+    }
+#endif
+  }
+  int received =
+      ::recvmmsg(s_, msgs, static_cast<unsigned int>(count), 0, nullptr);
+  UpdateLastError();
+  int error = GetError();
+  bool success = (received >= 0) || IsBlockingError(error);
+  if (udp_ || success) {
+    EnableEvents(DE_READ);
+  }
+  if (received < 0) {
+    if (!success) {
+      RTC_LOG_F(LS_VERBOSE) << "Error = " << error;
+      return SOCKET_ERROR;
+    }
+    return 0;
+  }
+  // Fall back to SIOCGSTAMP when no per-packet control message is attached.
+  // It only reports the arrival time of the last packet read from the
+  // socket, so all packets in the batch share it. Read lazily; the ioctl is
+  // not needed when SCM_TIMESTAMPNS is enabled.
+  absl::optional<int64_t> shared_timestamp;
+  for (int i = 0; i < received; ++i) {
+    datagrams[i].received = msgs[i].msg_len;
+    SocketAddressFromSockAddrStorage(addr_storages[i],
+                                     &datagrams[i].source_addr);
+    int64_t timestamp = -1;
+#if defined(SO_TIMESTAMPNS)
+    if (timestampns_enabled_) {
+      timestamp = GetTimestampFromCmsgs(&msgs[i].msg_hdr);
+    }
+#endif
+    if (timestamp == -1) {
+      if (!shared_timestamp) {
+        shared_timestamp = GetSocketRecvTimestamp(s_);
+      }
+      timestamp = *shared_timestamp;
+    }
+    datagrams[i].timestamp = timestamp;
+  }
+  return received;
+#else
+  return Socket::RecvFromBatch(datagrams, count);
+#endif
+}
+
 int PhysicalSocket::Listen(int backlog) {
   int err = ::listen(s_, backlog);
   UpdateLastError();
@@ -586,6 +935,10 @@ int PhysicalSocket::TranslateOption(Option opt, int* slevel, int* sopt) {
 #endif
     case OPT_RTP_SENDTIME_EXTN_ID:
       return -1;  // No logging is necessary as this not a OS socket option.
+    case OPT_TXTIME:
+      // Handled directly in GetOption()/SetOption(); the option value is a
+      // struct rather than an int.
+      return -1;
     default:
       RTC_NOTREACHED();
       return -1;
@@ -1032,10 +1385,10 @@ class Signaler : public EventDispatcher {
 PhysicalSocketServer::PhysicalSocketServer()
     :
 #if defined(WEBRTC_USE_EPOLL)
-      // Since Linux 2.6.8, the size argument is ignored, but must be greater
-      // than zero. Before that the size served as hint to the kernel for the
-      // amount of space to initially allocate in internal data structures.
-      epoll_fd_(epoll_create(FD_SETSIZE)),
+      // The epoll descriptor must not leak into child processes; the old
+      // size hint taken by epoll_create() has been ignored since Linux
+      // 2.6.8, so nothing is lost by using epoll_create1().
+      epoll_fd_(epoll_create1(EPOLL_CLOEXEC)),
 #endif
 #if defined(WEBRTC_WIN)
       socket_ev_(WSACreateEvent()),
@@ -1487,7 +1840,7 @@ bool PhysicalSocketServer::WaitEpoll(int cmsWait) {
         epoll_events_.size() < kMaxEpollEvents) {
       // We used the complete space to receive events, increase size for future
       // iterations.
-      epoll_events_.resize(std::max(epoll_events_.size() * 2, kMaxEpollEvents));
+      epoll_events_.resize(std::min(epoll_events_.size() * 2, kMaxEpollEvents));
     }
 
     if (cmsWait != kForever) {
@@ -17,7 +17,7 @@
 #endif
 
 #include <memory>
-#include <set>
+#include <unordered_set>
 #include <vector>
 
 #include "rtc_base/critical_section.h"
@@ -81,7 +81,9 @@ class RTC_EXPORT PhysicalSocketServer : public SocketServer {
   void Update(Dispatcher* dispatcher);
 
  private:
-  typedef std::set<Dispatcher*> DispatcherSet;
+  // Membership is checked for every signaled event in the epoll wait loop,
+  // so use a hash set to keep that lookup O(1) with thousands of sockets.
+  typedef std::unordered_set<Dispatcher*> DispatcherSet;
 
   void AddRemovePendingDispatchers() RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
 
@@ -133,15 +135,33 @@ class PhysicalSocket : public AsyncSocket, public sigslot::has_slots<> {
   int SetOption(Option opt, int value) override;
 
   int Send(const void* pv, size_t cb) override;
+  // Uses a single sendmsg() gather syscall on POSIX; falls back to the
+  // generic Send() loop elsewhere.
+  int SendV(const SendBuffer* buffers, size_t count) override;
   int SendTo(const void* buffer,
              size_t length,
              const SocketAddress& addr) override;
+  // Attaches the launch time as an SCM_TXTIME control message on Linux when
+  // OPT_TXTIME has been enabled; falls back to SendTo() elsewhere.
+  int SendToAtTime(const void* buffer,
+                   size_t length,
+                   const SocketAddress& addr,
+                   int64_t launch_time_us) override;
+  // On Linux, packs an equal-sized run of datagrams into one UDP GSO
+  // super-datagram (UDP_SEGMENT) and sends mixed sizes with a single
+  // sendmmsg() syscall; falls back to the generic SendTo() loop elsewhere.
+  int SendToBatch(const SendBuffer* datagrams,
+                  size_t count,
+                  const SocketAddress& addr) override;
 
   int Recv(void* buffer, size_t length, int64_t* timestamp) override;
   int RecvFrom(void* buffer,
                size_t length,
                SocketAddress* out_addr,
                int64_t* timestamp) override;
+  // Uses a single recvmmsg() syscall on Linux; falls back to the generic
+  // RecvFrom() loop elsewhere.
+  int RecvFromBatch(ReceivedDatagram* datagrams, size_t count) override;
 
   int Listen(int backlog) override;
   AsyncSocket* Accept(SocketAddress* out_addr) override;
@@ -183,6 +203,19 @@ class PhysicalSocket : public AsyncSocket, public sigslot::has_slots<> {
   SOCKET s_;
   bool udp_;
   int family_ = 0;
+  // True once OPT_TXTIME has been enabled, see SendToAtTime().
+  bool txtime_enabled_ = false;
+  // Last DSCP value applied through SetOption(OPT_DSCP), or -1 when unknown.
+  // Re-asserting the current marking is then a no-op instead of a
+  // setsockopt() syscall, which matters for flows that set their priority
+  // per packet.
+  int current_dscp_ = -1;
+  // Cleared when the kernel rejects a UDP GSO send, so SendToBatch() stops
+  // retrying the optimization on kernels without UDP_SEGMENT support.
+  bool gso_supported_ = true;
+  // True when the kernel attaches SCM_TIMESTAMPNS arrival times to received
+  // datagrams, see Create().
+  bool timestampns_enabled_ = false;
   CriticalSection crit_;
   int error_ RTC_GUARDED_BY(crit_);
   ConnState state_;
@@ -105,6 +105,33 @@ PlatformThreadRef PlatformThread::GetThreadRef() const {
 #endif  // defined(WEBRTC_WIN)
 }
 
+bool PlatformThread::SetAffinity(rtc::ArrayView<const int> cpu_ids) {
+  RTC_DCHECK(thread_checker_.IsCurrent());
+  RTC_DCHECK(IsRunning());
+  RTC_DCHECK(!cpu_ids.empty());
+#if defined(WEBRTC_WIN)
+  DWORD_PTR mask = 0;
+  for (int cpu_id : cpu_ids) {
+    RTC_DCHECK_GE(cpu_id, 0);
+    RTC_DCHECK_LT(cpu_id, static_cast<int>(8 * sizeof(DWORD_PTR)));
+    mask |= static_cast<DWORD_PTR>(1) << cpu_id;
+  }
+  return ::SetThreadAffinityMask(thread_, mask) != 0;
+#elif defined(WEBRTC_LINUX) && !defined(WEBRTC_ANDROID)
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu_id : cpu_ids) {
+    RTC_DCHECK_GE(cpu_id, 0);
+    RTC_DCHECK_LT(cpu_id, CPU_SETSIZE);
+    CPU_SET(cpu_id, &cpu_set);
+  }
+  return pthread_setaffinity_np(thread_, sizeof(cpu_set), &cpu_set) == 0;
+#else
+  // Thread affinity is not supported (or not meaningful) on this platform.
+  return false;
+#endif
+}
+
 void PlatformThread::Stop() {
   RTC_DCHECK(thread_checker_.IsCurrent());
   if (!IsRunning())
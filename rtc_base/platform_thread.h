@@ -17,6 +17,7 @@
 #include <string>
 
 #include "absl/strings/string_view.h"
+#include "api/array_view.h"
 #include "rtc_base/constructor_magic.h"
 #include "rtc_base/platform_thread_types.h"
 #include "rtc_base/thread_checker.h"
@@ -65,6 +66,14 @@ class PlatformThread {
   // thread checks.
   PlatformThreadRef GetThreadRef() const;
 
+  // Pins the spawned thread to the given set of logical CPUs, e.g. the cores
+  // of one NUMA node. Must be called from the thread that started the thread,
+  // while it is running. Returns false if pinning failed or is not supported
+  // on this platform. Note that memory which the pinned thread subsequently
+  // allocates and first touches is typically placed on the local node, so
+  // pinning a data-path thread also places the buffers it populates.
+  bool SetAffinity(rtc::ArrayView<const int> cpu_ids);
+
   // Stops (joins) the spawned thread.
   void Stop();
 
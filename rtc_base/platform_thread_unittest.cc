@@ -59,4 +59,18 @@ TEST(PlatformThreadTest, RunFunctionIsCalled) {
   EXPECT_TRUE(flag);
 }
 
+TEST(PlatformThreadTest, SetAffinityDoesNotBreakThread) {
+  bool flag = false;
+  PlatformThread thread(&SetFlagRunFunction, &flag, "SetAffinity");
+  thread.Start();
+
+  // Pinning may fail (or be unsupported on this platform), but it must not
+  // affect the ability to run and join the thread.
+  const int cpu_ids[] = {0};
+  thread.SetAffinity(cpu_ids);
+
+  thread.Stop();
+  EXPECT_TRUE(flag);
+}
+
 }  // namespace rtc
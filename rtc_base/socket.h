@@ -92,12 +92,105 @@ class Socket {
   virtual int Connect(const SocketAddress& addr) = 0;
   virtual int Send(const void* pv, size_t cb) = 0;
   virtual int SendTo(const void* pv, size_t cb, const SocketAddress& addr) = 0;
+
+  // One buffer of a vectored send, see SendV().
+  struct SendBuffer {
+    const void* data = nullptr;
+    size_t size = 0;
+  };
+
+  // Sends the |count| buffers in |buffers| as a single gather operation
+  // where the platform supports it (see PhysicalSocket, which uses
+  // sendmsg() on POSIX), so a framing header need not be copied next to
+  // its payload first. This default loops over Send(). Returns the total
+  // number of bytes sent, which is less than the sum of the buffer sizes
+  // on a partial send, or SOCKET_ERROR if nothing was sent due to an
+  // error.
+  virtual int SendV(const SendBuffer* buffers, size_t count) {
+    int total_sent = 0;
+    for (size_t i = 0; i < count; ++i) {
+      int sent = Send(buffers[i].data, buffers[i].size);
+      if (sent < 0)
+        return total_sent > 0 ? total_sent : sent;
+      total_sent += sent;
+      if (static_cast<size_t>(sent) < buffers[i].size)
+        break;
+    }
+    return total_sent;
+  }
+
+  // Sends like SendTo(), but asks the kernel to hold the packet until
+  // |launch_time_us| (microseconds on the clock configured through
+  // OPT_TXTIME; rtc::TimeMicros() on Linux). This lets a pacer hand a burst
+  // of packets to the kernel in one go and rely on kernel scheduling for
+  // the precise transmit times (see PhysicalSocket, which attaches an
+  // SCM_TXTIME control message). A negative |launch_time_us| means "send
+  // immediately". This default ignores the launch time.
+  virtual int SendToAtTime(const void* pv,
+                           size_t cb,
+                           const SocketAddress& addr,
+                           int64_t launch_time_us) {
+    return SendTo(pv, cb, addr);
+  }
+
+  // Sends |count| datagrams, one per entry of |datagrams|, to |addr| in as
+  // few syscalls as possible. Implementations may pack an equal-sized run of
+  // datagrams into a single super-datagram that the kernel segments on the
+  // wire (see PhysicalSocket, which attaches a UDP_SEGMENT control message
+  // on Linux) and submit mixed sizes with sendmmsg(). This default loops
+  // over SendTo(). Returns the number of datagrams fully sent, which may be
+  // less than |count| if the socket would block part way through, or
+  // SOCKET_ERROR if the first datagram failed.
+  virtual int SendToBatch(const SendBuffer* datagrams,
+                          size_t count,
+                          const SocketAddress& addr) {
+    for (size_t i = 0; i < count; ++i) {
+      int sent = SendTo(datagrams[i].data, datagrams[i].size, addr);
+      if (sent < 0)
+        return i > 0 ? static_cast<int>(i) : sent;
+    }
+    return static_cast<int>(count);
+  }
+
   // |timestamp| is in units of microseconds.
   virtual int Recv(void* pv, size_t cb, int64_t* timestamp) = 0;
   virtual int RecvFrom(void* pv,
                        size_t cb,
                        SocketAddress* paddr,
                        int64_t* timestamp) = 0;
+
+  // One datagram slot in a batched receive, see RecvFromBatch().
+  struct ReceivedDatagram {
+    void* buffer = nullptr;     // Provided by the caller.
+    size_t buffer_size = 0;     // Capacity of |buffer|.
+    size_t received = 0;        // Filled in by RecvFromBatch().
+    SocketAddress source_addr;  // Filled in by RecvFromBatch().
+    int64_t timestamp = -1;     // Microseconds since epoch, -1 if unknown.
+  };
+
+  // Receives up to |count| datagrams in one call, amortizing per-wakeup
+  // overhead at high packet rates. Implementations may drain the socket with
+  // a single syscall (see PhysicalSocket, which uses recvmmsg() on Linux);
+  // this default loops over RecvFrom(). Returns the number of datagrams
+  // received, 0 if the socket would block before the first datagram, or
+  // SOCKET_ERROR on error.
+  virtual int RecvFromBatch(ReceivedDatagram* datagrams, size_t count) {
+    size_t received_count = 0;
+    while (received_count < count) {
+      ReceivedDatagram& datagram = datagrams[received_count];
+      int len = RecvFrom(datagram.buffer, datagram.buffer_size,
+                         &datagram.source_addr, &datagram.timestamp);
+      if (len < 0) {
+        if (received_count == 0 && !IsBlockingError(GetError()))
+          return SOCKET_ERROR;
+        break;
+      }
+      datagram.received = static_cast<size_t>(len);
+      ++received_count;
+    }
+    return static_cast<int>(received_count);
+  }
+
   virtual int Listen(int backlog) = 0;
   virtual Socket* Accept(SocketAddress* paddr) = 0;
   virtual int Close() = 0;
@@ -118,6 +211,10 @@ class Socket {
     OPT_RTP_SENDTIME_EXTN_ID,  // This is a non-traditional socket option param.
                                // This is specific to libjingle and will be used
                                // if SendTime option is needed at socket level.
+    OPT_TXTIME,                // Whether the kernel schedules transmits from
+                               // per-packet launch times (SO_TXTIME on Linux,
+                               // using the rtc::TimeMicros() clock; see
+                               // SendToAtTime()). Unsupported elsewhere.
   };
   virtual int GetOption(Option opt, int* value) = 0;
   virtual int SetOption(Option opt, int value) = 0;
@@ -37,6 +37,10 @@ struct RTC_EXPORT SSLCertificateStats {
   std::string fingerprint_algorithm;
   std::string base64_certificate;
   std::unique_ptr<SSLCertificateStats> issuer;
+
+  // Deep copy of the stats, including the issuer chain. Much cheaper than
+  // recomputing them from the certificate, which re-hashes and re-encodes.
+  std::unique_ptr<SSLCertificateStats> Copy() const;
 };
 
 // Abstract interface overridden by SSL library specific
@@ -100,6 +100,8 @@ SSLStreamAdapter::SSLStreamAdapter(std::unique_ptr<StreamInterface> stream)
 
 SSLStreamAdapter::~SSLStreamAdapter() {}
 
+void SSLStreamAdapter::SetHandshakeOffloadThread(Thread* thread) {}
+
 bool SSLStreamAdapter::GetSslCipherSuite(int* cipher_suite) {
   return false;
 }
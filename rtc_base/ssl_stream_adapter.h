@@ -158,6 +158,17 @@ class SSLStreamAdapter : public StreamAdapterInterface {
   // This should only be called before StartSSL().
   virtual void SetInitialRetransmissionTimeout(int timeout_ms) = 0;
 
+  // Offload the CPU-heavy handshake steps (the SSL_connect/SSL_accept calls,
+  // which include the private key operations) to |thread|, leaving only state
+  // transitions and packet sends on the thread that drives this stream. Only
+  // supported in DTLS mode, where handshake packets that are lost while a
+  // step is in flight are recovered by retransmission. The wrapped stream
+  // must allow reads from |thread| while packets are appended on the driving
+  // thread.
+  // This should only be called before StartSSL(). The default implementation
+  // ignores the request and runs the handshake inline.
+  virtual void SetHandshakeOffloadThread(Thread* thread);
+
   // StartSSL starts negotiation with a peer, whose certificate is verified
   // using the certificate digest. Generally, SetIdentity() and possibly
   // SetServerRole() should have been called before this.
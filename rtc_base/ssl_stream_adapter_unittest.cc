@@ -25,6 +25,7 @@
 #include "rtc_base/ssl_identity.h"
 #include "rtc_base/ssl_stream_adapter.h"
 #include "rtc_base/stream.h"
+#include "rtc_base/thread.h"
 #include "test/field_trial.h"
 
 using ::testing::Combine;
@@ -1141,6 +1142,18 @@ TEST_P(SSLStreamAdapterTestDTLS, TestDTLSConnectWithLostFirstPacketDelay2s) {
   TestHandshake();
 }
 
+// Test that the handshake still works, and the connection can be used, when
+// the CPU-heavy handshake steps are offloaded to a separate thread.
+TEST_P(SSLStreamAdapterTestDTLS, TestDTLSConnectWithHandshakeOffload) {
+  std::unique_ptr<rtc::Thread> offload_thread = rtc::Thread::Create();
+  offload_thread->SetName("ssl_handshake_offload", nullptr);
+  offload_thread->Start();
+  client_ssl_->SetHandshakeOffloadThread(offload_thread.get());
+  server_ssl_->SetHandshakeOffloadThread(offload_thread.get());
+  TestHandshake();
+  TestTransfer(100);
+}
+
 // Test a handshake with small MTU
 // Disabled due to https://code.google.com/p/webrtc/issues/detail?id=3910
 TEST_P(SSLStreamAdapterTestDTLS, DISABLED_TestDTLSConnectWithSmallMtu) {
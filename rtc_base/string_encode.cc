@@ -291,6 +291,22 @@ size_t split(const std::string& source,
   return fields->size();
 }
 
+size_t split(absl::string_view source,
+             char delimiter,
+             std::vector<absl::string_view>* fields) {
+  RTC_DCHECK(fields);
+  fields->clear();
+  size_t last = 0;
+  for (size_t i = 0; i < source.length(); ++i) {
+    if (source[i] == delimiter) {
+      fields->push_back(source.substr(last, i - last));
+      last = i + 1;
+    }
+  }
+  fields->push_back(source.substr(last, source.length() - last));
+  return fields->size();
+}
+
 std::string ToString(const bool b) {
   return b ? "true" : "false";
 }
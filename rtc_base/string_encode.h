@@ -17,6 +17,7 @@
 #include <type_traits>
 #include <vector>
 
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 #include "rtc_base/checks.h"
 #include "rtc_base/string_to_number.h"
@@ -66,6 +67,12 @@ size_t split(const std::string& source,
              char delimiter,
              std::vector<std::string>* fields);
 
+// As above, but the fields are views into |source| and no copies are made.
+// The views are only valid for as long as the memory backing |source| is.
+size_t split(absl::string_view source,
+             char delimiter,
+             std::vector<absl::string_view>* fields);
+
 // Splits the source string into multiple fields separated by delimiter,
 // with duplicates of delimiter ignored.  Trailing delimiter ignored.
 size_t tokenize(const std::string& source,
@@ -14,6 +14,7 @@
 
 #include <sstream>  // no-presubmit-check TODO(webrtc:8982)
 
+#include "absl/strings/string_view.h"
 #include "test/gtest.h"
 
 namespace rtc {
@@ -318,6 +319,25 @@ TEST(SplitTest, CompareSubstrings) {
   ASSERT_STREQ("", fields.at(0).c_str());
 }
 
+// Tests the string_view overload, whose fields alias the source string.
+TEST(SplitTest, SplitStringView) {
+  const std::string source = "find,,middle,one";
+  std::vector<absl::string_view> fields;
+
+  EXPECT_EQ(4ul, split(absl::string_view(source), ',', &fields));
+  ASSERT_EQ(4ul, fields.size());
+  EXPECT_EQ("find", fields.at(0));
+  EXPECT_EQ("", fields.at(1));
+  EXPECT_EQ("middle", fields.at(2));
+  EXPECT_EQ("one", fields.at(3));
+  // The fields are views into the source string, not copies.
+  EXPECT_EQ(source.data(), fields.at(0).data());
+
+  EXPECT_EQ(1ul, split(absl::string_view(""), ',', &fields));
+  ASSERT_EQ(1ul, fields.size());
+  EXPECT_EQ("", fields.at(0));
+}
+
 TEST(ToString, SanityCheck) {
   EXPECT_EQ(ToString(true), "true");
   EXPECT_EQ(ToString(false), "false");
@@ -0,0 +1,104 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/synchronization/lock_profiler.h"
+
+#include <algorithm>
+
+#include "rtc_base/logging.h"
+#include "rtc_base/time_utils.h"
+
+namespace rtc {
+
+namespace {
+
+// Head of the global site list. Sites are only appended, never removed.
+std::atomic<LockProfileSite*> g_site_list_head{nullptr};
+
+}  // namespace
+
+LockProfileSite::LockProfileSite(const char* name) : name(name) {
+  LockProfileSite* head = g_site_list_head.load(std::memory_order_relaxed);
+  do {
+    next = head;
+  } while (!g_site_list_head.compare_exchange_weak(
+      head, this, std::memory_order_release, std::memory_order_relaxed));
+}
+
+std::vector<LockProfiler::SiteStats> LockProfiler::GetStats() {
+  std::vector<SiteStats> stats;
+  for (LockProfileSite* site =
+           g_site_list_head.load(std::memory_order_acquire);
+       site != nullptr; site = site->next) {
+    SiteStats s;
+    s.name = site->name;
+    s.enter_count = site->enter_count.load(std::memory_order_relaxed);
+    s.contended_count = site->contended_count.load(std::memory_order_relaxed);
+    s.total_wait_us = site->total_wait_us.load(std::memory_order_relaxed);
+    s.max_wait_us = site->max_wait_us.load(std::memory_order_relaxed);
+    s.total_hold_us = site->total_hold_us.load(std::memory_order_relaxed);
+    stats.push_back(s);
+  }
+  return stats;
+}
+
+std::vector<LockProfiler::SiteStats> LockProfiler::GetTopContendedSites(
+    size_t n) {
+  std::vector<SiteStats> stats = GetStats();
+  std::sort(stats.begin(), stats.end(),
+            [](const SiteStats& a, const SiteStats& b) {
+              return a.total_wait_us > b.total_wait_us;
+            });
+  if (stats.size() > n) {
+    stats.resize(n);
+  }
+  return stats;
+}
+
+void LockProfiler::LogTopContendedSites(size_t n) {
+  std::vector<SiteStats> stats = GetTopContendedSites(n);
+  RTC_LOG(LS_INFO) << "Top contended locks (" << stats.size() << " sites):";
+  for (const SiteStats& s : stats) {
+    RTC_LOG(LS_INFO) << "  " << s.name << ": enters=" << s.enter_count
+                     << " contended=" << s.contended_count
+                     << " wait_us=" << s.total_wait_us
+                     << " max_wait_us=" << s.max_wait_us
+                     << " hold_us=" << s.total_hold_us;
+  }
+}
+
+ProfiledCritScope::ProfiledCritScope(const CriticalSection* cs,
+                                     LockProfileSite* site)
+    : cs_(cs), site_(site) {
+  site_->enter_count.fetch_add(1, std::memory_order_relaxed);
+  if (cs_->TryEnter()) {
+    locked_us_ = TimeMicros();
+    return;
+  }
+  const int64_t wait_start_us = TimeMicros();
+  cs_->Enter();
+  locked_us_ = TimeMicros();
+  const int64_t wait_us = locked_us_ - wait_start_us;
+  site_->contended_count.fetch_add(1, std::memory_order_relaxed);
+  site_->total_wait_us.fetch_add(wait_us, std::memory_order_relaxed);
+  int64_t max_wait_us = site_->max_wait_us.load(std::memory_order_relaxed);
+  while (wait_us > max_wait_us &&
+         !site_->max_wait_us.compare_exchange_weak(
+             max_wait_us, wait_us, std::memory_order_relaxed)) {
+  }
+}
+
+ProfiledCritScope::~ProfiledCritScope() {
+  site_->total_hold_us.fetch_add(TimeMicros() - locked_us_,
+                                 std::memory_order_relaxed);
+  cs_->Leave();
+}
+
+}  // namespace rtc
@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_SYNCHRONIZATION_LOCK_PROFILER_H_
+#define RTC_BASE_SYNCHRONIZATION_LOCK_PROFILER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+#include "rtc_base/constructor_magic.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/system/rtc_export.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace rtc {
+
+// Wait/hold-time counters for one lock acquisition site. Sites register
+// themselves in a global list on construction and are never unregistered, so
+// instances must have static storage duration; RTC_PROFILED_CRIT_SCOPE()
+// takes care of this.
+struct RTC_EXPORT LockProfileSite {
+  explicit LockProfileSite(const char* name);
+
+  const char* const name;
+  std::atomic<int64_t> enter_count{0};
+  std::atomic<int64_t> contended_count{0};
+  std::atomic<int64_t> total_wait_us{0};
+  std::atomic<int64_t> max_wait_us{0};
+  std::atomic<int64_t> total_hold_us{0};
+  LockProfileSite* next = nullptr;  // Global registration list link.
+};
+
+class RTC_EXPORT LockProfiler {
+ public:
+  struct SiteStats {
+    const char* name;
+    int64_t enter_count;
+    int64_t contended_count;
+    int64_t total_wait_us;
+    int64_t max_wait_us;
+    int64_t total_hold_us;
+  };
+
+  // Snapshot of all registered sites, in no particular order. Counters keep
+  // running while the snapshot is taken, so totals are approximate.
+  static std::vector<SiteStats> GetStats();
+
+  // The up to |n| sites with the largest accumulated wait time, most
+  // contended first.
+  static std::vector<SiteStats> GetTopContendedSites(size_t n);
+
+  // Writes the ranked contention table to the log, one line per site.
+  static void LogTopContendedSites(size_t n);
+};
+
+// Scope that records wait and hold time of |cs| into |site|. Use through
+// RTC_PROFILED_CRIT_SCOPE() so that regular builds get a plain CritScope.
+class RTC_SCOPED_LOCKABLE ProfiledCritScope {
+ public:
+  ProfiledCritScope(const CriticalSection* cs, LockProfileSite* site)
+      RTC_EXCLUSIVE_LOCK_FUNCTION(cs);
+  ~ProfiledCritScope() RTC_UNLOCK_FUNCTION();
+
+ private:
+  const CriticalSection* const cs_;
+  LockProfileSite* const site_;
+  // When the lock was acquired, for measuring the hold time.
+  int64_t locked_us_;
+  RTC_DISALLOW_COPY_AND_ASSIGN(ProfiledCritScope);
+};
+
+}  // namespace rtc
+
+#define RTC_LOCK_PROFILER_STRINGIZE_IMPL(x) #x
+#define RTC_LOCK_PROFILER_STRINGIZE(x) RTC_LOCK_PROFILER_STRINGIZE_IMPL(x)
+#define RTC_LOCK_PROFILER_CONCAT_IMPL(a, b) a##b
+#define RTC_LOCK_PROFILER_CONCAT(a, b) RTC_LOCK_PROFILER_CONCAT_IMPL(a, b)
+
+// Drop-in replacement for rtc::CritScope. In lock profiling builds
+// (gn arg rtc_enable_lock_profiling=true) every expansion statically
+// registers a per-site counter named after the file:line of the macro,
+// RTC_DCHECK-style, and records wait and hold times into it. In regular
+// builds this is a plain CritScope with no overhead.
+#if defined(RTC_ENABLE_LOCK_PROFILING)
+#define RTC_PROFILED_CRIT_SCOPE(cs)                                         \
+  static rtc::LockProfileSite RTC_LOCK_PROFILER_CONCAT(lock_profile_site_,  \
+                                                       __LINE__)(           \
+      __FILE__ ":" RTC_LOCK_PROFILER_STRINGIZE(__LINE__));                  \
+  rtc::ProfiledCritScope RTC_LOCK_PROFILER_CONCAT(lock_profile_scope_,      \
+                                                  __LINE__)(                \
+      cs, &RTC_LOCK_PROFILER_CONCAT(lock_profile_site_, __LINE__))
+#else
+#define RTC_PROFILED_CRIT_SCOPE(cs) rtc::CritScope lock_profile_scope(cs)
+#endif
+
+#endif  // RTC_BASE_SYNCHRONIZATION_LOCK_PROFILER_H_
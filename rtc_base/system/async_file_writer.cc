@@ -0,0 +1,161 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/system/async_file_writer.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+constexpr size_t AsyncFileWriter::kDefaultBufferCapacityBytes;
+
+AsyncFileWriter::AsyncFileWriter(FileWrapper file,
+                                 size_t buffer_capacity_bytes)
+    : buffer_capacity_(buffer_capacity_bytes),
+      file_(std::move(file)),
+      thread_(&ThreadRun, this, "AsyncFileWriter", rtc::kLowPriority) {
+  RTC_DCHECK_GT(buffer_capacity_, 0);
+  if (file_.is_open()) {
+    fill_buffer_.EnsureCapacity(buffer_capacity_);
+    write_buffer_.EnsureCapacity(buffer_capacity_);
+    thread_.Start();
+  }
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+  Close();
+}
+
+bool AsyncFileWriter::Write(const void* buf, size_t length) {
+  RTC_DCHECK(file_.is_open());
+  const uint8_t* data = static_cast<const uint8_t*>(buf);
+  while (length > 0) {
+    {
+      rtc::CritScope lock(&crit_);
+      RTC_DCHECK(!stop_);
+      const size_t space = buffer_capacity_ - fill_buffer_.size();
+      if (space > 0) {
+        const size_t chunk = std::min(space, length);
+        fill_buffer_.AppendData(data, chunk);
+        data += chunk;
+        length -= chunk;
+        continue;
+      }
+    }
+    HandOffFillBuffer();
+  }
+  rtc::CritScope lock(&crit_);
+  return ok_;
+}
+
+bool AsyncFileWriter::Flush() {
+  RTC_DCHECK(file_.is_open());
+  HandOffFillBuffer();
+  WaitForIdleWriter();
+  // The writer thread only touches |file_| while it has handed-over data,
+  // and it has none left; flushing from this thread is safe.
+  const bool flush_ok = file_.Flush();
+  rtc::CritScope lock(&crit_);
+  ok_ = ok_ && flush_ok;
+  return ok_;
+}
+
+FileWrapper AsyncFileWriter::FinishAndRelease() {
+  if (!file_.is_open()) {
+    return FileWrapper();
+  }
+  HandOffFillBuffer();
+  WaitForIdleWriter();
+  {
+    rtc::CritScope lock(&crit_);
+    stop_ = true;
+  }
+  wake_writer_.Set();
+  thread_.Stop();
+  return std::move(file_);
+}
+
+bool AsyncFileWriter::Close() {
+  bool write_ok;
+  {
+    rtc::CritScope lock(&crit_);
+    write_ok = ok_;
+  }
+  return FinishAndRelease().Close() && write_ok;
+}
+
+// static
+void AsyncFileWriter::ThreadRun(void* obj) {
+  static_cast<AsyncFileWriter*>(obj)->ProcessWrites();
+}
+
+void AsyncFileWriter::ProcessWrites() {
+  rtc::Buffer local_buffer(size_t{0}, buffer_capacity_);
+  while (true) {
+    wake_writer_.Wait(rtc::Event::kForever);
+    while (true) {
+      {
+        rtc::CritScope lock(&crit_);
+        if (write_buffer_.empty()) {
+          if (stop_) {
+            return;
+          }
+          break;
+        }
+        std::swap(local_buffer, write_buffer_);
+        writing_ = true;
+      }
+      const bool write_ok =
+          file_.Write(local_buffer.data(), local_buffer.size());
+      local_buffer.Clear();
+      {
+        rtc::CritScope lock(&crit_);
+        ok_ = ok_ && write_ok;
+        writing_ = false;
+      }
+      writer_idle_.Set();
+    }
+  }
+}
+
+void AsyncFileWriter::HandOffFillBuffer() {
+  while (true) {
+    {
+      rtc::CritScope lock(&crit_);
+      if (fill_buffer_.empty()) {
+        return;
+      }
+      if (write_buffer_.empty()) {
+        std::swap(fill_buffer_, write_buffer_);
+        wake_writer_.Set();
+        return;
+      }
+    }
+    writer_idle_.Wait(rtc::Event::kForever);
+  }
+}
+
+void AsyncFileWriter::WaitForIdleWriter() {
+  while (true) {
+    {
+      rtc::CritScope lock(&crit_);
+      RTC_DCHECK(fill_buffer_.empty());
+      if (write_buffer_.empty() && !writing_) {
+        return;
+      }
+    }
+    writer_idle_.Wait(rtc::Event::kForever);
+  }
+}
+
+}  // namespace webrtc
@@ -0,0 +1,99 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_SYSTEM_ASYNC_FILE_WRITER_H_
+#define RTC_BASE_SYSTEM_ASYNC_FILE_WRITER_H_
+
+#include <stddef.h>
+
+#include "rtc_base/buffer.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/event.h"
+#include "rtc_base/platform_thread.h"
+#include "rtc_base/system/file_wrapper.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+
+// Writes data to a FileWrapper from a low priority background thread, so
+// that disk stalls do not block the calling thread. Writes are double
+// buffered: the caller appends to one buffer while the previous one is
+// written to disk as a single large chunk. When both buffers are full the
+// caller blocks until the disk catches up, so no data is ever dropped.
+//
+// Write, Flush and Close must be called from one thread at a time, like for
+// FileWrapper. Intended for debug recordings (aec dumps, wav dumps) where
+// the producer is a real-time audio or video thread.
+class AsyncFileWriter final {
+ public:
+  static constexpr size_t kDefaultBufferCapacityBytes = 256 * 1024;
+
+  // Takes ownership of |file|. If |file| is open, a writer thread is started
+  // and runs until Close or FinishAndRelease is called (or the writer is
+  // destroyed).
+  explicit AsyncFileWriter(
+      FileWrapper file,
+      size_t buffer_capacity_bytes = kDefaultBufferCapacityBytes);
+  ~AsyncFileWriter();
+
+  AsyncFileWriter(const AsyncFileWriter&) = delete;
+  AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+  // Returns true if the underlying file is open.
+  bool is_open() const { return file_.is_open(); }
+
+  // Copies |length| bytes into the fill buffer, handing full buffers over to
+  // the writer thread. Blocks only when the writer thread is more than one
+  // buffer behind. Returns false if any write so far has failed.
+  bool Write(const void* buf, size_t length);
+
+  // Blocks until all buffered data has been handed to the operating system.
+  // Returns false if any write so far has failed.
+  bool Flush();
+
+  // Stops the writer thread, writes out any buffered data and returns the
+  // underlying file, open and positioned after the last written byte. After
+  // this call the writer is no longer usable.
+  FileWrapper FinishAndRelease();
+
+  // Equivalent to FinishAndRelease followed by closing the returned file.
+  // Returns false if any write failed or the file could not be closed.
+  bool Close();
+
+ private:
+  static void ThreadRun(void* obj);
+  void ProcessWrites();
+  // Waits until the write buffer is free, then hands the fill buffer over to
+  // the writer thread.
+  void HandOffFillBuffer();
+  // Waits until the writer thread has no data left to write.
+  void WaitForIdleWriter();
+
+  const size_t buffer_capacity_;
+  // Accessed by the writer thread while it has data to write, and by the
+  // calling thread only when the writer thread is idle or stopped.
+  FileWrapper file_;
+
+  rtc::CriticalSection crit_;
+  rtc::Buffer fill_buffer_ RTC_GUARDED_BY(crit_);
+  rtc::Buffer write_buffer_ RTC_GUARDED_BY(crit_);
+  // True while the writer thread is writing a handed-over buffer.
+  bool writing_ RTC_GUARDED_BY(crit_) = false;
+  bool stop_ RTC_GUARDED_BY(crit_) = false;
+  bool ok_ RTC_GUARDED_BY(crit_) = true;
+
+  rtc::Event wake_writer_;
+  rtc::Event writer_idle_;
+  rtc::PlatformThread thread_;
+};
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_SYSTEM_ASYNC_FILE_WRITER_H_
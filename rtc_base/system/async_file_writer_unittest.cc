@@ -0,0 +1,94 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/system/async_file_writer.h"
+
+#include <string>
+#include <vector>
+
+#include "test/gtest.h"
+#include "test/testsupport/file_utils.h"
+
+namespace webrtc {
+namespace {
+
+std::vector<uint8_t> ReadFileContents(const std::string& path) {
+  FileWrapper file = FileWrapper::OpenReadOnly(path);
+  EXPECT_TRUE(file.is_open());
+  std::vector<uint8_t> contents;
+  uint8_t buffer[4096];
+  size_t read;
+  while ((read = file.Read(buffer, sizeof(buffer))) > 0) {
+    contents.insert(contents.end(), buffer, buffer + read);
+  }
+  return contents;
+}
+
+TEST(AsyncFileWriterTest, WritesAllDataInOrder) {
+  const std::string path = test::TempFilename(test::OutputPath(),
+                                              "async_file_writer");
+  std::vector<uint8_t> expected;
+  {
+    // A small buffer capacity forces many buffer hand-overs.
+    AsyncFileWriter writer(FileWrapper::OpenWriteOnly(path),
+                           /*buffer_capacity_bytes=*/64);
+    ASSERT_TRUE(writer.is_open());
+    uint8_t value = 0;
+    for (size_t chunk_size : {1u, 7u, 64u, 100u, 1000u, 3u}) {
+      std::vector<uint8_t> chunk(chunk_size);
+      for (uint8_t& byte : chunk) {
+        byte = value++;
+      }
+      EXPECT_TRUE(writer.Write(chunk.data(), chunk.size()));
+      expected.insert(expected.end(), chunk.begin(), chunk.end());
+    }
+    EXPECT_TRUE(writer.Close());
+  }
+  EXPECT_EQ(ReadFileContents(path), expected);
+  remove(path.c_str());
+}
+
+TEST(AsyncFileWriterTest, FlushMakesDataVisible) {
+  const std::string path = test::TempFilename(test::OutputPath(),
+                                              "async_file_writer");
+  AsyncFileWriter writer(FileWrapper::OpenWriteOnly(path),
+                         /*buffer_capacity_bytes=*/1024);
+  const char kData[] = "partially filled buffer";
+  EXPECT_TRUE(writer.Write(kData, sizeof(kData)));
+  EXPECT_TRUE(writer.Flush());
+  EXPECT_EQ(ReadFileContents(path).size(), sizeof(kData));
+  EXPECT_TRUE(writer.Close());
+  remove(path.c_str());
+}
+
+TEST(AsyncFileWriterTest, FinishAndReleaseReturnsOpenFile) {
+  const std::string path = test::TempFilename(test::OutputPath(),
+                                              "async_file_writer");
+  AsyncFileWriter writer(FileWrapper::OpenWriteOnly(path),
+                         /*buffer_capacity_bytes=*/16);
+  const char kData[] = "0123456789abcdef0123456789abcdef";
+  EXPECT_TRUE(writer.Write(kData, sizeof(kData)));
+
+  FileWrapper file = writer.FinishAndRelease();
+  ASSERT_TRUE(file.is_open());
+  // The returned file is positioned after the last written byte and can be
+  // used directly, e.g. to patch a header.
+  EXPECT_TRUE(file.Rewind());
+  EXPECT_TRUE(file.Write("####", 4));
+  EXPECT_TRUE(file.Close());
+
+  std::vector<uint8_t> contents = ReadFileContents(path);
+  ASSERT_EQ(contents.size(), sizeof(kData));
+  EXPECT_EQ(std::string(contents.begin(), contents.begin() + 4), "####");
+  remove(path.c_str());
+}
+
+}  // namespace
+}  // namespace webrtc
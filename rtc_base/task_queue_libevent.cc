@@ -18,8 +18,8 @@
 #include <time.h>
 #include <unistd.h>
 
-#include <list>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -34,8 +34,10 @@
 #include "rtc_base/numerics/safe_conversions.h"
 #include "rtc_base/platform_thread.h"
 #include "rtc_base/platform_thread_types.h"
+#include "rtc_base/task_sampler.h"
 #include "rtc_base/thread_annotations.h"
 #include "rtc_base/time_utils.h"
+#include "rtc_base/timer_wheel.h"
 
 namespace webrtc {
 namespace {
@@ -116,7 +118,6 @@ class TaskQueueLibevent final : public TaskQueueBase {
 
  private:
   class SetTimerTask;
-  struct TimerEvent;
 
   ~TaskQueueLibevent() override = default;
 
@@ -124,27 +125,30 @@ class TaskQueueLibevent final : public TaskQueueBase {
   static void OnWakeup(int socket, short flags, void* context);  // NOLINT
   static void RunTimer(int fd, short flags, void* context);      // NOLINT
 
+  // Re-arms |timer_event_| for the earliest entry in |delayed_tasks_|, if
+  // any. Called on the queue's thread.
+  void ScheduleNextTimer();
+
   bool is_active_ = true;
+  // Kept for attributing sampled tasks to this queue, see TaskSampler.
+  const std::string name_;
   int wakeup_pipe_in_ = -1;
   int wakeup_pipe_out_ = -1;
   event_base* event_base_;
   event wakeup_event_;
+  // Single timer event shared by all delayed posts, armed for the earliest
+  // entry in |delayed_tasks_|. Saves one heap-allocated event per delayed
+  // post and keeps at most one timer registered with libevent.
+  event timer_event_;
   rtc::PlatformThread thread_;
   rtc::CriticalSection pending_lock_;
   absl::InlinedVector<std::unique_ptr<QueuedTask>, 4> pending_
       RTC_GUARDED_BY(pending_lock_);
-  // Holds a list of events pending timers for cleanup when the loop exits.
-  std::list<TimerEvent*> pending_timers_;
-};
-
-struct TaskQueueLibevent::TimerEvent {
-  TimerEvent(TaskQueueLibevent* task_queue, std::unique_ptr<QueuedTask> task)
-      : task_queue(task_queue), task(std::move(task)) {}
-  ~TimerEvent() { event_del(&ev); }
-
-  event ev;
-  TaskQueueLibevent* task_queue;
-  std::unique_ptr<QueuedTask> task;
+  // Delayed tasks, only touched on the queue's thread.
+  TimerWheel delayed_tasks_;
+  // Breaks ties between delayed tasks with the same fire time so they run
+  // in posting order.
+  uint64_t delayed_next_order_ = 0;
 };
 
 class TaskQueueLibevent::SetTimerTask : public QueuedTask {
@@ -172,7 +176,8 @@ class TaskQueueLibevent::SetTimerTask : public QueuedTask {
 
 TaskQueueLibevent::TaskQueueLibevent(absl::string_view queue_name,
                                      rtc::ThreadPriority priority)
-    : event_base_(event_base_new()),
+    : name_(queue_name),
+      event_base_(event_base_new()),
       thread_(&TaskQueueLibevent::ThreadMain, this, queue_name, priority) {
   int fds[2];
   RTC_CHECK(pipe(fds) == 0);
@@ -184,6 +189,8 @@ TaskQueueLibevent::TaskQueueLibevent(absl::string_view queue_name,
   EventAssign(&wakeup_event_, event_base_, wakeup_pipe_out_,
               EV_READ | EV_PERSIST, OnWakeup, this);
   event_add(&wakeup_event_, 0);
+  EventAssign(&timer_event_, event_base_, -1, 0, &TaskQueueLibevent::RunTimer,
+              this);
   thread_.Start();
 }
 
@@ -202,6 +209,7 @@ void TaskQueueLibevent::Delete() {
   thread_.Stop();
 
   event_del(&wakeup_event_);
+  event_del(&timer_event_);
 
   IgnoreSigPipeSignalOnCurrentThread();
 
@@ -240,13 +248,9 @@ void TaskQueueLibevent::PostTask(std::unique_ptr<QueuedTask> task) {
 void TaskQueueLibevent::PostDelayedTask(std::unique_ptr<QueuedTask> task,
                                         uint32_t milliseconds) {
   if (IsCurrent()) {
-    TimerEvent* timer = new TimerEvent(this, std::move(task));
-    EventAssign(&timer->ev, event_base_, -1, 0, &TaskQueueLibevent::RunTimer,
-                timer);
-    pending_timers_.push_back(timer);
-    timeval tv = {rtc::dchecked_cast<int>(milliseconds / 1000),
-                  rtc::dchecked_cast<int>(milliseconds % 1000) * 1000};
-    event_add(&timer->ev, &tv);
+    delayed_tasks_.Schedule(std::move(task), rtc::TimeMillis() + milliseconds,
+                            delayed_next_order_++);
+    ScheduleNextTimer();
   } else {
     PostTask(std::make_unique<SetTimerTask>(std::move(task), milliseconds));
   }
@@ -261,9 +265,8 @@ void TaskQueueLibevent::ThreadMain(void* context) {
     while (me->is_active_)
       event_base_loop(me->event_base_, 0);
   }
-
-  for (TimerEvent* timer : me->pending_timers_)
-    delete timer;
+  // Tasks still scheduled in |delayed_tasks_| are released by its
+  // destructor.
 }
 
 // static
@@ -287,6 +290,7 @@ void TaskQueueLibevent::OnWakeup(int socket,
       }
       RTC_DCHECK(!tasks.empty());
       for (auto& task : tasks) {
+        rtc::TaskSampler::Scope sampler_scope(me->name_.c_str());
         if (task->Run()) {
           task.reset();
         } else {
@@ -306,11 +310,25 @@ void TaskQueueLibevent::OnWakeup(int socket,
 void TaskQueueLibevent::RunTimer(int fd,
                                  short flags,  // NOLINT
                                  void* context) {
-  TimerEvent* timer = static_cast<TimerEvent*>(context);
-  if (!timer->task->Run())
-    timer->task.release();
-  timer->task_queue->pending_timers_.remove(timer);
-  delete timer;
+  TaskQueueLibevent* me = static_cast<TaskQueueLibevent*>(context);
+  while (std::unique_ptr<QueuedTask> task =
+             me->delayed_tasks_.PopExpired(rtc::TimeMillis())) {
+    rtc::TaskSampler::Scope sampler_scope(me->name_.c_str());
+    if (!task->Run())
+      task.release();
+  }
+  me->ScheduleNextTimer();
+}
+
+void TaskQueueLibevent::ScheduleNextTimer() {
+  int64_t delay_ms = delayed_tasks_.TimeUntilNextFireMs(rtc::TimeMillis());
+  if (delay_ms < 0)
+    return;
+  // Re-adding an already armed event reschedules it, so the timer always
+  // tracks the earliest pending fire time.
+  timeval tv = {rtc::dchecked_cast<int>(delay_ms / 1000),
+                rtc::dchecked_cast<int>(delay_ms % 1000) * 1000};
+  event_add(&timer_event_, &tv);
 }
 
 class TaskQueueLibeventFactory final : public TaskQueueFactory {
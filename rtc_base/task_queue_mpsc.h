@@ -0,0 +1,28 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_TASK_QUEUE_MPSC_H_
+#define RTC_BASE_TASK_QUEUE_MPSC_H_
+
+#include <memory>
+
+#include "api/task_queue/task_queue_factory.h"
+
+namespace webrtc {
+
+// Creates a factory for task queues tuned for high-frequency posting:
+// PostTask() appends to a lock-free multi-producer single-consumer list
+// and only signals the worker thread when it has actually gone to sleep,
+// so a burst of posts costs at most one wakeup.
+std::unique_ptr<TaskQueueFactory> CreateTaskQueueMpscFactory();
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_TASK_QUEUE_MPSC_H_
@@ -13,9 +13,9 @@
 #include <string.h>
 
 #include <algorithm>
-#include <map>
 #include <memory>
 #include <queue>
+#include <string>
 #include <utility>
 
 #include "absl/strings/string_view.h"
@@ -26,8 +26,10 @@
 #include "rtc_base/event.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/platform_thread.h"
+#include "rtc_base/task_sampler.h"
 #include "rtc_base/thread_annotations.h"
 #include "rtc_base/time_utils.h"
+#include "rtc_base/timer_wheel.h"
 
 namespace webrtc {
 namespace {
@@ -60,16 +62,6 @@ class TaskQueueStdlib final : public TaskQueueBase {
  private:
   using OrderId = uint64_t;
 
-  struct DelayedEntryTimeout {
-    int64_t next_fire_at_ms_{};
-    OrderId order_{};
-
-    bool operator<(const DelayedEntryTimeout& o) const {
-      return std::tie(next_fire_at_ms_, order_) <
-             std::tie(o.next_fire_at_ms_, o.order_);
-    }
-  };
-
   struct NextTask {
     bool final_task_{false};
     std::unique_ptr<QueuedTask> run_task_;
@@ -93,6 +85,9 @@ class TaskQueueStdlib final : public TaskQueueBase {
   // Signaled whenever a new task is pending.
   rtc::Event flag_notify_;
 
+  // Kept for attributing sampled tasks to this queue, see TaskSampler.
+  const std::string name_;
+
   // Contains the active worker thread assigned to processing
   // tasks (including delayed tasks).
   rtc::PlatformThread thread_;
@@ -111,14 +106,11 @@ class TaskQueueStdlib final : public TaskQueueBase {
   std::queue<std::pair<OrderId, std::unique_ptr<QueuedTask>>> pending_queue_
       RTC_GUARDED_BY(pending_lock_);
 
-  // The list of all pending tasks that need to be processed at a future
-  // time based upon a delay. On the off change the delayed task should
-  // happen at exactly the same time interval as another task then the
-  // task is processed based on FIFO ordering. std::priority_queue was
-  // considered but rejected due to its inability to extract the
-  // std::unique_ptr out of the queue without the presence of a hack.
-  std::map<DelayedEntryTimeout, std::unique_ptr<QueuedTask>> delayed_queue_
-      RTC_GUARDED_BY(pending_lock_);
+  // All pending tasks that need to be processed at a future time based
+  // upon a delay. On the off chance a delayed task should happen at
+  // exactly the same time as another task it is processed in posting
+  // order, keyed by the same OrderId space as |pending_queue_|.
+  TimerWheel delayed_tasks_ RTC_GUARDED_BY(pending_lock_);
 };
 
 TaskQueueStdlib::TaskQueueStdlib(absl::string_view queue_name,
@@ -126,6 +118,7 @@ TaskQueueStdlib::TaskQueueStdlib(absl::string_view queue_name,
     : started_(/*manual_reset=*/false, /*initially_signaled=*/false),
       stopped_(/*manual_reset=*/false, /*initially_signaled=*/false),
       flag_notify_(/*manual_reset=*/false, /*initially_signaled=*/false),
+      name_(queue_name),
       thread_(&TaskQueueStdlib::ThreadMain, this, queue_name, priority) {
   thread_.Start();
   started_.Wait(rtc::Event::kForever);
@@ -162,13 +155,10 @@ void TaskQueueStdlib::PostDelayedTask(std::unique_ptr<QueuedTask> task,
                                       uint32_t milliseconds) {
   auto fire_at = rtc::TimeMillis() + milliseconds;
 
-  DelayedEntryTimeout delay;
-  delay.next_fire_at_ms_ = fire_at;
-
   {
     rtc::CritScope lock(&pending_lock_);
-    delay.order_ = ++thread_posting_order_;
-    delayed_queue_[delay] = std::move(task);
+    delayed_tasks_.Schedule(std::move(task), fire_at,
+                            ++thread_posting_order_);
   }
 
   NotifyWake();
@@ -186,30 +176,27 @@ TaskQueueStdlib::NextTask TaskQueueStdlib::GetNextTask() {
     return result;
   }
 
-  if (delayed_queue_.size() > 0) {
-    auto delayed_entry = delayed_queue_.begin();
-    const auto& delay_info = delayed_entry->first;
-    auto& delay_run = delayed_entry->second;
-    if (tick >= delay_info.next_fire_at_ms_) {
-      if (pending_queue_.size() > 0) {
-        auto& entry = pending_queue_.front();
-        auto& entry_order = entry.first;
-        auto& entry_run = entry.second;
-        if (entry_order < delay_info.order_) {
-          result.run_task_ = std::move(entry_run);
-          pending_queue_.pop();
-          return result;
-        }
+  OrderId delayed_order{};
+  if (delayed_tasks_.PeekExpiredOrder(tick, &delayed_order)) {
+    if (pending_queue_.size() > 0) {
+      auto& entry = pending_queue_.front();
+      auto& entry_order = entry.first;
+      auto& entry_run = entry.second;
+      if (entry_order < delayed_order) {
+        result.run_task_ = std::move(entry_run);
+        pending_queue_.pop();
+        return result;
       }
-
-      result.run_task_ = std::move(delay_run);
-      delayed_queue_.erase(delayed_entry);
-      return result;
     }
 
-    result.sleep_time_ms_ = delay_info.next_fire_at_ms_ - tick;
+    result.run_task_ = delayed_tasks_.PopExpired(tick);
+    return result;
   }
 
+  int64_t until_next_fire_ms = delayed_tasks_.TimeUntilNextFireMs(tick);
+  if (until_next_fire_ms > 0)
+    result.sleep_time_ms_ = until_next_fire_ms;
+
   if (pending_queue_.size() > 0) {
     auto& entry = pending_queue_.front();
     result.run_task_ = std::move(entry.second);
@@ -238,8 +225,11 @@ void TaskQueueStdlib::ProcessTasks() {
     if (task.run_task_) {
       // process entry immediately then try again
       QueuedTask* release_ptr = task.run_task_.release();
-      if (release_ptr->Run())
-        delete release_ptr;
+      {
+        rtc::TaskSampler::Scope sampler_scope(name_.c_str());
+        if (release_ptr->Run())
+          delete release_ptr;
+      }
 
       // attempt to sleep again
       continue;
@@ -0,0 +1,205 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/task_sampler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <set>
+
+#include "rtc_base/cpu_time.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/time_utils.h"
+
+namespace rtc {
+namespace {
+
+constexpr uint64_t kRingSize = 256;
+static_assert((kRingSize & (kRingSize - 1)) == 0, "kRingSize must be 2^n");
+
+// One recorded task dispatch. Either |file|/|line|/|function| are set (a
+// Thread message, strings are long-lived constants) or |queue_name| points
+// at an interned copy of the task queue name. Fields are individually
+// atomic so a reader racing the owning writer gets at worst a mix of two
+// samples, never undefined behavior.
+struct Sample {
+  std::atomic<const char*> file{nullptr};
+  std::atomic<int32_t> line{0};
+  std::atomic<const char*> function{nullptr};
+  std::atomic<const char*> queue_name{nullptr};
+  std::atomic<uint32_t> wall_us{0};
+  std::atomic<uint32_t> cpu_us{0};
+};
+
+// Written only by the owning thread; read concurrently by GetReport().
+struct Ring {
+  std::atomic<uint64_t> write_index{0};
+  Sample samples[kRingSize];
+};
+
+std::atomic<bool> g_enabled{false};
+
+CriticalSection* RegistryLock() {
+  static CriticalSection* const lock = new CriticalSection();
+  return lock;
+}
+
+// Rings are intentionally leaked when threads exit: samples may still be
+// aggregated afterwards and the cost is bounded by the number of threads
+// ever sampled, mirroring other process-lifetime state in rtc_base.
+std::vector<Ring*>* Registry() {
+  static std::vector<Ring*>* const registry = new std::vector<Ring*>();
+  return registry;
+}
+
+Ring* GetThreadRing() {
+  thread_local Ring* ring = nullptr;
+  if (!ring) {
+    ring = new Ring();
+    CritScope lock(RegistryLock());
+    Registry()->push_back(ring);
+  }
+  return ring;
+}
+
+// Maps a queue name to a pointer that stays valid after the queue dies, so
+// samples can outlive the queue that produced them. A worker thread serves
+// a single queue, so the one-entry thread-local cache makes the registry
+// lock a once-per-thread cost rather than a per-sample one.
+const char* InternQueueName(const char* raw_name) {
+  thread_local const char* cached_raw = nullptr;
+  thread_local const char* cached_interned = nullptr;
+  if (raw_name == cached_raw) {
+    return cached_interned;
+  }
+  static std::set<std::string>* const names = new std::set<std::string>();
+  const char* interned;
+  {
+    CritScope lock(RegistryLock());
+    interned = names->insert(raw_name).first->c_str();
+  }
+  cached_raw = raw_name;
+  cached_interned = interned;
+  return interned;
+}
+
+std::string SampleName(const Sample& sample) {
+  const char* queue_name = sample.queue_name.load(std::memory_order_relaxed);
+  if (queue_name) {
+    return std::string(queue_name);
+  }
+  const char* file = sample.file.load(std::memory_order_relaxed);
+  if (!file) {
+    return std::string();
+  }
+  char buffer[256];
+  SimpleStringBuilder sb(buffer);
+  sb << file << ":" << sample.line.load(std::memory_order_relaxed) << " "
+     << sample.function.load(std::memory_order_relaxed);
+  return sb.str();
+}
+
+}  // namespace
+
+void TaskSampler::Enable() {
+  g_enabled.store(true, std::memory_order_release);
+}
+
+void TaskSampler::Disable() {
+  g_enabled.store(false, std::memory_order_release);
+}
+
+bool TaskSampler::IsEnabled() {
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+std::vector<TaskSampler::TaskStats> TaskSampler::GetReport() {
+  std::map<std::string, TaskStats> aggregate;
+  {
+    CritScope lock(RegistryLock());
+    for (Ring* ring : *Registry()) {
+      const uint64_t end = ring->write_index.load(std::memory_order_acquire);
+      const uint64_t count = std::min(end, kRingSize);
+      for (uint64_t i = end - count; i < end; ++i) {
+        // A sample may be overwritten while it is read; the torn values can
+        // skew one entry of a diagnostic report, which is acceptable.
+        const Sample& sample = ring->samples[i & (kRingSize - 1)];
+        const std::string name = SampleName(sample);
+        if (name.empty()) {
+          continue;  // Slot has never been written.
+        }
+        const uint32_t wall_us =
+            sample.wall_us.load(std::memory_order_relaxed);
+        TaskStats& stats = aggregate[name];
+        ++stats.count;
+        stats.total_wall_us += wall_us;
+        stats.total_cpu_us += sample.cpu_us.load(std::memory_order_relaxed);
+        stats.max_wall_us = std::max<int64_t>(stats.max_wall_us, wall_us);
+      }
+    }
+  }
+  std::vector<TaskStats> report;
+  report.reserve(aggregate.size());
+  for (auto& entry : aggregate) {
+    entry.second.name = entry.first;
+    report.push_back(std::move(entry.second));
+  }
+  std::sort(report.begin(), report.end(),
+            [](const TaskStats& a, const TaskStats& b) {
+              return a.total_cpu_us > b.total_cpu_us;
+            });
+  return report;
+}
+
+TaskSampler::Scope::Scope(const char* file, int line, const char* function)
+    : active_(IsEnabled()), file_(file), line_(line), function_(function) {
+  if (active_) {
+    start_wall_us_ = TimeMicros();
+    start_cpu_ns_ = GetThreadCpuTimeNanos();
+  }
+}
+
+TaskSampler::Scope::Scope(const char* queue_name)
+    : active_(IsEnabled()), queue_name_(queue_name) {
+  if (active_) {
+    start_wall_us_ = TimeMicros();
+    start_cpu_ns_ = GetThreadCpuTimeNanos();
+  }
+}
+
+TaskSampler::Scope::~Scope() {
+  if (!active_) {
+    return;
+  }
+  Ring* ring = GetThreadRing();
+  const uint64_t index =
+      ring->write_index.load(std::memory_order_relaxed) & (kRingSize - 1);
+  Sample& sample = ring->samples[index];
+  sample.wall_us.store(static_cast<uint32_t>(TimeMicros() - start_wall_us_),
+                       std::memory_order_relaxed);
+  sample.cpu_us.store(
+      static_cast<uint32_t>((GetThreadCpuTimeNanos() - start_cpu_ns_) / 1000),
+      std::memory_order_relaxed);
+  if (queue_name_) {
+    sample.file.store(nullptr, std::memory_order_relaxed);
+    sample.queue_name.store(InternQueueName(queue_name_),
+                            std::memory_order_relaxed);
+  } else {
+    sample.queue_name.store(nullptr, std::memory_order_relaxed);
+    sample.file.store(file_, std::memory_order_relaxed);
+    sample.line.store(line_, std::memory_order_relaxed);
+    sample.function.store(function_, std::memory_order_relaxed);
+  }
+  ring->write_index.fetch_add(1, std::memory_order_release);
+}
+
+}  // namespace rtc
@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_TASK_SAMPLER_H_
+#define RTC_BASE_TASK_SAMPLER_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "rtc_base/system/rtc_export.h"
+
+namespace rtc {
+
+// Production-safe continuous profiling of task dispatch cost. Thread and the
+// task queue implementations wrap every dispatched message/task in a
+// TaskSampler::Scope, which records wall and thread-CPU time into a
+// lock-free per-thread ring when sampling is enabled. When disabled (the
+// default) a scope costs a single relaxed atomic load. GetReport()
+// aggregates the rings by task name - the posting location for Thread
+// messages, the queue name for task queue tasks - so a saturated media
+// thread can be attributed to a task class without attaching a profiler to
+// a live process.
+class RTC_EXPORT TaskSampler {
+ public:
+  // Aggregated cost of one task class, as named above.
+  struct TaskStats {
+    std::string name;
+    int64_t count = 0;
+    int64_t total_wall_us = 0;
+    int64_t total_cpu_us = 0;
+    int64_t max_wall_us = 0;
+  };
+
+  // Globally enables or disables sampling. Samples recorded before Enable()
+  // are discarded lazily as the rings wrap.
+  static void Enable();
+  static void Disable();
+  static bool IsEnabled();
+
+  // Aggregates the samples currently held in all per-thread rings, sorted
+  // by descending total CPU time. Rings are written concurrently; readers
+  // get a best-effort snapshot, which is fine for diagnostics.
+  static std::vector<TaskStats> GetReport();
+
+  // Measures one dispatched task on the current thread. Scopes must not be
+  // nested for the numbers to make sense, which holds for the dispatch
+  // loops where they are used.
+  class Scope {
+   public:
+    // For Thread messages: |file| and |function| must be long-lived string
+    // constants, as produced by RTC_FROM_HERE.
+    Scope(const char* file, int line, const char* function);
+    // For task queue tasks: |queue_name| is interned (copied to a
+    // process-lifetime string) when the scope closes and may die with the
+    // queue afterwards.
+    explicit Scope(const char* queue_name);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    bool active_;
+    const char* file_ = nullptr;
+    int line_ = 0;
+    const char* function_ = nullptr;
+    const char* queue_name_ = nullptr;
+    int64_t start_wall_us_ = 0;
+    int64_t start_cpu_ns_ = 0;
+  };
+};
+
+}  // namespace rtc
+
+#endif  // RTC_BASE_TASK_SAMPLER_H_
@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/task_sampler.h"
+
+#include <memory>
+
+#include "rtc_base/event.h"
+#include "rtc_base/location.h"
+#include "rtc_base/task_queue_for_test.h"
+#include "rtc_base/thread.h"
+#include "test/gtest.h"
+
+namespace rtc {
+namespace {
+
+class TaskSamplerTest : public ::testing::Test {
+ protected:
+  TaskSamplerTest() { TaskSampler::Enable(); }
+  ~TaskSamplerTest() override { TaskSampler::Disable(); }
+};
+
+const TaskSampler::TaskStats* FindByName(
+    const std::vector<TaskSampler::TaskStats>& report,
+    const std::string& name) {
+  for (const TaskSampler::TaskStats& stats : report) {
+    if (stats.name == name)
+      return &stats;
+  }
+  return nullptr;
+}
+
+TEST_F(TaskSamplerTest, DisabledScopeRecordsNothing) {
+  TaskSampler::Disable();
+  { TaskSampler::Scope scope("idle_queue"); }
+  EXPECT_EQ(nullptr, FindByName(TaskSampler::GetReport(), "idle_queue"));
+}
+
+TEST_F(TaskSamplerTest, AttributesQueueTasksByQueueName) {
+  {
+    webrtc::TaskQueueForTest queue("sampled_queue");
+    queue.SendTask([] {}, RTC_FROM_HERE);
+    queue.SendTask([] {}, RTC_FROM_HERE);
+  }
+  const std::vector<TaskSampler::TaskStats> report = TaskSampler::GetReport();
+  const TaskSampler::TaskStats* stats = FindByName(report, "sampled_queue");
+  ASSERT_NE(nullptr, stats);
+  EXPECT_GE(stats->count, 2);
+  EXPECT_GE(stats->total_wall_us, 0);
+  EXPECT_GE(stats->max_wall_us, 0);
+}
+
+TEST_F(TaskSamplerTest, AttributesThreadMessagesByPostingLocation) {
+  const Location posted_from = RTC_FROM_HERE;
+  auto thread = Thread::Create();
+  thread->Start();
+  Event done;
+  thread->PostTask(RTC_FROM_HERE, [&done] { done.Set(); });
+  EXPECT_TRUE(done.Wait(/*give_up_after_ms=*/5000));
+  thread->Stop();
+  // Thread messages are named "<file>:<line> <function>"; match on the
+  // file and function, the posting line differs from |posted_from|.
+  bool found = false;
+  for (const TaskSampler::TaskStats& stats : TaskSampler::GetReport()) {
+    if (stats.name.find(posted_from.file_name()) != std::string::npos &&
+        stats.name.find(posted_from.function_name()) != std::string::npos) {
+      found = true;
+      EXPECT_GE(stats.count, 1);
+    }
+  }
+  EXPECT_TRUE(found);
+}
+
+TEST_F(TaskSamplerTest, ReportIsSortedByDescendingCpuTime) {
+  {
+    webrtc::TaskQueueForTest queue("sort_check_queue");
+    queue.SendTask(
+        [] {
+          // Burn a little CPU so the entry has non-trivial cost.
+          volatile int sink = 0;
+          for (int i = 0; i < 100000; ++i)
+            sink += i;
+        },
+        RTC_FROM_HERE);
+  }
+  const std::vector<TaskSampler::TaskStats> report = TaskSampler::GetReport();
+  for (size_t i = 1; i < report.size(); ++i) {
+    EXPECT_GE(report[i - 1].total_cpu_us, report[i].total_cpu_us);
+  }
+}
+
+}  // namespace
+}  // namespace rtc
@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "rtc_base/task_utils/pooled_task_queue_factory.h"
+
+#include <utility>
+
+#include "api/task_queue/queued_task.h"
+#include "rtc_base/checks.h"
+#include "rtc_base/critical_section.h"
+#include "rtc_base/strings/string_builder.h"
+#include "rtc_base/thread_annotations.h"
+
+namespace webrtc {
+namespace {
+
+// A logical serial task queue that runs all of its tasks on a worker task
+// queue owned by the factory. Posted tasks are wrapped so that they set the
+// correct TaskQueueBase::Current() while running and so that tasks still
+// pending on the worker when the queue is deleted are dropped rather than run.
+class MultiplexedTaskQueue final : public TaskQueueBase {
+ public:
+  explicit MultiplexedTaskQueue(TaskQueueBase* worker)
+      : worker_(worker), control_(std::make_shared<Control>()) {}
+
+  void Delete() override {
+    RTC_DCHECK(!IsCurrent());
+    {
+      // Taking the lock blocks until a task running on behalf of this queue
+      // has finished; tasks still pending on the worker see |deleted| and are
+      // dropped by their wrappers.
+      rtc::CritScope cs(&control_->lock);
+      control_->deleted = true;
+    }
+    delete this;
+  }
+
+  void PostTask(std::unique_ptr<QueuedTask> task) override {
+    worker_->PostTask(
+        std::make_unique<WrapperTask>(this, control_, std::move(task)));
+  }
+
+  void PostDelayedTask(std::unique_ptr<QueuedTask> task,
+                       uint32_t milliseconds) override {
+    worker_->PostDelayedTask(
+        std::make_unique<WrapperTask>(this, control_, std::move(task)),
+        milliseconds);
+  }
+
+ private:
+  // Shared between the queue and its in-flight wrapper tasks, which may
+  // outlive the queue on the worker.
+  struct Control {
+    rtc::CriticalSection lock;
+    bool deleted RTC_GUARDED_BY(lock) = false;
+  };
+
+  class WrapperTask : public QueuedTask {
+   public:
+    WrapperTask(MultiplexedTaskQueue* queue,
+                std::shared_ptr<Control> control,
+                std::unique_ptr<QueuedTask> task)
+        : queue_(queue), control_(std::move(control)), task_(std::move(task)) {}
+
+    bool Run() override {
+      rtc::CritScope cs(&control_->lock);
+      if (control_->deleted)
+        return true;
+      // |queue_| is valid as long as |deleted| is false and the lock is held.
+      CurrentTaskQueueSetter set_current(queue_);
+      if (!task_->Run())
+        task_.release();
+      return true;
+    }
+
+   private:
+    MultiplexedTaskQueue* const queue_;
+    const std::shared_ptr<Control> control_;
+    std::unique_ptr<QueuedTask> task_;
+  };
+
+  ~MultiplexedTaskQueue() override = default;
+
+  TaskQueueBase* const worker_;
+  const std::shared_ptr<Control> control_;
+};
+
+}  // namespace
+
+PooledTaskQueueFactory::PooledTaskQueueFactory(
+    const TaskQueueFactory& worker_factory,
+    size_t num_workers,
+    absl::string_view worker_name,
+    Priority priority) {
+  RTC_DCHECK_GT(num_workers, 0u);
+  for (size_t i = 0; i < num_workers; ++i) {
+    char buffer[64];
+    rtc::SimpleStringBuilder name(buffer);
+    name << std::string(worker_name) << i;
+    workers_.push_back(worker_factory.CreateTaskQueue(name.str(), priority));
+  }
+}
+
+PooledTaskQueueFactory::~PooledTaskQueueFactory() = default;
+
+std::unique_ptr<TaskQueueBase, TaskQueueDeleter>
+PooledTaskQueueFactory::CreateTaskQueue(absl::string_view name,
+                                        Priority priority) const {
+  TaskQueueBase* worker =
+      workers_[next_worker_.fetch_add(1) % workers_.size()].get();
+  return std::unique_ptr<TaskQueueBase, TaskQueueDeleter>(
+      new MultiplexedTaskQueue(worker));
+}
+
+}  // namespace webrtc
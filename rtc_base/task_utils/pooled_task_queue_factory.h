@@ -0,0 +1,57 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#ifndef RTC_BASE_TASK_UTILS_POOLED_TASK_QUEUE_FACTORY_H_
+#define RTC_BASE_TASK_UTILS_POOLED_TASK_QUEUE_FACTORY_H_
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+#include "api/task_queue/task_queue_base.h"
+#include "api/task_queue/task_queue_factory.h"
+
+namespace webrtc {
+
+// TaskQueueFactory that multiplexes the task queues it creates onto a fixed
+// set of worker task queues created up front, so that the number of underlying
+// threads scales with the size of the pool rather than with the number of
+// queues. Each created queue is pinned to one worker in round-robin order;
+// tasks posted to one queue therefore still run strictly in FIFO order and
+// never overlap, but tasks posted to different queues that share a worker do
+// not run in parallel.
+//
+// All task queues created by this factory must be deleted before the factory
+// itself is destroyed.
+class PooledTaskQueueFactory : public TaskQueueFactory {
+ public:
+  // Creates |num_workers| worker task queues using |worker_factory|, named
+  // |worker_name| plus a numeric suffix. |worker_factory| is only used during
+  // construction.
+  PooledTaskQueueFactory(const TaskQueueFactory& worker_factory,
+                         size_t num_workers,
+                         absl::string_view worker_name,
+                         Priority priority);
+  ~PooledTaskQueueFactory() override;
+
+  std::unique_ptr<TaskQueueBase, TaskQueueDeleter> CreateTaskQueue(
+      absl::string_view name,
+      Priority priority) const override;
+
+ private:
+  std::vector<std::unique_ptr<TaskQueueBase, TaskQueueDeleter>> workers_;
+  // Round-robin cursor used to pin new queues to workers. Mutable since
+  // CreateTaskQueue is const.
+  mutable std::atomic<size_t> next_worker_{0};
+};
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_TASK_UTILS_POOLED_TASK_QUEUE_FACTORY_H_
@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2020 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+#include "rtc_base/task_utils/pooled_task_queue_factory.h"
+
+#include <memory>
+#include <vector>
+
+#include "api/task_queue/default_task_queue_factory.h"
+#include "api/task_queue/task_queue_base.h"
+#include "rtc_base/event.h"
+#include "rtc_base/task_utils/to_queued_task.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+constexpr int kTimeoutMs = 1000;
+using Priority = TaskQueueFactory::Priority;
+
+TEST(PooledTaskQueueFactoryTest, PostedTasksRunInOrder) {
+  auto base_factory = CreateDefaultTaskQueueFactory();
+  PooledTaskQueueFactory factory(*base_factory, 2, "PooledWorker",
+                                 Priority::NORMAL);
+  auto queue = factory.CreateTaskQueue("queue", Priority::NORMAL);
+
+  std::vector<int> order;
+  rtc::Event done;
+  for (int i = 0; i < 10; ++i) {
+    queue->PostTask(ToQueuedTask([&order, i] { order.push_back(i); }));
+  }
+  queue->PostTask(ToQueuedTask([&done] { done.Set(); }));
+  ASSERT_TRUE(done.Wait(kTimeoutMs));
+
+  ASSERT_EQ(order.size(), 10u);
+  for (int i = 0; i < 10; ++i)
+    EXPECT_EQ(order[i], i);
+}
+
+TEST(PooledTaskQueueFactoryTest, CurrentPointsToCreatedQueue) {
+  auto base_factory = CreateDefaultTaskQueueFactory();
+  PooledTaskQueueFactory factory(*base_factory, 1, "PooledWorker",
+                                 Priority::NORMAL);
+  auto queue = factory.CreateTaskQueue("queue", Priority::NORMAL);
+
+  TaskQueueBase* current = nullptr;
+  bool is_current = false;
+  rtc::Event done;
+  queue->PostTask(ToQueuedTask([&] {
+    current = TaskQueueBase::Current();
+    is_current = queue->IsCurrent();
+    done.Set();
+  }));
+  ASSERT_TRUE(done.Wait(kTimeoutMs));
+
+  EXPECT_EQ(current, queue.get());
+  EXPECT_TRUE(is_current);
+}
+
+TEST(PooledTaskQueueFactoryTest, QueuesSharingWorkerKeepSeparateCurrent) {
+  auto base_factory = CreateDefaultTaskQueueFactory();
+  PooledTaskQueueFactory factory(*base_factory, 1, "PooledWorker",
+                                 Priority::NORMAL);
+  auto queue1 = factory.CreateTaskQueue("queue1", Priority::NORMAL);
+  auto queue2 = factory.CreateTaskQueue("queue2", Priority::NORMAL);
+
+  TaskQueueBase* current1 = nullptr;
+  TaskQueueBase* current2 = nullptr;
+  rtc::Event done;
+  queue1->PostTask(
+      ToQueuedTask([&current1] { current1 = TaskQueueBase::Current(); }));
+  queue2->PostTask(ToQueuedTask([&] {
+    current2 = TaskQueueBase::Current();
+    done.Set();
+  }));
+  ASSERT_TRUE(done.Wait(kTimeoutMs));
+
+  EXPECT_EQ(current1, queue1.get());
+  EXPECT_EQ(current2, queue2.get());
+}
+
+TEST(PooledTaskQueueFactoryTest, PendingTasksDroppedOnDelete) {
+  auto base_factory = CreateDefaultTaskQueueFactory();
+  PooledTaskQueueFactory factory(*base_factory, 1, "PooledWorker",
+                                 Priority::NORMAL);
+  auto queue1 = factory.CreateTaskQueue("queue1", Priority::NORMAL);
+  auto queue2 = factory.CreateTaskQueue("queue2", Priority::NORMAL);
+
+  rtc::Event blocker;
+  rtc::Event done;
+  bool ran = false;
+  // Block the shared worker so that the task posted to |queue2| is still
+  // pending when |queue2| is deleted.
+  queue1->PostTask(
+      ToQueuedTask([&blocker] { blocker.Wait(rtc::Event::kForever); }));
+  queue2->PostTask(ToQueuedTask([&ran] { ran = true; }));
+  queue2 = nullptr;
+  blocker.Set();
+  queue1->PostTask(ToQueuedTask([&done] { done.Set(); }));
+  ASSERT_TRUE(done.Wait(kTimeoutMs));
+
+  EXPECT_FALSE(ran);
+}
+
+TEST(PooledTaskQueueFactoryTest, RunsDelayedTask) {
+  auto base_factory = CreateDefaultTaskQueueFactory();
+  PooledTaskQueueFactory factory(*base_factory, 1, "PooledWorker",
+                                 Priority::NORMAL);
+  auto queue = factory.CreateTaskQueue("queue", Priority::NORMAL);
+
+  rtc::Event done;
+  queue->PostDelayedTask(ToQueuedTask([&done] { done.Set(); }), 10);
+  EXPECT_TRUE(done.Wait(kTimeoutMs));
+}
+
+}  // namespace
+}  // namespace webrtc
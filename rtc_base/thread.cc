@@ -26,6 +26,7 @@
 
 #include <stdio.h>
 
+#include <deque>
 #include <utility>
 
 #include "absl/algorithm/container.h"
@@ -34,6 +35,7 @@
 #include "rtc_base/critical_section.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/null_socket_server.h"
+#include "rtc_base/task_sampler.h"
 #include "rtc_base/task_utils/to_queued_task.h"
 #include "rtc_base/time_utils.h"
 #include "rtc_base/trace_event.h"
@@ -355,7 +357,6 @@ Thread::Thread(std::unique_ptr<SocketServer> ss)
 
 Thread::Thread(SocketServer* ss, bool do_init)
     : fPeekKeep_(false),
-      delayed_next_num_(0),
       fInitialized_(false),
       fDestroyed_(false),
       stop_(0),
@@ -468,15 +469,10 @@ bool Thread::Get(Message* pmsg, int cmsWait, bool process_io) {
         // triggered and calculate the next trigger time.
         if (first_pass) {
           first_pass = false;
-          while (!delayed_messages_.empty()) {
-            if (msCurrent < delayed_messages_.top().run_time_ms_) {
-              cmsDelayNext =
-                  TimeDiff(delayed_messages_.top().run_time_ms_, msCurrent);
-              break;
-            }
-            messages_.push_back(delayed_messages_.top().msg_);
-            delayed_messages_.pop();
-          }
+          delayed_messages_.PopDue(msCurrent, &messages_);
+          int64_t next_run_time = delayed_messages_.NextWakeTime();
+          if (next_run_time != -1)
+            cmsDelayNext = TimeDiff(next_run_time, msCurrent);
         }
         // Pull a message off the message queue, if available.
         if (messages_.empty()) {
@@ -586,7 +582,7 @@ void Thread::DoDelayPost(const Location& posted_from,
   }
 
   // Keep thread safe
-  // Add to the priority queue. Gets sorted soonest first.
+  // Add to the timing wheel, keyed by the trigger time.
   // Signal for the multiplexer to return.
 
   {
@@ -596,13 +592,7 @@ void Thread::DoDelayPost(const Location& posted_from,
     msg.phandler = phandler;
     msg.message_id = id;
     msg.pdata = pdata;
-    DelayedMessage delayed(delay_ms, run_at_ms, delayed_next_num_, msg);
-    delayed_messages_.push(delayed);
-    // If this message queue processes 1 message every millisecond for 50 days,
-    // we will wrap this number.  Even then, only messages with identical times
-    // will be misordered, and then only briefly.  This is probably ok.
-    ++delayed_next_num_;
-    RTC_DCHECK_NE(0, delayed_next_num_);
+    delayed_messages_.Push(DelayedMessage(delay_ms, run_at_ms, msg));
   }
   WakeUpSocketServer();
 }
@@ -613,8 +603,9 @@ int Thread::GetDelay() {
   if (!messages_.empty())
     return 0;
 
-  if (!delayed_messages_.empty()) {
-    int delay = TimeUntil(delayed_messages_.top().run_time_ms_);
+  int64_t next_run_time = delayed_messages_.NextWakeTime();
+  if (next_run_time != -1) {
+    int delay = TimeUntil(next_run_time);
     if (delay < 0)
       delay = 0;
     return delay;
@@ -652,29 +643,140 @@ void Thread::ClearInternal(MessageHandler* phandler,
     }
   }
 
-  // Remove from priority queue. Not directly iterable, so use this approach
+  // Remove from the timing wheel
 
-  auto new_end = delayed_messages_.container().begin();
-  for (auto it = new_end; it != delayed_messages_.container().end(); ++it) {
-    if (it->msg_.Match(phandler, id)) {
-      if (removed) {
-        removed->push_back(it->msg_);
-      } else {
-        delete it->msg_.pdata;
+  delayed_messages_.Remove(phandler, id, removed);
+}
+
+void Thread::TimingWheel::Push(const DelayedMessage& dmsg) {
+  if (size_ == 0) {
+    // An empty wheel carries no time reference, so re-anchor it to the
+    // poster's clock (the trigger time minus the delay is the current time).
+    current_tick_ = dmsg.run_time_ms_ - dmsg.delay_ms_;
+  }
+  Insert(dmsg);
+  ++size_;
+}
+
+void Thread::TimingWheel::Insert(const DelayedMessage& dmsg) {
+  // Messages that are already due are parked in the next slot PopDue()
+  // will process, so they are delivered on its next call.
+  int64_t target = std::max(dmsg.run_time_ms_, current_tick_);
+  int64_t delta = target - current_tick_;
+  int level = 0;
+  while (level < kNumLevels - 1 &&
+         delta >= (int64_t{1} << (kWheelBits * (level + 1)))) {
+    ++level;
+  }
+  size_t index = (target >> (kWheelBits * level)) & kWheelMask;
+  slots_[level][index].push_back(dmsg);
+}
+
+void Thread::TimingWheel::MaybeCascade(int64_t tick) {
+  // When |tick| enters a new window of some level, the slot of that level
+  // covering the window is redistributed to the levels below it. Highest
+  // level first, so entries can cascade all the way down in one pass.
+  for (int level = kNumLevels - 1; level >= 1; --level) {
+    if ((tick & ((int64_t{1} << (kWheelBits * level)) - 1)) != 0)
+      continue;
+    size_t index = (tick >> (kWheelBits * level)) & kWheelMask;
+    std::vector<DelayedMessage> entries;
+    entries.swap(slots_[level][index]);
+    for (const DelayedMessage& dmsg : entries) {
+      Insert(dmsg);
+    }
+  }
+}
+
+void Thread::TimingWheel::PopDue(int64_t now, MessageList* due) {
+  if (size_ == 0) {
+    current_tick_ = now + 1;
+    return;
+  }
+  while (current_tick_ <= now) {
+    MaybeCascade(current_tick_);
+    std::vector<DelayedMessage>& slot = slots_[0][current_tick_ & kWheelMask];
+    if (!slot.empty()) {
+      for (const DelayedMessage& dmsg : slot) {
+        due->push_back(dmsg.msg_);
       }
-    } else {
-      *new_end++ = *it;
+      size_ -= slot.size();
+      slot.clear();
+      if (size_ == 0) {
+        current_tick_ = now + 1;
+        return;
+      }
+    }
+    ++current_tick_;
+    // Skip the empty stretch up to the next pending trigger time (or the
+    // cascade boundary in front of it) instead of visiting every
+    // millisecond of an idle period.
+    int64_t next = NextWakeTime();
+    if (next > current_tick_)
+      current_tick_ = std::min(next, now + 1);
+  }
+}
+
+int64_t Thread::TimingWheel::NextWakeTime() const {
+  if (size_ == 0)
+    return -1;
+  int64_t next = -1;
+  for (int level = 0; level < kNumLevels; ++level) {
+    const int shift = kWheelBits * level;
+    const int64_t pos = current_tick_ >> shift;
+    for (int i = 0; i < kWheelSize; ++i) {
+      if (slots_[level][i].empty())
+        continue;
+      // Number of level-|level| steps until |pos| lands on slot |i| again.
+      int64_t steps = (i - pos) & kWheelMask;
+      if (level > 0 && steps == 0 && current_tick_ != (pos << shift)) {
+        // The slot at the current position was already cascaded when its
+        // window was entered; anything in it is a full revolution away.
+        steps = kWheelSize;
+      }
+      // For the higher levels the window start is a lower bound on the
+      // trigger times in the slot; PopDue() cascades the slot when it
+      // reaches the window and refines the estimate.
+      int64_t candidate =
+          level == 0 ? current_tick_ + steps : (pos + steps) << shift;
+      if (next == -1 || candidate < next)
+        next = candidate;
+    }
+  }
+  return next;
+}
+
+void Thread::TimingWheel::Remove(MessageHandler* phandler,
+                                 uint32_t id,
+                                 MessageList* removed) {
+  for (int level = 0; level < kNumLevels; ++level) {
+    for (int i = 0; i < kWheelSize; ++i) {
+      std::vector<DelayedMessage>& slot = slots_[level][i];
+      auto new_end = slot.begin();
+      for (auto it = new_end; it != slot.end(); ++it) {
+        if (it->msg_.Match(phandler, id)) {
+          if (removed) {
+            removed->push_back(it->msg_);
+          } else {
+            delete it->msg_.pdata;
+          }
+          --size_;
+        } else {
+          *new_end++ = *it;
+        }
+      }
+      slot.erase(new_end, slot.end());
     }
   }
-  delayed_messages_.container().erase(new_end,
-                                      delayed_messages_.container().end());
-  delayed_messages_.reheap();
 }
 
 void Thread::Dispatch(Message* pmsg) {
   TRACE_EVENT2("webrtc", "Thread::Dispatch", "src_file",
                pmsg->posted_from.file_name(), "src_func",
                pmsg->posted_from.function_name());
+  TaskSampler::Scope sampler_scope(pmsg->posted_from.file_name(),
+                                   pmsg->posted_from.line_number(),
+                                   pmsg->posted_from.function_name());
   int64_t start_time = TimeMillis();
   pmsg->phandler->OnMessage(pmsg);
   int64_t end_time = TimeMillis();
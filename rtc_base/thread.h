@@ -16,7 +16,6 @@
 #include <list>
 #include <map>
 #include <memory>
-#include <queue>
 #include <set>
 #include <string>
 #include <type_traits>
@@ -451,37 +450,60 @@ class RTC_LOCKABLE RTC_EXPORT Thread : public webrtc::TaskQueueBase {
     rtc::Thread* const previous_;
   };
 
-  // DelayedMessage goes into a priority queue, sorted by trigger time. Messages
-  // with the same trigger time are processed in num_ (FIFO) order.
+  // DelayedMessage goes into the timing wheel, keyed by trigger time.
+  // Messages with the same trigger time are processed in the order they
+  // were posted.
   class DelayedMessage {
    public:
-    DelayedMessage(int64_t delay,
-                   int64_t run_time_ms,
-                   uint32_t num,
-                   const Message& msg)
-        : delay_ms_(delay),
-          run_time_ms_(run_time_ms),
-          message_number_(num),
-          msg_(msg) {}
-
-    bool operator<(const DelayedMessage& dmsg) const {
-      return (dmsg.run_time_ms_ < run_time_ms_) ||
-             ((dmsg.run_time_ms_ == run_time_ms_) &&
-              (dmsg.message_number_ < message_number_));
-    }
+    DelayedMessage(int64_t delay, int64_t run_time_ms, const Message& msg)
+        : delay_ms_(delay), run_time_ms_(run_time_ms), msg_(msg) {}
 
-    int64_t delay_ms_;  // for debugging
+    int64_t delay_ms_;  // for re-anchoring the wheel and debugging
     int64_t run_time_ms_;
-    // Monotonicaly incrementing number used for ordering of messages
-    // targeted to execute at the same time.
-    uint32_t message_number_;
     Message msg_;
   };
 
-  class PriorityQueue : public std::priority_queue<DelayedMessage> {
+  // Hierarchical timing wheel holding the delayed messages. Each level
+  // covers kWheelBits bits of the trigger time (in milliseconds), so
+  // insertion and expiry are O(1) amortized and stay flat no matter how
+  // many timers are pending, unlike a std::priority_queue whose push/pop
+  // cost grows with the queue size.
+  class TimingWheel {
    public:
-    container_type& container() { return c; }
-    void reheap() { make_heap(c.begin(), c.end(), comp); }
+    void Push(const DelayedMessage& dmsg);
+    // Appends every message whose trigger time has been reached at |now|
+    // to |due|, in trigger-time order, and advances the wheel to |now|.
+    void PopDue(int64_t now, MessageList* due);
+    // Returns a lower bound on the trigger time of the earliest pending
+    // message, or -1 if the wheel is empty. Waking up at the returned
+    // time and calling PopDue() converges on the exact trigger time
+    // after at most one cascade per level.
+    int64_t NextWakeTime() const;
+    // Removes every message matching |phandler| and |id| (in the
+    // Message::Match sense). Removed messages are appended to |removed|
+    // if non-null, otherwise their payloads are deleted.
+    void Remove(MessageHandler* phandler, uint32_t id, MessageList* removed);
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+   private:
+    static constexpr int kWheelBits = 8;
+    static constexpr int kWheelSize = 1 << kWheelBits;
+    static constexpr int kWheelMask = kWheelSize - 1;
+    static constexpr int kNumLevels = 4;
+
+    // Places |dmsg| in the slot covering its trigger time, without
+    // touching |size_|.
+    void Insert(const DelayedMessage& dmsg);
+    // Redistributes the slots of every level whose window starts at
+    // |tick| to the levels below them.
+    void MaybeCascade(int64_t tick);
+
+    std::vector<DelayedMessage> slots_[kNumLevels][kWheelSize];
+    // The next millisecond tick PopDue() will process. Re-anchored to the
+    // poster's clock whenever the wheel is empty.
+    int64_t current_tick_ = 0;
+    size_t size_ = 0;
   };
 
   void DoDelayPost(const Location& posted_from,
@@ -564,8 +586,7 @@ class RTC_LOCKABLE RTC_EXPORT Thread : public webrtc::TaskQueueBase {
   bool fPeekKeep_;
   Message msgPeek_;
   MessageList messages_ RTC_GUARDED_BY(crit_);
-  PriorityQueue delayed_messages_ RTC_GUARDED_BY(crit_);
-  uint32_t delayed_next_num_ RTC_GUARDED_BY(crit_);
+  TimingWheel delayed_messages_ RTC_GUARDED_BY(crit_);
   CriticalSection crit_;
   bool fInitialized_;
   bool fDestroyed_;
@@ -0,0 +1,175 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/timer_wheel.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "rtc_base/checks.h"
+
+namespace webrtc {
+
+TimerWheel::TimerWheel() = default;
+
+TimerWheel::~TimerWheel() {
+  for (Node* head : slots_)
+    DeleteList(head);
+  DeleteList(expired_head_);
+  DeleteList(free_list_);
+}
+
+void TimerWheel::Schedule(std::unique_ptr<QueuedTask> task,
+                          int64_t fire_at_ms,
+                          uint64_t order) {
+  RTC_DCHECK(task);
+  Node* node = AllocateNode();
+  node->fire_at_ms = fire_at_ms;
+  node->order = order;
+  node->task = std::move(task);
+  ++size_;
+
+  if (fire_at_ms <= cursor_ms_) {
+    // The cursor has already passed this entry's slot; it is due now.
+    InsertExpired(node);
+    return;
+  }
+
+  // The cursor next passes slot |fire_at_ms & kWheelMask| exactly at
+  // |fire_at_ms| (or a full turn later, in which case CollectExpired()
+  // leaves the entry in place until its actual fire time).
+  Node** head = &slots_[fire_at_ms & kWheelMask];
+  node->next = *head;
+  if (*head)
+    (*head)->prev = node;
+  *head = node;
+}
+
+bool TimerWheel::PeekExpiredOrder(int64_t now_ms, uint64_t* order) {
+  Advance(now_ms);
+  if (!expired_head_)
+    return false;
+  *order = expired_head_->order;
+  return true;
+}
+
+std::unique_ptr<QueuedTask> TimerWheel::PopExpired(int64_t now_ms) {
+  Advance(now_ms);
+  Node* node = expired_head_;
+  if (!node)
+    return nullptr;
+  Unlink(&expired_head_, node);
+  std::unique_ptr<QueuedTask> task = std::move(node->task);
+  FreeNode(node);
+  --size_;
+  return task;
+}
+
+int64_t TimerWheel::TimeUntilNextFireMs(int64_t now_ms) {
+  Advance(now_ms);
+  if (expired_head_)
+    return 0;
+  if (size_ == 0)
+    return -1;
+  int64_t next_fire_at_ms = std::numeric_limits<int64_t>::max();
+  for (Node* head : slots_) {
+    for (Node* node = head; node; node = node->next)
+      next_fire_at_ms = std::min(next_fire_at_ms, node->fire_at_ms);
+  }
+  RTC_DCHECK_GT(next_fire_at_ms, now_ms);
+  return next_fire_at_ms - now_ms;
+}
+
+TimerWheel::Node* TimerWheel::AllocateNode() {
+  if (!free_list_)
+    return new Node();
+  Node* node = free_list_;
+  Unlink(&free_list_, node);
+  return node;
+}
+
+void TimerWheel::FreeNode(Node* node) {
+  RTC_DCHECK(!node->task);
+  node->prev = nullptr;
+  node->next = free_list_;
+  if (free_list_)
+    free_list_->prev = node;
+  free_list_ = node;
+}
+
+// static
+void TimerWheel::Unlink(Node** head, Node* node) {
+  if (node->prev)
+    node->prev->next = node->next;
+  else
+    *head = node->next;
+  if (node->next)
+    node->next->prev = node->prev;
+  node->prev = nullptr;
+  node->next = nullptr;
+}
+
+// static
+void TimerWheel::DeleteList(Node* head) {
+  while (head) {
+    Node* next = head->next;
+    delete head;
+    head = next;
+  }
+}
+
+void TimerWheel::CollectExpired(Node** head, int64_t now_ms) {
+  Node* node = *head;
+  while (node) {
+    Node* next = node->next;
+    if (node->fire_at_ms <= now_ms) {
+      Unlink(head, node);
+      InsertExpired(node);
+    }
+    node = next;
+  }
+}
+
+void TimerWheel::InsertExpired(Node* node) {
+  // Keep the expired list sorted on (fire time, order). Entries expiring
+  // together are rare and typically only a handful, so a list walk is
+  // cheaper than maintaining a heap.
+  Node* prev = nullptr;
+  Node* next = expired_head_;
+  while (next && (next->fire_at_ms < node->fire_at_ms ||
+                  (next->fire_at_ms == node->fire_at_ms &&
+                   next->order < node->order))) {
+    prev = next;
+    next = next->next;
+  }
+  node->prev = prev;
+  node->next = next;
+  if (prev)
+    prev->next = node;
+  else
+    expired_head_ = node;
+  if (next)
+    next->prev = node;
+}
+
+void TimerWheel::Advance(int64_t now_ms) {
+  if (now_ms <= cursor_ms_)
+    return;
+  // Each slot only needs one visit per turn of the wheel, so long idle gaps
+  // cost at most |kWheelSlots| slot scans.
+  const int64_t steps =
+      std::min<int64_t>(now_ms - cursor_ms_, static_cast<int64_t>(kWheelSlots));
+  for (int64_t step = 1; step <= steps; ++step)
+    CollectExpired(&slots_[(cursor_ms_ + step) & kWheelMask], now_ms);
+  cursor_ms_ = now_ms;
+}
+
+}  // namespace webrtc
@@ -0,0 +1,108 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef RTC_BASE_TIMER_WHEEL_H_
+#define RTC_BASE_TIMER_WHEEL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+#include "api/task_queue/queued_task.h"
+#include "rtc_base/constructor_magic.h"
+
+namespace webrtc {
+
+// Timing wheel holding the delayed tasks of a task queue. Replaces the
+// per-queue std::map (or per-post heap-allocated timer object) that task
+// queue implementations otherwise use for delayed posts: entries live in
+// intrusive per-slot lists, nodes are recycled through a free list, so
+// scheduling and expiry are O(1) and allocation-free in steady state.
+//
+// Time is supplied by the caller on every mutating call, so the wheel works
+// equally under the real and the simulated clock. The wheel is not
+// thread-safe; callers synchronize externally (task queues already serialize
+// access with their pending-task lock or by touching the wheel only on the
+// queue's own thread).
+//
+// Tasks that expire at the same millisecond are handed out in the order of
+// the |order| values passed to Schedule(), so a task queue can keep its
+// FIFO interleaving of delayed and immediate posts.
+class TimerWheel {
+ public:
+  TimerWheel();
+  ~TimerWheel();
+
+  // Schedules |task| to run once the supplied time reaches |fire_at_ms|.
+  // |order| breaks ties between tasks with the same fire time and is also
+  // what PeekExpiredOrder() reports for interleaving with immediate tasks.
+  void Schedule(std::unique_ptr<QueuedTask> task,
+                int64_t fire_at_ms,
+                uint64_t order);
+
+  // If a task has expired at |now_ms|, writes its |order| value and returns
+  // true. The task itself is left in place for PopExpired().
+  bool PeekExpiredOrder(int64_t now_ms, uint64_t* order);
+
+  // Removes and returns the expired task with the smallest
+  // (fire time, order), or nullptr if nothing has expired at |now_ms|.
+  std::unique_ptr<QueuedTask> PopExpired(int64_t now_ms);
+
+  // Milliseconds until the earliest scheduled task fires: 0 if a task has
+  // already expired, -1 if the wheel is empty.
+  int64_t TimeUntilNextFireMs(int64_t now_ms);
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+
+ private:
+  struct Node {
+    Node* prev = nullptr;
+    Node* next = nullptr;
+    int64_t fire_at_ms = 0;
+    uint64_t order = 0;
+    std::unique_ptr<QueuedTask> task;
+  };
+
+  // 512 one-millisecond slots; tasks further out than one turn simply stay
+  // in their slot until the cursor passes it at their actual fire time.
+  static constexpr size_t kWheelSlots = 512;
+  static constexpr size_t kWheelMask = kWheelSlots - 1;
+
+  Node* AllocateNode();
+  void FreeNode(Node* node);
+  static void Unlink(Node** head, Node* node);
+  static void DeleteList(Node* head);
+
+  // Moves every entry of |*head| with a fire time <= |now_ms| to the
+  // expired list.
+  void CollectExpired(Node** head, int64_t now_ms);
+  // Sorted (fire time, order) insertion into the expired list.
+  void InsertExpired(Node* node);
+  // Walks the cursor forward to |now_ms|, expiring tasks along the way.
+  void Advance(int64_t now_ms);
+
+  Node* slots_[kWheelSlots] = {};
+  // Expired entries in run order; populated by Advance().
+  Node* expired_head_ = nullptr;
+  // Recycled nodes, so steady-state scheduling does not allocate.
+  Node* free_list_ = nullptr;
+  // The time Advance() last ran to. Slots in (cursor, now] are the only
+  // ones that can hold newly expired entries.
+  int64_t cursor_ms_ = 0;
+  size_t size_ = 0;
+
+  RTC_DISALLOW_COPY_AND_ASSIGN(TimerWheel);
+};
+
+}  // namespace webrtc
+
+#endif  // RTC_BASE_TIMER_WHEEL_H_
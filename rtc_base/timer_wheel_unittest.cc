@@ -0,0 +1,77 @@
+/*
+ *  Copyright 2019 The WebRTC Project Authors. All rights reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "rtc_base/timer_wheel.h"
+
+#include <memory>
+#include <vector>
+
+#include "rtc_base/task_utils/to_queued_task.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace {
+
+std::unique_ptr<QueuedTask> RecordingTask(std::vector<int>* log, int id) {
+  return ToQueuedTask([log, id] { log->push_back(id); });
+}
+
+TEST(TimerWheelTest, PopsExpiredTasksInFireTimeThenPostingOrder) {
+  TimerWheel wheel;
+  std::vector<int> log;
+  wheel.Schedule(RecordingTask(&log, 1), /*fire_at_ms=*/1100, /*order=*/1);
+  wheel.Schedule(RecordingTask(&log, 2), /*fire_at_ms=*/1050, /*order=*/2);
+  wheel.Schedule(RecordingTask(&log, 3), /*fire_at_ms=*/1050, /*order=*/3);
+  EXPECT_EQ(3u, wheel.size());
+
+  // Nothing has expired before the earliest fire time.
+  EXPECT_EQ(nullptr, wheel.PopExpired(/*now_ms=*/1049));
+
+  while (std::unique_ptr<QueuedTask> task = wheel.PopExpired(/*now_ms=*/1200))
+    task->Run();
+  EXPECT_EQ((std::vector<int>{2, 3, 1}), log);
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, HandlesFireTimesBeyondOneWheelTurn) {
+  TimerWheel wheel;
+  std::vector<int> log;
+  // Well beyond the 512 ms the wheel's slots span directly.
+  wheel.Schedule(RecordingTask(&log, 1), /*fire_at_ms=*/10000, /*order=*/1);
+  EXPECT_EQ(9000, wheel.TimeUntilNextFireMs(/*now_ms=*/1000));
+  EXPECT_EQ(nullptr, wheel.PopExpired(/*now_ms=*/9999));
+
+  std::unique_ptr<QueuedTask> task = wheel.PopExpired(/*now_ms=*/10000);
+  ASSERT_TRUE(task);
+  task->Run();
+  EXPECT_EQ((std::vector<int>{1}), log);
+  EXPECT_EQ(-1, wheel.TimeUntilNextFireMs(/*now_ms=*/10000));
+}
+
+TEST(TimerWheelTest, PeekExpiredOrderReportsNextRunnableTask) {
+  TimerWheel wheel;
+  std::vector<int> log;
+  uint64_t order = 0;
+  EXPECT_FALSE(wheel.PeekExpiredOrder(/*now_ms=*/1000, &order));
+
+  wheel.Schedule(RecordingTask(&log, 1), /*fire_at_ms=*/1000, /*order=*/7);
+  // A fire time at or before the current time is due immediately, even if
+  // the wheel has already advanced past its slot.
+  wheel.Schedule(RecordingTask(&log, 2), /*fire_at_ms=*/900, /*order=*/8);
+
+  ASSERT_TRUE(wheel.PeekExpiredOrder(/*now_ms=*/1000, &order));
+  EXPECT_EQ(8u, order);
+  wheel.PopExpired(/*now_ms=*/1000);
+  ASSERT_TRUE(wheel.PeekExpiredOrder(/*now_ms=*/1000, &order));
+  EXPECT_EQ(7u, order);
+}
+
+}  // namespace
+}  // namespace webrtc
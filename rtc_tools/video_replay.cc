@@ -8,6 +8,7 @@
  *  be found in the AUTHORS file in the root of the source tree.
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 
 #include <fstream>
@@ -20,11 +21,15 @@
 #include "api/task_queue/default_task_queue_factory.h"
 #include "api/test/video/function_video_decoder_factory.h"
 #include "api/transport/field_trial_based_config.h"
+#include "api/units/time_delta.h"
+#include "api/units/timestamp.h"
 #include "api/video_codecs/video_decoder.h"
 #include "call/call.h"
 #include "common_video/libyuv/include/webrtc_libyuv.h"
 #include "media/engine/internal_decoder_factory.h"
+#include "modules/utility/include/process_thread.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/cpu_time.h"
 #include "rtc_base/string_to_number.h"
 #include "rtc_base/strings/json.h"
 #include "rtc_base/time_utils.h"
@@ -42,6 +47,7 @@
 #include "test/run_test.h"
 #include "test/test_video_capturer.h"
 #include "test/testsupport/frame_writer.h"
+#include "test/time_controller/simulated_time_controller.h"
 #include "test/video_renderer.h"
 
 // Flag for payload type.
@@ -115,6 +121,15 @@ ABSL_FLAG(std::string,
 // Flag for video codec.
 ABSL_FLAG(std::string, codec, "VP8", "Video codec");
 
+// Flag for deterministic replay on simulated time.
+ABSL_FLAG(bool,
+          simulated_time,
+          false,
+          "Replay on a simulated clock instead of wall-clock time. The replay "
+          "is deterministic, runs as fast as the receive pipeline allows, and "
+          "reports per-stream pipeline statistics and consumed CPU time at "
+          "the end.");
+
 namespace {
 
 static bool ValidatePayloadType(int32_t payload_type) {
@@ -193,6 +208,10 @@ static std::string Codec() {
   return absl::GetFlag(FLAGS_codec);
 }
 
+static bool UseSimulatedTime() {
+  return absl::GetFlag(FLAGS_simulated_time);
+}
+
 }  // namespace
 
 namespace webrtc {
@@ -263,13 +282,28 @@ class RtpReplayer final {
   // Replay a rtp dump with an optional json configuration.
   static void Replay(const std::string& replay_config_path,
                      const std::string& rtp_dump_path) {
-    std::unique_ptr<webrtc::TaskQueueFactory> task_queue_factory =
-        webrtc::CreateDefaultTaskQueueFactory();
+    // In simulated-time mode all threads, task queues and timers of the call
+    // run on a simulated clock that is advanced between packets, so the
+    // replay is deterministic and limited only by the pipeline itself.
+    std::unique_ptr<GlobalSimulatedTimeController> time_controller;
+    std::unique_ptr<webrtc::TaskQueueFactory> task_queue_factory;
     webrtc::RtcEventLogNull event_log;
     Call::Config call_config(&event_log);
-    call_config.task_queue_factory = task_queue_factory.get();
     call_config.trials = new FieldTrialBasedConfig();
-    std::unique_ptr<Call> call(Call::Create(call_config));
+    std::unique_ptr<Call> call;
+    if (UseSimulatedTime()) {
+      time_controller = std::make_unique<GlobalSimulatedTimeController>(
+          Timestamp::Millis(1 << 30));
+      call_config.task_queue_factory = time_controller->GetTaskQueueFactory();
+      call.reset(
+          Call::Create(call_config, time_controller->GetClock(),
+                       time_controller->CreateProcessThread("CallModules"),
+                       time_controller->CreateProcessThread("Pacer")));
+    } else {
+      task_queue_factory = webrtc::CreateDefaultTaskQueueFactory();
+      call_config.task_queue_factory = task_queue_factory.get();
+      call.reset(Call::Create(call_config));
+    }
     std::unique_ptr<StreamState> stream_state;
     // Attempt to load the configuration
     if (replay_config_path.empty()) {
@@ -290,7 +324,20 @@ class RtpReplayer final {
     for (const auto& receive_stream : stream_state->receive_streams) {
       receive_stream->Start();
     }
-    ReplayPackets(call.get(), rtp_reader.get());
+    const int64_t start_cpu_ns = rtc::GetProcessCpuTimeNanos();
+    ReplayPackets(call.get(), rtp_reader.get(), time_controller.get());
+    if (time_controller != nullptr) {
+      // Let queued decode and render work drain before reading the stats.
+      time_controller->AdvanceTime(TimeDelta::Millis(100));
+      const int64_t cpu_ms =
+          (rtc::GetProcessCpuTimeNanos() - start_cpu_ns) / 1000000;
+      fprintf(stderr, "Replay consumed %" PRId64 " ms of process CPU time.\n",
+              cpu_ms);
+      for (const auto& receive_stream : stream_state->receive_streams) {
+        fprintf(stderr, "%s\n",
+                receive_stream->GetStats().ToString(rtc::TimeMillis()).c_str());
+      }
+    }
     for (const auto& receive_stream : stream_state->receive_streams) {
       call->DestroyVideoReceiveStream(receive_stream);
     }
@@ -435,11 +482,15 @@ class RtpReplayer final {
     return rtp_reader;
   }
 
-  static void ReplayPackets(Call* call, test::RtpFileReader* rtp_reader) {
+  static void ReplayPackets(Call* call,
+                            test::RtpFileReader* rtp_reader,
+                            GlobalSimulatedTimeController* time_controller) {
     int64_t replay_start_ms = -1;
     int num_packets = 0;
     std::map<uint32_t, int> unknown_packets;
     while (true) {
+      // With a |time_controller| the fake clock makes rtc::TimeMillis()
+      // return simulated time, so the same pacing logic works in both modes.
       int64_t now_ms = rtc::TimeMillis();
       if (replay_start_ms == -1) {
         replay_start_ms = now_ms;
@@ -452,7 +503,11 @@ class RtpReplayer final {
 
       int64_t deliver_in_ms = replay_start_ms + packet.time_ms - now_ms;
       if (deliver_in_ms > 0) {
-        SleepMs(deliver_in_ms);
+        if (time_controller != nullptr) {
+          time_controller->AdvanceTime(TimeDelta::Millis(deliver_in_ms));
+        } else {
+          SleepMs(deliver_in_ms);
+        }
       }
 
       ++num_packets;
@@ -0,0 +1,81 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef SYSTEM_WRAPPERS_INCLUDE_AUDIO_PIPELINE_TAP_H_
+#define SYSTEM_WRAPPERS_INCLUDE_AUDIO_PIPELINE_TAP_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+// Timestamp taps for measuring where mouth-to-ear latency goes inside the
+// audio pipeline. Hot paths call Record() with their stage; when the tap is
+// disabled (the default) this is a single relaxed atomic load. When enabled,
+// events go into a fixed process-wide ring and readers derive per-stage
+// deltas with GetStageDeltas(), typically surfaced through
+// AudioSendStream::GetStats().
+//
+// Like the histogram and field trial APIs in this directory, the state is
+// process-global: the taps sit in modules that have no common per-call
+// object, and per-stage attribution is the point, not per-stream isolation.
+
+namespace webrtc {
+namespace audio_pipeline_tap {
+
+// Pipeline stages in mouth-to-ear order. The delta reported for a stage is
+// measured against the closest preceding event of the previous stage, so
+// kPacerDequeue -> kNetEqInsert only means something when send and receive
+// sides run in the same process (loopback or local measurement rigs).
+enum class Stage {
+  kAdmCapture = 0,
+  kApmEntry,
+  kApmExit,
+  kAcmEncodeDone,
+  kPacerDequeue,
+  kNetEqInsert,
+  kNetEqGetAudio,
+  kAdmPlayout,
+};
+constexpr int kNumStages = 8;
+
+// Aggregated deltas for one stage, computed over the events still present
+// in the ring at the time of the GetStageDeltas() call.
+struct StageDelta {
+  Stage stage = Stage::kAdmCapture;
+  // Number of recorded events for this stage.
+  int64_t num_events = 0;
+  // Mean and maximum time from the previous stage, in microseconds. Zero
+  // for the first stage and for stages whose predecessor never fired.
+  int64_t mean_delta_us = 0;
+  int64_t max_delta_us = 0;
+};
+
+// Globally enables or disables recording. Events recorded before Enable()
+// are discarded.
+void Enable();
+void Disable();
+bool IsEnabled();
+
+// Records that |stage| ran now. Safe to call from real-time threads: no
+// locks, no allocation, a handful of relaxed atomic operations.
+void Record(Stage stage);
+
+// Returns one entry per stage that has recorded events, in stage order.
+// Events may be recorded concurrently while reading; readers get a
+// best-effort snapshot, which is fine for diagnostics.
+std::vector<StageDelta> GetStageDeltas();
+
+// Discards all recorded events. Also used between test cases.
+void Reset();
+
+}  // namespace audio_pipeline_tap
+}  // namespace webrtc
+
+#endif  // SYSTEM_WRAPPERS_INCLUDE_AUDIO_PIPELINE_TAP_H_
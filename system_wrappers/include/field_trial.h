@@ -13,6 +13,10 @@
 
 #include <string>
 
+#ifndef WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT
+#include "absl/strings/string_view.h"
+#endif
+
 // Field trials allow webrtc clients (such as Chrome) to turn on feature code
 // in binaries out in the field and gather information with that.
 //
@@ -63,17 +67,34 @@ namespace field_trial {
 // Note: To keep things tidy append all the trial names with WebRTC.
 std::string FindFullName(const std::string& name);
 
+#ifndef WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT
+// Like FindFullName(), but returns a view into the field trial string
+// instead of constructing a std::string, so lookups on hot paths do not
+// allocate. The view stays valid for as long as the string passed to
+// InitFieldTrialsFromString() (which must never be destroyed). Only
+// available with the default field trial implementation.
+absl::string_view FindFullNameView(absl::string_view name);
+#endif  // WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT
+
 // Convenience method, returns true iff FindFullName(name) return a string that
 // starts with "Enabled".
 // TODO(tommi): Make sure all implementations support this.
 inline bool IsEnabled(const char* name) {
+#ifndef WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT
+  return FindFullNameView(name).substr(0, 7) == "Enabled";
+#else
   return FindFullName(name).find("Enabled") == 0;
+#endif
 }
 
 // Convenience method, returns true iff FindFullName(name) return a string that
 // starts with "Disabled".
 inline bool IsDisabled(const char* name) {
+#ifndef WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT
+  return FindFullNameView(name).substr(0, 8) == "Disabled";
+#else
   return FindFullName(name).find("Disabled") == 0;
+#endif
 }
 
 // Optionally initialize field trial from a string.
@@ -0,0 +1,129 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "system_wrappers/include/audio_pipeline_tap.h"
+
+#include <atomic>
+
+#include "rtc_base/time_utils.h"
+
+namespace webrtc {
+namespace audio_pipeline_tap {
+namespace {
+
+// Ring capacity. At one event per stage per 10 ms block this holds roughly
+// half a second of pipeline history, enough for the reader to correlate
+// stages without the writer lapping it in practice.
+constexpr uint64_t kRingSize = 512;
+static_assert((kRingSize & (kRingSize - 1)) == 0, "kRingSize must be 2^n");
+
+// Deltas larger than this are treated as unrelated events (e.g. the
+// previous stage stopped running) and are not aggregated.
+constexpr int64_t kMaxPlausibleDeltaUs = rtc::kNumMicrosecsPerSec;
+
+struct Event {
+  std::atomic<int64_t> time_us{0};
+  std::atomic<int32_t> stage{-1};
+};
+
+std::atomic<bool> g_enabled{false};
+std::atomic<uint64_t> g_write_index{0};
+Event g_ring[kRingSize];
+
+}  // namespace
+
+void Enable() {
+  Reset();
+  g_enabled.store(true, std::memory_order_release);
+}
+
+void Disable() {
+  g_enabled.store(false, std::memory_order_release);
+}
+
+bool IsEnabled() {
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+void Record(Stage stage) {
+  if (!g_enabled.load(std::memory_order_relaxed))
+    return;
+  const uint64_t index =
+      g_write_index.fetch_add(1, std::memory_order_relaxed) & (kRingSize - 1);
+  Event& event = g_ring[index];
+  // Invalidate the slot first so a concurrent reader never pairs the new
+  // timestamp with the stage of the event being overwritten.
+  event.stage.store(-1, std::memory_order_release);
+  event.time_us.store(rtc::TimeMicros(), std::memory_order_relaxed);
+  event.stage.store(static_cast<int32_t>(stage), std::memory_order_release);
+}
+
+std::vector<StageDelta> GetStageDeltas() {
+  // Copy the ring in write order, oldest first.
+  const uint64_t end = g_write_index.load(std::memory_order_relaxed);
+  const uint64_t count = end < kRingSize ? end : kRingSize;
+  const uint64_t start = end - count;
+
+  int64_t last_time_us[kNumStages];
+  int64_t num_events[kNumStages] = {0};
+  int64_t sum_delta_us[kNumStages] = {0};
+  int64_t num_deltas[kNumStages] = {0};
+  int64_t max_delta_us[kNumStages] = {0};
+  for (int i = 0; i < kNumStages; ++i) {
+    last_time_us[i] = -1;
+  }
+
+  for (uint64_t i = start; i < end; ++i) {
+    const Event& event = g_ring[i & (kRingSize - 1)];
+    const int32_t stage = event.stage.load(std::memory_order_acquire);
+    const int64_t time_us = event.time_us.load(std::memory_order_relaxed);
+    if (stage < 0 || stage >= kNumStages) {
+      continue;  // Empty or concurrently overwritten slot.
+    }
+    ++num_events[stage];
+    last_time_us[stage] = time_us;
+    if (stage > 0 && last_time_us[stage - 1] >= 0) {
+      const int64_t delta_us = time_us - last_time_us[stage - 1];
+      if (delta_us >= 0 && delta_us <= kMaxPlausibleDeltaUs) {
+        sum_delta_us[stage] += delta_us;
+        ++num_deltas[stage];
+        if (delta_us > max_delta_us[stage]) {
+          max_delta_us[stage] = delta_us;
+        }
+      }
+    }
+  }
+
+  std::vector<StageDelta> deltas;
+  for (int i = 0; i < kNumStages; ++i) {
+    if (num_events[i] == 0) {
+      continue;
+    }
+    StageDelta delta;
+    delta.stage = static_cast<Stage>(i);
+    delta.num_events = num_events[i];
+    if (num_deltas[i] > 0) {
+      delta.mean_delta_us = sum_delta_us[i] / num_deltas[i];
+      delta.max_delta_us = max_delta_us[i];
+    }
+    deltas.push_back(delta);
+  }
+  return deltas;
+}
+
+void Reset() {
+  for (uint64_t i = 0; i < kRingSize; ++i) {
+    g_ring[i].stage.store(-1, std::memory_order_release);
+  }
+  g_write_index.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace audio_pipeline_tap
+}  // namespace webrtc
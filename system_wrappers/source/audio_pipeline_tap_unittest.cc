@@ -0,0 +1,94 @@
+/*
+ *  Copyright (c) 2020 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "system_wrappers/include/audio_pipeline_tap.h"
+
+#include "rtc_base/fake_clock.h"
+#include "test/gtest.h"
+
+namespace webrtc {
+namespace audio_pipeline_tap {
+
+class AudioPipelineTapTest : public ::testing::Test {
+ protected:
+  AudioPipelineTapTest() { Enable(); }
+  ~AudioPipelineTapTest() override {
+    Disable();
+    Reset();
+  }
+
+  rtc::ScopedFakeClock clock_;
+};
+
+TEST_F(AudioPipelineTapTest, RecordsNothingWhenDisabled) {
+  Disable();
+  Record(Stage::kAdmCapture);
+  EXPECT_TRUE(GetStageDeltas().empty());
+}
+
+TEST_F(AudioPipelineTapTest, ComputesDeltaAgainstPreviousStage) {
+  Record(Stage::kAdmCapture);
+  clock_.AdvanceTime(webrtc::TimeDelta::Millis(2));
+  Record(Stage::kApmEntry);
+  clock_.AdvanceTime(webrtc::TimeDelta::Millis(3));
+  Record(Stage::kApmExit);
+
+  std::vector<StageDelta> deltas = GetStageDeltas();
+  ASSERT_EQ(3u, deltas.size());
+  EXPECT_EQ(Stage::kAdmCapture, deltas[0].stage);
+  EXPECT_EQ(0, deltas[0].mean_delta_us);
+  EXPECT_EQ(Stage::kApmEntry, deltas[1].stage);
+  EXPECT_EQ(2000, deltas[1].mean_delta_us);
+  EXPECT_EQ(Stage::kApmExit, deltas[2].stage);
+  EXPECT_EQ(3000, deltas[2].mean_delta_us);
+}
+
+TEST_F(AudioPipelineTapTest, AggregatesMeanAndMaxOverBlocks) {
+  for (int delta_ms : {1, 3, 5}) {
+    Record(Stage::kNetEqInsert);
+    clock_.AdvanceTime(webrtc::TimeDelta::Millis(delta_ms));
+    Record(Stage::kNetEqGetAudio);
+    clock_.AdvanceTime(webrtc::TimeDelta::Millis(10));
+  }
+
+  std::vector<StageDelta> deltas = GetStageDeltas();
+  ASSERT_EQ(2u, deltas.size());
+  EXPECT_EQ(Stage::kNetEqGetAudio, deltas[1].stage);
+  EXPECT_EQ(3, deltas[1].num_events);
+  EXPECT_EQ(3000, deltas[1].mean_delta_us);
+  EXPECT_EQ(5000, deltas[1].max_delta_us);
+}
+
+TEST_F(AudioPipelineTapTest, IgnoresImplausiblyLargeDeltas) {
+  Record(Stage::kAdmCapture);
+  clock_.AdvanceTime(webrtc::TimeDelta::Seconds(5));
+  Record(Stage::kApmEntry);
+
+  std::vector<StageDelta> deltas = GetStageDeltas();
+  ASSERT_EQ(2u, deltas.size());
+  EXPECT_EQ(1, deltas[1].num_events);
+  EXPECT_EQ(0, deltas[1].mean_delta_us);
+}
+
+TEST_F(AudioPipelineTapTest, SurvivesRingWrapAround) {
+  for (int i = 0; i < 2000; ++i) {
+    Record(Stage::kAdmCapture);
+    clock_.AdvanceTime(webrtc::TimeDelta::Millis(1));
+    Record(Stage::kApmEntry);
+    clock_.AdvanceTime(webrtc::TimeDelta::Millis(9));
+  }
+
+  std::vector<StageDelta> deltas = GetStageDeltas();
+  ASSERT_EQ(2u, deltas.size());
+  EXPECT_EQ(1000, deltas[1].mean_delta_us);
+}
+
+}  // namespace audio_pipeline_tap
+}  // namespace webrtc
@@ -10,6 +10,8 @@
 
 // Parts of this file derived from Chromium's base/cpu.cc.
 
+#include <stdint.h>
+
 #include "rtc_base/system/arch.h"
 #include "system_wrappers/include/cpu_features_wrapper.h"
 
@@ -34,16 +36,26 @@ static inline void __cpuid(int cpu_info[4], int info_type) {
       "xchg %%edi, %%ebx\n"
       : "=a"(cpu_info[0]), "=D"(cpu_info[1]), "=c"(cpu_info[2]),
         "=d"(cpu_info[3])
-      : "a"(info_type));
+      : "a"(info_type), "c"(0));
 }
 #else
 static inline void __cpuid(int cpu_info[4], int info_type) {
   __asm__ volatile("cpuid\n"
                    : "=a"(cpu_info[0]), "=b"(cpu_info[1]), "=c"(cpu_info[2]),
                      "=d"(cpu_info[3])
-                   : "a"(info_type));
+                   : "a"(info_type), "c"(0));
 }
 #endif
+// Reads the extended control register, used below to check that the OS has
+// enabled saving/restoring of the AVX register state.
+static inline uint64_t xgetbv(uint32_t xcr) {
+  uint32_t eax, edx;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(xcr));
+  return (((uint64_t)edx) << 32) | eax;
+}
+#define GET_XCR0() xgetbv(0)
+#else
+#define GET_XCR0() _xgetbv(0)
 #endif  // _MSC_VER
 #endif  // WEBRTC_ARCH_X86_FAMILY
 
@@ -58,6 +70,26 @@ static int GetCPUInfo(CPUFeature feature) {
   if (feature == kSSE3) {
     return 0 != (cpu_info[2] & 0x00000001);
   }
+  if (feature == kAVX2) {
+    int cpu_info7[4];
+    __cpuid(cpu_info7, 0);
+    int num_ids = cpu_info7[0];
+    if (num_ids < 7) {
+      return 0;
+    }
+    // Interpret CPU feature information.
+    __cpuid(cpu_info7, 7);
+
+    // AVX instructions can be used when
+    //  a) AVX is supported by the CPU,
+    //  b) XSAVE is supported by the CPU and enabled by the OS, and
+    //  c) the AVX register state is saved/restored by the OS.
+    return (cpu_info[2] & 0x10000000) != 0 /* AVX */ &&
+           (cpu_info[2] & 0x04000000) != 0 /* XSAVE */ &&
+           (cpu_info[2] & 0x08000000) != 0 /* OSXSAVE */ &&
+           (GET_XCR0() & 0x00000006) == 6 /* XSAVE enabled by kernel */ &&
+           (cpu_info7[1] & 0x00000020) != 0 /* AVX2 */;
+  }
   return 0;
 }
 #else
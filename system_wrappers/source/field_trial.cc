@@ -68,6 +68,38 @@ bool FieldTrialsStringIsValidInternal(const absl::string_view trials) {
 
   return true;
 }
+
+// Trial-name-to-group lookup table, parsed once from |trials_init_string|
+// when it is set. The views point into that string, which per the
+// InitFieldTrialsFromString() contract is never destroyed. Queries can
+// therefore do a plain map lookup instead of rescanning (and copying) the
+// configuration string; this matters when thousands of streams construct
+// field trial parsers during startup.
+static const std::map<absl::string_view, absl::string_view>* trials_map =
+    nullptr;
+
+const std::map<absl::string_view, absl::string_view>* ParseTrialsString(
+    absl::string_view trials) {
+  auto* field_trials = new std::map<absl::string_view, absl::string_view>();
+  size_t next_item = 0;
+  while (next_item < trials.length()) {
+    size_t name_end = trials.find(kPersistentStringSeparator, next_item);
+    if (name_end == trials.npos || next_item == name_end)
+      break;
+    size_t group_name_end =
+        trials.find(kPersistentStringSeparator, name_end + 1);
+    if (group_name_end == trials.npos || name_end + 1 == group_name_end)
+      break;
+
+    // As with the old linear scan, the first group wins for (invalid)
+    // strings that repeat a trial with different groups.
+    field_trials->emplace(
+        trials.substr(next_item, name_end - next_item),
+        trials.substr(name_end + 1, group_name_end - name_end - 1));
+    next_item = group_name_end + 1;
+  }
+  return field_trials;
+}
 }  // namespace
 
 bool FieldTrialsStringIsValid(const char* trials_string) {
@@ -103,35 +135,17 @@ std::string MergeFieldTrialsStrings(const char* first, const char* second) {
 }
 
 std::string FindFullName(const std::string& name) {
-  if (trials_init_string == NULL)
-    return std::string();
+  return std::string(FindFullNameView(name));
+}
 
-  std::string trials_string(trials_init_string);
-  if (trials_string.empty())
-    return std::string();
+absl::string_view FindFullNameView(absl::string_view name) {
+  const std::map<absl::string_view, absl::string_view>* field_trials =
+      trials_map;
+  if (field_trials == nullptr)
+    return absl::string_view();
 
-  size_t next_item = 0;
-  while (next_item < trials_string.length()) {
-    // Find next name/value pair in field trial configuration string.
-    size_t field_name_end =
-        trials_string.find(kPersistentStringSeparator, next_item);
-    if (field_name_end == trials_string.npos || field_name_end == next_item)
-      break;
-    size_t field_value_end =
-        trials_string.find(kPersistentStringSeparator, field_name_end + 1);
-    if (field_value_end == trials_string.npos ||
-        field_value_end == field_name_end + 1)
-      break;
-    std::string field_name(trials_string, next_item,
-                           field_name_end - next_item);
-    std::string field_value(trials_string, field_name_end + 1,
-                            field_value_end - field_name_end - 1);
-    next_item = field_value_end + 1;
-
-    if (name == field_name)
-      return field_value;
-  }
-  return std::string();
+  const auto it = field_trials->find(name);
+  return (it == field_trials->end()) ? absl::string_view() : it->second;
 }
 #endif  // WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT
 
@@ -143,6 +157,11 @@ void InitFieldTrialsFromString(const char* trials_string) {
     RTC_DCHECK(FieldTrialsStringIsValidInternal(trials_string))
         << "Invalid field trials string:" << trials_string;
   };
+  // Re-initialization only happens in tests, sequentially with any queries,
+  // so replacing the lookup table here is safe.
+  const std::map<absl::string_view, absl::string_view>* old_map = trials_map;
+  trials_map = trials_string ? ParseTrialsString(trials_string) : nullptr;
+  delete old_map;
 #endif  // WEBRTC_EXCLUDE_FIELD_TRIAL_DEFAULT
   trials_init_string = trials_string;
 }
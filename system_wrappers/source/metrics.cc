@@ -10,7 +10,9 @@
 #include "system_wrappers/include/metrics.h"
 
 #include <algorithm>
+#include <vector>
 
+#include "rtc_base/atomic_ops.h"
 #include "rtc_base/critical_section.h"
 #include "rtc_base/thread_annotations.h"
 
@@ -27,6 +29,17 @@ namespace {
 // linearly/exponentially spaced buckets) if samples are logged more frequently.
 const int kMaxSampleMapSize = 300;
 
+// Atomically sets |*i| to zero and returns the previous value.
+int ExchangeZero(volatile int* i) {
+  while (true) {
+    int value = rtc::AtomicOps::AcquireLoad(i);
+    if (value == 0 ||
+        rtc::AtomicOps::CompareAndSwap(i, value, 0) == value) {
+      return value;
+    }
+  }
+}
+
 class RtcHistogram {
  public:
   RtcHistogram(const std::string& name, int min, int max, int bucket_count)
@@ -34,101 +47,161 @@ class RtcHistogram {
     RTC_DCHECK_GT(bucket_count, 0);
   }
 
+  // Lock-free; called from per-packet and per-frame paths. Each distinct
+  // sample value claims a slot in a fixed-size open-addressed table and its
+  // count is incremented atomically. As with the old sample map, samples
+  // with new values are dropped once all |kMaxSampleMapSize| slots are
+  // claimed. Claimed slots are reused (with their count reset) after
+  // GetAndReset().
   void Add(int sample) {
     sample = std::min(sample, max_);
     sample = std::max(sample, min_ - 1);  // Underflow bucket.
 
-    rtc::CritScope cs(&crit_);
-    if (info_.samples.size() == kMaxSampleMapSize &&
-        info_.samples.find(sample) == info_.samples.end()) {
-      return;
+    size_t idx =
+        static_cast<uint32_t>(sample) * 2654435761u % kMaxSampleMapSize;
+    for (int i = 0; i < kMaxSampleMapSize; ++i) {
+      Bucket& bucket = buckets_[idx];
+      int state = rtc::AtomicOps::AcquireLoad(&bucket.state);
+      if (state == kBucketEmpty) {
+        if (rtc::AtomicOps::CompareAndSwap(&bucket.state, kBucketEmpty,
+                                           kBucketClaiming) == kBucketEmpty) {
+          bucket.sample = sample;
+          rtc::AtomicOps::ReleaseStore(&bucket.state, kBucketReady);
+          state = kBucketReady;
+        } else {
+          state = rtc::AtomicOps::AcquireLoad(&bucket.state);
+        }
+      }
+      if (state == kBucketReady && bucket.sample == sample) {
+        rtc::AtomicOps::Increment(&bucket.count);
+        return;
+      }
+      // The slot holds another value, or is mid-claim by another thread (in
+      // which case this sample may end up in a second slot; readers
+      // aggregate counts by value, so this only costs a slot). Keep probing.
+      idx = (idx + 1) % kMaxSampleMapSize;
     }
-    ++info_.samples[sample];
+    // All slots claimed by other values; drop the sample.
   }
 
   // Returns a copy (or nullptr if there are no samples) and clears samples.
   std::unique_ptr<SampleInfo> GetAndReset() {
-    rtc::CritScope cs(&crit_);
-    if (info_.samples.empty())
-      return nullptr;
-
-    SampleInfo* copy =
-        new SampleInfo(info_.name, info_.min, info_.max, info_.bucket_count);
-
-    std::swap(info_.samples, copy->samples);
-
-    return std::unique_ptr<SampleInfo>(copy);
+    std::unique_ptr<SampleInfo> copy;
+    for (Bucket& bucket : buckets_) {
+      if (rtc::AtomicOps::AcquireLoad(&bucket.state) != kBucketReady)
+        continue;
+      int count = ExchangeZero(&bucket.count);
+      if (count > 0) {
+        if (!copy) {
+          copy.reset(new SampleInfo(info_.name, info_.min, info_.max,
+                                    info_.bucket_count));
+        }
+        copy->samples[bucket.sample] += count;
+      }
+    }
+    return copy;
   }
 
   const std::string& name() const { return info_.name; }
 
   // Functions only for testing.
   void Reset() {
-    rtc::CritScope cs(&crit_);
-    info_.samples.clear();
+    for (Bucket& bucket : buckets_) {
+      if (rtc::AtomicOps::AcquireLoad(&bucket.state) == kBucketReady)
+        ExchangeZero(&bucket.count);
+    }
   }
 
   int NumEvents(int sample) const {
-    rtc::CritScope cs(&crit_);
-    const auto it = info_.samples.find(sample);
-    return (it == info_.samples.end()) ? 0 : it->second;
+    int num_events = 0;
+    for (const Bucket& bucket : buckets_) {
+      if (rtc::AtomicOps::AcquireLoad(&bucket.state) == kBucketReady &&
+          bucket.sample == sample) {
+        num_events += rtc::AtomicOps::AcquireLoad(&bucket.count);
+      }
+    }
+    return num_events;
   }
 
   int NumSamples() const {
     int num_samples = 0;
-    rtc::CritScope cs(&crit_);
-    for (const auto& sample : info_.samples) {
-      num_samples += sample.second;
+    for (const Bucket& bucket : buckets_) {
+      if (rtc::AtomicOps::AcquireLoad(&bucket.state) == kBucketReady)
+        num_samples += rtc::AtomicOps::AcquireLoad(&bucket.count);
     }
     return num_samples;
   }
 
   int MinSample() const {
-    rtc::CritScope cs(&crit_);
-    return (info_.samples.empty()) ? -1 : info_.samples.begin()->first;
+    int min_sample = -1;
+    bool found = false;
+    for (const Bucket& bucket : buckets_) {
+      if (rtc::AtomicOps::AcquireLoad(&bucket.state) == kBucketReady &&
+          rtc::AtomicOps::AcquireLoad(&bucket.count) > 0 &&
+          (!found || bucket.sample < min_sample)) {
+        min_sample = bucket.sample;
+        found = true;
+      }
+    }
+    return min_sample;
   }
 
   std::map<int, int> Samples() const {
-    rtc::CritScope cs(&crit_);
-    return info_.samples;
+    std::map<int, int> samples;
+    for (const Bucket& bucket : buckets_) {
+      if (rtc::AtomicOps::AcquireLoad(&bucket.state) != kBucketReady)
+        continue;
+      int count = rtc::AtomicOps::AcquireLoad(&bucket.count);
+      if (count > 0)
+        samples[bucket.sample] += count;
+    }
+    return samples;
   }
 
  private:
-  rtc::CriticalSection crit_;
+  static const int kBucketEmpty = 0;
+  static const int kBucketClaiming = 1;
+  static const int kBucketReady = 2;
+
+  struct Bucket {
+    Bucket() : state(kBucketEmpty), sample(0), count(0) {}
+
+    volatile int state;
+    // Only written by the thread that moved |state| to |kBucketClaiming|,
+    // before it publishes |kBucketReady|; constant thereafter.
+    int sample;
+    volatile int count;
+  };
+
   const int min_;
   const int max_;
-  SampleInfo info_ RTC_GUARDED_BY(crit_);
+  // Only |name|, |min|, |max| and |bucket_count| are used; the samples live
+  // in |buckets_|.
+  const SampleInfo info_;
+  Bucket buckets_[kMaxSampleMapSize];
 
   RTC_DISALLOW_COPY_AND_ASSIGN(RtcHistogram);
 };
 
 class RtcHistogramMap {
  public:
-  RtcHistogramMap() {}
-  ~RtcHistogramMap() {}
+  RtcHistogramMap() : snapshot_(new Snapshot()) {}
+  ~RtcHistogramMap() { delete rtc::AtomicOps::AcquireLoadPtr(&snapshot_); }
 
   Histogram* GetCountsHistogram(const std::string& name,
                                 int min,
                                 int max,
                                 int bucket_count) {
-    rtc::CritScope cs(&crit_);
-    const auto& it = map_.find(name);
-    if (it != map_.end())
-      return reinterpret_cast<Histogram*>(it->second.get());
-
-    RtcHistogram* hist = new RtcHistogram(name, min, max, bucket_count);
-    map_[name].reset(hist);
+    RtcHistogram* hist = FindHistogram(name);
+    if (!hist)
+      hist = AddHistogram(name, min, max, bucket_count);
     return reinterpret_cast<Histogram*>(hist);
   }
 
   Histogram* GetEnumerationHistogram(const std::string& name, int boundary) {
-    rtc::CritScope cs(&crit_);
-    const auto& it = map_.find(name);
-    if (it != map_.end())
-      return reinterpret_cast<Histogram*>(it->second.get());
-
-    RtcHistogram* hist = new RtcHistogram(name, 1, boundary, boundary + 1);
-    map_[name].reset(hist);
+    RtcHistogram* hist = FindHistogram(name);
+    if (!hist)
+      hist = AddHistogram(name, 1, boundary, boundary + 1);
     return reinterpret_cast<Histogram*>(hist);
   }
 
@@ -174,9 +247,51 @@ class RtcHistogramMap {
   }
 
  private:
+  // Immutable name-to-histogram index, swapped out wholesale when a
+  // histogram is added so that lookups never take |crit_|.
+  using Snapshot = std::map<std::string, RtcHistogram*>;
+
+  // Lock-free lookup of an already registered histogram. The factory
+  // functions are called for every RTC_HISTOGRAM_* invocation with a
+  // non-constant name, so the common hit case must not serialize callers on
+  // a process-global lock.
+  RtcHistogram* FindHistogram(const std::string& name) {
+    const Snapshot* snapshot = rtc::AtomicOps::AcquireLoadPtr(&snapshot_);
+    const auto& it = snapshot->find(name);
+    return (it == snapshot->end()) ? nullptr : it->second;
+  }
+
+  RtcHistogram* AddHistogram(const std::string& name,
+                             int min,
+                             int max,
+                             int bucket_count) {
+    rtc::CritScope cs(&crit_);
+    std::unique_ptr<RtcHistogram>& hist = map_[name];
+    if (!hist) {
+      hist.reset(new RtcHistogram(name, min, max, bucket_count));
+      Snapshot* new_snapshot = new Snapshot();
+      for (const auto& kv : map_)
+        (*new_snapshot)[kv.first] = kv.second.get();
+      Snapshot* old_snapshot = rtc::AtomicOps::AcquireLoadPtr(&snapshot_);
+      rtc::AtomicOps::CompareAndSwapPtr(&snapshot_, old_snapshot,
+                                        new_snapshot);
+      // Readers may still hold a pointer to the old snapshot, so it cannot
+      // be freed here. Snapshots are small (one pointer per histogram) and
+      // one is retired per histogram ever registered, so keep them for the
+      // lifetime of the map (which is itself never freed, see
+      // |g_rtc_histogram_map|).
+      retired_snapshots_.emplace_back(old_snapshot);
+    }
+    return hist.get();
+  }
+
   rtc::CriticalSection crit_;
   std::map<std::string, std::unique_ptr<RtcHistogram>> map_
       RTC_GUARDED_BY(crit_);
+  // Written under |crit_|, read without it via AcquireLoadPtr().
+  Snapshot* volatile snapshot_;
+  std::vector<std::unique_ptr<Snapshot>> retired_snapshots_
+      RTC_GUARDED_BY(crit_);
 
   RTC_DISALLOW_COPY_AND_ASSIGN(RtcHistogramMap);
 };
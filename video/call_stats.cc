@@ -122,16 +122,13 @@ void CallStats::Process() {
   int64_t now = clock_->TimeInMilliseconds();
   last_process_time_ = now;
 
-  // |avg_rtt_ms_| is allowed to be read on the process thread since that's the
-  // only thread that modifies the value.
-  int64_t avg_rtt_ms = avg_rtt_ms_;
+  // The process thread is the only writer of |avg_rtt_ms_|, so the relaxed
+  // read-modify-write here cannot race with another writer.
+  int64_t avg_rtt_ms = avg_rtt_ms_.load(std::memory_order_relaxed);
   RemoveOldReports(now, &reports_);
   max_rtt_ms_ = GetMaxRttMs(reports_);
   avg_rtt_ms = GetNewAvgRttMs(reports_, avg_rtt_ms);
-  {
-    rtc::CritScope lock(&avg_rtt_ms_lock_);
-    avg_rtt_ms_ = avg_rtt_ms;
-  }
+  avg_rtt_ms_.store(avg_rtt_ms, std::memory_order_relaxed);
 
   // If there is a valid rtt, update all observers with the max rtt.
   if (max_rtt_ms_ >= 0) {
@@ -173,13 +170,10 @@ void CallStats::DeregisterStatsObserver(CallStatsObserver* observer) {
 }
 
 int64_t CallStats::LastProcessedRtt() const {
-  // TODO(tommi): This currently gets called from the construction thread of
-  // Call as well as from the process thread. Look into restricting this to
-  // allow only reading this from the process thread (or TQ once we get there)
-  // so that the lock isn't necessary.
-
-  rtc::CritScope cs(&avg_rtt_ms_lock_);
-  return avg_rtt_ms_;
+  // This gets called from the construction thread of Call as well as from
+  // every RtpRtcp module's Process(), so it must stay cheap; the atomic
+  // snapshot keeps it lock free.
+  return avg_rtt_ms_.load(std::memory_order_relaxed);
 }
 
 void CallStats::OnRttUpdate(int64_t rtt) {
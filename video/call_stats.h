@@ -11,6 +11,7 @@
 #ifndef VIDEO_CALL_STATS_H_
 #define VIDEO_CALL_STATS_H_
 
+#include <atomic>
 #include <list>
 #include <memory>
 
@@ -18,7 +19,6 @@
 #include "modules/include/module_common_types.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "rtc_base/constructor_magic.h"
-#include "rtc_base/critical_section.h"
 #include "rtc_base/thread_checker.h"
 #include "system_wrappers/include/clock.h"
 
@@ -83,14 +83,10 @@ class CallStats : public Module, public RtcpRttStats {
   // The last RTT in the statistics update (zero if there is no valid estimate).
   int64_t max_rtt_ms_ RTC_GUARDED_BY(process_thread_checker_);
 
-  // Accessed from random threads (seemingly). Consider atomic.
-  // |avg_rtt_ms_| is allowed to be read on the process thread without a lock.
-  // |avg_rtt_ms_lock_| must be held elsewhere for reading.
-  // |avg_rtt_ms_lock_| must be held on the process thread for writing.
-  int64_t avg_rtt_ms_;
-
-  // Protects |avg_rtt_ms_|.
-  rtc::CriticalSection avg_rtt_ms_lock_;
+  // Written on the process thread, read from random threads via
+  // LastProcessedRtt(). Atomic so that the frequent reads (every RtpRtcp
+  // module polls this once a second) don't contend on a lock.
+  std::atomic<int64_t> avg_rtt_ms_;
 
   // |sum_avg_rtt_ms_|, |num_avg_rtt_| and |time_of_first_rtt_ms_| are only used
   // on the ProcessThread when running. When the Process Thread is not running,
@@ -95,16 +95,13 @@ CallStats::~CallStats() {
 void CallStats::UpdateAndReport() {
   RTC_DCHECK_RUN_ON(&construction_thread_checker_);
 
-  // |avg_rtt_ms_| is allowed to be read on the construction thread since that's
-  // the only thread that modifies the value.
-  int64_t avg_rtt_ms = avg_rtt_ms_;
+  // The construction thread is the only writer of |avg_rtt_ms_|, so the
+  // relaxed read-modify-write here cannot race with another writer.
+  int64_t avg_rtt_ms = avg_rtt_ms_.load(std::memory_order_relaxed);
   RemoveOldReports(clock_->CurrentTime().ms(), &reports_);
   max_rtt_ms_ = GetMaxRttMs(reports_);
   avg_rtt_ms = GetNewAvgRttMs(reports_, avg_rtt_ms);
-  {
-    rtc::CritScope lock(&avg_rtt_ms_lock_);
-    avg_rtt_ms_ = avg_rtt_ms;
-  }
+  avg_rtt_ms_.store(avg_rtt_ms, std::memory_order_relaxed);
 
   // If there is a valid rtt, update all observers with the max rtt.
   if (max_rtt_ms_ >= 0) {
@@ -130,14 +127,12 @@ void CallStats::DeregisterStatsObserver(CallStatsObserver* observer) {
 
 int64_t CallStats::LastProcessedRtt() const {
   RTC_DCHECK_RUN_ON(&construction_thread_checker_);
-  // No need for locking since we're on the construction thread.
-  return avg_rtt_ms_;
+  return avg_rtt_ms_.load(std::memory_order_relaxed);
 }
 
 int64_t CallStats::LastProcessedRttFromProcessThread() const {
   RTC_DCHECK_RUN_ON(&process_thread_checker_);
-  rtc::CritScope lock(&avg_rtt_ms_lock_);
-  return avg_rtt_ms_;
+  return avg_rtt_ms_.load(std::memory_order_relaxed);
 }
 
 void CallStats::OnRttUpdate(int64_t rtt) {
@@ -11,6 +11,7 @@
 #ifndef VIDEO_CALL_STATS2_H_
 #define VIDEO_CALL_STATS2_H_
 
+#include <atomic>
 #include <list>
 #include <memory>
 
@@ -18,7 +19,6 @@
 #include "modules/include/module_common_types.h"
 #include "modules/rtp_rtcp/include/rtp_rtcp_defines.h"
 #include "rtc_base/constructor_magic.h"
-#include "rtc_base/critical_section.h"
 #include "rtc_base/synchronization/sequence_checker.h"
 #include "rtc_base/task_queue.h"
 #include "rtc_base/task_utils/pending_task_safety_flag.h"
@@ -109,14 +109,10 @@ class CallStats {
   // The last RTT in the statistics update (zero if there is no valid estimate).
   int64_t max_rtt_ms_ RTC_GUARDED_BY(construction_thread_checker_);
 
-  // Accessed from two separate threads.
-  // |avg_rtt_ms_| may be read on the construction thread without a lock.
-  // |avg_rtt_ms_lock_| must be held elsewhere for reading.
-  // |avg_rtt_ms_lock_| must be held on the construction thread for writing.
-  int64_t avg_rtt_ms_;
-
-  // Protects |avg_rtt_ms_|.
-  rtc::CriticalSection avg_rtt_ms_lock_;
+  // Written on the construction thread, read from there and, via
+  // LastProcessedRttFromProcessThread(), from the process thread. Atomic so
+  // that the cross-thread reads don't need a lock.
+  std::atomic<int64_t> avg_rtt_ms_;
 
   // |sum_avg_rtt_ms_|, |num_avg_rtt_| and |time_of_first_rtt_ms_| are only used
   // on the ProcessThread when running. When the Process Thread is not running,
@@ -19,6 +19,11 @@ namespace webrtc {
 
 namespace {
 constexpr int kMinKeyframeSendIntervalMs = 300;
+
+// How many keyframe send intervals a requested keyframe is considered to be
+// in flight before it is assumed dropped and a new request is allowed
+// through.
+constexpr int kKeyframePendingTimeoutFactor = 3;
 }  // namespace
 
 EncoderRtcpFeedback::EncoderRtcpFeedback(Clock* clock,
@@ -29,6 +34,8 @@ EncoderRtcpFeedback::EncoderRtcpFeedback(Clock* clock,
       rtp_video_sender_(nullptr),
       video_stream_encoder_(encoder),
       time_last_intra_request_ms_(-1),
+      time_last_keyframe_ms_(-1),
+      keyframe_pending_(false),
       min_keyframe_send_interval_ms_(
           KeyframeIntervalSettings::ParseFromFieldTrials()
               .MinKeyframeSendIntervalMs()
@@ -60,13 +67,33 @@ void EncoderRtcpFeedback::OnReceivedIntraFrameRequest(uint32_t ssrc) {
     if (time_last_intra_request_ms_ + min_keyframe_send_interval_ms_ > now_ms) {
       return;
     }
+    if (keyframe_pending_ &&
+        now_ms < time_last_intra_request_ms_ +
+                     kKeyframePendingTimeoutFactor *
+                         min_keyframe_send_interval_ms_) {
+      // A requested keyframe has not yet been produced by the encoder; it
+      // will serve this request as well.
+      return;
+    }
+    if (time_last_keyframe_ms_ + min_keyframe_send_interval_ms_ > now_ms) {
+      // A keyframe was recently produced (e.g. for a previous request wave);
+      // it serves this request as well.
+      return;
+    }
     time_last_intra_request_ms_ = now_ms;
+    keyframe_pending_ = true;
   }
 
   // Always produce key frame for all streams.
   video_stream_encoder_->SendKeyFrame();
 }
 
+void EncoderRtcpFeedback::OnKeyFrameEncoded() {
+  rtc::CritScope lock(&crit_);
+  time_last_keyframe_ms_ = clock_->TimeInMilliseconds();
+  keyframe_pending_ = false;
+}
+
 void EncoderRtcpFeedback::OnReceivedLossNotification(
     uint32_t ssrc,
     uint16_t seq_num_of_last_decodable,
@@ -36,6 +36,12 @@ class EncoderRtcpFeedback : public RtcpIntraFrameObserver,
 
   void OnReceivedIntraFrameRequest(uint32_t ssrc) override;
 
+  // Called (on the encoder thread) whenever the encoder produces a key
+  // frame, so that intra requests arriving while a keyframe is in flight,
+  // or shortly after one was produced, are absorbed without triggering
+  // another keyframe.
+  void OnKeyFrameEncoded();
+
   // Implements RtcpLossNotificationObserver.
   void OnReceivedLossNotification(uint32_t ssrc,
                                   uint16_t seq_num_of_last_decodable,
@@ -52,6 +58,10 @@ class EncoderRtcpFeedback : public RtcpIntraFrameObserver,
 
   rtc::CriticalSection crit_;
   int64_t time_last_intra_request_ms_ RTC_GUARDED_BY(crit_);
+  int64_t time_last_keyframe_ms_ RTC_GUARDED_BY(crit_);
+  // True while a requested keyframe has not yet been seen by
+  // OnKeyFrameEncoded().
+  bool keyframe_pending_ RTC_GUARDED_BY(crit_);
 
   const int min_keyframe_send_interval_ms_;
 };
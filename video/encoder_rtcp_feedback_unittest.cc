@@ -55,4 +55,38 @@ TEST_F(VieKeyRequestTest, TooManyOnReceivedIntraFrameRequest) {
   encoder_rtcp_feedback_.OnReceivedIntraFrameRequest(kSsrc);
 }
 
+TEST_F(VieKeyRequestTest, KeyFrameInFlightAbsorbsRequests) {
+  EXPECT_CALL(encoder_, SendKeyFrame()).Times(1);
+  encoder_rtcp_feedback_.OnReceivedIntraFrameRequest(kSsrc);
+
+  // The keyframe has not been produced yet; requests arriving after the
+  // throttling window are still absorbed while it is in flight.
+  simulated_clock_.AdvanceTimeMilliseconds(400);
+  encoder_rtcp_feedback_.OnReceivedIntraFrameRequest(kSsrc);
+
+  // Once the keyframe is produced, the window restarts from that point.
+  encoder_rtcp_feedback_.OnKeyFrameEncoded();
+  simulated_clock_.AdvanceTimeMilliseconds(100);
+  encoder_rtcp_feedback_.OnReceivedIntraFrameRequest(kSsrc);
+
+  EXPECT_CALL(encoder_, SendKeyFrame()).Times(1);
+  simulated_clock_.AdvanceTimeMilliseconds(300);
+  encoder_rtcp_feedback_.OnReceivedIntraFrameRequest(kSsrc);
+}
+
+TEST_F(VieKeyRequestTest, StalledKeyFrameDoesNotBlockRequestsForever) {
+  EXPECT_CALL(encoder_, SendKeyFrame()).Times(1);
+  encoder_rtcp_feedback_.OnReceivedIntraFrameRequest(kSsrc);
+
+  // Still considered in flight.
+  simulated_clock_.AdvanceTimeMilliseconds(600);
+  encoder_rtcp_feedback_.OnReceivedIntraFrameRequest(kSsrc);
+
+  // After three keyframe send intervals the request is assumed dropped and
+  // a new one is let through.
+  EXPECT_CALL(encoder_, SendKeyFrame()).Times(1);
+  simulated_clock_.AdvanceTimeMilliseconds(400);
+  encoder_rtcp_feedback_.OnReceivedIntraFrameRequest(kSsrc);
+}
+
 }  // namespace webrtc
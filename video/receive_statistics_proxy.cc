@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <memory>
 #include <utility>
 
 #include "modules/video_coding/include/video_codec_interface.h"
@@ -127,40 +128,38 @@ void ReceiveStatisticsProxy::UpdateHistograms(
     absl::optional<int> fraction_lost,
     const StreamDataCounters& rtp_stats,
     const StreamDataCounters* rtx_stats) {
+  RecordHistograms(*TakeHistogramSnapshot(fraction_lost, rtp_stats, rtx_stats));
+}
+
+std::unique_ptr<ReceiveStatisticsProxy::HistogramSnapshot>
+ReceiveStatisticsProxy::TakeHistogramSnapshot(
+    absl::optional<int> fraction_lost,
+    const StreamDataCounters& rtp_stats,
+    const StreamDataCounters* rtx_stats) {
   // Not actually running on the decoder thread, but must be called after
   // DecoderThreadStopped, which detaches the thread checker. It is therefore
   // safe to access |qp_counters_|, which were updated on the decode thread
   // earlier.
   RTC_DCHECK_RUN_ON(&decode_thread_);
 
+  auto snapshot = std::make_unique<HistogramSnapshot>();
+
   rtc::CritScope lock(&crit_);
 
-  char log_stream_buf[8 * 1024];
-  rtc::SimpleStringBuilder log_stream(log_stream_buf);
   int stream_duration_sec = (clock_->TimeInMilliseconds() - start_ms_) / 1000;
   if (stats_.frame_counts.key_frames > 0 ||
       stats_.frame_counts.delta_frames > 0) {
-    RTC_HISTOGRAM_COUNTS_100000("WebRTC.Video.ReceiveStreamLifetimeInSeconds",
-                                stream_duration_sec);
-    log_stream << "WebRTC.Video.ReceiveStreamLifetimeInSeconds "
-               << stream_duration_sec << '\n';
+    snapshot->stream_duration_sec = stream_duration_sec;
   }
 
-  log_stream << "Frames decoded " << stats_.frames_decoded << '\n';
+  snapshot->frames_decoded = stats_.frames_decoded;
 
   if (num_unique_frames_) {
-    int num_dropped_frames = *num_unique_frames_ - stats_.frames_decoded;
-    RTC_HISTOGRAM_COUNTS_1000("WebRTC.Video.DroppedFrames.Receiver",
-                              num_dropped_frames);
-    log_stream << "WebRTC.Video.DroppedFrames.Receiver " << num_dropped_frames
-               << '\n';
+    snapshot->dropped_frames = *num_unique_frames_ - stats_.frames_decoded;
   }
 
   if (fraction_lost && stream_duration_sec >= metrics::kMinRunTimeInSeconds) {
-    RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.ReceivedPacketsLostInPercent",
-                             *fraction_lost);
-    log_stream << "WebRTC.Video.ReceivedPacketsLostInPercent " << *fraction_lost
-               << '\n';
+    snapshot->fraction_lost = *fraction_lost;
   }
 
   if (first_decoded_frame_time_ms_) {
@@ -168,23 +167,16 @@ void ReceiveStatisticsProxy::UpdateHistograms(
         (clock_->TimeInMilliseconds() - *first_decoded_frame_time_ms_);
     if (elapsed_ms >=
         metrics::kMinRunTimeInSeconds * rtc::kNumMillisecsPerSec) {
-      int decoded_fps = static_cast<int>(
+      snapshot->decoded_fps = static_cast<int>(
           (stats_.frames_decoded * 1000.0f / elapsed_ms) + 0.5f);
-      RTC_HISTOGRAM_COUNTS_100("WebRTC.Video.DecodedFramesPerSecond",
-                               decoded_fps);
-      log_stream << "WebRTC.Video.DecodedFramesPerSecond " << decoded_fps
-                 << '\n';
 
       const uint32_t frames_rendered = stats_.frames_rendered;
       if (frames_rendered > 0) {
-        RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.DelayedFramesToRenderer",
-                                 static_cast<int>(num_delayed_frames_rendered_ *
-                                                  100 / frames_rendered));
+        snapshot->delayed_frames_percent = static_cast<int>(
+            num_delayed_frames_rendered_ * 100 / frames_rendered);
         if (num_delayed_frames_rendered_ > 0) {
-          RTC_HISTOGRAM_COUNTS_1000(
-              "WebRTC.Video.DelayedFramesToRenderer_AvgDelayInMs",
-              static_cast<int>(sum_missed_render_deadline_ms_ /
-                               num_delayed_frames_rendered_));
+          snapshot->delayed_frames_avg_delay_ms = static_cast<int>(
+              sum_missed_render_deadline_ms_ / num_delayed_frames_rendered_);
         }
       }
     }
@@ -193,77 +185,29 @@ void ReceiveStatisticsProxy::UpdateHistograms(
   const int kMinRequiredSamples = 200;
   int samples = static_cast<int>(render_fps_tracker_.TotalSampleCount());
   if (samples >= kMinRequiredSamples) {
-    int rendered_fps = round(render_fps_tracker_.ComputeTotalRate());
-    RTC_HISTOGRAM_COUNTS_100("WebRTC.Video.RenderFramesPerSecond",
-                             rendered_fps);
-    log_stream << "WebRTC.Video.RenderFramesPerSecond " << rendered_fps << '\n';
-    RTC_HISTOGRAM_COUNTS_100000(
-        "WebRTC.Video.RenderSqrtPixelsPerSecond",
-        round(render_pixel_tracker_.ComputeTotalRate()));
+    snapshot->rendered_fps = round(render_fps_tracker_.ComputeTotalRate());
+    snapshot->render_sqrt_pixels_per_sec =
+        round(render_pixel_tracker_.ComputeTotalRate());
   }
 
-  absl::optional<int> sync_offset_ms =
-      sync_offset_counter_.Avg(kMinRequiredSamples);
-  if (sync_offset_ms) {
-    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.AVSyncOffsetInMs",
-                               *sync_offset_ms);
-    log_stream << "WebRTC.Video.AVSyncOffsetInMs " << *sync_offset_ms << '\n';
-  }
-  AggregatedStats freq_offset_stats = freq_offset_counter_.GetStats();
-  if (freq_offset_stats.num_samples > 0) {
-    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.RtpToNtpFreqOffsetInKhz",
-                               freq_offset_stats.average);
-    log_stream << "WebRTC.Video.RtpToNtpFreqOffsetInKhz "
-               << freq_offset_stats.ToString() << '\n';
-  }
+  snapshot->sync_offset_ms = sync_offset_counter_.Avg(kMinRequiredSamples);
+  snapshot->freq_offset_stats = freq_offset_counter_.GetStats();
 
   int num_total_frames =
       stats_.frame_counts.key_frames + stats_.frame_counts.delta_frames;
   if (num_total_frames >= kMinRequiredSamples) {
     int num_key_frames = stats_.frame_counts.key_frames;
-    int key_frames_permille =
+    snapshot->key_frames_permille =
         (num_key_frames * 1000 + num_total_frames / 2) / num_total_frames;
-    RTC_HISTOGRAM_COUNTS_1000("WebRTC.Video.KeyFramesReceivedInPermille",
-                              key_frames_permille);
-    log_stream << "WebRTC.Video.KeyFramesReceivedInPermille "
-               << key_frames_permille << '\n';
   }
 
-  absl::optional<int> qp = qp_counters_.vp8.Avg(kMinRequiredSamples);
-  if (qp) {
-    RTC_HISTOGRAM_COUNTS_200("WebRTC.Video.Decoded.Vp8.Qp", *qp);
-    log_stream << "WebRTC.Video.Decoded.Vp8.Qp " << *qp << '\n';
-  }
-  absl::optional<int> decode_ms = decode_time_counter_.Avg(kMinRequiredSamples);
-  if (decode_ms) {
-    RTC_HISTOGRAM_COUNTS_1000("WebRTC.Video.DecodeTimeInMs", *decode_ms);
-    log_stream << "WebRTC.Video.DecodeTimeInMs " << *decode_ms << '\n';
-  }
-  absl::optional<int> jb_delay_ms =
+  snapshot->qp_vp8 = qp_counters_.vp8.Avg(kMinRequiredSamples);
+  snapshot->decode_time_ms = decode_time_counter_.Avg(kMinRequiredSamples);
+  snapshot->jitter_buffer_delay_ms =
       jitter_buffer_delay_counter_.Avg(kMinRequiredSamples);
-  if (jb_delay_ms) {
-    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.JitterBufferDelayInMs",
-                               *jb_delay_ms);
-    log_stream << "WebRTC.Video.JitterBufferDelayInMs " << *jb_delay_ms << '\n';
-  }
-
-  absl::optional<int> target_delay_ms =
-      target_delay_counter_.Avg(kMinRequiredSamples);
-  if (target_delay_ms) {
-    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.TargetDelayInMs",
-                               *target_delay_ms);
-    log_stream << "WebRTC.Video.TargetDelayInMs " << *target_delay_ms << '\n';
-  }
-  absl::optional<int> current_delay_ms =
-      current_delay_counter_.Avg(kMinRequiredSamples);
-  if (current_delay_ms) {
-    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.CurrentDelayInMs",
-                               *current_delay_ms);
-    log_stream << "WebRTC.Video.CurrentDelayInMs " << *current_delay_ms << '\n';
-  }
-  absl::optional<int> delay_ms = delay_counter_.Avg(kMinRequiredSamples);
-  if (delay_ms)
-    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.OnewayDelayInMs", *delay_ms);
+  snapshot->target_delay_ms = target_delay_counter_.Avg(kMinRequiredSamples);
+  snapshot->current_delay_ms = current_delay_counter_.Avg(kMinRequiredSamples);
+  snapshot->oneway_delay_ms = delay_counter_.Avg(kMinRequiredSamples);
 
   // Aggregate content_specific_stats_ by removing experiment or simulcast
   // information;
@@ -300,108 +244,49 @@ void ReceiveStatisticsProxy::UpdateHistograms(
     // WebRTC.Video.Screenshare.Foo.ExperimentGroup[0-7].
     auto content_type = it.first;
     auto stats = it.second;
-    std::string uma_prefix = UmaPrefixForContentType(content_type);
-    std::string uma_suffix = UmaSuffixForContentType(content_type);
     // Metrics can be sliced on either simulcast id or experiment id but not
     // both.
     RTC_DCHECK(videocontenttypehelpers::GetExperimentId(content_type) == 0 ||
                videocontenttypehelpers::GetSimulcastId(content_type) == 0);
 
-    absl::optional<int> e2e_delay_ms =
-        stats.e2e_delay_counter.Avg(kMinRequiredSamples);
-    if (e2e_delay_ms) {
-      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
-          uma_prefix + ".EndToEndDelayInMs" + uma_suffix, *e2e_delay_ms);
-      log_stream << uma_prefix << ".EndToEndDelayInMs" << uma_suffix << " "
-                 << *e2e_delay_ms << '\n';
-    }
-    absl::optional<int> e2e_delay_max_ms = stats.e2e_delay_counter.Max();
-    if (e2e_delay_max_ms && e2e_delay_ms) {
-      RTC_HISTOGRAM_COUNTS_SPARSE_100000(
-          uma_prefix + ".EndToEndDelayMaxInMs" + uma_suffix, *e2e_delay_max_ms);
-      log_stream << uma_prefix << ".EndToEndDelayMaxInMs" << uma_suffix << " "
-                 << *e2e_delay_max_ms << '\n';
+    HistogramSnapshot::ContentStats content;
+    content.uma_prefix = UmaPrefixForContentType(content_type);
+    content.uma_suffix = UmaSuffixForContentType(content_type);
+
+    content.e2e_delay_ms = stats.e2e_delay_counter.Avg(kMinRequiredSamples);
+    if (content.e2e_delay_ms) {
+      content.e2e_delay_max_ms = stats.e2e_delay_counter.Max();
     }
-    absl::optional<int> interframe_delay_ms =
+    content.interframe_delay_ms =
         stats.interframe_delay_counter.Avg(kMinRequiredSamples);
-    if (interframe_delay_ms) {
-      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
-          uma_prefix + ".InterframeDelayInMs" + uma_suffix,
-          *interframe_delay_ms);
-      log_stream << uma_prefix << ".InterframeDelayInMs" << uma_suffix << " "
-                 << *interframe_delay_ms << '\n';
+    if (content.interframe_delay_ms) {
+      content.interframe_delay_max_ms = stats.interframe_delay_counter.Max();
     }
-    absl::optional<int> interframe_delay_max_ms =
-        stats.interframe_delay_counter.Max();
-    if (interframe_delay_max_ms && interframe_delay_ms) {
-      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
-          uma_prefix + ".InterframeDelayMaxInMs" + uma_suffix,
-          *interframe_delay_max_ms);
-      log_stream << uma_prefix << ".InterframeDelayMaxInMs" << uma_suffix << " "
-                 << *interframe_delay_max_ms << '\n';
-    }
-
-    absl::optional<uint32_t> interframe_delay_95p_ms =
+    content.interframe_delay_95p_ms =
         stats.interframe_delay_percentiles.GetPercentile(0.95f);
-    if (interframe_delay_95p_ms && interframe_delay_ms != -1) {
-      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
-          uma_prefix + ".InterframeDelay95PercentileInMs" + uma_suffix,
-          *interframe_delay_95p_ms);
-      log_stream << uma_prefix << ".InterframeDelay95PercentileInMs"
-                 << uma_suffix << " " << *interframe_delay_95p_ms << '\n';
-    }
-
-    absl::optional<int> width = stats.received_width.Avg(kMinRequiredSamples);
-    if (width) {
-      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
-          uma_prefix + ".ReceivedWidthInPixels" + uma_suffix, *width);
-      log_stream << uma_prefix << ".ReceivedWidthInPixels" << uma_suffix << " "
-                 << *width << '\n';
-    }
-
-    absl::optional<int> height = stats.received_height.Avg(kMinRequiredSamples);
-    if (height) {
-      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
-          uma_prefix + ".ReceivedHeightInPixels" + uma_suffix, *height);
-      log_stream << uma_prefix << ".ReceivedHeightInPixels" << uma_suffix << " "
-                 << *height << '\n';
-    }
+    content.width = stats.received_width.Avg(kMinRequiredSamples);
+    content.height = stats.received_height.Avg(kMinRequiredSamples);
 
     if (content_type != VideoContentType::UNSPECIFIED) {
       // Don't report these 3 metrics unsliced, as more precise variants
       // are reported separately in this method.
       float flow_duration_sec = stats.flow_duration_ms / 1000.0;
       if (flow_duration_sec >= metrics::kMinRunTimeInSeconds) {
-        int media_bitrate_kbps = static_cast<int>(stats.total_media_bytes * 8 /
-                                                  flow_duration_sec / 1000);
-        RTC_HISTOGRAM_COUNTS_SPARSE_10000(
-            uma_prefix + ".MediaBitrateReceivedInKbps" + uma_suffix,
-            media_bitrate_kbps);
-        log_stream << uma_prefix << ".MediaBitrateReceivedInKbps" << uma_suffix
-                   << " " << media_bitrate_kbps << '\n';
+        content.media_bitrate_kbps = static_cast<int>(
+            stats.total_media_bytes * 8 / flow_duration_sec / 1000);
       }
 
       int num_total_frames =
           stats.frame_counts.key_frames + stats.frame_counts.delta_frames;
       if (num_total_frames >= kMinRequiredSamples) {
         int num_key_frames = stats.frame_counts.key_frames;
-        int key_frames_permille =
+        content.key_frames_permille =
             (num_key_frames * 1000 + num_total_frames / 2) / num_total_frames;
-        RTC_HISTOGRAM_COUNTS_SPARSE_1000(
-            uma_prefix + ".KeyFramesReceivedInPermille" + uma_suffix,
-            key_frames_permille);
-        log_stream << uma_prefix << ".KeyFramesReceivedInPermille" << uma_suffix
-                   << " " << key_frames_permille << '\n';
       }
 
-      absl::optional<int> qp = stats.qp_counter.Avg(kMinRequiredSamples);
-      if (qp) {
-        RTC_HISTOGRAM_COUNTS_SPARSE_200(
-            uma_prefix + ".Decoded.Vp8.Qp" + uma_suffix, *qp);
-        log_stream << uma_prefix << ".Decoded.Vp8.Qp" << uma_suffix << " "
-                   << *qp << '\n';
-      }
+      content.qp = stats.qp_counter.Avg(kMinRequiredSamples);
     }
+    snapshot->content_stats.push_back(std::move(content));
   }
 
   StreamDataCounters rtp_rtx_stats = rtp_stats;
@@ -411,68 +296,289 @@ void ReceiveStatisticsProxy::UpdateHistograms(
       rtp_rtx_stats.TimeSinceFirstPacketInMs(clock_->TimeInMilliseconds()) /
       1000;
   if (elapsed_sec >= metrics::kMinRunTimeInSeconds) {
-    RTC_HISTOGRAM_COUNTS_10000(
-        "WebRTC.Video.BitrateReceivedInKbps",
-        static_cast<int>(rtp_rtx_stats.transmitted.TotalBytes() * 8 /
-                         elapsed_sec / 1000));
-    int media_bitrate_kbs = static_cast<int>(rtp_stats.MediaPayloadBytes() * 8 /
-                                             elapsed_sec / 1000);
-    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.MediaBitrateReceivedInKbps",
-                               media_bitrate_kbs);
-    log_stream << "WebRTC.Video.MediaBitrateReceivedInKbps "
-               << media_bitrate_kbs << '\n';
-    RTC_HISTOGRAM_COUNTS_10000(
-        "WebRTC.Video.PaddingBitrateReceivedInKbps",
-        static_cast<int>(rtp_rtx_stats.transmitted.padding_bytes * 8 /
-                         elapsed_sec / 1000));
-    RTC_HISTOGRAM_COUNTS_10000(
-        "WebRTC.Video.RetransmittedBitrateReceivedInKbps",
-        static_cast<int>(rtp_rtx_stats.retransmitted.TotalBytes() * 8 /
-                         elapsed_sec / 1000));
+    snapshot->bitrate_kbps = static_cast<int>(
+        rtp_rtx_stats.transmitted.TotalBytes() * 8 / elapsed_sec / 1000);
+    snapshot->media_bitrate_kbps = static_cast<int>(
+        rtp_stats.MediaPayloadBytes() * 8 / elapsed_sec / 1000);
+    snapshot->padding_bitrate_kbps = static_cast<int>(
+        rtp_rtx_stats.transmitted.padding_bytes * 8 / elapsed_sec / 1000);
+    snapshot->retransmitted_bitrate_kbps = static_cast<int>(
+        rtp_rtx_stats.retransmitted.TotalBytes() * 8 / elapsed_sec / 1000);
     if (rtx_stats) {
-      RTC_HISTOGRAM_COUNTS_10000(
-          "WebRTC.Video.RtxBitrateReceivedInKbps",
-          static_cast<int>(rtx_stats->transmitted.TotalBytes() * 8 /
-                           elapsed_sec / 1000));
+      snapshot->rtx_bitrate_kbps = static_cast<int>(
+          rtx_stats->transmitted.TotalBytes() * 8 / elapsed_sec / 1000);
     }
     const RtcpPacketTypeCounter& counters = stats_.rtcp_packet_type_counts;
-    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.NackPacketsSentPerMinute",
-                               counters.nack_packets * 60 / elapsed_sec);
-    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.FirPacketsSentPerMinute",
-                               counters.fir_packets * 60 / elapsed_sec);
-    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.PliPacketsSentPerMinute",
-                               counters.pli_packets * 60 / elapsed_sec);
+    snapshot->nack_packets_per_minute =
+        counters.nack_packets * 60 / elapsed_sec;
+    snapshot->fir_packets_per_minute = counters.fir_packets * 60 / elapsed_sec;
+    snapshot->pli_packets_per_minute = counters.pli_packets * 60 / elapsed_sec;
     if (counters.nack_requests > 0) {
-      RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.UniqueNackRequestsSentInPercent",
-                               counters.UniqueNackRequestsInPercent());
+      snapshot->unique_nack_percent = counters.UniqueNackRequestsInPercent();
     }
   }
 
   if (num_certain_states_ >= kBadCallMinRequiredSamples) {
-    RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.BadCall.Any",
-                             100 * num_bad_states_ / num_certain_states_);
+    snapshot->bad_call_any_percent =
+        100 * num_bad_states_ / num_certain_states_;
   }
   absl::optional<double> fps_fraction =
       fps_threshold_.FractionHigh(kBadCallMinRequiredSamples);
   if (fps_fraction) {
-    RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.BadCall.FrameRate",
-                             static_cast<int>(100 * (1 - *fps_fraction)));
+    snapshot->bad_call_frame_rate_percent =
+        static_cast<int>(100 * (1 - *fps_fraction));
   }
   absl::optional<double> variance_fraction =
       variance_threshold_.FractionHigh(kBadCallMinRequiredSamples);
   if (variance_fraction) {
-    RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.BadCall.FrameRateVariance",
-                             static_cast<int>(100 * *variance_fraction));
+    snapshot->bad_call_frame_rate_variance_percent =
+        static_cast<int>(100 * *variance_fraction);
   }
   absl::optional<double> qp_fraction =
       qp_threshold_.FractionHigh(kBadCallMinRequiredSamples);
   if (qp_fraction) {
+    snapshot->bad_call_qp_percent = static_cast<int>(100 * *qp_fraction);
+  }
+
+  // Hand the quality observer over to the snapshot; its histograms are
+  // recorded together with the rest. Start over with a fresh observer in
+  // case the stream is started again.
+  snapshot->quality_observer = std::move(video_quality_observer_);
+  video_quality_observer_.reset(
+      new VideoQualityObserver(VideoContentType::UNSPECIFIED));
+
+  return snapshot;
+}
+
+// static
+void ReceiveStatisticsProxy::RecordHistograms(
+    const HistogramSnapshot& snapshot) {
+  char log_stream_buf[8 * 1024];
+  rtc::SimpleStringBuilder log_stream(log_stream_buf);
+
+  if (snapshot.stream_duration_sec) {
+    RTC_HISTOGRAM_COUNTS_100000("WebRTC.Video.ReceiveStreamLifetimeInSeconds",
+                                *snapshot.stream_duration_sec);
+    log_stream << "WebRTC.Video.ReceiveStreamLifetimeInSeconds "
+               << *snapshot.stream_duration_sec << '\n';
+  }
+
+  log_stream << "Frames decoded " << snapshot.frames_decoded << '\n';
+
+  if (snapshot.dropped_frames) {
+    RTC_HISTOGRAM_COUNTS_1000("WebRTC.Video.DroppedFrames.Receiver",
+                              *snapshot.dropped_frames);
+    log_stream << "WebRTC.Video.DroppedFrames.Receiver "
+               << *snapshot.dropped_frames << '\n';
+  }
+
+  if (snapshot.fraction_lost) {
+    RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.ReceivedPacketsLostInPercent",
+                             *snapshot.fraction_lost);
+    log_stream << "WebRTC.Video.ReceivedPacketsLostInPercent "
+               << *snapshot.fraction_lost << '\n';
+  }
+
+  if (snapshot.decoded_fps) {
+    RTC_HISTOGRAM_COUNTS_100("WebRTC.Video.DecodedFramesPerSecond",
+                             *snapshot.decoded_fps);
+    log_stream << "WebRTC.Video.DecodedFramesPerSecond "
+               << *snapshot.decoded_fps << '\n';
+  }
+  if (snapshot.delayed_frames_percent) {
+    RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.DelayedFramesToRenderer",
+                             *snapshot.delayed_frames_percent);
+  }
+  if (snapshot.delayed_frames_avg_delay_ms) {
+    RTC_HISTOGRAM_COUNTS_1000(
+        "WebRTC.Video.DelayedFramesToRenderer_AvgDelayInMs",
+        *snapshot.delayed_frames_avg_delay_ms);
+  }
+
+  if (snapshot.rendered_fps) {
+    RTC_HISTOGRAM_COUNTS_100("WebRTC.Video.RenderFramesPerSecond",
+                             *snapshot.rendered_fps);
+    log_stream << "WebRTC.Video.RenderFramesPerSecond "
+               << *snapshot.rendered_fps << '\n';
+    RTC_HISTOGRAM_COUNTS_100000("WebRTC.Video.RenderSqrtPixelsPerSecond",
+                                *snapshot.render_sqrt_pixels_per_sec);
+  }
+
+  if (snapshot.sync_offset_ms) {
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.AVSyncOffsetInMs",
+                               *snapshot.sync_offset_ms);
+    log_stream << "WebRTC.Video.AVSyncOffsetInMs " << *snapshot.sync_offset_ms
+               << '\n';
+  }
+  if (snapshot.freq_offset_stats.num_samples > 0) {
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.RtpToNtpFreqOffsetInKhz",
+                               snapshot.freq_offset_stats.average);
+    log_stream << "WebRTC.Video.RtpToNtpFreqOffsetInKhz "
+               << snapshot.freq_offset_stats.ToString() << '\n';
+  }
+
+  if (snapshot.key_frames_permille) {
+    RTC_HISTOGRAM_COUNTS_1000("WebRTC.Video.KeyFramesReceivedInPermille",
+                              *snapshot.key_frames_permille);
+    log_stream << "WebRTC.Video.KeyFramesReceivedInPermille "
+               << *snapshot.key_frames_permille << '\n';
+  }
+
+  if (snapshot.qp_vp8) {
+    RTC_HISTOGRAM_COUNTS_200("WebRTC.Video.Decoded.Vp8.Qp", *snapshot.qp_vp8);
+    log_stream << "WebRTC.Video.Decoded.Vp8.Qp " << *snapshot.qp_vp8 << '\n';
+  }
+  if (snapshot.decode_time_ms) {
+    RTC_HISTOGRAM_COUNTS_1000("WebRTC.Video.DecodeTimeInMs",
+                              *snapshot.decode_time_ms);
+    log_stream << "WebRTC.Video.DecodeTimeInMs " << *snapshot.decode_time_ms
+               << '\n';
+  }
+  if (snapshot.jitter_buffer_delay_ms) {
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.JitterBufferDelayInMs",
+                               *snapshot.jitter_buffer_delay_ms);
+    log_stream << "WebRTC.Video.JitterBufferDelayInMs "
+               << *snapshot.jitter_buffer_delay_ms << '\n';
+  }
+  if (snapshot.target_delay_ms) {
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.TargetDelayInMs",
+                               *snapshot.target_delay_ms);
+    log_stream << "WebRTC.Video.TargetDelayInMs " << *snapshot.target_delay_ms
+               << '\n';
+  }
+  if (snapshot.current_delay_ms) {
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.CurrentDelayInMs",
+                               *snapshot.current_delay_ms);
+    log_stream << "WebRTC.Video.CurrentDelayInMs " << *snapshot.current_delay_ms
+               << '\n';
+  }
+  if (snapshot.oneway_delay_ms) {
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.OnewayDelayInMs",
+                               *snapshot.oneway_delay_ms);
+  }
+
+  for (const auto& content : snapshot.content_stats) {
+    const std::string& uma_prefix = content.uma_prefix;
+    const std::string& uma_suffix = content.uma_suffix;
+
+    if (content.e2e_delay_ms) {
+      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
+          uma_prefix + ".EndToEndDelayInMs" + uma_suffix,
+          *content.e2e_delay_ms);
+      log_stream << uma_prefix << ".EndToEndDelayInMs" << uma_suffix << " "
+                 << *content.e2e_delay_ms << '\n';
+    }
+    if (content.e2e_delay_max_ms) {
+      RTC_HISTOGRAM_COUNTS_SPARSE_100000(
+          uma_prefix + ".EndToEndDelayMaxInMs" + uma_suffix,
+          *content.e2e_delay_max_ms);
+      log_stream << uma_prefix << ".EndToEndDelayMaxInMs" << uma_suffix << " "
+                 << *content.e2e_delay_max_ms << '\n';
+    }
+    if (content.interframe_delay_ms) {
+      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
+          uma_prefix + ".InterframeDelayInMs" + uma_suffix,
+          *content.interframe_delay_ms);
+      log_stream << uma_prefix << ".InterframeDelayInMs" << uma_suffix << " "
+                 << *content.interframe_delay_ms << '\n';
+    }
+    if (content.interframe_delay_max_ms) {
+      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
+          uma_prefix + ".InterframeDelayMaxInMs" + uma_suffix,
+          *content.interframe_delay_max_ms);
+      log_stream << uma_prefix << ".InterframeDelayMaxInMs" << uma_suffix << " "
+                 << *content.interframe_delay_max_ms << '\n';
+    }
+    if (content.interframe_delay_95p_ms) {
+      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
+          uma_prefix + ".InterframeDelay95PercentileInMs" + uma_suffix,
+          *content.interframe_delay_95p_ms);
+      log_stream << uma_prefix << ".InterframeDelay95PercentileInMs"
+                 << uma_suffix << " " << *content.interframe_delay_95p_ms
+                 << '\n';
+    }
+    if (content.width) {
+      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
+          uma_prefix + ".ReceivedWidthInPixels" + uma_suffix, *content.width);
+      log_stream << uma_prefix << ".ReceivedWidthInPixels" << uma_suffix << " "
+                 << *content.width << '\n';
+    }
+    if (content.height) {
+      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
+          uma_prefix + ".ReceivedHeightInPixels" + uma_suffix,
+          *content.height);
+      log_stream << uma_prefix << ".ReceivedHeightInPixels" << uma_suffix << " "
+                 << *content.height << '\n';
+    }
+    if (content.media_bitrate_kbps) {
+      RTC_HISTOGRAM_COUNTS_SPARSE_10000(
+          uma_prefix + ".MediaBitrateReceivedInKbps" + uma_suffix,
+          *content.media_bitrate_kbps);
+      log_stream << uma_prefix << ".MediaBitrateReceivedInKbps" << uma_suffix
+                 << " " << *content.media_bitrate_kbps << '\n';
+    }
+    if (content.key_frames_permille) {
+      RTC_HISTOGRAM_COUNTS_SPARSE_1000(
+          uma_prefix + ".KeyFramesReceivedInPermille" + uma_suffix,
+          *content.key_frames_permille);
+      log_stream << uma_prefix << ".KeyFramesReceivedInPermille" << uma_suffix
+                 << " " << *content.key_frames_permille << '\n';
+    }
+    if (content.qp) {
+      RTC_HISTOGRAM_COUNTS_SPARSE_200(
+          uma_prefix + ".Decoded.Vp8.Qp" + uma_suffix, *content.qp);
+      log_stream << uma_prefix << ".Decoded.Vp8.Qp" << uma_suffix << " "
+                 << *content.qp << '\n';
+    }
+  }
+
+  if (snapshot.bitrate_kbps) {
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.BitrateReceivedInKbps",
+                               *snapshot.bitrate_kbps);
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.MediaBitrateReceivedInKbps",
+                               *snapshot.media_bitrate_kbps);
+    log_stream << "WebRTC.Video.MediaBitrateReceivedInKbps "
+               << *snapshot.media_bitrate_kbps << '\n';
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.PaddingBitrateReceivedInKbps",
+                               *snapshot.padding_bitrate_kbps);
+    RTC_HISTOGRAM_COUNTS_10000(
+        "WebRTC.Video.RetransmittedBitrateReceivedInKbps",
+        *snapshot.retransmitted_bitrate_kbps);
+    if (snapshot.rtx_bitrate_kbps) {
+      RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.RtxBitrateReceivedInKbps",
+                                 *snapshot.rtx_bitrate_kbps);
+    }
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.NackPacketsSentPerMinute",
+                               *snapshot.nack_packets_per_minute);
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.FirPacketsSentPerMinute",
+                               *snapshot.fir_packets_per_minute);
+    RTC_HISTOGRAM_COUNTS_10000("WebRTC.Video.PliPacketsSentPerMinute",
+                               *snapshot.pli_packets_per_minute);
+    if (snapshot.unique_nack_percent) {
+      RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.UniqueNackRequestsSentInPercent",
+                               *snapshot.unique_nack_percent);
+    }
+  }
+
+  if (snapshot.bad_call_any_percent) {
+    RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.BadCall.Any",
+                             *snapshot.bad_call_any_percent);
+  }
+  if (snapshot.bad_call_frame_rate_percent) {
+    RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.BadCall.FrameRate",
+                             *snapshot.bad_call_frame_rate_percent);
+  }
+  if (snapshot.bad_call_frame_rate_variance_percent) {
+    RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.BadCall.FrameRateVariance",
+                             *snapshot.bad_call_frame_rate_variance_percent);
+  }
+  if (snapshot.bad_call_qp_percent) {
     RTC_HISTOGRAM_PERCENTAGE("WebRTC.Video.BadCall.Qp",
-                             static_cast<int>(100 * *qp_fraction));
+                             *snapshot.bad_call_qp_percent);
   }
 
   RTC_LOG(LS_INFO) << log_stream.str();
-  video_quality_observer_->UpdateHistograms();
+  snapshot.quality_observer->UpdateHistograms();
 }
 
 void ReceiveStatisticsProxy::QualitySample() {
@@ -559,20 +665,21 @@ void ReceiveStatisticsProxy::UpdateFramerate(int64_t now_ms) const {
 void ReceiveStatisticsProxy::UpdateDecodeTimeHistograms(
     int width,
     int height,
-    int decode_time_ms) const {
+    int decode_time_ms,
+    VideoCodecType codec_type,
+    const std::string& decoder_implementation) const {
   bool is_4k = (width == 3840 || width == 4096) && height == 2160;
   bool is_hd = width == 1920 && height == 1080;
   // Only update histograms for 4k/HD and VP9/H264.
-  if ((is_4k || is_hd) && (last_codec_type_ == kVideoCodecVP9 ||
-                           last_codec_type_ == kVideoCodecH264)) {
+  if ((is_4k || is_hd) &&
+      (codec_type == kVideoCodecVP9 || codec_type == kVideoCodecH264)) {
     const std::string kDecodeTimeUmaPrefix =
         "WebRTC.Video.DecodeTimePerFrameInMs.";
 
     // Each histogram needs its own line for it to not be reused in the wrong
     // way when the format changes.
-    if (last_codec_type_ == kVideoCodecVP9) {
-      bool is_sw_decoder =
-          stats_.decoder_implementation_name.compare(0, 6, "libvpx") == 0;
+    if (codec_type == kVideoCodecVP9) {
+      bool is_sw_decoder = decoder_implementation.compare(0, 6, "libvpx") == 0;
       if (is_4k) {
         if (is_sw_decoder)
           RTC_HISTOGRAM_COUNTS_1000(kDecodeTimeUmaPrefix + "Vp9.4k.Sw",
@@ -589,8 +696,7 @@ void ReceiveStatisticsProxy::UpdateDecodeTimeHistograms(
                                     decode_time_ms);
       }
     } else {
-      bool is_sw_decoder =
-          stats_.decoder_implementation_name.compare(0, 6, "FFmpeg") == 0;
+      bool is_sw_decoder = decoder_implementation.compare(0, 6, "FFmpeg") == 0;
       if (is_4k) {
         if (is_sw_decoder)
           RTC_HISTOGRAM_COUNTS_1000(kDecodeTimeUmaPrefix + "H264.4k.Sw",
@@ -670,7 +776,8 @@ void ReceiveStatisticsProxy::OnFrameBufferTimingsUpdated(
     int target_delay_ms,
     int jitter_buffer_ms,
     int min_playout_delay_ms,
-    int render_delay_ms) {
+    int render_delay_ms,
+    size_t decode_budget_overruns) {
   rtc::CritScope lock(&crit_);
   stats_.max_decode_ms = max_decode_ms;
   stats_.current_delay_ms = current_delay_ms;
@@ -678,6 +785,8 @@ void ReceiveStatisticsProxy::OnFrameBufferTimingsUpdated(
   stats_.jitter_buffer_ms = jitter_buffer_ms;
   stats_.min_playout_delay_ms = min_playout_delay_ms;
   stats_.render_delay_ms = render_delay_ms;
+  stats_.frames_decoded_over_budget =
+      static_cast<uint32_t>(decode_budget_overruns);
   jitter_buffer_delay_counter_.Add(jitter_buffer_ms);
   target_delay_counter_.Add(target_delay_ms);
   current_delay_counter_.Add(current_delay_ms);
@@ -733,64 +842,76 @@ void ReceiveStatisticsProxy::OnDecodedFrame(const VideoFrame& frame,
                                             absl::optional<uint8_t> qp,
                                             int32_t decode_time_ms,
                                             VideoContentType content_type) {
-  rtc::CritScope lock(&crit_);
-
   uint64_t now_ms = clock_->TimeInMilliseconds();
+  // Sampled under |crit_| and consumed by the histogram update below, which
+  // runs after the lock has been released to keep per-frame histogram work
+  // out of the critical section shared with GetStats().
+  VideoCodecType codec_type = kVideoCodecGeneric;
+  std::string decoder_implementation;
+
+  {
+    rtc::CritScope lock(&crit_);
+
+    if (videocontenttypehelpers::IsScreenshare(content_type) !=
+        videocontenttypehelpers::IsScreenshare(last_content_type_)) {
+      // Reset the quality observer if content type is switched. But first
+      // report stats for the previous part of the call.
+      video_quality_observer_->UpdateHistograms();
+      video_quality_observer_.reset(new VideoQualityObserver(content_type));
+    }
 
-  if (videocontenttypehelpers::IsScreenshare(content_type) !=
-      videocontenttypehelpers::IsScreenshare(last_content_type_)) {
-    // Reset the quality observer if content type is switched. But first report
-    // stats for the previous part of the call.
-    video_quality_observer_->UpdateHistograms();
-    video_quality_observer_.reset(new VideoQualityObserver(content_type));
-  }
-
-  video_quality_observer_->OnDecodedFrame(frame, qp, last_codec_type_);
+    video_quality_observer_->OnDecodedFrame(frame, qp, last_codec_type_);
 
-  ContentSpecificStats* content_specific_stats =
-      &content_specific_stats_[content_type];
-  ++stats_.frames_decoded;
-  if (qp) {
-    if (!stats_.qp_sum) {
-      if (stats_.frames_decoded != 1) {
-        RTC_LOG(LS_WARNING)
-            << "Frames decoded was not 1 when first qp value was received.";
+    ContentSpecificStats* content_specific_stats =
+        &content_specific_stats_[content_type];
+    ++stats_.frames_decoded;
+    if (qp) {
+      if (!stats_.qp_sum) {
+        if (stats_.frames_decoded != 1) {
+          RTC_LOG(LS_WARNING)
+              << "Frames decoded was not 1 when first qp value was received.";
+        }
+        stats_.qp_sum = 0;
       }
-      stats_.qp_sum = 0;
+      *stats_.qp_sum += *qp;
+      content_specific_stats->qp_counter.Add(*qp);
+    } else if (stats_.qp_sum) {
+      RTC_LOG(LS_WARNING)
+          << "QP sum was already set and no QP was given for a frame.";
+      stats_.qp_sum.reset();
+    }
+    decode_time_counter_.Add(decode_time_ms);
+    stats_.decode_ms = decode_time_ms;
+    stats_.total_decode_time_ms += decode_time_ms;
+    last_content_type_ = content_type;
+    decode_fps_estimator_.Update(1, now_ms);
+    if (last_decoded_frame_time_ms_) {
+      int64_t interframe_delay_ms = now_ms - *last_decoded_frame_time_ms_;
+      RTC_DCHECK_GE(interframe_delay_ms, 0);
+      double interframe_delay = interframe_delay_ms / 1000.0;
+      stats_.total_inter_frame_delay += interframe_delay;
+      stats_.total_squared_inter_frame_delay +=
+          interframe_delay * interframe_delay;
+      interframe_delay_max_moving_.Add(interframe_delay_ms, now_ms);
+      content_specific_stats->interframe_delay_counter.Add(interframe_delay_ms);
+      content_specific_stats->interframe_delay_percentiles.Add(
+          interframe_delay_ms);
+      content_specific_stats->flow_duration_ms += interframe_delay_ms;
+    }
+    if (stats_.frames_decoded == 1) {
+      first_decoded_frame_time_ms_.emplace(now_ms);
+    }
+    last_decoded_frame_time_ms_.emplace(now_ms);
+
+    if (enable_decode_time_histograms_) {
+      codec_type = last_codec_type_;
+      decoder_implementation = stats_.decoder_implementation_name;
     }
-    *stats_.qp_sum += *qp;
-    content_specific_stats->qp_counter.Add(*qp);
-  } else if (stats_.qp_sum) {
-    RTC_LOG(LS_WARNING)
-        << "QP sum was already set and no QP was given for a frame.";
-    stats_.qp_sum.reset();
-  }
-  decode_time_counter_.Add(decode_time_ms);
-  stats_.decode_ms = decode_time_ms;
-  stats_.total_decode_time_ms += decode_time_ms;
+  }
   if (enable_decode_time_histograms_) {
-    UpdateDecodeTimeHistograms(frame.width(), frame.height(), decode_time_ms);
-  }
-
-  last_content_type_ = content_type;
-  decode_fps_estimator_.Update(1, now_ms);
-  if (last_decoded_frame_time_ms_) {
-    int64_t interframe_delay_ms = now_ms - *last_decoded_frame_time_ms_;
-    RTC_DCHECK_GE(interframe_delay_ms, 0);
-    double interframe_delay = interframe_delay_ms / 1000.0;
-    stats_.total_inter_frame_delay += interframe_delay;
-    stats_.total_squared_inter_frame_delay +=
-        interframe_delay * interframe_delay;
-    interframe_delay_max_moving_.Add(interframe_delay_ms, now_ms);
-    content_specific_stats->interframe_delay_counter.Add(interframe_delay_ms);
-    content_specific_stats->interframe_delay_percentiles.Add(
-        interframe_delay_ms);
-    content_specific_stats->flow_duration_ms += interframe_delay_ms;
-  }
-  if (stats_.frames_decoded == 1) {
-    first_decoded_frame_time_ms_.emplace(now_ms);
-  }
-  last_decoded_frame_time_ms_.emplace(now_ms);
+    UpdateDecodeTimeHistograms(frame.width(), frame.height(), decode_time_ms,
+                               codec_type, decoder_implementation);
+  }
 }
 
 void ReceiveStatisticsProxy::OnRenderedFrame(const VideoFrame& frame) {
@@ -919,6 +1040,13 @@ void ReceiveStatisticsProxy::DecoderThreadStopped() {
   decode_thread_.Detach();
 }
 
+ReceiveStatisticsProxy::HistogramSnapshot::HistogramSnapshot() = default;
+
+ReceiveStatisticsProxy::HistogramSnapshot::HistogramSnapshot(
+    HistogramSnapshot&&) = default;
+
+ReceiveStatisticsProxy::HistogramSnapshot::~HistogramSnapshot() = default;
+
 ReceiveStatisticsProxy::ContentSpecificStats::ContentSpecificStats()
     : interframe_delay_percentiles(kMaxCommonInterframeDelayMs) {}
 
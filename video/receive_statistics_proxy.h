@@ -42,6 +42,67 @@ class ReceiveStatisticsProxy : public VCMReceiveStatisticsCallback,
                                public RtcpPacketTypeCounterObserver,
                                public CallStatsObserver {
  public:
+  // Final values for the histograms recorded at stream teardown, captured
+  // under the stats lock by TakeHistogramSnapshot() and consumed lock-free
+  // by RecordHistograms(), possibly after the proxy is gone.
+  struct HistogramSnapshot {
+    HistogramSnapshot();
+    HistogramSnapshot(HistogramSnapshot&&);
+    ~HistogramSnapshot();
+
+    // Per content type slice ("", ".S0", ".ExperimentGroup0", ...).
+    struct ContentStats {
+      std::string uma_prefix;
+      std::string uma_suffix;
+      absl::optional<int> e2e_delay_ms;
+      absl::optional<int> e2e_delay_max_ms;
+      absl::optional<int> interframe_delay_ms;
+      absl::optional<int> interframe_delay_max_ms;
+      absl::optional<uint32_t> interframe_delay_95p_ms;
+      absl::optional<int> width;
+      absl::optional<int> height;
+      absl::optional<int> media_bitrate_kbps;
+      absl::optional<int> key_frames_permille;
+      absl::optional<int> qp;
+    };
+
+    uint32_t frames_decoded = 0;
+    absl::optional<int> stream_duration_sec;
+    absl::optional<int> dropped_frames;
+    absl::optional<int> fraction_lost;
+    absl::optional<int> decoded_fps;
+    absl::optional<int> delayed_frames_percent;
+    absl::optional<int> delayed_frames_avg_delay_ms;
+    absl::optional<int> rendered_fps;
+    absl::optional<int> render_sqrt_pixels_per_sec;
+    absl::optional<int> sync_offset_ms;
+    AggregatedStats freq_offset_stats;
+    absl::optional<int> key_frames_permille;
+    absl::optional<int> qp_vp8;
+    absl::optional<int> decode_time_ms;
+    absl::optional<int> jitter_buffer_delay_ms;
+    absl::optional<int> target_delay_ms;
+    absl::optional<int> current_delay_ms;
+    absl::optional<int> oneway_delay_ms;
+    std::vector<ContentStats> content_stats;
+    absl::optional<int> bitrate_kbps;
+    absl::optional<int> media_bitrate_kbps;
+    absl::optional<int> padding_bitrate_kbps;
+    absl::optional<int> retransmitted_bitrate_kbps;
+    absl::optional<int> rtx_bitrate_kbps;
+    absl::optional<int> nack_packets_per_minute;
+    absl::optional<int> fir_packets_per_minute;
+    absl::optional<int> pli_packets_per_minute;
+    absl::optional<int> unique_nack_percent;
+    absl::optional<int> bad_call_any_percent;
+    absl::optional<int> bad_call_frame_rate_percent;
+    absl::optional<int> bad_call_frame_rate_variance_percent;
+    absl::optional<int> bad_call_qp_percent;
+    // Records the per-stream video quality histograms and is destroyed with
+    // the snapshot; the proxy starts over with a fresh observer.
+    std::unique_ptr<VideoQualityObserver> quality_observer;
+  };
+
   ReceiveStatisticsProxy(const VideoReceiveStream::Config* config,
                          Clock* clock);
   ~ReceiveStatisticsProxy() = default;
@@ -76,7 +137,8 @@ class ReceiveStatisticsProxy : public VCMReceiveStatisticsCallback,
                                    int target_delay_ms,
                                    int jitter_buffer_ms,
                                    int min_playout_delay_ms,
-                                   int render_delay_ms) override;
+                                   int render_delay_ms,
+                                   size_t decode_budget_overruns) override;
 
   void OnTimingFrameInfoUpdated(const TimingFrameInfo& info) override;
 
@@ -97,11 +159,26 @@ class ReceiveStatisticsProxy : public VCMReceiveStatisticsCallback,
   void DecoderThreadStopped();
 
   // Produce histograms. Must be called after DecoderThreadStopped(), typically
-  // at the end of the call.
+  // at the end of the call. Equivalent to recording a snapshot inline; when
+  // teardown latency matters, use TakeHistogramSnapshot() and post
+  // RecordHistograms() to a background queue instead.
   void UpdateHistograms(absl::optional<int> fraction_lost,
                         const StreamDataCounters& rtp_stats,
                         const StreamDataCounters* rtx_stats);
 
+  // Captures everything RecordHistograms() needs, holding the stats lock
+  // only for the duration of the copy. Must be called after
+  // DecoderThreadStopped(), like UpdateHistograms().
+  std::unique_ptr<HistogramSnapshot> TakeHistogramSnapshot(
+      absl::optional<int> fraction_lost,
+      const StreamDataCounters& rtp_stats,
+      const StreamDataCounters* rtx_stats);
+
+  // Computes nothing and takes no locks; only feeds the snapshot values to
+  // the histogram registry and the log. Safe to run after the proxy that
+  // produced the snapshot has been destroyed.
+  static void RecordHistograms(const HistogramSnapshot& snapshot);
+
  private:
   struct QpCounters {
     rtc::SampleCounter vp8;
@@ -130,10 +207,16 @@ class ReceiveStatisticsProxy : public VCMReceiveStatisticsCallback,
   void UpdateFramerate(int64_t now_ms) const
       RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
 
+  // Updates the decode time histograms. Does not touch any state guarded by
+  // |crit_|; building histogram names and looking them up in the global
+  // registry is done per decoded frame and should not extend the critical
+  // section the decode thread shares with GetStats().
   void UpdateDecodeTimeHistograms(int width,
                                   int height,
-                                  int decode_time_ms) const
-      RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
+                                  int decode_time_ms,
+                                  VideoCodecType codec_type,
+                                  const std::string& decoder_implementation)
+      const RTC_LOCKS_EXCLUDED(crit_);
 
   absl::optional<int64_t> GetCurrentEstimatedPlayoutNtpTimestampMs(
       int64_t now_ms) const RTC_EXCLUSIVE_LOCKS_REQUIRED(crit_);
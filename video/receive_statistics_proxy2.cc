@@ -725,12 +725,13 @@ void ReceiveStatisticsProxy::OnFrameBufferTimingsUpdated(
     int target_delay_ms,
     int jitter_buffer_ms,
     int min_playout_delay_ms,
-    int render_delay_ms) {
+    int render_delay_ms,
+    size_t decode_budget_overruns) {
   RTC_DCHECK_RUN_ON(&decode_queue_);
   worker_thread_->PostTask(ToQueuedTask(
       task_safety_,
       [max_decode_ms, current_delay_ms, target_delay_ms, jitter_buffer_ms,
-       min_playout_delay_ms, render_delay_ms, this]() {
+       min_playout_delay_ms, render_delay_ms, decode_budget_overruns, this]() {
         RTC_DCHECK_RUN_ON(&main_thread_);
         stats_.max_decode_ms = max_decode_ms;
         stats_.current_delay_ms = current_delay_ms;
@@ -738,6 +739,8 @@ void ReceiveStatisticsProxy::OnFrameBufferTimingsUpdated(
         stats_.jitter_buffer_ms = jitter_buffer_ms;
         stats_.min_playout_delay_ms = min_playout_delay_ms;
         stats_.render_delay_ms = render_delay_ms;
+        stats_.frames_decoded_over_budget =
+            static_cast<uint32_t>(decode_budget_overruns);
         jitter_buffer_delay_counter_.Add(jitter_buffer_ms);
         target_delay_counter_.Add(target_delay_ms);
         current_delay_counter_.Add(current_delay_ms);
@@ -92,7 +92,8 @@ class ReceiveStatisticsProxy : public VCMReceiveStatisticsCallback,
                                    int target_delay_ms,
                                    int jitter_buffer_ms,
                                    int min_playout_delay_ms,
-                                   int render_delay_ms) override;
+                                   int render_delay_ms,
+                                   size_t decode_budget_overruns) override;
 
   void OnTimingFrameInfoUpdated(const TimingFrameInfo& info) override;
 
@@ -512,7 +512,8 @@ TEST_F(ReceiveStatisticsProxy2Test, GetStatsReportsDecodeTimingStats) {
   statistics_proxy_->OnRttUpdate(kRttMs);
   statistics_proxy_->OnFrameBufferTimingsUpdated(
       kMaxDecodeMs, kCurrentDelayMs, kTargetDelayMs, kJitterBufferMs,
-      kMinPlayoutDelayMs, kRenderDelayMs);
+      kMinPlayoutDelayMs, kRenderDelayMs,
+        /*decode_budget_overruns=*/0);
   VideoReceiveStream::Stats stats = FlushAndGetStats();
   EXPECT_EQ(kMaxDecodeMs, stats.max_decode_ms);
   EXPECT_EQ(kCurrentDelayMs, stats.current_delay_ms);
@@ -867,7 +868,8 @@ TEST_F(ReceiveStatisticsProxy2Test,
   for (int i = 0; i < kMinRequiredSamples - 1; ++i) {
     statistics_proxy_->OnFrameBufferTimingsUpdated(
         kMaxDecodeMs, kCurrentDelayMs, kTargetDelayMs, kJitterBufferMs,
-        kMinPlayoutDelayMs, kRenderDelayMs);
+        kMinPlayoutDelayMs, kRenderDelayMs,
+        /*decode_budget_overruns=*/0);
   }
 
   statistics_proxy_->UpdateHistograms(absl::nullopt, StreamDataCounters(),
@@ -891,7 +893,8 @@ TEST_F(ReceiveStatisticsProxy2Test, TimingHistogramsAreUpdated) {
   for (int i = 0; i < kMinRequiredSamples; ++i) {
     statistics_proxy_->OnFrameBufferTimingsUpdated(
         kMaxDecodeMs, kCurrentDelayMs, kTargetDelayMs, kJitterBufferMs,
-        kMinPlayoutDelayMs, kRenderDelayMs);
+        kMinPlayoutDelayMs, kRenderDelayMs,
+        /*decode_budget_overruns=*/0);
   }
 
   FlushAndUpdateHistograms(absl::nullopt, StreamDataCounters(), nullptr);
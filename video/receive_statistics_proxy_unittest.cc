@@ -482,7 +482,8 @@ TEST_F(ReceiveStatisticsProxyTest, GetStatsReportsDecodeTimingStats) {
   statistics_proxy_->OnRttUpdate(kRttMs, 0);
   statistics_proxy_->OnFrameBufferTimingsUpdated(
       kMaxDecodeMs, kCurrentDelayMs, kTargetDelayMs, kJitterBufferMs,
-      kMinPlayoutDelayMs, kRenderDelayMs);
+      kMinPlayoutDelayMs, kRenderDelayMs,
+        /*decode_budget_overruns=*/0);
   VideoReceiveStream::Stats stats = statistics_proxy_->GetStats();
   EXPECT_EQ(kMaxDecodeMs, stats.max_decode_ms);
   EXPECT_EQ(kCurrentDelayMs, stats.current_delay_ms);
@@ -602,6 +603,27 @@ TEST_F(ReceiveStatisticsProxyTest, LifetimeHistogramIsUpdated) {
                             kTimeSec));
 }
 
+TEST_F(ReceiveStatisticsProxyTest, SnapshotOutlivesProxy) {
+  const int64_t kTimeSec = 3;
+  fake_clock_.AdvanceTimeMilliseconds(kTimeSec * 1000);
+  // Need at least one frame to report stream lifetime.
+  statistics_proxy_->OnCompleteFrame(true, 1000, VideoContentType::UNSPECIFIED);
+  std::unique_ptr<ReceiveStatisticsProxy::HistogramSnapshot> snapshot =
+      statistics_proxy_->TakeHistogramSnapshot(absl::nullopt,
+                                               StreamDataCounters(), nullptr);
+  // Nothing recorded until the snapshot is drained, which may happen on a
+  // background queue after the proxy is gone.
+  EXPECT_METRIC_EQ(
+      0, metrics::NumSamples("WebRTC.Video.ReceiveStreamLifetimeInSeconds"));
+  statistics_proxy_.reset();
+  ReceiveStatisticsProxy::RecordHistograms(*snapshot);
+  EXPECT_METRIC_EQ(
+      1, metrics::NumSamples("WebRTC.Video.ReceiveStreamLifetimeInSeconds"));
+  EXPECT_METRIC_EQ(
+      1, metrics::NumEvents("WebRTC.Video.ReceiveStreamLifetimeInSeconds",
+                            kTimeSec));
+}
+
 TEST_F(ReceiveStatisticsProxyTest,
        LifetimeHistogramNotReportedForEmptyStreams) {
   const int64_t kTimeSec = 3;
@@ -836,7 +858,8 @@ TEST_F(ReceiveStatisticsProxyTest, TimingHistogramsNotUpdatedForTooFewSamples) {
   for (int i = 0; i < kMinRequiredSamples - 1; ++i) {
     statistics_proxy_->OnFrameBufferTimingsUpdated(
         kMaxDecodeMs, kCurrentDelayMs, kTargetDelayMs, kJitterBufferMs,
-        kMinPlayoutDelayMs, kRenderDelayMs);
+        kMinPlayoutDelayMs, kRenderDelayMs,
+        /*decode_budget_overruns=*/0);
   }
 
   statistics_proxy_->UpdateHistograms(absl::nullopt, StreamDataCounters(),
@@ -860,7 +883,8 @@ TEST_F(ReceiveStatisticsProxyTest, TimingHistogramsAreUpdated) {
   for (int i = 0; i < kMinRequiredSamples; ++i) {
     statistics_proxy_->OnFrameBufferTimingsUpdated(
         kMaxDecodeMs, kCurrentDelayMs, kTargetDelayMs, kJitterBufferMs,
-        kMinPlayoutDelayMs, kRenderDelayMs);
+        kMinPlayoutDelayMs, kRenderDelayMs,
+        /*decode_budget_overruns=*/0);
   }
 
   statistics_proxy_->UpdateHistograms(absl::nullopt, StreamDataCounters(),
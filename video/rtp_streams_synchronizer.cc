@@ -10,6 +10,8 @@
 
 #include "video/rtp_streams_synchronizer.h"
 
+#include <map>
+
 #include "absl/types/optional.h"
 #include "call/syncable.h"
 #include "rtc_base/checks.h"
@@ -23,6 +25,14 @@ namespace {
 // Time interval for logging stats.
 constexpr int64_t kStatsLogIntervalMs = 10000;
 
+// Interval between audio/video sync adjustments.
+constexpr int64_t kSyncIntervalMs = 1000;
+
+// Maximum age of a cached audio measurement before the audio stream is
+// queried again. Must be shorter than the one second sync interval so that
+// every Process() call still observes a recent measurement.
+constexpr int64_t kAudioMeasurementMaxAgeMs = 500;
+
 bool UpdateMeasurements(StreamSynchronization::Measurements* stream,
                         const Syncable::Info& info) {
   RTC_DCHECK(stream);
@@ -36,6 +46,80 @@ bool UpdateMeasurements(StreamSynchronization::Measurements* stream,
   }
   return true;
 }
+
+// Process-wide registry of audio measurements shared between synchronizers.
+// When many video streams are synchronized against the same audio stream
+// (e.g. a conference call with one mixed audio stream), each synchronizer
+// would otherwise query the audio stream and update its own RtpToNtpEstimator
+// with identical RTCP sender reports once per second. The registry queries
+// each audio stream at most once per kAudioMeasurementMaxAgeMs and hands out
+// copies of the resulting measurements, so the per-second cost is independent
+// of the number of video streams.
+class SharedAudioMeasurements {
+ public:
+  static SharedAudioMeasurements* Instance() {
+    static SharedAudioMeasurements* const instance =
+        new SharedAudioMeasurements();
+    return instance;
+  }
+
+  void AddSyncable(Syncable* syncable_audio) {
+    RTC_DCHECK(syncable_audio);
+    rtc::CritScope lock(&lock_);
+    ++entries_[syncable_audio].ref_count;
+  }
+
+  void RemoveSyncable(Syncable* syncable_audio) {
+    RTC_DCHECK(syncable_audio);
+    rtc::CritScope lock(&lock_);
+    auto it = entries_.find(syncable_audio);
+    RTC_DCHECK(it != entries_.end());
+    if (--it->second.ref_count == 0)
+      entries_.erase(it);
+  }
+
+  // Returns the most recent info reported by |syncable_audio|, querying the
+  // stream only if the cached measurement is older than
+  // kAudioMeasurementMaxAgeMs, and copies the matching measurements into
+  // |measurements|. Returns nullopt if the last query failed.
+  absl::optional<Syncable::Info> Measure(
+      Syncable* syncable_audio,
+      int64_t now_ms,
+      StreamSynchronization::Measurements* measurements) {
+    RTC_DCHECK(syncable_audio);
+    RTC_DCHECK(measurements);
+    rtc::CritScope lock(&lock_);
+    auto it = entries_.find(syncable_audio);
+    RTC_DCHECK(it != entries_.end());
+    Entry& entry = it->second;
+    if (entry.last_refresh_ms == -1 ||
+        now_ms - entry.last_refresh_ms >= kAudioMeasurementMaxAgeMs) {
+      entry.last_refresh_ms = now_ms;
+      absl::optional<Syncable::Info> info = syncable_audio->GetInfo();
+      if (info && UpdateMeasurements(&entry.measurements, *info)) {
+        entry.info = info;
+      } else {
+        entry.info = absl::nullopt;
+      }
+    }
+    if (entry.info)
+      *measurements = entry.measurements;
+    return entry.info;
+  }
+
+ private:
+  struct Entry {
+    int ref_count = 0;
+    int64_t last_refresh_ms = -1;
+    absl::optional<Syncable::Info> info;
+    StreamSynchronization::Measurements measurements;
+  };
+
+  SharedAudioMeasurements() = default;
+
+  rtc::CriticalSection lock_;
+  std::map<Syncable*, Entry> entries_ RTC_GUARDED_BY(lock_);
+};
 }  // namespace
 
 RtpStreamsSynchronizer::RtpStreamsSynchronizer(Syncable* syncable_video)
@@ -48,7 +132,11 @@ RtpStreamsSynchronizer::RtpStreamsSynchronizer(Syncable* syncable_video)
   process_thread_checker_.Detach();
 }
 
-RtpStreamsSynchronizer::~RtpStreamsSynchronizer() = default;
+RtpStreamsSynchronizer::~RtpStreamsSynchronizer() {
+  rtc::CritScope lock(&crit_);
+  if (syncable_audio_)
+    SharedAudioMeasurements::Instance()->RemoveSyncable(syncable_audio_);
+}
 
 void RtpStreamsSynchronizer::ConfigureSync(Syncable* syncable_audio) {
   rtc::CritScope lock(&crit_);
@@ -57,6 +145,10 @@ void RtpStreamsSynchronizer::ConfigureSync(Syncable* syncable_audio) {
     return;
   }
 
+  if (syncable_audio_)
+    SharedAudioMeasurements::Instance()->RemoveSyncable(syncable_audio_);
+  if (syncable_audio)
+    SharedAudioMeasurements::Instance()->AddSyncable(syncable_audio);
   syncable_audio_ = syncable_audio;
   sync_.reset(nullptr);
   if (syncable_audio_) {
@@ -67,14 +159,19 @@ void RtpStreamsSynchronizer::ConfigureSync(Syncable* syncable_audio) {
 
 int64_t RtpStreamsSynchronizer::TimeUntilNextProcess() {
   RTC_DCHECK_RUN_ON(&process_thread_checker_);
-  const int64_t kSyncIntervalMs = 1000;
   return kSyncIntervalMs -
          (rtc::TimeNanos() - last_sync_time_) / rtc::kNumNanosecsPerMillisec;
 }
 
 void RtpStreamsSynchronizer::Process() {
   RTC_DCHECK_RUN_ON(&process_thread_checker_);
-  last_sync_time_ = rtc::TimeNanos();
+  // Round the sync reference time down to a multiple of the interval, so that
+  // the synchronizers of all streams on a shared process thread fall due at
+  // the same second boundary and ride along on a single wakeup.
+  const int64_t now_ns = rtc::TimeNanos();
+  constexpr int64_t kSyncIntervalNanos =
+      kSyncIntervalMs * rtc::kNumNanosecsPerMillisec;
+  last_sync_time_ = now_ns - (now_ns % kSyncIntervalNanos);
 
   rtc::CritScope lock(&crit_);
   if (!syncable_audio_) {
@@ -89,8 +186,10 @@ void RtpStreamsSynchronizer::Process() {
     log_stats = true;
   }
 
-  absl::optional<Syncable::Info> audio_info = syncable_audio_->GetInfo();
-  if (!audio_info || !UpdateMeasurements(&audio_measurement_, *audio_info)) {
+  absl::optional<Syncable::Info> audio_info =
+      SharedAudioMeasurements::Instance()->Measure(syncable_audio_, now_ms,
+                                                   &audio_measurement_);
+  if (!audio_info) {
     return;
   }
 
@@ -77,6 +77,25 @@ int PacketBufferMaxSize() {
   return packet_buffer_max_size;
 }
 
+// Returns true if no other frame may depend on |frame|, so that dropping
+// it costs only the frame itself. Without a signal that proves the frame is
+// safe to discard, false is returned.
+bool IsNonReferenceFrame(const video_coding::RtpFrameObject& frame) {
+  if (frame.FrameType() == VideoFrameType::kVideoFrameKey)
+    return false;
+  const RTPVideoHeader& video_header = frame.GetRtpVideoHeader();
+  if (video_header.generic) {
+    return absl::c_linear_search(
+        video_header.generic->decode_target_indications,
+        DecodeTargetIndication::kDiscardable);
+  }
+  if (video_header.codec == kVideoCodecVP8) {
+    return absl::get<RTPVideoHeaderVP8>(video_header.video_type_header)
+        .nonReference;
+  }
+  return false;
+}
+
 }  // namespace
 
 std::unique_ptr<RtpRtcp> CreateRtpRtcpModule(
@@ -361,10 +380,11 @@ void RtpVideoStreamReceiver::AddReceiveCodec(
     const VideoCodec& video_codec,
     const std::map<std::string, std::string>& codec_params,
     bool raw_payload) {
-  payload_type_map_.emplace(
-      video_codec.plType,
+  std::unique_ptr<VideoRtpDepacketizer> depacketizer =
       raw_payload ? std::make_unique<VideoRtpDepacketizerRaw>()
-                  : CreateVideoRtpDepacketizer(video_codec.codecType));
+                  : CreateVideoRtpDepacketizer(video_codec.codecType);
+  depacketizer->SetBitstreamBufferPool(&bitstream_buffer_pool_);
+  payload_type_map_.emplace(video_codec.plType, std::move(depacketizer));
   pt_codec_params_.emplace(video_codec.plType, codec_params);
 }
 
@@ -610,9 +630,8 @@ void RtpVideoStreamReceiver::OnReceivedPayloadData(
     }
 
     video_coding::H264SpsPpsTracker::FixedBitstream fixed =
-        tracker_.CopyAndFixBitstream(
-            rtc::MakeArrayView(codec_payload.cdata(), codec_payload.size()),
-            &packet->video_header);
+        tracker_.CopyAndFixBitstream(std::move(codec_payload),
+                                     &packet->video_header);
 
     switch (fixed.action) {
       case video_coding::H264SpsPpsTracker::kRequestKeyframe:
@@ -846,6 +865,18 @@ void RtpVideoStreamReceiver::OnAssembledFrame(
     has_received_frame_ = true;
   }
 
+  if (load_shedding_.load(std::memory_order_relaxed) &&
+      IsNonReferenceFrame(*frame)) {
+    // Shed the frame before it costs reference-finder work and decode-queue
+    // space; overload then shows up as reduced temporal resolution rather
+    // than a growing frame buffer.
+    ++num_frames_shed_;
+    if (loss_notification_controller_) {
+      loss_notification_controller_->OnDiscardedFrame(frame->last_seq_num());
+    }
+    return;
+  }
+
   rtc::CritScope lock(&reference_finder_lock_);
   // Reset |reference_finder_| if |frame| is new and the codec have changed.
   if (current_codec_) {
@@ -897,9 +928,20 @@ void RtpVideoStreamReceiver::OnCompleteFrame(
   }
   last_completed_picture_id_ =
       std::max(last_completed_picture_id_, frame->id.picture_id);
+  {
+    rtc::CritScope lock(&encoded_frame_tap_lock_);
+    if (encoded_frame_tap_) {
+      encoded_frame_tap_->OnCompleteFrame(*frame);
+    }
+  }
   complete_frame_callback_->OnCompleteFrame(std::move(frame));
 }
 
+void RtpVideoStreamReceiver::SetEncodedFrameTap(EncodedFrameTap* tap) {
+  rtc::CritScope lock(&encoded_frame_tap_lock_);
+  encoded_frame_tap_ = tap;
+}
+
 void RtpVideoStreamReceiver::OnDecryptedFrame(
     std::unique_ptr<video_coding::RtpFrameObject> frame) {
   rtc::CritScope lock(&reference_finder_lock_);
@@ -947,6 +989,22 @@ absl::optional<int64_t> RtpVideoStreamReceiver::LastReceivedKeyframePacketMs()
   return packet_buffer_.LastReceivedKeyframePacketMs();
 }
 
+size_t RtpVideoStreamReceiver::PacketBufferMemoryUsage() const {
+  return packet_buffer_.UsedMemoryBytes();
+}
+
+size_t RtpVideoStreamReceiver::TrimPacketBuffer() {
+  const size_t released_bytes = packet_buffer_.UsedMemoryBytes();
+  if (released_bytes == 0) {
+    return 0;
+  }
+  packet_buffer_.Clear();
+  // The dropped packets leave holes in any partially assembled frames, so ask
+  // for a key frame to resynchronize the decoder.
+  RequestKeyFrame();
+  return released_bytes;
+}
+
 void RtpVideoStreamReceiver::AddSecondarySink(RtpPacketSinkInterface* sink) {
   RTC_DCHECK_RUN_ON(&worker_task_checker_);
   RTC_DCHECK(!absl::c_linear_search(secondary_sinks_, sink));
@@ -1097,6 +1155,15 @@ void RtpVideoStreamReceiver::FrameContinuous(int64_t picture_id) {
     nack_module_->ClearUpTo(seq_num);
 }
 
+void RtpVideoStreamReceiver::SetLoadShedding(bool enabled) {
+  const bool was_enabled =
+      load_shedding_.exchange(enabled, std::memory_order_relaxed);
+  if (was_enabled != enabled) {
+    RTC_LOG(LS_INFO) << "Load shedding of non-reference frames "
+                     << (enabled ? "enabled." : "disabled.");
+  }
+}
+
 void RtpVideoStreamReceiver::FrameDecoded(int64_t picture_id) {
   int seq_num = -1;
   {
@@ -26,6 +26,7 @@
 #include "call/rtp_packet_sink_interface.h"
 #include "call/syncable.h"
 #include "call/video_receive_stream.h"
+#include "common_video/include/encoded_image_buffer_pool.h"
 #include "modules/rtp_rtcp/include/receive_statistics.h"
 #include "modules/rtp_rtcp/include/remote_ntp_time_estimator.h"
 #include "modules/rtp_rtcp/include/rtp_header_extension_map.h"
@@ -130,6 +131,11 @@ class RtpVideoStreamReceiver : public LossNotificationSender,
 
   void FrameDecoded(int64_t seq_num);
 
+  // Enables or disables early dropping of assembled non-reference frames,
+  // used by the receive stream when the decode queue falls behind. May be
+  // called from any thread.
+  void SetLoadShedding(bool enabled);
+
   void SignalNetworkState(NetworkState state);
 
   // Returns number of different frames seen.
@@ -192,12 +198,40 @@ class RtpVideoStreamReceiver : public LossNotificationSender,
   void SetDepacketizerToDecoderFrameTransformer(
       rtc::scoped_refptr<FrameTransformerInterface> frame_transformer);
 
+  // Observes assembled encoded frames before they enter the decode path,
+  // so that recording or forwarding pipelines can consume the encoded
+  // bitstream without running a decoder.
+  class EncodedFrameTap {
+   public:
+    // Called on the network thread for every complete frame, before the
+    // frame is handed on towards the decoder. |frame| is only guaranteed to
+    // be alive for the duration of the call, but its payload buffer is
+    // refcounted and can be retained without a copy through
+    // frame.GetEncodedData(). Keyframe boundaries are available through
+    // frame.FrameType().
+    virtual void OnCompleteFrame(const video_coding::EncodedFrame& frame) = 0;
+
+   protected:
+    virtual ~EncodedFrameTap() = default;
+  };
+
+  // Attaches a tap receiving every assembled frame. Pass nullptr to detach.
+  // |tap| must remain valid until it has been detached.
+  void SetEncodedFrameTap(EncodedFrameTap* tap);
+
   // Called by VideoReceiveStream when stats are updated.
   void UpdateRtt(int64_t max_rtt_ms);
 
   absl::optional<int64_t> LastReceivedPacketMs() const;
   absl::optional<int64_t> LastReceivedKeyframePacketMs() const;
 
+  // Number of payload bytes held by the packet buffer; thread-safe.
+  size_t PacketBufferMemoryUsage() const;
+  // Drops the contents of the packet buffer under memory pressure and
+  // requests a new key frame to recover. Returns the number of bytes
+  // released; thread-safe.
+  size_t TrimPacketBuffer();
+
   // RtpDemuxer only forwards a given RTP packet to one sink. However, some
   // sinks, such as FlexFEC, might wish to be informed of all of the packets
   // a given sink receives (or any set of sinks). They may do so by registering
@@ -327,6 +361,9 @@ class RtpVideoStreamReceiver : public LossNotificationSender,
   const std::unique_ptr<RtpRtcp> rtp_rtcp_;
 
   video_coding::OnCompleteFrameCallback* complete_frame_callback_;
+  rtc::CriticalSection encoded_frame_tap_lock_;
+  EncodedFrameTap* encoded_frame_tap_
+      RTC_GUARDED_BY(encoded_frame_tap_lock_) = nullptr;
   KeyFrameRequestSender* const keyframe_request_sender_;
 
   RtcpFeedbackBuffer rtcp_feedback_buffer_;
@@ -362,6 +399,11 @@ class RtpVideoStreamReceiver : public LossNotificationSender,
   // Maps payload id to the depacketizer.
   std::map<uint8_t, std::unique_ptr<VideoRtpDepacketizer>> payload_type_map_;
 
+  // Recycles the bitstream buffers that the depacketizers assemble frames
+  // into; RtpFrameObjects release their buffer back to the pool when the
+  // decoded frame is dropped.
+  EncodedImageBufferPool bitstream_buffer_pool_;
+
   // TODO(johan): Remove pt_codec_params_ once
   // https://bugs.chromium.org/p/webrtc/issues/detail?id=6883 is resolved.
   // Maps a payload type to a map of out-of-band supplied codec parameters.
@@ -391,6 +433,11 @@ class RtpVideoStreamReceiver : public LossNotificationSender,
   std::atomic<bool> frames_decryptable_;
   absl::optional<ColorSpace> last_color_space_;
 
+  // When true, assembled frames that no other frame depends on are dropped
+  // before reference resolution and decoding. See SetLoadShedding().
+  std::atomic<bool> load_shedding_{false};
+  int64_t num_frames_shed_ RTC_GUARDED_BY(network_tc_) = 0;
+
   AbsoluteCaptureTimeReceiver absolute_capture_time_receiver_
       RTC_GUARDED_BY(worker_task_checker_);
 
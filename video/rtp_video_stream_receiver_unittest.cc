@@ -1210,4 +1210,74 @@ TEST_P(RtpVideoStreamReceiverTestPlayoutDelay, PlayoutDelay) {
       received_packet.PayloadBuffer(), received_packet, video_header);
 }
 
+TEST_F(RtpVideoStreamReceiverTest, LoadSheddingDropsDiscardableDeltaFrames) {
+  rtc::CopyOnWriteBuffer data({1, 2, 3, 4});
+  RtpPacketReceived rtp_packet;
+  rtp_packet.SetPayloadType(kPayloadType);
+  rtp_packet.SetSequenceNumber(1);
+  mock_on_complete_frame_callback_.AppendExpectedBitstream(data.data(),
+                                                           data.size());
+  rtp_video_stream_receiver_->SetLoadShedding(true);
+
+  // Key frames are never shed.
+  RTPVideoHeader key_header =
+      GetGenericVideoHeader(VideoFrameType::kVideoFrameKey);
+  key_header.generic.emplace();
+  key_header.generic->frame_id = 1;
+  EXPECT_CALL(mock_on_complete_frame_callback_, DoOnCompleteFrame(_));
+  rtp_video_stream_receiver_->OnReceivedPayloadData(data, rtp_packet,
+                                                    key_header);
+
+  // A discardable delta frame is dropped before reference resolution.
+  rtp_packet.SetSequenceNumber(2);
+  RTPVideoHeader delta_header =
+      GetGenericVideoHeader(VideoFrameType::kVideoFrameDelta);
+  delta_header.generic.emplace();
+  delta_header.generic->frame_id = 2;
+  delta_header.generic->dependencies.push_back(1);
+  delta_header.generic->decode_target_indications.push_back(
+      DecodeTargetIndication::kDiscardable);
+  EXPECT_CALL(mock_on_complete_frame_callback_, DoOnCompleteFrame(_)).Times(0);
+  rtp_video_stream_receiver_->OnReceivedPayloadData(data, rtp_packet,
+                                                    delta_header);
+
+  // Once shedding is disabled, the same kind of frame is delivered again.
+  rtp_video_stream_receiver_->SetLoadShedding(false);
+  rtp_packet.SetSequenceNumber(3);
+  delta_header.generic->frame_id = 3;
+  EXPECT_CALL(mock_on_complete_frame_callback_, DoOnCompleteFrame(_));
+  rtp_video_stream_receiver_->OnReceivedPayloadData(data, rtp_packet,
+                                                    delta_header);
+}
+
+TEST_F(RtpVideoStreamReceiverTest, LoadSheddingKeepsReferencedFrames) {
+  rtc::CopyOnWriteBuffer data({1, 2, 3, 4});
+  RtpPacketReceived rtp_packet;
+  rtp_packet.SetPayloadType(kPayloadType);
+  rtp_packet.SetSequenceNumber(1);
+  mock_on_complete_frame_callback_.AppendExpectedBitstream(data.data(),
+                                                           data.size());
+  rtp_video_stream_receiver_->SetLoadShedding(true);
+
+  RTPVideoHeader key_header =
+      GetGenericVideoHeader(VideoFrameType::kVideoFrameKey);
+  key_header.generic.emplace();
+  key_header.generic->frame_id = 1;
+  EXPECT_CALL(mock_on_complete_frame_callback_, DoOnCompleteFrame(_));
+  rtp_video_stream_receiver_->OnReceivedPayloadData(data, rtp_packet,
+                                                    key_header);
+
+  // A delta frame other frames may depend on is delivered even while load
+  // shedding is active.
+  rtp_packet.SetSequenceNumber(2);
+  RTPVideoHeader delta_header =
+      GetGenericVideoHeader(VideoFrameType::kVideoFrameDelta);
+  delta_header.generic.emplace();
+  delta_header.generic->frame_id = 2;
+  delta_header.generic->dependencies.push_back(1);
+  EXPECT_CALL(mock_on_complete_frame_callback_, DoOnCompleteFrame(_));
+  rtp_video_stream_receiver_->OnReceivedPayloadData(data, rtp_packet,
+                                                    delta_header);
+}
+
 }  // namespace webrtc
@@ -730,20 +730,27 @@ void SendStatisticsProxy::OnSuspendChange(bool is_suspended) {
   }
 }
 
-VideoSendStream::Stats SendStatisticsProxy::GetStats() {
-  rtc::CritScope lock(&crit_);
-  PurgeOldStats();
-  stats_.input_frame_rate =
-      round(uma_container_->input_frame_rate_tracker_.ComputeRate());
-  stats_.content_type =
-      content_type_ == VideoEncoderConfig::ContentType::kRealtimeVideo
-          ? VideoContentType::UNSPECIFIED
-          : VideoContentType::SCREENSHARE;
-  stats_.encode_frame_rate = round(encoded_frame_rate_tracker_.ComputeRate());
-  stats_.media_bitrate_bps = media_byte_rate_tracker_.ComputeRate() * 8;
-  stats_.quality_limitation_durations_ms =
-      quality_limitation_reason_tracker_.DurationsMs();
-  return stats_;
+const VideoSendStream::Stats& SendStatisticsProxy::GetStats() {
+  VideoSendStream::Stats& snapshot = snapshots_[snapshot_generation_ % 2];
+  {
+    rtc::CritScope lock(&crit_);
+    PurgeOldStats();
+    stats_.input_frame_rate =
+        round(uma_container_->input_frame_rate_tracker_.ComputeRate());
+    stats_.content_type =
+        content_type_ == VideoEncoderConfig::ContentType::kRealtimeVideo
+            ? VideoContentType::UNSPECIFIED
+            : VideoContentType::SCREENSHARE;
+    stats_.encode_frame_rate = round(encoded_frame_rate_tracker_.ComputeRate());
+    stats_.media_bitrate_bps = media_byte_rate_tracker_.ComputeRate() * 8;
+    stats_.quality_limitation_durations_ms =
+        quality_limitation_reason_tracker_.DurationsMs();
+    // Copy-assignment into the warm buffer reuses its substream map nodes and
+    // string storage, so sealing does not allocate in steady state.
+    snapshot = stats_;
+  }
+  ++snapshot_generation_;
+  return snapshot;
 }
 
 void SendStatisticsProxy::PurgeOldStats() {
@@ -55,7 +55,13 @@ class SendStatisticsProxy : public VideoStreamEncoderObserver,
                       VideoEncoderConfig::ContentType content_type);
   ~SendStatisticsProxy() override;
 
-  virtual VideoSendStream::Stats GetStats();
+  // Seals and returns a snapshot of the current stats. The returned reference
+  // stays valid until the second-next call. Callers are expected to poll from
+  // a single stats-gathering thread; concurrent calls are not supported. The
+  // encoder and RTP threads are only blocked while the snapshot buffer is
+  // refreshed in place, which reuses the map nodes and string storage of a
+  // previous generation instead of deep-copying under the lock.
+  virtual const VideoSendStream::Stats& GetStats();
 
   void OnSendEncodedImage(const EncodedImage& encoded_image,
                           const CodecSpecificInfo* codec_info) override;
@@ -279,6 +285,14 @@ class SendStatisticsProxy : public VideoStreamEncoderObserver,
   VideoEncoderConfig::ContentType content_type_ RTC_GUARDED_BY(crit_);
   const int64_t start_ms_;
   VideoSendStream::Stats stats_ RTC_GUARDED_BY(crit_);
+  // Double-buffered snapshots handed out by GetStats(). A seal copies |stats_|
+  // into the buffer the call before last wrote, so its allocations are reused,
+  // and the buffer returned by the previous call stays untouched. Written
+  // under |crit_| but read by the polling thread after the lock is released;
+  // safe since GetStats() calls do not overlap.
+  VideoSendStream::Stats snapshots_[2];
+  // Number of sealed snapshots; the buffer being sealed is generation % 2.
+  uint64_t snapshot_generation_ = 0;
   std::map<uint32_t, StatsUpdateTimes> update_times_ RTC_GUARDED_BY(crit_);
   rtc::ExpFilter encode_time_ RTC_GUARDED_BY(crit_);
   QualityLimitationReasonTracker quality_limitation_reason_tracker_
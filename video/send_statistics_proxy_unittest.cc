@@ -374,13 +374,15 @@ TEST_F(SendStatisticsProxyTest, OnSendEncodedImageIncreasesQpSum) {
   CodecSpecificInfo codec_info;
   auto ssrc = config_.rtp.ssrcs[0];
   EXPECT_EQ(absl::nullopt,
-            statistics_proxy_->GetStats().substreams[ssrc].qp_sum);
+            VideoSendStream::Stats(statistics_proxy_->GetStats())
+                .substreams[ssrc]
+                .qp_sum);
   encoded_image.qp_ = 3;
   statistics_proxy_->OnSendEncodedImage(encoded_image, &codec_info);
-  EXPECT_EQ(3u, statistics_proxy_->GetStats().substreams[ssrc].qp_sum);
+  EXPECT_EQ(3u, statistics_proxy_->GetStats().substreams.at(ssrc).qp_sum);
   encoded_image.qp_ = 127;
   statistics_proxy_->OnSendEncodedImage(encoded_image, &codec_info);
-  EXPECT_EQ(130u, statistics_proxy_->GetStats().substreams[ssrc].qp_sum);
+  EXPECT_EQ(130u, statistics_proxy_->GetStats().substreams.at(ssrc).qp_sum);
 }
 
 TEST_F(SendStatisticsProxyTest, OnSendEncodedImageWithoutQpQpSumWontExist) {
@@ -389,10 +391,12 @@ TEST_F(SendStatisticsProxyTest, OnSendEncodedImageWithoutQpQpSumWontExist) {
   auto ssrc = config_.rtp.ssrcs[0];
   encoded_image.qp_ = -1;
   EXPECT_EQ(absl::nullopt,
-            statistics_proxy_->GetStats().substreams[ssrc].qp_sum);
+            VideoSendStream::Stats(statistics_proxy_->GetStats())
+                .substreams[ssrc]
+                .qp_sum);
   statistics_proxy_->OnSendEncodedImage(encoded_image, &codec_info);
   EXPECT_EQ(absl::nullopt,
-            statistics_proxy_->GetStats().substreams[ssrc].qp_sum);
+            statistics_proxy_->GetStats().substreams.at(ssrc).qp_sum);
 }
 
 TEST_F(SendStatisticsProxyTest, TotalEncodedBytesTargetFirstFrame) {
@@ -0,0 +1,29 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#include "video/stats_histogram_drain.h"
+
+#include <memory>
+
+#include "api/task_queue/default_task_queue_factory.h"
+#include "api/task_queue/task_queue_factory.h"
+
+namespace webrtc {
+
+rtc::TaskQueue* GetStatsHistogramDrainQueue() {
+  // The factory only needs to stay alive for the creation of the queue; the
+  // queue owns its worker thread.
+  static rtc::TaskQueue* const queue =
+      new rtc::TaskQueue(CreateDefaultTaskQueueFactory()->CreateTaskQueue(
+          "StatsHistogramDrain", TaskQueueFactory::Priority::LOW));
+  return queue;
+}
+
+}  // namespace webrtc
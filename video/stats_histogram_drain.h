@@ -0,0 +1,28 @@
+/*
+ *  Copyright (c) 2019 The WebRTC project authors. All Rights Reserved.
+ *
+ *  Use of this source code is governed by a BSD-style license
+ *  that can be found in the LICENSE file in the root of the source
+ *  tree. An additional intellectual property rights grant can be found
+ *  in the file PATENTS.  All contributing project authors may
+ *  be found in the AUTHORS file in the root of the source tree.
+ */
+
+#ifndef VIDEO_STATS_HISTOGRAM_DRAIN_H_
+#define VIDEO_STATS_HISTOGRAM_DRAIN_H_
+
+#include "rtc_base/task_queue.h"
+
+namespace webrtc {
+
+// Returns the process-wide, low-priority task queue on which stats proxies
+// finalize UMA histograms at stream teardown. Building histogram names and
+// looking them up in the global registry is slow enough to stall the worker
+// thread noticeably when many streams are torn down at once, so the work is
+// posted here instead of running inline. Created on first use and
+// intentionally never deleted.
+rtc::TaskQueue* GetStatsHistogramDrainQueue();
+
+}  // namespace webrtc
+
+#endif  // VIDEO_STATS_HISTOGRAM_DRAIN_H_
@@ -33,12 +33,14 @@
 #include "common_video/include/incoming_video_stream.h"
 #include "media/base/h264_profile_level_id.h"
 #include "modules/utility/include/process_thread.h"
+#include "modules/video_coding/decoder_database.h"
 #include "modules/video_coding/include/video_codec_interface.h"
 #include "modules/video_coding/include/video_coding_defines.h"
 #include "modules/video_coding/include/video_error_codes.h"
 #include "modules/video_coding/timing.h"
 #include "modules/video_coding/utility/vp8_header_parser.h"
 #include "rtc_base/checks.h"
+#include "rtc_base/experiments/field_trial_parser.h"
 #include "rtc_base/experiments/keyframe_interval_settings.h"
 #include "rtc_base/location.h"
 #include "rtc_base/logging.h"
@@ -51,6 +53,7 @@
 #include "video/call_stats.h"
 #include "video/frame_dumping_decoder.h"
 #include "video/receive_statistics_proxy.h"
+#include "video/stats_histogram_drain.h"
 
 namespace webrtc {
 
@@ -178,6 +181,25 @@ class NullVideoDecoder : public webrtc::VideoDecoder {
 // timestamps wraparound to affect FrameBuffer.
 constexpr int kInactiveStreamThresholdMs = 600000;  //  10 minutes.
 
+// Watermarks for the receive-side load shedder, overridable through the
+// "WebRTC-ReceiverLoadShedding" field trial. See the member documentation
+// in video_receive_stream.h for their meaning.
+struct LoadShedderConfig {
+  int high_watermark = 8;
+  int low_watermark = 2;
+};
+
+LoadShedderConfig ReadLoadShedderConfig() {
+  LoadShedderConfig config;
+  FieldTrialParameter<int> high_watermark("high", config.high_watermark);
+  FieldTrialParameter<int> low_watermark("low", config.low_watermark);
+  ParseFieldTrial({&high_watermark, &low_watermark},
+                  field_trial::FindFullName("WebRTC-ReceiverLoadShedding"));
+  config.high_watermark = high_watermark.Get();
+  config.low_watermark = low_watermark.Get();
+  return config;
+}
+
 }  // namespace
 
 namespace internal {
@@ -230,6 +252,10 @@ VideoReceiveStream::VideoReceiveStream(
           TaskQueueFactory::Priority::HIGH)) {
   RTC_LOG(LS_INFO) << "VideoReceiveStream: " << config_.ToString();
 
+  const LoadShedderConfig load_shedder_config = ReadLoadShedderConfig();
+  load_shed_high_watermark_ = load_shedder_config.high_watermark;
+  load_shed_low_watermark_ = load_shedder_config.low_watermark;
+
   RTC_DCHECK(config_.renderer);
   RTC_DCHECK(process_thread_);
   RTC_DCHECK(call_stats_);
@@ -252,6 +278,15 @@ VideoReceiveStream::VideoReceiveStream(
 
   frame_buffer_.reset(
       new video_coding::FrameBuffer(clock_, timing_.get(), &stats_proxy_));
+  if (config_.enable_low_latency_decoding)
+    frame_buffer_->SetLowLatencyMode(true);
+  // Decode-ahead relies on the prerenderer smoothing queue to hold early
+  // decoded frames until their render time; without it they would render
+  // early, so the option is ignored.
+  if (config_.max_decode_ahead_frames > 0 &&
+      config_.enable_prerenderer_smoothing) {
+    frame_buffer_->SetMaxDecodeAheadFrames(config_.max_decode_ahead_frames);
+  }
 
   process_thread_->RegisterModule(&rtp_stream_sync_, RTC_FROM_HERE);
   // Register with RtpStreamReceiverController.
@@ -292,6 +327,9 @@ VideoReceiveStream::~VideoReceiveStream() {
   RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
   RTC_LOG(LS_INFO) << "~VideoReceiveStream: " << config_.ToString();
   Stop();
+  // Decoders parked by Stop() may reference the decoder factory, whose
+  // lifetime this stream does not control beyond its own.
+  VideoDecoderInstanceCache::GetInstance()->EvictOwner(this);
   process_thread_->DeRegisterModule(&rtp_stream_sync_);
 }
 
@@ -337,9 +375,21 @@ void VideoReceiveStream::Start() {
   }
 
   for (const Decoder& decoder : config_.decoders) {
+    // Reattach a decoder parked by an earlier Stop() if one matches; going
+    // through the factory can cost hundreds of milliseconds for hardware
+    // decoders.
+    const std::string decoder_cache_key = VideoDecoderInstanceCache::MakeKey(
+        decoder.video_format, config_.stream_id);
     std::unique_ptr<VideoDecoder> video_decoder =
-        decoder.decoder_factory->LegacyCreateVideoDecoder(decoder.video_format,
-                                                          config_.stream_id);
+        VideoDecoderInstanceCache::GetInstance()->Retrieve(this,
+                                                           decoder_cache_key);
+    if (!video_decoder) {
+      video_decoder = decoder.decoder_factory->LegacyCreateVideoDecoder(
+          decoder.video_format, config_.stream_id);
+    }
+    // Null decoders and decoders wrapped for frame dumping below should not
+    // be parked for reuse.
+    bool decoder_cacheable = video_decoder != nullptr;
     // If we still have no valid decoder, we have to create a "Null" decoder
     // that ignores all calls. The reason we can get into this state is that the
     // old decoder factory interface doesn't have a way to query supported
@@ -365,9 +415,12 @@ void VideoReceiveStream::Start() {
           << ".ivf";
       video_decoder = CreateFrameDumpingDecoderWrapper(
           std::move(video_decoder), FileWrapper::OpenWriteOnly(ssb.str()));
+      decoder_cacheable = false;
     }
 
     video_decoders_.push_back(std::move(video_decoder));
+    video_decoder_cache_keys_.push_back(decoder_cacheable ? decoder_cache_key
+                                                          : std::string());
 
     video_receiver_.RegisterExternalDecoder(video_decoders_.back().get(),
                                             decoder.payload_type);
@@ -431,6 +484,18 @@ void VideoReceiveStream::Stop() {
     for (const Decoder& decoder : config_.decoders)
       video_receiver_.RegisterExternalDecoder(nullptr, decoder.payload_type);
 
+    // Park the decoders for fast reattachment when this stream is started
+    // again. An empty key marks a decoder that should not be reused.
+    RTC_DCHECK_EQ(video_decoders_.size(), video_decoder_cache_keys_.size());
+    for (size_t i = 0; i < video_decoders_.size(); ++i) {
+      if (!video_decoder_cache_keys_[i].empty()) {
+        VideoDecoderInstanceCache::GetInstance()->Park(
+            this, video_decoder_cache_keys_[i], std::move(video_decoders_[i]));
+      }
+    }
+    video_decoders_.clear();
+    video_decoder_cache_keys_.clear();
+
     UpdateHistograms();
   }
 
@@ -466,17 +531,28 @@ void VideoReceiveStream::UpdateHistograms() {
     fraction_lost = statistician->GetFractionLostInPercent();
     rtp_stats = statistician->GetReceiveStreamDataCounters();
   }
-  if (config_.rtp.rtx_ssrc) {
-    StreamStatistician* rtx_statistician =
-        rtp_receive_statistics_->GetStatistician(config_.rtp.rtx_ssrc);
-    if (rtx_statistician) {
-      StreamDataCounters rtx_stats =
-          rtx_statistician->GetReceiveStreamDataCounters();
-      stats_proxy_.UpdateHistograms(fraction_lost, rtp_stats, &rtx_stats);
-      return;
-    }
-  }
-  stats_proxy_.UpdateHistograms(fraction_lost, rtp_stats, nullptr);
+  std::unique_ptr<ReceiveStatisticsProxy::HistogramSnapshot> snapshot;
+  StreamStatistician* rtx_statistician =
+      config_.rtp.rtx_ssrc
+          ? rtp_receive_statistics_->GetStatistician(config_.rtp.rtx_ssrc)
+          : nullptr;
+  if (rtx_statistician) {
+    StreamDataCounters rtx_stats =
+        rtx_statistician->GetReceiveStreamDataCounters();
+    snapshot =
+        stats_proxy_.TakeHistogramSnapshot(fraction_lost, rtp_stats, &rtx_stats);
+  } else {
+    snapshot =
+        stats_proxy_.TakeHistogramSnapshot(fraction_lost, rtp_stats, nullptr);
+  }
+  // Recording the histograms builds dozens of histogram names and looks them
+  // up in the global registry; when many streams are torn down at once this
+  // stalls the worker thread noticeably. Drain the snapshot on the shared
+  // background queue instead; it does not reference |this|.
+  GetStatsHistogramDrainQueue()->PostTask(
+      [snapshot = std::move(snapshot)]() {
+        ReceiveStatisticsProxy::RecordHistograms(*snapshot);
+      });
 }
 
 void VideoReceiveStream::AddSecondarySink(RtpPacketSinkInterface* sink) {
@@ -542,6 +618,11 @@ void VideoReceiveStream::SetDepacketizerToDecoderFrameTransformer(
       std::move(frame_transformer));
 }
 
+void VideoReceiveStream::SetEncodedFrameTap(
+    RtpVideoStreamReceiver::EncodedFrameTap* tap) {
+  rtp_video_stream_receiver_.SetEncodedFrameTap(tap);
+}
+
 void VideoReceiveStream::SendNack(const std::vector<uint16_t>& sequence_numbers,
                                   bool buffering_allowed) {
   RTC_DCHECK(buffering_allowed);
@@ -580,6 +661,23 @@ void VideoReceiveStream::OnCompleteFrame(
   int64_t last_continuous_pid = frame_buffer_->InsertFrame(std::move(frame));
   if (last_continuous_pid != -1)
     rtp_video_stream_receiver_.FrameContinuous(last_continuous_pid);
+
+  // Under decode-queue pressure, have the rtp receiver early-drop
+  // non-reference frames until the backlog has drained, so that overload
+  // degrades temporal resolution gracefully instead of filling the buffer
+  // until frames are dropped after full assembly.
+  if (load_shed_high_watermark_ > 0) {
+    const size_t backlog = frame_buffer_->Size();
+    if (!load_shedding_active_ &&
+        backlog > static_cast<size_t>(load_shed_high_watermark_)) {
+      load_shedding_active_ = true;
+      rtp_video_stream_receiver_.SetLoadShedding(true);
+    } else if (load_shedding_active_ &&
+               backlog <= static_cast<size_t>(load_shed_low_watermark_)) {
+      load_shedding_active_ = false;
+      rtp_video_stream_receiver_.SetLoadShedding(false);
+    }
+  }
 }
 
 void VideoReceiveStream::OnRttUpdate(int64_t avg_rtt_ms, int64_t max_rtt_ms) {
@@ -12,6 +12,7 @@
 #define VIDEO_VIDEO_RECEIVE_STREAM_H_
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "api/task_queue/task_queue_factory.h"
@@ -102,6 +103,11 @@ class VideoReceiveStream : public webrtc::VideoReceiveStream,
   void SetDepacketizerToDecoderFrameTransformer(
       rtc::scoped_refptr<FrameTransformerInterface> frame_transformer) override;
 
+  // Attaches a tap receiving every assembled encoded frame before decoding,
+  // e.g. for recording without a decode/re-encode round trip. Pass nullptr
+  // to detach. |tap| must remain valid until it has been detached.
+  void SetEncodedFrameTap(RtpVideoStreamReceiver::EncodedFrameTap* tap);
+
   // Implements rtc::VideoSinkInterface<VideoFrame>.
   void OnFrame(const VideoFrame& video_frame) override;
 
@@ -184,6 +190,10 @@ class VideoReceiveStream : public webrtc::VideoReceiveStream,
   // TODO(nisse, philipel): Creation and ownership of video encoders should be
   // moved to the new VideoStreamDecoder.
   std::vector<std::unique_ptr<VideoDecoder>> video_decoders_;
+  // Cache keys under which the corresponding entries of |video_decoders_|
+  // are parked in the VideoDecoderInstanceCache on Stop(). An empty string
+  // marks a decoder that must not be reused.
+  std::vector<std::string> video_decoder_cache_keys_;
 
   // Members for the new jitter buffer experiment.
   std::unique_ptr<video_coding::FrameBuffer> frame_buffer_;
@@ -202,6 +212,15 @@ class VideoReceiveStream : public webrtc::VideoReceiveStream,
   int64_t last_keyframe_request_ms_ = 0;
   int64_t last_complete_frame_time_ms_ = 0;
 
+  // Load shedding: when more frames than |load_shed_high_watermark_| are
+  // waiting in |frame_buffer_|, the rtp receiver is told to early-drop
+  // non-reference frames until the backlog is back at or below
+  // |load_shed_low_watermark_|. A non-positive high watermark disables the
+  // mechanism. Both are set once in the constructor, from a field trial.
+  int load_shed_high_watermark_;
+  int load_shed_low_watermark_;
+  bool load_shedding_active_ RTC_GUARDED_BY(network_sequence_checker_) = false;
+
   // Keyframe request intervals are configurable through field trials.
   const int max_wait_for_keyframe_ms_;
   const int max_wait_for_frame_ms_;
@@ -249,6 +249,15 @@ VideoReceiveStream2::VideoReceiveStream2(
 
   frame_buffer_.reset(
       new video_coding::FrameBuffer(clock_, timing_.get(), &stats_proxy_));
+  if (config_.enable_low_latency_decoding)
+    frame_buffer_->SetLowLatencyMode(true);
+  // Decode-ahead relies on the prerenderer smoothing queue to hold early
+  // decoded frames until their render time; without it they would render
+  // early, so the option is ignored.
+  if (config_.max_decode_ahead_frames > 0 &&
+      config_.enable_prerenderer_smoothing) {
+    frame_buffer_->SetMaxDecodeAheadFrames(config_.max_decode_ahead_frames);
+  }
 
   // Register with RtpStreamReceiverController.
   media_receiver_ = receiver_controller->CreateReceiver(
@@ -415,6 +424,14 @@ void VideoReceiveStream2::Stop() {
   transport_adapter_.Disable();
 }
 
+size_t VideoReceiveStream2::PacketBufferMemoryUsage() const {
+  return rtp_video_stream_receiver_.PacketBufferMemoryUsage();
+}
+
+size_t VideoReceiveStream2::TrimPacketBuffer() {
+  return rtp_video_stream_receiver_.TrimPacketBuffer();
+}
+
 VideoReceiveStream::Stats VideoReceiveStream2::GetStats() const {
   RTC_DCHECK_RUN_ON(&worker_sequence_checker_);
   VideoReceiveStream2::Stats stats = stats_proxy_.GetStats();
@@ -110,6 +110,10 @@ class VideoReceiveStream2 : public webrtc::VideoReceiveStream,
 
   webrtc::VideoReceiveStream::Stats GetStats() const override;
 
+  // Memory accounting hooks for the per-call memory budget; thread-safe.
+  size_t PacketBufferMemoryUsage() const;
+  size_t TrimPacketBuffer();
+
   void AddSecondarySink(RtpPacketSinkInterface* sink) override;
   void RemoveSecondarySink(const RtpPacketSinkInterface* sink) override;
 
@@ -149,12 +149,14 @@ void VideoSendStream::UpdateActiveSimulcastLayers(
                    << active_layers_string.str();
 
   VideoSendStreamImpl* send_stream = send_stream_.get();
-  worker_queue_->PostTask([this, send_stream, active_layers] {
+  // Fire and forget: there is no result to hand back, and tasks on
+  // |worker_queue_| run in order, so Start(), Stop() and the teardown task in
+  // StopPermanentlyAndGetRtpStates() all observe the update. Blocking here
+  // serializes stream setup on the worker when many streams (re)activate at
+  // once.
+  worker_queue_->PostTask([send_stream, active_layers] {
     send_stream->UpdateActiveSimulcastLayers(active_layers);
-    thread_sync_event_.Set();
   });
-
-  thread_sync_event_.Wait(rtc::Event::kForever);
 }
 
 void VideoSendStream::Start() {
@@ -228,5 +230,15 @@ void VideoSendStream::DeliverRtcp(const uint8_t* packet, size_t length) {
   send_stream_->DeliverRtcp(packet, length);
 }
 
+size_t VideoSendStream::GetPacketHistoryMemoryUsage() const {
+  // May be called from any thread; |send_stream_| is valid until
+  // StopPermanentlyAndGetRtpStates() and the histories do their own locking.
+  return send_stream_->GetPacketHistoryMemoryUsage();
+}
+
+size_t VideoSendStream::TrimPacketHistories(size_t bytes) {
+  return send_stream_->TrimPacketHistories(bytes);
+}
+
 }  // namespace internal
 }  // namespace webrtc
@@ -88,6 +88,12 @@ class VideoSendStream : public webrtc::VideoSendStream {
   void StopPermanentlyAndGetRtpStates(RtpStateMap* rtp_state_map,
                                       RtpPayloadStateMap* payload_state_map);
 
+  // Memory accounting hooks for the per-call memory budget. Thread-safe; may
+  // be called from any thread between construction and
+  // StopPermanentlyAndGetRtpStates().
+  size_t GetPacketHistoryMemoryUsage() const;
+  size_t TrimPacketHistories(size_t bytes);
+
  private:
   friend class test::VideoSendStreamPeer;
 
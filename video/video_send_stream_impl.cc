@@ -572,6 +572,9 @@ EncodedImageCallback::Result VideoSendStreamImpl::OnEncodedImage(
     enable_padding_task();
   }
 
+  if (encoded_image._frameType == VideoFrameType::kVideoFrameKey)
+    encoder_feedback_.OnKeyFrameEncoded();
+
   EncodedImageCallback::Result result(EncodedImageCallback::Result::OK);
   result = rtp_video_sender_->OnEncodedImage(encoded_image, codec_specific_info,
                                              fragmentation);
@@ -605,6 +608,14 @@ std::map<uint32_t, RtpState> VideoSendStreamImpl::GetRtpStates() const {
   return rtp_video_sender_->GetRtpStates();
 }
 
+size_t VideoSendStreamImpl::GetPacketHistoryMemoryUsage() const {
+  return rtp_video_sender_->GetPacketHistoryMemoryUsage();
+}
+
+size_t VideoSendStreamImpl::TrimPacketHistories(size_t bytes) {
+  return rtp_video_sender_->TrimPacketHistories(bytes);
+}
+
 std::map<uint32_t, RtpPayloadState> VideoSendStreamImpl::GetRtpPayloadStates()
     const {
   return rtp_video_sender_->GetRtpPayloadStates();
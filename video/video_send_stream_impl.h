@@ -107,6 +107,11 @@ class VideoSendStreamImpl : public webrtc::BitrateAllocatorObserver,
 
   std::map<uint32_t, RtpPayloadState> GetRtpPayloadStates() const;
 
+  // Memory accounting hooks for the per-call memory budget; thread-safe, may
+  // be called while the stream exists regardless of the worker queue.
+  size_t GetPacketHistoryMemoryUsage() const;
+  size_t TrimPacketHistories(size_t bytes);
+
   absl::optional<float> configured_pacing_factor_;
 
  private:
@@ -95,6 +95,8 @@ class MockRtpVideoSender : public RtpVideoSenderInterface {
               GetSentRtpPacketInfos,
               (uint32_t ssrc, rtc::ArrayView<const uint16_t> sequence_numbers),
               (const, override));
+  MOCK_METHOD(size_t, GetPacketHistoryMemoryUsage, (), (const, override));
+  MOCK_METHOD(size_t, TrimPacketHistories, (size_t bytes), (override));
 
   MOCK_METHOD(void, SetFecAllowed, (bool fec_allowed), (override));
 };
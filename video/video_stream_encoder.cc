@@ -35,6 +35,7 @@
 #include "rtc_base/location.h"
 #include "rtc_base/logging.h"
 #include "rtc_base/strings/string_builder.h"
+#include "rtc_base/task_queue_mpsc.h"
 #include "rtc_base/time_utils.h"
 #include "rtc_base/trace_event.h"
 #include "system_wrappers/include/field_trial.h"
@@ -270,9 +271,26 @@ VideoStreamEncoder::VideoStreamEncoder(
       resource_adaptation_queue_(task_queue_factory->CreateTaskQueue(
           "ResourceAdaptationQueue",
           TaskQueueFactory::Priority::NORMAL)),
-      encoder_queue_(task_queue_factory->CreateTaskQueue(
-          "EncoderQueue",
-          TaskQueueFactory::Priority::NORMAL)) {
+      encoder_queue_(
+          // The encoder queue is posted to for every captured frame and
+          // every encoded-image callback; the lock-free MPSC task queue
+          // makes those posts cheap. It runs on its own real thread, so
+          // leave it behind a field trial for tests that inject a
+          // time-controlling |task_queue_factory|.
+          field_trial::IsEnabled("WebRTC-MpscTaskQueue")
+              ? CreateTaskQueueMpscFactory()->CreateTaskQueue(
+                    "EncoderQueue",
+                    TaskQueueFactory::Priority::NORMAL)
+              : task_queue_factory->CreateTaskQueue(
+                    "EncoderQueue",
+                    TaskQueueFactory::Priority::NORMAL)),
+      packetization_queue_(
+          field_trial::IsEnabled("WebRTC-PipelinedEncodePacketization")
+              ? std::make_unique<rtc::TaskQueue>(
+                    task_queue_factory->CreateTaskQueue(
+                        "PacketizationQueue",
+                        TaskQueueFactory::Priority::NORMAL))
+              : nullptr) {
   RTC_DCHECK(encoder_stats_observer);
   RTC_DCHECK_GE(number_of_cores, 1);
 
@@ -333,6 +351,14 @@ void VideoStreamEncoder::Stop() {
     shutdown_event_.Set();
   });
   shutdown_event_.Wait(rtc::Event::kForever);
+  if (packetization_queue_) {
+    // Flush frames already handed over for packetization; the sink may be
+    // destroyed once Stop() returns.
+    rtc::Event packetization_flushed_event;
+    packetization_queue_->PostTask(
+        [&packetization_flushed_event] { packetization_flushed_event.Set(); });
+    packetization_flushed_event.Wait(rtc::Event::kForever);
+  }
 }
 
 void VideoStreamEncoder::SetBitrateAllocationObserver(
@@ -1225,10 +1251,12 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
   const bool is_buffer_type_supported =
       buffer_type == VideoFrameBuffer::Type::kI420 ||
       (buffer_type == VideoFrameBuffer::Type::kNative &&
-       info.supports_native_handle);
+       info.supports_native_handle) ||
+      absl::c_linear_search(info.preferred_pixel_formats, buffer_type);
 
   if (!is_buffer_type_supported) {
-    // This module only supports software encoding.
+    // The encoder can neither consume this buffer type natively nor via a
+    // native handle; fall back to software encoding in I420.
     rtc::scoped_refptr<I420BufferInterface> converted_buffer(
         out_frame.video_frame_buffer()->ToI420());
 
@@ -1269,16 +1297,16 @@ void VideoStreamEncoder::EncodeVideoFrame(const VideoFrame& video_frame,
     // happen after SinkWants signaled correctly from ReconfigureEncoder.
     VideoFrame::UpdateRect update_rect = video_frame.update_rect();
     if (crop_width_ < 4 && crop_height_ < 4) {
-      cropped_buffer->CropAndScaleFrom(*i420_buffer, crop_width_ / 2,
-                                       crop_height_ / 2, cropped_width,
-                                       cropped_height);
+      cropped_buffer->CropAndScaleFromParallel(*i420_buffer, crop_width_ / 2,
+                                               crop_height_ / 2, cropped_width,
+                                               cropped_height);
       update_rect.offset_x -= crop_width_ / 2;
       update_rect.offset_y -= crop_height_ / 2;
       update_rect.Intersect(
           VideoFrame::UpdateRect{0, 0, cropped_width, cropped_height});
 
     } else {
-      cropped_buffer->ScaleFrom(*i420_buffer);
+      cropped_buffer->ScaleFromParallel(*i420_buffer);
       if (!update_rect.IsEmpty()) {
         // Since we can't reason about pixels after scaling, we invalidate whole
         // picture, if anything changed.
@@ -1495,9 +1523,34 @@ EncodedImageCallback::Result VideoStreamEncoder::OnEncodedImage(
     simulcast_id = encoded_image.SpatialIndex().value_or(0);
   }
 
-  EncodedImageCallback::Result result = sink_->OnEncodedImage(
-      image_copy, codec_specific_info,
-      fragmentation_copy ? fragmentation_copy.get() : fragmentation);
+  EncodedImageCallback::Result result(Result::OK, image_copy.Timestamp());
+  if (packetization_queue_) {
+    // Pipelined mode: hand the frame over so that the encoder is free to
+    // start on the next frame while this one is packetized and protected.
+    // A drop request from the sink is signaled one frame late through
+    // |pending_frame_drops_|, the same path internal encoders use.
+    if (!fragmentation_copy && fragmentation) {
+      fragmentation_copy = std::make_unique<RTPFragmentationHeader>();
+      fragmentation_copy->CopyFrom(*fragmentation);
+    }
+    absl::optional<CodecSpecificInfo> codec_info_copy;
+    if (codec_specific_info)
+      codec_info_copy = *codec_specific_info;
+    EncoderSink* sink = sink_;
+    packetization_queue_->PostTask(
+        [this, sink, image = image_copy, codec_info_copy,
+         frag = std::move(fragmentation_copy)] {
+          EncodedImageCallback::Result sink_result = sink->OnEncodedImage(
+              image, codec_info_copy ? &*codec_info_copy : nullptr,
+              frag.get());
+          if (sink_result.error == Result::OK && sink_result.drop_next_frame)
+            pending_frame_drops_.fetch_add(1);
+        });
+  } else {
+    result = sink_->OnEncodedImage(
+        image_copy, codec_specific_info,
+        fragmentation_copy ? fragmentation_copy.get() : fragmentation);
+  }
 
   // We are only interested in propagating the meta-data about the image, not
   // encoded data itself, to the post encode function. Since we cannot be sure
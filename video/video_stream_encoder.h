@@ -427,6 +427,13 @@ class VideoStreamEncoder : public VideoStreamEncoderInterface,
   // multi-stream aware.
   rtc::TaskQueue resource_adaptation_queue_;
   rtc::TaskQueue encoder_queue_;
+  // Present in pipelined mode (see the WebRTC-PipelinedEncodePacketization
+  // field trial). Encoded frames are handed over to this queue for
+  // packetization and FEC generation, so that the encoder is free to start on
+  // the next frame while the previous one is still being sent. Null when the
+  // sink is called synchronously from the encode complete callback (the
+  // default).
+  std::unique_ptr<rtc::TaskQueue> packetization_queue_;
 
   RTC_DISALLOW_COPY_AND_ASSIGN(VideoStreamEncoder);
 };
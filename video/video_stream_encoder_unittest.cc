@@ -478,7 +478,7 @@ class MockableSendStatisticsProxy : public SendStatisticsProxy {
                               VideoEncoderConfig::ContentType content_type)
       : SendStatisticsProxy(clock, config, content_type) {}
 
-  VideoSendStream::Stats GetStats() override {
+  const VideoSendStream::Stats& GetStats() override {
     rtc::CritScope cs(&lock_);
     if (mock_stats_)
       return *mock_stats_;
@@ -1313,6 +1313,24 @@ TEST_F(VideoStreamEncoderTest, EncodeOneFrame) {
   video_stream_encoder_->Stop();
 }
 
+TEST_F(VideoStreamEncoderTest, EncodeOneFrameWithPipelinedPacketization) {
+  test::ScopedFieldTrials field_trials(
+      "WebRTC-PipelinedEncodePacketization/Enabled/");
+  // Recreate the encoder so that it picks up the field trial.
+  ConfigureEncoder(video_encoder_config_.Copy());
+
+  video_stream_encoder_->OnBitrateUpdatedAndWaitForManagedResources(
+      DataRate::BitsPerSec(kTargetBitrateBps),
+      DataRate::BitsPerSec(kTargetBitrateBps),
+      DataRate::BitsPerSec(kTargetBitrateBps), 0, 0, 0);
+  rtc::Event frame_destroyed_event;
+  video_source_.IncomingCapturedFrame(CreateFrame(1, &frame_destroyed_event));
+  // The frame reaches the sink through the packetization queue.
+  WaitForEncodedFrame(1);
+  EXPECT_TRUE(frame_destroyed_event.Wait(kDefaultTimeoutMs));
+  video_stream_encoder_->Stop();
+}
+
 TEST_F(VideoStreamEncoderTest, DropsFramesBeforeFirstOnBitrateUpdated) {
   // Dropped since no target bitrate has been set.
   rtc::Event frame_destroyed_event;